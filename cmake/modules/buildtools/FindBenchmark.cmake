@@ -0,0 +1,60 @@
+#.rst:
+# FindBenchmark
+# -------------
+# Finds the google benchmark library
+#
+# This will define the following variables::
+#
+# BENCHMARK_FOUND - system has google benchmark
+# BENCHMARK_INCLUDE_DIRS - the google benchmark include directories
+# BENCHMARK_LIBRARIES - the google benchmark libraries
+#
+# and the following imported targets:
+#
+#   Benchmark::Benchmark   - The google benchmark library
+
+if(Benchmark_FIND_VERSION)
+  if(Benchmark_FIND_VERSION_EXACT)
+    set(Benchmark_FIND_SPEC "=${Benchmark_FIND_VERSION_COMPLETE}")
+  else()
+    set(Benchmark_FIND_SPEC ">=${Benchmark_FIND_VERSION_COMPLETE}")
+  endif()
+endif()
+
+find_package(PkgConfig ${SEARCH_QUIET})
+if(PKG_CONFIG_FOUND)
+  pkg_check_modules(PC_BENCHMARK benchmark${Benchmark_FIND_SPEC} ${SEARCH_QUIET})
+  set(BENCHMARK_VERSION ${PC_BENCHMARK_VERSION})
+elseif(WIN32)
+  set(BENCHMARK_VERSION ${Benchmark_FIND_VERSION_COMPLETE})
+endif()
+
+find_path(BENCHMARK_INCLUDE_DIR NAMES benchmark/benchmark.h
+                                HINTS ${PC_BENCHMARK_INCLUDEDIR})
+
+find_library(BENCHMARK_LIBRARY_RELEASE NAMES benchmark
+                                       HINTS ${PC_BENCHMARK_LIBDIR})
+find_library(BENCHMARK_LIBRARY_DEBUG NAMES benchmarkd
+                                     HINTS ${PC_BENCHMARK_LIBDIR})
+
+include(SelectLibraryConfigurations)
+select_library_configurations(BENCHMARK)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(Benchmark
+                                  REQUIRED_VARS BENCHMARK_LIBRARY BENCHMARK_INCLUDE_DIR
+                                  VERSION_VAR BENCHMARK_VERSION)
+
+if(BENCHMARK_FOUND)
+  set(BENCHMARK_LIBRARIES ${BENCHMARK_LIBRARY})
+  set(BENCHMARK_INCLUDE_DIRS ${BENCHMARK_INCLUDE_DIR})
+
+  if(NOT TARGET Benchmark::Benchmark)
+    add_library(Benchmark::Benchmark UNKNOWN IMPORTED)
+    set_target_properties(Benchmark::Benchmark PROPERTIES
+                                               IMPORTED_LOCATION "${BENCHMARK_LIBRARY}"
+                                               INTERFACE_INCLUDE_DIRECTORIES "${BENCHMARK_INCLUDE_DIR}")
+  endif()
+endif()
+
+mark_as_advanced(BENCHMARK_INCLUDE_DIR BENCHMARK_LIBRARY)
@@ -17,7 +17,14 @@ out vec4 fragColor;
 void main()
 {
   fragColor = m_colour;
+#if defined(KODI_FONT_SDF)
+  // 0.5 is the glyph outline, antialias over about one pixel at any scale
+  float distance = texture(m_samp0, m_cord0).r;
+  float edge = 0.5 * fwidth(distance);
+  fragColor.a *= smoothstep(0.5 - edge, 0.5 + edge, distance);
+#else
   fragColor.a *= texture(m_samp0, m_cord0).r;
+#endif
 #if defined(KODI_LIMITED_RANGE)
   fragColor.rgb *= (235.0-16.0) / 255.0;
   fragColor.rgb += 16.0 / 255.0;
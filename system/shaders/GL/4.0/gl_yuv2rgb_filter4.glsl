@@ -19,6 +19,9 @@ uniform float m_gammaSrc;
 uniform float m_toneP1;
 uniform float m_luminance;
 uniform vec3 m_coefsDst;
+#if defined(KODI_TONE_MAPPING_LUT)
+uniform sampler3D m_toneLUT;
+#endif
 in vec2 m_cordY;
 in vec2 m_cordU;
 in vec2 m_cordV;
@@ -111,7 +114,12 @@ vec4 process()
   rgb = m_yuvmat * yuv;
   rgb.a = m_alpha;
 
-#if defined(XBMC_COL_CONVERSION)
+#if defined(KODI_TONE_MAPPING_LUT)
+  // color conversion, tone mapping and calibration in one lookup
+  float lutSize = float(textureSize(m_toneLUT, 0).x);
+  rgb.rgb = texture(m_toneLUT, (clamp(rgb.rgb, 0.0, 1.0) * (lutSize - 1.0) + 0.5) / lutSize).rgb;
+
+#elif defined(XBMC_COL_CONVERSION)
   rgb.rgb = pow(max(vec3(0), rgb.rgb), vec3(m_gammaSrc));
   rgb.rgb = max(vec3(0), m_primMat * rgb.rgb);
   rgb.rgb = pow(rgb.rgb, vec3(m_gammaDstInv));
@@ -0,0 +1,197 @@
+#version 400
+
+#if(XBMC_texture_rectangle)
+# define texture2D texture2DRect
+# define sampler2D sampler2DRect
+#endif
+
+uniform sampler2D m_sampY;
+uniform sampler2D m_sampU;
+uniform sampler2D m_sampV;
+uniform vec2 m_step;
+uniform mat4 m_yuvmat;
+uniform float m_stretch;
+uniform float m_alpha;
+uniform sampler1D m_kernelTex;
+uniform mat3 m_primMat;
+uniform float m_gammaDstInv;
+uniform float m_gammaSrc;
+uniform float m_toneP1;
+uniform float m_luminance;
+uniform vec3 m_coefsDst;
+#if defined(KODI_TONE_MAPPING_LUT)
+uniform sampler3D m_toneLUT;
+#endif
+in vec2 m_cordY;
+in vec2 m_cordU;
+in vec2 m_cordV;
+out vec4 fragColor;
+
+vec2 stretch(vec2 pos)
+{
+#if (XBMC_STRETCH)
+  // our transform should map [0..1] to itself, with f(0) = 0, f(1) = 1, f(0.5) = 0.5, and f'(0.5) = b.
+  // a simple curve to do this is g(x) = b(x-0.5) + (1-b)2^(n-1)(x-0.5)^n + 0.5
+  // where the power preserves sign. n = 2 is the simplest non-linear case (required when b != 1)
+  #if(XBMC_texture_rectangle)
+    float x = (pos.x * m_step.x) - 0.5;
+    return vec2((mix(2.0 * x * abs(x), x, m_stretch) + 0.5) / m_step.x, pos.y);
+  #else
+    float x = pos.x - 0.5;
+    return vec2(mix(2.0 * x * abs(x), x, m_stretch) + 0.5, pos.y);
+  #endif
+#else
+  return pos;
+#endif
+}
+
+vec2 texelStep(sampler2D sampler)
+{
+#if(XBMC_texture_rectangle)
+  return vec2(1.0);
+#else
+  return 1.0 / vec2(textureSize(sampler, 0));
+#endif
+}
+
+// the 6 taps are stored as two rgb halves of the kernel texture, interleaved
+void weights6(float f, out vec3 taps1, out vec3 taps2)
+{
+  taps1 = texture(m_kernelTex, (1.0 - f) / 2.0).rgb;
+  taps2 = texture(m_kernelTex, (1.0 - f) / 2.0 + 0.5).rgb;
+  float sum = dot(taps1 + taps2, vec3(1.0));
+  taps1 /= sum;
+  taps2 /= sum;
+}
+
+// 3x3 gathers cover the 6x6 texels around pos, gather [b * 3 + a] starts at texel (2a, 2b)
+void load6x6_0(sampler2D sampler, vec2 pos, out vec4 tex[9])
+{
+  tex[0] = textureGatherOffset(sampler, pos, ivec2(0,0), 0);
+  tex[1] = textureGatherOffset(sampler, pos, ivec2(2,0), 0);
+  tex[2] = textureGatherOffset(sampler, pos, ivec2(4,0), 0);
+  tex[3] = textureGatherOffset(sampler, pos, ivec2(0,2), 0);
+  tex[4] = textureGatherOffset(sampler, pos, ivec2(2,2), 0);
+  tex[5] = textureGatherOffset(sampler, pos, ivec2(4,2), 0);
+  tex[6] = textureGatherOffset(sampler, pos, ivec2(0,4), 0);
+  tex[7] = textureGatherOffset(sampler, pos, ivec2(2,4), 0);
+  tex[8] = textureGatherOffset(sampler, pos, ivec2(4,4), 0);
+}
+
+void load6x6_1(sampler2D sampler, vec2 pos, out vec4 tex[9])
+{
+  tex[0] = textureGatherOffset(sampler, pos, ivec2(0,0), 1);
+  tex[1] = textureGatherOffset(sampler, pos, ivec2(2,0), 1);
+  tex[2] = textureGatherOffset(sampler, pos, ivec2(4,0), 1);
+  tex[3] = textureGatherOffset(sampler, pos, ivec2(0,2), 1);
+  tex[4] = textureGatherOffset(sampler, pos, ivec2(2,2), 1);
+  tex[5] = textureGatherOffset(sampler, pos, ivec2(4,2), 1);
+  tex[6] = textureGatherOffset(sampler, pos, ivec2(0,4), 1);
+  tex[7] = textureGatherOffset(sampler, pos, ivec2(2,4), 1);
+  tex[8] = textureGatherOffset(sampler, pos, ivec2(4,4), 1);
+}
+
+float convolve6x6(vec4 tex[9], vec3 linetaps1, vec3 linetaps2, vec3 coltaps1, vec3 coltaps2)
+{
+  float result = 0.0;
+  for (int b = 0; b < 3; b++)
+  {
+    vec2 coltaps = vec2(coltaps1[b], coltaps2[b]);
+    for (int a = 0; a < 3; a++)
+    {
+      // a gather returns the texels (0,1), (1,1), (1,0), (0,0) of its 2x2 block
+      vec2 linetaps = vec2(linetaps1[a], linetaps2[a]);
+      result += dot(tex[b * 3 + a].wzxy, vec4(linetaps * coltaps.x, linetaps * coltaps.y));
+    }
+  }
+  return result;
+}
+
+// position of the first gather and the taps for a sample at coord
+vec2 setup6x6(sampler2D sampler, vec2 coord, out vec3 linetaps1, out vec3 linetaps2,
+              out vec3 coltaps1, out vec3 coltaps2)
+{
+  vec2 texStep = texelStep(sampler);
+  vec2 pos = coord + texStep * 0.5;
+  vec2 f = fract(pos / texStep);
+
+  weights6(f.x, linetaps1, linetaps2);
+  weights6(f.y, coltaps1, coltaps2);
+  return (-2.0 - f) * texStep + pos;
+}
+
+float filter_0(sampler2D sampler, vec2 coord)
+{
+  vec3 linetaps1, linetaps2, coltaps1, coltaps2;
+  vec4 tex[9];
+  load6x6_0(sampler, setup6x6(sampler, coord, linetaps1, linetaps2, coltaps1, coltaps2), tex);
+  return convolve6x6(tex, linetaps1, linetaps2, coltaps1, coltaps2);
+}
+
+vec2 filter_01(sampler2D sampler, vec2 coord)
+{
+  vec3 linetaps1, linetaps2, coltaps1, coltaps2;
+  vec2 pos = setup6x6(sampler, coord, linetaps1, linetaps2, coltaps1, coltaps2);
+  vec4 tex[9];
+  load6x6_0(sampler, pos, tex);
+  float x = convolve6x6(tex, linetaps1, linetaps2, coltaps1, coltaps2);
+  load6x6_1(sampler, pos, tex);
+  return vec2(x, convolve6x6(tex, linetaps1, linetaps2, coltaps1, coltaps2));
+}
+
+vec4 process()
+{
+  vec4 rgb;
+  vec4 yuv;
+
+#if defined(XBMC_YV12)
+
+  yuv = vec4(filter_0(m_sampY, stretch(m_cordY)),
+             filter_0(m_sampU, stretch(m_cordU)),
+             filter_0(m_sampV, stretch(m_cordV)),
+             1.0);
+
+#elif defined(XBMC_NV12)
+
+  yuv = vec4(filter_0(m_sampY, stretch(m_cordY)),
+             filter_01(m_sampU, stretch(m_cordU)),
+             1.0);
+
+#endif
+
+  rgb = m_yuvmat * yuv;
+  rgb.a = m_alpha;
+
+#if defined(KODI_TONE_MAPPING_LUT)
+  // color conversion, tone mapping and calibration in one lookup
+  float lutSize = float(textureSize(m_toneLUT, 0).x);
+  rgb.rgb = texture(m_toneLUT, (clamp(rgb.rgb, 0.0, 1.0) * (lutSize - 1.0) + 0.5) / lutSize).rgb;
+
+#elif defined(XBMC_COL_CONVERSION)
+  rgb.rgb = pow(max(vec3(0), rgb.rgb), vec3(m_gammaSrc));
+  rgb.rgb = max(vec3(0), m_primMat * rgb.rgb);
+  rgb.rgb = pow(rgb.rgb, vec3(m_gammaDstInv));
+
+#if defined(KODI_TONE_MAPPING_REINHARD)
+  float luma = dot(rgb.rgb, m_coefsDst);
+  rgb.rgb *= reinhard(luma) / luma;
+
+#elif defined(KODI_TONE_MAPPING_ACES)
+  rgb.rgb = inversePQ(rgb.rgb);
+  rgb.rgb *= (10000.0 / m_luminance) * (2.0 / m_toneP1);
+  rgb.rgb = aces(rgb.rgb);
+  rgb.rgb *= (1.24 / m_toneP1);
+  rgb.rgb = pow(rgb.rgb, vec3(0.27));
+
+#elif defined(KODI_TONE_MAPPING_HABLE)
+  rgb.rgb = inversePQ(rgb.rgb);
+  rgb.rgb *= m_toneP1;
+  float wp = m_luminance / 100.0;
+  rgb.rgb = hable(rgb.rgb * wp) / hable(vec3(wp));
+  rgb.rgb = pow(rgb.rgb, vec3(1.0 / 2.2));
+#endif
+
+#endif
+
+  return rgb;
+}
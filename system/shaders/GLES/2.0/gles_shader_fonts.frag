@@ -20,6 +20,10 @@
 
 #version 100
 
+#if defined(KODI_FONT_SDF)
+#extension GL_OES_standard_derivatives : enable
+#endif
+
 precision mediump float;
 uniform sampler2D m_samp0;
 varying vec4 m_cord0;
@@ -31,7 +35,14 @@ void main ()
   vec4 rgb;
 
   rgb.rgb = m_colour.rgb;
+#if defined(KODI_FONT_SDF)
+  // 0.5 is the glyph outline, antialias over about one pixel at any scale
+  float distance = texture2D(m_samp0, m_cord0.xy).a;
+  float edge = 0.5 * fwidth(distance);
+  rgb.a = m_colour.a * smoothstep(0.5 - edge, 0.5 + edge, distance);
+#else
   rgb.a = m_colour.a * texture2D(m_samp0, m_cord0.xy).a;
+#endif
 
 #if defined(KODI_LIMITED_RANGE)
   rgb.rgb *= (235.0 - 16.0) / 255.0;
@@ -0,0 +1,319 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ETC2Encoder.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace
+{
+
+// clang-format off
+constexpr int ETC_MODIFIERS[8][2] = {
+  {2, 8}, {5, 17}, {9, 29}, {13, 42}, {18, 60}, {24, 80}, {33, 106}, {47, 183},
+};
+
+constexpr int EAC_MODIFIERS[16][8] = {
+  {-3, -6,  -9, -15, 2, 5, 8, 14},
+  {-3, -7, -10, -13, 2, 6, 9, 12},
+  {-2, -5,  -8, -13, 1, 4, 7, 12},
+  {-2, -4,  -6, -13, 1, 3, 5, 12},
+  {-3, -6,  -8, -12, 2, 5, 7, 11},
+  {-3, -7,  -9, -11, 2, 6, 8, 10},
+  {-4, -7,  -8, -11, 3, 6, 7, 10},
+  {-3, -5,  -8, -11, 2, 4, 7, 10},
+  {-2, -6,  -8, -10, 1, 5, 7,  9},
+  {-2, -5,  -8, -10, 1, 4, 7,  9},
+  {-2, -4,  -8, -10, 1, 3, 7,  9},
+  {-2, -5,  -7, -10, 1, 4, 6,  9},
+  {-3, -4,  -7, -10, 2, 3, 6,  9},
+  {-1, -2,  -3, -10, 0, 1, 2,  9},
+  {-4, -6,  -8,  -9, 3, 5, 7,  8},
+  {-3, -5,  -7,  -9, 2, 4, 6,  8},
+};
+// clang-format on
+
+// pixels of a 4x4 block, in the column major order used by the block formats
+struct Block
+{
+  std::array<std::array<int, 4>, 16> pixels; // r, g, b, a
+};
+
+Block FetchBlock(const uint8_t* image, uint32_t width, uint32_t height, uint32_t bx, uint32_t by)
+{
+  Block block;
+  for (uint32_t x = 0; x < 4; ++x)
+  {
+    for (uint32_t y = 0; y < 4; ++y)
+    {
+      const uint32_t px = std::min(bx + x, width - 1);
+      const uint32_t py = std::min(by + y, height - 1);
+      const uint8_t* pixel = image + (static_cast<size_t>(py) * width + px) * 4;
+      block.pixels[x * 4 + y] = {pixel[2], pixel[1], pixel[0], pixel[3]};
+    }
+  }
+  return block;
+}
+
+bool InSubBlock(int pixel, bool flip, int subBlock)
+{
+  const int coordinate = flip ? pixel % 4 : pixel / 4;
+  return (coordinate >= 2) == (subBlock == 1);
+}
+
+int Clamp255(int value)
+{
+  return std::clamp(value, 0, 255);
+}
+
+struct SubBlockResult
+{
+  int error{std::numeric_limits<int>::max()};
+  int table{0};
+  uint32_t indices{0}; // msb in bit 16 + pixel, lsb in bit pixel
+};
+
+SubBlockResult EncodeSubBlock(const Block& block,
+                              bool flip,
+                              int subBlock,
+                              const std::array<int, 3>& base)
+{
+  SubBlockResult best;
+  for (int table = 0; table < 8; ++table)
+  {
+    const int modifiers[4] = {ETC_MODIFIERS[table][0], ETC_MODIFIERS[table][1],
+                              -ETC_MODIFIERS[table][0], -ETC_MODIFIERS[table][1]};
+    int error = 0;
+    uint32_t indices = 0;
+    for (int pixel = 0; pixel < 16 && error < best.error; ++pixel)
+    {
+      if (!InSubBlock(pixel, flip, subBlock))
+        continue;
+
+      int bestPixelError = std::numeric_limits<int>::max();
+      uint32_t bestIndex = 0;
+      for (uint32_t index = 0; index < 4; ++index)
+      {
+        int pixelError = 0;
+        for (int c = 0; c < 3; ++c)
+        {
+          const int delta = Clamp255(base[c] + modifiers[index]) - block.pixels[pixel][c];
+          pixelError += delta * delta;
+        }
+        if (pixelError < bestPixelError)
+        {
+          bestPixelError = pixelError;
+          bestIndex = index;
+        }
+      }
+      error += bestPixelError;
+      indices |= ((bestIndex >> 1) << (16 + pixel)) | ((bestIndex & 1) << pixel);
+    }
+
+    if (error < best.error)
+      best = {error, table, indices};
+  }
+  return best;
+}
+
+std::array<int, 3> Average(const Block& block, bool flip, int subBlock)
+{
+  std::array<int, 3> sum{};
+  for (int pixel = 0; pixel < 16; ++pixel)
+  {
+    if (!InSubBlock(pixel, flip, subBlock))
+      continue;
+    for (int c = 0; c < 3; ++c)
+      sum[c] += block.pixels[pixel][c];
+  }
+  return {(sum[0] + 4) / 8, (sum[1] + 4) / 8, (sum[2] + 4) / 8};
+}
+
+int Quantize(int value, int bits)
+{
+  const int max = (1 << bits) - 1;
+  return (value * max + 127) / 255;
+}
+
+int Expand(int value, int bits)
+{
+  return bits == 4 ? (value << 4) | value : (value << 3) | (value >> 2);
+}
+
+uint64_t EncodeColor(const Block& block)
+{
+  int bestError = std::numeric_limits<int>::max();
+  uint64_t bestBits = 0;
+
+  for (const bool flip : {false, true})
+  {
+    const std::array<int, 3> averages[2] = {Average(block, flip, 0), Average(block, flip, 1)};
+
+    // differential mode keeps 5 bits per channel if the sub block colours are close enough
+    std::array<int, 3> quantized[2];
+    bool differential = true;
+    for (int c = 0; c < 3; ++c)
+    {
+      quantized[0][c] = Quantize(averages[0][c], 5);
+      quantized[1][c] = Quantize(averages[1][c], 5);
+      const int delta = quantized[1][c] - quantized[0][c];
+      if (delta < -4 || delta > 3)
+        differential = false;
+    }
+    if (!differential)
+    {
+      for (int c = 0; c < 3; ++c)
+      {
+        quantized[0][c] = Quantize(averages[0][c], 4);
+        quantized[1][c] = Quantize(averages[1][c], 4);
+      }
+    }
+
+    const int bits = differential ? 5 : 4;
+    SubBlockResult results[2];
+    for (int subBlock = 0; subBlock < 2; ++subBlock)
+    {
+      const std::array<int, 3> base = {Expand(quantized[subBlock][0], bits),
+                                       Expand(quantized[subBlock][1], bits),
+                                       Expand(quantized[subBlock][2], bits)};
+      results[subBlock] = EncodeSubBlock(block, flip, subBlock, base);
+    }
+
+    const int error = results[0].error + results[1].error;
+    if (error >= bestError)
+      continue;
+
+    uint64_t encoded = 0;
+    for (int c = 0; c < 3; ++c)
+    {
+      const int shift = 59 - c * 8;
+      if (differential)
+      {
+        const int delta = quantized[1][c] - quantized[0][c];
+        encoded |= static_cast<uint64_t>(quantized[0][c]) << shift;
+        encoded |= static_cast<uint64_t>(delta & 7) << (shift - 3);
+      }
+      else
+      {
+        encoded |= static_cast<uint64_t>(quantized[0][c]) << (shift + 1);
+        encoded |= static_cast<uint64_t>(quantized[1][c]) << (shift - 3);
+      }
+    }
+    encoded |= static_cast<uint64_t>(results[0].table) << 37;
+    encoded |= static_cast<uint64_t>(results[1].table) << 34;
+    encoded |= static_cast<uint64_t>(differential ? 1 : 0) << 33;
+    encoded |= static_cast<uint64_t>(flip ? 1 : 0) << 32;
+    encoded |= results[0].indices | results[1].indices;
+
+    bestError = error;
+    bestBits = encoded;
+  }
+  return bestBits;
+}
+
+uint64_t EncodeAlpha(const Block& block)
+{
+  int minAlpha = 255;
+  int maxAlpha = 0;
+  for (const auto& pixel : block.pixels)
+  {
+    minAlpha = std::min(minAlpha, pixel[3]);
+    maxAlpha = std::max(maxAlpha, pixel[3]);
+  }
+
+  // table 13 has a zero modifier at index 4, which stores a constant alpha exactly
+  if (minAlpha == maxAlpha)
+  {
+    uint64_t encoded = (static_cast<uint64_t>(minAlpha) << 56) | (1ULL << 52) | (13ULL << 48);
+    for (int pixel = 0; pixel < 16; ++pixel)
+      encoded |= 4ULL << (45 - 3 * pixel);
+    return encoded;
+  }
+
+  int bestError = std::numeric_limits<int>::max();
+  uint64_t bestBits = 0;
+  for (int table = 0; table < 16; ++table)
+  {
+    const int* modifiers = EAC_MODIFIERS[table];
+    const int range = modifiers[7] - modifiers[3];
+    const int center = (modifiers[7] + modifiers[3]);
+    const int estimate = std::clamp((maxAlpha - minAlpha + range - 1) / range, 1, 15);
+
+    for (int multiplier = std::max(1, estimate - 1); multiplier <= std::min(15, estimate + 1);
+         ++multiplier)
+    {
+      const int estimatedBase = (minAlpha + maxAlpha - center * multiplier + 1) / 2;
+      for (int base = estimatedBase - 1; base <= estimatedBase + 1; ++base)
+      {
+        if (base < 0 || base > 255)
+          continue;
+
+        int error = 0;
+        uint64_t indices = 0;
+        for (int pixel = 0; pixel < 16 && error < bestError; ++pixel)
+        {
+          int bestPixelError = std::numeric_limits<int>::max();
+          uint64_t bestIndex = 0;
+          for (uint64_t index = 0; index < 8; ++index)
+          {
+            const int delta = Clamp255(base + modifiers[index] * multiplier) - block.pixels[pixel][3];
+            if (delta * delta < bestPixelError)
+            {
+              bestPixelError = delta * delta;
+              bestIndex = index;
+            }
+          }
+          error += bestPixelError;
+          indices |= bestIndex << (45 - 3 * pixel);
+        }
+
+        if (error < bestError)
+        {
+          bestError = error;
+          bestBits = (static_cast<uint64_t>(base) << 56) |
+                     (static_cast<uint64_t>(multiplier) << 52) |
+                     (static_cast<uint64_t>(table) << 48) | indices;
+        }
+      }
+    }
+  }
+  return bestBits;
+}
+
+void AppendBigEndian(std::vector<uint8_t>& output, uint64_t value)
+{
+  for (int shift = 56; shift >= 0; shift -= 8)
+    output.push_back(static_cast<uint8_t>(value >> shift));
+}
+
+} // namespace
+
+std::vector<uint8_t> ETC2Encoder::Encode(const uint8_t* pixels,
+                                         uint32_t width,
+                                         uint32_t height,
+                                         bool withAlpha)
+{
+  const uint32_t blocksX = (width + 3) / 4;
+  const uint32_t blocksY = (height + 3) / 4;
+
+  std::vector<uint8_t> output;
+  output.reserve(static_cast<size_t>(blocksX) * blocksY * (withAlpha ? 16 : 8));
+  for (uint32_t by = 0; by < blocksY; ++by)
+  {
+    for (uint32_t bx = 0; bx < blocksX; ++bx)
+    {
+      const Block block = FetchBlock(pixels, width, height, bx * 4, by * 4);
+      if (withAlpha)
+        AppendBigEndian(output, EncodeAlpha(block));
+      AppendBigEndian(output, EncodeColor(block));
+    }
+  }
+  return output;
+}
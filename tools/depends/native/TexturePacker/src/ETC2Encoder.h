@@ -0,0 +1,31 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace ETC2Encoder
+{
+/*!
+ * \brief Compress a BGRA8 image into ETC2 blocks.
+ *
+ * The colour is stored as ETC1 compatible blocks, which every ETC2 decoder accepts. With alpha the
+ * image is stored as ETC2 RGBA8 (EAC alpha + colour, 8bpp), without as ETC2 RGB8 (4bpp). Images
+ * that aren't a multiple of 4 pixels are padded by repeating their edges.
+ *
+ * \param pixels BGRA8 image, rows of width * 4 bytes
+ * \param withAlpha true to encode the alpha channel
+ * \return the blocks, left to right and top to bottom
+ */
+std::vector<uint8_t> Encode(const uint8_t* pixels,
+                            uint32_t width,
+                            uint32_t height,
+                            bool withAlpha);
+} // namespace ETC2Encoder
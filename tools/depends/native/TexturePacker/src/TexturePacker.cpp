@@ -36,6 +36,7 @@
 
 #include "DecoderManager.h"
 
+#include "ETC2Encoder.h"
 #include "XBTFWriter.h"
 #include "md5.h"
 #include "cmdlineargs.h"
@@ -68,6 +69,10 @@ const char* GetFormatString(KD_TEX_FMT format)
       return "RGBA8";
     case KD_TEX_FMT_SDR_BGRA8:
       return "BGRA8";
+    case KD_TEX_FMT_ETC2_RGB8:
+      return "ETC2 ";
+    case KD_TEX_FMT_ETC2_RGBA8:
+      return "ETC2A";
     default:
       return "?????";
   }
@@ -85,6 +90,8 @@ void Usage()
   puts("  -input <dir>     Input directory. Default: current dir");
   puts("  -output <dir>    Output directory/filename. Default: Textures.xbt");
   puts("  -dupecheck       Enable duplicate file detection. Reduces output file size. Default: off");
+  puts("  -etc2            Store colour images as ETC2. Only for skins shipped to GLES 3 devices.");
+  puts("                   Default: off");
 }
 
 } // namespace
@@ -97,6 +104,8 @@ public:
 
   void EnableDupeCheck() { m_dupecheck = true; }
 
+  void EnableETC2() { m_etc2 = true; }
+
   void EnableVerboseOutput();
 
   int createBundle(const std::string& InputDir, const std::string& OutputFile);
@@ -115,6 +124,7 @@ private:
   void ConvertToSingleChannel(RGBAImage& image, uint32_t channel);
   void ConvertToDualChannel(RGBAImage& image);
   void ReduceChannels(RGBAImage& image);
+  void CompressETC2(RGBAImage& image);
 
   DecoderManager decoderManager;
 
@@ -122,6 +132,7 @@ private:
   std::vector<unsigned int> m_dupes;
 
   bool m_dupecheck{false};
+  bool m_etc2{false};
   bool m_verbose{false};
   unsigned int m_flags{0};
 };
@@ -198,7 +209,11 @@ CXBTFFrame TexturePacker::CreateXBTFFrame(DecodedFrame& decodedFrame, CXBTFWrite
   const unsigned int width = decodedFrame.rgbaImage.width;
   const unsigned int height = decodedFrame.rgbaImage.height;
   const uint32_t bpp = decodedFrame.rgbaImage.bbp;
-  const unsigned int size = width * height * (bpp / 8);
+  // compressed images are stored as whole blocks
+  const bool isETC2 =
+      (decodedFrame.rgbaImage.textureFormat & KD_TEX_FMT_TYPE_MASK) == KD_TEX_FMT_ETC2;
+  const unsigned int size = isETC2 ? static_cast<unsigned int>(decodedFrame.rgbaImage.pixels.size())
+                                   : width * height * (bpp / 8);
   const uint32_t format = static_cast<uint32_t>(decodedFrame.rgbaImage.textureFormat) |
                           static_cast<uint32_t>(decodedFrame.rgbaImage.textureAlpha) |
                           static_cast<uint32_t>(decodedFrame.rgbaImage.textureSwizzle);
@@ -385,6 +400,19 @@ void TexturePacker::ReduceChannels(RGBAImage& image)
   }
 }
 
+void TexturePacker::CompressETC2(RGBAImage& image)
+{
+  // single and dual channel images are small already and keep their exact values
+  if (image.textureFormat != KD_TEX_FMT_SDR_BGRA8 || image.textureSwizzle != KD_TEX_SWIZ_RGBA)
+    return;
+
+  const bool hasAlpha = image.textureAlpha != KD_TEX_ALPHA_OPAQUE;
+  image.pixels = ETC2Encoder::Encode(image.pixels.data(), image.width, image.height, hasAlpha);
+  image.textureFormat = hasAlpha ? KD_TEX_FMT_ETC2_RGBA8 : KD_TEX_FMT_ETC2_RGB8;
+  image.bbp = hasAlpha ? 8 : 4;
+  image.pitch = ((image.width + 3) / 4) * (hasAlpha ? 16 : 8);
+}
+
 int TexturePacker::createBundle(const std::string& InputDir, const std::string& OutputFile)
 {
   CXBTFWriter writer(OutputFile);
@@ -452,6 +480,9 @@ int TexturePacker::createBundle(const std::string& InputDir, const std::string&
     {
       for (unsigned int j = 0; j < frames.frameList.size(); j++)
       {
+        if (m_etc2)
+          CompressETC2(frames.frameList[j].rgbaImage);
+
         CXBTFFrame frame = CreateXBTFFrame(frames.frameList[j], writer);
         file.GetFrames().push_back(frame);
         if(m_verbose)
@@ -521,6 +552,10 @@ int main(int argc, char* argv[])
     {
       texturePacker.EnableDupeCheck();
     }
+    else if (!strcmp(args[i], "-etc2"))
+    {
+      texturePacker.EnableETC2();
+    }
     else if (!strcmp(args[i], "-verbose"))
     {
       texturePacker.EnableVerboseOutput();
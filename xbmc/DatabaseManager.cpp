@@ -16,6 +16,7 @@
 #include "pvr/epg/EpgDatabase.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/StartupTrace.h"
 #include "utils/log.h"
 #include "video/VideoDatabase.h"
 #include "view/ViewDatabase.h"
@@ -60,10 +61,13 @@ void CDatabaseManager::Deinitialize()
   m_bIsUpgrading = false;
   m_connecting = false;
   m_dbStatus.clear();
+  CDatabase::CloseIdleConnections();
 }
 
 bool CDatabaseManager::InitializeInternal()
 {
+  CStartupTrace::CScope trace("CDatabaseManager::Initialize");
+
   CLog::LogF(LOGDEBUG, "updating databases...");
 
   const std::shared_ptr<CAdvancedSettings> advancedSettings =
@@ -1630,7 +1630,7 @@ void CFileItem::SetURL(const CURL& url)
 const CURL& CFileItem::GetURL() const
 {
   if (!m_urlPath)
-    m_urlPath = CURL(m_strPath);
+    m_urlPath = std::make_unique<CURL>(m_strPath);
   return *m_urlPath;
 }
 
@@ -1654,13 +1654,13 @@ const CURL& CFileItem::GetDynURL() const
   if (!m_strDynPath.empty())
   {
     if (!m_urlDynPath)
-      m_urlDynPath = CURL(m_strDynPath);
+      m_urlDynPath = std::make_unique<CURL>(m_strDynPath);
     return *m_urlDynPath;
   }
   else
   {
     if (!m_urlPath)
-      m_urlPath = CURL(m_strPath);
+      m_urlPath = std::make_unique<CURL>(m_strPath);
     return *m_urlPath;
   }
 }
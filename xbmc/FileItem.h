@@ -556,8 +556,8 @@ private:
    */
   void FillMusicInfoTag(const std::shared_ptr<const PVR::CPVREpgInfoTag>& tag);
 
-  mutable std::optional<CURL> m_urlPath;
-  mutable std::optional<CURL> m_urlDynPath;
+  mutable std::unique_ptr<CURL> m_urlPath; ///< parsed m_strPath, created on first use
+  mutable std::unique_ptr<CURL> m_urlDynPath;
   std::string m_strPath;            ///< complete path to item
   std::string m_strDynPath;
 
@@ -859,8 +859,17 @@ constexpr std::array<InfoMap, 7> integer_bools = {{
 ///     @skinning_v22 **[New Boolean Condition]** \link Player_IsLive `Player.IsLive`\endlink
 ///     <p>
 ///   }
+///   \table_row3{   <b>`Player.SeekPreview`</b>,
+///                  \anchor Player_SeekPreview
+///                  _string_,
+///     @return The preview image of the position the player is seeking to\, empty if there is none.
+///     Previews are made in the background for library videos while they are played.
+///     <p><hr>
+///     @skinning_v22 **[New Infolabel]** \link Player_SeekPreview `Player.SeekPreview`\endlink
+///     <p>
+///   }
 // clang-format off
-constexpr std::array<InfoMap, 60> player_labels = {{
+constexpr std::array<InfoMap, 61> player_labels = {{
     {"hasmedia",              PLAYER_HAS_MEDIA},
     {"hasaudio",              PLAYER_HAS_AUDIO},
     {"hasvideo",              PLAYER_HAS_VIDEO},
@@ -921,6 +930,7 @@ constexpr std::array<InfoMap, 60> player_labels = {{
     {"chapters",              PLAYER_CHAPTERS},
     {"bookmarks",             PLAYER_BOOKMARKS},
     {"hasbookmarks",          PLAYER_HAS_BOOKMARKS},
+    {"seekpreview",           PLAYER_SEEK_PREVIEW},
 }};
 // clang-format on
 
@@ -1207,6 +1217,15 @@ constexpr std::array<InfoMap, 10> player_times = {{
 ///     @skinning_v22 **[New Infolabel]** \link Player_Process_videoqueuedatalevel `Player.Process(videoqueuedatalevel)`\endlink
 ///     <p>
 ///   }
+///   \table_row3{   <b>`Player.Process(videodecodetime)`</b>,
+///                  \anchor Player_Process_videodecodetime
+///                  _string_,
+///     @return The average time in milliseconds the video decoder needs for one frame of the
+///             currently playing item. Empty if the decoder does not report it.
+///     <p><hr>
+///     @skinning_v22 **[New Infolabel]** \link Player_Process_videodecodetime `Player.Process(videodecodetime)`\endlink
+///     <p>
+///   }
 ///   \table_row3{   <b>`Player.Process(subtitledecoder)`</b>,
 ///                  \anchor Player_Process_subtitledecoder
 ///                  _string_,
@@ -1220,7 +1239,7 @@ constexpr std::array<InfoMap, 10> player_times = {{
 ///
 /// -----------------------------------------------------------------------------
 // clang-format off
-constexpr std::array<InfoMap, 20> player_process = {{
+constexpr std::array<InfoMap, 21> player_process = {{
     {"videodecoder",        PLAYER_PROCESS_VIDEODECODER},
     {"deintmethod",         PLAYER_PROCESS_DEINTMETHOD},
     {"pixformat",           PLAYER_PROCESS_PIXELFORMAT},
@@ -1239,6 +1258,7 @@ constexpr std::array<InfoMap, 20> player_process = {{
     {"videolivebitrate",    PLAYER_PROCESS_VIDEO_LIVE_BITRATE},
     {"videoqueuelevel",     PLAYER_PROCESS_VIDEO_QUEUE_LEVEL},
     {"videoqueuedatalevel", PLAYER_PROCESS_VIDEO_QUEUE_DATA_LEVEL},
+    {"videodecodetime",     PLAYER_PROCESS_VIDEO_DECODE_TIME},
     {"videoscantype",       PLAYER_PROCESS_VIDEOSCANTYPE},
     {"subtitledecoder",     PLAYER_PROCESS_SUBTITLEDECODER},
 }};
@@ -11783,9 +11803,9 @@ INFO::InfoPtr CGUIInfoManager::Register(const std::string& expression, int conte
   std::pair<INFOBOOLTYPE::iterator, bool> res;
 
   if (condition.find_first_of("|+[]!") != std::string::npos)
-    res = m_bools.insert(std::make_shared<InfoExpression>(condition, context, m_refreshCounter));
+    res = m_bools.insert(std::make_shared<InfoExpression>(condition, context, m_boolCounters));
   else
-    res = m_bools.insert(std::make_shared<InfoSingle>(condition, context, m_refreshCounter));
+    res = m_bools.insert(std::make_shared<InfoSingle>(condition, context, m_boolCounters));
 
   if (res.second)
     res.first->get()->Initialize(this);
@@ -11799,6 +11819,31 @@ void CGUIInfoManager::UnRegister(const INFO::InfoPtr& expression)
   m_bools.erase(expression);
 }
 
+bool CGUIInfoManager::IsChangeNotified(int condition) const
+{
+  int info = std::abs(condition);
+  if (info >= MULTI_INFO_START && info <= MULTI_INFO_END)
+    info = m_multiInfo[info - MULTI_INFO_START].GetInfo();
+
+  switch (info)
+  {
+    case SYSTEM_ALWAYS_TRUE:
+    case SYSTEM_ALWAYS_FALSE:
+    case SKIN_BOOL:
+    case SKIN_STRING:
+    case SKIN_STRING_IS_EQUAL:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void CGUIInfoManager::OnInfoSourceChanged()
+{
+  std::unique_lock lock(m_critInfo);
+  ++m_boolCounters.change;
+}
+
 bool CGUIInfoManager::EvaluateBool(const std::string& expression,
                                    int contextWindow /* = 0 */,
                                    const std::shared_ptr<CGUIListItem>& item /* = nullptr */)
@@ -12128,6 +12173,8 @@ void CGUIInfoManager::Clear()
 {
   std::unique_lock lock(m_critInfo);
   m_skinVariableStrings.clear();
+  // the bools kept alive may be reused with the settings of another skin
+  ++m_boolCounters.change;
 
   /*
     Erase any info bools that are unused. We do this repeatedly as each run
@@ -12424,9 +12471,19 @@ bool CGUIInfoManager::GetItemBool(const CGUIListItem* item, int contextWindow, i
 
 void CGUIInfoManager::ResetCache()
 {
-  // mark our infobools as dirty
+  // mark all our infobools as dirty
+  std::unique_lock lock(m_critInfo);
+  ++m_boolCounters.refresh;
+  ++m_boolCounters.change;
+}
+
+void CGUIInfoManager::ResetFrameCache()
+{
+  // mark the infobools that aren't change notified as dirty
   std::unique_lock lock(m_critInfo);
-  ++m_refreshCounter;
+  ++m_boolCounters.refresh;
+  m_lastEvaluationCount = m_boolCounters.evaluations;
+  m_boolCounters.evaluations = 0;
 }
 
 void CGUIInfoManager::SetCurrentVideoTag(const CVideoInfoTag& tag)
@@ -58,6 +58,7 @@ public:
 
   void Clear();
   void ResetCache();
+  void ResetFrameCache();
 
   // KODI::MESSAGING::IMessageTarget implementation
   int GetMessageMask() override;
@@ -82,6 +83,21 @@ public:
    */
   void UnRegister(const INFO::InfoPtr& expression);
 
+  /*! \brief Whether a condition only changes together with a source that calls OnInfoSourceChanged()
+   Bools made of such conditions are not refreshed every frame.
+   \param condition the condition returned by TranslateSingleString
+   */
+  bool IsChangeNotified(int condition) const;
+
+  /*! \brief Notify the info manager that a change notified source (e.g. the skin settings) changed
+   This marks the bools depending on these sources as dirty.
+   */
+  void OnInfoSourceChanged();
+
+  /*! \brief Get the number of info bools evaluated to render the last frame
+   */
+  unsigned int GetLastEvaluationCount() const { return m_lastEvaluationCount; }
+
   /// \brief iterates through boolean conditions and compares their stored values to current values. Returns true if any condition changed value.
   bool ConditionsChangedValues(const std::map<INFO::InfoPtr, bool>& map) const;
 
@@ -243,7 +259,8 @@ private:
   }
 
   INFOBOOLTYPE m_bools{&CGUIInfoManager::InfoBoolComparator};
-  unsigned int m_refreshCounter = 0;
+  INFO::InfoBoolCounters m_boolCounters;
+  unsigned int m_lastEvaluationCount = 0;
   std::vector<INFO::CSkinVariableString> m_skinVariableStrings;
 
   CCriticalSection m_critInfo;
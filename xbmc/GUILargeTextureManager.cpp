@@ -11,6 +11,7 @@
 #include "ServiceBroker.h"
 #include "TextureCache.h"
 #include "commons/ilog.h"
+#include "guilib/GPUMemoryBudget.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/Texture.h"
 #include "jobs/JobManager.h"
@@ -21,10 +22,13 @@
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <exception>
+#include <iterator>
 #include <mutex>
+#include <thread>
 
 CImageLoader::CImageLoader(const std::string& path,
                            unsigned int targetWidth,
@@ -102,14 +106,17 @@ bool CImageLoader::DoWork()
 CGUILargeTextureManager::CLargeTexture::CLargeTexture(const std::string& path,
                                                       unsigned int targetWidth,
                                                       unsigned int targetHeight,
-                                                      CAspectRatio::AspectRatio aspectRatio)
+                                                      CAspectRatio::AspectRatio aspectRatio,
+                                                      bool useCache)
   : m_path(path),
     m_targetWidth(targetWidth),
     m_targetHeight(targetHeight),
-    m_aspectRatio(aspectRatio)
+    m_aspectRatio(aspectRatio),
+    m_useCache(useCache)
 {
   m_refCount = 1;
   m_timeToDelete = 0;
+  m_lastRequest = CTimeUtils::GetFrameTime();
 }
 
 CGUILargeTextureManager::CLargeTexture::~CLargeTexture()
@@ -148,6 +155,21 @@ bool CGUILargeTextureManager::CLargeTexture::DeleteIfRequired(bool deleteImmedia
   return false;
 }
 
+uint64_t CGUILargeTextureManager::CLargeTexture::GetMemoryUsage() const
+{
+  // same estimate as the texture manager
+  uint64_t memUsage = 0;
+  for (const auto& texture : m_texture.m_textures)
+    memUsage +=
+        static_cast<uint64_t>(texture->GetTextureWidth()) * texture->GetTextureHeight() * 4;
+  return memUsage;
+}
+
+void CGUILargeTextureManager::CLargeTexture::Touch()
+{
+  m_lastRequest = CTimeUtils::GetFrameTime();
+}
+
 void CGUILargeTextureManager::CLargeTexture::SetTexture(std::unique_ptr<CTexture> texture)
 {
   assert(!m_texture.size());
@@ -159,7 +181,11 @@ void CGUILargeTextureManager::CLargeTexture::SetTexture(std::unique_ptr<CTexture
   }
 }
 
-CGUILargeTextureManager::CGUILargeTextureManager() = default;
+CGUILargeTextureManager::CGUILargeTextureManager()
+{
+  // decoding is cpu bound, but loads that download the image mostly wait
+  m_maxJobs = std::clamp(std::thread::hardware_concurrency(), 2u, 8u);
+}
 
 CGUILargeTextureManager::~CGUILargeTextureManager() = default;
 
@@ -176,6 +202,42 @@ void CGUILargeTextureManager::CleanupUnusedImages(bool immediately)
     else
       ++it;
   }
+
+  auto& budget = CGPUMemoryBudget::GetInstance();
+  budget.SetUsage(CGPUMemoryBudget::Consumer::LARGE_TEXTURES, GetMemoryUsage());
+  uint64_t excess = budget.GetExcess();
+  if (excess == 0)
+    return;
+
+  // images still referenced are on screen or about to be, only the unused ones can go
+  std::vector<CLargeTexture*> unused;
+  std::ranges::copy_if(m_allocated, std::back_inserter(unused), &CLargeTexture::IsUnused);
+  std::ranges::sort(unused, {}, &CLargeTexture::GetTimeToDelete);
+  for (CLargeTexture* image : unused)
+  {
+    if (excess == 0)
+      break;
+    const uint64_t memUsage = image->GetMemoryUsage();
+    excess -= std::min(excess, memUsage);
+    budget.Remove(CGPUMemoryBudget::Consumer::LARGE_TEXTURES, memUsage);
+    std::erase(m_allocated, image);
+    image->DeleteIfRequired(true);
+  }
+}
+
+uint64_t CGUILargeTextureManager::GetMemoryUsage() const
+{
+  std::unique_lock lock(m_listSection);
+  uint64_t memUsage = 0;
+  for (const CLargeTexture* image : m_allocated)
+    memUsage += image->GetMemoryUsage();
+  return memUsage;
+}
+
+unsigned int CGUILargeTextureManager::GetImageCount() const
+{
+  std::unique_lock lock(m_listSection);
+  return static_cast<unsigned int>(m_allocated.size());
 }
 
 // if available, increment reference count, and return the image.
@@ -204,6 +266,19 @@ bool CGUILargeTextureManager::GetImage(const std::string& path,
 
   if (firstRequest)
     QueueImage(path, width, height, aspectRatio, useCache);
+  else
+  {
+    // still waiting for it, so it's still wanted on screen
+    for (auto& [id, image] : m_queued)
+    {
+      if (image->GetPath() == path && image->GetTargetWidth() == width &&
+          image->GetTargetHeight() == height && image->GetAspectRatio() == aspectRatio)
+      {
+        image->Touch();
+        break;
+      }
+    }
+  }
 
   return true;
 }
@@ -234,9 +309,13 @@ void CGUILargeTextureManager::ReleaseImage(const std::string& path,
         image->GetTargetHeight() == height && image->GetAspectRatio() == aspectRatio &&
         image->DecrRef(true))
     {
-      // cancel this job
-      CServiceBroker::GetJobManager()->CancelJob(id);
+      // cancel this job, unless it wasn't started yet
       m_queued.erase(it);
+      if (id)
+      {
+        CServiceBroker::GetJobManager()->CancelJob(id);
+        StartQueuedJobs();
+      }
       return;
     }
   }
@@ -265,10 +344,37 @@ void CGUILargeTextureManager::QueueImage(const std::string& path,
   }
 
   // queue the item
-  CLargeTexture* image = new CLargeTexture(path, width, height, aspectRatio);
-  unsigned int jobID = CServiceBroker::GetJobManager()->AddJob(
-      new CImageLoader(path, width, height, aspectRatio, useCache), this, CJob::PRIORITY_NORMAL);
-  m_queued.emplace_back(jobID, image);
+  m_queued.emplace_back(0, new CLargeTexture(path, width, height, aspectRatio, useCache));
+  StartQueuedJobs();
+}
+
+void CGUILargeTextureManager::StartQueuedJobs()
+{
+  unsigned int running = std::count_if(m_queued.begin(), m_queued.end(),
+                                       [](const auto& queued) { return queued.first != 0; });
+  while (running < m_maxJobs)
+  {
+    auto next = m_queued.end();
+    for (auto it = m_queued.begin(); it != m_queued.end(); ++it)
+    {
+      // prefer the newest request if they were asked for in the same frame
+      if (it->first == 0 &&
+          (next == m_queued.end() || it->second->GetLastRequest() >= next->second->GetLastRequest()))
+        next = it;
+    }
+    if (next == m_queued.end())
+      return;
+
+    // the loaders get their own workers, limited by m_maxJobs instead of the shared job pool
+    const CLargeTexture* image = next->second;
+    next->first = CServiceBroker::GetJobManager()->AddJob(
+        new CImageLoader(image->GetPath(), image->GetTargetWidth(), image->GetTargetHeight(),
+                         image->GetAspectRatio(), image->UseCache()),
+        this, CJob::PRIORITY_DEDICATED);
+    if (!next->first)
+      return;
+    ++running;
+  }
 }
 
 void CGUILargeTextureManager::OnJobComplete(unsigned int jobID, bool success, CJob *job)
@@ -285,6 +391,7 @@ void CGUILargeTextureManager::OnJobComplete(unsigned int jobID, bool success, CJ
       loader->m_texture = NULL; // we want to keep the texture, and jobs are auto-deleted.
       m_queued.erase(it);
       m_allocated.push_back(image);
+      StartQueuedJobs();
       return;
     }
   }
@@ -14,6 +14,7 @@
 #include "jobs/Job.h"
 #include "threads/CriticalSection.h"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -128,10 +129,23 @@ public:
    they are flagged as unused with the current time.  After a delay they may be unloaded, hence
    CleanupUnusedImages() should be called periodically to ensure this occurs.
 
+   While the textures are over the budget of CGPUMemoryBudget, the unused images are unloaded
+   without waiting for the delay, the first released first.
+
    \param immediately set to true to cleanup images regardless of whether the delay has passed
    */
   void CleanupUnusedImages(bool immediately = false);
 
+  /*!
+   \brief Estimated memory used by the loaded images, in bytes.
+   */
+  uint64_t GetMemoryUsage() const;
+
+  /*!
+   \brief Number of loaded images.
+   */
+  unsigned int GetImageCount() const;
+
 private:
   class CLargeTexture
   {
@@ -139,7 +153,8 @@ private:
     explicit CLargeTexture(const std::string& path,
                            unsigned int targetWidth,
                            unsigned int targetHeight,
-                           CAspectRatio::AspectRatio aspectRatio);
+                           CAspectRatio::AspectRatio aspectRatio,
+                           bool useCache = true);
     virtual ~CLargeTexture();
 
     void AddRef();
@@ -152,6 +167,15 @@ private:
     unsigned int GetTargetWidth() const { return m_targetWidth; }
     unsigned int GetTargetHeight() const { return m_targetHeight; }
     CAspectRatio::AspectRatio GetAspectRatio() const { return m_aspectRatio; }
+    bool UseCache() const { return m_useCache; }
+
+    bool IsUnused() const { return m_refCount == 0; }
+    unsigned int GetTimeToDelete() const { return m_timeToDelete; }
+    uint64_t GetMemoryUsage() const;
+
+    /*! \brief remember that the texture was asked for this frame, i.e. it's still on screen */
+    void Touch();
+    unsigned int GetLastRequest() const { return m_lastRequest; }
 
   private:
     static const unsigned int TIME_TO_DELETE = 2000;
@@ -163,6 +187,8 @@ private:
     unsigned int m_targetHeight;
     CAspectRatio::AspectRatio m_aspectRatio;
     unsigned int m_timeToDelete;
+    bool m_useCache;
+    unsigned int m_lastRequest;
   };
 
   void QueueImage(const std::string& path,
@@ -171,11 +197,20 @@ private:
                   CAspectRatio::AspectRatio aspectRatio,
                   bool useCache = true);
 
+  /*!
+   \brief Start loading the most recently requested queued images, up to m_maxJobs at once.
+
+   Images still waiting for a loader have a job id of 0. Picking the most recently requested ones
+   first means what is on screen now is loaded before images that were scrolled past.
+   */
+  void StartQueuedJobs();
+
+  unsigned int m_maxJobs;
   std::vector< std::pair<unsigned int, CLargeTexture *> > m_queued;
   std::vector<CLargeTexture *> m_allocated;
   typedef std::vector<CLargeTexture *>::iterator listIterator;
   typedef std::vector< std::pair<unsigned int, CLargeTexture *> >::iterator queueIterator;
 
-  CCriticalSection m_listSection;
+  mutable CCriticalSection m_listSection;
 };
 
@@ -0,0 +1,297 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "LibraryWatcher.h"
+
+#include "MediaSource.h"
+#include "ServiceBroker.h"
+#include "music/MusicLibraryQueue.h"
+#include "music/infoscanner/MusicInfoScanner.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/MediaSourceSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+#include "video/VideoDatabase.h"
+#include "video/VideoLibraryQueue.h"
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <set>
+#include <system_error>
+
+#if defined(TARGET_LINUX)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// a folder is scanned once nothing in it changed for this long
+constexpr auto SETTLE_TIME = 30s;
+constexpr int POLL_INTERVAL_MS = 1000;
+constexpr size_t EVENT_BUFFER_SIZE = 64 * 1024;
+
+#if defined(TARGET_LINUX)
+// files are only picked up once they are complete, folders as soon as they show up
+constexpr uint32_t WATCH_EVENTS =
+    IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR;
+#endif
+
+std::vector<std::string> GetLocalPaths(const std::vector<std::string>& paths)
+{
+  std::vector<std::string> localPaths;
+  for (const auto& path : paths)
+  {
+    if (URIUtils::IsSpecial(path) || !URIUtils::IsHD(path))
+      continue;
+    localPaths.emplace_back(path);
+  }
+  return localPaths;
+}
+} // unnamed namespace
+
+CLibraryWatcher::CLibraryWatcher() : CThread("LibraryWatcher")
+{
+}
+
+CLibraryWatcher::~CLibraryWatcher()
+{
+  Stop();
+}
+
+void CLibraryWatcher::Start()
+{
+  Stop();
+
+  const auto advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  if (advancedSettings->m_bVideoLibraryWatchSources)
+  {
+    // the paths with content set, the scanner finds the scraper from there
+    CVideoDatabase database;
+    std::set<std::string, std::less<>> paths;
+    if (database.Open() && database.GetPaths(paths))
+    {
+      for (const auto& path : GetLocalPaths({paths.begin(), paths.end()}))
+        m_roots.emplace_back(path, Library::VIDEO);
+    }
+  }
+  if (advancedSettings->m_bMusicLibraryWatchSources)
+  {
+    const std::vector<CMediaSource>* sources =
+        CMediaSourceSettings::GetInstance().GetSources("music");
+    if (sources)
+    {
+      for (const auto& source : *sources)
+      {
+        for (const auto& path : GetLocalPaths(source.vecPaths))
+          m_roots.emplace_back(path, Library::MUSIC);
+      }
+    }
+  }
+
+  if (m_roots.empty())
+    return;
+
+#if defined(TARGET_LINUX)
+  m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (m_fd < 0)
+  {
+    CLog::LogF(LOGERROR, "failed to initialize inotify ({})", std::strerror(errno));
+    m_roots.clear();
+    return;
+  }
+
+  for (const auto& [root, library] : m_roots)
+    AddWatches(root, library);
+
+  CLog::LogF(LOGINFO, "watching {} folders of {} sources", m_watches.size(), m_roots.size());
+  Create();
+#else
+  CLog::LogF(LOGWARNING, "watching library sources isn't supported on this platform");
+  m_roots.clear();
+#endif
+}
+
+void CLibraryWatcher::Stop()
+{
+  StopThread(true);
+
+#if defined(TARGET_LINUX)
+  if (m_fd >= 0)
+    close(m_fd);
+#endif
+  m_fd = -1;
+  m_roots.clear();
+  m_watches.clear();
+  m_pendingScans.clear();
+  m_watchLimitReached = false;
+}
+
+void CLibraryWatcher::Process()
+{
+#if defined(TARGET_LINUX)
+  while (!m_bStop)
+  {
+    struct pollfd pfd = {};
+    pfd.fd = m_fd;
+    pfd.events = POLLIN;
+    const int ret = poll(&pfd, 1, POLL_INTERVAL_MS);
+    if (ret < 0 && errno != EINTR)
+    {
+      CLog::LogF(LOGERROR, "poll failed ({}), no longer watching", std::strerror(errno));
+      break;
+    }
+
+    if (ret > 0 && (pfd.revents & POLLIN))
+      ReadEvents();
+    QueueScans();
+  }
+#endif
+}
+
+void CLibraryWatcher::ReadEvents()
+{
+#if defined(TARGET_LINUX)
+  alignas(struct inotify_event) char buffer[EVENT_BUFFER_SIZE];
+  while (true)
+  {
+    const ssize_t length = read(m_fd, buffer, sizeof(buffer));
+    if (length <= 0)
+      return;
+
+    for (ssize_t offset = 0; offset < length;)
+    {
+      const auto* event = reinterpret_cast<const struct inotify_event*>(buffer + offset);
+      offset += sizeof(struct inotify_event) + event->len;
+
+      // events were lost, anything may have changed
+      if (event->mask & IN_Q_OVERFLOW)
+      {
+        CLog::LogF(LOGWARNING, "event queue overflowed, scanning all sources");
+        for (const auto& [root, library] : m_roots)
+          MarkChanged(root, library);
+        continue;
+      }
+
+      const auto it = m_watches.find(event->wd);
+      if (it == m_watches.end())
+        continue;
+
+      // the folder was deleted or moved away, its parent has an event for that
+      if (event->mask & IN_IGNORED)
+      {
+        m_watches.erase(it);
+        continue;
+      }
+
+      // hidden files are usually temporary ones of a download or copy in progress
+      const std::string name = event->len > 0 ? event->name : "";
+      if (name.empty() || name.front() == '.')
+        continue;
+
+      const Watch watch = it->second;
+      if (event->mask & IN_ISDIR)
+      {
+        if (event->mask & (IN_CREATE | IN_MOVED_TO))
+          AddWatches(URIUtils::AddFileToFolder(watch.directory, name), watch.library);
+      }
+      else if (event->mask & IN_CREATE)
+      {
+        // the file is complete once it is closed
+        continue;
+      }
+
+      MarkChanged(watch.directory, watch.library);
+    }
+  }
+#endif
+}
+
+void CLibraryWatcher::AddWatches(const std::string& directory, Library library)
+{
+  AddWatch(directory, library);
+
+  std::error_code ec;
+  std::filesystem::recursive_directory_iterator it(
+      directory, std::filesystem::directory_options::skip_permission_denied, ec);
+  for (; !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec))
+  {
+    if (m_watchLimitReached)
+      return;
+
+    const auto& entry = *it;
+    const std::string name = entry.path().filename().string();
+    if (!name.empty() && name.front() == '.')
+    {
+      it.disable_recursion_pending();
+      continue;
+    }
+    if (entry.is_directory(ec) && !entry.is_symlink(ec))
+      AddWatch(entry.path().string(), library);
+  }
+}
+
+void CLibraryWatcher::AddWatch(const std::string& directory, Library library)
+{
+#if defined(TARGET_LINUX)
+  if (m_watchLimitReached)
+    return;
+
+  const int wd = inotify_add_watch(m_fd, directory.c_str(), WATCH_EVENTS);
+  if (wd < 0)
+  {
+    if (errno == ENOSPC)
+    {
+      CLog::LogF(LOGWARNING,
+                 "reached the limit of inotify watches after {} folders, raise "
+                 "fs.inotify.max_user_watches to watch all of them",
+                 m_watches.size());
+      m_watchLimitReached = true;
+    }
+    else
+      CLog::LogF(LOGDEBUG, "failed to watch {} ({})", directory, std::strerror(errno));
+    return;
+  }
+
+  // the scanners expect folders to end with a slash
+  std::string path = directory;
+  URIUtils::AddSlashAtEnd(path);
+  m_watches[wd] = {path, library};
+#endif
+}
+
+void CLibraryWatcher::MarkChanged(const std::string& directory, Library library)
+{
+  m_pendingScans[directory] = {library, std::chrono::steady_clock::now() + SETTLE_TIME};
+}
+
+void CLibraryWatcher::QueueScans()
+{
+  const auto now = std::chrono::steady_clock::now();
+  for (auto it = m_pendingScans.begin(); it != m_pendingScans.end();)
+  {
+    if (it->second.due > now)
+    {
+      ++it;
+      continue;
+    }
+
+    CLog::LogF(LOGDEBUG, "scanning changed folder {}", it->first);
+    if (it->second.library == Library::VIDEO)
+      CVideoLibraryQueue::GetInstance().ScanLibrary(it->first, false, false);
+    else
+      CMusicLibraryQueue::GetInstance().ScanLibrary(
+          it->first, MUSIC_INFO::CMusicInfoScanner::SCAN_NORMAL, false);
+    it = m_pendingScans.erase(it);
+  }
+}
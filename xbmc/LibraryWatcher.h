@@ -0,0 +1,70 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/Thread.h"
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief Scans the folders of local library sources that changed on disk
+ *
+ * The folders of the sources are watched for files that were written, moved or deleted. A folder
+ * is queued for a library scan once it didn't change for a while, so the scan doesn't pick up a
+ * file that is still copied. Enabled per library with <watchsources> in advancedsettings.xml.
+ * Only supported with inotify on Linux, remote sources are never watched.
+ */
+class CLibraryWatcher : private CThread
+{
+public:
+  CLibraryWatcher();
+  ~CLibraryWatcher() override;
+
+  /*!
+   * \brief Watch the sources of the current profile, restarts watching if already running
+   */
+  void Start();
+  void Stop();
+
+private:
+  enum class Library
+  {
+    VIDEO,
+    MUSIC
+  };
+
+  struct Watch
+  {
+    std::string directory;
+    Library library;
+  };
+
+  struct PendingScan
+  {
+    Library library;
+    std::chrono::steady_clock::time_point due;
+  };
+
+  void Process() override;
+  void ReadEvents();
+  void AddWatches(const std::string& directory, Library library);
+  void AddWatch(const std::string& directory, Library library);
+  void MarkChanged(const std::string& directory, Library library);
+  void QueueScans();
+
+  int m_fd = -1;
+  std::vector<std::pair<std::string, Library>> m_roots;
+  std::map<int, Watch> m_watches; //!< watched folders by their watch descriptor
+  std::map<std::string, PendingScan> m_pendingScans;
+  bool m_watchLimitReached = false;
+};
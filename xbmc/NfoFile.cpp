@@ -20,6 +20,7 @@
 #include "music/Album.h"
 #include "music/Artist.h"
 #include "video/VideoInfoDownloader.h"
+#include "video/VideoInfoTag.h"
 
 #include <string>
 #include <vector>
@@ -34,7 +35,14 @@ std::vector<ScraperPtr> GetScrapers(AddonType type, const ScraperPtr& selectedSc
 
 } // unnamed namespace
 
-CInfoScanner::InfoType CNfoFile::TryParsing(ADDON::AddonType addonType) const
+CNfoFile::CNfoFile() = default;
+
+CNfoFile::~CNfoFile()
+{
+  Close();
+}
+
+CInfoScanner::InfoType CNfoFile::TryParsing(ADDON::AddonType addonType, bool keepDetails)
 {
   using enum CInfoScanner::InfoType;
   using enum ADDON::AddonType;
@@ -52,8 +60,13 @@ CInfoScanner::InfoType CNfoFile::TryParsing(ADDON::AddonType addonType) const
   if (addonType == SCRAPER_MOVIES || addonType == SCRAPER_TVSHOWS ||
       addonType == SCRAPER_MUSICVIDEOS)
   {
-    if (CVideoInfoTag details; GetDetails(details))
-      return details.GetOverride() ? OVERRIDE : FULL;
+    if (auto details = std::make_unique<CVideoInfoTag>(); GetDetails(*details))
+    {
+      const bool isOverride = details->GetOverride();
+      if (keepDetails)
+        m_videoDetails = std::move(details);
+      return isOverride ? OVERRIDE : FULL;
+    }
   }
   return NONE;
 }
@@ -73,7 +86,8 @@ bool CNfoFile::SeekToMovieIndex(int index)
 
 CInfoScanner::InfoType CNfoFile::TryParsing(const CURL& nfoPath,
                                             ADDON::ContentType contentType,
-                                            int index /* =1 */)
+                                            int index /* =1 */,
+                                            bool keepDetails /* =false */)
 {
   if (Load(nfoPath) != 0) // Setup m_doc and m_headPos
     return CInfoScanner::InfoType::ERROR_NFO;
@@ -83,7 +97,22 @@ CInfoScanner::InfoType CNfoFile::TryParsing(const CURL& nfoPath,
   if (addonType == ADDON::AddonType::SCRAPER_MOVIES && !SeekToMovieIndex(index))
     return CInfoScanner::InfoType::NONE;
 
-  return TryParsing(addonType);
+  return TryParsing(addonType, keepDetails);
+}
+
+void CNfoFile::Parse(const std::string& nfoPath, ADDON::ContentType contentType, int index)
+{
+  m_parseResult = TryParsing(CURL{nfoPath}, contentType, index, true);
+}
+
+bool CNfoFile::TakeDetails(CVideoInfoTag& details)
+{
+  if (!m_videoDetails)
+    return false;
+
+  details = std::move(*m_videoDetails);
+  m_videoDetails.reset();
+  return true;
 }
 
 CInfoScanner::InfoType CNfoFile::Create(const std::string& nfoPath,
@@ -112,7 +141,8 @@ CInfoScanner::InfoType CNfoFile::Create(const std::string& nfoPath,
    * This call is expensive as it encodes the NFO file into a URL param
    * and executes a python interpreter for each installed python scraper.
   */
-  const CInfoScanner::InfoType result = TryParsing(CURL{nfoPath}, info->Content(), index);
+  const CInfoScanner::InfoType result =
+      m_parseResult ? *m_parseResult : TryParsing(CURL{nfoPath}, info->Content(), index);
   if (result == CInfoScanner::InfoType::ERROR_NFO)
     return CInfoScanner::InfoType::NONE;
   return SearchNfoForScraperUrls(result, info);
@@ -175,6 +205,8 @@ void CNfoFile::Close()
   m_doc.clear();
   m_headPos = 0;
   m_scurl.Clear();
+  m_parseResult.reset();
+  m_videoDetails.reset();
 }
 
 namespace
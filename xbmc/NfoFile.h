@@ -17,10 +17,14 @@
 #include "addons/Scraper.h"
 #include "utils/XBMCTinyXML.h"
 
+#include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
+class CVideoInfoTag;
+
 namespace ADDON
 {
 enum class AddonType;
@@ -29,10 +33,24 @@ enum class AddonType;
 class CNfoFile
 {
 public:
-  virtual ~CNfoFile() { Close(); }
+  CNfoFile();
+  virtual ~CNfoFile();
 
   CInfoScanner::InfoType Create(const std::string&, const ADDON::ScraperPtr&, int index = 1);
 
+  /*!
+   * \brief Read and parse a video nfo file, Create() then only looks for scraper urls in it.
+   * No scraper is used, so it may run on another thread ahead of Create(). The details are kept
+   * for TakeDetails().
+   */
+  void Parse(const std::string& nfoPath, ADDON::ContentType contentType, int index = 1);
+
+  /*!
+   * \brief Take the video details read by Parse(), instead of parsing them again.
+   * \return false if Parse() wasn't called or found no details
+   */
+  bool TakeDetails(CVideoInfoTag& details);
+
   template<class T>
   bool GetDetails(T& details, const char* document = nullptr, bool prioritise = false) const
   {
@@ -53,10 +71,11 @@ public:
   const CScraperUrl &ScraperUrl() const { return m_scurl; }
 
 private:
-  CInfoScanner::InfoType TryParsing(ADDON::AddonType addonType) const;
+  CInfoScanner::InfoType TryParsing(ADDON::AddonType addonType, bool keepDetails);
   CInfoScanner::InfoType TryParsing(const CURL& nfoPath,
                                     ADDON::ContentType contentType,
-                                    int index = 1);
+                                    int index = 1,
+                                    bool keepDetails = false);
   CInfoScanner::InfoType SearchNfoForScraperUrls(CInfoScanner::InfoType parseResult,
                                                  const ADDON::ScraperPtr& info);
   bool SeekToMovieIndex(int index);
@@ -65,6 +84,8 @@ private:
   size_t m_headPos = 0;
   ADDON::ScraperPtr m_info;
   CScraperUrl m_scurl;
+  std::optional<CInfoScanner::InfoType> m_parseResult; //!< set by Parse()
+  std::unique_ptr<CVideoInfoTag> m_videoDetails; //!< kept by Parse()
 
   int Load(const CURL&);
 };
@@ -496,6 +496,21 @@ std::shared_ptr<XFILE::CBlurayDiscCache> CServiceBroker::GetBlurayDiscCache()
   return g_serviceBroker.m_blurayDiscCache;
 }
 
+void CServiceBroker::RegisterMemoryPressureManager(std::shared_ptr<CMemoryPressureManager> manager)
+{
+  g_serviceBroker.m_memoryPressureManager = std::move(manager);
+}
+
+void CServiceBroker::UnregisterMemoryPressureManager()
+{
+  g_serviceBroker.m_memoryPressureManager.reset();
+}
+
+std::shared_ptr<CMemoryPressureManager> CServiceBroker::GetMemoryPressureManager()
+{
+  return g_serviceBroker.m_memoryPressureManager;
+}
+
 CSubTagRegistryManager& CServiceBroker::GetSubTagRegistry()
 {
   return g_application.m_ServiceManager->GetSubTagRegistryManager();
@@ -82,6 +82,7 @@ class CTextureCache;
 class CJobManager;
 class CSlideShowDelegator;
 class CDNSNameCache;
+class CMemoryPressureManager;
 
 namespace WSDiscovery
 {
@@ -251,6 +252,10 @@ public:
   static void UnregisterBlurayDiscCache();
   static std::shared_ptr<XFILE::CBlurayDiscCache> GetBlurayDiscCache();
 
+  static void RegisterMemoryPressureManager(std::shared_ptr<CMemoryPressureManager> manager);
+  static void UnregisterMemoryPressureManager();
+  static std::shared_ptr<CMemoryPressureManager> GetMemoryPressureManager();
+
 private:
   std::shared_ptr<CAppParams> m_appParams;
   std::unique_ptr<CLog> m_logging;
@@ -271,6 +276,7 @@ private:
   std::shared_ptr<CSlideShowDelegator> m_slideshowDelegator;
   std::shared_ptr<CDNSNameCache> m_dnsNameCache;
   std::shared_ptr<XFILE::CBlurayDiscCache> m_blurayDiscCache;
+  std::shared_ptr<CMemoryPressureManager> m_memoryPressureManager;
 };
 
 XBMC_GLOBAL_REF(CServiceBroker, g_serviceBroker);
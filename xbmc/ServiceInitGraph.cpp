@@ -0,0 +1,110 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceInitGraph.h"
+
+#include "utils/StartupTrace.h"
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+void CServiceInitGraph::Add(std::string name,
+                            const std::vector<std::string>& dependencies,
+                            std::function<bool()> init)
+{
+  Task task{std::move(name), {}, std::move(init)};
+  for (const std::string& dependency : dependencies)
+  {
+    const auto it = std::ranges::find(m_tasks, dependency, &Task::name);
+    if (it == m_tasks.end())
+    {
+      CLog::Log(LOGERROR, "CServiceInitGraph::{}: {} depends on unknown task {}", __func__,
+                task.name, dependency);
+      continue;
+    }
+    task.dependencies.emplace_back(std::distance(m_tasks.begin(), it));
+  }
+  m_tasks.emplace_back(std::move(task));
+}
+
+bool CServiceInitGraph::Run()
+{
+  const auto start = std::chrono::steady_clock::now();
+
+  std::mutex mutex;
+  std::condition_variable finished;
+  std::vector<std::thread> threads;
+  size_t done = 0;
+
+  std::unique_lock lock(mutex);
+  while (done < m_tasks.size())
+  {
+    for (Task& task : m_tasks)
+    {
+      if (task.state != State::PENDING)
+        continue;
+
+      const auto hasState = [this](State state)
+      { return [this, state](size_t dependency) { return m_tasks[dependency].state == state; }; };
+      if (std::ranges::any_of(task.dependencies, hasState(State::FAILED)))
+      {
+        CLog::Log(LOGERROR, "CServiceInitGraph::{}: {} not initialized, a dependency failed",
+                  __func__, task.name);
+        task.state = State::FAILED;
+        done++;
+        continue;
+      }
+      if (!std::ranges::all_of(task.dependencies, hasState(State::SUCCEEDED)))
+        continue;
+
+      task.state = State::RUNNING;
+      threads.emplace_back(
+          [&task, &mutex, &finished, &done]()
+          {
+            const auto taskStart = std::chrono::steady_clock::now();
+            bool success;
+            {
+              CStartupTrace::CScope trace(task.name);
+              success = task.init();
+            }
+            const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - taskStart);
+
+            std::unique_lock taskLock(mutex);
+            task.state = success ? State::SUCCEEDED : State::FAILED;
+            task.duration = duration;
+            done++;
+            finished.notify_all();
+          });
+    }
+
+    // a failed dependency may have finished tasks without starting any
+    if (done < m_tasks.size())
+      finished.wait(lock);
+  }
+  lock.unlock();
+
+  for (std::thread& thread : threads)
+    thread.join();
+
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start);
+  std::vector<std::string> report;
+  for (const Task& task : m_tasks)
+    report.emplace_back(StringUtils::Format("{} {} ms{}", task.name, task.duration.count(),
+                                            task.state == State::FAILED ? " (failed)" : ""));
+  CLog::Log(LOGINFO, "CServiceInitGraph: {} initialized in {} ms: {}", m_stage, duration.count(),
+            StringUtils::Join(report, ", "));
+
+  return std::ranges::none_of(m_tasks,
+                              [](const Task& task) { return task.state == State::FAILED; });
+}
@@ -0,0 +1,64 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief Initializes services in parallel as far as their dependencies allow.
+ *
+ * Each task runs on its own thread as soon as the tasks it depends on finished. Run() returns
+ * when all tasks finished and logs how long the stage and each of its tasks took.
+ */
+class CServiceInitGraph
+{
+public:
+  explicit CServiceInitGraph(std::string stage) : m_stage(std::move(stage)) {}
+
+  /*!
+   * \brief Add the initialization of a service.
+   * \param name name of the task in the log and for the tasks depending on it
+   * \param dependencies names of the tasks that have to finish first, added before this one
+   * \param init initializes the service, returns false when it failed
+   */
+  void Add(std::string name,
+           const std::vector<std::string>& dependencies,
+           std::function<bool()> init);
+
+  /*!
+   * \brief Run all tasks and wait for them.
+   * \return false when a task failed, the tasks depending on it didn't run then
+   */
+  bool Run();
+
+private:
+  enum class State
+  {
+    PENDING,
+    RUNNING,
+    SUCCEEDED,
+    FAILED
+  };
+
+  struct Task
+  {
+    std::string name;
+    std::vector<size_t> dependencies;
+    std::function<bool()> init;
+    State state{State::PENDING};
+    std::chrono::milliseconds duration{0};
+  };
+
+  std::string m_stage;
+  std::vector<Task> m_tasks;
+};
@@ -11,6 +11,7 @@
 #include "ContextMenuManager.h"
 #include "DatabaseManager.h"
 #include "PlayListPlayer.h"
+#include "ServiceInitGraph.h"
 #include "addons/AddonManager.h"
 #include "addons/BinaryAddonCache.h"
 #include "addons/ExtsMimeSupportList.h"
@@ -46,10 +47,12 @@
 #include "pictures/SlideShowDelegator.h"
 #include "storage/MediaManager.h"
 #include "utils/FileExtensionProvider.h"
+#include "utils/StartupTrace.h"
 #include "utils/i18n/Bcp47Registry/SubTagRegistryManager.h"
 #include "utils/log.h"
 #include "weather/WeatherManager.h"
 
+#include <future>
 #include <memory>
 
 using namespace KODI;
@@ -109,6 +112,8 @@ void CServiceManager::DeinitTesting()
 
 bool CServiceManager::InitStageOne()
 {
+  CStartupTrace::CScope trace("CServiceManager::InitStageOne");
+
   m_Platform.reset(CPlatform::CreateInstance());
   if (!m_Platform->InitStageOne())
     return false;
@@ -130,6 +135,8 @@ bool CServiceManager::InitStageOne()
 
 bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
 {
+  CStartupTrace::CScope trace("CServiceManager::InitStageTwo");
+
   // Initialize the addon database (must be before the addon manager is init'd)
   try
   {
@@ -156,14 +163,12 @@ bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
   m_extsMimeSupportList = std::make_unique<ADDONS::CExtsMimeSupportList>(*m_addonMgr);
 
   m_vfsAddonCache = std::make_unique<ADDON::CVFSAddonCache>();
-  m_vfsAddonCache->Init();
 
   m_PVRManager = std::make_unique<PVR::CPVRManager>();
 
   m_dataCacheCore = std::make_unique<CDataCacheCore>();
 
   m_binaryAddonCache = std::make_unique<ADDON::CBinaryAddonCache>();
-  m_binaryAddonCache->Init();
 
   m_favouritesService = std::make_unique<CFavouritesService>(profilesUserDataFolder);
 
@@ -173,23 +178,17 @@ bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
 
   m_gameControllerManager = std::make_unique<GAME::CControllerManager>(*m_addonMgr);
   m_inputManager = std::make_unique<CInputManager>();
-  m_inputManager->InitializeInputs();
 
   m_peripherals =
       std::make_unique<PERIPHERALS::CPeripherals>(*m_inputManager, *m_gameControllerManager);
 
   m_gameRenderManager = std::make_unique<RETRO::CGUIGameRenderManager>();
 
-  m_fileExtensionProvider->Initialize(*m_addonMgr);
-
   m_powerManager = std::make_unique<CPowerManager>();
-  m_powerManager->Initialize();
-  m_powerManager->SetDefaults();
 
   m_weatherManager = std::make_unique<CWeatherManager>(*m_addonMgr);
 
   m_mediaManager = std::make_unique<CMediaManager>();
-  m_mediaManager->Initialize();
 
 #if !defined(TARGET_WINDOWS) && defined(HAS_OPTICAL_DRIVE)
   m_DetectDVDType = std::make_unique<MEDIA_DETECT::CDetectDVDMedia>();
@@ -199,8 +198,57 @@ bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
   m_WSDiscovery = WSDiscovery::IWSDiscovery::GetInstance();
 #endif
 
+  // the services are created, the slow parts of their initialization run in parallel
+  CServiceInitGraph graph("stage two");
+  graph.Add("vfsaddons", {},
+            [this]()
+            {
+              m_vfsAddonCache->Init();
+              return true;
+            });
+  graph.Add("binaryaddons", {},
+            [this]()
+            {
+              m_binaryAddonCache->Init();
+              return true;
+            });
+  graph.Add("inputs", {},
+            [this]()
+            {
+              m_inputManager->InitializeInputs();
+              return true;
+            });
+  graph.Add("fileextensions", {},
+            [this]()
+            {
+              m_fileExtensionProvider->Initialize(*m_addonMgr);
+              return true;
+            });
+  graph.Add("powermanager", {},
+            [this]()
+            {
+              m_powerManager->Initialize();
+              m_powerManager->SetDefaults();
+              return true;
+            });
+  graph.Add("mediamanager", {},
+            [this]()
+            {
+              m_mediaManager->Initialize();
+              return true;
+            });
+  graph.Run();
+
+  // only language matching of streams needs the registry, it loads while the skin loads
   m_subTagRegistryManager = std::make_unique<KODI::UTILS::I18N::CSubTagRegistryManager>();
-  m_subTagRegistryManager->Initialize();
+  m_subTagRegistryInit =
+      std::async(std::launch::async,
+                 [this]()
+                 {
+                   CStartupTrace::CScope trace("subtagregistry");
+                   m_subTagRegistryManager->Initialize();
+                 })
+          .share();
 
   if (!m_Platform->InitStageTwo())
     return false;
@@ -212,28 +260,49 @@ bool CServiceManager::InitStageTwo(const std::string& profilesUserDataFolder)
 // stage 3 is called after successful initialization of WindowManager
 bool CServiceManager::InitStageThree(const std::shared_ptr<CProfileManager>& profileManager)
 {
+  CStartupTrace::CScope trace("CServiceManager::InitStageThree");
+
 #if !defined(TARGET_WINDOWS) && defined(HAS_OPTICAL_DRIVE)
   // Start Thread for DVD Mediatype detection
   CLog::Log(LOGINFO, "[Media Detection] starting service for optical media detection");
   m_DetectDVDType->Create(false);
 #endif
 
+  CServiceInitGraph graph("stage three");
   // Peripherals depends on strings being loaded before stage 3
-  m_peripherals->Initialise();
-
-  m_gameServices = std::make_unique<GAME::CGameServices>(
-      *m_gameControllerManager, *m_gameRenderManager, *m_peripherals, *profileManager,
-      *m_inputManager, *m_addonMgr, *m_fileExtensionProvider);
-  m_gameServices->Initialize();
-
-  m_contextMenuManager->Init();
+  graph.Add("peripherals", {},
+            [this]()
+            {
+              m_peripherals->Initialise();
+              return true;
+            });
+  graph.Add("gameservices", {"peripherals"},
+            [this, &profileManager]()
+            {
+              m_gameServices = std::make_unique<GAME::CGameServices>(
+                  *m_gameControllerManager, *m_gameRenderManager, *m_peripherals,
+                  *profileManager, *m_inputManager, *m_addonMgr, *m_fileExtensionProvider);
+              m_gameServices->Initialize();
+              return true;
+            });
+  graph.Add("contextmenus", {},
+            [this]()
+            {
+              m_contextMenuManager->Init();
+              return true;
+            });
+  graph.Add("playercores", {},
+            [this, &profileManager]()
+            {
+              m_playerCoreFactory = std::make_unique<CPlayerCoreFactory>(*profileManager);
+              return true;
+            });
+  graph.Run();
 
   // Init PVR manager after login, not already on login screen
   if (!profileManager->UsingLoginScreen())
     m_PVRManager->Init();
 
-  m_playerCoreFactory = std::make_unique<CPlayerCoreFactory>(*profileManager);
-
   if (!m_Platform->InitStageThree())
     return false;
 
@@ -268,6 +337,9 @@ void CServiceManager::DeinitStageTwo()
 
   init_level = 1;
 
+  if (m_subTagRegistryInit.valid())
+    m_subTagRegistryInit.wait();
+  m_subTagRegistryInit = {};
   m_subTagRegistryManager.reset();
 
 #if defined(HAS_FILESYSTEM_SMB)
@@ -472,5 +544,7 @@ CSlideShowDelegator& CServiceManager::GetSlideShowDelegator()
 
 KODI::UTILS::I18N::CSubTagRegistryManager& CServiceManager::GetSubTagRegistryManager()
 {
+  if (m_subTagRegistryInit.valid())
+    m_subTagRegistryInit.wait();
   return *m_subTagRegistryManager;
 }
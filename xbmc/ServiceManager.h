@@ -10,6 +10,7 @@
 
 #include "platform/Platform.h"
 
+#include <future>
 #include <memory>
 
 namespace ADDON
@@ -259,4 +260,5 @@ protected:
 #endif
   std::unique_ptr<CSlideShowDelegator> m_slideShowDelegator;
   std::unique_ptr<KODI::UTILS::I18N::CSubTagRegistryManager> m_subTagRegistryManager;
+  std::shared_future<void> m_subTagRegistryInit; //!< loads the registry in the background
 };
@@ -12,6 +12,8 @@
 #include "TextureCacheJob.h"
 #include "URL.h"
 #include "commons/ilog.h"
+#include "cores/VideoPlayer/DVDThumbExtractionPool.h"
+#include "dialogs/GUIDialogExtendedProgressBar.h"
 #include "dialogs/GUIDialogProgress.h"
 #include "filesystem/File.h"
 #include "filesystem/IFileTypes.h"
@@ -19,21 +21,28 @@
 #include "guilib/GUIWindowManager.h"
 #include "guilib/Texture.h"
 #include "imagefiles/ImageCacheCleaner.h"
+#include "imagefiles/ImageCachePrecacher.h"
 #include "imagefiles/ImageFileURL.h"
 #include "jobs/Job.h"
 #include "jobs/JobManager.h"
 #include "profiles/ProfileManager.h"
+#include "resources/LocalizeStrings.h"
+#include "resources/ResourcesComponent.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/Crc32.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <mutex>
 #include <optional>
 #include <string.h>
+#include <utility>
+#include <vector>
 
 using namespace XFILE;
 using namespace std::chrono_literals;
@@ -56,7 +65,9 @@ void CTextureCache::Initialize()
 void CTextureCache::Deinitialize()
 {
   m_cleanTimer.Stop(true);
+  m_stopPrecaching = true;
   CancelJobs();
+  m_extractionQueue.CancelJobs();
 
   std::unique_lock lock(m_databaseSection);
   m_database.Close();
@@ -79,6 +90,14 @@ bool CTextureCache::IsCachedImage(const std::string &url) const
       URIUtils::PathHasParent(url, profileManager->GetThumbnailsFolder(), true);
 }
 
+bool CTextureCache::IsExtractedFromVideo(const std::string& image)
+{
+  // seek previews are extracted with a strip of keyframes each, caching them one by one is fine
+  const IMAGE_FILES::CImageFileURL imageFile(image);
+  return imageFile.GetSpecialType() == "video" && imageFile.GetOption("seekstrip").empty() &&
+         imageFile.GetOption("seektile").empty();
+}
+
 bool CTextureCache::HasCachedImage(const std::string &url)
 {
   CTextureDetails details;
@@ -132,7 +151,10 @@ void CTextureCache::BackgroundCacheImage(const std::string &url)
     return;
 
   // needs (re)caching
-  AddJob(new CTextureCacheJob(path, details.hash));
+  if (IsExtractedFromVideo(path))
+    m_extractionQueue.AddJob(new CTextureCacheJob(path, details.hash));
+  else
+    AddJob(new CTextureCacheJob(path, details.hash));
 }
 
 bool CTextureCache::StartCacheImage(const std::string& image)
@@ -307,8 +329,8 @@ void CTextureCache::OnCachingComplete(bool success, CTextureCacheJob *job)
   {
     if (job->m_details.hashRevalidated)
       SetCachedTextureValid(job->m_url, job->m_details.updateable);
-    else
-      AddCachedTexture(job->m_url, job->m_details);
+    else if (AddCachedTexture(job->m_url, job->m_details))
+      OnCacheGrown(job->m_details.fileSize);
   }
 
   { // remove from our processing list
@@ -328,6 +350,20 @@ void CTextureCache::OnJobComplete(unsigned int jobID, bool success, CJob *job)
   return CJobQueue::OnJobComplete(jobID, success, job);
 }
 
+CTextureCache::CExtractionQueue::CExtractionQueue(CTextureCache& cache)
+  : CJobQueue(false,
+              CDVDThumbExtractionPool::GetInstance().GetMaxWorkers(),
+              CJob::PRIORITY_DEDICATED),
+    m_cache(cache)
+{
+}
+
+void CTextureCache::CExtractionQueue::OnJobComplete(unsigned int jobID, bool success, CJob* job)
+{
+  m_cache.OnCachingComplete(success, static_cast<CTextureCacheJob*>(job));
+  CJobQueue::OnJobComplete(jobID, success, job);
+}
+
 bool CTextureCache::Export(const std::string &image, const std::string &destination, bool overwrite)
 {
   CTextureDetails details;
@@ -397,19 +433,29 @@ bool CTextureCache::CleanAllUnusedImagesJob(CGUIDialogProgress* progress)
     return false;
   }
 
-  const unsigned int cleanAmount = 1000000;
-  const auto result = cleaner->ScanOldestCache(cleanAmount);
-  if (progress && progress->IsCanceled())
-  {
-    progress->Close();
-    return false;
-  }
-
-  const auto total = result.imagesToClean.size();
+  // Clean in scans of the size of the background ones. Looking up a million images at once in
+  // the library takes ages and all of the memory of small devices.
+  const unsigned int cleanAmount = 1000;
+  const unsigned int total = cleaner->CountOldestCache(cleanAmount);
   unsigned int current = 0;
-  for (const auto& image : result.imagesToClean)
+  while (current < total)
   {
-    ClearCachedImage(image);
+    const auto result = cleaner->ScanOldestCache(cleanAmount);
+    if (result.processedCount == 0)
+      break;
+
+    for (const auto& image : result.imagesToClean)
+    {
+      ClearCachedImage(image);
+      if (progress && progress->IsCanceled())
+      {
+        progress->Close();
+        return false;
+      }
+    }
+
+    // the kept images are checked again in a month at the earliest, they won't come back
+    current += result.processedCount;
     if (progress)
     {
       if (progress->IsCanceled())
@@ -417,13 +463,13 @@ bool CTextureCache::CleanAllUnusedImagesJob(CGUIDialogProgress* progress)
         progress->Close();
         return false;
       }
-      int percentage = static_cast<unsigned long long>(current) * 100 / total;
+      const int percentage =
+          static_cast<int>(static_cast<unsigned long long>(std::min(current, total)) * 100 / total);
       if (progress->GetPercentage() != percentage)
       {
         progress->SetPercentage(percentage);
         progress->Progress();
       }
-      current++;
     }
   }
 
@@ -432,6 +478,53 @@ bool CTextureCache::CleanAllUnusedImagesJob(CGUIDialogProgress* progress)
   return true;
 }
 
+bool CTextureCache::PrecacheAllLibraryImages(bool showProgress)
+{
+  if (m_precachingInProgress.test_and_set())
+    return false;
+
+  CGUIDialogProgressBarHandle* progress = nullptr;
+  if (showProgress)
+  {
+    auto dialog =
+        CServiceBroker::GetGUI()->GetWindowManager().GetWindow<CGUIDialogExtendedProgressBar>(
+            WINDOW_DIALOG_EXT_PROGRESS);
+    if (dialog)
+      progress = dialog->GetHandle(
+          CServiceBroker::GetResourcesComponent().GetLocalizeStrings().Get(14283));
+  }
+
+  m_stopPrecaching = false;
+  CServiceBroker::GetJobManager()->Submit(
+      [this, progress]()
+      {
+        PrecacheAllLibraryImagesJob(progress);
+        m_precachingInProgress.clear();
+      },
+      CJob::PRIORITY_LOW_PAUSABLE);
+  return true;
+}
+
+void CTextureCache::PrecacheAllLibraryImagesJob(CGUIDialogProgressBarHandle* progress)
+{
+  // close the databases again before the long part
+  std::vector<std::string> images;
+  if (auto precacher = IMAGE_FILES::CImageCachePrecacher::Create())
+    images = precacher->GetUncachedImages();
+
+  IMAGE_FILES::CImageCachePrecacher::CacheImages(
+      std::move(images),
+      [this, progress](unsigned int done, unsigned int total)
+      {
+        if (progress)
+          progress->SetProgress(done, total);
+        return !m_stopPrecaching;
+      });
+
+  if (progress)
+    progress->MarkFinished();
+}
+
 void CTextureCache::CleanTimer()
 {
   if (IsSleeping())
@@ -447,9 +540,78 @@ void CTextureCache::CleanTimer()
         auto next = m_cleaningInProgress.test_and_set() ? 1h : ScanOldestCache();
         m_cleaningInProgress.clear();
         m_cleanTimer.Start(next);
+        if (!m_sizeCheckInProgress.test_and_set())
+          EnforceMaxSize();
       });
 }
 
+void CTextureCache::OnCacheGrown(uint64_t bytes)
+{
+  const uint64_t maxSize = GetMaxSize();
+  if (maxSize == 0)
+    return;
+
+  // check the size again each time the cache grew by 5% of its limit
+  if (m_bytesSinceSizeCheck.fetch_add(bytes) + bytes < maxSize / 20)
+    return;
+  m_bytesSinceSizeCheck = 0;
+
+  if (!m_sizeCheckInProgress.test_and_set())
+    Submit([this]() { EnforceMaxSize(); });
+}
+
+uint64_t CTextureCache::GetMaxSize()
+{
+  return static_cast<uint64_t>(
+             CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageCacheMaxSize) *
+         1024 * 1024;
+}
+
+void CTextureCache::EnforceMaxSize()
+{
+  const uint64_t maxSize = GetMaxSize();
+  if (maxSize == 0)
+  {
+    m_sizeCheckInProgress.clear();
+    return;
+  }
+
+  // fill in the sizes of the images cached before they were kept, a batch at a time
+  std::vector<std::pair<int, std::string>> unknownSizes;
+  {
+    std::unique_lock lock(m_databaseSection);
+    unknownSizes = m_database.GetCachedImagesWithoutSize(5000);
+  }
+  for (const auto& [id, file] : unknownSizes)
+  {
+    struct __stat64 st;
+    const uint64_t size =
+        CFile::Stat(GetCachedPath(file), &st) == 0 ? static_cast<uint64_t>(st.st_size) : 0;
+    std::unique_lock lock(m_databaseSection);
+    m_database.SetCachedImageSize(id, size);
+  }
+
+  std::vector<int> images;
+  uint64_t size;
+  {
+    std::unique_lock lock(m_databaseSection);
+    size = m_database.GetCachedImagesSize();
+    // free a tenth more than needed, not to come back for every image cached
+    if (size > maxSize)
+      images = m_database.GetLeastRecentlyUsedImages(size - maxSize + maxSize / 10);
+  }
+
+  if (!images.empty())
+  {
+    CLog::LogF(LOGDEBUG, "image cache of {} MiB over its limit of {} MiB, evicting {} images",
+               size / (1024 * 1024), maxSize / (1024 * 1024), images.size());
+    for (int id : images)
+      ClearCachedImage(id);
+  }
+
+  m_sizeCheckInProgress.clear();
+}
+
 std::chrono::milliseconds CTextureCache::ScanOldestCache()
 {
   auto cleaner = IMAGE_FILES::CImageCacheCleaner::Create();
@@ -19,12 +19,14 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <set>
 #include <string>
 #include <vector>
 
 class CGUIDialogProgress;
+class CGUIDialogProgressBarHandle;
 class CJob;
 class CURL;
 class CTexture;
@@ -167,7 +169,30 @@ public:
 
   bool CleanAllUnusedImages();
 
+  /*! \brief Cache all artwork of the media library in the background
+   Images that are already cached are skipped.
+   \param showProgress whether to show the progress in the extended progress bar
+   \return true if caching was started, false if it is already running
+   \sa IMAGE_FILES::CImageCachePrecacher
+   */
+  bool PrecacheAllLibraryImages(bool showProgress);
+
 private:
+  /*! \brief Queue caching the images extracted from video files.
+   Its jobs mostly wait for a CDVDThumbExtractionPool worker, so as many run at once as the pool
+   has workers, and the pool limits the decoding itself.
+   */
+  class CExtractionQueue : public CJobQueue
+  {
+  public:
+    explicit CExtractionQueue(CTextureCache& cache);
+
+    void OnJobComplete(unsigned int jobID, bool success, CJob* job) override;
+
+  private:
+    CTextureCache& m_cache;
+  };
+
   // private construction, and no assignments; use the provided singleton methods
   CTextureCache(const CTextureCache&) = delete;
   CTextureCache const& operator=(CTextureCache const&) = delete;
@@ -178,6 +203,11 @@ private:
    */
   bool IsCachedImage(const std::string &image) const;
 
+  /*! \brief Check if the given image is a thumbnail or chapter image extracted from a video file
+   \param image cache key of the image
+   */
+  static bool IsExtractedFromVideo(const std::string& image);
+
   /*! \brief retrieve the cached version of the given image (if it exists)
    \param image url of the image
    \param details [out] the details of the texture.
@@ -230,9 +260,27 @@ private:
 
   void CleanTimer();
   std::chrono::milliseconds ScanOldestCache();
+
+  /*! \brief Account for a newly cached image, checking the size of the cache when it grew enough.
+   \param bytes the size of the cached file
+   */
+  void OnCacheGrown(uint64_t bytes);
+
+  /*! \brief Evict the least recently used images when the cache is over its size limit.
+   Clears m_sizeCheckInProgress when done.
+   \sa CAdvancedSettings::m_imageCacheMaxSize
+   */
+  void EnforceMaxSize();
+  static uint64_t GetMaxSize();
+
   bool CleanAllUnusedImagesJob(CGUIDialogProgress* progress);
+  void PrecacheAllLibraryImagesJob(CGUIDialogProgressBarHandle* progress);
 
   std::atomic_flag m_cleaningInProgress;
+  std::atomic_flag m_precachingInProgress;
+  std::atomic<bool> m_stopPrecaching{false};
+  std::atomic_flag m_sizeCheckInProgress;
+  std::atomic<uint64_t> m_bytesSinceSizeCheck{0};
   CTimer m_cleanTimer;
   CCriticalSection m_databaseSection;
   CTextureDatabase m_database;
@@ -241,5 +289,6 @@ private:
   CEvent               m_completeEvent; ///< Set whenever a job has finished
   std::vector<CTextureDetails> m_useCounts; ///< Use count tracking
   CCriticalSection             m_useCountSection;
+  CExtractionQueue m_extractionQueue{*this};
 };
 
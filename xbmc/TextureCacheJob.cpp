@@ -20,6 +20,7 @@
 #include "imagefiles/ImageFileURL.h"
 #include "imagefiles/SpecialImageLoaderFactory.h"
 #include "pictures/Picture.h"
+#include "pictures/metadata/ImageMetadataParser.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/StringUtils.h"
@@ -53,6 +54,17 @@ bool CTextureCacheJob::Equals(const CJob* job) const
   return false;
 }
 
+CJob::RESOURCE CTextureCacheJob::GetResource(std::string& host) const
+{
+  // local images keep the cpu busy with decoding and scaling, remote ones wait for their host
+  const std::string file{IMAGE_FILES::CImageFileURL(m_url).GetTargetFile()};
+  if (!URIUtils::IsRemote(file))
+    return RESOURCE_CPU;
+
+  host = CURL(file).GetHostName();
+  return RESOURCE_NETWORK;
+}
+
 bool CTextureCacheJob::DoWork()
 {
   if (ShouldCancel(0, 0))
@@ -91,6 +103,10 @@ bool ShouldCheckForChanges(const std::string& specialType, const std::string& ur
       StringUtils::StartsWith(url, "http://") || StringUtils::StartsWith(url, "https://");
   return !isHTTP;
 }
+
+// pictures from cameras, which embed previews in the EXIF data or the maker notes
+constexpr const char* PREVIEW_EXTENSIONS =
+    ".jpg|.jpeg|.jpe|.jfif|.dng|.nef|.nrw|.cr2|.arw|.sr2|.srw|.orf|.rw2|.pef|.raf";
 } // namespace
 
 bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
@@ -114,10 +130,14 @@ bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
     }
   }
 
-  std::unique_ptr<CTexture> texture = LoadImage(imageURL);
+  std::unique_ptr<CTexture> texture = LoadPreview(imageURL);
+  if (!texture)
+    texture = LoadImage(imageURL);
   if (texture)
   {
-    if (texture->HasAlpha())
+    if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageCacheRaw)
+      m_details.file = m_cachePath + ".dds";
+    else if (texture->HasAlpha())
       m_details.file = m_cachePath + ".png";
     else
       m_details.file = m_cachePath + ".jpg";
@@ -132,6 +152,9 @@ bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
     {
       m_details.width = cached_width;
       m_details.height = cached_height;
+      struct __stat64 st;
+      if (XFILE::CFile::Stat(CTextureCache::GetCachedPath(m_details.file), &st) == 0)
+        m_details.fileSize = static_cast<uint64_t>(st.st_size);
       if (out_texture) // caller wants the texture
         *out_texture = std::move(texture);
       return true;
@@ -200,6 +223,42 @@ std::unique_ptr<CTexture> CTextureCacheJob::LoadImage(const IMAGE_FILES::CImageF
   return texture;
 }
 
+std::unique_ptr<CTexture> CTextureCacheJob::LoadPreview(const IMAGE_FILES::CImageFileURL& imageURL)
+{
+  const auto& image = imageURL.GetTargetFile();
+  if (imageURL.IsSpecialImage() || !URIUtils::HasExtension(image, PREVIEW_EXTENSIONS))
+    return {};
+
+  const auto isLargeEnough = [](unsigned int width, unsigned int height, unsigned int previewWidth,
+                                unsigned int previewHeight)
+  {
+    uint32_t cachedWidth = 0;
+    uint32_t cachedHeight = 0;
+    CPicture::GetCacheSize(width, height, cachedWidth, cachedHeight);
+    return previewWidth >= cachedWidth && previewHeight >= cachedHeight;
+  };
+
+  const std::unique_ptr<ImagePreview> preview =
+      CImageMetadataParser::ExtractPreview(image, isLargeEnough);
+  if (!preview)
+    return {};
+
+  auto texture = CTexture::LoadFromFileInMemory(preview->data.data(), preview->data.size(),
+                                                preview->mimeType);
+  if (!texture)
+    return {};
+
+  // the preview is stored the way the picture is, so it's turned the way the picture is
+  if (preview->orientation)
+    texture->SetOrientation(preview->orientation - 1);
+  if (imageURL.flipped)
+    texture->SetOrientation(texture->GetOrientation() ^ 1);
+
+  CLog::Log(LOGDEBUG, "Using the {}x{} preview of image '{}'", texture->GetWidth(),
+            texture->GetHeight(), CURL::GetRedacted(image));
+  return texture;
+}
+
 std::string CTextureCacheJob::GetImageHash(const std::string &url)
 {
   // silently ignore - we cannot stat these
@@ -41,6 +41,7 @@ public:
   std::string hash;
   unsigned int width{0};
   unsigned int height{0};
+  uint64_t fileSize{0}; ///< size of the cached file
   bool updateable{false};
   bool hashRevalidated{false};
 };
@@ -61,6 +62,7 @@ public:
 
   const char* GetType() const override { return JOB_TYPE_CACHE_IMAGE; }
   bool Equals(const CJob* job) const override;
+  RESOURCE GetResource(std::string& host) const override;
   bool DoWork() override;
 
   /*! \brief retrieve a hash for the given image
@@ -98,6 +100,16 @@ private:
    */
   static std::unique_ptr<CTexture> LoadImage(const IMAGE_FILES::CImageFileURL& imageURL);
 
+  /*! \brief Load the preview embedded in an image, if it's at least as large as the cached version.
+
+   Camera pictures carry JPEG previews, decoding one of those is much faster than decoding the
+   picture itself.
+
+   \param image the URL of the image file.
+   \return a pointer to a CTexture object, NULL if the image has no preview that is large enough.
+   */
+  static std::unique_ptr<CTexture> LoadPreview(const IMAGE_FILES::CImageFileURL& imageURL);
+
   std::string    m_cachePath;
 };
 
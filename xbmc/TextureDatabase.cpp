@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cinttypes>
 #include <string_view>
 
 using enum CDatabaseQueryRule::FieldType;
@@ -107,7 +108,8 @@ void CTextureDatabase::CreateTables()
               "imagehash text, lasthashcheck text, lastlibrarycheck text)");
 
   CLog::Log(LOGINFO, "create sizes table, index,  and trigger");
-  m_pDS->exec("CREATE TABLE sizes (idtexture integer, size integer, width integer, height integer, usecount integer, lastusetime text)");
+  m_pDS->exec("CREATE TABLE sizes (idtexture integer, size integer, width integer, height "
+              "integer, usecount integer, lastusetime text, filesize integer)");
 
   CLog::Log(LOGINFO, "create path table");
   m_pDS->exec("CREATE TABLE path (id integer primary key, url text, type text, texture text)\n");
@@ -183,6 +185,10 @@ void CTextureDatabase::UpdateTables(int version)
   {
     m_pDS->exec("ALTER TABLE texture ADD lastlibrarycheck text");
   }
+  if (version < 15)
+  { // the sizes of the already cached files are filled in by the texture cache
+    m_pDS->exec("ALTER TABLE sizes ADD filesize integer");
+  }
 }
 
 bool CTextureDatabase::IncrementUseCount(const CTextureDetails &details)
@@ -276,6 +282,22 @@ bool CTextureDatabase::GetTextures(CVariant &items, const Filter &filter)
   return false;
 }
 
+std::string CTextureDatabase::GetOldestCachedImagesFilter(unsigned int maxImages) const
+{
+  // PVR manages own image cache, so exclude from here:
+  //   `WHERE url NOT LIKE 'image://pvr%%' AND url NOT LIKE 'image://epg%%'`
+  // "re-check" between minimum of 30 days and maximum of total time required to check all
+  //   current images by maxImages 4 times per day, in case of very many images in library.
+  return PrepareSQL(
+      "FROM texture JOIN sizes ON (texture.id=sizes.idtexture AND sizes.size=1) WHERE "
+      "url NOT LIKE 'image://pvr%%' AND url NOT LIKE 'image://epg%%' AND lastusetime < "
+      "datetime('now', '-30 days') AND (lastlibrarycheck IS NULL OR lastlibrarycheck < "
+      "datetime('now', '-'||min((select (count(*) / %u / 4) + 1 from texture WHERE url NOT LIKE "
+      "'image://pvr%%' AND url NOT LIKE 'image://epg%%'), max(30, (julianday(lastlibrarycheck) - "
+      "julianday(sizes.lastusetime)) / 2))||' days'))",
+      maxImages);
+}
+
 std::vector<std::string> CTextureDatabase::GetOldestCachedImages(unsigned int maxImages) const
 {
   try
@@ -283,23 +305,156 @@ std::vector<std::string> CTextureDatabase::GetOldestCachedImages(unsigned int ma
     if (!m_pDB || !m_pDS)
       return {};
 
-    // PVR manages own image cache, so exclude from here:
-    //   `WHERE url NOT LIKE 'image://pvr%%' AND url NOT LIKE 'image://epg%%'`
-    // "re-check" between minimum of 30 days and maximum of total time required to check all
-    //   current images by maxImages 4 times per day, in case of very many images in library.
-    std::string sql = PrepareSQL(
-        "SELECT url FROM texture JOIN sizes ON (texture.id=sizes.idtexture AND sizes.size=1) WHERE "
-        "url NOT LIKE 'image://pvr%%' AND url NOT LIKE 'image://epg%%' AND lastusetime < "
-        "datetime('now', '-30 days') AND (lastlibrarycheck IS NULL OR lastlibrarycheck < "
-        "datetime('now', '-'||min((select (count(*) / %u / 4) + 1 from texture WHERE url NOT LIKE "
-        "'image://pvr%%' AND url NOT LIKE 'image://epg%%'), max(30, (julianday(lastlibrarycheck) - "
-        "julianday(sizes.lastusetime)) / 2))||' days')) ORDER BY COALESCE(lastlibrarycheck, "
-        "lastusetime) ASC LIMIT %u",
-        maxImages, maxImages);
+    std::string sql = "SELECT url " + GetOldestCachedImagesFilter(maxImages) +
+                      PrepareSQL(" ORDER BY COALESCE(lastlibrarycheck, lastusetime) ASC LIMIT %u",
+                                 maxImages);
+
+    if (!m_pDS->query(sql))
+      return {};
+
+    std::vector<std::string> result;
+    while (!m_pDS->eof())
+    {
+      result.push_back(m_pDS->fv(0).get_asString());
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return result;
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{}, failed", __FUNCTION__);
+  }
+  return {};
+}
+
+unsigned int CTextureDatabase::GetOldestCachedImagesCount(unsigned int maxImages) const
+{
+  try
+  {
+    if (!m_pDB || !m_pDS)
+      return 0;
+
+    if (!m_pDS->query("SELECT count(*) " + GetOldestCachedImagesFilter(maxImages)))
+      return 0;
+
+    unsigned int result = 0;
+    if (!m_pDS->eof())
+      result = static_cast<unsigned int>(m_pDS->fv(0).get_asInt());
+    m_pDS->close();
+    return result;
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{}, failed", __FUNCTION__);
+  }
+  return 0;
+}
+
+uint64_t CTextureDatabase::GetCachedImagesSize() const
+{
+  try
+  {
+    if (!m_pDB || !m_pDS)
+      return 0;
+
+    if (!m_pDS->query("SELECT sum(filesize) FROM sizes WHERE size=1"))
+      return 0;
+
+    uint64_t result = 0;
+    if (!m_pDS->eof())
+      result = static_cast<uint64_t>(m_pDS->fv(0).get_asInt64());
+    m_pDS->close();
+    return result;
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{}, failed", __FUNCTION__);
+  }
+  return 0;
+}
+
+std::vector<std::pair<int, std::string>> CTextureDatabase::GetCachedImagesWithoutSize(
+    unsigned int maxImages) const
+{
+  try
+  {
+    if (!m_pDB || !m_pDS)
+      return {};
+
+    std::string sql = PrepareSQL("SELECT id, cachedurl FROM texture JOIN sizes ON "
+                                 "(texture.id=sizes.idtexture AND sizes.size=1) WHERE "
+                                 "sizes.filesize IS NULL LIMIT %u",
+                                 maxImages);
+    if (!m_pDS->query(sql))
+      return {};
+
+    std::vector<std::pair<int, std::string>> result;
+    while (!m_pDS->eof())
+    {
+      result.emplace_back(m_pDS->fv(0).get_asInt(), m_pDS->fv(1).get_asString());
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return result;
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{}, failed", __FUNCTION__);
+  }
+  return {};
+}
+
+bool CTextureDatabase::SetCachedImageSize(int textureID, uint64_t fileSize)
+{
+  return ExecuteQuery(PrepareSQL("UPDATE sizes SET filesize=%" PRIu64
+                                 " WHERE idtexture=%u AND size=1",
+                                 fileSize, textureID));
+}
+
+std::vector<int> CTextureDatabase::GetLeastRecentlyUsedImages(uint64_t bytes) const
+{
+  try
+  {
+    if (!m_pDB || !m_pDS)
+      return {};
 
+    // The images shown in the last hour are kept, they are likely to be shown again soon.
+    // Evicted images are cached again when the library shows them.
+    std::string sql = "SELECT id, filesize FROM texture JOIN sizes ON (texture.id=sizes.idtexture "
+                      "AND sizes.size=1) WHERE sizes.lastusetime < datetime('now', '-1 hours') "
+                      "ORDER BY sizes.lastusetime ASC, sizes.usecount ASC LIMIT 10000";
     if (!m_pDS->query(sql))
       return {};
 
+    std::vector<int> result;
+    uint64_t freed = 0;
+    while (!m_pDS->eof() && freed < bytes)
+    {
+      result.push_back(m_pDS->fv(0).get_asInt());
+      freed += static_cast<uint64_t>(m_pDS->fv(1).get_asInt64());
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return result;
+  }
+  catch (...)
+  {
+    CLog::Log(LOGERROR, "{}, failed", __FUNCTION__);
+  }
+  return {};
+}
+
+std::vector<std::string> CTextureDatabase::GetCachedImages() const
+{
+  try
+  {
+    if (!m_pDB || !m_pDS)
+      return {};
+
+    if (!m_pDS->query("SELECT url FROM texture"))
+      return {};
+
     std::vector<std::string> result;
     while (!m_pDS->eof())
     {
@@ -358,7 +513,9 @@ bool CTextureDatabase::AddCachedTexture(const std::string &url, const CTextureDe
     int textureID = (int)m_pDS->lastinsertid();
 
     // set the size information
-    sql = PrepareSQL("INSERT INTO sizes (idtexture, size, usecount, lastusetime, width, height) VALUES(%u, 1, 1, CURRENT_TIMESTAMP, %u, %u)", textureID, details.width, details.height);
+    sql = PrepareSQL("INSERT INTO sizes (idtexture, size, usecount, lastusetime, width, height, "
+                     "filesize) VALUES(%u, 1, 1, CURRENT_TIMESTAMP, %u, %u, %" PRIu64 ")",
+                     textureID, details.width, details.height, details.fileSize);
     m_pDS->exec(sql);
 
     CommitTransaction();
@@ -12,7 +12,9 @@
 #include "dbwrappers/Database.h"
 #include "dbwrappers/DatabaseQuery.h"
 
+#include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 
 class CVariant;
@@ -109,6 +111,40 @@ public:
    */
   std::vector<std::string> GetOldestCachedImages(unsigned int maxImages) const;
 
+  /*!
+   * @brief Get the number of cached images eligible for cleaning.
+   * @param maxImages the maximum number of images returned at a time by GetOldestCachedImages
+   * @return the number of images GetOldestCachedImages would return without a limit
+   */
+  unsigned int GetOldestCachedImagesCount(unsigned int maxImages) const;
+
+  /*!
+   * @brief Get the size on disk of the cached images, as far as it is known.
+   */
+  uint64_t GetCachedImagesSize() const;
+
+  /*!
+   * @brief Get the cached images whose size isn't known, cached before sizes were kept.
+   * @param maxImages the maximum number of images to return
+   * @return the ids and cached urls of the images
+   */
+  std::vector<std::pair<int, std::string>> GetCachedImagesWithoutSize(
+      unsigned int maxImages) const;
+  bool SetCachedImageSize(int textureID, uint64_t fileSize);
+
+  /*!
+   * @brief Get the least recently used cached images, the ones to evict to free space.
+   * @param bytes the size of the images to return
+   * @return the ids of the images
+   */
+  std::vector<int> GetLeastRecentlyUsedImages(uint64_t bytes) const;
+
+  /*!
+   * @brief Get the urls of all cached images. Used to pre-cache the library images.
+   * @return the original urls of the cached images
+   */
+  std::vector<std::string> GetCachedImages() const;
+
   /*!
    * @brief Set a list of images to be kept. Used to clean the image cache.
    * @param imagesToKeep
@@ -127,9 +163,12 @@ protected:
    */
   unsigned int GetURLHash(const std::string &url) const;
 
+  //! FROM and WHERE clauses selecting the cached images eligible for cleaning
+  std::string GetOldestCachedImagesFilter(unsigned int maxImages) const;
+
   void CreateTables() override;
   void CreateAnalytics() override;
   void UpdateTables(int version) override;
-  int GetSchemaVersion() const override { return 14; }
+  int GetSchemaVersion() const override { return 15; }
   const char* GetBaseDBName() const override { return "Textures"; }
 };
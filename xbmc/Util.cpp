@@ -466,20 +466,23 @@ void CUtil::CleanString(const std::string& strFileName,
   const std::shared_ptr<CAdvancedSettings> advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
   const std::vector<std::string> &regexps = advancedSettings->m_videoCleanStringRegExps;
 
-  CRegExp reTags(true, CRegExp::autoUtf8);
-  CRegExp reYear(false, CRegExp::autoUtf8);
+  // Scans clean the name of every file, compile the expressions once per thread
+  thread_local KODI::REGEXP::RegExpCache yearCache;
+  thread_local KODI::REGEXP::RegExpCache tagsCache;
 
-  if (!reYear.RegComp(advancedSettings->m_videoCleanDateTimeRegExp))
+  const std::shared_ptr<CRegExp> reYear = KODI::REGEXP::GetRegExp(
+      advancedSettings->m_videoCleanDateTimeRegExp, &yearCache, false, CRegExp::autoUtf8);
+  if (!reYear)
   {
     CLog::Log(LOGERROR, "{}: Invalid datetime clean RegExp:'{}'", __FUNCTION__,
               advancedSettings->m_videoCleanDateTimeRegExp);
   }
   else
   {
-    if (reYear.RegFind(strTitleAndYear.c_str()) >= 0)
+    if (reYear->RegFind(strTitleAndYear.c_str()) >= 0)
     {
-      strTitleAndYear = reYear.GetMatch(1);
-      strYear = reYear.GetMatch(2);
+      strTitleAndYear = reYear->GetMatch(1);
+      strYear = reYear->GetMatch(2);
     }
   }
 
@@ -487,13 +490,15 @@ void CUtil::CleanString(const std::string& strFileName,
 
   for (const auto &regexp : regexps)
   {
-    if (!reTags.RegComp(regexp.c_str()))
+    const std::shared_ptr<CRegExp> reTags =
+        KODI::REGEXP::GetRegExp(regexp, &tagsCache, true, CRegExp::autoUtf8);
+    if (!reTags)
     { // invalid regexp - complain in logs
       CLog::Log(LOGERROR, "{}: Invalid string clean RegExp:'{}'", __FUNCTION__, regexp);
       continue;
     }
     int j=0;
-    if ((j=reTags.RegFind(strTitleAndYear.c_str())) > 0)
+    if ((j=reTags->RegFind(strTitleAndYear.c_str())) > 0)
       strTitleAndYear.resize(j);
   }
 
@@ -605,6 +610,16 @@ bool CUtil::ExcludeFileOrFolder(const std::string& strFileOrFolder,
   if (strFileOrFolder.empty())
     return false;
 
+  if (cache)
+  {
+    // Test all the rules in a single match, they are only tried one by one to log the one that
+    // matched
+    if (const std::shared_ptr<CRegExp> anyOf =
+            KODI::REGEXP::GetAnyOfRegExp(regexps, *cache, true, CRegExp::autoUtf8);
+        anyOf && anyOf->RegFind(strFileOrFolder) < 0)
+      return false;
+  }
+
   std::shared_ptr<CRegExp> regExExcludes;
 
   for (const auto &regexp : regexps)
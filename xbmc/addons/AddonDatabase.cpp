@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <map>
 #include <utility>
 
 using namespace ADDON;
@@ -779,28 +780,6 @@ void CAddonDatabase::DeleteRepository(const std::string& id)
   }
 }
 
-void CAddonDatabase::DeleteRepositoryContents(const std::string& id)
-{
-  try
-  {
-    if (!m_pDB)
-      return;
-    if (!m_pDS)
-      return;
-
-    int idRepo = GetRepositoryId(id);
-    if (idRepo < 0)
-      return;
-
-    m_pDS->exec(PrepareSQL("DELETE FROM addons WHERE id IN (SELECT idAddon FROM addonlinkrepo WHERE idRepo=%i)", idRepo));
-    m_pDS->exec(PrepareSQL("DELETE FROM addonlinkrepo WHERE idRepo=%i", idRepo));
-  }
-  catch (...)
-  {
-    CLog::LogF(LOGERROR, "failed on repo '{}'", id);
-  }
-}
-
 int CAddonDatabase::GetRepositoryId(const std::string& addonId)
 {
   if (!m_pDB)
@@ -827,22 +806,70 @@ bool CAddonDatabase::UpdateRepositoryContent(const std::string& repository,
     if (!m_pDS)
       return false;
 
-    DeleteRepositoryContents(repository);
     int idRepo = GetRepositoryId(repository);
     if (idRepo < 0)
       return false;
 
     assert(idRepo > 0);
 
+    // only the entries that changed since the last update are written, most of the index of a
+    // repository stays the same between two updates
+    struct StoredAddon
+    {
+      int id;
+      std::string metadata;
+      std::string name;
+      std::string summary;
+      std::string description;
+      std::string news;
+    };
+    std::map<std::string, std::vector<StoredAddon>, std::less<>> stored;
+    m_pDS->query(PrepareSQL("SELECT addons.* FROM addons JOIN addonlinkrepo ON "
+                            "addonlinkrepo.idAddon=addons.id WHERE addonlinkrepo.idRepo=%i",
+                            idRepo));
+    while (!m_pDS->eof())
+    {
+      stored[m_pDS->fv("addonID").get_asString() + " " + m_pDS->fv("version").get_asString()]
+          .emplace_back(m_pDS->fv("id").get_asInt(), m_pDS->fv("metadata").get_asString(),
+                        m_pDS->fv("name").get_asString(), m_pDS->fv("summary").get_asString(),
+                        m_pDS->fv("description").get_asString(),
+                        m_pDS->fv("news").get_asString());
+      m_pDS->next();
+    }
+    m_pDS->close();
+
     m_pDB->start_transaction();
     m_pDS->exec(
         PrepareSQL("UPDATE repo SET checksum='%s' WHERE id='%i'", checksum.c_str(), idRepo));
+    unsigned int unchanged = 0;
     for (const auto& addon : addons)
     {
+      const std::string metadata = CAddonDatabaseSerializer::SerializeMetadata(*addon);
+
+      const auto it = stored.find(addon->ID() + " " + addon->Version().asString());
+      if (it != stored.end() && !it->second.empty())
+      {
+        const StoredAddon old = std::move(it->second.back());
+        it->second.pop_back();
+        if (old.metadata == metadata && old.name == addon->Name() &&
+            old.summary == addon->Summary() && old.description == addon->Description() &&
+            old.news == addon->ChangeLog())
+        {
+          ++unchanged;
+          continue;
+        }
+
+        m_pDS->exec(PrepareSQL("UPDATE addons SET metadata='%s', name='%s', summary='%s', "
+                               "description='%s', news='%s' WHERE id=%i",
+                               metadata.c_str(), addon->Name().c_str(), addon->Summary().c_str(),
+                               addon->Description().c_str(), addon->ChangeLog().c_str(), old.id));
+        continue;
+      }
+
       m_pDS->exec(PrepareSQL(
           "INSERT INTO addons (id, metadata, addonID, version, name, summary, description, news) "
           "VALUES (NULL, '%s', '%s', '%s', '%s','%s', '%s','%s')",
-          CAddonDatabaseSerializer::SerializeMetadata(*addon).c_str(), addon->ID().c_str(),
+          metadata.c_str(), addon->ID().c_str(),
           addon->Version().asString().c_str(), addon->Name().c_str(), addon->Summary().c_str(),
           addon->Description().c_str(), addon->ChangeLog().c_str()));
 
@@ -857,7 +884,25 @@ bool CAddonDatabase::UpdateRepositoryContent(const std::string& repository,
       m_pDS->exec(PrepareSQL("INSERT INTO addonlinkrepo (idRepo, idAddon) VALUES (%i, %i)", idRepo, idAddon));
     }
 
+    // what is left is gone from the repository
+    std::vector<std::string> removed;
+    for (const auto& [_, rows] : stored)
+    {
+      for (const auto& row : rows)
+        removed.emplace_back(std::to_string(row.id));
+    }
+    if (!removed.empty())
+    {
+      const std::string ids = StringUtils::Join(removed, ",");
+      m_pDS->exec(PrepareSQL("DELETE FROM addons WHERE id IN (%s)", ids.c_str()));
+      m_pDS->exec(PrepareSQL("DELETE FROM addonlinkrepo WHERE idRepo=%i AND idAddon IN (%s)",
+                             idRepo, ids.c_str()));
+    }
+
     m_pDB->commit_transaction();
+    CLog::Log(LOGDEBUG,
+              "CAddonDatabase: updated repository {}: {} unchanged, {} written, {} removed",
+              repository, unchanged, addons.size() - unchanged, removed.size());
     return true;
   }
   catch (...)
@@ -248,7 +248,6 @@ protected:
 
   bool GetAddon(int id, ADDON::AddonPtr& addon);
   void DeleteRepository(const std::string& id);
-  void DeleteRepositoryContents(const std::string& id);
   int GetRepositoryId(const std::string& addonId);
 };
 
@@ -23,6 +23,7 @@
 #include "addons/IAddon.h"
 #include "addons/addoninfo/AddonInfo.h"
 #include "addons/addoninfo/AddonInfoBuilder.h"
+#include "addons/addoninfo/AddonInfoCache.h"
 #include "addons/addoninfo/AddonType.h"
 #include "events/AddonManagementEvent.h"
 #include "events/EventLog.h"
@@ -33,6 +34,7 @@
 #include "resources/LocalizeStrings.h"
 #include "resources/ResourcesComponent.h"
 #include "utils/FileUtils.h"
+#include "utils/StartupTrace.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/XBMCTinyXML2.h"
@@ -94,6 +96,7 @@ bool LoadManifest(std::set<std::string, std::less<>>& system,
 
 CAddonMgr::CAddonMgr()
   : m_database(std::make_unique<CAddonDatabase>()),
+    m_infoCache(std::make_unique<CAddonInfoCache>("special://temp/addoninfo.json")),
     m_updateRules(std::make_unique<CAddonUpdateRules>())
 {
 }
@@ -129,6 +132,8 @@ void CAddonMgr::UnregisterAddonMgrCallback(AddonType type) const
 
 bool CAddonMgr::Init()
 {
+  CStartupTrace::CScope trace("CAddonMgr::Init");
+
   std::unique_lock lock(m_critSection);
 
   if (!LoadManifest(m_systemAddons, m_optionalSystemAddons))
@@ -665,6 +670,7 @@ bool CAddonMgr::FindAddon(const std::string& addonId,
   if (!CSpecialProtocol::ComparePath("special://xbmcbin/addons", "special://xbmc/addons"))
     FindAddons(installedAddons, "special://xbmc/addons");
   FindAddons(installedAddons, "special://home/addons");
+  m_infoCache->Save();
 
   const auto it = installedAddons.find(addonId);
   if (it == installedAddons.cend() || it->second->Version() != addonVersion)
@@ -696,6 +702,7 @@ bool CAddonMgr::FindAddons()
   if (!CSpecialProtocol::ComparePath("special://xbmcbin/addons", "special://xbmc/addons"))
     FindAddons(installedAddons, "special://xbmc/addons");
   FindAddons(installedAddons, "special://home/addons");
+  m_infoCache->Save();
 
   std::set<std::string, std::less<>> installed;
   for (const auto& [_, addon] : installedAddons)
@@ -1280,7 +1287,7 @@ void CAddonMgr::FindAddons(AddonInfoMap& addonmap, const std::string& path) cons
       const std::string p{i->GetPath()};
       if (CFileUtils::Exists(p + "addon.xml"))
       {
-        AddonInfoPtr addonInfo = CAddonInfoBuilder::Generate(p);
+        AddonInfoPtr addonInfo = m_infoCache->Get(p);
         if (addonInfo)
         {
           const auto it = addonmap.find(addonInfo->ID());
@@ -34,6 +34,7 @@ class CAddonVersion;
 class IAddonMgrCallback;
 
 class CAddonInfo;
+class CAddonInfoCache;
 using AddonInfoPtr = std::shared_ptr<CAddonInfo>;
 using AddonInfoMap = std::map<std::string, AddonInfoPtr, std::less<>>;
 
@@ -680,6 +681,7 @@ private:
   static std::map<AddonType, IAddonMgrCallback*> m_managers;
   mutable CCriticalSection m_critSection;
   std::unique_ptr<CAddonDatabase> m_database;
+  std::unique_ptr<CAddonInfoCache> m_infoCache;
   std::unique_ptr<CAddonUpdateRules> m_updateRules;
   CEventSource<AddonEvent> m_events;
   CBlockingEventSource<AddonEvent> m_unloadEvents;
@@ -209,7 +209,7 @@ bool CAudioDecoder::Load(const std::string& fileName,
 
         if (file.LoadFile(ifcTag.cover_art_path, buf) > 0)
         {
-          tag.SetCoverArtInfo(buf.size(), mimetype);
+          tag.SetCoverArtInfo(buf.data(), buf.size(), mimetype);
           if (art)
             art->Set(reinterpret_cast<const uint8_t*>(buf.data()), buf.size(), mimetype);
         }
@@ -218,7 +218,8 @@ bool CAudioDecoder::Load(const std::string& fileName,
     }
     else if (ifcTag.cover_art_mem_mimetype && ifcTag.cover_art_mem && ifcTag.cover_art_mem_size > 0)
     {
-      tag.SetCoverArtInfo(ifcTag.cover_art_mem_size, ifcTag.cover_art_mem_mimetype);
+      tag.SetCoverArtInfo(ifcTag.cover_art_mem, ifcTag.cover_art_mem_size,
+                          ifcTag.cover_art_mem_mimetype);
       if (art)
         art->Set(ifcTag.cover_art_mem, ifcTag.cover_art_mem_size, ifcTag.cover_art_mem_mimetype);
     }
@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <string_view>
 #include <tuple>
 #include <utility>
 
@@ -40,6 +41,15 @@ using namespace KODI::MESSAGING;
 using KODI::UTILITY::CDigest;
 using KODI::UTILITY::TypedDigest;
 
+namespace
+{
+// separates the parts of the checksum of a repository with several dirs
+constexpr std::string_view CHECKSUM_SEPARATOR = "\n";
+// prefixes of the validators of an index kept as the checksum of its dir
+constexpr std::string_view VALIDATOR_ETAG = "etag:";
+constexpr std::string_view VALIDATOR_MODIFIED = "modified:";
+} // unnamed namespace
+
 
 CRepository::ResolveResult CRepository::ResolvePathAndHash(const AddonPtr& addon) const
 {
@@ -99,6 +109,17 @@ CRepository::ResolveResult CRepository::ResolvePathAndHash(const AddonPtr& addon
   return {location, hash};
 }
 
+std::string CRepository::GetHostName() const
+{
+  for (const auto& dir : m_dirs)
+  {
+    const std::string& url = dir.checksum.empty() ? dir.info : dir.checksum;
+    if (URIUtils::IsRemote(url))
+      return CURL(url).GetHostName();
+  }
+  return {};
+}
+
 CRepository::CRepository(const AddonInfoPtr& addonInfo) : CAddon(addonInfo, AddonType::REPOSITORY)
 {
   RepositoryDirList dirs;
@@ -205,26 +226,47 @@ bool CRepository::FetchChecksum(const std::string& url,
   return true;
 }
 
-bool CRepository::FetchIndex(const RepositoryDirInfo& repo,
-                             std::string const& digest,
-                             std::vector<AddonInfoPtr>& addons) noexcept
+CRepository::FetchStatus CRepository::FetchIndex(const RepositoryDirInfo& repo,
+                                                 std::string const& digest,
+                                                 std::string_view oldValidator,
+                                                 std::string& validator,
+                                                 std::vector<AddonInfoPtr>& addons) noexcept
 {
   XFILE::CCurlFile http;
+  if (oldValidator.starts_with(VALIDATOR_ETAG))
+    http.SetRequestHeader("If-None-Match",
+                          std::string(oldValidator.substr(VALIDATOR_ETAG.size())));
+  else if (oldValidator.starts_with(VALIDATOR_MODIFIED))
+    http.SetRequestHeader("If-Modified-Since",
+                          std::string(oldValidator.substr(VALIDATOR_MODIFIED.size())));
 
   std::string response;
   if (!http.Get(repo.info, response))
   {
     CLog::Log(LOGERROR, "CRepository: failed to read {}", repo.info);
-    return false;
+    return FetchStatus::FETCH_ERROR;
+  }
+
+  if (!oldValidator.empty() && http.GetResponseCode() == 304)
+  {
+    validator = oldValidator;
+    return FetchStatus::NOT_MODIFIED;
   }
 
-  if (repo.checksumType != CDigest::Type::INVALID)
+  validator.clear();
+  if (const std::string etag = http.GetHttpHeader().GetValue("ETag"); !etag.empty())
+    validator = std::string(VALIDATOR_ETAG) + etag;
+  else if (const std::string modified = http.GetHttpHeader().GetValue("Last-Modified");
+           !modified.empty())
+    validator = std::string(VALIDATOR_MODIFIED) + modified;
+
+  if (repo.checksumType != CDigest::Type::INVALID && !repo.checksum.empty())
   {
     std::string actualDigest = CDigest::Calculate(repo.checksumType, response);
     if (!StringUtils::EqualsNoCase(digest, actualDigest))
     {
       CLog::Log(LOGERROR, "CRepository: {} index has wrong digest {}, expected: {}", repo.info, actualDigest, digest);
-      return false;
+      return FetchStatus::FETCH_ERROR;
     }
   }
 
@@ -237,12 +279,14 @@ bool CRepository::FetchIndex(const RepositoryDirInfo& repo,
     if (!CZipFile::DecompressGzip(response, buffer))
     {
       CLog::Log(LOGERROR, "CRepository: failed to decompress gzip from '{}'", repo.info);
-      return false;
+      return FetchStatus::FETCH_ERROR;
     }
     response = std::move(buffer);
   }
 
-  return CServiceBroker::GetAddonMgr().AddonsFromRepoXML(repo, response, addons);
+  if (!CServiceBroker::GetAddonMgr().AddonsFromRepoXML(repo, response, addons))
+    return FetchStatus::FETCH_ERROR;
+  return FetchStatus::OK;
 }
 
 CRepository::FetchStatus CRepository::FetchIfChanged(std::string_view oldChecksum,
@@ -250,47 +294,76 @@ CRepository::FetchStatus CRepository::FetchIfChanged(std::string_view oldChecksu
                                                      std::vector<AddonInfoPtr>& addons,
                                                      int& recheckAfter) const
 {
-  checksum = "";
-  std::vector<std::tuple<RepositoryDirInfo const&, std::string>> dirChecksums;
+  // the checksum of the repository is made of one part per dir: the content of its checksum
+  // file, or the validator of its last index response when it has none
+  std::vector<std::string> oldParts;
+  if (!oldChecksum.empty())
+    oldParts = StringUtils::Split(oldChecksum, CHECKSUM_SEPARATOR);
+  if (oldParts.size() != m_dirs.size())
+    oldParts.assign(m_dirs.size(), "");
+
+  std::vector<std::string> parts(m_dirs.size());
+  std::vector<std::vector<AddonInfoPtr>> dirAddons(m_dirs.size());
+  std::vector<bool> fetched(m_dirs.size(), false);
   std::vector<int> recheckAfterTimes;
+  bool modified = false;
 
-  for (const auto& dir : m_dirs)
+  for (size_t i = 0; i < m_dirs.size(); ++i)
   {
+    const RepositoryDirInfo& dir = m_dirs[i];
     if (!dir.checksum.empty())
     {
-      std::string part;
       int recheckAfterThisDir;
-      if (!FetchChecksum(dir.checksum, part, recheckAfterThisDir))
+      if (!FetchChecksum(dir.checksum, parts[i], recheckAfterThisDir))
       {
         recheckAfter = 1 * 60 * 60; // retry after 1 hour
         CLog::Log(LOGERROR, "CRepository: failed read '{}'", dir.checksum);
         return FetchStatus::FETCH_ERROR;
       }
-      dirChecksums.emplace_back(dir, part);
       recheckAfterTimes.push_back(recheckAfterThisDir);
-      checksum += part;
+      modified |= parts[i].empty() || parts[i] != oldParts[i];
+      continue;
+    }
+
+    // without checksum file the index itself is requested, conditionally when it has been
+    // read before, so an unchanged index costs no more than a checksum file
+    const FetchStatus status = FetchIndex(dir, "", oldParts[i], parts[i], dirAddons[i]);
+    if (status == FetchStatus::FETCH_ERROR)
+    {
+      recheckAfter = 1 * 60 * 60; // retry after 1 hour
+      return FetchStatus::FETCH_ERROR;
     }
+    fetched[i] = status == FetchStatus::OK;
+    modified |= fetched[i] || parts[i].empty();
   }
 
+  checksum = StringUtils::Join(parts, CHECKSUM_SEPARATOR);
+
   // Default interval: 24 h
-  recheckAfter = 24 * 60 * 60;
-  if (dirChecksums.size() == m_dirs.size() && !dirChecksums.empty())
-  {
-    // Use smallest update interval out of all received (individual intervals per directory are
-    // not possible)
-    recheckAfter = *std::ranges::min_element(recheckAfterTimes);
-    // If all directories have checksums and they match the last one, nothing has changed
-    if (dirChecksums.size() == m_dirs.size() && oldChecksum == checksum)
-      return FetchStatus::NOT_MODIFIED;
-  }
+  // Use smallest update interval out of all received (individual intervals per directory are
+  // not possible)
+  recheckAfter = recheckAfterTimes.empty() ? 24 * 60 * 60
+                                           : *std::ranges::min_element(recheckAfterTimes);
+
+  // If all directories match the last check, nothing has changed
+  if (!modified)
+    return FetchStatus::NOT_MODIFIED;
 
-  for (const auto& [repoInfo, digest] : dirChecksums)
+  // the content of the repository is replaced as a whole, the unchanged dirs are read as well
+  for (size_t i = 0; i < m_dirs.size(); ++i)
   {
-    std::vector<AddonInfoPtr> tmp;
-    if (!FetchIndex(repoInfo, digest, tmp))
-      return FetchStatus::FETCH_ERROR;
-    addons.insert(addons.end(), tmp.begin(), tmp.end());
+    if (!fetched[i])
+    {
+      std::string validator;
+      if (FetchIndex(m_dirs[i], parts[i], "", validator, dirAddons[i]) != FetchStatus::OK)
+        return FetchStatus::FETCH_ERROR;
+      if (m_dirs[i].checksum.empty())
+        parts[i] = std::move(validator);
+    }
+    addons.insert(addons.end(), dirAddons[i].begin(), dirAddons[i].end());
   }
+
+  checksum = StringUtils::Join(parts, CHECKSUM_SEPARATOR);
   return FetchStatus::OK;
 }
 
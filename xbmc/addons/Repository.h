@@ -59,6 +59,11 @@ public:
   };
   ResolveResult ResolvePathAndHash(AddonPtr const& addon) const;
 
+  /*!
+   * \brief Host the repository is updated from, empty for local repositories.
+   */
+  std::string GetHostName() const;
+
   // Implementation of CAddon
   void OnPostInstall(bool update, bool modal) override;
 
@@ -66,9 +71,19 @@ private:
   static bool FetchChecksum(const std::string& url,
                             std::string& checksum,
                             int& recheckAfter) noexcept;
-  static bool FetchIndex(const RepositoryDirInfo& repo,
-                         std::string const& digest,
-                         std::vector<AddonInfoPtr>& addons) noexcept;
+  /*!
+   * \brief Read the index of a dir.
+   * \param digest content of the checksum file of the dir the index is verified with
+   * \param oldValidator validator of the last response, the index is requested only if it
+   *        changed since then
+   * \param[out] validator ETag or modification time of the response, for the next request
+   * \return NOT_MODIFIED if the index didn't change since oldValidator
+   */
+  static FetchStatus FetchIndex(const RepositoryDirInfo& repo,
+                                std::string const& digest,
+                                std::string_view oldValidator,
+                                std::string& validator,
+                                std::vector<AddonInfoPtr>& addons) noexcept;
 
   static RepositoryDirInfo ParseDirConfiguration(const CAddonExtensions& configuration);
 
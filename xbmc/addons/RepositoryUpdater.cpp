@@ -53,6 +53,13 @@ public:
   bool DoWork() override;
   const RepositoryPtr& GetAddon() const { return m_repo; }
 
+  // the updates of repositories on different hosts run side by side
+  RESOURCE GetResource(std::string& host) const override
+  {
+    host = m_repo->GetHostName();
+    return host.empty() ? RESOURCE_DISK : RESOURCE_NETWORK;
+  }
+
 private:
   const RepositoryPtr m_repo;
 };
@@ -226,6 +226,8 @@ void CScraper::ClearCache() const
   }
   else
     CDirectory::Create(strCachePath);
+
+  CScraperUrl::ClearHttpCache();
 }
 
 // returns a vector of strings: the first is the XML output by the function; the rest
@@ -10,6 +10,7 @@
 
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "GUIInfoManager.h"
 #include "ServiceBroker.h"
 #include "Util.h"
 #include "addons/addoninfo/AddonType.h"
@@ -64,6 +65,14 @@ constexpr const char* XML_ATTR_ID = "id";
 
 constexpr auto DELAY = 500ms;
 
+// skin settings are change notified, the info manager only refreshes their bools when told
+void NotifyInfoManager()
+{
+  CGUIComponent* gui = CServiceBroker::GetGUI();
+  if (gui)
+    gui->GetInfoManager().OnInfoSourceChanged();
+}
+
 } // unnamed namespace
 
 namespace ADDON
@@ -703,6 +712,7 @@ void CSkinInfo::SetString(int setting, std::string_view label)
   if (it != m_strings.end())
   {
     it->second->value = label;
+    NotifyInfoManager();
     m_settingsUpdateHandler->TriggerSave();
     return;
   }
@@ -747,6 +757,7 @@ void CSkinInfo::SetBool(int setting, bool set)
   if (it != m_bools.end())
   {
     it->second->value = set;
+    NotifyInfoManager();
     m_settingsUpdateHandler->TriggerSave();
     return;
   }
@@ -791,6 +802,7 @@ void CSkinInfo::Reset(const std::string &setting)
     if (StringUtils::EqualsNoCase(setting, settingstring->name))
     {
       settingstring->value.clear();
+      NotifyInfoManager();
       m_settingsUpdateHandler->TriggerSave();
       return;
     }
@@ -802,6 +814,7 @@ void CSkinInfo::Reset(const std::string &setting)
     if (StringUtils::EqualsNoCase(setting, settingbool->name))
     {
       settingbool->value = false;
+      NotifyInfoManager();
       m_settingsUpdateHandler->TriggerSave();
       return;
     }
@@ -817,6 +830,7 @@ void CSkinInfo::Reset()
   for (const auto& [_, settingstring] : m_strings)
     settingstring->value.clear();
 
+  NotifyInfoManager();
   m_settingsUpdateHandler->TriggerSave();
 }
 
@@ -901,6 +915,7 @@ bool CSkinInfo::SettingsFromXML(const CXBMCTinyXML& doc,
                 setting->GetType());
   }
 
+  NotifyInfoManager();
   return true;
 }
 
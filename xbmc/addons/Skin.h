@@ -166,6 +166,10 @@ public:
   void ResolveIncludes(TiXmlElement* node,
                        std::map<INFO::InfoPtr, bool>* xmlIncludeConditions = nullptr);
 
+  /*! \brief Get the include files of this skin
+   */
+  const std::vector<std::string>& GetIncludeFiles() const { return m_includes.GetFiles(); }
+
   float GetEffectsSlowdown() const { return m_effectsSlowDown; }
 
   const std::vector<CStartupWindow>& GetStartupWindows() const { return m_startupWindows; }
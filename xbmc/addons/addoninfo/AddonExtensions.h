@@ -17,6 +17,7 @@ namespace ADDON
 {
 
 class CAddonInfoBuilder;
+class CAddonInfoCache;
 class CAddonDatabaseSerializer;
 
 struct SExtValue
@@ -71,6 +72,7 @@ public:
 
 private:
   friend class CAddonInfoBuilder;
+  friend class CAddonInfoCache;
   friend class CAddonDatabaseSerializer;
 
   std::string m_point;
@@ -133,6 +133,7 @@ struct DependencyInfo
 using InfoMap = std::map<std::string, std::string, std::less<>>;
 
 class CAddonInfoBuilder;
+class CAddonInfoCache;
 
 class CAddonInfo
 {
@@ -262,6 +263,7 @@ public:
 private:
   friend class CAddonInfoBuilder;
   friend class CAddonInfoBuilderFromDB;
+  friend class CAddonInfoCache;
 
   std::string m_id;
   AddonType m_mainType{};
@@ -0,0 +1,393 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AddonInfoCache.h"
+
+#include "CompileInfo.h"
+#include "addons/addoninfo/AddonInfo.h"
+#include "addons/addoninfo/AddonInfoBuilder.h"
+#include "addons/addoninfo/AddonType.h"
+#include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
+#include "utils/JSONVariantParser.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/URIUtils.h"
+#include "utils/Variant.h"
+#include "utils/log.h"
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace ADDON
+{
+namespace
+{
+// increase when the layout of the file changes
+constexpr int CACHE_VERSION = 1;
+
+std::string GetBuildId()
+{
+  return std::string(CCompileInfo::GetSCMID()) + " " + CCompileInfo::GetBuildDate();
+}
+
+CVariant SerializeStrings(const CLocale::LocalizedStringsMap& strings)
+{
+  CVariant variant(CVariant::VariantTypeObject);
+  for (const auto& [locale, text] : strings)
+    variant[locale] = text;
+  return variant;
+}
+
+CLocale::LocalizedStringsMap DeserializeStrings(const CVariant& variant)
+{
+  CLocale::LocalizedStringsMap strings;
+  for (auto it = variant.begin_map(); it != variant.end_map(); ++it)
+    strings.try_emplace(it->first, it->second.asString());
+  return strings;
+}
+} // unnamed namespace
+
+CAddonInfoCache::CAddonInfoCache(std::string file) : m_file(std::move(file))
+{
+}
+
+AddonInfoPtr CAddonInfoCache::Get(const std::string& addonPath)
+{
+  std::unique_lock lock(m_critSection);
+
+  if (!m_loaded)
+  {
+    Load();
+    m_loaded = true;
+  }
+
+  const std::string realPath = CSpecialProtocol::TranslatePath(addonPath);
+  Stamp stamp;
+  const bool stamped = GetStamp(realPath, stamp);
+
+  const auto it = m_entries.find(realPath);
+  if (stamped && it != m_entries.end() && it->second.stamp == stamp)
+  {
+    it->second.used = true;
+    // the caller sets the install data, the cached info must not change under other users
+    return std::make_shared<CAddonInfo>(*it->second.info);
+  }
+
+  AddonInfoPtr info = CAddonInfoBuilder::Generate(addonPath);
+  if (!info || !stamped)
+  {
+    if (it != m_entries.end())
+    {
+      m_entries.erase(it);
+      m_changed = true;
+    }
+    return info;
+  }
+
+  m_entries.insert_or_assign(realPath, Entry{stamp, std::make_shared<CAddonInfo>(*info), true});
+  m_changed = true;
+  return info;
+}
+
+void CAddonInfoCache::Save()
+{
+  std::unique_lock lock(m_critSection);
+
+  for (auto it = m_entries.begin(); it != m_entries.end();)
+  {
+    if (!it->second.used)
+    {
+      it = m_entries.erase(it);
+      m_changed = true;
+      continue;
+    }
+    it->second.used = false;
+    ++it;
+  }
+
+  if (!m_changed)
+    return;
+
+  CVariant variant(CVariant::VariantTypeObject);
+  variant["version"] = CACHE_VERSION;
+  variant["build"] = GetBuildId();
+  variant["addons"] = CVariant(CVariant::VariantTypeObject);
+  for (const auto& [path, entry] : m_entries)
+  {
+    CVariant item = Serialize(*entry.info);
+    item["stamp"]["xmltime"] = entry.stamp.xmlTime;
+    item["stamp"]["xmlsize"] = entry.stamp.xmlSize;
+    item["stamp"]["dirtime"] = entry.stamp.dirTime;
+    item["stamp"]["resourcestime"] = entry.stamp.resourcesTime;
+    variant["addons"][path] = std::move(item);
+  }
+
+  std::string json;
+  XFILE::CFile file;
+  if (!CJSONVariantWriter::Write(variant, json, true) || !file.OpenForWrite(m_file, true) ||
+      file.Write(json.data(), json.size()) != static_cast<ssize_t>(json.size()))
+  {
+    CLog::LogF(LOGERROR, "Unable to write the add-on info cache '{}'", m_file);
+    return;
+  }
+
+  m_changed = false;
+}
+
+bool CAddonInfoCache::GetStamp(const std::string& addonRealPath, Stamp& stamp)
+{
+  struct __stat64 buffer{};
+  if (XFILE::CFile::Stat(URIUtils::AddFileToFolder(addonRealPath, "addon.xml"), &buffer) != 0)
+    return false;
+  stamp.xmlTime = static_cast<int64_t>(buffer.st_mtime);
+  stamp.xmlSize = static_cast<int64_t>(buffer.st_size);
+
+  // the folders change when changelog.txt or the settings are added or removed
+  if (XFILE::CFile::Stat(addonRealPath, &buffer) != 0)
+    return false;
+  stamp.dirTime = static_cast<int64_t>(buffer.st_mtime);
+
+  stamp.resourcesTime = 0;
+  if (XFILE::CFile::Stat(URIUtils::AddFileToFolder(addonRealPath, "resources"), &buffer) == 0)
+    stamp.resourcesTime = static_cast<int64_t>(buffer.st_mtime);
+
+  return true;
+}
+
+void CAddonInfoCache::Load()
+{
+  XFILE::CFile file;
+  std::vector<uint8_t> buffer;
+  if (!XFILE::CFile::Exists(m_file) || file.LoadFile(m_file, buffer) <= 0)
+    return;
+
+  CVariant variant;
+  if (!CJSONVariantParser::Parse(std::string(buffer.begin(), buffer.end()), variant) ||
+      variant["version"].asInteger() != CACHE_VERSION ||
+      variant["build"].asString() != GetBuildId())
+  {
+    CLog::LogF(LOGDEBUG, "Ignoring the add-on info cache '{}' of another build", m_file);
+    return;
+  }
+
+  const CVariant& addons = variant["addons"];
+  for (auto it = addons.begin_map(); it != addons.end_map(); ++it)
+  {
+    const CVariant& item = it->second;
+    AddonInfoPtr info = Deserialize(item);
+    if (!info)
+      continue;
+
+    Stamp stamp;
+    stamp.xmlTime = item["stamp"]["xmltime"].asInteger();
+    stamp.xmlSize = item["stamp"]["xmlsize"].asInteger();
+    stamp.dirTime = item["stamp"]["dirtime"].asInteger();
+    stamp.resourcesTime = item["stamp"]["resourcestime"].asInteger();
+    m_entries.insert_or_assign(it->first, Entry{stamp, std::move(info), false});
+  }
+
+  CLog::LogF(LOGDEBUG, "Loaded {} add-on infos from '{}'", m_entries.size(), m_file);
+}
+
+CVariant CAddonInfoCache::Serialize(const CAddonInfo& addon)
+{
+  CVariant variant(CVariant::VariantTypeObject);
+  variant["id"] = addon.m_id;
+  variant["maintype"] = static_cast<unsigned int>(addon.m_mainType);
+  variant["version"] = addon.m_version.asString();
+  variant["minversion"] = addon.m_minversion.asString();
+  variant["binary"] = addon.m_isBinary;
+  variant["name"] = addon.m_name;
+  variant["license"] = addon.m_license;
+  variant["summary"] = SerializeStrings(addon.m_summary);
+  variant["description"] = SerializeStrings(addon.m_description);
+  variant["author"] = addon.m_author;
+  variant["source"] = addon.m_source;
+  variant["website"] = addon.m_website;
+  variant["forum"] = addon.m_forum;
+  variant["email"] = addon.m_email;
+  variant["path"] = addon.m_path;
+  variant["profilepath"] = addon.m_profilePath;
+  variant["changelog"] = SerializeStrings(addon.m_changelog);
+  variant["icon"] = addon.m_icon;
+  variant["disclaimer"] = SerializeStrings(addon.m_disclaimer);
+  variant["lifecycletype"] = static_cast<unsigned int>(addon.m_lifecycleState);
+  variant["lifecycledesc"] = SerializeStrings(addon.m_lifecycleStateDescription);
+  variant["size"] = addon.m_packageSize;
+  variant["libname"] = addon.m_libname;
+  variant["platforms"] = addon.m_platforms;
+  variant["instancesupport"] = static_cast<unsigned int>(addon.m_addonInstanceSupportType);
+  variant["addonsettings"] = addon.m_supportsAddonSettings;
+  variant["instancesettings"] = addon.m_supportsInstanceSettings;
+
+  variant["art"] = CVariant(CVariant::VariantTypeObject);
+  for (const auto& [type, url] : addon.m_art)
+    variant["art"][type] = url;
+
+  variant["screenshots"] = addon.m_screenshots;
+
+  variant["extrainfo"] = CVariant(CVariant::VariantTypeObject);
+  for (const auto& [key, value] : addon.m_extrainfo)
+    variant["extrainfo"][key] = value;
+
+  variant["dependencies"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& dep : addon.m_dependencies)
+  {
+    CVariant info(CVariant::VariantTypeObject);
+    info["addonId"] = dep.id;
+    info["version"] = dep.version.asString();
+    info["minversion"] = dep.versionMin.asString();
+    info["optional"] = dep.optional;
+    variant["dependencies"].push_back(std::move(info));
+  }
+
+  variant["types"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& type : addon.m_types)
+  {
+    CVariant info = SerializeExtensions(type);
+    info["addontype"] = static_cast<unsigned int>(type.m_type);
+    info["path"] = type.m_path;
+    info["libname"] = type.m_libname;
+    info["provides"] = CVariant(CVariant::VariantTypeArray);
+    for (const AddonType content : type.m_providedSubContent)
+      info["provides"].push_back(static_cast<unsigned int>(content));
+    variant["types"].push_back(std::move(info));
+  }
+
+  return variant;
+}
+
+AddonInfoPtr CAddonInfoCache::Deserialize(const CVariant& variant)
+{
+  if (!variant["types"].isArray() || variant["types"].empty())
+    return nullptr;
+
+  auto addon = std::make_shared<CAddonInfo>();
+  addon->m_id = variant["id"].asString();
+  addon->m_mainType = static_cast<AddonType>(variant["maintype"].asUnsignedInteger());
+  addon->m_version = CAddonVersion(variant["version"].asString());
+  addon->m_minversion = CAddonVersion(variant["minversion"].asString());
+  addon->m_isBinary = variant["binary"].asBoolean();
+  addon->m_name = variant["name"].asString();
+  addon->m_license = variant["license"].asString();
+  addon->m_summary = DeserializeStrings(variant["summary"]);
+  addon->m_description = DeserializeStrings(variant["description"]);
+  addon->m_author = variant["author"].asString();
+  addon->m_source = variant["source"].asString();
+  addon->m_website = variant["website"].asString();
+  addon->m_forum = variant["forum"].asString();
+  addon->m_email = variant["email"].asString();
+  addon->m_path = variant["path"].asString();
+  addon->m_profilePath = variant["profilepath"].asString();
+  addon->m_changelog = DeserializeStrings(variant["changelog"]);
+  addon->m_icon = variant["icon"].asString();
+  addon->m_disclaimer = DeserializeStrings(variant["disclaimer"]);
+  addon->m_lifecycleState =
+      static_cast<AddonLifecycleState>(variant["lifecycletype"].asUnsignedInteger());
+  addon->m_lifecycleStateDescription = DeserializeStrings(variant["lifecycledesc"]);
+  addon->m_packageSize = variant["size"].asUnsignedInteger();
+  addon->m_libname = variant["libname"].asString();
+  addon->m_addonInstanceSupportType =
+      static_cast<AddonInstanceSupport>(variant["instancesupport"].asUnsignedInteger());
+  addon->m_supportsAddonSettings = variant["addonsettings"].asBoolean();
+  addon->m_supportsInstanceSettings = variant["instancesettings"].asBoolean();
+
+  for (auto it = variant["platforms"].begin_array(); it != variant["platforms"].end_array(); ++it)
+    addon->m_platforms.push_back(it->asString());
+
+  for (auto it = variant["art"].begin_map(); it != variant["art"].end_map(); ++it)
+    addon->m_art.try_emplace(it->first, it->second.asString());
+
+  for (auto it = variant["screenshots"].begin_array(); it != variant["screenshots"].end_array();
+       ++it)
+    addon->m_screenshots.push_back(it->asString());
+
+  for (auto it = variant["extrainfo"].begin_map(); it != variant["extrainfo"].end_map(); ++it)
+    addon->m_extrainfo.try_emplace(it->first, it->second.asString());
+
+  for (auto it = variant["dependencies"].begin_array(); it != variant["dependencies"].end_array();
+       ++it)
+  {
+    addon->m_dependencies.emplace_back(
+        (*it)["addonId"].asString(), CAddonVersion((*it)["minversion"].asString()),
+        CAddonVersion((*it)["version"].asString()), (*it)["optional"].asBoolean());
+  }
+
+  for (auto it = variant["types"].begin_array(); it != variant["types"].end_array(); ++it)
+  {
+    CAddonType type(static_cast<AddonType>((*it)["addontype"].asUnsignedInteger()));
+    DeserializeExtensions(*it, type);
+    type.m_path = (*it)["path"].asString();
+    type.m_libname = (*it)["libname"].asString();
+    for (auto content = (*it)["provides"].begin_array(); content != (*it)["provides"].end_array();
+         ++content)
+      type.m_providedSubContent.insert(static_cast<AddonType>(content->asUnsignedInteger()));
+    addon->m_types.push_back(std::move(type));
+  }
+
+  return addon;
+}
+
+CVariant CAddonInfoCache::SerializeExtensions(const CAddonExtensions& extensions)
+{
+  CVariant variant(CVariant::VariantTypeObject);
+  variant["point"] = extensions.m_point;
+
+  variant["values"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& [id, values] : extensions.m_values)
+  {
+    CVariant info(CVariant::VariantTypeObject);
+    info["id"] = id;
+    info["content"] = CVariant(CVariant::VariantTypeArray);
+    for (const auto& [key, value] : values)
+    {
+      CVariant content(CVariant::VariantTypeObject);
+      content["key"] = key;
+      content["value"] = value.str;
+      info["content"].push_back(std::move(content));
+    }
+    variant["values"].push_back(std::move(info));
+  }
+
+  variant["children"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& [id, child] : extensions.m_children)
+  {
+    CVariant info(CVariant::VariantTypeObject);
+    info["id"] = id;
+    info["child"] = SerializeExtensions(child);
+    variant["children"].push_back(std::move(info));
+  }
+
+  return variant;
+}
+
+void CAddonInfoCache::DeserializeExtensions(const CVariant& variant, CAddonExtensions& extensions)
+{
+  extensions.m_point = variant["point"].asString();
+
+  for (auto value = variant["values"].begin_array(); value != variant["values"].end_array();
+       ++value)
+  {
+    EXT_VALUE values;
+    for (auto content = (*value)["content"].begin_array();
+         content != (*value)["content"].end_array(); ++content)
+      values.emplace_back((*content)["key"].asString(), SExtValue((*content)["value"].asString()));
+    extensions.m_values.emplace_back((*value)["id"].asString(), CExtValues(values));
+  }
+
+  for (auto child = variant["children"].begin_array(); child != variant["children"].end_array();
+       ++child)
+  {
+    CAddonExtensions childExtensions;
+    DeserializeExtensions((*child)["child"], childExtensions);
+    extensions.m_children.emplace_back((*child)["id"].asString(), std::move(childExtensions));
+  }
+}
+
+} // namespace ADDON
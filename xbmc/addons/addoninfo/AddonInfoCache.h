@@ -0,0 +1,87 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+class CVariant;
+
+namespace ADDON
+{
+class CAddonExtensions;
+class CAddonInfo;
+using AddonInfoPtr = std::shared_ptr<CAddonInfo>;
+
+/*!
+ * \brief Parsed add-on infos of the installed add-ons, kept in a file between runs.
+ *
+ * An add-on is parsed again only when its addon.xml, its folder or its resources folder
+ * changed since the info was cached, the others are taken from the file. The file is thrown
+ * away when it was written by another build, the platform checks and library names depend on it.
+ */
+class CAddonInfoCache
+{
+public:
+  explicit CAddonInfoCache(std::string file);
+
+  /*!
+   * \brief Get the info of the add-on in the given folder.
+   * \param addonPath path of the add-on folder
+   * \return the cached info if the add-on didn't change, otherwise the newly parsed one,
+   *         nullptr if it can't be parsed
+   */
+  AddonInfoPtr Get(const std::string& addonPath);
+
+  /*!
+   * \brief Write the infos taken since the last call, when any of them changed.
+   *
+   * Add-ons that weren't asked for since the last call were removed and are dropped.
+   */
+  void Save();
+
+private:
+  struct Stamp
+  {
+    int64_t xmlTime{0};
+    int64_t xmlSize{0};
+    int64_t dirTime{0};
+    int64_t resourcesTime{0};
+
+    bool operator==(const Stamp& rhs) const = default;
+  };
+
+  struct Entry
+  {
+    Stamp stamp;
+    AddonInfoPtr info;
+    bool used{false};
+  };
+
+  static bool GetStamp(const std::string& addonRealPath, Stamp& stamp);
+
+  void Load();
+
+  static CVariant Serialize(const CAddonInfo& addon);
+  static AddonInfoPtr Deserialize(const CVariant& variant);
+  static CVariant SerializeExtensions(const CAddonExtensions& extensions);
+  static void DeserializeExtensions(const CVariant& variant, CAddonExtensions& extensions);
+
+  CCriticalSection m_critSection;
+  const std::string m_file;
+  std::map<std::string, Entry, std::less<>> m_entries;
+  bool m_loaded{false};
+  bool m_changed{false};
+};
+
+} // namespace ADDON
@@ -72,6 +72,7 @@ enum class AddonType
 };
 
 class CAddonInfoBuilder;
+class CAddonInfoCache;
 class CAddonDatabaseSerializer;
 
 class CAddonType : public CAddonExtensions
@@ -112,6 +113,7 @@ public:
 private:
   friend class CAddonInfoBuilder;
   friend class CAddonInfoBuilderFromDB;
+  friend class CAddonInfoCache;
   friend class CAddonDatabaseSerializer;
 
   void SetProvides(const std::string& content);
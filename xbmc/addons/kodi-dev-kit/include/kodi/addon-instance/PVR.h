@@ -1462,6 +1462,39 @@ public:
   }
   //----------------------------------------------------------------------------
 
+  //============================================================================
+  /// @brief Request the EPG events of a channel that changed since the last
+  /// update from the backend.
+  ///
+  /// Kodi asks for the changes of a time range it already got with
+  /// @ref GetEPGForChannel(), so a periodic update doesn't need to transfer
+  /// the whole range again. Events that were deleted since the given time
+  /// are reported with @ref EpgEventStateChange() and @ref EPG_EVENT_DELETED.
+  ///
+  /// @param[in] channelUid The UID of the channel to get the EPG changes for.
+  /// @param[in] start Get events after this time (UTC).
+  /// @param[in] end Get events before this time (UTC).
+  /// @param[in] changedSince Get events created or changed after this time (UTC).
+  /// @param[out] results List where the new and changed EPG events become
+  ///                     transferred with @ref cpp_kodi_addon_pvr_Defs_epg_PVREPGTag
+  ///                     and given to Kodi
+  /// @return @ref PVR_ERROR_NO_ERROR if the changes have been fetched successfully,
+  ///         @ref PVR_ERROR_NOT_IMPLEMENTED to let Kodi fetch the whole range with
+  ///         @ref GetEPGForChannel().
+  ///
+  /// @remarks Optional. Only called if @ref PVRCapabilities::SetSupportsEPGChanges
+  /// "supportsEPGChanges" is set to true.
+  ///
+  virtual PVR_ERROR GetEPGChangesForChannel(int channelUid,
+                                            time_t start,
+                                            time_t end,
+                                            time_t changedSince,
+                                            kodi::addon::PVREPGTagsResultSet& results)
+  {
+    return PVR_ERROR_NOT_IMPLEMENTED;
+  }
+  //----------------------------------------------------------------------------
+
   //============================================================================
   /// @brief Check if the given EPG tag can be recorded.
   ///
@@ -2928,6 +2961,8 @@ private:
     instance->pvr->toAddon->FreeSignalStatus = ADDON_FreeSignalStatus;
     instance->pvr->toAddon->FreeEdlEntries = ADDON_FreeEdlEntries;
     instance->pvr->toAddon->FreeString = ADDON_FreeString;
+    //--==----==----==----==----==----==----==----==----==----==----==----==----==
+    instance->pvr->toAddon->GetEPGChangesForChannel = ADDON_GetEPGChangesForChannel;
 
     m_instanceData = instance->pvr;
     m_instanceData->toAddon->addonInstance = this;
@@ -3168,6 +3203,18 @@ private:
         ->GetEPGForChannel(channelUid, start, end, result);
   }
 
+  inline static PVR_ERROR ADDON_GetEPGChangesForChannel(const AddonInstance_PVR* instance,
+                                                        PVR_HANDLE handle,
+                                                        int channelUid,
+                                                        time_t start,
+                                                        time_t end,
+                                                        time_t changedSince)
+  {
+    PVREPGTagsResultSet result(instance, handle);
+    return static_cast<CInstancePVRClient*>(instance->toAddon->addonInstance)
+        ->GetEPGChangesForChannel(channelUid, start, end, changedSince, result);
+  }
+
   inline static PVR_ERROR ADDON_IsEPGTagRecordable(const AddonInstance_PVR* instance,
                                                    const EPG_TAG* tag,
                                                    bool* isRecordable)
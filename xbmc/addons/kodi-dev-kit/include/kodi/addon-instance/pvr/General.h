@@ -1113,6 +1113,8 @@ public:
   /// | **Supports recording size** | `boolean` | @ref PVRCapabilities::SetSupportsRecordingSize "SetSupportsRecordingSize" | @ref PVRCapabilities::GetSupportsRecordingSize "GetSupportsRecordingSize"
   /// | **Supports recordings delete** | `boolean` | @ref PVRCapabilities::SetSupportsRecordingsDelete "SetSupportsRecordingsDelete" | @ref PVRCapabilities::GetSupportsRecordingsDelete "SetSupportsRecordingsDelete"
   /// | **Supports multiple recorded streams** | `boolean` | @ref PVRCapabilities::SetSupportsMultipleRecordedStreams "SetSupportsMultipleRecordedStreams" | @ref PVRCapabilities::GetSupportsMultipleRecordedStreams "GetSupportsMultipleRecordedStreams"
+  /// | **Supports EPG changes** | `boolean` | @ref PVRCapabilities::SetSupportsEPGChanges "SetSupportsEPGChanges" | @ref PVRCapabilities::GetSupportsEPGChanges "GetSupportsEPGChanges"
+  /// | **Max parallel EPG requests** | `unsigned int` | @ref PVRCapabilities::SetMaxParallelEPGRequests "SetMaxParallelEPGRequests" | @ref PVRCapabilities::GetMaxParallelEPGRequests "GetMaxParallelEPGRequests"
   /// | **Recordings lifetime values** | @ref cpp_kodi_addon_pvr_Defs_PVRTypeIntValue "PVRTypeIntValue" | @ref PVRCapabilities::SetRecordingsLifetimeValues "SetRecordingsLifetimeValues" | @ref PVRCapabilities::GetRecordingsLifetimeValues "GetRecordingsLifetimeValues"
   ///
   /// @warning This class can not be used outside of @ref kodi::addon::CInstancePVRClient::GetCapabilities()
@@ -1351,6 +1353,32 @@ public:
     return m_cStructure->bSupportsMultipleRecordedStreams;
   }
 
+  /// @brief Set **true** if this add-on can transfer only the EPG events changed
+  /// since a given time, using
+  /// @ref kodi::addon::CInstancePVRClient::GetEPGChangesForChannel().
+  void SetSupportsEPGChanges(bool supportsEPGChanges)
+  {
+    m_cStructure->bSupportsEPGChanges = supportsEPGChanges;
+  }
+
+  /// @brief To get with @ref SetSupportsEPGChanges changed values.
+  bool GetSupportsEPGChanges() const { return m_cStructure->bSupportsEPGChanges; }
+
+  /// @brief Set the number of channels Kodi may request the EPG for at the same
+  /// time, using @ref kodi::addon::CInstancePVRClient::GetEPGForChannel().
+  ///
+  /// Leave it at 0 or 1 if the backend can't serve concurrent requests.
+  void SetMaxParallelEPGRequests(unsigned int maxParallelEPGRequests)
+  {
+    m_cStructure->iMaxParallelEPGRequests = maxParallelEPGRequests;
+  }
+
+  /// @brief To get with @ref SetMaxParallelEPGRequests changed values.
+  unsigned int GetMaxParallelEPGRequests() const
+  {
+    return m_cStructure->iMaxParallelEPGRequests;
+  }
+
   /// @brief **optional**\n
   /// Set array containing the possible values for @ref PVRRecording::SetLifetime().
   ///
@@ -356,6 +356,8 @@ extern "C"
     //--==----==----==----==----==----==----==----==----==----==----==----==----==
     // New functions becomes added below and can be on another API change (where
     // breaks min API version) moved up.
+    enum PVR_ERROR(__cdecl* GetEPGChangesForChannel)(
+        const struct AddonInstance_PVR*, PVR_HANDLE, int, time_t, time_t, time_t);
   } KodiToAddonFuncTable_PVR;
 
   typedef struct AddonInstance_PVR
@@ -374,6 +374,11 @@ extern "C"
 
     unsigned int iRecordingsLifetimesSize;
     struct PVR_ATTRIBUTE_INT_VALUE* recordingsLifetimeValues;
+
+    // New values becomes added below and can be on another API change (where
+    // breaks min API version) moved up.
+    bool bSupportsEPGChanges;
+    unsigned int iMaxParallelEPGRequests;
   } PVR_ADDON_CAPABILITIES;
 
   /*!
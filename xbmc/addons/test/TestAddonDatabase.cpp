@@ -78,3 +78,35 @@ TEST_F(AddonDatabaseTest, TestFindByNonExistingId)
   EXPECT_TRUE(database.FindByAddonId("does.not.exist", addons));
   EXPECT_EQ(0U, addons.size());
 }
+
+TEST_F(AddonDatabaseTest, TestUpdateRepositoryContent)
+{
+  std::vector<AddonInfoPtr> addons;
+  CreateAddon(addons, "foo.bar", "1.0.0");
+  CreateAddon(addons, "foo.qux", "2.0.0");
+  EXPECT_TRUE(
+      database.UpdateRepositoryContent("repository.a", CAddonVersion("1.0.0"), "test2", addons));
+
+  VECADDONS found;
+  EXPECT_TRUE(database.GetRepositoryContent("repository.a", found));
+  EXPECT_EQ(2U, found.size());
+
+  addons.clear();
+  CreateAddon(addons, "foo.qux", "2.1.0");
+  EXPECT_TRUE(
+      database.UpdateRepositoryContent("repository.a", CAddonVersion("1.0.0"), "test3", addons));
+
+  found.clear();
+  EXPECT_TRUE(database.GetRepositoryContent("repository.a", found));
+  ASSERT_EQ(1U, found.size());
+  EXPECT_EQ("foo.qux", found.at(0)->ID());
+  EXPECT_EQ("2.1.0", found.at(0)->Version().asString());
+
+  found.clear();
+  EXPECT_TRUE(database.FindByAddonId("foo.baz", found));
+  EXPECT_EQ(1U, found.size());
+
+  std::string checksum;
+  database.GetRepoChecksum("repository.a", checksum);
+  EXPECT_EQ("test3", checksum);
+}
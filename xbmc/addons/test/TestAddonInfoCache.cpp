@@ -0,0 +1,129 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "addons/addoninfo/AddonInfo.h"
+#include "addons/addoninfo/AddonInfoCache.h"
+#include "addons/addoninfo/AddonType.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace ADDON;
+
+namespace
+{
+std::string GetAddonXML(const std::string& version)
+{
+  return R"xml(<?xml version="1.0" encoding="UTF-8"?>
+<addon id="script.cache.test" name="Cache Test" version=")xml" +
+         version + R"xml(" provider-name="Team Kodi">
+  <requires>
+    <import addon="xbmc.python" version="3.0.0"/>
+    <import addon="script.module.foo" minversion="1.0.0" version="1.2.0" optional="true"/>
+  </requires>
+  <extension point="xbmc.python.script" library="default.py">
+    <provides>video audio</provides>
+  </extension>
+  <extension point="kodi.addon.metadata">
+    <summary lang="en_GB">Summary</summary>
+    <summary lang="de_DE">Zusammenfassung</summary>
+    <description lang="en_GB">Description</description>
+    <platform>all</platform>
+    <license>GPL-2.0-or-later</license>
+  </extension>
+</addon>
+)xml";
+}
+
+class TestAddonInfoCache : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_dir = std::filesystem::temp_directory_path() / "kodi-addoninfocache";
+    std::filesystem::remove_all(m_dir);
+    std::filesystem::create_directories(m_dir / "script.cache.test");
+    WriteAddonXML("1.0.0");
+  }
+
+  void TearDown() override { std::filesystem::remove_all(m_dir); }
+
+  void WriteAddonXML(const std::string& version)
+  {
+    std::ofstream(m_dir / "script.cache.test" / "addon.xml") << GetAddonXML(version);
+  }
+
+  std::string AddonPath() const { return (m_dir / "script.cache.test").string() + "/"; }
+  std::string CacheFile() const { return (m_dir / "addoninfo.json").string(); }
+
+  std::filesystem::path m_dir;
+};
+} // unnamed namespace
+
+TEST_F(TestAddonInfoCache, KeepsInfoBetweenRuns)
+{
+  AddonInfoPtr parsed;
+  {
+    CAddonInfoCache cache(CacheFile());
+    parsed = cache.Get(AddonPath());
+    ASSERT_NE(nullptr, parsed);
+    cache.Save();
+  }
+  ASSERT_TRUE(std::filesystem::exists(CacheFile()));
+
+  CAddonInfoCache cache(CacheFile());
+  const AddonInfoPtr cached = cache.Get(AddonPath());
+  ASSERT_NE(nullptr, cached);
+  EXPECT_NE(parsed, cached);
+
+  EXPECT_EQ(parsed->ID(), cached->ID());
+  EXPECT_EQ(parsed->Name(), cached->Name());
+  EXPECT_EQ(parsed->Version(), cached->Version());
+  EXPECT_EQ(parsed->Path(), cached->Path());
+  EXPECT_EQ(parsed->Summary(), cached->Summary());
+  EXPECT_EQ(parsed->Description(), cached->Description());
+  EXPECT_EQ(parsed->License(), cached->License());
+  EXPECT_EQ(parsed->LibName(), cached->LibName());
+  EXPECT_EQ(parsed->MainType(), cached->MainType());
+  EXPECT_EQ(parsed->GetDependencies(), cached->GetDependencies());
+  EXPECT_EQ(parsed->ExtraInfo(), cached->ExtraInfo());
+  ASSERT_EQ(parsed->Types().size(), cached->Types().size());
+  EXPECT_TRUE(cached->ProvidesSubContent(AddonType::VIDEO, AddonType::SCRIPT));
+  EXPECT_TRUE(cached->ProvidesSeveralSubContents());
+  EXPECT_EQ(parsed->Type(AddonType::SCRIPT)->GetValue("provides").asString(),
+            cached->Type(AddonType::SCRIPT)->GetValue("provides").asString());
+}
+
+TEST_F(TestAddonInfoCache, ParsesChangedAddon)
+{
+  {
+    CAddonInfoCache cache(CacheFile());
+    ASSERT_NE(nullptr, cache.Get(AddonPath()));
+    cache.Save();
+  }
+
+  WriteAddonXML("1.0.10");
+
+  CAddonInfoCache cache(CacheFile());
+  const AddonInfoPtr info = cache.Get(AddonPath());
+  ASSERT_NE(nullptr, info);
+  EXPECT_EQ("1.0.10", info->Version().asString());
+}
+
+TEST_F(TestAddonInfoCache, DropsRemovedAddon)
+{
+  CAddonInfoCache cache(CacheFile());
+  ASSERT_NE(nullptr, cache.Get(AddonPath()));
+  cache.Save();
+
+  std::filesystem::remove_all(m_dir / "script.cache.test");
+  EXPECT_EQ(nullptr, cache.Get(AddonPath()));
+}
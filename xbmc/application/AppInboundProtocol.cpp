@@ -35,6 +35,20 @@ bool CAppInboundProtocol::OnEvent(const XBMC_Event& newEvent)
   if (m_closed)
     return false;
   m_portEvents.push_back(newEvent);
+
+  switch (newEvent.type)
+  {
+    case XBMC_KEYDOWN:
+    case XBMC_MOUSEBUTTONDOWN:
+    case XBMC_MOUSEMOTION:
+    case XBMC_TOUCH:
+    case XBMC_BUTTON:
+      if (m_inputTime == std::chrono::steady_clock::time_point{})
+        m_inputTime = std::chrono::steady_clock::now();
+      break;
+    default:
+      break;
+  }
   return true;
 }
 
@@ -54,6 +68,12 @@ void CAppInboundProtocol::SetRenderGUI(bool renderGUI)
 void CAppInboundProtocol::HandleEvents()
 {
   std::unique_lock lock(m_portSection);
+  if (m_inputTime != std::chrono::steady_clock::time_point{})
+  {
+    CServiceBroker::GetInputManager().OnInputReceived(m_inputTime);
+    m_inputTime = {};
+  }
+
   while (!m_portEvents.empty())
   {
     auto newEvent = m_portEvents.front();
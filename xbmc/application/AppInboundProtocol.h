@@ -11,6 +11,7 @@
 #include "threads/CriticalSection.h"
 #include "windowing/XBMC_events.h"
 
+#include <chrono>
 #include <deque>
 
 class CApplication;
@@ -31,5 +32,6 @@ protected:
   bool m_closed = false;
   CApplication &m_pApp;
   std::deque<XBMC_Event> m_portEvents;
+  std::chrono::steady_clock::time_point m_inputTime; // arrival of the oldest queued input event
   CCriticalSection m_portSection;
 };
@@ -41,6 +41,12 @@ Arguments:
   --debug               Enable debug logging
   --version             Print version information
   --test                Enable test mode. [FILE] required.
+  --benchmark[=<decoder>]
+                        Decode the video of [FILE] as fast as possible, print the
+                        frame rate, CPU time and memory used and quit. The decoder
+                        is one of auto, software, vaapi, vdpau, drmprime or mediacodec,
+                        hardware decoders also have to be enabled in the settings.
+  --trace-startup       Write a timeline of the startup to startup-trace.json in the log folder
   --settings=<filename> Loads specified file after advancedsettings.xml replacing any settings specified
                         specified file must exist in special://xbmc/system/
 )""";
@@ -67,7 +73,10 @@ void CAppParamParser::Parse(const char* const* argv, int nArgs)
   {
     // testmode is only valid if at least one item to play was given
     if (m_params->GetPlaylist().IsEmpty())
+    {
       m_params->SetTestMode(false);
+      m_params->SetBenchmark(false);
+    }
   }
 
   // Record raw parameters
@@ -108,6 +117,15 @@ void CAppParamParser::ParseArg(const std::string &arg)
     m_params->SetLogLevel(LOG_LEVEL_DEBUG);
   else if (arg == "--test")
     m_params->SetTestMode(true);
+  else if (arg == "--benchmark")
+    m_params->SetBenchmark(true);
+  else if (arg.substr(0, 12) == "--benchmark=")
+  {
+    m_params->SetBenchmark(true);
+    m_params->SetBenchmarkDecoder(arg.substr(12));
+  }
+  else if (arg == "--trace-startup")
+    m_params->SetTraceStartup(true);
   else if (arg.substr(0, 11) == "--settings=")
     m_params->SetSettingsFile(arg.substr(11));
   else if (!arg.empty() && arg[0] != '-')
@@ -45,6 +45,18 @@ public:
   bool IsTestMode() const { return m_testmode; }
   void SetTestMode(bool testMode) { m_testmode = testMode; }
 
+  bool IsBenchmark() const { return m_benchmark; }
+  void SetBenchmark(bool benchmark) { m_benchmark = benchmark; }
+
+  /*!
+   * \brief The video decoder the benchmark has to use, empty to let the player choose
+   */
+  const std::string& GetBenchmarkDecoder() const { return m_benchmarkDecoder; }
+  void SetBenchmarkDecoder(const std::string& decoder) { m_benchmarkDecoder = decoder; }
+
+  bool IsTraceStartup() const { return m_traceStartup; }
+  void SetTraceStartup(bool traceStartup) { m_traceStartup = traceStartup; }
+
   const std::string& GetSettingsFile() const { return m_settingsFile; }
   void SetSettingsFile(const std::string& settingsFile) { m_settingsFile = settingsFile; }
 
@@ -87,7 +99,10 @@ private:
   bool m_startFullScreen{false};
   bool m_standAlone{false};
   bool m_testmode{false};
+  bool m_benchmark{false};
+  bool m_traceStartup{false};
 
+  std::string m_benchmarkDecoder;
   std::string m_settingsFile;
   std::string m_windowing;
   std::string m_logTarget;
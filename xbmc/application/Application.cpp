@@ -19,6 +19,7 @@
 #include "GUIUserMessages.h"
 #include "HDRStatus.h"
 #include "LangInfo.h"
+#include "LibraryWatcher.h"
 #include "PartyModeManager.h"
 #include "PlayListPlayer.h"
 #include "SectionLoader.h"
@@ -49,6 +50,7 @@
 #include "application/ApplicationVolumeHandling.h"
 #include "cores/AudioEngine/Engines/ActiveAE/ActiveAE.h"
 #include "cores/FFmpeg.h"
+#include "cores/VideoPlayer/VideoDecodeBenchmark.h"
 #include "cores/playercorefactory/PlayerCoreFactory.h"
 #include "dialogs/GUIDialogBusy.h"
 #include "dialogs/GUIDialogCache.h"
@@ -137,10 +139,12 @@
 #include "utils/ContentUtils.h"
 #include "utils/FileExtensionProvider.h"
 #include "utils/LangCodeExpander.h"
+#include "utils/MemoryPressure.h"
 #include "utils/PlayerUtils.h"
 #include "utils/RegExp.h"
 #include "utils/Screenshot.h"
 #include "utils/StringUtils.h"
+#include "utils/StartupTrace.h"
 #include "utils/SystemInfo.h"
 #include "utils/TimeUtils.h"
 #include "utils/URIUtils.h"
@@ -178,6 +182,7 @@
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include <tinyxml.h>
 
@@ -253,6 +258,10 @@ extern "C" void __stdcall cleanup_emu_environ();
 
 bool CApplication::Create()
 {
+  if (CServiceBroker::GetAppParams()->IsTraceStartup())
+    CStartupTrace::Enable();
+  CStartupTrace::CScope trace("CApplication::Create");
+
   m_bStop = false;
 
   RegisterSettings();
@@ -275,6 +284,21 @@ bool CApplication::Create()
 
   CServiceBroker::RegisterDNSNameCache(std::make_shared<CDNSNameCache>());
 
+  const auto memoryPressure = std::make_shared<CMemoryPressureManager>();
+  // listings are the most expensive to get back, network shares have to be read again
+  memoryPressure->RegisterCache(
+      "directories", 30,
+      [] { return CMemoryPressureManager::Usage{0, g_directoryCache.GetItemCount()}; },
+      [](MemoryPressure pressure)
+      {
+        if (pressure == MemoryPressure::CRITICAL)
+          g_directoryCache.Clear();
+        else
+          g_directoryCache.Trim();
+      });
+  memoryPressure->Start();
+  CServiceBroker::RegisterMemoryPressureManager(memoryPressure);
+
   m_ServiceManager = std::make_unique<CServiceManager>();
 
   if (!m_ServiceManager->InitStageOne())
@@ -399,6 +423,8 @@ bool CApplication::Create()
 
 bool CApplication::CreateGUI()
 {
+  CStartupTrace::CScope trace("CApplication::CreateGUI");
+
   m_frameMoveGuard.lock();
 
   const auto appPower = GetComponent<CApplicationPowerHandling>();
@@ -544,6 +570,8 @@ bool CApplication::InitWindow(RESOLUTION res)
 
 bool CApplication::Initialize()
 {
+  CStartupTrace::CScope trace("CApplication::Initialize");
+
   m_pActiveAE->Start();
   // restore AE's previous volume state
 
@@ -854,6 +882,21 @@ void CApplication::Render()
   const bool guiWillRender = appPower->GetRenderGUI() && !m_skipGuiRender;
   bool compositing = CServiceBroker::GetWinSystem()->BeginGuiComposite(guiWillRender);
 
+  // render the gui below the output resolution, unless video or addons draw through it
+  bool guiScaled = false;
+  CGUIWindowManager& windowManager = CServiceBroker::GetGUI()->GetWindowManager();
+  if (guiWillRender && !compositing &&
+      CServiceBroker::GetWinSystem()->GetGfxContext().GetStereoMode() == RenderStereoMode::OFF &&
+      (!appPlayer->IsRenderingVideo() || appPlayer->IsRenderingVideoLayer()) &&
+      !windowManager.IsWindowActive(WINDOW_VISUALISATION) &&
+      !windowManager.IsWindowActive(WINDOW_SCREENSAVER))
+  {
+    bool newTarget = false;
+    guiScaled = CServiceBroker::GetRenderSystem()->BeginGUIRenderScale(newTarget);
+    if (guiScaled && newTarget)
+      windowManager.MarkDirty();
+  }
+
   if (guiWillRender)
   {
     if (CServiceBroker::GetWinSystem()->GetGfxContext().GetStereoMode() != RenderStereoMode::OFF)
@@ -872,6 +915,9 @@ void CApplication::Render()
     {
       hasRendered |= CServiceBroker::GetGUI()->GetWindowManager().Render();
     }
+    if (guiScaled)
+      CServiceBroker::GetRenderSystem()->EndGUIRenderScale(hasRendered);
+
     // execute post rendering actions (finalize window closing)
     CServiceBroker::GetGUI()->GetWindowManager().AfterRender();
 
@@ -893,7 +939,7 @@ void CApplication::Render()
   // fresh for the next process(), or after a windowclose animation (where process()
   // isn't called)
   CGUIInfoManager& infoMgr = CServiceBroker::GetGUI()->GetInfoManager();
-  infoMgr.ResetCache();
+  infoMgr.ResetFrameCache();
   infoMgr.GetInfoProviders().GetGUIControlsInfoProvider().ResetContainerMovingCache();
 
   if (hasRendered)
@@ -901,9 +947,14 @@ void CApplication::Render()
     infoMgr.GetInfoProviders().GetSystemInfoProvider().UpdateFPS();
   }
 
+  CServiceBroker::GetGUI()->GetWindowManager().GetFrameBudget().EndFrame();
+
   CServiceBroker::GetWinSystem()->GetGfxContext().Flip(hasRendered,
                                                        appPlayer->IsRenderingVideoLayer());
 
+  if (hasRendered)
+    CServiceBroker::GetInputManager().OnFramePresented();
+
   CTimeUtils::UpdateFrameTime(hasRendered);
 
   // [debug hack] count gui-on-screen frames vs total played and skipped
@@ -1505,6 +1556,10 @@ void CApplication::FrameMove(bool processEvents, bool processGUI)
 {
   const auto appPlayer = GetComponent<CApplicationPlayer>();
   bool renderGUI = GetComponent<CApplicationPowerHandling>()->GetRenderGUI();
+
+  // deferrable gui work is skipped once the processing share of the frame is spent
+  CServiceBroker::GetGUI()->GetWindowManager().GetFrameBudget().BeginFrame(
+      CServiceBroker::GetWinSystem()->GetGfxContext().GetFPS());
   if (processEvents)
   {
     // currently we calculate the repeat time (ie time from last similar keypress) just global as fps
@@ -1528,6 +1583,9 @@ void CApplication::FrameMove(bool processEvents, bool processGUI)
       }
     }
 
+    // pump the window system now, the input that arrived during the last render is then
+    // handled before this frame's gui processing instead of the next one's
+    CServiceBroker::GetWinSystem()->MessagePump();
     m_pMsgHandling->HandleEvents();
     CServiceBroker::GetInputManager().Process(CServiceBroker::GetGUI()->GetWindowManager().GetActiveWindowOrDialog(), frameTime);
 
@@ -1580,7 +1638,8 @@ void CApplication::FrameMove(bool processEvents, bool processGUI)
     if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiSmartRedraw && m_guiRefreshTimer.IsTimePast())
     {
       CServiceBroker::GetGUI()->GetWindowManager().SendMessage(GUI_MSG_REFRESH_TIMER, 0, 0);
-      m_guiRefreshTimer.Set(500ms);
+      // coalesced while idle, there's nothing to react to quickly
+      m_guiRefreshTimer.Set(GetComponent<CApplicationPowerHandling>()->IsIdle() ? 5s : 500ms);
     }
 
     if (!m_bStop)
@@ -1612,13 +1671,27 @@ void CApplication::ResetCurrentItem()
 int CApplication::Run()
 {
   CLog::Log(LOGINFO, "Running the application...");
+  CStartupTrace::Finish("special://logpath/startup-trace.json");
 
   std::chrono::time_point<std::chrono::steady_clock> lastFrameTime;
   std::chrono::milliseconds frameTime;
   const unsigned int noRenderFrameTime = 15; // Simulates ~66fps
 
   CFileItemList& playlist = CServiceBroker::GetAppParams()->GetPlaylist();
-  if (playlist.Size() > 0)
+  if (CServiceBroker::GetAppParams()->IsBenchmark())
+  {
+    // decode outside of the render loop and quit, the player isn't involved
+    std::vector<std::shared_ptr<CFileItem>> items(playlist.begin(), playlist.end());
+    CServiceBroker::GetJobManager()->Submit(
+        [items = std::move(items),
+         decoder = CServiceBroker::GetAppParams()->GetBenchmarkDecoder()]()
+        {
+          for (const auto& item : items)
+            CVideoDecodeBenchmark::RunAndReport(*item, decoder);
+          CServiceBroker::GetAppMessenger()->PostMsg(TMSG_QUIT);
+        });
+  }
+  else if (playlist.Size() > 0)
   {
     CServiceBroker::GetPlaylistPlayer().Add(PLAYLIST::Id::TYPE_MUSIC, playlist);
     CServiceBroker::GetPlaylistPlayer().SetCurrentPlaylist(PLAYLIST::Id::TYPE_MUSIC);
@@ -1642,6 +1715,18 @@ int CApplication::Run()
     if (renderGUI && !m_bStop)
     {
       Render();
+
+      // cap the frame rate while idle, without holding off other threads meanwhile
+      const auto idleFrameTime = GetComponent<CApplicationPowerHandling>()->GetIdleFrameTime();
+      frameTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - lastFrameTime);
+      if (frameTime < idleFrameTime)
+      {
+        CSingleExit ex(CServiceBroker::GetWinSystem()->GetGfxContext());
+        m_frameMoveGuard.unlock();
+        KODI::TIME::Sleep(idleFrameTime - frameTime);
+        m_frameMoveGuard.lock();
+      }
     }
     else if (!renderGUI)
     {
@@ -1754,6 +1839,10 @@ bool CApplication::Cleanup()
 
     CServiceBroker::UnregisterDNSNameCache();
 
+    if (const auto memoryPressure = CServiceBroker::GetMemoryPressureManager())
+      memoryPressure->Stop();
+    CServiceBroker::UnregisterMemoryPressureManager();
+
     CServiceBroker::UnregisterKeyboardLayoutManager();
 
     CServiceBroker::UnregisterAppMessenger();
@@ -1859,6 +1948,9 @@ bool CApplication::Stop(int exitCode)
     CServiceBroker::GetJobManager()->CancelJobs();
 
     // stop scanning before we kill the network and so on
+    if (m_libraryWatcher)
+      m_libraryWatcher->Stop();
+
     if (CMusicLibraryQueue::GetInstance().IsRunning())
       CMusicLibraryQueue::GetInstance().CancelAllJobs();
 
@@ -2406,6 +2498,7 @@ void CApplication::ProcessSlow()
   // Check if we need to activate the screensaver / DPMS.
   const auto appPower = GetComponent<CApplicationPowerHandling>();
   appPower->CheckScreenSaverAndDPMS();
+  appPower->CheckIdle();
 
   // Check if we need to shutdown (if enabled).
 #if defined(TARGET_DARWIN)
@@ -2446,6 +2539,9 @@ void CApplication::ProcessSlow()
 
   CServiceBroker::GetGUI()->GetTextureManager().FreeUnusedTextures(5000);
 
+  if (const auto memoryPressure = CServiceBroker::GetMemoryPressureManager())
+    memoryPressure->Process();
+
 #ifdef HAS_OPTICAL_DRIVE
   // checks whats in the DVD drive and tries to autostart the content (xbox games, dvd, cdda, avi files...)
   if (!appPlayer->IsPlayingVideo())
@@ -2735,6 +2831,11 @@ void CApplication::UpdateLibraries()
         "", MUSIC_INFO::CMusicInfoScanner::SCAN_NORMAL,
         !settings->GetBool(CSettings::SETTING_MUSICLIBRARY_BACKGROUNDUPDATE));
   }
+
+  // the sources may have changed with the profile
+  if (!m_libraryWatcher)
+    m_libraryWatcher = std::make_unique<CLibraryWatcher>();
+  m_libraryWatcher->Start();
 }
 
 void CApplication::UpdateCurrentPlayArt()
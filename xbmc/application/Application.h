@@ -35,6 +35,7 @@ class CFileItemList;
 class CGUIComponent;
 class CInertialScrollingHandler;
 class CKey;
+class CLibraryWatcher;
 class CSeekHandler;
 class CServiceManager;
 class CSettingsComponent;
@@ -227,6 +228,7 @@ protected:
   bool m_skipGuiRender = false;
 
   std::unique_ptr<MUSIC_INFO::CMusicInfoScanner> m_musicInfoScanner;
+  std::unique_ptr<CLibraryWatcher> m_libraryWatcher;
 
   std::unique_ptr<CInertialScrollingHandler> m_pInertialScrollingHandler;
 
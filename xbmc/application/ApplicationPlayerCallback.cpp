@@ -40,6 +40,7 @@
 #include "video/VideoDatabase.h"
 #include "video/VideoFileItemClassify.h"
 #include "video/VideoInfoTag.h"
+#include "video/VideoSeekPreview.h"
 
 #include <chrono>
 #include <memory>
@@ -112,6 +113,14 @@ void CApplicationPlayerCallback::OnPlayBackStarted(const CFileItem& file)
 
   stackHelper->OnPlayBackStarted();
 
+  // make the seek previews in the background, strips that are cached already are skipped
+  if (!stackHelper->IsPlayingStack() && VIDEO::CVideoSeekPreview::IsEnabled(*itemCurrentFile))
+  {
+    const auto appPlayer = components.GetComponent<CApplicationPlayer>();
+    VIDEO::CVideoSeekPreview::CacheStrips(*itemCurrentFile,
+                                          std::chrono::milliseconds(appPlayer->GetTotalTime()));
+  }
+
   CGUIMessage msg(GUI_MSG_PLAYBACK_STARTED, 0, 0, 0, 0, itemCurrentFile);
   CServiceBroker::GetGUI()->GetWindowManager().SendThreadMessage(msg);
 }
@@ -31,6 +31,7 @@
 #include "pvr/PVRManager.h"
 #include "pvr/guilib/PVRGUIActionsChannels.h"
 #include "pvr/guilib/PVRGUIActionsPowerManagement.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/AlarmClock.h"
@@ -40,6 +41,9 @@
 
 void CApplicationPowerHandling::ResetScreenSaver()
 {
+  // leave the idle mode right away, not on the next check
+  m_idle = false;
+
   // reset our timers
   m_shutdownTimer.StartZero();
 
@@ -360,6 +364,39 @@ void CApplicationPowerHandling::CheckScreenSaverAndDPMS()
   }
 }
 
+void CApplicationPowerHandling::CheckIdle()
+{
+  const unsigned int timeout =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiIdleTimeout;
+
+  const auto& components = CServiceBroker::GetAppComponents();
+  const auto appPlayer = components.GetComponent<CApplicationPlayer>();
+
+  bool idle = timeout > 0 && !m_bInhibitScreenSaver && m_screenSaverTimer.IsRunning() &&
+              m_screenSaverTimer.GetElapsedSeconds() >= timeout;
+  if (idle && appPlayer && appPlayer->IsPlaying())
+    idle = false;
+
+  if (idle != m_idle)
+  {
+    CLog::Log(LOGDEBUG, "CApplicationPowerHandling: {} idle mode", idle ? "entering" : "leaving");
+    m_idle = idle;
+  }
+}
+
+std::chrono::milliseconds CApplicationPowerHandling::GetIdleFrameTime() const
+{
+  // screensavers are meant to be watched, leave them alone
+  if (!m_idle || m_screensaverActive)
+    return std::chrono::milliseconds::zero();
+
+  const unsigned int fps =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiIdleFps;
+  if (fps == 0)
+    return std::chrono::milliseconds::zero();
+  return std::chrono::milliseconds(1000 / fps);
+}
+
 // activate the screensaver.
 // if forceType is true, we ignore the various conditions that can alter
 // the type of screensaver displayed
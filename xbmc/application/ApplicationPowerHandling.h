@@ -16,6 +16,8 @@
 #include "utils/Stopwatch.h"
 #include "windowing/OSScreenSaver.h"
 
+#include <atomic>
+#include <chrono>
 #include <string>
 
 namespace ADDON
@@ -57,6 +59,17 @@ public:
 
   void ResetNavigationTimer();
 
+  /*!
+   * \brief Whether nothing plays and there was no input for <gui><idletimeout> seconds.
+   * The GUI frame rate is capped and the info providers stop polling while idle.
+   */
+  bool IsIdle() const { return m_idle; }
+
+  /*!
+   * \brief Minimum duration of a GUI frame right now, zero if not capped
+   */
+  std::chrono::milliseconds GetIdleFrameTime() const;
+
   bool IsDPMSActive() const { return m_dpmsIsActive; }
   bool ToggleDPMS(bool manual);
 
@@ -77,6 +90,9 @@ protected:
 
   void InhibitIdleShutdown(bool inhibit);
 
+  // Checks whether the application became idle.
+  void CheckIdle();
+
   /*! \brief Helper method to determine how to handle TMSG_SHUTDOWN
   */
   void HandleShutdownMessage();
@@ -99,6 +115,7 @@ protected:
   bool m_dpmsIsManual = false;
 
   bool m_bInhibitIdleShutdown = false;
+  std::atomic<bool> m_idle{false};
   CStopWatch m_navigationTimer;
   CStopWatch m_shutdownTimer;
 
@@ -8,12 +8,17 @@
 
 #include "AEResampleFactory.h"
 #include "cores/AudioEngine/Engines/ActiveAE/ActiveAEResampleFFMPEG.h"
+#include "cores/AudioEngine/Engines/ActiveAE/ActiveAEResamplePolyphase.h"
 
 namespace ActiveAE
 {
 
-std::unique_ptr<IAEResample> CAEResampleFactory::Create(uint32_t flags /* = 0 */)
+std::unique_ptr<IAEResample> CAEResampleFactory::Create(uint32_t flags /* = 0 */,
+                                                        AEQuality quality /* = AE_QUALITY_UNKNOWN */)
 {
+  if (quality == AE_QUALITY_POLYPHASE && !(flags & AERESAMPLEFACTORY_QUICK_RESAMPLE))
+    return std::make_unique<CActiveAEResamplePolyphase>();
+
   return std::make_unique<CActiveAEResampleFFMPEG>();
 }
 
@@ -27,7 +27,13 @@ enum AEResampleFactoryOptions
 class CAEResampleFactory
 {
 public:
-  static std::unique_ptr<IAEResample> Create(uint32_t flags = 0U);
+  /*!
+   \brief create a resampler
+   \param flags AEResampleFactoryOptions
+   \param quality the resample quality, selects the implementation
+   */
+  static std::unique_ptr<IAEResample> Create(uint32_t flags = 0U,
+                                             AEQuality quality = AE_QUALITY_UNKNOWN);
 };
 
 }
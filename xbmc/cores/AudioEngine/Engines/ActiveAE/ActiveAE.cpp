@@ -21,11 +21,14 @@
 #include "cores/DataCacheCore.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/StringUtils.h"
 #include "utils/log.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
+#include <thread>
 
 using namespace AE;
 using namespace ActiveAE;
@@ -40,6 +43,17 @@ constexpr float MIN_WATER_LEVEL = 0.02f; // min buffer time to prevent underrun
 constexpr float MIN_WATER_LEVEL_RESAMPLE = 0.1f; // min buffer time in resample mode
 constexpr float BUFFER_LEVEL_INCREMENT = 0.0001f; // increment step for ramp-up
 constexpr double MAX_BUFFER_TIME = 0.1; // max time of a buffer in seconds;
+constexpr float LOW_LATENCY_CACHE_LEVEL = 0.05f; // total cache time of a low latency stream
+constexpr double LOW_LATENCY_PERIOD_TIME = 0.01; // sink period requested for low latency streams
+constexpr unsigned int MAX_STREAM_WORKERS = 3; // threads resampling streams besides the engine
+
+std::string GetSoundFormatKey(const AEAudioFormat& format, AEChannel channel)
+{
+  return StringUtils::Format("{}|{}|{}|{}", format.m_sampleRate,
+                             static_cast<std::string>(format.m_channelLayout),
+                             CAEUtil::DataFormatToStr(format.m_dataFormat),
+                             static_cast<int>(channel));
+}
 } // unnamed namespace
 
 void CEngineStats::Reset(unsigned int sampleRate, bool pcm)
@@ -218,14 +232,25 @@ float CEngineStats::GetCacheTime(CActiveAEStream *stream)
   return delay;
 }
 
-float CEngineStats::GetCacheTotal()
+float CEngineStats::GetCacheTotal(const CActiveAEStream* stream)
+{
+  return (stream && stream->m_lowLatency) ? LOW_LATENCY_CACHE_LEVEL : MAX_CACHE_LEVEL;
+}
+
+float CEngineStats::GetMaxDelay(const CActiveAEStream* stream /* = nullptr */) const
 {
-  return MAX_CACHE_LEVEL;
+  const float cache =
+      (stream && stream->m_lowLatency) ? LOW_LATENCY_CACHE_LEVEL : MAX_CACHE_LEVEL;
+  return cache + MAX_WATER_LEVEL + m_sinkCacheTotal;
 }
 
-float CEngineStats::GetMaxDelay() const
+// end-to-end latency a stream is configured for: its cache, the water level and the sink
+float CEngineStats::GetLatency(const CActiveAEStream* stream) const
 {
-  return MAX_CACHE_LEVEL + MAX_WATER_LEVEL + m_sinkCacheTotal;
+  const bool lowLatency = stream && stream->m_lowLatency;
+  return (lowLatency ? LOW_LATENCY_CACHE_LEVEL + MIN_WATER_LEVEL
+                     : MAX_CACHE_LEVEL + MAX_WATER_LEVEL) +
+         m_sinkCacheTotal + m_sinkLatency;
 }
 
 float CEngineStats::GetWaterLevel()
@@ -261,6 +286,40 @@ AEAudioFormat CEngineStats::GetCurrentSinkFormat()
   return m_sinkFormat;
 }
 
+void CEngineStats::GetPerfStats(AEPerfStats& stats)
+{
+  stats.underruns = m_underruns.load(std::memory_order_relaxed);
+  m_resampleTime.Get(stats.resample);
+  m_mixTime.Get(stats.mix);
+  m_sinkWriteTime.Get(stats.sinkWrite);
+
+  AEDelayStatus status;
+  GetDelay(status);
+  stats.sinkDelay = status.GetDelay();
+
+  std::unique_lock lock(m_lock);
+  stats.streams.clear();
+  for (const auto& str : m_streamStats)
+    stats.streams.push_back({str.m_streamId, str.m_bufferedTime, str.m_resampleRatio});
+}
+
+void CEngineTimeCounter::Add(std::chrono::steady_clock::duration time)
+{
+  const int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+  m_count.fetch_add(1, std::memory_order_relaxed);
+  m_total.fetch_add(ns, std::memory_order_relaxed);
+  int64_t max = m_max.load(std::memory_order_relaxed);
+  while (ns > max && !m_max.compare_exchange_weak(max, ns, std::memory_order_relaxed))
+    ;
+}
+
+void CEngineTimeCounter::Get(AEPerfStats::Timing& timing) const
+{
+  timing.count = m_count.load(std::memory_order_relaxed);
+  timing.totalMs = m_total.load(std::memory_order_relaxed) / 1e6;
+  timing.maxMs = m_max.load(std::memory_order_relaxed) / 1e6;
+}
+
 CActiveAE::CActiveAE() :
   CThread("ActiveAE"),
   m_controlPort("OutputControlPort", &m_inMsgEvent, &m_outMsgEvent),
@@ -276,6 +335,7 @@ CActiveAE::CActiveAE() :
   m_encoder = NULL;
   m_vizInitialized = false;
   m_sinkHasVolume = false;
+  m_lowLatency = false;
   m_aeGUISoundForce = false;
   m_stats.Reset(48000, true);
   m_streamIdGen = 0;
@@ -303,6 +363,7 @@ void CActiveAE::Dispose()
   m_bStop = true;
   m_outMsgEvent.Set();
   StopThread();
+  m_streamWorkers.reset();
   m_controlPort.Purge();
   m_dataPort.Purge();
   m_sink.Dispose();
@@ -1187,19 +1248,28 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
   ApplySettingsToFormat(m_sinkRequestFormat, m_settings, (int*)&m_mode);
   m_extKeepConfig = 0ms;
 
+  // low latency streams ask the sink for short periods, otherwise the sink uses its defaults
+  const bool lowLatency = m_sinkRequestFormat.m_dataFormat != AE_FMT_RAW &&
+                          std::ranges::any_of(m_streams, [](const CActiveAEStream* stream)
+                                              { return stream->m_lowLatency; });
+  m_sinkRequestFormat.m_frames =
+      lowLatency ? m_sinkRequestFormat.m_sampleRate * LOW_LATENCY_PERIOD_TIME : 0;
+
   std::string device = (m_sinkRequestFormat.m_dataFormat == AE_FMT_RAW) ? m_settings.passthroughdevice : m_settings.device;
 
   const AESinkDevice dev = CAESinkFactory::ParseDevice(device);
 
   if ((!CompareFormat(m_sinkRequestFormat, m_sinkFormat) &&
        !CompareFormat(m_sinkRequestFormat, oldSinkRequestFormat)) ||
-      m_currDevice.compare(dev.name) != 0 || m_settings.driver.compare(dev.driver) != 0)
+      m_currDevice.compare(dev.name) != 0 || m_settings.driver.compare(dev.driver) != 0 ||
+      lowLatency != m_lowLatency)
   {
     FlushEngine();
     if (!InitSink())
       return;
     m_settings.driver = dev.driver;
     m_currDevice = dev.name;
+    m_lowLatency = lowLatency;
     initSink = true;
     m_stats.Reset(m_sinkFormat.m_sampleRate, m_mode == MODE_PCM);
     m_sink.m_controlPort.SendOutMessage(CSinkControlProtocol::VOLUME, &m_volume, sizeof(float));
@@ -1451,11 +1521,11 @@ void CActiveAE::Configure(AEAudioFormat *desiredFmt)
        (m_settings.guisoundmode == AE_SOUND_IDLE && m_streams.empty()) ||
        m_aeGUISoundForce)
     {
-      std::vector<CActiveAESound*>::iterator it;
-      for (it = m_sounds.begin(); it != m_sounds.end(); ++it)
-      {
-        (*it)->SetConverted(false);
-      }
+      // sounds converted to this format before are picked up again, the others are converted
+      // right away so playing them later doesn't resample in the mixer
+      for (auto* sound : m_sounds)
+        sound->SelectFormat(GetSoundFormatKey(m_internalFormat, sound->GetChannel()));
+      ResampleSounds();
     }
     m_sounds_playing.clear();
   }
@@ -1505,6 +1575,9 @@ CActiveAEStream* CActiveAE::CreateStream(MsgStreamNew *streamMsg)
   if (streamMsg->options & AESTREAM_FORCE_RESAMPLE)
     stream->m_forceResampler = true;
 
+  if (streamMsg->options & AESTREAM_LOW_LATENCY)
+    stream->m_lowLatency = true;
+
   stream->m_pClock = streamMsg->clock;
 
   m_streams.push_back(stream);
@@ -1681,7 +1754,7 @@ void CActiveAE::ConfigureLowLatency()
 {
   bool resample{false};
 
-  if (m_settings.lowLatencyMode)
+  if (m_settings.lowLatencyMode || m_lowLatency)
   {
     if (!m_streams.empty())
     {
@@ -1708,6 +1781,18 @@ void CActiveAE::ConfigureLowLatency()
 
   CLog::LogF(LOGDEBUG, "Low latency mode: {} - Initial buffer level: {:.0f}ms (resample: {})",
              m_settings.lowLatencyMode, m_initialTargetBufferLevel * 1000.0f, resample);
+
+  if (m_lowLatency)
+  {
+    for (const auto& stream : m_streams)
+    {
+      if (stream->m_lowLatency)
+        CLog::LogF(LOGDEBUG,
+                   "Low latency stream {} - sink period: {:.0f}ms, configured latency: {:.0f}ms",
+                   stream->m_id, 1000.0 * m_sinkFormat.m_frames / m_sinkFormat.m_sampleRate,
+                   m_stats.GetLatency(stream) * 1000.0f);
+    }
+  }
 }
 
 void CActiveAE::ApplySettingsToFormat(AEAudioFormat& format,
@@ -1957,13 +2042,31 @@ bool CActiveAE::RunStages()
 {
   bool busy = false;
 
+  // resample the input streams, in parallel when there are several of them
+  m_streamJobs.clear();
+  for (auto* stream : m_streams)
+  {
+    if (stream->m_processingBuffers && !stream->m_paused)
+      m_streamJobs.push_back(stream->m_processingBuffers.get());
+  }
+  const auto resampleStart = std::chrono::steady_clock::now();
+  if (m_streamJobs.size() > 1 && !m_streamWorkers)
+  {
+    const unsigned int threads =
+        std::clamp(std::thread::hardware_concurrency(), 2u, MAX_STREAM_WORKERS + 1) - 1;
+    m_streamWorkers = std::make_unique<CActiveAEStreamWorkers>(threads);
+  }
+  if (m_streamWorkers)
+    busy = m_streamWorkers->ProcessBuffers(m_streamJobs);
+  else if (!m_streamJobs.empty())
+    busy = m_streamJobs.front()->ProcessBuffers();
+  if (!m_streamJobs.empty())
+    m_stats.AddResampleTime(std::chrono::steady_clock::now() - resampleStart);
+
   // serve input streams
   std::list<CActiveAEStream*>::iterator it;
   for (it = m_streams.begin(); it != m_streams.end(); ++it)
   {
-    if ((*it)->m_processingBuffers && !(*it)->m_paused)
-      busy = (*it)->m_processingBuffers->ProcessBuffers();
-
     if ((*it)->m_streamIsBuffering &&
         (*it)->m_processingBuffers &&
         ((*it)->m_processingBuffers->HasInputLevel(50)))
@@ -1980,7 +2083,7 @@ bool CActiveAE::RunStages()
       float buftime = (float)(*it)->m_inputBuffers->m_format.m_frames / (*it)->m_inputBuffers->m_format.m_sampleRate;
       if ((*it)->m_inputBuffers->m_format.m_dataFormat == AE_FMT_RAW)
         buftime = (*it)->m_inputBuffers->m_format.m_streamInfo.GetDuration() / 1000;
-      while ((time < MAX_CACHE_LEVEL || (*it)->m_streamIsBuffering) &&
+      while ((time < m_stats.GetCacheTotal(*it) || (*it)->m_streamIsBuffering) &&
              !(*it)->m_inputBuffers->m_freeSamples.empty())
       {
         buffer = (*it)->m_inputBuffers->GetFreeBuffer();
@@ -2025,7 +2128,8 @@ bool CActiveAE::RunStages()
   const bool isTrueHDPassthrough =
       (m_mode == MODE_RAW && m_sinkFormat.m_streamInfo.m_type == CAEStreamInfo::STREAM_TYPE_TRUEHD);
 
-  if (m_settings.lowLatencyMode)
+  // low latency streams keep the minimum buffer level instead
+  if (m_settings.lowLatencyMode && !m_lowLatency)
   {
     // m_targetBufferLevel grows progressively from ~20ms (virtual zero buffer and zero latency)
     // to ~200 ms (nominal buffer and nominal latency), same as before.
@@ -2044,7 +2148,7 @@ bool CActiveAE::RunStages()
     for (it = m_streams.begin(); it != m_streams.end(); ++it)
     {
       // reset target buffer level at pause (but not initial start pause)
-      if ((*it)->m_paused && (*it)->m_started && m_settings.lowLatencyMode)
+      if ((*it)->m_paused && (*it)->m_started && (m_settings.lowLatencyMode || m_lowLatency))
         m_targetBufferLevel = m_initialTargetBufferLevel;
 
       if ((*it)->m_paused || !(*it)->m_started || !(*it)->m_processingBuffers || !(*it)->m_pClock)
@@ -2101,6 +2205,7 @@ bool CActiveAE::RunStages()
       }
 
       // mix streams
+      auto mixStart = std::chrono::steady_clock::now();
       std::list<CActiveAEStream*>::iterator it;
 
       // if we deal with more than a single stream, all streams
@@ -2176,6 +2281,7 @@ bool CActiveAE::RunStages()
               nb_loops = out->pkt->nb_samples;
             }
 
+            m_frameGains.resize(nb_loops);
             for(int i=0; i<nb_loops; i++)
             {
               if ((*it)->m_fadingSamples > 0)
@@ -2195,20 +2301,13 @@ bool CActiveAE::RunStages()
               float volume = (*it)->m_volume * (*it)->m_rgain;
               if(nb_loops > 1)
                 volume *= (*it)->m_limiter.Run((float**)out->pkt->data, out->pkt->config.channels, i*nb_floats, out->pkt->planes > 1);
-
-              for(int j=0; j<out->pkt->planes; j++)
-              {
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulArray((float*)out->pkt->data[j]+i*nb_floats, volume, nb_floats);
-#else
-                float* fbuffer = (float*) out->pkt->data[j]+i*nb_floats;
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  fbuffer[k] *= volume;
-                }
-#endif
-              }
+              m_frameGains[i] = volume;
             }
+
+            // apply the gains of all frames at once
+            for (int j = 0; j < out->pkt->planes; j++)
+              CAEUtil::MulFramesArray(reinterpret_cast<float*>(out->pkt->data[j]),
+                                      m_frameGains.data(), nb_loops, nb_floats);
           }
           else
           {
@@ -2243,6 +2342,7 @@ bool CActiveAE::RunStages()
               nb_loops = out->pkt->nb_samples;
             }
 
+            m_frameGains.resize(nb_loops);
             for(int i=0; i<nb_loops; i++)
             {
               if ((*it)->m_fadingSamples > 0)
@@ -2262,31 +2362,14 @@ bool CActiveAE::RunStages()
               float volume = (*it)->m_volume * (*it)->m_rgain;
               if(nb_loops > 1)
                 volume *= (*it)->m_limiter.Run((float**)mix->pkt->data, mix->pkt->config.channels, i*nb_floats, mix->pkt->planes > 1);
-
-              for(int j=0; j<out->pkt->planes && j<mix->pkt->planes; j++)
-              {
-                float *dst = (float*)out->pkt->data[j]+i*nb_floats;
-                float *src = (float*)mix->pkt->data[j]+i*nb_floats;
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulAddArray(dst, src, volume, nb_floats);
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  if (fabs(dst[k]) > 1.0f)
-                  {
-                    needClamp = true;
-                    break;
-                  }
-                }
-#else
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  dst[k] += src[k] * volume;
-                  if (fabs(dst[k]) > 1.0f)
-                    needClamp = true;
-                }
-#endif
-              }
+              m_frameGains[i] = volume;
             }
+
+            // mix all frames at once
+            for (int j = 0; j < out->pkt->planes && j < mix->pkt->planes; j++)
+              needClamp |= CAEUtil::MulAddFramesArray(reinterpret_cast<float*>(out->pkt->data[j]),
+                                                      reinterpret_cast<float*>(mix->pkt->data[j]),
+                                                      m_frameGains.data(), nb_loops, nb_floats);
             mix->Return();
           }
           busy = true;
@@ -2302,6 +2385,7 @@ bool CActiveAE::RunStages()
           CAEUtil::ClampArray((float*)out->pkt->data[i], nb_floats);
         }
       }
+      auto mixTime = std::chrono::steady_clock::now() - mixStart;
 
       // process output buffer, gui sounds, encode, viz
       if (out)
@@ -2360,9 +2444,12 @@ bool CActiveAE::RunStages()
         }
 
         // mix gui sounds
+        mixStart = std::chrono::steady_clock::now();
         MixSounds(*(out->pkt));
         if (!m_sinkHasVolume || m_muted)
           Deamplify(*(out->pkt));
+        mixTime += std::chrono::steady_clock::now() - mixStart;
+        m_stats.AddMixTime(mixTime);
 
         if (m_mode == MODE_TRANSCODE && m_encoder)
         {
@@ -2673,12 +2760,7 @@ void CActiveAE::MixSounds(CSoundPacket &dstSample)
       out = (float*)dstSample.data[j];
       sample_buffer = (float*)(it->sound->GetSound(false)->data[j]+start);
       int nb_floats = mix_samples * dstSample.config.channels / dstSample.planes;
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulAddArray(out, sample_buffer, volume, nb_floats);
-#else
-      for (int k = 0; k < nb_floats; ++k)
-        *out++ += *sample_buffer++ * volume;
-#endif
+      CAEUtil::MulAddArray(out, sample_buffer, volume, nb_floats);
     }
 
     it->samples_played += mix_samples;
@@ -2703,13 +2785,7 @@ void CActiveAE::Deamplify(CSoundPacket &dstSample)
     for(int j=0; j<dstSample.planes; j++)
     {
       float* buffer = reinterpret_cast<float*>(dstSample.data[j]);
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulArray(buffer, volume, nb_floats);
-#else
-      float *fbuffer = buffer;
-      for (int i = 0; i < nb_floats; i++)
-        *fbuffer++ *= volume;
-#endif
+      CAEUtil::MulArray(buffer, volume, nb_floats);
     }
   }
 }
@@ -2901,7 +2977,8 @@ bool CActiveAE::HasHDAudioChannelCount()
 
 bool CActiveAE::SupportsQualityLevel(enum AEQuality level)
 {
-  if (level == AE_QUALITY_LOW || level == AE_QUALITY_MID || level == AE_QUALITY_HIGH)
+  if (level == AE_QUALITY_LOW || level == AE_QUALITY_MID || level == AE_QUALITY_HIGH ||
+      level == AE_QUALITY_POLYPHASE)
     return true;
 
   return false;
@@ -3071,6 +3148,12 @@ bool CActiveAE::GetCurrentSinkFormat(AEAudioFormat &SinkFormat)
   return true;
 }
 
+bool CActiveAE::GetPerfStats(AEPerfStats& stats)
+{
+  m_stats.GetPerfStats(stats);
+  return true;
+}
+
 void CActiveAE::OnLostDisplay()
 {
   Message *reply;
@@ -3344,15 +3427,10 @@ void CActiveAE::ResampleSounds()
       !m_aeGUISoundForce)
     return;
 
-  std::vector<CActiveAESound*>::iterator it;
-  for (it = m_sounds.begin(); it != m_sounds.end(); ++it)
+  for (auto* sound : m_sounds)
   {
-    if (!(*it)->IsConverted())
-    {
-      ResampleSound(*it);
-      // only do one sound, then yield to main loop
-      break;
-    }
+    if (!sound->IsConverted())
+      ResampleSound(sound);
   }
 }
 
@@ -3368,6 +3446,9 @@ bool CActiveAE::ResampleSound(CActiveAESound *sound)
   if (!sound->GetSound(true))
     return false;
 
+  if (sound->SelectFormat(GetSoundFormatKey(m_internalFormat, sound->GetChannel())))
+    return true;
+
   orig_config = sound->GetSound(true)->config;
 
   dst_config.channel_layout = CAEUtil::GetAVChannelLayout(m_internalFormat.m_channelLayout);
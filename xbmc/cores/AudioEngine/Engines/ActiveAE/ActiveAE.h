@@ -16,6 +16,8 @@
 #include "threads/SystemClock.h"
 #include "threads/Thread.h"
 
+#include <atomic>
+#include <chrono>
 #include <list>
 #include <memory>
 #include <queue>
@@ -38,6 +40,8 @@ namespace ActiveAE
 
 class CActiveAESound;
 class CActiveAEStream;
+class CActiveAEStreamBuffers;
+class CActiveAEStreamWorkers;
 class CActiveAESettings;
 
 struct AudioSettings
@@ -181,6 +185,21 @@ struct MsgStreamFFmpegInfo
   enum AVAudioServiceType audio_service_type;
 };
 
+/*!
+ * \brief Lock free counter of the time spent in one stage of the engine
+ */
+class CEngineTimeCounter
+{
+public:
+  void Add(std::chrono::steady_clock::duration time);
+  void Get(AEPerfStats::Timing& timing) const;
+
+protected:
+  std::atomic<uint64_t> m_count{0};
+  std::atomic<int64_t> m_total{0};
+  std::atomic<int64_t> m_max{0};
+};
+
 class CEngineStats
 {
 public:
@@ -194,8 +213,9 @@ public:
   void GetDelay(AEDelayStatus& status, CActiveAEStream *stream);
   void GetSyncInfo(CAESyncInfo& info, CActiveAEStream *stream);
   float GetCacheTime(CActiveAEStream *stream);
-  float GetCacheTotal();
-  float GetMaxDelay() const;
+  float GetCacheTotal(const CActiveAEStream* stream);
+  float GetMaxDelay(const CActiveAEStream* stream = nullptr) const;
+  float GetLatency(const CActiveAEStream* stream) const;
   float GetWaterLevel();
   void SetSuspended(bool state);
   void SetCurrentSinkFormat(const AEAudioFormat& SinkFormat);
@@ -204,6 +224,11 @@ public:
   void SetSinkNeedIec(bool needIEC) { m_sinkNeedIecPack = needIEC; }
   bool IsSuspended();
   AEAudioFormat GetCurrentSinkFormat();
+  void AddUnderrun() { m_underruns.fetch_add(1, std::memory_order_relaxed); }
+  void AddResampleTime(std::chrono::steady_clock::duration time) { m_resampleTime.Add(time); }
+  void AddMixTime(std::chrono::steady_clock::duration time) { m_mixTime.Add(time); }
+  void AddSinkWriteTime(std::chrono::steady_clock::duration time) { m_sinkWriteTime.Add(time); }
+  void GetPerfStats(AEPerfStats& stats);
 protected:
   float m_sinkCacheTotal;
   float m_sinkLatency;
@@ -225,6 +250,12 @@ protected:
     CAESyncInfo::AESyncState m_syncState;
   };
   std::vector<StreamStats> m_streamStats;
+
+  // performance counters, updated from the engine and sink threads and kept while the engine runs
+  std::atomic<uint64_t> m_underruns{0};
+  CEngineTimeCounter m_resampleTime;
+  CEngineTimeCounter m_mixTime;
+  CEngineTimeCounter m_sinkWriteTime;
 };
 
 class CActiveAE : public IAE, public IDispResource, private CThread
@@ -270,6 +301,7 @@ public:
   void DeviceChange() override;
   void DeviceCountChange(const std::string& driver) override;
   bool GetCurrentSinkFormat(AEAudioFormat &SinkFormat) override;
+  bool GetPerfStats(AEPerfStats& stats) override;
 
   void RegisterAudioCallback(IAudioCallback* pCallback) override;
   void UnregisterAudioCallback(IAudioCallback* pCallback) override;
@@ -289,8 +321,8 @@ protected:
   void GetDelay(AEDelayStatus& status, CActiveAEStream *stream) { m_stats.GetDelay(status, stream); }
   void GetSyncInfo(CAESyncInfo& info, CActiveAEStream *stream) { m_stats.GetSyncInfo(info, stream); }
   float GetCacheTime(CActiveAEStream *stream) { return m_stats.GetCacheTime(stream); }
-  float GetCacheTotal() { return m_stats.GetCacheTotal(); }
-  float GetMaxDelay() { return m_stats.GetMaxDelay(); }
+  float GetCacheTotal(CActiveAEStream* stream) { return m_stats.GetCacheTotal(stream); }
+  float GetMaxDelay(CActiveAEStream* stream) { return m_stats.GetMaxDelay(stream); }
   void FlushStream(CActiveAEStream *stream);
   void PauseStream(CActiveAEStream *stream, bool pause);
   void StopSound(CActiveAESound *sound);
@@ -370,6 +402,9 @@ protected:
   AEAudioFormat m_inputFormat;
   AudioSettings m_settings;
   CEngineStats m_stats;
+  std::vector<float> m_frameGains; ///< gain of each frame of the stream being mixed
+  std::unique_ptr<CActiveAEStreamWorkers> m_streamWorkers;
+  std::vector<CActiveAEStreamBuffers*> m_streamJobs; ///< processing buffers of the running streams
   IAEEncoder *m_encoder;
   std::string m_currDevice;
   std::unique_ptr<CActiveAESettings> m_settingsHandler;
@@ -400,6 +435,7 @@ protected:
   float m_volumeScaled; // multiplier to scale samples in order to achieve the volume specified in m_volume
   bool m_muted;
   bool m_sinkHasVolume;
+  bool m_lowLatency; // sink configured for low latency streams
 
   // viz
   std::vector<IAudioCallback*> m_audioCallback;
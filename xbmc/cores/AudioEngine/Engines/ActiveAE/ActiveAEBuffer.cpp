@@ -9,7 +9,7 @@
 #include "ActiveAEBuffer.h"
 
 #include "ActiveAE.h"
-#include "ActiveAEFilter.h"
+#include "ActiveAETempo.h"
 #include "cores/AudioEngine/AEResampleFactory.h"
 #include "cores/AudioEngine/Utils/AEUtil.h"
 
@@ -169,7 +169,7 @@ bool CActiveAEBufferPoolResample::Create(
 
 void CActiveAEBufferPoolResample::ChangeResampler()
 {
-  m_resampler = CAEResampleFactory::Create();
+  m_resampler = CAEResampleFactory::Create(0U, m_resampleQuality);
 
   SampleConfig dstConfig, srcConfig;
   dstConfig.channel_layout = CAEUtil::GetAVChannelLayout(m_format.m_channelLayout);
@@ -470,8 +470,8 @@ bool CActiveAEBufferPoolAtempo::Create(unsigned int totaltime)
 {
   CActiveAEBufferPool::Create(totaltime);
 
-  m_pTempoFilter = std::make_unique<CActiveAEFilter>();
-  m_pTempoFilter->Init(CAEUtil::GetAVSampleFormat(m_format.m_dataFormat), m_format.m_sampleRate, CAEUtil::GetAVChannelLayout(m_format.m_channelLayout));
+  m_pTempoFilter = std::make_unique<CActiveAETempo>();
+  m_pTempoFilter->Init(m_format);
 
   return true;
 }
@@ -541,8 +541,7 @@ bool CActiveAEBufferPoolAtempo::ProcessBuffers()
       int out_samples = m_pTempoFilter->ProcessFilter(m_planes,
                                                       m_procSample->pkt->max_nb_samples - m_procSample->pkt->nb_samples,
                                                       in ? in->pkt->data : nullptr,
-                                                      in ? in->pkt->nb_samples : 0,
-                                                      in ? in->pkt->linesize * in->pkt->planes : 0);
+                                                      in ? in->pkt->nb_samples : 0);
 
       // in case of error, trigger re-create of filter
       if (out_samples < 0)
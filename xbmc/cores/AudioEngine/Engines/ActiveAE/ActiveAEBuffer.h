@@ -118,7 +118,7 @@ protected:
   bool m_stereoUpmix = false;
 };
 
-class CActiveAEFilter;
+class CActiveAETempo;
 
 class CActiveAEBufferPoolAtempo : public CActiveAEBufferPool
 {
@@ -138,7 +138,7 @@ public:
 
 protected:
   void ChangeFilter();
-  std::unique_ptr<CActiveAEFilter> m_pTempoFilter;
+  std::unique_ptr<CActiveAETempo> m_pTempoFilter;
   uint8_t *m_planes[16];
   CSampleBuffer *m_procSample;
   bool m_empty;
@@ -0,0 +1,273 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ActiveAEResamplePolyphase.h"
+
+#include "ActiveAEResampleFFMPEG.h"
+#include "cores/AudioEngine/Utils/AEUtil.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cmath>
+
+extern "C" {
+#include <libavutil/samplefmt.h>
+}
+
+using namespace ActiveAE;
+
+namespace
+{
+constexpr int TAPS = 64; // taps of each phase, a multiple of the SIMD width
+constexpr int HALF_TAPS = TAPS / 2;
+constexpr int PHASES = 256; // phases of the filter, taps in between are interpolated
+constexpr double CUTOFF = 0.97; // of the lower nyquist frequency
+constexpr double KAISER_BETA = 8.0; // about 80 dB stop band attenuation
+
+double BesselI0(double x)
+{
+  double sum = 1.0;
+  double term = 1.0;
+  for (int k = 1; k < 32; ++k)
+  {
+    term *= (x / (2.0 * k)) * (x / (2.0 * k));
+    sum += term;
+    if (term < sum * 1e-12)
+      break;
+  }
+  return sum;
+}
+} // namespace
+
+CActiveAEResamplePolyphase::CActiveAEResamplePolyphase() = default;
+
+CActiveAEResamplePolyphase::~CActiveAEResamplePolyphase() = default;
+
+bool CActiveAEResamplePolyphase::Init(SampleConfig dstConfig,
+                                      SampleConfig srcConfig,
+                                      bool upmix,
+                                      bool normalize,
+                                      double centerMix,
+                                      CAEChannelInfo* remapLayout,
+                                      AEQuality quality,
+                                      bool force_resample,
+                                      float sublevel)
+{
+  m_srcRate = srcConfig.sample_rate;
+  m_dstRate = dstConfig.sample_rate;
+  m_channels = dstConfig.channels;
+  m_filter = m_srcRate != m_dstRate || force_resample;
+
+  m_input = std::make_unique<CActiveAEResampleFFMPEG>();
+  m_output.reset();
+  if (!m_filter)
+    return m_input->Init(dstConfig, srcConfig, upmix, normalize, centerMix, remapLayout, quality,
+                         false, sublevel);
+
+  if (m_channels <= 0 || m_channels > AE_CH_MAX || m_srcRate <= 0 || m_dstRate <= 0)
+  {
+    CLog::Log(LOGERROR, "CActiveAEResamplePolyphase::Init - invalid configuration");
+    return false;
+  }
+
+  // remap, mix and convert to planar float at the source rate
+  SampleConfig planarConfig = dstConfig;
+  planarConfig.fmt = AV_SAMPLE_FMT_FLTP;
+  planarConfig.sample_rate = m_srcRate;
+  planarConfig.bits_per_sample = 32;
+  planarConfig.dither_bits = 0;
+  if (!m_input->Init(planarConfig, srcConfig, upmix, normalize, centerMix, remapLayout,
+                     AE_QUALITY_UNKNOWN, false, sublevel))
+    return false;
+
+  // the channels are in their final order already, so both sides of the output conversion get
+  // the same default layout and swresample only converts the format
+  if (dstConfig.fmt != AV_SAMPLE_FMT_FLTP)
+  {
+    SampleConfig srcPlanar = planarConfig;
+    srcPlanar.sample_rate = m_dstRate;
+    srcPlanar.channel_layout = 0;
+    SampleConfig dst = dstConfig;
+    dst.channel_layout = 0;
+    m_output = std::make_unique<CActiveAEResampleFFMPEG>();
+    if (!m_output->Init(dst, srcPlanar, false, false, centerMix, nullptr, AE_QUALITY_UNKNOWN, false,
+                        0.0f))
+      return false;
+  }
+
+  CreateFilter();
+
+  // start with the history the first output sample needs, so the filter adds no delay
+  m_history.assign(m_channels, std::vector<float>(HALF_TAPS - 1, 0.0f));
+  m_outputPlanes.assign(m_output ? m_channels : 0, std::vector<float>());
+  m_phaseTaps.resize(TAPS);
+  m_position = 0.0;
+  m_flushed = false;
+  return true;
+}
+
+void CActiveAEResamplePolyphase::CreateFilter()
+{
+  const double cutoff = CUTOFF * std::min(1.0, static_cast<double>(m_dstRate) / m_srcRate);
+  const double window = BesselI0(KAISER_BETA);
+
+  // one row more than phases, so interpolating the last phase doesn't need a special case
+  m_taps.resize((PHASES + 1) * TAPS);
+  for (int phase = 0; phase <= PHASES; ++phase)
+  {
+    float* taps = m_taps.data() + phase * TAPS;
+    double sum = 0.0;
+    for (int k = 0; k < TAPS; ++k)
+    {
+      // distance of the tap to the output sample in input samples
+      const double x = k - (HALF_TAPS - 1) - static_cast<double>(phase) / PHASES;
+      const double t = std::clamp(x / HALF_TAPS, -1.0, 1.0);
+      const double kaiser = BesselI0(KAISER_BETA * std::sqrt(1.0 - t * t)) / window;
+      const double arg = M_PI * cutoff * x;
+      const double sinc = arg == 0.0 ? 1.0 : std::sin(arg) / arg;
+      taps[k] = static_cast<float>(cutoff * sinc * kaiser);
+      sum += taps[k];
+    }
+    // unity gain for every phase, otherwise the phases modulate a constant signal
+    for (int k = 0; k < TAPS; ++k)
+      taps[k] = static_cast<float>(taps[k] / sum);
+  }
+}
+
+int CActiveAEResamplePolyphase::Filter(float** dst, int dst_samples, double ratio)
+{
+  const double step = static_cast<double>(m_srcRate) / (m_dstRate * ratio);
+  const size_t available = m_history[0].size();
+
+  int samples = 0;
+  while (samples < dst_samples)
+  {
+    const size_t first = static_cast<size_t>(m_position);
+    if (first + TAPS > available)
+      break;
+
+    const double phase = (m_position - first) * PHASES;
+    const int index = std::min(static_cast<int>(phase), PHASES - 1);
+    const float frac = static_cast<float>(phase - index);
+    const float* taps0 = m_taps.data() + index * TAPS;
+    const float* taps1 = taps0 + TAPS;
+    for (int k = 0; k < TAPS; ++k)
+      m_phaseTaps[k] = taps0[k] + frac * (taps1[k] - taps0[k]);
+
+    for (int ch = 0; ch < m_channels; ++ch)
+      dst[ch][samples] = CAEUtil::DotProduct(m_history[ch].data() + first, m_phaseTaps.data(), TAPS);
+
+    m_position += step;
+    samples++;
+  }
+
+  const size_t consumed = std::min(static_cast<size_t>(m_position), available);
+  if (consumed > 0)
+  {
+    for (auto& history : m_history)
+      history.erase(history.begin(), history.begin() + consumed);
+    m_position -= consumed;
+  }
+  return samples;
+}
+
+double CActiveAEResamplePolyphase::GetPendingInput() const
+{
+  // input samples after the one the next output sample is centered on, without the silence of a
+  // flush
+  const double pending = m_history[0].size() - (m_position + HALF_TAPS - 1);
+  return std::max(0.0, m_flushed ? pending - HALF_TAPS : pending);
+}
+
+int CActiveAEResamplePolyphase::Resample(
+    uint8_t** dst_buffer, int dst_samples, uint8_t** src_buffer, int src_samples, double ratio)
+{
+  if (!m_filter)
+    return m_input->Resample(dst_buffer, dst_samples, src_buffer, src_samples, ratio);
+
+  if (src_buffer && src_samples > 0)
+  {
+    // convert straight into the history of the filter
+    uint8_t* planes[AE_CH_MAX];
+    const size_t size = m_history[0].size();
+    for (int ch = 0; ch < m_channels; ++ch)
+    {
+      m_history[ch].resize(size + src_samples);
+      planes[ch] = reinterpret_cast<uint8_t*>(m_history[ch].data() + size);
+    }
+
+    const int converted = m_input->Resample(planes, src_samples, src_buffer, src_samples, 1.0);
+    for (auto& history : m_history)
+      history.resize(size + std::max(converted, 0));
+    if (converted < 0)
+      return -1;
+    m_flushed = false;
+  }
+
+  float* planes[AE_CH_MAX];
+  for (int ch = 0; ch < m_channels; ++ch)
+  {
+    if (m_output)
+    {
+      if (m_outputPlanes[ch].size() < static_cast<size_t>(dst_samples))
+        m_outputPlanes[ch].resize(dst_samples);
+      planes[ch] = m_outputPlanes[ch].data();
+    }
+    else
+      planes[ch] = reinterpret_cast<float*>(dst_buffer[ch]);
+  }
+
+  int samples = Filter(planes, dst_samples, ratio);
+
+  // without input the caller drains us, pad with silence to get out the last samples
+  if (samples == 0 && !src_buffer && !m_flushed && GetPendingInput() > 0)
+  {
+    for (auto& history : m_history)
+      history.insert(history.end(), HALF_TAPS, 0.0f);
+    m_flushed = true;
+    samples = Filter(planes, dst_samples, ratio);
+  }
+
+  if (m_output && samples > 0)
+  {
+    uint8_t* src[AE_CH_MAX];
+    for (int ch = 0; ch < m_channels; ++ch)
+      src[ch] = reinterpret_cast<uint8_t*>(planes[ch]);
+    return m_output->Resample(dst_buffer, dst_samples, src, samples, 1.0);
+  }
+  return samples;
+}
+
+int64_t CActiveAEResamplePolyphase::GetDelay(int64_t base)
+{
+  if (!m_filter)
+    return m_input->GetDelay(base);
+  return static_cast<int64_t>(GetPendingInput() * base / m_srcRate);
+}
+
+int CActiveAEResamplePolyphase::GetBufferedSamples()
+{
+  if (!m_filter)
+    return m_input->GetBufferedSamples();
+  return static_cast<int>(std::ceil(GetPendingInput() * m_dstRate / m_srcRate));
+}
+
+int CActiveAEResamplePolyphase::CalcDstSampleCount(int src_samples, int dst_rate, int src_rate)
+{
+  return static_cast<int>((static_cast<int64_t>(src_samples) * dst_rate + src_rate - 1) / src_rate);
+}
+
+int CActiveAEResamplePolyphase::GetSrcBufferSize(int samples)
+{
+  return m_input->GetSrcBufferSize(samples);
+}
+
+int CActiveAEResamplePolyphase::GetDstBufferSize(int samples)
+{
+  return m_output ? m_output->GetDstBufferSize(samples) : m_input->GetDstBufferSize(samples);
+}
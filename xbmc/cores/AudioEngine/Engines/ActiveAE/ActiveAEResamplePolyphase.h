@@ -0,0 +1,78 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "cores/AudioEngine/Interfaces/AE.h"
+#include "cores/AudioEngine/Interfaces/AEResample.h"
+
+#include <memory>
+#include <vector>
+
+namespace ActiveAE
+{
+
+class CActiveAEResampleFFMPEG;
+
+/*!
+ * \brief Sample rate conversion with a windowed sinc polyphase filter on planar float samples
+ *
+ * The filter taps of an output sample are interpolated between two phases once, and then applied
+ * to every channel with a SIMD dot product, so the cost per extra channel is a single pass over
+ * the taps. Format conversion, remapping and downmix are left to swresample, which runs at the
+ * source rate before the filter and, if the destination is not planar float, at the destination
+ * rate after it. Without a rate change the whole job is handed to swresample.
+ */
+class CActiveAEResamplePolyphase : public IAEResample
+{
+public:
+  const char* GetName() override { return "ActiveAEResamplePolyphase"; }
+  CActiveAEResamplePolyphase();
+  ~CActiveAEResamplePolyphase() override;
+  bool Init(SampleConfig dstConfig,
+            SampleConfig srcConfig,
+            bool upmix,
+            bool normalize,
+            double centerMix,
+            CAEChannelInfo* remapLayout,
+            AEQuality quality,
+            bool force_resample,
+            float sublevel) override;
+  int Resample(uint8_t** dst_buffer,
+               int dst_samples,
+               uint8_t** src_buffer,
+               int src_samples,
+               double ratio) override;
+  int64_t GetDelay(int64_t base) override;
+  int GetBufferedSamples() override;
+  bool WantsNewSamples(int samples) override { return GetBufferedSamples() <= samples * 2; }
+  int CalcDstSampleCount(int src_samples, int dst_rate, int src_rate) override;
+  int GetSrcBufferSize(int samples) override;
+  int GetDstBufferSize(int samples) override;
+
+private:
+  void CreateFilter();
+  int Filter(float** dst, int dst_samples, double ratio);
+  double GetPendingInput() const;
+
+  std::unique_ptr<CActiveAEResampleFFMPEG> m_input; ///< conversion to planar float at the source rate
+  std::unique_ptr<CActiveAEResampleFFMPEG> m_output; ///< conversion from planar float, if needed
+  bool m_filter = false;
+  int m_srcRate = 0;
+  int m_dstRate = 0;
+  int m_channels = 0;
+
+  std::vector<float> m_taps; ///< (phases + 1) rows of filter taps
+  std::vector<float> m_phaseTaps; ///< the taps interpolated for the current output sample
+  std::vector<std::vector<float>> m_history; ///< not yet consumed input of each channel
+  std::vector<std::vector<float>> m_outputPlanes; ///< filter output before the conversion
+  double m_position = 0.0; ///< position of the next output sample in the history
+  bool m_flushed = false;
+};
+
+} // namespace ActiveAE
@@ -112,6 +112,9 @@ void CActiveAESettings::SettingOptionsAudioQualityLevelsFiller(
   if (m_instance->m_audioEngine.SupportsQualityLevel(AE_QUALITY_REALLYHIGH))
     list.emplace_back(CServiceBroker::GetResourcesComponent().GetLocalizeStrings().Get(13509),
                       AE_QUALITY_REALLYHIGH);
+  if (m_instance->m_audioEngine.SupportsQualityLevel(AE_QUALITY_POLYPHASE))
+    list.emplace_back(CServiceBroker::GetResourcesComponent().GetLocalizeStrings().Get(14285),
+                      AE_QUALITY_POLYPHASE);
   if (m_instance->m_audioEngine.SupportsQualityLevel(AE_QUALITY_GPU))
     list.emplace_back(CServiceBroker::GetResourcesComponent().GetLocalizeStrings().Get(38010),
                       AE_QUALITY_GPU);
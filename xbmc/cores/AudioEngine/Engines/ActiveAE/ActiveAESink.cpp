@@ -545,6 +545,9 @@ void CActiveAESink::StateMachine(int signal, Protocol *port, Message *msg)
         switch (signal)
         {
         case CSinkControlProtocol::TIMEOUT:
+          // the engine was streaming but did not deliver in time, silence fills the gap
+          if (m_extStreaming)
+            m_stats->AddUnderrun();
           if (!m_extSilenceTimer.IsTimePast())
           {
             m_state = S_TOP_CONFIGURED_SILENCE;
@@ -1043,15 +1046,19 @@ unsigned int CActiveAESink::OutputSamples(CSampleBuffer* samples)
     bool skipSwap = false;
     if (m_needIecPack)
     {
+      // TrueHD bursts are packed in the sample buffer, the other formats go through the packer
+      bool packedInPlace = false;
       if (frames > 0)
       {
         m_packer->Reset();
-        m_packer->Pack(m_sinkFormat.m_streamInfo, buffer[0], frames);
+        packedInPlace = m_packer->PackInPlace(m_sinkFormat.m_streamInfo, buffer[0], frames);
+        if (!packedInPlace)
+          m_packer->Pack(m_sinkFormat.m_streamInfo, buffer[0], frames);
       }
       else if (samples->pkt->pause_burst_ms > 0)
       {
         // construct a pause burst if we have already output valid audio
-        bool burst = m_extStreaming && (m_packer->GetBuffer()[0] != 0);
+        bool burst = m_extStreaming && m_packer->HasBurst();
         if (!m_packer->PackPause(m_sinkFormat.m_streamInfo, samples->pkt->pause_burst_ms, burst))
           skipSwap = true;
       }
@@ -1059,7 +1066,7 @@ unsigned int CActiveAESink::OutputSamples(CSampleBuffer* samples)
         m_packer->Reset();
 
       unsigned int size = m_packer->GetSize();
-      packBuffer = m_packer->GetBuffer();
+      packBuffer = packedInPlace ? buffer[0] : m_packer->GetBuffer();
       buffer = &packBuffer;
       totalFrames = size / m_sinkFormat.m_frameSize;
       frames = totalFrames;
@@ -1095,6 +1102,7 @@ unsigned int CActiveAESink::OutputSamples(CSampleBuffer* samples)
 
   int framesOrPackets;
 
+  const auto writeStart = std::chrono::steady_clock::now();
   while (frames > 0)
   {
     maxFrames = std::min(frames, m_sinkFormat.m_frames);
@@ -1140,6 +1148,9 @@ unsigned int CActiveAESink::OutputSamples(CSampleBuffer* samples)
   if (m_requestedFormat.m_dataFormat == AE_FMT_RAW)
     m_stats->UpdateSinkDelay(status, samples->pool ? 1 : 0);
 
+  if (samples->pool)
+    m_stats->AddSinkWriteTime(std::chrono::steady_clock::now() - writeStart);
+
   return status.delay * 1000;
 }
 
@@ -13,6 +13,12 @@
 #include "filesystem/File.h"
 #include "utils/log.h"
 
+namespace
+{
+// the formats of the last few sinks are kept, so switching between them doesn't convert again
+constexpr size_t MAX_CONVERTED_FORMATS = 4;
+} // namespace
+
 extern "C" {
 #include <libavutil/avutil.h>
 }
@@ -35,7 +41,6 @@ CActiveAESound::CActiveAESound(const std::string& filename, CActiveAE* ae)
 CActiveAESound::~CActiveAESound()
 {
   delete m_orig_sound;
-  delete m_dst_sound;
   Finish();
 }
 
@@ -58,18 +63,26 @@ bool CActiveAESound::IsPlaying()
 
 uint8_t** CActiveAESound::InitSound(bool orig, SampleConfig config, int nb_samples)
 {
-  CSoundPacket **info;
-  if (orig)
-    info = &m_orig_sound;
-  else
-    info = &m_dst_sound;
+  if (!orig)
+  {
+    if (m_dstSounds.size() >= MAX_CONVERTED_FORMATS && !m_dstSounds.contains(m_dstKey))
+      m_dstSounds.clear();
+    auto& sound = m_dstSounds[m_dstKey];
+    sound = std::make_unique<CSoundPacket>(config, nb_samples);
+    m_dst_sound = sound.get();
+    m_dst_sound->nb_samples = 0;
+    m_isConverted = false;
+    return m_dst_sound->data;
+  }
 
-  delete *info;
-  *info = new CSoundPacket(config, nb_samples);
+  delete m_orig_sound;
+  m_orig_sound = new CSoundPacket(config, nb_samples);
 
-  (*info)->nb_samples = 0;
+  m_orig_sound->nb_samples = 0;
+  m_dstSounds.clear();
+  m_dst_sound = nullptr;
   m_isConverted = false;
-  return (*info)->data;
+  return m_orig_sound->data;
 }
 
 bool CActiveAESound::StoreSound(bool orig, uint8_t **buffer, int samples, int linesize)
@@ -100,6 +113,15 @@ bool CActiveAESound::StoreSound(bool orig, uint8_t **buffer, int samples, int li
   return true;
 }
 
+bool CActiveAESound::SelectFormat(const std::string& key)
+{
+  m_dstKey = key;
+  auto it = m_dstSounds.find(key);
+  m_dst_sound = it != m_dstSounds.end() ? it->second.get() : nullptr;
+  m_isConverted = m_dst_sound != nullptr;
+  return m_isConverted;
+}
+
 CSoundPacket *CActiveAESound::GetSound(bool orig)
 {
   if (orig)
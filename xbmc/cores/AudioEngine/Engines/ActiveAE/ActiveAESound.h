@@ -11,6 +11,10 @@
 #include "cores/AudioEngine/Engines/ActiveAE/ActiveAEBuffer.h"
 #include "cores/AudioEngine/Interfaces/AESound.h"
 
+#include <map>
+#include <memory>
+#include <string>
+
 class DllAvUtil;
 
 namespace XFILE
@@ -45,6 +49,13 @@ public:
   bool IsConverted() { return m_isConverted; }
   void SetConverted(bool state) { m_isConverted = state; }
 
+  /*!
+   * \brief Switch the converted sound to the given output format
+   * \param key identifies the output format
+   * \return true if the sound was converted to this format before
+   */
+  bool SelectFormat(const std::string& key);
+
   bool Prepare();
   void Finish();
   int GetChunkSize();
@@ -65,6 +76,8 @@ protected:
 
   CSoundPacket *m_orig_sound;
   CSoundPacket *m_dst_sound;
+  std::string m_dstKey;
+  std::map<std::string, std::unique_ptr<CSoundPacket>> m_dstSounds; ///< converted sounds by format
 
   bool m_isConverted;
 };
@@ -41,6 +41,7 @@ CActiveAEStream::CActiveAEStream(AEAudioFormat* format, unsigned int streamid, C
   m_streamSlave = NULL;
   m_leftoverBytes = 0;
   m_forceResampler = false;
+  m_lowLatency = false;
   m_streamResampleRatio = 1.0;
   m_streamResampleMode = 0;
   m_profile = 0;
@@ -363,12 +364,12 @@ double CActiveAEStream::GetCacheTime()
 
 double CActiveAEStream::GetCacheTotal()
 {
-  return static_cast<double>(m_activeAE->GetCacheTotal());
+  return static_cast<double>(m_activeAE->GetCacheTotal(this));
 }
 
 double CActiveAEStream::GetMaxDelay()
 {
-  return static_cast<double>(m_activeAE->GetMaxDelay());
+  return static_cast<double>(m_activeAE->GetMaxDelay(this));
 }
 
 void CActiveAEStream::Pause()
@@ -779,3 +780,85 @@ bool CActiveAEStreamBuffers::HasWork()
 
   return false;
 }
+
+//------------------------------------------------------------------------------
+// CActiveAEStreamWorkers
+//------------------------------------------------------------------------------
+
+CActiveAEStreamWorkers::CActiveAEStreamWorkers(unsigned int threads)
+{
+  for (unsigned int i = 0; i < threads; ++i)
+    m_threads.emplace_back(&CActiveAEStreamWorkers::Run, this);
+}
+
+CActiveAEStreamWorkers::~CActiveAEStreamWorkers()
+{
+  {
+    std::unique_lock lock(m_section);
+    m_stop = true;
+    m_wake.notifyAll();
+  }
+  for (auto& thread : m_threads)
+    thread.join();
+}
+
+bool CActiveAEStreamWorkers::ProcessBuffers(const std::vector<CActiveAEStreamBuffers*>& buffers)
+{
+  if (buffers.size() < 2 || m_threads.empty())
+  {
+    bool busy = false;
+    for (auto* buffer : buffers)
+      busy |= buffer->ProcessBuffers();
+    return busy;
+  }
+
+  {
+    std::unique_lock lock(m_section);
+    m_jobs = &buffers;
+    m_nextJob = 0;
+    m_busy = false;
+    m_active = m_threads.size();
+    m_generation++;
+    m_wake.notifyAll();
+  }
+
+  ProcessJobs();
+
+  // the workers only touch the job list until they checked in, so it is safe to return after
+  std::unique_lock lock(m_section);
+  m_done.wait(lock, [this]() { return m_active == 0; });
+  m_jobs = nullptr;
+  return m_busy;
+}
+
+void CActiveAEStreamWorkers::Run()
+{
+  // start behind the first dispatch, a worker starting late still checks in for it
+  std::unique_lock lock(m_section);
+  unsigned int generation = 0;
+  while (true)
+  {
+    m_wake.wait(lock, [this, &generation]() { return m_stop || m_generation != generation; });
+    if (m_stop)
+      return;
+    generation = m_generation;
+
+    lock.unlock();
+    ProcessJobs();
+    lock.lock();
+
+    if (--m_active == 0)
+      m_done.notifyAll();
+  }
+}
+
+void CActiveAEStreamWorkers::ProcessJobs()
+{
+  // streams are handed out with a single atomic counter, no lock is held while processing
+  size_t job;
+  while ((job = m_nextJob++) < m_jobs->size())
+  {
+    if ((*m_jobs)[job]->ProcessBuffers())
+      m_busy = true;
+  }
+}
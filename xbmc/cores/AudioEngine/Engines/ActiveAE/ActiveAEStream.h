@@ -13,10 +13,14 @@
 #include "cores/AudioEngine/Interfaces/AEStream.h"
 #include "cores/AudioEngine/Utils/AEAudioFormat.h"
 #include "cores/AudioEngine/Utils/AELimiter.h"
+#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
 #include "threads/Event.h"
 
 #include <atomic>
 #include <deque>
+#include <thread>
+#include <vector>
 
 namespace ActiveAE
 {
@@ -131,6 +135,38 @@ private:
   CActiveAEStreamBuffers& operator=(const CActiveAEStreamBuffers&) = delete;
 };
 
+/*!
+ * \brief Runs ProcessBuffers() of several streams in parallel
+ *
+ * The processing buffers of the streams don't share any state, so the resampling and tempo work of
+ * each stream can run on its own thread. The calling thread takes part in the work and returns
+ * once every stream is done, so the mixer sees the same buffers as if it did the work itself.
+ */
+class CActiveAEStreamWorkers
+{
+public:
+  explicit CActiveAEStreamWorkers(unsigned int threads);
+  ~CActiveAEStreamWorkers();
+  bool ProcessBuffers(const std::vector<CActiveAEStreamBuffers*>& buffers);
+
+private:
+  CActiveAEStreamWorkers(const CActiveAEStreamWorkers&) = delete;
+  CActiveAEStreamWorkers& operator=(const CActiveAEStreamWorkers&) = delete;
+  void Run();
+  void ProcessJobs();
+
+  std::vector<std::thread> m_threads;
+  CCriticalSection m_section;
+  XbmcThreads::ConditionVariable m_wake;
+  XbmcThreads::ConditionVariable m_done;
+  const std::vector<CActiveAEStreamBuffers*>* m_jobs = nullptr;
+  std::atomic<size_t> m_nextJob{0};
+  std::atomic<bool> m_busy{false};
+  unsigned int m_generation = 0;
+  unsigned int m_active = 0;
+  bool m_stop = false;
+};
+
 class CActiveAEStream : public IAEStream
 {
 protected:
@@ -240,6 +276,7 @@ protected:
   enum AVMatrixEncoding m_matrixEncoding;
   enum AVAudioServiceType m_audioServiceType;
   bool m_forceResampler;
+  bool m_lowLatency;
   IAEClockCallback *m_pClock;
   CSyncError m_syncError;
   double m_lastSyncError;
@@ -0,0 +1,325 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ActiveAETempo.h"
+
+#include "cores/AudioEngine/Utils/AEUtil.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace ActiveAE;
+
+namespace
+{
+constexpr double FRAME_TIME = 0.02; // length of a windowed frame in seconds
+constexpr double SEARCH_TIME = 0.008; // max shift of a frame in seconds
+constexpr int COARSE_RATE = 12000; // the coarse search tests one offset per sample at this rate
+} // unnamed namespace
+
+void CActiveAETempo::Init(const AEAudioFormat& format)
+{
+  m_planar = AE_IS_PLANAR(format.m_dataFormat);
+  m_sampleRate = static_cast<int>(format.m_sampleRate);
+  m_channels = 0;
+  if (format.m_dataFormat == AE_FMT_FLOAT || format.m_dataFormat == AE_FMT_FLOATP)
+    m_channels = static_cast<int>(format.m_channelLayout.Count());
+
+  // multiples of 8 keep the dot products on the SIMD path
+  m_overlap = std::max(8, static_cast<int>(m_sampleRate * FRAME_TIME / 2) & ~7);
+  m_frameSize = m_overlap * 2;
+  m_searchRange = static_cast<int>(m_sampleRate * SEARCH_TIME);
+
+  m_window.resize(m_overlap);
+  for (int i = 0; i < m_overlap; ++i)
+    m_window[i] = static_cast<float>(0.5 - 0.5 * std::cos(M_PI * i / m_overlap));
+
+  m_tempo = 1.0f;
+  m_active = false;
+  Reset();
+}
+
+bool CActiveAETempo::SetTempo(float tempo)
+{
+  m_tempo = tempo;
+  Reset();
+  m_active = false;
+  if (m_tempo == 1.0f)
+    return true;
+
+  if (m_channels == 0)
+  {
+    CLog::Log(LOGERROR, "CActiveAETempo::SetTempo - only float samples are supported");
+    return false;
+  }
+
+  m_active = true;
+  return true;
+}
+
+void CActiveAETempo::Reset()
+{
+  m_input.assign(m_channels, {});
+  m_mono.clear();
+  m_tail.assign(m_channels, std::vector<float>(m_overlap));
+  m_output.assign(m_channels, {});
+  m_position = 0.0;
+  m_lastFrame = 0;
+  m_firstFrame = true;
+  m_inputEnd = -1;
+  m_eof = false;
+  m_samplesIn = 0;
+  m_samplesOut = 0;
+}
+
+int CActiveAETempo::ProcessFilter(uint8_t** dst_buffer,
+                                  int dst_samples,
+                                  uint8_t** src_buffer,
+                                  int src_samples)
+{
+  if (m_eof)
+  {
+    if (src_samples)
+    {
+      CLog::Log(LOGERROR, "CActiveAETempo::ProcessFilter - adding data while already eof");
+      return -1;
+    }
+    return 0;
+  }
+
+  if (src_samples)
+  {
+    if (m_inputEnd >= 0)
+    {
+      CLog::Log(LOGERROR, "CActiveAETempo::ProcessFilter - adding data while flushing");
+      return -1;
+    }
+    AddInput(src_buffer, src_samples);
+  }
+  else if (m_inputEnd < 0 && NeedData())
+  {
+    if (m_samplesIn == 0)
+    {
+      m_eof = true;
+      return 0;
+    }
+
+    // end of stream, pad with silence so the frames covering the last samples can be built
+    m_inputEnd = static_cast<int>(m_mono.size());
+    const int padding = m_searchRange + m_frameSize + 1;
+    for (auto& plane : m_input)
+      plane.resize(plane.size() + padding, 0.0f);
+    m_mono.resize(m_mono.size() + padding, 0.0f);
+  }
+
+  while (static_cast<int>(m_output[0].size()) < dst_samples && CanProcessFrame())
+    ProcessFrame();
+
+  const int samples = WriteOutput(dst_buffer, dst_samples);
+
+  if (m_inputEnd >= 0 && !CanProcessFrame() && m_output[0].empty())
+    m_eof = true;
+
+  return samples;
+}
+
+void CActiveAETempo::AddInput(uint8_t** src_buffer, int src_samples)
+{
+  const size_t start = m_mono.size();
+  m_mono.resize(start + src_samples, 0.0f);
+  for (int ch = 0; ch < m_channels; ++ch)
+  {
+    std::vector<float>& plane = m_input[ch];
+    plane.resize(start + src_samples);
+    if (m_planar)
+    {
+      std::memcpy(plane.data() + start, src_buffer[ch], src_samples * sizeof(float));
+    }
+    else
+    {
+      const float* src = reinterpret_cast<const float*>(src_buffer[0]) + ch;
+      for (int i = 0; i < src_samples; ++i)
+        plane[start + i] = src[i * m_channels];
+    }
+
+    float* mono = m_mono.data() + start;
+    const float* in = plane.data() + start;
+    for (int i = 0; i < src_samples; ++i)
+      mono[i] += in[i];
+  }
+  m_samplesIn += src_samples;
+}
+
+bool CActiveAETempo::CanProcessFrame() const
+{
+  const int center = static_cast<int>(std::lround(m_position));
+  if (m_inputEnd >= 0 && center >= m_inputEnd)
+    return false;
+  return center + m_searchRange + m_frameSize <= static_cast<int>(m_mono.size());
+}
+
+bool CActiveAETempo::NeedData() const
+{
+  return m_inputEnd < 0 && !CanProcessFrame();
+}
+
+void CActiveAETempo::ProcessFrame()
+{
+  const int center = static_cast<int>(std::lround(m_position));
+  int frame = center;
+  if (!m_firstFrame)
+    frame = FindBestOffset(m_lastFrame + m_overlap, center);
+
+  // cross fade the tail of the last frame into the rising half of this one, the first frame
+  // starts without a fade
+  for (int ch = 0; ch < m_channels; ++ch)
+  {
+    const float* in = m_input[ch].data() + frame;
+    std::vector<float>& out = m_output[ch];
+    float* tail = m_tail[ch].data();
+    const size_t start = out.size();
+    out.resize(start + m_overlap);
+    float* dst = out.data() + start;
+    if (!m_firstFrame)
+    {
+      for (int i = 0; i < m_overlap; ++i)
+        dst[i] = tail[i] + m_window[i] * in[i];
+    }
+    else
+      std::memcpy(dst, in, m_overlap * sizeof(float));
+
+    in += m_overlap;
+    for (int i = 0; i < m_overlap; ++i)
+      tail[i] = in[i] - m_window[i] * in[i];
+  }
+
+  m_lastFrame = frame;
+  m_firstFrame = false;
+  m_position += m_overlap * static_cast<double>(m_tempo);
+
+  // drop what neither the next frame nor its search target can reach
+  const int drop = std::max(
+      0, std::min(m_lastFrame + m_overlap,
+                  static_cast<int>(std::lround(m_position)) - m_searchRange));
+  if (drop > 0)
+  {
+    for (auto& plane : m_input)
+      plane.erase(plane.begin(), plane.begin() + drop);
+    m_mono.erase(m_mono.begin(), m_mono.begin() + drop);
+    m_lastFrame -= drop;
+    m_position -= drop;
+    if (m_inputEnd >= 0)
+      m_inputEnd -= drop;
+  }
+}
+
+int CActiveAETempo::FindBestOffset(int target, int center)
+{
+  const int first = std::max(0, center - m_searchRange);
+  const int last = center + m_searchRange;
+  const float* mono = m_mono.data();
+  const float* ref = mono + target;
+
+  // energy of the candidate at first, moved along by the samples entering and leaving it
+  double energy = CAEUtil::DotProduct(mono + first, mono + first, m_overlap);
+  auto score = [&](int offset, double offsetEnergy)
+  {
+    const double corr = CAEUtil::DotProduct(ref, mono + offset, m_overlap);
+    return corr / std::sqrt(offsetEnergy + 1e-9);
+  };
+
+  const int step = std::max(1, m_sampleRate / COARSE_RATE);
+  int best = first;
+  double bestScore = -HUGE_VAL;
+  m_energies.resize(last - first + 1);
+  for (int offset = first; offset <= last; ++offset)
+  {
+    m_energies[offset - first] = energy;
+    const float leaving = mono[offset];
+    const float entering = mono[offset + m_overlap];
+    energy = std::max(0.0, energy + entering * entering - leaving * leaving);
+  }
+
+  for (int offset = first; offset <= last; offset += step)
+  {
+    const double value = score(offset, m_energies[offset - first]);
+    if (value > bestScore)
+    {
+      bestScore = value;
+      best = offset;
+    }
+  }
+
+  const int coarse = best;
+  for (int offset = std::max(first, coarse - step + 1); offset <= std::min(last, coarse + step - 1);
+       ++offset)
+  {
+    if (offset == coarse)
+      continue;
+    const double value = score(offset, m_energies[offset - first]);
+    if (value > bestScore)
+    {
+      bestScore = value;
+      best = offset;
+    }
+  }
+  return best;
+}
+
+int CActiveAETempo::WriteOutput(uint8_t** dst_buffer, int dst_samples)
+{
+  int samples = std::min(dst_samples, static_cast<int>(m_output[0].size()));
+
+  // the padding of the last frames must not make the stream longer than the tempo says
+  if (m_inputEnd >= 0)
+  {
+    const int64_t total = std::llround(m_samplesIn / static_cast<double>(m_tempo));
+    samples = static_cast<int>(std::min<int64_t>(samples, std::max<int64_t>(0, total - m_samplesOut)));
+  }
+
+  for (int ch = 0; ch < m_channels; ++ch)
+  {
+    const float* src = m_output[ch].data();
+    if (m_planar)
+    {
+      std::memcpy(dst_buffer[ch], src, samples * sizeof(float));
+    }
+    else
+    {
+      float* dst = reinterpret_cast<float*>(dst_buffer[0]) + ch;
+      for (int i = 0; i < samples; ++i)
+        dst[i * m_channels] = src[i];
+    }
+  }
+
+  m_samplesOut += samples;
+  const bool done = m_inputEnd >= 0 &&
+                    m_samplesOut >= std::llround(m_samplesIn / static_cast<double>(m_tempo));
+
+  // the queue rarely holds more than one frame, so moving the rest to the front is cheap
+  for (auto& plane : m_output)
+    plane.erase(plane.begin(), done ? plane.end() : plane.begin() + samples);
+  return samples;
+}
+
+bool CActiveAETempo::IsEof() const
+{
+  return m_eof;
+}
+
+bool CActiveAETempo::IsActive() const
+{
+  return m_active && !m_eof;
+}
+
+int CActiveAETempo::GetBufferedSamples() const
+{
+  return std::max(0, static_cast<int>(m_samplesIn - m_samplesOut * static_cast<double>(m_tempo)));
+}
@@ -0,0 +1,86 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "cores/AudioEngine/Utils/AEAudioFormat.h"
+
+#include <stdint.h>
+#include <vector>
+
+namespace ActiveAE
+{
+
+/*!
+ * \brief Time stretch of float samples with WSOLA (waveform similarity overlap-add)
+ *
+ * The output is built from Hann windowed frames overlapping by half. Every frame is taken from
+ * the input around its nominal position, shifted within a small search range to the offset
+ * where it matches the natural continuation of the previous frame best. The match is measured
+ * on a mono downmix with SIMD dot products, first on a coarse grid and then refined, so the cost
+ * barely depends on the channel count. Works on planar and packed float, in place of the ffmpeg
+ * atempo filter and its format conversions.
+ */
+class CActiveAETempo
+{
+public:
+  void Init(const AEAudioFormat& format);
+
+  /*!
+   * \brief Stretch samples by the current tempo
+   * \param dst_buffer planes of at least dst_samples free samples
+   * \param src_buffer input samples, nullptr when there is no more input. The remaining samples
+   * are flushed if no input was needed anyway, this ends the stream
+   * \return the number of samples written to dst_buffer, -1 on error
+   */
+  int ProcessFilter(uint8_t** dst_buffer, int dst_samples, uint8_t** src_buffer, int src_samples);
+  bool SetTempo(float tempo);
+  bool NeedData() const;
+  bool IsEof() const;
+  bool IsActive() const;
+
+  /*!
+   * \brief Samples held back by the filter, in input samples
+   */
+  int GetBufferedSamples() const;
+
+protected:
+  void Reset();
+  void AddInput(uint8_t** src_buffer, int src_samples);
+  bool CanProcessFrame() const;
+  void ProcessFrame();
+  int FindBestOffset(int target, int center);
+  int WriteOutput(uint8_t** dst_buffer, int dst_samples);
+
+  bool m_planar = false;
+  int m_channels = 0;
+  int m_sampleRate = 0;
+  float m_tempo = 1.0f;
+
+  int m_frameSize = 0; ///< length of a windowed frame, twice the output hop
+  int m_overlap = 0; ///< output hop and length of the cross fade
+  int m_searchRange = 0; ///< max shift of a frame from its nominal position
+  std::vector<float> m_window; ///< the rising half of the Hann window
+
+  std::vector<std::vector<float>> m_input; ///< not yet consumed input of each channel
+  std::vector<float> m_mono; ///< mono downmix of m_input for the similarity search
+  std::vector<std::vector<float>> m_tail; ///< falling half of the last frame of each channel
+  std::vector<std::vector<float>> m_output; ///< stretched samples not yet returned
+  std::vector<double> m_energies; ///< energy of every search candidate
+
+  double m_position = 0.0; ///< nominal input position of the next frame
+  int m_lastFrame = 0; ///< input position of the last frame, may be partly dropped already
+  bool m_firstFrame = true;
+  int m_inputEnd = -1; ///< end of the real input while flushing, -1 while streaming
+  bool m_active = false;
+  bool m_eof = false;
+  int64_t m_samplesIn = 0;
+  int64_t m_samplesOut = 0;
+};
+
+} // namespace ActiveAE
@@ -63,6 +63,8 @@ enum AEQuality
   AE_QUALITY_REALLYHIGH = 100, /*! Uncompromised optional quality level,
                                usually with unmeasurable and unnoticeable improvement */
   AE_QUALITY_GPU = 101, /*! GPU acceleration */
+  AE_QUALITY_POLYPHASE = 102, /*! High quality polyphase resampler, cheaper than the ffmpeg one on
+                              many channels */
 };
 
 struct SampleConfig
@@ -75,6 +77,33 @@ struct SampleConfig
   int dither_bits;
 };
 
+/*!
+ * \brief Performance counters of the audio engine, collected since the engine was started
+ */
+struct AEPerfStats
+{
+  struct Timing
+  {
+    uint64_t count{0}; /*! number of measured runs */
+    double totalMs{0}; /*! time spent in all runs */
+    double maxMs{0}; /*! longest single run */
+  };
+
+  struct Stream
+  {
+    unsigned int id{0};
+    double bufferedTime{0}; /*! seconds of audio queued in the stream stages */
+    double resampleRatio{1.0};
+  };
+
+  uint64_t underruns{0}; /*! number of times the sink ran dry while streams were playing */
+  Timing resample; /*! resampling of the input streams */
+  Timing mix; /*! mixing of the streams and gui sounds into one output buffer */
+  Timing sinkWrite; /*! writing one buffer to the sink, including the waits for room */
+  double sinkDelay{0}; /*! seconds of audio buffered in the sink */
+  std::vector<Stream> streams;
+};
+
 /*!
  * \brief IAE Interface
  */
@@ -266,6 +295,14 @@ public:
    */
   virtual bool GetCurrentSinkFormat(AEAudioFormat &SinkFormat) { return false; }
 
+  /*!
+   * \brief Get the performance counters of the engine
+   *
+   * \param stats The counters, see AEPerfStats.
+   * \return Returns true on success, false if the engine does not collect them.
+   */
+  virtual bool GetPerfStats(AEPerfStats& stats) { return false; }
+
 private:
   friend class IAEStreamDeleter;
   friend class IAESoundDeleter;
@@ -873,7 +873,12 @@ initialize:
   }
 
   const bool isPassthrough = (format.m_dataFormat == AE_FMT_RAW);
-  const auto targetPeriod = isPassthrough ? minPassthroughPeriod : minPcmPeriod;
+  std::chrono::nanoseconds targetPeriod = isPassthrough ? minPassthroughPeriod : minPcmPeriod;
+
+  // low latency streams ask for a shorter period, down to a single device period
+  if (!isPassthrough && format.m_frames > 0)
+    targetPeriod = std::min(targetPeriod, std::chrono::nanoseconds(1'000'000'000LL * format.m_frames /
+                                                                   format.m_sampleRate));
 
   REFERENCE_TIME defaultDevicePeriodHns{};
 
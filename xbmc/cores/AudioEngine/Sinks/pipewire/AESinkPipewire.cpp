@@ -23,6 +23,7 @@
 #include <algorithm>
 
 #include <pipewire/keys.h>
+#include <spa/buffer/buffer.h>
 #include <spa/param/audio/format-utils.h>
 #include <spa/param/audio/raw.h>
 #include <spa/pod/builder.h>
@@ -241,6 +242,7 @@ std::chrono::duration<double, std::ratio<1>> PWTimeToAEDelay(const pw_time& time
 
 constexpr std::chrono::duration<double, std::ratio<1>> DEFAULT_BUFFER_DURATION = 0.100s;
 constexpr unsigned int DEFAULT_NUM_PERIODS = 2;
+constexpr unsigned int MAX_NUM_PERIODS = 8;
 
 } // namespace
 
@@ -415,9 +417,14 @@ bool CAESinkPipewire::Initialize(AEAudioFormat& format, std::string& device)
 
   uint32_t frames =
       std::nearbyint((DEFAULT_BUFFER_DURATION / DEFAULT_NUM_PERIODS).count() * format.m_sampleRate);
+
+  // low latency streams ask for a shorter quantum
+  if (!passthrough && format.m_frames > 0)
+    frames = std::min(frames, format.m_frames);
   std::string fraction = StringUtils::Format("{}/{}", frames, format.m_sampleRate);
 
   m_latency = DEFAULT_NUM_PERIODS * frames * 1.0s / format.m_sampleRate;
+  m_quantum = 0;
 
   std::string srate = StringUtils::Format("1/{}", format.m_sampleRate);
 
@@ -443,13 +450,17 @@ bool CAESinkPipewire::Initialize(AEAudioFormat& format, std::string& device)
 
   std::vector<const spa_pod*> params;
 
+  // Ask for a small pool of buffers holding exactly one quantum each, in memory shared with the
+  // server. AddPackets() copies straight into them, so there is no copy left on the way to the graph.
   // clang-format off
   uint32_t buf_minsize = frames * pwChannels.size() * PWFormatToSampleSize(pwFormat);
   params.emplace_back(static_cast<const spa_pod*>(spa_pod_builder_add_object(
       &builder, SPA_TYPE_OBJECT_ParamBuffers, SPA_PARAM_Buffers,
+          SPA_PARAM_BUFFERS_buffers, SPA_POD_CHOICE_RANGE_Int(DEFAULT_NUM_PERIODS, DEFAULT_NUM_PERIODS, MAX_NUM_PERIODS),
           SPA_PARAM_BUFFERS_blocks, SPA_POD_Int(1),
           SPA_PARAM_BUFFERS_size, SPA_POD_CHOICE_RANGE_Int(buf_minsize, buf_minsize, INT32_MAX),
-          SPA_PARAM_BUFFERS_stride, SPA_POD_Int(pwChannels.size() * PWFormatToSampleSize(pwFormat)))));
+          SPA_PARAM_BUFFERS_stride, SPA_POD_Int(pwChannels.size() * PWFormatToSampleSize(pwFormat)),
+          SPA_PARAM_BUFFERS_dataType, SPA_POD_CHOICE_FLAGS_Int((1 << SPA_DATA_MemFd) | (1 << SPA_DATA_MemPtr)))));
   // clang-format on
 
   pw_stream_flags flags = static_cast<pw_stream_flags>(
@@ -578,6 +589,15 @@ unsigned int CAESinkPipewire::AddPackets(uint8_t** data,
     unsigned int requested = buffer->requested ? buffer->requested : frames;
     unsigned int target = std::min(requested, max_frames);
 
+    // The graph may run with a different quantum than we asked for, e.g. when another client
+    // forces a larger one. Keep filling whole quanta, but let the log show it.
+    if (buffer->requested && buffer->requested != m_quantum)
+    {
+      CLog::Log(LOGDEBUG, "CAESinkPipewire::{} - quantum: {}/{} (requested {})", __FUNCTION__,
+                buffer->requested, m_format.m_sampleRate, m_format.m_frames);
+      m_quantum = buffer->requested;
+    }
+
     if (buffer->size < target)
     {
       unsigned int consume = std::min(frames, static_cast<unsigned int>(target - buffer->size));
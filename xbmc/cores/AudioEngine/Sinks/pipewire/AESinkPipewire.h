@@ -52,6 +52,7 @@ public:
 private:
   AEAudioFormat m_format;
   std::chrono::duration<double, std::ratio<1>> m_latency;
+  uint64_t m_quantum{0};
 
   std::unique_ptr<KODI::PIPEWIRE::CPipewireStream> m_stream;
 };
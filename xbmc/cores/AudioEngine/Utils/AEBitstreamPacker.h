@@ -24,10 +24,26 @@ public:
   ~CAEBitstreamPacker();
 
   void Pack(CAEStreamInfo &info, uint8_t* data, int size);
+
+  /*!
+   * @brief Pack a burst in the buffer of the stream data itself, which saves copying it
+   *
+   * Only possible for the TrueHD MAT frames, which come as complete bursts with room for the
+   * IEC 61937 header in front of the data.
+   * @return true if the data was packed, it can then be output as is
+   */
+  bool PackInPlace(CAEStreamInfo& info, uint8_t* data, int size);
+
   bool PackPause(CAEStreamInfo &info, unsigned int millis, bool iecBursts);
   void Reset();
   uint8_t* GetBuffer();
   unsigned int GetSize() const;
+
+  /*!
+   * @brief Whether the last burst carried audio or IEC pause bursts, rather than silence
+   */
+  bool HasBurst() const { return m_hasBurst; }
+
   static unsigned int GetOutputRate(const CAEStreamInfo& info);
   static CAEChannelInfo GetOutputChannelMap(const CAEStreamInfo& info);
 
@@ -46,5 +62,6 @@ private:
   unsigned int  m_dataSize = 0;
   uint8_t       m_packedBuffer[MAX_IEC61937_PACKET];
   unsigned int m_pauseDuration = 0;
+  bool m_hasBurst = false;
 };
 
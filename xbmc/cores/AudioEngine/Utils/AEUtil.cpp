@@ -14,9 +14,12 @@
 #include "utils/TimeUtils.h"
 
 #include <cassert>
+#include <cmath>
 
 #if defined(HAVE_SSE) && defined(__SSE__)
 #include <xmmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
 #endif
 
 void AEDelayStatus::SetDelay(double d)
@@ -214,105 +217,6 @@ const char* CAEUtil::DataFormatToStr(const enum AEDataFormat dataFormat)
   return formats[dataFormat];
 }
 
-#if defined(HAVE_SSE) && defined(__SSE__)
-void CAEUtil::SSEMulArray(float *data, const float mul, uint32_t count)
-{
-  const __m128 m = _mm_set_ps1(mul);
-
-  /* work around invalid alignment */
-  while (((uintptr_t)data & 0xF) && count > 0)
-  {
-    data[0] *= mul;
-    ++data;
-    --count;
-  }
-
-  uint32_t even = count & ~0x3;
-  for (uint32_t i = 0; i < even; i+=4, data+=4)
-  {
-    __m128 to      = _mm_load_ps(data);
-    *(__m128*)data = _mm_mul_ps (to, m);
-  }
-
-  if (even != count)
-  {
-    uint32_t odd = count - even;
-    if (odd == 1)
-      data[0] *= mul;
-    else
-    {
-      __m128 to;
-      if (odd == 2)
-      {
-        to = _mm_setr_ps(data[0], data[1], 0, 0);
-        __m128 ou = _mm_mul_ps(to, m);
-        data[0] = ((float*)&ou)[0];
-        data[1] = ((float*)&ou)[1];
-      }
-      else
-      {
-        to = _mm_setr_ps(data[0], data[1], data[2], 0);
-        __m128 ou = _mm_mul_ps(to, m);
-        data[0] = ((float*)&ou)[0];
-        data[1] = ((float*)&ou)[1];
-        data[2] = ((float*)&ou)[2];
-      }
-    }
-  }
-}
-
-void CAEUtil::SSEMulAddArray(float *data, float *add, const float mul, uint32_t count)
-{
-  const __m128 m = _mm_set_ps1(mul);
-
-  /* work around invalid alignment */
-  while ((((uintptr_t)data & 0xF) || ((uintptr_t)add & 0xF)) && count > 0)
-  {
-    data[0] += add[0] * mul;
-    ++add;
-    ++data;
-    --count;
-  }
-
-  uint32_t even = count & ~0x3;
-  for (uint32_t i = 0; i < even; i+=4, data+=4, add+=4)
-  {
-    __m128 ad      = _mm_load_ps(add );
-    __m128 to      = _mm_load_ps(data);
-    *(__m128*)data = _mm_add_ps (to, _mm_mul_ps(ad, m));
-  }
-
-  if (even != count)
-  {
-    uint32_t odd = count - even;
-    if (odd == 1)
-      data[0] += add[0] * mul;
-    else
-    {
-      __m128 ad;
-      __m128 to;
-      if (odd == 2)
-      {
-        ad = _mm_setr_ps(add [0], add [1], 0, 0);
-        to = _mm_setr_ps(data[0], data[1], 0, 0);
-        __m128 ou = _mm_add_ps(to, _mm_mul_ps(ad, m));
-        data[0] = ((float*)&ou)[0];
-        data[1] = ((float*)&ou)[1];
-      }
-      else
-      {
-        ad = _mm_setr_ps(add [0], add [1], add [2], 0);
-        to = _mm_setr_ps(data[0], data[1], data[2], 0);
-        __m128 ou = _mm_add_ps(to, _mm_mul_ps(ad, m));
-        data[0] = ((float*)&ou)[0];
-        data[1] = ((float*)&ou)[1];
-        data[2] = ((float*)&ou)[2];
-      }
-    }
-  }
-}
-#endif
-
 inline float CAEUtil::SoftClamp(const float x)
 {
 #if 1
@@ -348,85 +252,187 @@ inline float CAEUtil::SoftClamp(const float x)
 #endif
 }
 
-void CAEUtil::ClampArray(float *data, uint32_t count)
+namespace
 {
-#if !defined(HAVE_SSE) || !defined(__SSE__)
-  for (uint32_t i = 0; i < count; ++i)
-    data[i] = SoftClamp(data[i]);
-
+/*
+   Four float lanes of the SIMD extension the build targets. The mixing runs on unaligned
+   buffers, but unaligned loads are as fast as aligned ones on the CPUs of today, so there is no
+   need to work around the alignment anymore.
+*/
+#if defined(HAVE_SSE) && defined(__SSE__)
+#define AE_SIMD
+using Vec4 = __m128;
+inline Vec4 Load(const float* p) { return _mm_loadu_ps(p); }
+inline void Store(float* p, Vec4 v) { _mm_storeu_ps(p, v); }
+inline Vec4 Set(float f) { return _mm_set1_ps(f); }
+inline Vec4 Mul(Vec4 a, Vec4 b) { return _mm_mul_ps(a, b); }
+inline Vec4 MulAdd(Vec4 acc, Vec4 a, Vec4 b) { return _mm_add_ps(acc, _mm_mul_ps(a, b)); }
+inline Vec4 Div(Vec4 a, Vec4 b) { return _mm_div_ps(a, b); }
+inline Vec4 Min(Vec4 a, Vec4 b) { return _mm_min_ps(a, b); }
+inline Vec4 Max(Vec4 a, Vec4 b) { return _mm_max_ps(a, b); }
+inline Vec4 Abs(Vec4 a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+inline bool AnyGreater(Vec4 a, float f) { return _mm_movemask_ps(_mm_cmpgt_ps(a, Set(f))) != 0; }
+#elif defined(__ARM_NEON)
+#define AE_SIMD
+using Vec4 = float32x4_t;
+inline Vec4 Load(const float* p) { return vld1q_f32(p); }
+inline void Store(float* p, Vec4 v) { vst1q_f32(p, v); }
+inline Vec4 Set(float f) { return vdupq_n_f32(f); }
+inline Vec4 Mul(Vec4 a, Vec4 b) { return vmulq_f32(a, b); }
+inline Vec4 MulAdd(Vec4 acc, Vec4 a, Vec4 b) { return vmlaq_f32(acc, a, b); }
+inline Vec4 Div(Vec4 a, Vec4 b)
+{
+#if defined(__aarch64__)
+  return vdivq_f32(a, b);
 #else
-  const __m128 c1 = _mm_set_ps1(27.0f);
-  const __m128 c2 = _mm_set_ps1(27.0f + 9.0f);
+  // no division on 32 bit NEON, refine the reciprocal estimate twice
+  Vec4 r = vrecpeq_f32(b);
+  r = vmulq_f32(vrecpsq_f32(b, r), r);
+  r = vmulq_f32(vrecpsq_f32(b, r), r);
+  return vmulq_f32(a, r);
+#endif
+}
+inline Vec4 Min(Vec4 a, Vec4 b) { return vminq_f32(a, b); }
+inline Vec4 Max(Vec4 a, Vec4 b) { return vmaxq_f32(a, b); }
+inline Vec4 Abs(Vec4 a) { return vabsq_f32(a); }
+inline bool AnyGreater(Vec4 a, float f)
+{
+  const uint32x4_t gt = vcgtq_f32(a, Set(f));
+  const uint32x2_t folded = vorr_u32(vget_low_u32(gt), vget_high_u32(gt));
+  return (vget_lane_u32(folded, 0) | vget_lane_u32(folded, 1)) != 0;
+}
+#endif
+} // namespace
+
+void CAEUtil::MulArray(float* data, const float mul, uint32_t count)
+{
+  uint32_t i = 0;
+#if defined(AE_SIMD)
+  const Vec4 m = Set(mul);
+  for (; i + 4 <= count; i += 4)
+    Store(data + i, Mul(Load(data + i), m));
+#endif
+  for (; i < count; ++i)
+    data[i] *= mul;
+}
 
-  /* work around invalid alignment */
-  while (((uintptr_t)data & 0xF) && count > 0)
+bool CAEUtil::MulAddArray(float* data, const float* add, const float mul, uint32_t count)
+{
+  bool clip = false;
+  uint32_t i = 0;
+#if defined(AE_SIMD)
+  const Vec4 m = Set(mul);
+  Vec4 peak = Set(0.0f);
+  for (; i + 4 <= count; i += 4)
+  {
+    const Vec4 out = MulAdd(Load(data + i), Load(add + i), m);
+    Store(data + i, out);
+    peak = Max(peak, Abs(out));
+  }
+  clip = AnyGreater(peak, 1.0f);
+#endif
+  for (; i < count; ++i)
   {
-    data[0] = SoftClamp(data[0]);
-    ++data;
-    --count;
+    data[i] += add[i] * mul;
+    clip |= std::fabs(data[i]) > 1.0f;
   }
+  return clip;
+}
 
-  uint32_t even = count & ~0x3;
-  for (uint32_t i = 0; i < even; i+=4, data+=4)
+void CAEUtil::MulFramesArray(float* data, const float* gains, uint32_t frames, uint32_t channels)
+{
+  if (channels != 1)
   {
-    /* tanh approx clamp */
-    __m128 dt = _mm_load_ps(data);
-    __m128 tmp     = _mm_mul_ps(dt, dt);
-    *(__m128*)data = _mm_div_ps(
-      _mm_mul_ps(
-        dt,
-        _mm_add_ps(c1, tmp)
-      ),
-      _mm_add_ps(c2, tmp)
-    );
+    for (uint32_t f = 0; f < frames; ++f, data += channels)
+      MulArray(data, gains[f], channels);
+    return;
   }
 
-  if (even != count)
+  // planar, one gain per sample
+  uint32_t i = 0;
+#if defined(AE_SIMD)
+  for (; i + 4 <= frames; i += 4)
+    Store(data + i, Mul(Load(data + i), Load(gains + i)));
+#endif
+  for (; i < frames; ++i)
+    data[i] *= gains[i];
+}
+
+bool CAEUtil::MulAddFramesArray(
+    float* data, const float* add, const float* gains, uint32_t frames, uint32_t channels)
+{
+  bool clip = false;
+  if (channels != 1)
   {
-    uint32_t odd = count - even;
-    if (odd == 1)
-      data[0] = SoftClamp(data[0]);
-    else
-    {
-      __m128 dt;
-      __m128 tmp;
-      __m128 out;
-      if (odd == 2)
-      {
-        /* tanh approx clamp */
-        dt  = _mm_setr_ps(data[0], data[1], 0, 0);
-        tmp = _mm_mul_ps(dt, dt);
-        out = _mm_div_ps(
-          _mm_mul_ps(
-            dt,
-            _mm_add_ps(c1, tmp)
-          ),
-          _mm_add_ps(c2, tmp)
-        );
-
-        data[0] = ((float*)&out)[0];
-        data[1] = ((float*)&out)[1];
-      }
-      else
-      {
-        /* tanh approx clamp */
-        dt  = _mm_setr_ps(data[0], data[1], data[2], 0);
-        tmp = _mm_mul_ps(dt, dt);
-        out = _mm_div_ps(
-          _mm_mul_ps(
-            dt,
-            _mm_add_ps(c1, tmp)
-          ),
-          _mm_add_ps(c2, tmp)
-        );
-
-        data[0] = ((float*)&out)[0];
-        data[1] = ((float*)&out)[1];
-        data[2] = ((float*)&out)[2];
-      }
-    }
+    for (uint32_t f = 0; f < frames; ++f, data += channels, add += channels)
+      clip |= MulAddArray(data, add, gains[f], channels);
+    return clip;
+  }
+
+  // planar, one gain per sample
+  uint32_t i = 0;
+#if defined(AE_SIMD)
+  Vec4 peak = Set(0.0f);
+  for (; i + 4 <= frames; i += 4)
+  {
+    const Vec4 out = MulAdd(Load(data + i), Load(add + i), Load(gains + i));
+    Store(data + i, out);
+    peak = Max(peak, Abs(out));
+  }
+  clip = AnyGreater(peak, 1.0f);
+#endif
+  for (; i < frames; ++i)
+  {
+    data[i] += add[i] * gains[i];
+    clip |= std::fabs(data[i]) > 1.0f;
+  }
+  return clip;
+}
+
+float CAEUtil::DotProduct(const float* a, const float* b, uint32_t count)
+{
+  uint32_t i = 0;
+  float sum = 0.0f;
+#if defined(AE_SIMD)
+  // two accumulators hide the latency of the multiply-add
+  Vec4 acc0 = Set(0.0f);
+  Vec4 acc1 = Set(0.0f);
+  for (; i + 8 <= count; i += 8)
+  {
+    acc0 = MulAdd(acc0, Load(a + i), Load(b + i));
+    acc1 = MulAdd(acc1, Load(a + i + 4), Load(b + i + 4));
+  }
+  for (; i + 4 <= count; i += 4)
+    acc0 = MulAdd(acc0, Load(a + i), Load(b + i));
+
+  float lanes[4];
+  Store(lanes, MulAdd(acc0, acc1, Set(1.0f)));
+  sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#endif
+  for (; i < count; ++i)
+    sum += a[i] * b[i];
+  return sum;
+}
+
+void CAEUtil::ClampArray(float *data, uint32_t count)
+{
+  uint32_t i = 0;
+#if defined(AE_SIMD)
+  // same rational tanh approximation as SoftClamp, which reaches +-1 at +-3 and exceeds it beyond
+  const Vec4 c27 = Set(27.0f);
+  const Vec4 c9 = Set(9.0f);
+  const Vec4 one = Set(1.0f);
+  const Vec4 minusOne = Set(-1.0f);
+  for (; i + 4 <= count; i += 4)
+  {
+    const Vec4 x = Load(data + i);
+    const Vec4 y = Mul(x, x);
+    const Vec4 out = Div(Mul(x, MulAdd(c27, y, one)), MulAdd(c27, y, c9));
+    Store(data + i, Min(Max(out, minusOne), one));
   }
 #endif
+  for (; i < count; ++i)
+    data[i] = SoftClamp(data[i]);
 }
 
 bool CAEUtil::S16NeedsByteSwap(AEDataFormat in, AEDataFormat out)
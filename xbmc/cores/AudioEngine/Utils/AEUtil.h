@@ -164,10 +164,44 @@ public:
     return 20*log10(scale);
   }
 
-  #if defined(HAVE_SSE) && defined(__SSE__)
-  static void SSEMulArray     (float *data, const float mul, uint32_t count);
-  static void SSEMulAddArray  (float *data, float *add, const float mul, uint32_t count);
-  #endif
+  /*! \brief multiply samples by a gain, using SSE or NEON where available
+   \param data the samples
+   \param mul the gain
+   \param count the number of samples
+   */
+  static void MulArray(float* data, const float mul, uint32_t count);
+
+  /*! \brief mix samples scaled by a gain into others, using SSE or NEON where available
+   \param data the samples to mix into
+   \param add the samples to mix
+   \param mul the gain of the added samples
+   \param count the number of samples
+   \return true if a mixed sample exceeds full scale and the result needs clamping
+   */
+  static bool MulAddArray(float* data, const float* add, const float mul, uint32_t count);
+
+  /*! \brief multiply frames of samples by a gain per frame, e.g. a fade or the limiter gains
+   \param data the frames
+   \param gains one gain per frame
+   \param frames the number of frames
+   \param channels the number of samples per frame, 1 for planar buffers
+   */
+  static void MulFramesArray(float* data, const float* gains, uint32_t frames, uint32_t channels);
+
+  /*! \brief mix frames of samples scaled by a gain per frame into others
+   \sa MulFramesArray
+   \return true if a mixed sample exceeds full scale and the result needs clamping
+   */
+  static bool MulAddFramesArray(
+      float* data, const float* add, const float* gains, uint32_t frames, uint32_t channels);
+
+  /*! \brief sum of the products of two arrays, e.g. samples and the taps of a filter
+   \param a the first array
+   \param b the second array
+   \param count the number of elements
+   */
+  static float DotProduct(const float* a, const float* b, uint32_t count);
+
   static void ClampArray(float *data, uint32_t count);
 
   static bool S16NeedsByteSwap(AEDataFormat in, AEDataFormat out);
@@ -48,6 +48,7 @@ void CDataCacheCore::Reset()
     m_contentInfo.Reset();
   }
   m_timeInfo = {};
+  m_packetPoolInfo = {};
 }
 
 void CDataCacheCore::ResetAudioCache()
@@ -209,6 +210,20 @@ int CDataCacheCore::GetVideoQueueDataLevel()
   return m_playerVideoInfo.queueDataLevel;
 }
 
+void CDataCacheCore::SetVideoDecodeTime(float ms)
+{
+  std::unique_lock lock(m_videoPlayerSection);
+
+  m_playerVideoInfo.decodeTime = ms;
+}
+
+float CDataCacheCore::GetVideoDecodeTime()
+{
+  std::unique_lock lock(m_videoPlayerSection);
+
+  return m_playerVideoInfo.decodeTime;
+}
+
 void CDataCacheCore::SetVideoFps(float fps)
 {
   std::unique_lock lock(m_videoPlayerSection);
@@ -572,6 +587,30 @@ void CDataCacheCore::GetPlayTimes(time_t &start, int64_t &current, int64_t &min,
   max = m_timeInfo.m_timeMax;
 }
 
+void CDataCacheCore::SetDemuxPacketPoolStats(uint64_t allocations,
+                                             uint64_t poolHits,
+                                             uint64_t wrapped,
+                                             uint64_t cachedBytes)
+{
+  std::unique_lock lock(m_stateSection);
+  m_packetPoolInfo.m_allocations = allocations;
+  m_packetPoolInfo.m_poolHits = poolHits;
+  m_packetPoolInfo.m_wrapped = wrapped;
+  m_packetPoolInfo.m_cachedBytes = cachedBytes;
+}
+
+void CDataCacheCore::GetDemuxPacketPoolStats(uint64_t& allocations,
+                                             uint64_t& poolHits,
+                                             uint64_t& wrapped,
+                                             uint64_t& cachedBytes)
+{
+  std::unique_lock lock(m_stateSection);
+  allocations = m_packetPoolInfo.m_allocations;
+  poolHits = m_packetPoolInfo.m_poolHits;
+  wrapped = m_packetPoolInfo.m_wrapped;
+  cachedBytes = m_packetPoolInfo.m_cachedBytes;
+}
+
 time_t CDataCacheCore::GetStartTime()
 {
   std::unique_lock lock(m_stateSection);
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "EdlEdit.h"
+#include "FrameTimeline.h"
 #include "threads/CriticalSection.h"
 
 #include <atomic>
@@ -52,6 +53,8 @@ public:
   int GetVideoQueueLevel();
   void SetVideoQueueDataLevel(int level);
   int GetVideoQueueDataLevel();
+  void SetVideoDecodeTime(float ms);
+  float GetVideoDecodeTime();
 
   /*!
    * @brief Set if the video is interlaced in cache.
@@ -182,6 +185,19 @@ public:
   bool GetVideoRender();
   void SetPlayTimes(time_t start, int64_t current, int64_t min, int64_t max);
   void GetPlayTimes(time_t &start, int64_t &current, int64_t &min, int64_t &max);
+  void SetDemuxPacketPoolStats(uint64_t allocations,
+                               uint64_t poolHits,
+                               uint64_t wrapped,
+                               uint64_t cachedBytes);
+  void GetDemuxPacketPoolStats(uint64_t& allocations,
+                               uint64_t& poolHits,
+                               uint64_t& wrapped,
+                               uint64_t& cachedBytes);
+
+  /*!
+   * \brief Per frame timeline of the video pipeline, recorded while enabled
+   */
+  CFrameTimeline& GetFrameTimeline() { return m_frameTimeline; }
 
   /*!
    * \brief Get the start time
@@ -243,6 +259,7 @@ protected:
     int liveBitRate;
     int queueLevel;
     int queueDataLevel;
+    float decodeTime;
   } m_playerVideoInfo;
 
   CCriticalSection m_audioPlayerSection;
@@ -391,4 +408,14 @@ protected:
     int64_t m_timeMax;
     int64_t m_timeMin;
   } m_timeInfo = {};
+
+  struct SPacketPoolInfo
+  {
+    uint64_t m_allocations;
+    uint64_t m_poolHits;
+    uint64_t m_wrapped;
+    uint64_t m_cachedBytes;
+  } m_packetPoolInfo = {};
+
+  CFrameTimeline m_frameTimeline;
 };
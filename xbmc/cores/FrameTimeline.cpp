@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FrameTimeline.h"
+
+#include "cores/VideoPlayer/Interface/TimingConstants.h"
+#include "utils/Variant.h"
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+namespace
+{
+
+const char* GetStageName(FrameStage stage)
+{
+  switch (stage)
+  {
+    case FrameStage::DEMUX:
+      return "demux";
+    case FrameStage::DECODE_SUBMIT:
+      return "decode submit";
+    case FrameStage::DECODE_RETURN:
+      return "decode return";
+    case FrameStage::RENDER_QUEUE:
+      return "render queue";
+    case FrameStage::FLIP:
+      return "flip";
+    case FrameStage::SKIP:
+      return "skip";
+    case FrameStage::PRESENT:
+      return "present";
+  }
+  return "unknown";
+}
+
+constexpr int STAGE_COUNT = static_cast<int>(FrameStage::PRESENT) + 1;
+
+} // namespace
+
+void CFrameTimeline::Enable(bool enable, size_t capacity)
+{
+  std::unique_lock lock(m_section);
+
+  if (enable)
+  {
+    m_events.assign(std::max<size_t>(capacity, 1), Event{});
+    m_next = 0;
+    m_count = 0;
+  }
+  m_enabled = enable;
+}
+
+int64_t CFrameTimeline::Now()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void CFrameTimeline::Add(FrameStage stage, double pts, int64_t durationUs)
+{
+  const int64_t now = Now();
+
+  std::unique_lock lock(m_section);
+  if (m_events.empty())
+    return;
+
+  // durations are recorded when the stage completes, the event starts before that
+  m_events[m_next] = {now - durationUs, durationUs, pts, stage};
+  m_next = (m_next + 1) % m_events.size();
+  m_count++;
+}
+
+void CFrameTimeline::GetChromeTrace(CVariant& trace) const
+{
+  trace = CVariant(CVariant::VariantTypeObject);
+  trace["displayTimeUnit"] = "ms";
+  trace["traceEvents"] = CVariant(CVariant::VariantTypeArray);
+  CVariant& events = trace["traceEvents"];
+
+  // one named track per stage
+  for (int i = 0; i < STAGE_COUNT; ++i)
+  {
+    CVariant meta(CVariant::VariantTypeObject);
+    meta["name"] = "thread_name";
+    meta["ph"] = "M";
+    meta["pid"] = 1;
+    meta["tid"] = i;
+    meta["args"]["name"] = GetStageName(static_cast<FrameStage>(i));
+    events.push_back(std::move(meta));
+  }
+
+  std::unique_lock lock(m_section);
+
+  const size_t size = m_events.size();
+  const size_t count = static_cast<size_t>(std::min<uint64_t>(m_count, size));
+  size_t index = (m_next + size - count) % std::max<size_t>(size, 1);
+
+  for (size_t i = 0; i < count; ++i, index = (index + 1) % size)
+  {
+    const Event& event = m_events[index];
+
+    CVariant entry(CVariant::VariantTypeObject);
+    entry["name"] = GetStageName(event.stage);
+    entry["pid"] = 1;
+    entry["tid"] = static_cast<int>(event.stage);
+    entry["ts"] = event.timestamp;
+    if (event.duration > 0)
+    {
+      entry["ph"] = "X";
+      entry["dur"] = event.duration;
+    }
+    else
+    {
+      entry["ph"] = "i";
+      entry["s"] = "t";
+    }
+    if (event.pts != DVD_NOPTS_VALUE)
+      entry["args"]["pts"] = event.pts / DVD_TIME_BASE;
+    events.push_back(std::move(entry));
+  }
+
+  trace["otherData"]["recorded"] = m_count;
+  trace["otherData"]["dropped"] = m_count - count;
+}
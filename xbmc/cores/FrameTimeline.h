@@ -0,0 +1,88 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class CVariant;
+
+enum class FrameStage
+{
+  DEMUX, //!< video packet handed from the demuxer to the video player
+  DECODE_SUBMIT, //!< packet sent to the video decoder
+  DECODE_RETURN, //!< picture returned by the video decoder
+  RENDER_QUEUE, //!< picture queued in the render manager
+  FLIP, //!< picture selected for the next display refresh
+  SKIP, //!< queued picture skipped for being late
+  PRESENT, //!< picture rendered, with the duration of the render call
+};
+
+/*!
+ * \brief Ring buffer of per frame timestamps of the video pipeline.
+ *
+ * Disabled by default, recording then costs a single atomic load. When enabled, the stages of
+ * every frame are stored with the frame pts so stalls, judder and drops can be matched up to the
+ * stage causing them. The buffer is exported in the Chrome trace event format (chrome://tracing,
+ * Perfetto), with one track per stage.
+ */
+class CFrameTimeline
+{
+public:
+  static constexpr size_t DEFAULT_CAPACITY = 16384;
+
+  /*!
+   * \brief Start or stop recording. Starting clears previously recorded events.
+   * \param capacity number of events kept, the oldest are overwritten
+   */
+  void Enable(bool enable, size_t capacity = DEFAULT_CAPACITY);
+  bool IsEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+  /*!
+   * \brief Record a stage of a frame.
+   * \param pts presentation time of the frame in DVD_TIME_BASE units, DVD_NOPTS_VALUE if unknown
+   * \param durationUs duration of the stage in microseconds, 0 for an instant
+   */
+  void Record(FrameStage stage, double pts, int64_t durationUs = 0)
+  {
+    if (IsEnabled())
+      Add(stage, pts, durationUs);
+  }
+
+  /*!
+   * \brief Current time on the clock used for the events, in microseconds.
+   */
+  static int64_t Now();
+
+  /*!
+   * \brief Fill trace with the recorded events as a Chrome trace JSON object.
+   */
+  void GetChromeTrace(CVariant& trace) const;
+
+private:
+  struct Event
+  {
+    int64_t timestamp;
+    int64_t duration;
+    double pts;
+    FrameStage stage;
+  };
+
+  void Add(FrameStage stage, double pts, int64_t durationUs);
+
+  std::atomic_bool m_enabled{false};
+  mutable CCriticalSection m_section;
+  std::vector<Event> m_events;
+  size_t m_next{0}; //!< slot of the next event
+  uint64_t m_count{0}; //!< events recorded since enabling
+};
@@ -8,16 +8,19 @@
 
 #include "RenderBufferOpenGL.h"
 
-#include "cores/RetroPlayer/rendering/RenderContext.h"
+#include "RenderBufferPoolOpenGL.h"
+#include "utils/log.h"
 
 using namespace KODI;
 using namespace RETRO;
 
-CRenderBufferOpenGL::CRenderBufferOpenGL(GLuint pixelType,
+CRenderBufferOpenGL::CRenderBufferOpenGL(CRenderBufferPoolOpenGL& pool,
+                                         GLuint pixelType,
                                          GLuint internalFormat,
                                          GLuint pixelFormat,
                                          GLuint bpp)
-  : m_pixelType(pixelType),
+  : m_bufferPool(pool),
+    m_pixelType(pixelType),
     m_internalFormat(internalFormat),
     m_pixelFormat(pixelFormat),
     m_bpp(bpp)
@@ -26,9 +29,22 @@ CRenderBufferOpenGL::CRenderBufferOpenGL(GLuint pixelType,
 
 CRenderBufferOpenGL::~CRenderBufferOpenGL()
 {
+  DeletePixelBuffer();
   DeleteTexture();
 }
 
+void CRenderBufferOpenGL::Update()
+{
+  // Hand out the pixel buffer if it was created by a previous upload
+  uint8_t* const mappedMemory = m_mappedMemory;
+  m_memory = mappedMemory != nullptr ? mappedMemory : m_data.data();
+}
+
+uint8_t* CRenderBufferOpenGL::GetMemory()
+{
+  return m_memory != nullptr ? m_memory : m_data.data();
+}
+
 void CRenderBufferOpenGL::CreateTexture()
 {
   glGenTextures(1, &m_textureId);
@@ -62,17 +78,79 @@ bool CRenderBufferOpenGL::UploadTexture()
 
   glPixelStorei(GL_UNPACK_ROW_LENGTH, stride / m_bpp);
 
-  //! @todo This is subject to change:
-  //! We want to use PBO's instead of glTexSubImage2D!
-  //! This code has been borrowed from OpenGL ES in order
-  //! to remove GL dependencies on GLES.
-  glTexSubImage2D(m_textureTarget, 0, 0, 0, m_width, m_height, m_pixelFormat, m_pixelType,
-                  m_data.data());
+  const bool bFromPixelBuffer = m_memory != nullptr && m_memory == m_mappedMemory;
+  if (bFromPixelBuffer)
+  {
+    // The frame is already in GPU-visible memory, let the GPU copy it
+    m_bufferPool.WaitForUpload();
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pixelBuffer);
+    glTexSubImage2D(m_textureTarget, 0, 0, 0, m_width, m_height, m_pixelFormat, m_pixelType,
+                    nullptr);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    m_bufferPool.SetUploadFence(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+  }
+  else
+  {
+    glTexSubImage2D(m_textureTarget, 0, 0, 0, m_width, m_height, m_pixelFormat, m_pixelType,
+                    m_data.data());
+  }
 
   glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+  // The game client writes the next frames of this buffer into a pixel buffer
+  if (m_pixelBuffer == 0 && m_bufferPool.SupportsPixelBuffers())
+    CreatePixelBuffer();
+
   return true;
 }
 
+void CRenderBufferOpenGL::CreatePixelBuffer()
+{
+  const GLsizeiptr size = static_cast<GLsizeiptr>(GetFrameSize());
+  if (size == 0)
+    return;
+
+  // Readable too, savestates copy their video frame from the render buffer
+  const GLbitfield flags =
+      GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+  glGenBuffers(1, &m_pixelBuffer);
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pixelBuffer);
+  glBufferStorage(GL_PIXEL_UNPACK_BUFFER, size, nullptr, flags);
+  void* const mappedMemory = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, flags);
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+  if (mappedMemory == nullptr)
+  {
+    CLog::Log(LOGERROR, "RetroPlayer[RENDER]: Failed to map pixel buffer of size {}", size);
+    DeletePixelBuffer();
+    return;
+  }
+
+  m_mappedMemory = static_cast<uint8_t*>(mappedMemory);
+}
+
+void CRenderBufferOpenGL::DeletePixelBuffer()
+{
+  if (m_pixelBuffer == 0)
+    return;
+
+  m_bufferPool.WaitForUpload();
+
+  if (m_mappedMemory != nullptr)
+  {
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pixelBuffer);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    m_mappedMemory = nullptr;
+  }
+
+  glDeleteBuffers(1, &m_pixelBuffer);
+  m_pixelBuffer = 0;
+}
+
 void CRenderBufferOpenGL::DeleteTexture()
 {
   if (glIsTexture(m_textureId))
@@ -10,27 +10,44 @@
 
 #include "cores/RetroPlayer/buffers/video/RenderBufferSysMem.h"
 
+#include <atomic>
+
 #include "system_gl.h"
 
 namespace KODI
 {
 namespace RETRO
 {
-class CRenderContext;
+class CRenderBufferPoolOpenGL;
 
+/*!
+ * \brief Render buffer uploaded to an OpenGL texture
+ *
+ * When persistent buffer mappings are supported, the buffer creates a pixel
+ * buffer on its first upload. From then on the game client writes its frames
+ * straight into the mapped pixel buffer and the upload is a copy on the GPU.
+ * Otherwise the frames are uploaded from system memory.
+ */
 class CRenderBufferOpenGL : public CRenderBufferSysMem
 {
 public:
-  CRenderBufferOpenGL(GLuint pixelType, GLuint internalFormat, GLuint pixelFormat, GLuint bpp);
+  CRenderBufferOpenGL(CRenderBufferPoolOpenGL& pool,
+                      GLuint pixelType,
+                      GLuint internalFormat,
+                      GLuint pixelFormat,
+                      GLuint bpp);
   ~CRenderBufferOpenGL() override;
 
   // Implementation of IRenderBuffer via CRenderBufferSysMem
+  void Update() override;
+  uint8_t* GetMemory() override;
   bool UploadTexture() override;
 
   GLuint TextureID() const { return m_textureId; }
 
 private:
   // Construction parameters
+  CRenderBufferPoolOpenGL& m_bufferPool;
   const GLuint m_pixelType;
   const GLuint m_internalFormat;
   const GLuint m_pixelFormat;
@@ -39,8 +56,15 @@ private:
   const GLenum m_textureTarget = GL_TEXTURE_2D; //! @todo
   GLuint m_textureId = 0;
 
+  // Pixel buffer parameters
+  GLuint m_pixelBuffer = 0;
+  std::atomic<uint8_t*> m_mappedMemory{nullptr}; // Set on the rendering thread
+  uint8_t* m_memory = nullptr; // Memory handed to the game client for the current frame
+
   void CreateTexture();
   void DeleteTexture();
+  void CreatePixelBuffer();
+  void DeletePixelBuffer();
 };
 } // namespace RETRO
 } // namespace KODI
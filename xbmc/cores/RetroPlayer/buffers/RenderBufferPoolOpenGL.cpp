@@ -13,10 +13,21 @@
 #include "cores/RetroPlayer/rendering/RenderVideoSettings.h"
 #include "cores/RetroPlayer/rendering/VideoRenderers/RPRendererOpenGL.h"
 #include "utils/GLUtils.h"
+#include "utils/log.h"
 
 using namespace KODI;
 using namespace RETRO;
 
+CRenderBufferPoolOpenGL::CRenderBufferPoolOpenGL(CRenderContext& context) : m_context(context)
+{
+}
+
+CRenderBufferPoolOpenGL::~CRenderBufferPoolOpenGL()
+{
+  if (m_uploadFence != nullptr)
+    glDeleteSync(m_uploadFence);
+}
+
 bool CRenderBufferPoolOpenGL::IsCompatible(const CRenderVideoSettings& renderSettings) const
 {
   return CRPRendererOpenGL::SupportsScalingMethod(renderSettings.GetScalingMethod());
@@ -24,7 +35,38 @@ bool CRenderBufferPoolOpenGL::IsCompatible(const CRenderVideoSettings& renderSet
 
 IRenderBuffer* CRenderBufferPoolOpenGL::CreateRenderBuffer(void* header /* = nullptr */)
 {
-  return new CRenderBufferOpenGL(m_pixelType, m_internalFormat, m_pixelFormat, m_bpp);
+  return new CRenderBufferOpenGL(*this, m_pixelType, m_internalFormat, m_pixelFormat, m_bpp);
+}
+
+bool CRenderBufferPoolOpenGL::SupportsPixelBuffers()
+{
+  if (m_pixelBuffersSupported < 0)
+    m_pixelBuffersSupported = m_context.IsExtSupported("GL_ARB_buffer_storage") ? 1 : 0;
+
+  return m_pixelBuffersSupported != 0;
+}
+
+void CRenderBufferPoolOpenGL::WaitForUpload()
+{
+  if (m_uploadFence == nullptr)
+    return;
+
+  // Usually signaled long ago, the upload was queued a frame earlier
+  constexpr GLuint64 UPLOAD_TIMEOUT_NS = 100 * 1000 * 1000;
+  if (glClientWaitSync(m_uploadFence, GL_SYNC_FLUSH_COMMANDS_BIT, UPLOAD_TIMEOUT_NS) ==
+      GL_TIMEOUT_EXPIRED)
+    CLog::Log(LOGWARNING, "RetroPlayer[RENDER]: Timed out waiting for pixel buffer upload");
+
+  glDeleteSync(m_uploadFence);
+  m_uploadFence = nullptr;
+}
+
+void CRenderBufferPoolOpenGL::SetUploadFence(GLsync fence)
+{
+  if (m_uploadFence != nullptr)
+    glDeleteSync(m_uploadFence);
+
+  m_uploadFence = fence;
 }
 
 bool CRenderBufferPoolOpenGL::ConfigureInternal()
@@ -23,23 +23,55 @@ class CRenderVideoSettings;
 class CRenderBufferPoolOpenGL : public CBaseRenderBufferPool
 {
 public:
-  CRenderBufferPoolOpenGL() = default;
-  ~CRenderBufferPoolOpenGL() override = default;
+  explicit CRenderBufferPoolOpenGL(CRenderContext& context);
+  ~CRenderBufferPoolOpenGL() override;
 
   // Implementation of IRenderBufferPool via CBaseRenderBufferPool
   bool IsCompatible(const CRenderVideoSettings& renderSettings) const override;
 
+  /*!
+   * \brief Check if render buffers can be persistently mapped pixel buffers
+   *
+   * Must be called on the rendering thread.
+   */
+  bool SupportsPixelBuffers();
+
+  /*!
+   * \brief Wait until the GPU finished copying the last uploaded pixel buffer
+   *
+   * A buffer is only returned to the pool after the renderers moved on to a
+   * newer frame, the upload of which waits here first. So the game client is
+   * never handed a pixel buffer the GPU is still reading from. Must be called
+   * on the rendering thread.
+   */
+  void WaitForUpload();
+
+  /*!
+   * \brief Set the fence of the pixel buffer that was just uploaded
+   *
+   * The pool takes ownership of the fence. Must be called on the rendering
+   * thread.
+   */
+  void SetUploadFence(GLsync fence);
+
 protected:
   // Implementation of CBaseRenderBufferPool
   IRenderBuffer* CreateRenderBuffer(void* header = nullptr) override;
   bool ConfigureInternal() override;
 
 private:
+  // Construction parameters
+  CRenderContext& m_context;
+
   // Configuration parameters
   GLuint m_pixelType = 0;
   GLuint m_internalFormat = 0;
   GLuint m_pixelFormat = 0;
   GLuint m_bpp = 0;
+
+  // Rendering parameters
+  int m_pixelBuffersSupported = -1; // Unknown until queried on the rendering thread
+  GLsync m_uploadFence = nullptr;
 };
 } // namespace RETRO
 } // namespace KODI
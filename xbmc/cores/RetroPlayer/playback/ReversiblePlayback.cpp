@@ -16,7 +16,7 @@
 #include "cores/RetroPlayer/rendering/RPRenderManager.h"
 #include "cores/RetroPlayer/savestates/ISavestate.h"
 #include "cores/RetroPlayer/savestates/SavestateDatabase.h"
-#include "cores/RetroPlayer/streams/memory/DeltaPairMemoryStream.h"
+#include "cores/RetroPlayer/streams/memory/CompressedDeltaMemoryStream.h"
 #include "filesystem/File.h"
 #include "games/GameServices.h"
 #include "games/GameSettings.h"
@@ -33,6 +33,8 @@ using namespace KODI;
 using namespace RETRO;
 
 #define REWIND_FACTOR 0.25 // Rewind at 25% of gameplay speed
+#define REWIND_MAX_MEMORY (256 * 1024 * 1024) // Memory for the rewind history, in bytes
+#define SAVESTATE_POOL_SIZE 2 // Snapshot buffers kept for the next savestates
 
 CReversiblePlayback::CReversiblePlayback(GAME::CGameClient* gameClient,
                                          CRPRenderManager& renderManager,
@@ -48,6 +50,7 @@ CReversiblePlayback::CReversiblePlayback(GAME::CGameClient* gameClient,
     m_savestateDatabase(new CSavestateDatabase)
 {
   UpdateMemoryStream();
+  UpdateRunAhead();
 
   GAME::CGameSettings& gameSettings = CServiceBroker::GetGameServices().GameSettings();
   gameSettings.RegisterObserver(this);
@@ -142,6 +145,15 @@ std::string CReversiblePlayback::CreateSavestate(bool autosave,
   // Record the frame count
   const uint64_t timestampFrames = m_totalFrameCount;
 
+  // Snapshot the memory now, the savestate is built and written on a worker
+  std::vector<uint8_t> memory = AcquireSnapshotBuffer();
+  memory.resize(memorySize);
+  if (!SnapshotMemory(memory))
+  {
+    ReleaseSnapshotBuffer(std::move(memory));
+    return "";
+  }
+
   // Get the savestate path
   std::string savePath(savestatePath);
   {
@@ -179,9 +191,13 @@ std::string CReversiblePlayback::CreateSavestate(bool autosave,
                              m_savestateThreads.end());
 
     // Save async to not block game loop
-    std::future<void> task =
-        std::async(std::launch::async, [this, autosave, savePath, nowUTC, timestampFrames]()
-                   { CommitSavestate(autosave, savePath, nowUTC, timestampFrames); });
+    std::future<void> task = std::async(
+        std::launch::async,
+        [this, autosave, savePath, nowUTC, timestampFrames, memory = std::move(memory)]() mutable
+        {
+          CommitSavestate(autosave, savePath, nowUTC, timestampFrames, memory);
+          ReleaseSnapshotBuffer(std::move(memory));
+        });
 
     m_savestateThreads.emplace_back(std::move(task));
   }
@@ -189,32 +205,31 @@ std::string CReversiblePlayback::CreateSavestate(bool autosave,
   return savePath;
 }
 
-void CReversiblePlayback::CommitSavestate(bool autosave,
-                                          const std::string& savePath,
-                                          const CDateTime& nowUTC,
-                                          uint64_t timestampFrames)
+bool CReversiblePlayback::SnapshotMemory(std::vector<uint8_t>& memory)
 {
-  std::unique_ptr<ISavestate> savestate = CSavestateDatabase::AllocateSavestate();
-  std::unique_ptr<ISavestate> loadedSavestate;
-
-  const size_t memorySize = m_gameClient->SerializeSize();
-  uint8_t* const memoryData = savestate->GetMemoryBuffer(memorySize);
-
-  // Copy the savestate memory
   {
     std::unique_lock lock(m_mutex);
     if (m_memoryStream && m_memoryStream->CurrentFrame() != nullptr)
     {
-      std::memcpy(memoryData, m_memoryStream->CurrentFrame(), memorySize);
-    }
-    else
-    {
-      lock.unlock();
-      if (!m_gameClient->Serialize(memoryData, memorySize))
-        return;
+      std::memcpy(memory.data(), m_memoryStream->CurrentFrame(), memory.size());
+      return true;
     }
   }
 
+  return m_gameClient->Serialize(memory.data(), memory.size());
+}
+
+void CReversiblePlayback::CommitSavestate(bool autosave,
+                                          const std::string& savePath,
+                                          const CDateTime& nowUTC,
+                                          uint64_t timestampFrames,
+                                          const std::vector<uint8_t>& memory)
+{
+  std::unique_ptr<ISavestate> savestate = CSavestateDatabase::AllocateSavestate();
+  std::unique_ptr<ISavestate> loadedSavestate;
+
+  std::memcpy(savestate->GetMemoryBuffer(memory.size()), memory.data(), memory.size());
+
   // Attempt to get existing properties
   {
     std::unique_lock lock(m_savestateMutex);
@@ -246,6 +261,7 @@ void CReversiblePlayback::CommitSavestate(bool autosave,
 
   m_renderManager.SaveVideoFrame(savePath, *savestate);
 
+  // Compresses the memory
   savestate->Finalize();
 
   bool success;
@@ -264,6 +280,26 @@ void CReversiblePlayback::CommitSavestate(bool autosave,
   m_guiMessenger.RefreshSavestates(savePath, savestate.get());
 }
 
+std::vector<uint8_t> CReversiblePlayback::AcquireSnapshotBuffer()
+{
+  std::unique_lock lock(m_savestateMutex);
+
+  if (m_snapshotPool.empty())
+    return {};
+
+  std::vector<uint8_t> buffer = std::move(m_snapshotPool.back());
+  m_snapshotPool.pop_back();
+  return buffer;
+}
+
+void CReversiblePlayback::ReleaseSnapshotBuffer(std::vector<uint8_t> buffer)
+{
+  std::unique_lock lock(m_savestateMutex);
+
+  if (m_snapshotPool.size() < SAVESTATE_POOL_SIZE)
+    m_snapshotPool.emplace_back(std::move(buffer));
+}
+
 bool CReversiblePlayback::LoadSavestate(const std::string& savestatePath)
 {
   const size_t memorySize = m_gameClient->SerializeSize();
@@ -311,9 +347,19 @@ bool CReversiblePlayback::LoadSavestate(const std::string& savestatePath)
 
 void CReversiblePlayback::FrameEvent()
 {
-  m_gameClient->RunFrame();
+  const unsigned int runAheadFrames = m_runAheadFrames;
+  if (runAheadFrames == 0)
+  {
+    m_gameClient->RunFrame();
+    AddFrame();
+    return;
+  }
 
+  // Play the sound of this frame, its picture is the one of the last frame ahead
+  m_gameClient->RunFrame(GAME::FRAME_OUTPUT::AUDIO);
   AddFrame();
+
+  RunAhead(runAheadFrames);
 }
 
 void CReversiblePlayback::RewindEvent()
@@ -344,6 +390,37 @@ void CReversiblePlayback::AddFrame()
   m_totalFrameCount++;
 }
 
+void CReversiblePlayback::RunAhead(unsigned int frames)
+{
+  // Keep the state of the frame that was just played, the rewind history
+  // already holds it
+  m_runAheadState.resize(m_gameClient->SerializeSize());
+  bool bHasState = false;
+  {
+    std::unique_lock lock(m_mutex);
+    if (m_memoryStream && m_memoryStream->CurrentFrame() != nullptr)
+    {
+      std::memcpy(m_runAheadState.data(), m_memoryStream->CurrentFrame(),
+                  m_runAheadState.size());
+      bHasState = true;
+    }
+  }
+
+  if (!bHasState && !m_gameClient->Serialize(m_runAheadState.data(), m_runAheadState.size()))
+  {
+    CLog::Log(LOGERROR, "RetroPlayer: Failed to serialize state, disabling run-ahead");
+    m_runAheadFrames = 0;
+    return;
+  }
+
+  // Emulate the frames ahead with the same input, only the last one is shown
+  for (unsigned int frame = 1; frame <= frames; frame++)
+    m_gameClient->RunFrame(frame == frames ? GAME::FRAME_OUTPUT::VIDEO : GAME::FRAME_OUTPUT::NONE);
+
+  // Roll back to the played frame
+  m_gameClient->Deserialize(m_runAheadState.data(), m_runAheadState.size());
+}
+
 void CReversiblePlayback::RewindFrames(uint64_t frames)
 {
   std::unique_lock lock(m_mutex);
@@ -392,6 +469,7 @@ void CReversiblePlayback::Notify(const Observable& obs, const ObservableMessage
   {
     case ObservableMessageSettingsChanged:
       UpdateMemoryStream();
+      UpdateRunAhead();
       break;
     default:
       break;
@@ -419,7 +497,7 @@ void CReversiblePlayback::UpdateMemoryStream()
 
     if (!m_memoryStream)
     {
-      m_memoryStream = std::make_unique<CDeltaPairMemoryStream>();
+      m_memoryStream = std::make_unique<CCompressedDeltaMemoryStream>(REWIND_MAX_MEMORY);
       m_memoryStream->Init(m_gameClient->SerializeSize(), frameCount);
     }
 
@@ -440,3 +518,15 @@ void CReversiblePlayback::UpdateMemoryStream()
     m_cacheTimeMs = 0;
   }
 }
+
+void CReversiblePlayback::UpdateRunAhead()
+{
+  unsigned int runAheadFrames = 0;
+
+  GAME::CGameSettings& gameSettings = CServiceBroker::GetGameServices().GameSettings();
+
+  if (m_gameClient->SerializeSize() > 0)
+    runAheadFrames = gameSettings.RunAheadFrames();
+
+  m_runAheadFrames = runAheadFrames;
+}
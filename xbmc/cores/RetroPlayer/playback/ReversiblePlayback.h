@@ -13,6 +13,7 @@
 #include "threads/CriticalSection.h"
 #include "utils/Observer.h"
 
+#include <atomic>
 #include <future>
 #include <memory>
 #include <stddef.h>
@@ -72,14 +73,20 @@ public:
 
 private:
   void AddFrame();
+  void RunAhead(unsigned int frames);
   void RewindFrames(uint64_t frames);
   void AdvanceFrames(uint64_t frames);
   void UpdatePlaybackStats();
   void UpdateMemoryStream();
+  void UpdateRunAhead();
+  bool SnapshotMemory(std::vector<uint8_t>& memory);
   void CommitSavestate(bool autosave,
                        const std::string& savePath,
                        const CDateTime& nowUTC,
-                       uint64_t timestampFrames);
+                       uint64_t timestampFrames,
+                       const std::vector<uint8_t>& memory);
+  std::vector<uint8_t> AcquireSnapshotBuffer();
+  void ReleaseSnapshotBuffer(std::vector<uint8_t> buffer);
 
   // Construction parameter
   GAME::CGameClient* const m_gameClient;
@@ -92,11 +99,16 @@ private:
   std::unique_ptr<IMemoryStream> m_memoryStream;
   CCriticalSection m_mutex;
 
+  // Run-ahead functionality
+  std::atomic<unsigned int> m_runAheadFrames{0};
+  std::vector<uint8_t> m_runAheadState; // Accessed by the game loop only
+
   // Savestate functionality
   std::unique_ptr<CSavestateDatabase> m_savestateDatabase;
   std::string m_autosavePath{};
   std::vector<std::future<void>> m_savestateThreads;
   CCriticalSection m_savestateMutex;
+  std::vector<std::vector<uint8_t>> m_snapshotPool; // Guarded by m_savestateMutex
 
   // Playback stats
   uint64_t m_totalFrameCount = 0;
@@ -15,12 +15,15 @@
 
 #include <memory>
 
+#include <lzo/lzo1x.h>
+#include <lzo/lzoconf.h>
+
 using namespace KODI;
 using namespace RETRO;
 
 namespace
 {
-const uint8_t SCHEMA_VERSION = 3;
+const uint8_t SCHEMA_VERSION = 5;
 const uint8_t SCHEMA_MIN_VERSION = 1;
 
 /*!
@@ -31,6 +34,31 @@ const uint8_t SCHEMA_MIN_VERSION = 1;
  */
 const size_t INITIAL_FLATBUFFER_SIZE = 1024;
 
+/*!
+ * \brief Compress the savestate memory with LZO1X-1
+ *
+ * \return The compressed memory, or empty if the memory doesn't compress
+ */
+std::vector<uint8_t> CompressMemory(const std::vector<uint8_t>& memory)
+{
+  static const bool lzoInitialized = lzo_init() == LZO_E_OK;
+  if (!lzoInitialized || memory.empty())
+    return {};
+
+  std::vector<uint8_t> workMemory(LZO1X_1_MEM_COMPRESS);
+
+  // Worst case expansion of LZO1X
+  std::vector<uint8_t> compressed(memory.size() + memory.size() / 16 + 64 + 3);
+  lzo_uint size = compressed.size();
+  if (lzo1x_1_compress(memory.data(), memory.size(), compressed.data(), &size,
+                       workMemory.data()) != LZO_E_OK ||
+      size >= memory.size())
+    return {};
+
+  compressed.resize(size);
+  return compressed;
+}
+
 /*!
  * \brief Translate the save type (RetroPlayer to FlatBuffers)
  */
@@ -196,6 +224,7 @@ void CSavestateFlatBuffer::Reset()
 {
   m_builder = std::make_unique<flatbuffers::FlatBufferBuilder>(INITIAL_FLATBUFFER_SIZE);
   m_data.clear();
+  m_memory.clear();
   m_savestate = nullptr;
 }
 
@@ -515,6 +544,9 @@ void CSavestateFlatBuffer::SetRotationDegCCW(unsigned int rotationCCW)
 
 const uint8_t* CSavestateFlatBuffer::GetMemoryData() const
 {
+  if (!m_memory.empty())
+    return m_memory.data();
+
   if (m_savestate != nullptr && m_savestate->memory_data())
     return m_savestate->memory_data()->data();
 
@@ -523,6 +555,9 @@ const uint8_t* CSavestateFlatBuffer::GetMemoryData() const
 
 size_t CSavestateFlatBuffer::GetMemorySize() const
 {
+  if (!m_memory.empty())
+    return m_memory.size();
+
   if (m_savestate != nullptr && m_savestate->memory_data())
     return m_savestate->memory_data()->size();
 
@@ -531,16 +566,26 @@ size_t CSavestateFlatBuffer::GetMemorySize() const
 
 uint8_t* CSavestateFlatBuffer::GetMemoryBuffer(size_t size)
 {
-  uint8_t* memoryBuffer = nullptr;
-
-  m_memoryDataOffset =
-      std::make_unique<VectorOffset>(m_builder->CreateUninitializedVector(size, &memoryBuffer));
+  m_memory.resize(size);
 
-  return memoryBuffer;
+  return m_memory.data();
 }
 
 void CSavestateFlatBuffer::Finalize()
 {
+  // Compress the memory, keep it uncompressed if that doesn't make it smaller
+  bool memoryCompressed = false;
+  std::unique_ptr<VectorOffset> memoryDataOffset;
+  if (!m_memory.empty())
+  {
+    const std::vector<uint8_t> compressed = CompressMemory(m_memory);
+    memoryCompressed = !compressed.empty();
+
+    const std::vector<uint8_t>& memoryData = memoryCompressed ? compressed : m_memory;
+    memoryDataOffset = std::make_unique<VectorOffset>(
+        m_builder->CreateVector(memoryData.data(), memoryData.size()));
+  }
+
   // Helper class to build the nested Savestate table
   SAVESTATE::SavestateBuilder savestateBuilder(*m_builder);
 
@@ -618,10 +663,20 @@ void CSavestateFlatBuffer::Finalize()
 
   savestateBuilder.add_rotation_ccw(TranslateRotation(m_rotationCCW));
 
-  if (m_memoryDataOffset)
+  if (memoryDataOffset)
   {
-    savestateBuilder.add_memory_data(*m_memoryDataOffset);
-    m_memoryDataOffset.reset();
+    savestateBuilder.add_memory_data(*memoryDataOffset);
+
+    if (memoryCompressed)
+    {
+      savestateBuilder.add_memory_compression(SAVESTATE::MemoryCompression_LZO1X);
+      savestateBuilder.add_memory_size(m_memory.size());
+    }
+    else
+    {
+      // The memory is read from the FlatBuffer
+      m_memory.clear();
+    }
   }
 
   auto savestate = savestateBuilder.Finish();
@@ -643,9 +698,30 @@ bool CSavestateFlatBuffer::Deserialize(std::vector<uint8_t> data)
                 "RetroPlayer[SAVE): Schema version {} not supported, must be at least version {}",
                 savestate->version(), SCHEMA_MIN_VERSION);
     }
+    else if (savestate->memory_compression() == SAVESTATE::MemoryCompression_LZO1X)
+    {
+      std::vector<uint8_t> memory(savestate->memory_size());
+
+      lzo_uint size = memory.size();
+      if (savestate->memory_data() == nullptr || memory.empty() ||
+          lzo1x_decompress_safe(savestate->memory_data()->data(), savestate->memory_data()->size(),
+                                memory.data(), &size, nullptr) != LZO_E_OK ||
+          size != memory.size())
+      {
+        CLog::Log(LOGERROR, "RetroPlayer[SAVE]: Failed to decompress savestate memory");
+      }
+      else
+      {
+        m_data = std::move(data);
+        m_memory = std::move(memory);
+        m_savestate = SAVESTATE::GetSavestate(m_data.data());
+        return true;
+      }
+    }
     else
     {
       m_data = std::move(data);
+      m_memory.clear();
       m_savestate = SAVESTATE::GetSavestate(m_data.data());
       return true;
     }
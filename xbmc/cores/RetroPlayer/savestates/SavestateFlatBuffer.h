@@ -11,6 +11,7 @@
 #include "ISavestate.h"
 
 #include <memory>
+#include <vector>
 
 #include <flatbuffers/flatbuffers.h>
 
@@ -96,6 +97,14 @@ private:
    */
   std::vector<uint8_t> m_data;
 
+  /*!
+   * \brief Uncompressed memory of the savestate
+   *
+   * Filled by the caller before the memory is compressed in Finalize(), or
+   * when a savestate with compressed memory is deserialized.
+   */
+  std::vector<uint8_t> m_memory;
+
   /*!
    * \brief FlatBuffer struct used for accessing data
    */
@@ -126,7 +135,6 @@ private:
   unsigned int m_videoHeight{0};
   float m_displayAspectRatio{0.0f};
   unsigned int m_rotationCCW{0};
-  std::unique_ptr<VectorOffset> m_memoryDataOffset;
 };
 } // namespace RETRO
 } // namespace KODI
@@ -0,0 +1,107 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ShaderBinaryCache.h"
+
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "utils/Digest.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <cstring>
+
+using namespace KODI;
+using namespace SHADER;
+
+namespace
+{
+constexpr auto CACHE_PATH = "special://temp/retroplayer/shadercache/";
+
+// Identifies the file layout: magic, binary format, binary
+constexpr char CACHE_MAGIC[4] = {'K', 'S', 'B', '1'};
+constexpr size_t HEADER_SIZE = sizeof(CACHE_MAGIC) + sizeof(uint32_t);
+
+std::string GetPath(const std::string& key)
+{
+  return URIUtils::AddFileToFolder(CACHE_PATH, key + ".bin");
+}
+} // namespace
+
+std::string CShaderBinaryCache::GetKey(const std::string& driver,
+                                       const std::string& vertexSource,
+                                       const std::string& fragmentSource)
+{
+  UTILITY::CDigest digest(UTILITY::CDigest::Type::SHA256);
+
+  // Include the terminators, so moving text between the parts changes the key
+  for (const std::string* part : {&driver, &vertexSource, &fragmentSource})
+    digest.Update(part->c_str(), part->size() + 1);
+
+  return digest.Finalize();
+}
+
+bool CShaderBinaryCache::Load(const std::string& key,
+                              uint32_t& format,
+                              std::vector<uint8_t>& binary)
+{
+  const std::string path = GetPath(key);
+  if (!XFILE::CFile::Exists(path))
+    return false;
+
+  std::vector<uint8_t> data;
+  XFILE::CFile file;
+  if (file.LoadFile(path, data) <= static_cast<ssize_t>(HEADER_SIZE) ||
+      std::memcmp(data.data(), CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0)
+  {
+    CLog::Log(LOGDEBUG, "CShaderBinaryCache: Ignoring invalid program binary {}", path);
+    return false;
+  }
+
+  std::memcpy(&format, data.data() + sizeof(CACHE_MAGIC), sizeof(format));
+  binary.assign(data.begin() + HEADER_SIZE, data.end());
+
+  return true;
+}
+
+void CShaderBinaryCache::Save(const std::string& key,
+                              uint32_t format,
+                              const std::vector<uint8_t>& binary)
+{
+  if (binary.empty())
+    return;
+
+  if (!XFILE::CDirectory::Exists(CACHE_PATH) && !XFILE::CDirectory::Create(CACHE_PATH))
+  {
+    CLog::Log(LOGERROR, "CShaderBinaryCache: Failed to create {}", CACHE_PATH);
+    return;
+  }
+
+  std::vector<uint8_t> data(HEADER_SIZE);
+  std::memcpy(data.data(), CACHE_MAGIC, sizeof(CACHE_MAGIC));
+  std::memcpy(data.data() + sizeof(CACHE_MAGIC), &format, sizeof(format));
+  data.insert(data.end(), binary.begin(), binary.end());
+
+  const std::string path = GetPath(key);
+
+  XFILE::CFile file;
+  if (!file.OpenForWrite(path, true) ||
+      file.Write(data.data(), data.size()) != static_cast<ssize_t>(data.size()))
+  {
+    CLog::Log(LOGERROR, "CShaderBinaryCache: Failed to write program binary {}", path);
+    file.Close();
+    XFILE::CFile::Delete(path);
+  }
+}
+
+void CShaderBinaryCache::Remove(const std::string& key)
+{
+  const std::string path = GetPath(key);
+  if (XFILE::CFile::Exists(path))
+    XFILE::CFile::Delete(path);
+}
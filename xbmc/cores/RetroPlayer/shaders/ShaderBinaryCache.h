@@ -0,0 +1,62 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace KODI::SHADER
+{
+/*!
+ * \brief Cache of compiled shader programs, kept on disk between runs
+ *
+ * Multi-pass presets compile every pass on each game start, which can take
+ * seconds on mobile GPUs. The renderers store the program binaries returned by
+ * the driver here and try them before compiling the sources again.
+ *
+ * A program is keyed on the driver and on the sources of its shaders, so a
+ * changed pass or a driver update simply misses the cache.
+ */
+class CShaderBinaryCache
+{
+public:
+  /*!
+   * \brief Get the key of a program
+   *
+   * \param driver Vendor, renderer and version of the driver
+   * \param vertexSource The complete source of the vertex shader
+   * \param fragmentSource The complete source of the fragment shader
+   */
+  static std::string GetKey(const std::string& driver,
+                            const std::string& vertexSource,
+                            const std::string& fragmentSource);
+
+  /*!
+   * \brief Load a program binary
+   *
+   * \param key The key of the program
+   * \param[out] format The driver specific format of the binary
+   * \param[out] binary The binary
+   *
+   * \return True if the program is in the cache, false otherwise
+   */
+  static bool Load(const std::string& key, uint32_t& format, std::vector<uint8_t>& binary);
+
+  /*!
+   * \brief Store a program binary, replacing the one with the same key
+   */
+  static void Save(const std::string& key, uint32_t format, const std::vector<uint8_t>& binary);
+
+  /*!
+   * \brief Remove a program binary the driver failed to load
+   */
+  static void Remove(const std::string& key);
+};
+} // namespace KODI::SHADER
@@ -59,6 +59,59 @@ bool CShaderGL::Create(unsigned int passIdx,
   const GLchar* vertexShaderSource = vertexShaderSourceStr.c_str();
   const GLchar* fragmentShaderSource = fragmentShaderSourceStr.c_str();
 
+  // Skip compiling if the driver takes the program binary of a previous run
+  const std::string programKey =
+      CShaderUtilsGL::GetProgramKey(vertexShaderSourceStr, fragmentShaderSourceStr);
+  if (!CShaderUtilsGL::LoadProgramBinary(m_shaderProgram, programKey))
+  {
+    if (!LinkProgram(vertexShaderSource, fragmentShaderSource))
+      return false;
+
+    CShaderUtilsGL::SaveProgramBinary(m_shaderProgram, programKey);
+  }
+
+  glUseProgram(m_shaderProgram);
+
+  GetUniformLocs();
+
+  GLint paramLoc = glGetUniformLocation(m_shaderProgram, "Texture");
+  glUniform1i(paramLoc, 0);
+
+  const GLubyte idx[4] = {0, 1, 3, 2}; // Determines order of triangle strip
+
+  // Set up VAO/VBO
+  glGenVertexArrays(1, &m_shaderVAO);
+  glBindVertexArray(m_shaderVAO);
+
+  glGenBuffers(3, m_shaderVertexVBO.data());
+  glBindBuffer(GL_ARRAY_BUFFER, m_shaderVertexVBO[0]);
+
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), nullptr);
+  glEnableVertexAttribArray(0);
+
+  glBindBuffer(GL_ARRAY_BUFFER, m_shaderVertexVBO[1]);
+
+  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), nullptr);
+  glEnableVertexAttribArray(1);
+
+  glBindBuffer(GL_ARRAY_BUFFER, m_shaderVertexVBO[2]);
+
+  glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr);
+  glEnableVertexAttribArray(2);
+
+  glGenBuffers(1, &m_shaderIndexVBO);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_shaderIndexVBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLubyte) * 4, idx, GL_STATIC_DRAW);
+
+  glBindVertexArray(0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  glUseProgram(0);
+  return true;
+}
+
+bool CShaderGL::LinkProgram(const GLchar* vertexShaderSource, const GLchar* fragmentShaderSource)
+{
   GLint status;
   GLuint vShader;
   GLuint fShader;
@@ -100,6 +153,8 @@ bool CShaderGL::Create(unsigned int passIdx,
   glBindAttribLocation(m_shaderProgram, 1, "COLOR");
   glBindAttribLocation(m_shaderProgram, 2, "TexCoord");
 
+  // Allow storing the program in the shader binary cache
+  glProgramParameteri(m_shaderProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
   glLinkProgram(m_shaderProgram);
 
   glDeleteShader(vShader);
@@ -119,43 +174,6 @@ bool CShaderGL::Create(unsigned int passIdx,
     return false;
   }
 
-  glUseProgram(m_shaderProgram);
-
-  GetUniformLocs();
-
-  GLint paramLoc = glGetUniformLocation(m_shaderProgram, "Texture");
-  glUniform1i(paramLoc, 0);
-
-  const GLubyte idx[4] = {0, 1, 3, 2}; // Determines order of triangle strip
-
-  // Set up VAO/VBO
-  glGenVertexArrays(1, &m_shaderVAO);
-  glBindVertexArray(m_shaderVAO);
-
-  glGenBuffers(3, m_shaderVertexVBO.data());
-  glBindBuffer(GL_ARRAY_BUFFER, m_shaderVertexVBO[0]);
-
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), nullptr);
-  glEnableVertexAttribArray(0);
-
-  glBindBuffer(GL_ARRAY_BUFFER, m_shaderVertexVBO[1]);
-
-  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), nullptr);
-  glEnableVertexAttribArray(1);
-
-  glBindBuffer(GL_ARRAY_BUFFER, m_shaderVertexVBO[2]);
-
-  glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr);
-  glEnableVertexAttribArray(2);
-
-  glGenBuffers(1, &m_shaderIndexVBO);
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_shaderIndexVBO);
-  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLubyte) * 4, idx, GL_STATIC_DRAW);
-
-  glBindVertexArray(0);
-  glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-  glUseProgram(0);
   return true;
 }
 
@@ -76,6 +76,7 @@ private:
   UniformInputs GetInputData(uint64_t frameCount = 0) const;
   UniformFrameInputs GetFrameInputData(GLuint texture) const;
   UniformFrameInputs GetFrameUniformInputs() const { return m_uniformFrameInputs; }
+  bool LinkProgram(const GLchar* vertexShaderSource, const GLchar* fragmentShaderSource);
   void GetUniformLocs();
   void SetShaderParameters(IShaderTexture& sourceTexture);
 
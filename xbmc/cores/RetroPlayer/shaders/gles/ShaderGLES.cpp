@@ -59,6 +59,41 @@ bool CShaderGLES::Create(unsigned int passIdx,
   const GLchar* vertexShaderSource = vertexShaderSourceStr.c_str();
   const GLchar* fragmentShaderSource = fragmentShaderSourceStr.c_str();
 
+  // Skip compiling if the driver takes the program binary of a previous run
+  const std::string programKey =
+      CShaderUtilsGLES::GetProgramKey(vertexShaderSourceStr, fragmentShaderSourceStr);
+  if (!CShaderUtilsGLES::LoadProgramBinary(m_shaderProgram, programKey))
+  {
+    if (!LinkProgram(vertexShaderSource, fragmentShaderSource))
+      return false;
+
+    CShaderUtilsGLES::SaveProgramBinary(m_shaderProgram, programKey);
+  }
+
+  glUseProgram(m_shaderProgram);
+
+  GetUniformLocs();
+
+  GLint paramLoc = glGetUniformLocation(m_shaderProgram, "Texture");
+  glUniform1i(paramLoc, 0);
+
+  const GLubyte idx[4] = {0, 1, 3, 2}; // Determines order of triangle strip
+
+  // Set up VBO
+  glGenBuffers(3, m_shaderVertexVBO.data());
+
+  glGenBuffers(1, &m_shaderIndexVBO);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_shaderIndexVBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLubyte) * 4, idx, GL_STATIC_DRAW);
+
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+  glUseProgram(0);
+  return true;
+}
+
+bool CShaderGLES::LinkProgram(const GLchar* vertexShaderSource, const GLchar* fragmentShaderSource)
+{
   GLint status;
   GLuint vShader;
   GLuint fShader;
@@ -100,6 +135,10 @@ bool CShaderGLES::Create(unsigned int passIdx,
   glBindAttribLocation(m_shaderProgram, 1, "COLOR");
   glBindAttribLocation(m_shaderProgram, 2, "TexCoord");
 
+  // Allow storing the program in the shader binary cache
+#if defined(GL_ES_VERSION_3_0)
+  glProgramParameteri(m_shaderProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
   glLinkProgram(m_shaderProgram);
 
   glDeleteShader(vShader);
@@ -119,25 +158,6 @@ bool CShaderGLES::Create(unsigned int passIdx,
     return false;
   }
 
-  glUseProgram(m_shaderProgram);
-
-  GetUniformLocs();
-
-  GLint paramLoc = glGetUniformLocation(m_shaderProgram, "Texture");
-  glUniform1i(paramLoc, 0);
-
-  const GLubyte idx[4] = {0, 1, 3, 2}; // Determines order of triangle strip
-
-  // Set up VBO
-  glGenBuffers(3, m_shaderVertexVBO.data());
-
-  glGenBuffers(1, &m_shaderIndexVBO);
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_shaderIndexVBO);
-  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLubyte) * 4, idx, GL_STATIC_DRAW);
-
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-
-  glUseProgram(0);
   return true;
 }
 
@@ -9,7 +9,11 @@
 #include "ShaderUtilsGLES.h"
 
 #include "ServiceBroker.h"
+#include "cores/RetroPlayer/shaders/ShaderBinaryCache.h"
 #include "rendering/gles/RenderSystemGLES.h"
+#include "utils/log.h"
+
+#include <vector>
 
 using namespace KODI::SHADER;
 
@@ -92,3 +96,63 @@ std::string CShaderUtilsGLES::GetGLSLVersion(std::string& source)
   }
   return versionString;
 }
+
+std::string CShaderUtilsGLES::GetProgramKey(const std::string& vertexSource,
+                                            const std::string& fragmentSource)
+{
+  const CRenderSystemBase* renderSystem = CServiceBroker::GetRenderSystem();
+  const std::string driver = renderSystem->GetRenderVendor() + "\n" +
+                             renderSystem->GetRenderRenderer() + "\n" +
+                             renderSystem->GetRenderVersionString();
+
+  return CShaderBinaryCache::GetKey(driver, vertexSource, fragmentSource);
+}
+
+bool CShaderUtilsGLES::LoadProgramBinary(GLuint program, const std::string& key)
+{
+#if defined(GL_ES_VERSION_3_0)
+  GLint formatCount = 0;
+  glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+  if (formatCount <= 0)
+    return false;
+
+  uint32_t format = 0;
+  std::vector<uint8_t> binary;
+  if (!CShaderBinaryCache::Load(key, format, binary))
+    return false;
+
+  glProgramBinary(program, static_cast<GLenum>(format), binary.data(),
+                  static_cast<GLsizei>(binary.size()));
+
+  GLint status = GL_FALSE;
+  glGetProgramiv(program, GL_LINK_STATUS, &status);
+  if (status == GL_FALSE)
+  {
+    // Rejected by the driver, compile the program again
+    CLog::Log(LOGDEBUG, "CShaderUtilsGLES: Cached program binary {} was rejected", key);
+    CShaderBinaryCache::Remove(key);
+    return false;
+  }
+
+  return true;
+#else
+  return false;
+#endif
+}
+
+void CShaderUtilsGLES::SaveProgramBinary(GLuint program, const std::string& key)
+{
+#if defined(GL_ES_VERSION_3_0)
+  GLint length = 0;
+  glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length <= 0)
+    return;
+
+  std::vector<uint8_t> binary(static_cast<size_t>(length));
+  GLenum format = 0;
+  glGetProgramBinary(program, length, &length, &format, binary.data());
+  binary.resize(static_cast<size_t>(length));
+
+  CShaderBinaryCache::Save(key, static_cast<uint32_t>(format), binary);
+#endif
+}
@@ -20,5 +20,26 @@ class CShaderUtilsGLES
 public:
   static GLint TranslateWrapType(WrapType wrapType);
   static std::string GetGLSLVersion(std::string& source);
+
+  /*!
+   * \brief Get the key of a program in the shader binary cache
+   */
+  static std::string GetProgramKey(const std::string& vertexSource,
+                                   const std::string& fragmentSource);
+
+  /*!
+   * \brief Load a program from the shader binary cache
+   *
+   * \return True if the cached binary was loaded and linked, false if the
+   *         program has to be compiled
+   */
+  static bool LoadProgramBinary(GLuint program, const std::string& key);
+
+  /*!
+   * \brief Store the binary of a linked program in the shader binary cache
+   *
+   * The program must have been linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT.
+   */
+  static void SaveProgramBinary(GLuint program, const std::string& key);
 };
 } // namespace KODI::SHADER
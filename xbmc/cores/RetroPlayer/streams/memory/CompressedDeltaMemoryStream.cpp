@@ -0,0 +1,261 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "CompressedDeltaMemoryStream.h"
+
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+#include <lzo/lzo1x.h>
+#include <lzo/lzoconf.h>
+
+using namespace KODI;
+using namespace RETRO;
+
+namespace
+{
+// Frames waiting for the worker before the game loop compresses them itself
+constexpr size_t MAX_PENDING_FRAMES = 8;
+
+// Worst case size of the output of LZO1X
+constexpr size_t CompressBound(size_t size)
+{
+  return size + size / 16 + 64 + 3;
+}
+
+void ApplyDelta(uint32_t* state, const uint32_t* delta, size_t words)
+{
+  for (size_t i = 0; i < words; i++)
+    state[i] ^= delta[i];
+}
+} // namespace
+
+CCompressedDeltaMemoryStream::CCompressedDeltaMemoryStream(size_t maxMemory)
+  : CThread("RewindCompress"),
+    m_maxMemory(maxMemory)
+{
+  static const bool lzoInitialized = lzo_init() == LZO_E_OK;
+  if (!lzoInitialized)
+    CLog::Log(LOGERROR, "CCompressedDeltaMemoryStream: Failed to initialize LZO");
+
+  Create();
+}
+
+CCompressedDeltaMemoryStream::~CCompressedDeltaMemoryStream()
+{
+  StopThread(false);
+  m_pendingEvent.Set();
+  StopThread(true);
+}
+
+void CCompressedDeltaMemoryStream::Reset()
+{
+  CLinearMemoryStream::Reset();
+
+  std::unique_lock lock(m_critSection);
+  for (const DeltaFramePtr& frame : m_rewindBuffer)
+    frame->stored = false;
+  m_rewindBuffer.clear();
+  m_pending.clear();
+  m_memoryUsage = 0;
+}
+
+void CCompressedDeltaMemoryStream::SubmitFrameInternal()
+{
+  auto frame = std::make_shared<DeltaFrame>();
+
+  // Record frame history
+  frame->frameHistoryCount = m_currentFrameHistory++;
+
+  // A plain loop over both states, no branches, so it runs on vector registers
+  const size_t words = m_paddedFrameSize / sizeof(uint32_t);
+  frame->data.resize(words * sizeof(uint32_t));
+  uint32_t* delta = reinterpret_cast<uint32_t*>(frame->data.data());
+  const uint32_t* currentFrame = m_currentFrame.get();
+  const uint32_t* nextFrame = m_nextFrame.get();
+  for (size_t i = 0; i < words; i++)
+    delta[i] = currentFrame[i] ^ nextFrame[i];
+
+  // Delta is generated, bring the new frame forward (m_nextFrame is now disposable)
+  std::swap(m_currentFrame, m_nextFrame);
+
+  m_bHasNextFrame = false;
+
+  std::unique_lock lock(m_critSection);
+  if (m_pending.size() >= MAX_PENDING_FRAMES)
+  {
+    // The worker doesn't keep up, don't let the raw deltas pile up
+    lock.unlock();
+    std::vector<uint8_t> compressed = Compress(frame->data);
+    lock.lock();
+    if (!compressed.empty())
+    {
+      frame->data = std::move(compressed);
+      frame->compressed = true;
+    }
+  }
+  else
+  {
+    m_pending.push_back(frame);
+    m_pendingEvent.Set();
+  }
+  m_memoryUsage += frame->data.size();
+  m_rewindBuffer.push_back(std::move(frame));
+  lock.unlock();
+
+  if (PastFramesAvailable() + 1 > MaxFrameCount())
+    CullPastFrames(1);
+
+  while (m_rewindBuffer.size() > 1 && MemoryUsage() > m_maxMemory)
+    CullPastFrames(1);
+}
+
+uint64_t CCompressedDeltaMemoryStream::PastFramesAvailable() const
+{
+  return static_cast<uint64_t>(m_rewindBuffer.size());
+}
+
+uint64_t CCompressedDeltaMemoryStream::RewindFrames(uint64_t frameCount)
+{
+  const size_t words = m_paddedFrameSize / sizeof(uint32_t);
+
+  uint64_t rewound;
+  for (rewound = 0; rewound < frameCount; rewound++)
+  {
+    if (m_rewindBuffer.empty())
+      break;
+
+    const DeltaFramePtr frame = std::move(m_rewindBuffer.back());
+    m_rewindBuffer.pop_back();
+
+    // Once dropped, the worker leaves the frame alone
+    {
+      std::unique_lock lock(m_critSection);
+      DropFrame(frame);
+    }
+
+    const uint8_t* delta = frame->data.data();
+    if (frame->compressed)
+    {
+      m_scratch.resize(words * sizeof(uint32_t));
+      lzo_uint size = m_scratch.size();
+      if (lzo1x_decompress_safe(frame->data.data(), frame->data.size(), m_scratch.data(), &size,
+                                nullptr) != LZO_E_OK ||
+          size != m_scratch.size())
+      {
+        CLog::Log(LOGERROR, "CCompressedDeltaMemoryStream: Failed to decompress frame {}",
+                  frame->frameHistoryCount);
+        Reset();
+        break;
+      }
+      delta = m_scratch.data();
+    }
+
+    ApplyDelta(m_currentFrame.get(), reinterpret_cast<const uint32_t*>(delta), words);
+
+    // Restore frame history
+    m_currentFrameHistory = frame->frameHistoryCount;
+  }
+
+  return rewound;
+}
+
+size_t CCompressedDeltaMemoryStream::MemoryUsage() const
+{
+  std::unique_lock lock(m_critSection);
+  return m_memoryUsage;
+}
+
+void CCompressedDeltaMemoryStream::CullPastFrames(uint64_t frameCount)
+{
+  for (uint64_t removedCount = 0; removedCount < frameCount; removedCount++)
+  {
+    if (m_rewindBuffer.empty())
+    {
+      CLog::Log(LOGDEBUG,
+                "CCompressedDeltaMemoryStream: Tried to cull {} frames too many. Check your math!",
+                frameCount - removedCount);
+      break;
+    }
+
+    std::unique_lock lock(m_critSection);
+    DropFrame(m_rewindBuffer.front());
+    m_rewindBuffer.pop_front();
+  }
+}
+
+void CCompressedDeltaMemoryStream::Process()
+{
+  while (!m_bStop)
+  {
+    DeltaFramePtr frame;
+    {
+      std::unique_lock lock(m_critSection);
+      if (!m_pending.empty())
+      {
+        frame = std::move(m_pending.front());
+        m_pending.pop_front();
+      }
+    }
+
+    if (!frame)
+    {
+      m_pendingEvent.Wait();
+      continue;
+    }
+
+    // The raw delta doesn't change while it's queued, only the worker replaces it
+    std::vector<uint8_t> compressed = Compress(frame->data);
+
+    std::unique_lock lock(m_critSection);
+    StoreCompressed(*frame, std::move(compressed));
+  }
+}
+
+std::vector<uint8_t> CCompressedDeltaMemoryStream::Compress(const std::vector<uint8_t>& delta)
+{
+  thread_local std::vector<uint8_t> workMemory(LZO1X_1_MEM_COMPRESS);
+
+  std::vector<uint8_t> compressed(CompressBound(delta.size()));
+  lzo_uint size = compressed.size();
+  if (lzo1x_1_compress(delta.data(), delta.size(), compressed.data(), &size,
+                       workMemory.data()) != LZO_E_OK)
+  {
+    CLog::Log(LOGERROR, "CCompressedDeltaMemoryStream: Failed to compress frame");
+    return {};
+  }
+
+  compressed.resize(size);
+  compressed.shrink_to_fit();
+  return compressed;
+}
+
+void CCompressedDeltaMemoryStream::StoreCompressed(DeltaFrame& frame,
+                                                   std::vector<uint8_t> compressed)
+{
+  if (!frame.stored || compressed.empty())
+    return;
+
+  m_memoryUsage -= frame.data.size();
+  m_memoryUsage += compressed.size();
+  frame.data = std::move(compressed);
+  frame.compressed = true;
+}
+
+void CCompressedDeltaMemoryStream::DropFrame(const DeltaFramePtr& frame)
+{
+  if (!frame->stored)
+    return;
+
+  frame->stored = false;
+  m_memoryUsage -= frame->data.size();
+  std::erase(m_pending, frame);
+}
@@ -0,0 +1,104 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "LinearMemoryStream.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+#include "threads/Thread.h"
+
+#include <deque>
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+namespace KODI
+{
+namespace RETRO
+{
+/*!
+ * \brief Implementation of a linear memory stream using compressed XOR deltas
+ *
+ * Each past frame is stored as the XOR of two consecutive states. The delta is
+ * computed and applied word by word over the whole state, a loop the compiler
+ * vectorizes. Because most of a state doesn't change between two frames, the
+ * deltas are mostly zero and compress very well. A worker thread compresses
+ * them with LZO, so the game loop only pays for the XOR.
+ *
+ * Besides the max frame count, the stream holds no more past frames than fit
+ * in its memory budget, the oldest frames are dropped first.
+ */
+class CCompressedDeltaMemoryStream : public CLinearMemoryStream, private CThread
+{
+public:
+  /*!
+   * \param maxMemory The number of bytes the past frames may take
+   */
+  explicit CCompressedDeltaMemoryStream(size_t maxMemory);
+
+  ~CCompressedDeltaMemoryStream() override;
+
+  // implementation of IMemoryStream via CLinearMemoryStream
+  void Reset() override;
+  uint64_t PastFramesAvailable() const override;
+  uint64_t RewindFrames(uint64_t frameCount) override;
+
+  /*!
+   * \brief Return the number of bytes the past frames take
+   */
+  size_t MemoryUsage() const;
+
+protected:
+  // implementation of CLinearMemoryStream
+  void SubmitFrameInternal() override;
+  void CullPastFrames(uint64_t frameCount) override;
+
+  // implementation of CThread
+  void Process() override;
+
+private:
+  struct DeltaFrame
+  {
+    std::vector<uint8_t> data; // raw delta until it's compressed
+    bool compressed{false};
+    bool stored{true}; // false once the frame left the stream
+    uint64_t frameHistoryCount{0};
+  };
+
+  using DeltaFramePtr = std::shared_ptr<DeltaFrame>;
+
+  /*!
+   * \brief Compress a raw delta, needs no lock
+   */
+  static std::vector<uint8_t> Compress(const std::vector<uint8_t>& delta);
+
+  /*!
+   * \brief Replace the raw delta of the frame by its compressed form, needs m_critSection
+   */
+  void StoreCompressed(DeltaFrame& frame, std::vector<uint8_t> compressed);
+
+  /*!
+   * \brief Take the frame out of the memory accounting and the worker queue, needs m_critSection
+   */
+  void DropFrame(const DeltaFramePtr& frame);
+
+  const size_t m_maxMemory;
+
+  // Accessed by the game loop only
+  std::deque<DeltaFramePtr> m_rewindBuffer;
+  std::vector<uint8_t> m_scratch;
+
+  // Shared with the worker
+  mutable CCriticalSection m_critSection;
+  std::deque<DeltaFramePtr> m_pending;
+  size_t m_memoryUsage{0};
+  CEvent m_pendingEvent;
+};
+} // namespace RETRO
+} // namespace KODI
@@ -0,0 +1,93 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/RetroPlayer/streams/memory/CompressedDeltaMemoryStream.h"
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace KODI;
+using namespace RETRO;
+
+namespace
+{
+constexpr size_t FRAME_SIZE = 64 * 1024 + 3;
+
+std::vector<uint8_t> MakeState(unsigned int frame)
+{
+  // a state that changes in a few places from frame to frame, like a game does
+  std::vector<uint8_t> state(FRAME_SIZE, 0x5a);
+  for (size_t i = 0; i < 16; i++)
+    state[(frame * 997 + i * 4099) % FRAME_SIZE] = static_cast<uint8_t>(frame + i);
+  return state;
+}
+
+void Submit(IMemoryStream& stream, const std::vector<uint8_t>& state)
+{
+  uint8_t* buffer = stream.BeginFrame();
+  ASSERT_NE(nullptr, buffer);
+  std::memcpy(buffer, state.data(), state.size());
+  stream.SubmitFrame();
+}
+} // namespace
+
+TEST(TestCompressedDeltaMemoryStream, RewindRestoresStates)
+{
+  CCompressedDeltaMemoryStream stream(64 * 1024 * 1024);
+  stream.Init(FRAME_SIZE, 100);
+
+  for (unsigned int frame = 0; frame < 60; frame++)
+    Submit(stream, MakeState(frame));
+
+  EXPECT_EQ(59u, stream.PastFramesAvailable());
+  EXPECT_EQ(0, std::memcmp(MakeState(59).data(), stream.CurrentFrame(), FRAME_SIZE));
+
+  EXPECT_EQ(10u, stream.RewindFrames(10));
+  EXPECT_EQ(0, std::memcmp(MakeState(49).data(), stream.CurrentFrame(), FRAME_SIZE));
+
+  EXPECT_EQ(49u, stream.RewindFrames(100));
+  EXPECT_EQ(0, std::memcmp(MakeState(0).data(), stream.CurrentFrame(), FRAME_SIZE));
+  EXPECT_EQ(0u, stream.MemoryUsage());
+}
+
+TEST(TestCompressedDeltaMemoryStream, KeepsMaxFrameCount)
+{
+  CCompressedDeltaMemoryStream stream(64 * 1024 * 1024);
+  stream.Init(FRAME_SIZE, 20);
+
+  for (unsigned int frame = 0; frame < 60; frame++)
+    Submit(stream, MakeState(frame));
+
+  EXPECT_EQ(19u, stream.PastFramesAvailable());
+  EXPECT_EQ(19u, stream.RewindFrames(100));
+  EXPECT_EQ(0, std::memcmp(MakeState(40).data(), stream.CurrentFrame(), FRAME_SIZE));
+}
+
+TEST(TestCompressedDeltaMemoryStream, KeepsMemoryBudget)
+{
+  constexpr size_t MAX_MEMORY = 4 * FRAME_SIZE;
+  CCompressedDeltaMemoryStream stream(MAX_MEMORY);
+  stream.Init(FRAME_SIZE, 1000);
+
+  // random states don't compress, only a few of them fit
+  std::mt19937 random(42);
+  std::vector<uint8_t> state(FRAME_SIZE);
+  for (unsigned int frame = 0; frame < 50; frame++)
+  {
+    for (uint8_t& byte : state)
+      byte = static_cast<uint8_t>(random());
+    Submit(stream, state);
+  }
+
+  EXPECT_LE(stream.MemoryUsage(), MAX_MEMORY);
+  EXPECT_GE(stream.PastFramesAvailable(), 1u);
+  EXPECT_LT(stream.PastFramesAvailable(), 10u);
+}
@@ -105,9 +105,11 @@ void CVideoBufferDMA::SetDimensions(int width,
   }
 }
 
-bool CVideoBufferDMA::Alloc()
+bool CVideoBufferDMA::Alloc(std::unique_ptr<IBufferObject> bo)
 {
-  if (!m_bo->CreateBufferObject(m_size))
+  if (bo)
+    m_bo = std::move(bo);
+  else if (!m_bo->CreateBufferObject(m_size))
     return false;
 
   m_fd = m_bo->GetFd();
@@ -176,10 +178,24 @@ void CVideoBufferDMA::SyncEnd()
   m_bo->SyncEnd();
 }
 
+std::unique_ptr<IBufferObject> CVideoBufferDMA::ReleaseBufferObject()
+{
+  if (m_fd < 0)
+    return nullptr;
+
+  std::unique_ptr<IBufferObject> bo = std::move(m_bo);
+  m_addr = nullptr;
+  m_fd = -1;
+  return bo;
+}
+
 void CVideoBufferDMA::Destroy()
 {
-  m_bo->ReleaseMemory();
-  m_bo->DestroyBufferObject();
+  if (m_bo)
+  {
+    m_bo->ReleaseMemory();
+    m_bo->DestroyBufferObject();
+  }
 
   for (auto& offset : m_offsets)
     offset = 0;
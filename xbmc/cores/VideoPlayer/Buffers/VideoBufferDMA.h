@@ -36,7 +36,18 @@ public:
                      const int (&planeOffsets)[YuvImage::MAX_PLANES]) override;
 
   void SetDimensions(int width, int height);
-  bool Alloc();
+
+  /*!
+   * \brief Allocate the buffer memory
+   * \param bo an already allocated buffer object of the right size to take over, may be nullptr
+   */
+  bool Alloc(std::unique_ptr<IBufferObject> bo = nullptr);
+
+  /*!
+   * \brief Give up the buffer object, so it outlives this buffer
+   * \return the allocated buffer object, nullptr if there is none
+   */
+  std::unique_ptr<IBufferObject> ReleaseBufferObject();
   void Export(AVFrame* frame, uint32_t width, uint32_t height);
 
   void SyncStart() override;
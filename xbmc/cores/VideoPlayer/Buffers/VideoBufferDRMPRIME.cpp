@@ -57,6 +57,22 @@ CVideoBufferDRMPRIME::CVideoBufferDRMPRIME(int id) : CVideoBuffer(id)
   m_pixFormat = AV_PIX_FMT_DRM_PRIME;
 }
 
+bool CVideoBufferDRMPRIME::GetFormatAndModifier(uint32_t& format, uint64_t& modifier)
+{
+  if (!AcquireDescriptor())
+    return false;
+
+  const AVDRMFrameDescriptor* desc = GetDescriptor();
+  if (desc)
+  {
+    format = desc->layers[0].format;
+    modifier = desc->objects[0].format_modifier;
+  }
+
+  ReleaseDescriptor();
+  return desc != nullptr;
+}
+
 CVideoBufferDRMPRIMEFFmpeg::CVideoBufferDRMPRIMEFFmpeg(IVideoBufferPool& pool, int id)
   : CVideoBufferDRMPRIME(id)
 {
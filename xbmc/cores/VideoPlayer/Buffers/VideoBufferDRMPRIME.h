@@ -41,6 +41,12 @@ public:
   virtual bool AcquireDescriptor() { return true; }
   virtual void ReleaseDescriptor() {}
 
+  /*!
+   * \brief Get the drm fourcc of the first layer and the modifier of the first object
+   * \return false if the descriptor is not available
+   */
+  bool GetFormatAndModifier(uint32_t& format, uint64_t& modifier);
+
   uint32_t m_fb_id = 0;
   uint32_t m_handles[AV_DRM_MAX_PLANES] = {};
 
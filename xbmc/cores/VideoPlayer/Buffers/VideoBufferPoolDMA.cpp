@@ -9,8 +9,14 @@
 #include "VideoBufferPoolDMA.h"
 
 #include "cores/VideoPlayer/Buffers/VideoBufferDMA.h"
+#include "guilib/GPUMemoryBudget.h"
 #include "utils/BufferObjectFactory.h"
+#include "utils/DRMHelpers.h"
+#include "utils/IBufferObject.h"
+#include "utils/MemUtils.h"
+#include "utils/log.h"
 
+#include <algorithm>
 #include <mutex>
 
 #include <drm_fourcc.h>
@@ -21,12 +27,96 @@ extern "C"
 #include <libavutil/pixfmt.h>
 }
 
+namespace
+{
+constexpr auto CACHE_EXPIRY = std::chrono::minutes(1);
+} // unnamed namespace
+
+CVideoBufferDMACache& CVideoBufferDMACache::GetInstance()
+{
+  static CVideoBufferDMACache cache;
+  return cache;
+}
+
+std::unique_ptr<IBufferObject> CVideoBufferDMACache::Take(uint32_t fourcc, uint64_t size)
+{
+  std::unique_lock lock(m_critSection);
+
+  Trim();
+
+  // the most recent buffers are the least likely to have been swapped out
+  auto it = std::find_if(m_entries.rbegin(), m_entries.rend(), [fourcc, size](const Entry& entry)
+                         { return entry.fourcc == fourcc && entry.size == size; });
+  if (it == m_entries.rend())
+    return nullptr;
+
+  std::unique_ptr<IBufferObject> bo = std::move(it->bo);
+  m_bytes -= it->size;
+  CGPUMemoryBudget::GetInstance().Remove(CGPUMemoryBudget::Consumer::VIDEO_BUFFERS, it->size);
+  m_entries.erase(std::next(it).base());
+  return bo;
+}
+
+void CVideoBufferDMACache::Put(uint32_t fourcc, uint64_t size, std::unique_ptr<IBufferObject> bo)
+{
+  if (!bo)
+    return;
+
+  std::unique_lock lock(m_critSection);
+
+  m_entries.push_back({fourcc, size, std::chrono::steady_clock::now(), std::move(bo)});
+  m_bytes += size;
+  CGPUMemoryBudget::GetInstance().Add(CGPUMemoryBudget::Consumer::VIDEO_BUFFERS, size);
+  Trim();
+}
+
+void CVideoBufferDMACache::Clear()
+{
+  std::unique_lock lock(m_critSection);
+
+  if (!m_entries.empty())
+    CLog::Log(LOGDEBUG, LOGVIDEO, "CVideoBufferDMACache::{} - releasing {} buffers, {} bytes",
+              __FUNCTION__, m_entries.size(), m_bytes);
+
+  CGPUMemoryBudget::GetInstance().Remove(CGPUMemoryBudget::Consumer::VIDEO_BUFFERS, m_bytes);
+  m_entries.clear();
+  m_bytes = 0;
+}
+
+void CVideoBufferDMACache::Trim()
+{
+  if (m_entries.empty())
+    return;
+
+  KODI::MEMORY::MemoryStatus status{};
+  KODI::MEMORY::GetMemoryStatus(&status);
+  const uint64_t limit = status.availPhys < status.totalPhys / 10 ? 0 : status.totalPhys / 8;
+  const auto expired = std::chrono::steady_clock::now() - CACHE_EXPIRY;
+
+  while (!m_entries.empty() && (m_bytes > limit || m_entries.front().time < expired))
+  {
+    CLog::Log(LOGDEBUG, LOGVIDEO, "CVideoBufferDMACache::{} - dropping fourcc={} size={}",
+              __FUNCTION__, DRMHELPERS::FourCCToString(m_entries.front().fourcc),
+              m_entries.front().size);
+    m_bytes -= m_entries.front().size;
+    CGPUMemoryBudget::GetInstance().Remove(CGPUMemoryBudget::Consumer::VIDEO_BUFFERS,
+                                           m_entries.front().size);
+    m_entries.pop_front();
+  }
+}
+
 CVideoBufferPoolDMA::~CVideoBufferPoolDMA()
 {
   std::unique_lock lock(m_critSection);
 
+  // all buffers are back home, hand their memory on to the next decoder
+  auto& cache = CVideoBufferDMACache::GetInstance();
   for (auto buf : m_all)
+  {
+    CGPUMemoryBudget::GetInstance().Remove(CGPUMemoryBudget::Consumer::VIDEO_BUFFERS, m_size);
+    cache.Put(m_fourcc, m_size, buf->ReleaseBufferObject());
     delete buf;
+  }
 }
 
 CVideoBuffer* CVideoBufferPoolDMA::Get()
@@ -46,7 +136,7 @@ CVideoBuffer* CVideoBufferPoolDMA::Get()
     int id = m_all.size();
     buf = new CVideoBufferDMA(*this, id, m_fourcc, m_planes, m_size);
 
-    if (!buf->Alloc())
+    if (!buf->Alloc(CVideoBufferDMACache::GetInstance().Take(m_fourcc, m_size)))
     {
       delete buf;
       return nullptr;
@@ -54,6 +144,8 @@ CVideoBuffer* CVideoBufferPoolDMA::Get()
 
     m_all.push_back(buf);
     m_used.push_back(id);
+    // counted against the GUI textures, which give way when the decoder needs the memory
+    CGPUMemoryBudget::GetInstance().Add(CGPUMemoryBudget::Consumer::VIDEO_BUFFERS, m_size);
   }
 
   buf->Acquire(GetPtr());
@@ -10,9 +10,50 @@
 
 #include "cores/VideoPlayer/Buffers/VideoBuffer.h"
 
+#include <chrono>
 #include <memory>
 
 class CVideoBufferDMA;
+class IBufferObject;
+
+/*!
+ * \brief Process wide store of the buffer objects of discarded DMA pools
+ *
+ * Every codec change discards the pool of the old decoder. Its buffer objects are kept here for a
+ * while, so the next decoder with the same format and size, e.g. after a channel switch, takes
+ * them over instead of allocating new dmabufs. Buffers unused for a minute are dropped, and the
+ * store never holds more than an eighth of the physical memory, or anything while less than a
+ * tenth of it is available.
+ */
+class CVideoBufferDMACache
+{
+public:
+  static CVideoBufferDMACache& GetInstance();
+
+  /*!
+   * \brief Take a buffer object out of the store
+   * \return an allocated and mapped buffer object, nullptr if none matches
+   */
+  std::unique_ptr<IBufferObject> Take(uint32_t fourcc, uint64_t size);
+  void Put(uint32_t fourcc, uint64_t size, std::unique_ptr<IBufferObject> bo);
+  void Clear();
+
+private:
+  CVideoBufferDMACache() = default;
+  void Trim();
+
+  struct Entry
+  {
+    uint32_t fourcc;
+    uint64_t size;
+    std::chrono::steady_clock::time_point time;
+    std::unique_ptr<IBufferObject> bo;
+  };
+
+  CCriticalSection m_critSection;
+  std::deque<Entry> m_entries; ///< oldest first
+  uint64_t m_bytes = 0;
+};
 
 class CVideoBufferPoolDMA : public IVideoBufferPool
 {
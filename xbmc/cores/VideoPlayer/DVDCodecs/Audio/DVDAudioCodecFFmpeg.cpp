@@ -180,6 +180,10 @@ bool CDVDAudioCodecFFmpeg::AddData(const DemuxPacket &packet)
   avpkt->side_data = static_cast<AVPacketSideData*>(packet.pSideData);
   avpkt->side_data_elems = packet.iSideDataElems;
 
+  // let libavcodec reference the demuxer's buffer instead of copying the payload
+  if (packet.m_avBuffer)
+    avpkt->buf = av_buffer_ref(packet.m_avBuffer);
+
   int ret = avcodec_send_packet(m_pCodecContext, avpkt);
 
   //! @todo: properly handle avpkt side_data. this works around our improper use of the side_data
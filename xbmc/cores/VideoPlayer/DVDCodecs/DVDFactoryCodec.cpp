@@ -39,6 +39,8 @@ std::map<std::string, CreateHWAudioCodec> CDVDFactoryCodec::m_hwAudioCodecs;
 
 std::map<std::string, CreateHWAccel> CDVDFactoryCodec::m_hwAccels;
 
+std::string CDVDFactoryCodec::m_videoDecoder;
+
 CCriticalSection videoCodecSection, audioCodecSection;
 
 std::unique_ptr<CDVDVideoCodec> CDVDFactoryCodec::CreateVideoCodec(CDVDStreamInfo& hint,
@@ -73,6 +75,9 @@ std::unique_ptr<CDVDVideoCodec> CDVDFactoryCodec::CreateVideoCodec(CDVDStreamInf
   {
     for (auto &codec : m_hwVideoCodecs)
     {
+      if (!m_videoDecoder.empty() && codec.first != m_videoDecoder)
+        continue;
+
       pCodec = CreateVideoCodecHW(codec.first, processInfo);
       if (pCodec && pCodec->Open(hint, options))
       {
@@ -145,6 +150,9 @@ std::vector<std::string> CDVDFactoryCodec::GetHWAccels()
   ret.reserve(m_hwAccels.size());
   for (auto &hwaccel : m_hwAccels)
   {
+    if (!m_videoDecoder.empty() && hwaccel.first != m_videoDecoder)
+      continue;
+
     ret.push_back(hwaccel.first);
   }
   return ret;
@@ -164,6 +172,13 @@ void CDVDFactoryCodec::ClearHWAccels()
   m_hwAccels.clear();
 }
 
+void CDVDFactoryCodec::SetVideoDecoder(const std::string& id)
+{
+  std::unique_lock lock(videoCodecSection);
+
+  m_videoDecoder = id;
+}
+
 //------------------------------------------------------------------------------
 // Audio
 //------------------------------------------------------------------------------
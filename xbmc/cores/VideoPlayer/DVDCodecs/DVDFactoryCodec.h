@@ -63,6 +63,13 @@ public:
   static std::vector<std::string> GetHWAccels();
   static void ClearHWAccels();
 
+  /*!
+   * \brief Only use one of the platform video decoders or of the hardware accelerations of
+   * ffmpeg, i.e. for benchmarks
+   * \param id the id it was registered with, empty to use any
+   */
+  static void SetVideoDecoder(const std::string& id);
+
   static void RegisterHWAudioCodec(const std::string& id, CreateHWAudioCodec createFunc);
   static void ClearHWAudioCodecs();
 
@@ -76,5 +83,6 @@ protected:
   static std::map<std::string, CreateHWVideoCodec> m_hwVideoCodecs;
   static std::map<std::string, CreateHWAccel> m_hwAccels;
   static std::map<std::string, CreateHWAudioCodec> m_hwAudioCodecs;
+  static std::string m_videoDecoder;
 };
 
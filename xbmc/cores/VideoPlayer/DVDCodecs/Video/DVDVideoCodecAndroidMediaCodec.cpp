@@ -471,6 +471,11 @@ bool CDVDVideoCodecAndroidMediaCodec::Open(CDVDStreamInfo &hints, CDVDCodecOptio
         {
           m_bitstream.reset();
         }
+        else
+        {
+          // AddData() consumes the packet once it's converted
+          m_bitstream->SetConvertInPlace(true);
+        }
       }
       break;
     case AV_CODEC_ID_HEVC:
@@ -600,6 +605,7 @@ bool CDVDVideoCodecAndroidMediaCodec::Open(CDVDStreamInfo &hints, CDVDCodecOptio
 
         if (m_bitstream)
         {
+          m_bitstream->SetConvertInPlace(true);
           m_bitstream->SetRemoveDovi(removeDovi);
           m_bitstream->SetRemoveHdr10Plus(removeHdr10Plus);
           m_bitstream->SetDoviZeroLevel5(doviZeroLevel5);
@@ -1054,6 +1060,16 @@ bool CDVDVideoCodecAndroidMediaCodec::AddData(const DemuxPacket &packet)
       }
 
       // we have an input buffer, fill it.
+      // get it before the conversion, which can rewrite the packet that would be sent again
+      CJNIByteBuffer buffer = m_codec->getInputBuffer(m_indexInputBuffer);
+      if (xbmc_jnienv()->ExceptionCheck())
+      {
+        xbmc_jnienv()->ExceptionDescribe();
+        xbmc_jnienv()->ExceptionClear();
+        CLog::Log(LOGERROR, "CDVDVideoCodecAndroidMediaCodec::AddData: getInputBuffer failed");
+        return false;
+      }
+
       if (pData && m_bitstream)
       {
         m_bitstream->Convert(pData, iSize);
@@ -1071,15 +1087,6 @@ bool CDVDVideoCodecAndroidMediaCodec::AddData(const DemuxPacket &packet)
       if (m_state == MEDIACODEC_STATE_FLUSHED)
         m_state = MEDIACODEC_STATE_RUNNING;
 
-      CJNIByteBuffer buffer = m_codec->getInputBuffer(m_indexInputBuffer);
-      if (xbmc_jnienv()->ExceptionCheck())
-      {
-        xbmc_jnienv()->ExceptionDescribe();
-        xbmc_jnienv()->ExceptionClear();
-        CLog::Log(LOGERROR, "CDVDVideoCodecAndroidMediaCodec::AddData: getInputBuffer failed");
-        return false;
-      }
-
       size_t out_size = buffer.capacity();
       if ((size_t)iSize > out_size)
       {
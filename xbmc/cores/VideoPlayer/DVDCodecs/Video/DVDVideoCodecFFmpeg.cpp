@@ -66,6 +66,51 @@ enum EFilterFlags {
   FILTER_ROTATE              = 0x40,  //< rotate image according to the codec hints
 };
 
+namespace
+{
+// frames up to this size decode fast enough on slice threads alone
+constexpr int SLICE_THREADING_MAX_PIXELS = 1024 * 576;
+// frame threading delays the output by one frame per thread, live streams keep that short
+constexpr int REALTIME_MAX_FRAME_THREADS = 4;
+// the average decode time is reported once per this many frames
+constexpr int DECODE_TIME_FRAMES = 25;
+
+/*!
+ * \brief Set the threading model and the thread count of a software decoder
+ *
+ * Slice threading adds no delay but only scales with the slices of a frame, so it is used for
+ * small frames and for codecs without frame threading. libavcodec offers no way to set the
+ * affinity of its workers, instead one core is left to the render and demux threads on machines
+ * that have enough of them.
+ * \return the name of the threading model for the log
+ */
+const char* SetupThreading(AVCodecContext* avctx,
+                           const AVCodec* codec,
+                           const CDVDStreamInfo& hints,
+                           bool realtime)
+{
+  const int cpus = CServiceBroker::GetCPUInfo()->GetCPUCount();
+  const int available = std::max(1, cpus >= 4 ? cpus - 1 : cpus);
+  const bool frameThreads = (codec->capabilities & AV_CODEC_CAP_FRAME_THREADS) != 0;
+  const bool sliceThreads = (codec->capabilities & AV_CODEC_CAP_SLICE_THREADS) != 0;
+  const int pixels = hints.width * hints.height;
+
+  if (sliceThreads && (!frameThreads || (pixels > 0 && pixels <= SLICE_THREADING_MAX_PIXELS)))
+  {
+    avctx->thread_type = FF_THREAD_SLICE;
+    avctx->thread_count = std::min(available, 8);
+    return "slice";
+  }
+
+  int threads = std::min(available * 3 / 2, 16);
+  if (realtime)
+    threads = std::min(threads, REALTIME_MAX_FRAME_THREADS);
+  avctx->thread_type = FF_THREAD_FRAME;
+  avctx->thread_count = std::max(1, threads);
+  return "frame";
+}
+} // unnamed namespace
+
 //------------------------------------------------------------------------------
 // Video Buffers
 //------------------------------------------------------------------------------
@@ -392,12 +437,11 @@ bool CDVDVideoCodecFFmpeg::Open(CDVDStreamInfo &hints, CDVDCodecOptions &options
     }
     else
     {
-      int num_threads = CServiceBroker::GetCPUInfo()->GetCPUCount() * 3 / 2;
-      num_threads = std::max(1, std::min(num_threads, 16));
-      m_pCodecContext->thread_count = num_threads;
+      const char* model =
+          SetupThreading(m_pCodecContext, pCodec, hints, m_processInfo.IsRealtimeStream());
       m_decoderState = STATE_SW_MULTI;
-      CLog::Log(LOGDEBUG, "CDVDVideoCodecFFmpeg - open frame threaded with {} threads",
-                num_threads);
+      CLog::Log(LOGDEBUG, "CDVDVideoCodecFFmpeg - open {} threaded with {} threads", model,
+                m_pCodecContext->thread_count);
     }
   }
   else
@@ -618,7 +662,13 @@ bool CDVDVideoCodecFFmpeg::AddData(const DemuxPacket &packet)
   avpkt->side_data = static_cast<AVPacketSideData*>(packet.pSideData);
   avpkt->side_data_elems = packet.iSideDataElems;
 
+  // let libavcodec reference the demuxer's buffer instead of copying the payload
+  if (packet.m_avBuffer)
+    avpkt->buf = av_buffer_ref(packet.m_avBuffer);
+
+  const auto start = std::chrono::steady_clock::now();
   int ret = avcodec_send_packet(m_pCodecContext, avpkt);
+  UpdateDecodeTime(start, false);
 
   //! @todo: properly handle avpkt side_data. this works around our improper use of the side_data
   // as we pass pointers to ffmpeg allocated memory for the side_data. we should really be allocating
@@ -719,7 +769,9 @@ CDVDVideoCodec::VCReturn CDVDVideoCodecFFmpeg::GetPicture(VideoPicture* pVideoPi
     av_packet_free(&avpkt);
   }
 
+  const auto start = std::chrono::steady_clock::now();
   int ret = avcodec_receive_frame(m_pCodecContext, m_pDecodedFrame);
+  UpdateDecodeTime(start, ret == 0);
 
   if (m_decoderState == STATE_HW_FAILED && !m_pHardware)
     return VC_REOPEN;
@@ -950,6 +1002,8 @@ void CDVDVideoCodecFFmpeg::Reset()
   m_decoderPts = DVD_NOPTS_VALUE;
   m_skippedDeint = 0;
   m_droppedFrames = 0;
+  m_decodeTime = {};
+  m_decodeFrames = 0;
   m_eof = false;
   m_iLastKeyframe = m_pCodecContext->has_b_frames;
   avcodec_flush_buffers(m_pCodecContext);
@@ -963,6 +1017,20 @@ void CDVDVideoCodecFFmpeg::Reset()
   m_dropCtrl.Reset(false);
 }
 
+void CDVDVideoCodecFFmpeg::UpdateDecodeTime(std::chrono::steady_clock::time_point start,
+                                            bool gotFrame)
+{
+  // with frame threading this is the time the player waits for the decoder, not its cpu time
+  m_decodeTime += std::chrono::steady_clock::now() - start;
+  if (!gotFrame || ++m_decodeFrames < DECODE_TIME_FRAMES)
+    return;
+
+  const std::chrono::duration<float, std::milli> average = m_decodeTime / m_decodeFrames;
+  m_processInfo.SetVideoDecodeTime(average.count());
+  m_decodeTime = {};
+  m_decodeFrames = 0;
+}
+
 void CDVDVideoCodecFFmpeg::Reopen()
 {
   Dispose();
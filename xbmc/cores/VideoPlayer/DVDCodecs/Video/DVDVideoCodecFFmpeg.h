@@ -13,6 +13,7 @@
 #include "cores/VideoPlayer/DVDCodecs/DVDCodecs.h"
 #include "cores/VideoPlayer/DVDStreamInfo.h"
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -59,6 +60,7 @@ protected:
   bool SetPictureParams(VideoPicture* pVideoPicture);
 
   bool HasHardware() { return m_pHardware != nullptr; }
+  void UpdateDecodeTime(std::chrono::steady_clock::time_point start, bool gotFrame);
   void SetHardware(IHardwareDecoder *hardware);
 
   AVFrame* m_pFrame = nullptr;;
@@ -94,6 +96,8 @@ protected:
   double m_decoderPts = DVD_NOPTS_VALUE;
   int m_skippedDeint = 0;
   int m_droppedFrames = 0;
+  std::chrono::steady_clock::duration m_decodeTime{}; ///< time spent in libavcodec since the last report
+  int m_decodeFrames = 0;
   bool m_requestSkipDeint = false;
   int m_codecControlFlags = 0;
   bool m_interlaced = false;
@@ -53,6 +53,8 @@ using namespace VAAPI;
 using namespace std::chrono_literals;
 
 #define NUM_RENDER_PICS 7
+// max times the output polls a picture still in vpp before it blocks on it, about 1 ms apart
+#define MAX_READY_POLLS 20
 
 constexpr auto SETTING_VIDEOPLAYER_USEVAAPI = "videoplayer.usevaapi";
 constexpr auto SETTING_VIDEOPLAYER_USEVAAPIAV1 = "videoplayer.usevaapiav1";
@@ -1916,6 +1918,17 @@ void COutput::StateMachine(int signal, Protocol *port, Message *msg)
         switch (signal)
         {
         case COutputControlProtocol::TIMEOUT:
+          // vpp runs ahead asynchronously, instead of blocking until the gpu is done with the
+          // oldest picture see to returned pictures and new work meanwhile
+          if (!m_bufferPool->processedPics.empty() &&
+              !IsPictureReady(m_bufferPool->processedPics.front()) &&
+              ++m_readyPolls < MAX_READY_POLLS)
+          {
+            m_state = O_TOP_CONFIGURED_IDLE;
+            m_extTimeout = 1ms;
+            return;
+          }
+          m_readyPolls = 0;
           if (!m_bufferPool->processedPics.empty())
           {
             CVaapiRenderPicture *outPic;
@@ -2108,6 +2121,7 @@ void COutput::Flush()
     ReleaseProcessedPicture(m_bufferPool->processedPics[i]);
   }
   m_bufferPool->processedPics.clear();
+  m_readyPolls = 0;
 
   if (m_pp)
     m_pp->Flush();
@@ -2259,6 +2273,19 @@ void COutput::InitCycle()
   }
 }
 
+bool COutput::IsPictureReady(const CVaapiProcessedPicture& pic)
+{
+  if (!pic.source || !pic.source->UseVideoSurface())
+    return true;
+
+  // on errors let vaSyncSurface in ProcessPicture sort it out
+  VASurfaceStatus status;
+  if (vaQuerySurfaceStatus(m_config.dpy, pic.videoSurface, &status) != VA_STATUS_SUCCESS)
+    return true;
+
+  return status != VASurfaceRendering;
+}
+
 CVaapiRenderPicture* COutput::ProcessPicture(CVaapiProcessedPicture &pic)
 {
   CVaapiRenderPicture *retPic;
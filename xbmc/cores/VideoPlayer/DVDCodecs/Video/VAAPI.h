@@ -352,6 +352,7 @@ protected:
   bool HasWork();
   bool PreferPP();
   void InitCycle();
+  bool IsPictureReady(const CVaapiProcessedPicture& pic);
   CVaapiRenderPicture* ProcessPicture(CVaapiProcessedPicture &pic);
   void QueueReturnPicture(CVaapiRenderPicture *pic);
   void ProcessReturnPicture(CVaapiRenderPicture *pic);
@@ -377,6 +378,7 @@ protected:
   CVaapiConfig m_config;
   std::shared_ptr<CVaapiBufferPool> m_bufferPool;
   CVaapiDecodedPicture m_currentPicture;
+  int m_readyPolls = 0; ///< times the oldest processed picture was found still rendering
   CPostproc *m_pp;
   std::list<std::shared_ptr<CPostproc>> m_discardedPostprocs;
   SDiMethods m_diMethods;
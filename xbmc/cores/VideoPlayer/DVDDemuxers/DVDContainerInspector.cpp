@@ -0,0 +1,1322 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DVDContainerInspector.h"
+
+#include "URL.h"
+#include "filesystem/File.h"
+#include "utils/LangCodeExpander.h"
+#include "utils/StreamDetails.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <map>
+#include <string_view>
+
+namespace
+{
+constexpr size_t BLOCK_SIZE = 64 * 1024;
+// most files need a few blocks, the ones with their index at the end a few more
+constexpr uint64_t READ_BUDGET = 64 * BLOCK_SIZE;
+// header elements and boxes read whole, larger ones are left to the demuxer
+constexpr uint64_t MAX_ELEMENT_SIZE = 1024 * 1024;
+constexpr int MAX_TOP_LEVEL = 64;
+
+constexpr std::array<std::string_view, 6> extensions{"mkv", "mk3d", "webm", "mp4", "m4v", "mov"};
+
+// Matroska element IDs, with their length marker
+constexpr uint32_t MKV_EBML = 0x1A45DFA3;
+constexpr uint32_t MKV_DOCTYPE = 0x4282;
+constexpr uint32_t MKV_SEGMENT = 0x18538067;
+constexpr uint32_t MKV_SEEKHEAD = 0x114D9B74;
+constexpr uint32_t MKV_SEEK = 0x4DBB;
+constexpr uint32_t MKV_SEEKID = 0x53AB;
+constexpr uint32_t MKV_SEEKPOSITION = 0x53AC;
+constexpr uint32_t MKV_INFO = 0x1549A966;
+constexpr uint32_t MKV_TIMESTAMPSCALE = 0x2AD7B1;
+constexpr uint32_t MKV_DURATION = 0x4489;
+constexpr uint32_t MKV_TRACKS = 0x1654AE6B;
+constexpr uint32_t MKV_TRACKENTRY = 0xAE;
+constexpr uint32_t MKV_TRACKTYPE = 0x83;
+constexpr uint32_t MKV_NAME = 0x536E;
+constexpr uint32_t MKV_LANGUAGE = 0x22B59C;
+constexpr uint32_t MKV_CODECID = 0x86;
+constexpr uint32_t MKV_CODECPRIVATE = 0x63A2;
+constexpr uint32_t MKV_BLOCKADDITIONMAPPING = 0x41E4;
+constexpr uint32_t MKV_BLOCKADDIDTYPE = 0x41E7;
+constexpr uint32_t MKV_VIDEO = 0xE0;
+constexpr uint32_t MKV_PIXELWIDTH = 0xB0;
+constexpr uint32_t MKV_PIXELHEIGHT = 0xBA;
+constexpr uint32_t MKV_DISPLAYWIDTH = 0x54B0;
+constexpr uint32_t MKV_DISPLAYHEIGHT = 0x54BA;
+constexpr uint32_t MKV_DISPLAYUNIT = 0x54B2;
+constexpr uint32_t MKV_STEREOMODE = 0x53B8;
+constexpr uint32_t MKV_COLOUR = 0x55B0;
+constexpr uint32_t MKV_TRANSFERCHARACTERISTICS = 0x55BA;
+constexpr uint32_t MKV_MASTERINGMETADATA = 0x55D0;
+constexpr uint32_t MKV_AUDIO = 0xE1;
+constexpr uint32_t MKV_CHANNELS = 0x9F;
+constexpr uint32_t MKV_BITDEPTH = 0x6264;
+constexpr uint32_t MKV_TAGS = 0x1254C367;
+constexpr uint32_t MKV_TAG = 0x7373;
+constexpr uint32_t MKV_SIMPLETAG = 0x67C8;
+constexpr uint32_t MKV_TAGNAME = 0x45A3;
+constexpr uint32_t MKV_CLUSTER = 0x1F43B675;
+
+constexpr uint64_t MKV_TRACKTYPE_VIDEO = 1;
+constexpr uint64_t MKV_TRACKTYPE_AUDIO = 2;
+constexpr uint64_t MKV_TRACKTYPE_SUBTITLE = 0x11;
+
+// transfer characteristics of ISO/IEC 23091-2, as used by both containers
+constexpr uint64_t TRANSFER_UNSPECIFIED = 2;
+constexpr uint64_t TRANSFER_PQ = 16;
+constexpr uint64_t TRANSFER_HLG = 18;
+
+constexpr uint32_t FourCC(const char (&code)[5])
+{
+  return static_cast<uint32_t>(static_cast<uint8_t>(code[0])) << 24 |
+         static_cast<uint32_t>(static_cast<uint8_t>(code[1])) << 16 |
+         static_cast<uint32_t>(static_cast<uint8_t>(code[2])) << 8 |
+         static_cast<uint32_t>(static_cast<uint8_t>(code[3]));
+}
+
+struct TrackInfo
+{
+  CStreamDetail::StreamType type;
+  std::string codec;
+  std::string language;
+  int width = 0;
+  int height = 0;
+  float aspect = 0.0f;
+  StreamHdrType hdrType = StreamHdrType::HDR_TYPE_NONE;
+  int channels = 0;
+};
+
+struct ContainerInfo
+{
+  std::vector<TrackInfo> tracks;
+  int64_t durationMs = 0;
+};
+
+/*!
+ * \brief Big endian reads from a buffer, reading past its end fails all further reads
+ */
+class CByteReader
+{
+public:
+  CByteReader(const uint8_t* data, size_t size) : m_data(data), m_size(size) {}
+
+  bool Failed() const { return m_failed; }
+  size_t Left() const { return m_size - m_pos; }
+  const uint8_t* Current() const { return m_data + m_pos; }
+
+  bool Skip(uint64_t bytes)
+  {
+    if (bytes > Left())
+    {
+      m_failed = true;
+      m_pos = m_size;
+      return false;
+    }
+    m_pos += static_cast<size_t>(bytes);
+    return true;
+  }
+
+  uint64_t Read(size_t bytes)
+  {
+    if (bytes > Left() || bytes > 8)
+    {
+      m_failed = true;
+      m_pos = m_size;
+      return 0;
+    }
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; ++i)
+      value = value << 8 | m_data[m_pos++];
+    return value;
+  }
+
+private:
+  const uint8_t* m_data;
+  size_t m_size;
+  size_t m_pos = 0;
+  bool m_failed = false;
+};
+
+/*!
+ * \brief Cached reads of whole blocks of a file
+ */
+class CBlockReader
+{
+public:
+  CBlockReader(XFILE::CFile& file, uint64_t size) : m_file(file), m_size(size) {}
+
+  bool Read(uint64_t offset, size_t size, std::vector<uint8_t>& data)
+  {
+    if (offset > m_size || size > m_size - offset)
+      return false;
+
+    data.resize(size);
+    size_t done = 0;
+    while (done < size)
+    {
+      const uint64_t position = offset + done;
+      const std::vector<uint8_t>* block = GetBlock(position / BLOCK_SIZE);
+      const size_t inBlock = static_cast<size_t>(position % BLOCK_SIZE);
+      if (!block || inBlock >= block->size())
+        return false;
+
+      const size_t bytes = std::min(size - done, block->size() - inBlock);
+      std::memcpy(data.data() + done, block->data() + inBlock, bytes);
+      done += bytes;
+    }
+    return true;
+  }
+
+private:
+  const std::vector<uint8_t>* GetBlock(uint64_t index)
+  {
+    const auto it = m_blocks.find(index);
+    if (it != m_blocks.end())
+      return &it->second;
+
+    if (m_read + BLOCK_SIZE > READ_BUDGET || m_file.Seek(index * BLOCK_SIZE, SEEK_SET) < 0)
+      return nullptr;
+    m_read += BLOCK_SIZE;
+
+    std::vector<uint8_t> block(BLOCK_SIZE);
+    size_t filled = 0;
+    while (filled < block.size())
+    {
+      const ssize_t bytes = m_file.Read(block.data() + filled, block.size() - filled);
+      if (bytes <= 0)
+        break;
+      filled += static_cast<size_t>(bytes);
+    }
+    if (filled == 0)
+      return nullptr;
+
+    block.resize(filled);
+    return &m_blocks.emplace(index, std::move(block)).first->second;
+  }
+
+  XFILE::CFile& m_file;
+  uint64_t m_size;
+  uint64_t m_read = 0;
+  std::map<uint64_t, std::vector<uint8_t>> m_blocks;
+};
+
+bool ReadPayload(const CDVDContainerInspector::ReadFunc& read,
+                 uint64_t fileSize,
+                 uint64_t offset,
+                 uint64_t size,
+                 std::vector<uint8_t>& data)
+{
+  if (size > MAX_ELEMENT_SIZE || offset > fileSize || size > fileSize - offset)
+    return false;
+  return read(offset, static_cast<size_t>(size), data);
+}
+
+/*!
+ * \brief Codec name and channels of an AAC AudioSpecificConfig, as the decoder reports them
+ */
+bool ParseAacConfig(const uint8_t* data, size_t size, std::string& codec, int& channels)
+{
+  uint64_t bits = 0;
+  const size_t bytes = std::min<size_t>(size, 8);
+  for (size_t i = 0; i < bytes; ++i)
+    bits |= static_cast<uint64_t>(data[i]) << (56 - 8 * i);
+
+  size_t position = 0;
+  bool ok = true;
+  const auto get = [&](size_t count) -> uint32_t
+  {
+    if (position + count > bytes * 8)
+    {
+      ok = false;
+      return 0;
+    }
+    const uint64_t value = (bits << position) >> (64 - count);
+    position += count;
+    return static_cast<uint32_t>(value);
+  };
+
+  int objectType = get(5);
+  if (objectType == 31)
+    objectType = 32 + get(6);
+
+  static constexpr std::array<unsigned int, 13> sampleRates{
+      96000, 88200, 64000, 48000, 44100, 32000, 24000, 22050, 16000, 12000, 11025, 8000, 7350};
+  const unsigned int rateIndex = get(4);
+  unsigned int sampleRate = 0;
+  if (rateIndex == 15)
+    sampleRate = get(24);
+  else if (rateIndex < sampleRates.size())
+    sampleRate = sampleRates[rateIndex];
+
+  static constexpr std::array<int, 15> configChannels{0, 1, 2, 3, 4, 5, 6, 8, 0, 0, 0, 7, 8, 24, 8};
+  const unsigned int channelConfig = get(4);
+  if (!ok || channelConfig >= configChannels.size() || configChannels[channelConfig] == 0)
+    return false;
+  channels = configChannels[channelConfig];
+
+  switch (objectType)
+  {
+    case 2:
+      // SBR may be signalled in the bitstream only, the decoder would report HE-AAC then
+      if (sampleRate <= 24000)
+        return false;
+      codec = "aac_lc";
+      break;
+    case 3:
+      codec = "aac_ssr";
+      break;
+    case 4:
+      codec = "aac_ltp";
+      break;
+    case 5:
+      codec = "he_aac";
+      break;
+    case 29:
+      codec = "he_aac_v2";
+      // parametric stereo is decoded to two channels
+      channels = std::max(channels, 2);
+      break;
+    default:
+      codec = "aac";
+      break;
+  }
+  return true;
+}
+
+// Matroska
+
+struct EbmlElement
+{
+  uint32_t id = 0;
+  uint64_t size = 0;
+  bool unknownSize = false;
+  size_t headerSize = 0;
+};
+
+bool ReadVint(CByteReader& reader,
+              size_t maxLength,
+              bool keepMarker,
+              uint64_t& value,
+              size_t& length,
+              bool& allOnes)
+{
+  const uint8_t first = static_cast<uint8_t>(reader.Read(1));
+  if (reader.Failed() || first == 0)
+    return false;
+
+  length = static_cast<size_t>(std::countl_zero(first)) + 1;
+  if (length > maxLength)
+    return false;
+
+  const uint8_t mask = static_cast<uint8_t>(0xFF >> length);
+  value = keepMarker ? first : first & mask;
+  allOnes = (first & mask) == mask;
+  for (size_t i = 1; i < length; ++i)
+  {
+    const uint8_t next = static_cast<uint8_t>(reader.Read(1));
+    allOnes = allOnes && next == 0xFF;
+    value = value << 8 | next;
+  }
+  return !reader.Failed();
+}
+
+bool ReadElementHeader(CByteReader& reader, EbmlElement& element)
+{
+  uint64_t id = 0;
+  size_t idLength = 0;
+  size_t sizeLength = 0;
+  bool allOnes = false;
+  if (!ReadVint(reader, 4, true, id, idLength, allOnes) ||
+      !ReadVint(reader, 8, false, element.size, sizeLength, element.unknownSize))
+    return false;
+
+  element.id = static_cast<uint32_t>(id);
+  element.headerSize = idLength + sizeLength;
+  return true;
+}
+
+bool ReadElementHeader(const CDVDContainerInspector::ReadFunc& read,
+                       uint64_t fileSize,
+                       uint64_t offset,
+                       EbmlElement& element)
+{
+  std::vector<uint8_t> data;
+  if (offset >= fileSize ||
+      !read(offset, static_cast<size_t>(std::min<uint64_t>(12, fileSize - offset)), data))
+    return false;
+
+  CByteReader reader(data.data(), data.size());
+  return ReadElementHeader(reader, element);
+}
+
+/*!
+ * \brief Call child for each element in the payload of a master element
+ * \return false if the payload is malformed or child returned false
+ */
+using EbmlChildFunc = std::function<bool(uint32_t id, const uint8_t* data, size_t size)>;
+
+bool ParseEbmlChildren(const uint8_t* data, size_t size, const EbmlChildFunc& child)
+{
+  CByteReader reader(data, size);
+  while (reader.Left() > 0)
+  {
+    EbmlElement element;
+    if (!ReadElementHeader(reader, element) || element.unknownSize || element.size > reader.Left())
+      return false;
+
+    const uint8_t* payload = reader.Current();
+    reader.Skip(element.size);
+    if (!child(element.id, payload, static_cast<size_t>(element.size)))
+      return false;
+  }
+  return true;
+}
+
+uint64_t EbmlUInt(const uint8_t* data, size_t size)
+{
+  CByteReader reader(data, size);
+  return reader.Read(size);
+}
+
+double EbmlFloat(const uint8_t* data, size_t size)
+{
+  CByteReader reader(data, size);
+  if (size == 4)
+    return std::bit_cast<float>(static_cast<uint32_t>(reader.Read(4)));
+  if (size == 8)
+    return std::bit_cast<double>(reader.Read(8));
+  return 0.0;
+}
+
+std::string EbmlString(const uint8_t* data, size_t size)
+{
+  const auto* text = reinterpret_cast<const char*>(data);
+  return std::string(text, std::find(text, text + size, '\0'));
+}
+
+bool ParseMatroskaInfo(const uint8_t* data, size_t size, ContainerInfo& info)
+{
+  uint64_t timestampScale = 1000000;
+  double duration = 0.0;
+  if (!ParseEbmlChildren(data, size,
+                         [&](uint32_t id, const uint8_t* child, size_t childSize)
+                         {
+                           if (id == MKV_TIMESTAMPSCALE)
+                             timestampScale = EbmlUInt(child, childSize);
+                           else if (id == MKV_DURATION)
+                             duration = EbmlFloat(child, childSize);
+                           return true;
+                         }))
+    return false;
+
+  // live recordings have no duration, which the demuxer works out from the last cluster
+  info.durationMs =
+      static_cast<int64_t>(duration * static_cast<double>(timestampScale) / 1000000.0);
+  return info.durationMs > 0;
+}
+
+bool ParseMatroskaVideo(const std::string& codecId,
+                        const uint8_t* data,
+                        size_t size,
+                        TrackInfo& track)
+{
+  static const std::map<std::string_view, std::string_view> codecs{
+      {"V_MPEG4/ISO/AVC", "h264"}, {"V_MPEGH/ISO/HEVC", "hevc"}, {"V_AV1", "av1"},
+      {"V_VP9", "vp9"},            {"V_VP8", "vp8"},             {"V_MPEG2", "mpeg2video"},
+      {"V_MPEG4/ISO/ASP", "mpeg4"}, {"V_MPEG4/ISO/SP", "mpeg4"}, {"V_MPEG4/ISO/AP", "mpeg4"},
+      {"V_THEORA", "theora"}};
+  const auto codec = codecs.find(codecId);
+  if (codec == codecs.end())
+    return false;
+  track.codec = codec->second;
+
+  uint64_t pixelWidth = 0;
+  uint64_t pixelHeight = 0;
+  uint64_t displayWidth = 0;
+  uint64_t displayHeight = 0;
+  uint64_t displayUnit = 0;
+  uint64_t stereoMode = 0;
+  uint64_t transfer = TRANSFER_UNSPECIFIED;
+  const auto colour = [&transfer](uint32_t id, const uint8_t* child, size_t childSize)
+  {
+    if (id == MKV_TRANSFERCHARACTERISTICS)
+      transfer = EbmlUInt(child, childSize);
+    // static HDR metadata makes it HDR10 whatever the transfer says
+    return id != MKV_MASTERINGMETADATA;
+  };
+  if (!ParseEbmlChildren(data, size,
+                         [&](uint32_t id, const uint8_t* child, size_t childSize)
+                         {
+                           switch (id)
+                           {
+                             case MKV_PIXELWIDTH:
+                               pixelWidth = EbmlUInt(child, childSize);
+                               break;
+                             case MKV_PIXELHEIGHT:
+                               pixelHeight = EbmlUInt(child, childSize);
+                               break;
+                             case MKV_DISPLAYWIDTH:
+                               displayWidth = EbmlUInt(child, childSize);
+                               break;
+                             case MKV_DISPLAYHEIGHT:
+                               displayHeight = EbmlUInt(child, childSize);
+                               break;
+                             case MKV_DISPLAYUNIT:
+                               displayUnit = EbmlUInt(child, childSize);
+                               break;
+                             case MKV_STEREOMODE:
+                               stereoMode = EbmlUInt(child, childSize);
+                               break;
+                             case MKV_COLOUR:
+                               return ParseEbmlChildren(child, childSize, colour);
+                             default:
+                               break;
+                           }
+                           return true;
+                         }))
+    return false;
+
+  if (stereoMode != 0 || transfer == TRANSFER_PQ || pixelWidth == 0 || pixelHeight == 0)
+    return false;
+
+  if (transfer == TRANSFER_HLG)
+    track.hdrType = StreamHdrType::HDR_TYPE_HLG;
+  // these carry their HDR signalling in the bitstream when the container has none
+  else if (transfer == TRANSFER_UNSPECIFIED &&
+           (track.codec == "hevc" || track.codec == "av1" || track.codec == "vp9"))
+    return false;
+
+  track.width = static_cast<int>(pixelWidth);
+  track.height = static_cast<int>(pixelHeight);
+  if (displayWidth > 0 && displayHeight > 0 && displayUnit <= 3)
+    track.aspect = static_cast<float>(displayWidth) / static_cast<float>(displayHeight);
+  return true;
+}
+
+bool ParseMatroskaAudio(const std::string& codecId,
+                        const uint8_t* codecPrivate,
+                        size_t codecPrivateSize,
+                        const uint8_t* data,
+                        size_t size,
+                        TrackInfo& track)
+{
+  uint64_t channels = 1;
+  uint64_t bitDepth = 0;
+  if (!ParseEbmlChildren(data, size,
+                         [&](uint32_t id, const uint8_t* child, size_t childSize)
+                         {
+                           if (id == MKV_CHANNELS)
+                             channels = EbmlUInt(child, childSize);
+                           else if (id == MKV_BITDEPTH)
+                             bitDepth = EbmlUInt(child, childSize);
+                           return true;
+                         }))
+    return false;
+  track.channels = static_cast<int>(channels);
+
+  if (codecId == "A_AAC")
+    return codecPrivate &&
+           ParseAacConfig(codecPrivate, codecPrivateSize, track.codec, track.channels);
+
+  if (codecId.starts_with("A_PCM/"))
+  {
+    static const std::map<std::pair<std::string_view, uint64_t>, std::string_view> pcm{
+        {{"A_PCM/INT/LIT", 8}, "pcm_u8"},       {{"A_PCM/INT/LIT", 16}, "pcm_s16le"},
+        {{"A_PCM/INT/LIT", 24}, "pcm_s24le"},   {{"A_PCM/INT/LIT", 32}, "pcm_s32le"},
+        {{"A_PCM/INT/BIG", 16}, "pcm_s16be"},   {{"A_PCM/INT/BIG", 24}, "pcm_s24be"},
+        {{"A_PCM/INT/BIG", 32}, "pcm_s32be"},   {{"A_PCM/FLOAT/IEEE", 32}, "pcm_f32le"},
+        {{"A_PCM/FLOAT/IEEE", 64}, "pcm_f64le"}};
+    const auto codec = pcm.find({codecId, bitDepth});
+    if (codec == pcm.end())
+      return false;
+    track.codec = codec->second;
+    return true;
+  }
+
+  // DTS, E-AC-3 and TrueHD are named by the profile found in their frames
+  static const std::map<std::string_view, std::string_view> codecs{
+      {"A_AC3", "ac3"},       {"A_FLAC", "flac"},    {"A_OPUS", "opus"}, {"A_VORBIS", "vorbis"},
+      {"A_MPEG/L3", "mp3"}, {"A_MPEG/L2", "mp2"}, {"A_ALAC", "alac"}};
+  const auto codec = codecs.find(codecId);
+  if (codec == codecs.end())
+    return false;
+  track.codec = codec->second;
+  return true;
+}
+
+bool ParseMatroskaTrack(const uint8_t* data, size_t size, ContainerInfo& info)
+{
+  uint64_t type = 0;
+  std::string codecId;
+  std::string language = "eng";
+  std::string name;
+  const uint8_t* codecPrivate = nullptr;
+  size_t codecPrivateSize = 0;
+  const uint8_t* video = nullptr;
+  size_t videoSize = 0;
+  const uint8_t* audio = nullptr;
+  size_t audioSize = 0;
+
+  // Dolby Vision configuration of the track, its details come from the frames
+  const auto mapping = [](uint32_t id, const uint8_t* child, size_t childSize)
+  {
+    if (id != MKV_BLOCKADDIDTYPE)
+      return true;
+    const uint64_t addIdType = EbmlUInt(child, childSize);
+    return addIdType != FourCC("dvcC") && addIdType != FourCC("dvvC") &&
+           addIdType != FourCC("dvwC");
+  };
+  if (!ParseEbmlChildren(data, size,
+                         [&](uint32_t id, const uint8_t* child, size_t childSize)
+                         {
+                           switch (id)
+                           {
+                             case MKV_TRACKTYPE:
+                               type = EbmlUInt(child, childSize);
+                               break;
+                             case MKV_CODECID:
+                               codecId = EbmlString(child, childSize);
+                               break;
+                             case MKV_LANGUAGE:
+                               language = EbmlString(child, childSize);
+                               break;
+                             case MKV_NAME:
+                               name = EbmlString(child, childSize);
+                               break;
+                             case MKV_CODECPRIVATE:
+                               codecPrivate = child;
+                               codecPrivateSize = childSize;
+                               break;
+                             case MKV_VIDEO:
+                               video = child;
+                               videoSize = childSize;
+                               break;
+                             case MKV_AUDIO:
+                               audio = child;
+                               audioSize = childSize;
+                               break;
+                             case MKV_BLOCKADDITIONMAPPING:
+                               return ParseEbmlChildren(child, childSize, mapping);
+                             default:
+                               break;
+                           }
+                           return true;
+                         }))
+    return false;
+
+  TrackInfo track;
+  if (type == MKV_TRACKTYPE_VIDEO)
+  {
+    track.type = CStreamDetail::VIDEO;
+    if (!video || !ParseMatroskaVideo(codecId, video, videoSize, track))
+      return false;
+  }
+  else if (type == MKV_TRACKTYPE_AUDIO)
+  {
+    track.type = CStreamDetail::AUDIO;
+    if (!ParseMatroskaAudio(codecId, codecPrivate, codecPrivateSize, audio, audioSize, track))
+      return false;
+  }
+  else if (type == MKV_TRACKTYPE_SUBTITLE)
+    track.type = CStreamDetail::SUBTITLE;
+  else
+    return true;
+
+  // same as the demuxer: "und" is no language, a language code in the name replaces it
+  if (language != "und")
+  {
+    track.language = language.substr(0, 3);
+    if (!name.empty())
+    {
+      const std::string languageCode = g_LangCodeExpander.FindLanguageCodeWithSubtag(name);
+      if (!languageCode.empty())
+        track.language = languageCode;
+    }
+  }
+
+  info.tracks.push_back(std::move(track));
+  return true;
+}
+
+bool ParseMatroskaTracks(const uint8_t* data, size_t size, ContainerInfo& info)
+{
+  return ParseEbmlChildren(
+      data, size,
+      [&info](uint32_t id, const uint8_t* child, size_t childSize)
+      { return id != MKV_TRACKENTRY || ParseMatroskaTrack(child, childSize, info); });
+}
+
+bool ParseMatroskaTags(const uint8_t* data, size_t size)
+{
+  // a stereo mode given by a tag
+  const auto simpleTag = [](uint32_t id, const uint8_t* child, size_t childSize)
+  {
+    return id != MKV_TAGNAME ||
+           !StringUtils::EqualsNoCase(EbmlString(child, childSize), "stereo_mode");
+  };
+  const auto tag = [&simpleTag](uint32_t id, const uint8_t* child, size_t childSize)
+  { return id != MKV_SIMPLETAG || ParseEbmlChildren(child, childSize, simpleTag); };
+  return ParseEbmlChildren(data, size,
+                           [&tag](uint32_t id, const uint8_t* child, size_t childSize)
+                           { return id != MKV_TAG || ParseEbmlChildren(child, childSize, tag); });
+}
+
+bool ParseMatroska(const CDVDContainerInspector::ReadFunc& read,
+                   uint64_t fileSize,
+                   ContainerInfo& info)
+{
+  std::vector<uint8_t> data;
+  EbmlElement header;
+  if (!ReadElementHeader(read, fileSize, 0, header) || header.id != MKV_EBML ||
+      header.unknownSize || !ReadPayload(read, fileSize, header.headerSize, header.size, data))
+    return false;
+
+  std::string docType;
+  if (!ParseEbmlChildren(data.data(), data.size(),
+                         [&docType](uint32_t id, const uint8_t* child, size_t childSize)
+                         {
+                           if (id == MKV_DOCTYPE)
+                             docType = EbmlString(child, childSize);
+                           return true;
+                         }) ||
+      (docType != "matroska" && docType != "webm"))
+    return false;
+
+  const uint64_t segmentOffset = header.headerSize + header.size;
+  EbmlElement segment;
+  if (!ReadElementHeader(read, fileSize, segmentOffset, segment) || segment.id != MKV_SEGMENT)
+    return false;
+
+  const uint64_t segmentData = segmentOffset + segment.headerSize;
+  const uint64_t segmentEnd =
+      segment.unknownSize ? fileSize : std::min(fileSize, segmentData + segment.size);
+
+  // the top level elements up to the first cluster, the seek head tells where the others are
+  std::map<uint32_t, uint64_t> seekPositions;
+  bool haveInfo = false;
+  bool haveTracks = false;
+  bool haveTags = false;
+  const auto parseElement = [&](const EbmlElement& element, uint64_t offset)
+  {
+    if (element.id != MKV_SEEKHEAD && element.id != MKV_INFO && element.id != MKV_TRACKS &&
+        element.id != MKV_TAGS)
+      return true;
+    if (!ReadPayload(read, fileSize, offset + element.headerSize, element.size, data))
+      return false;
+
+    switch (element.id)
+    {
+      case MKV_SEEKHEAD:
+        return ParseEbmlChildren(
+            data.data(), data.size(),
+            [&seekPositions](uint32_t id, const uint8_t* seek, size_t seekSize)
+            {
+              if (id != MKV_SEEK)
+                return true;
+              uint64_t seekId = 0;
+              uint64_t position = 0;
+              const bool valid = ParseEbmlChildren(
+                  seek, seekSize,
+                  [&](uint32_t seekChild, const uint8_t* child, size_t childSize)
+                  {
+                    if (seekChild == MKV_SEEKID)
+                      seekId = EbmlUInt(child, childSize);
+                    else if (seekChild == MKV_SEEKPOSITION)
+                      position = EbmlUInt(child, childSize);
+                    return true;
+                  });
+              seekPositions.emplace(static_cast<uint32_t>(seekId), position);
+              return valid;
+            });
+      case MKV_INFO:
+        haveInfo = true;
+        return ParseMatroskaInfo(data.data(), data.size(), info);
+      case MKV_TRACKS:
+        haveTracks = true;
+        return ParseMatroskaTracks(data.data(), data.size(), info);
+      default:
+        haveTags = true;
+        return ParseMatroskaTags(data.data(), data.size());
+    }
+  };
+
+  uint64_t offset = segmentData;
+  for (int i = 0; i < MAX_TOP_LEVEL && offset < segmentEnd && !(haveInfo && haveTracks); ++i)
+  {
+    EbmlElement element;
+    if (!ReadElementHeader(read, fileSize, offset, element) || element.id == MKV_CLUSTER)
+      break;
+    if (element.unknownSize || !parseElement(element, offset))
+      return false;
+    offset += element.headerSize + element.size;
+  }
+
+  for (const uint32_t id : {MKV_INFO, MKV_TRACKS, MKV_TAGS})
+  {
+    const bool have = id == MKV_INFO ? haveInfo : id == MKV_TRACKS ? haveTracks : haveTags;
+    const auto it = seekPositions.find(id);
+    if (have || it == seekPositions.end())
+      continue;
+
+    EbmlElement element;
+    const uint64_t position = segmentData + it->second;
+    if (!ReadElementHeader(read, fileSize, position, element) || element.id != id ||
+        element.unknownSize || !parseElement(element, position))
+      return false;
+  }
+
+  return haveInfo && haveTracks;
+}
+
+// MP4 and QuickTime
+
+struct Box
+{
+  uint32_t type = 0;
+  uint64_t offset = 0;
+  uint64_t headerSize = 0;
+  uint64_t size = 0; //!< including the header
+};
+
+bool ReadBoxHeader(const CDVDContainerInspector::ReadFunc& read,
+                   uint64_t offset,
+                   uint64_t end,
+                   Box& box)
+{
+  std::vector<uint8_t> data;
+  if (end < offset || end - offset < 8 ||
+      !read(offset, static_cast<size_t>(std::min<uint64_t>(16, end - offset)), data))
+    return false;
+
+  CByteReader reader(data.data(), data.size());
+  const uint64_t size = reader.Read(4);
+  box.type = static_cast<uint32_t>(reader.Read(4));
+  box.offset = offset;
+  box.headerSize = 8;
+  if (size == 1)
+  {
+    box.size = reader.Read(8);
+    box.headerSize = 16;
+  }
+  else if (size == 0)
+    box.size = end - offset;
+  else
+    box.size = size;
+
+  return !reader.Failed() && box.size >= box.headerSize && box.size <= end - offset;
+}
+
+/*!
+ * \brief Call child for each box between begin and end of the file, reading their headers only
+ */
+bool ParseBoxes(const CDVDContainerInspector::ReadFunc& read,
+                uint64_t begin,
+                uint64_t end,
+                const std::function<bool(const Box& box)>& child)
+{
+  Box box;
+  for (uint64_t offset = begin; end - offset >= 8; offset += box.size)
+  {
+    if (!ReadBoxHeader(read, offset, end, box) || !child(box))
+      return false;
+  }
+  return true;
+}
+
+/*!
+ * \brief Call child for each box in a buffer
+ */
+bool ParseBoxes(const uint8_t* data,
+                size_t size,
+                const std::function<bool(uint32_t type, const uint8_t* data, size_t size)>& child)
+{
+  CByteReader reader(data, size);
+  while (reader.Left() >= 8)
+  {
+    uint64_t boxSize = reader.Read(4);
+    const uint32_t type = static_cast<uint32_t>(reader.Read(4));
+    uint64_t headerSize = 8;
+    if (boxSize == 1)
+    {
+      boxSize = reader.Read(8);
+      headerSize = 16;
+    }
+    else if (boxSize == 0)
+      boxSize = reader.Left() + headerSize;
+
+    if (reader.Failed() || boxSize < headerSize || boxSize - headerSize > reader.Left())
+      return false;
+
+    const uint8_t* payload = reader.Current();
+    reader.Skip(boxSize - headerSize);
+    if (!child(type, payload, static_cast<size_t>(boxSize - headerSize)))
+      return false;
+  }
+  return true;
+}
+
+bool ReadBoxPayload(const CDVDContainerInspector::ReadFunc& read,
+                    uint64_t fileSize,
+                    const Box& box,
+                    std::vector<uint8_t>& data)
+{
+  return ReadPayload(read, fileSize, box.offset + box.headerSize, box.size - box.headerSize, data);
+}
+
+/*!
+ * \brief Object type and decoder specific info of an esds box
+ */
+bool ParseEsds(const uint8_t* data,
+               size_t size,
+               uint8_t& objectType,
+               const uint8_t*& config,
+               size_t& configSize)
+{
+  CByteReader reader(data, size);
+  reader.Skip(4); // version and flags
+
+  const auto descriptor = [&reader](uint8_t expectedTag, size_t& length)
+  {
+    const uint8_t tag = static_cast<uint8_t>(reader.Read(1));
+    length = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+      const uint8_t next = static_cast<uint8_t>(reader.Read(1));
+      length = length << 7 | (next & 0x7F);
+      if (!(next & 0x80))
+        break;
+    }
+    return !reader.Failed() && tag == expectedTag && length <= reader.Left();
+  };
+
+  size_t length = 0;
+  if (!descriptor(0x03, length)) // ES_Descriptor
+    return false;
+  reader.Skip(2); // ES_ID
+  const uint8_t flags = static_cast<uint8_t>(reader.Read(1));
+  if (flags & 0x80)
+    reader.Skip(2);
+  if (flags & 0x40)
+    reader.Skip(reader.Read(1));
+  if (flags & 0x20)
+    reader.Skip(2);
+
+  if (!descriptor(0x04, length) || length < 13) // DecoderConfigDescriptor
+    return false;
+  objectType = static_cast<uint8_t>(reader.Read(1));
+  reader.Skip(12);
+
+  config = nullptr;
+  configSize = 0;
+  if (reader.Left() > 0 && descriptor(0x05, length)) // DecoderSpecificInfo
+  {
+    config = reader.Current();
+    configSize = length;
+  }
+  return true;
+}
+
+bool ParseMp4Video(uint32_t format, const uint8_t* data, size_t size, TrackInfo& track)
+{
+  constexpr size_t VIDEO_SAMPLE_ENTRY_SIZE = 78;
+  if (size < VIDEO_SAMPLE_ENTRY_SIZE)
+    return false;
+
+  CByteReader reader(data, size);
+  reader.Skip(24);
+  track.width = static_cast<int>(reader.Read(2));
+  track.height = static_cast<int>(reader.Read(2));
+  if (track.width == 0 || track.height == 0)
+    return false;
+
+  // Dolby Vision sample entries and unknown formats are left to the demuxer
+  static const std::map<uint32_t, std::string_view> codecs{
+      {FourCC("avc1"), "h264"}, {FourCC("avc3"), "h264"}, {FourCC("hvc1"), "hevc"},
+      {FourCC("hev1"), "hevc"}, {FourCC("av01"), "av1"},  {FourCC("vp09"), "vp9"},
+      {FourCC("vp08"), "vp8"},  {FourCC("mp4v"), ""}};
+  const auto codec = codecs.find(format);
+  if (codec == codecs.end())
+    return false;
+  track.codec = codec->second;
+
+  uint64_t transfer = TRANSFER_UNSPECIFIED;
+  uint64_t hSpacing = 0;
+  uint64_t vSpacing = 0;
+  if (!ParseBoxes(data + VIDEO_SAMPLE_ENTRY_SIZE, size - VIDEO_SAMPLE_ENTRY_SIZE,
+                  [&](uint32_t type, const uint8_t* child, size_t childSize)
+                  {
+                    CByteReader box(child, childSize);
+                    if (type == FourCC("colr"))
+                    {
+                      const uint32_t colourType = static_cast<uint32_t>(box.Read(4));
+                      if (colourType == FourCC("nclx") || colourType == FourCC("nclc"))
+                      {
+                        box.Skip(2); // colour primaries
+                        transfer = box.Read(2);
+                      }
+                    }
+                    else if (type == FourCC("vpcC") && box.Read(1) >= 1)
+                    {
+                      box.Skip(6); // flags, profile, level, bit depth and chroma, primaries
+                      if (transfer == TRANSFER_UNSPECIFIED)
+                        transfer = box.Read(1);
+                    }
+                    else if (type == FourCC("pasp"))
+                    {
+                      hSpacing = box.Read(4);
+                      vSpacing = box.Read(4);
+                    }
+                    else if (type == FourCC("esds"))
+                    {
+                      uint8_t objectType = 0;
+                      const uint8_t* config = nullptr;
+                      size_t configSize = 0;
+                      if (!ParseEsds(child, childSize, objectType, config, configSize))
+                        return false;
+                      if (objectType == 0x20)
+                        track.codec = "mpeg4";
+                      else if (objectType >= 0x60 && objectType <= 0x65)
+                        track.codec = "mpeg2video";
+                    }
+                    // Dolby Vision, static HDR metadata and stereoscopic video
+                    return type != FourCC("dvcC") && type != FourCC("dvvC") &&
+                           type != FourCC("dvwC") && type != FourCC("mdcv") &&
+                           type != FourCC("st3d") && !box.Failed();
+                  }))
+    return false;
+
+  if (track.codec.empty() || transfer == TRANSFER_PQ)
+    return false;
+
+  if (transfer == TRANSFER_HLG)
+    track.hdrType = StreamHdrType::HDR_TYPE_HLG;
+  else if (transfer == TRANSFER_UNSPECIFIED &&
+           (track.codec == "hevc" || track.codec == "av1" || track.codec == "vp9"))
+    return false;
+
+  // without a pasp box the pixels are taken as square
+  if (hSpacing > 0 && vSpacing > 0)
+    track.aspect = static_cast<float>(track.width * hSpacing) /
+                   static_cast<float>(track.height * vSpacing);
+  return true;
+}
+
+bool ParseMp4Audio(uint32_t format, const uint8_t* data, size_t size, TrackInfo& track)
+{
+  constexpr size_t AUDIO_SAMPLE_ENTRY_SIZE = 28;
+  if (size < AUDIO_SAMPLE_ENTRY_SIZE)
+    return false;
+
+  CByteReader reader(data, size);
+  reader.Skip(8);
+  // the QuickTime versions 1 and 2 entries have more fields, left to the demuxer
+  if (reader.Read(2) != 0)
+    return false;
+  reader.Skip(6);
+  track.channels = static_cast<int>(reader.Read(2));
+
+  static const std::map<uint32_t, std::string_view> codecs{
+      {FourCC("mp4a"), ""},     {FourCC("ac-3"), "ac3"},  {FourCC("fLaC"), "flac"},
+      {FourCC("Opus"), "opus"}, {FourCC("alac"), "alac"}, {FourCC(".mp3"), "mp3"}};
+  const auto codec = codecs.find(format);
+  if (codec == codecs.end())
+    return false;
+  track.codec = codec->second;
+
+  if (!ParseBoxes(data + AUDIO_SAMPLE_ENTRY_SIZE, size - AUDIO_SAMPLE_ENTRY_SIZE,
+                  [&](uint32_t type, const uint8_t* child, size_t childSize)
+                  {
+                    if (type == FourCC("dac3") && childSize >= 3)
+                    {
+                      static constexpr std::array<int, 8> acmodChannels{2, 1, 2, 3, 3, 4, 4, 5};
+                      track.channels =
+                          acmodChannels[(child[1] >> 3) & 0x07] + ((child[1] >> 2) & 0x01);
+                    }
+                    else if (type == FourCC("esds") && format == FourCC("mp4a"))
+                    {
+                      uint8_t objectType = 0;
+                      const uint8_t* config = nullptr;
+                      size_t configSize = 0;
+                      if (!ParseEsds(child, childSize, objectType, config, configSize))
+                        return false;
+
+                      if (objectType == 0x40 || (objectType >= 0x66 && objectType <= 0x68))
+                        return config && ParseAacConfig(config, configSize, track.codec,
+                                                        track.channels);
+                      if (objectType == 0x69 || objectType == 0x6B)
+                        track.codec = "mp3";
+                      else if (objectType == 0xA5)
+                        track.codec = "ac3";
+                      else if (objectType == 0xAD)
+                        track.codec = "opus";
+                    }
+                    return true;
+                  }))
+    return false;
+
+  return !track.codec.empty() && track.channels > 0;
+}
+
+bool ParseMp4Language(uint16_t code, std::string& language)
+{
+  // packed ISO 639-2/T code
+  if (code >= 0x400 && code != 0x7FFF)
+  {
+    language = {static_cast<char>(0x60 + ((code >> 10) & 0x1F)),
+                static_cast<char>(0x60 + ((code >> 5) & 0x1F)),
+                static_cast<char>(0x60 + (code & 0x1F))};
+    return true;
+  }
+
+  language.clear();
+  if (code == 0) // Macintosh language code for English
+    language = "eng";
+  // other Macintosh codes are rare, the demuxer has the table
+  return code == 0 || code == 0x7FFF;
+}
+
+bool ParseMp4Track(const CDVDContainerInspector::ReadFunc& read,
+                   uint64_t fileSize,
+                   const Box& trak,
+                   ContainerInfo& info)
+{
+  std::vector<uint8_t> data;
+  uint32_t handler = 0;
+  uint16_t languageCode = 0x7FFF;
+  uint32_t format = 0;
+  std::vector<uint8_t> sampleEntry;
+
+  const auto stbl = [&](const Box& box)
+  {
+    if (box.type != FourCC("stsd"))
+      return true;
+    if (box.size - box.headerSize > BLOCK_SIZE || !ReadBoxPayload(read, fileSize, box, data))
+      return false;
+
+    // version, flags and entry count, then the first sample entry
+    CByteReader reader(data.data(), data.size());
+    reader.Skip(8);
+    const uint64_t entrySize = reader.Read(4);
+    format = static_cast<uint32_t>(reader.Read(4));
+    if (reader.Failed() || entrySize < 8 || entrySize - 8 > reader.Left())
+      return false;
+    sampleEntry.assign(reader.Current(), reader.Current() + (entrySize - 8));
+    return true;
+  };
+  const auto minf = [&](const Box& box)
+  {
+    return box.type != FourCC("stbl") ||
+           ParseBoxes(read, box.offset + box.headerSize, box.offset + box.size, stbl);
+  };
+  const auto mdia = [&](const Box& box)
+  {
+    if (box.type == FourCC("minf"))
+      return ParseBoxes(read, box.offset + box.headerSize, box.offset + box.size, minf);
+
+    if (box.type == FourCC("mdhd"))
+    {
+      if (!ReadBoxPayload(read, fileSize, box, data))
+        return false;
+      CByteReader reader(data.data(), data.size());
+      const uint64_t version = reader.Read(1);
+      reader.Skip(version == 1 ? 3 + 8 + 8 + 4 + 8 : 3 + 4 + 4 + 4 + 4);
+      languageCode = static_cast<uint16_t>(reader.Read(2));
+      return !reader.Failed();
+    }
+
+    if (box.type == FourCC("hdlr"))
+    {
+      if (box.size - box.headerSize < 12 || !read(box.offset + box.headerSize, 12, data))
+        return false;
+      CByteReader reader(data.data(), data.size());
+      reader.Skip(8); // version, flags and pre_defined
+      handler = static_cast<uint32_t>(reader.Read(4));
+    }
+    return true;
+  };
+
+  if (!ParseBoxes(read, trak.offset + trak.headerSize, trak.offset + trak.size,
+                  [&](const Box& box)
+                  {
+                    return box.type != FourCC("mdia") ||
+                           ParseBoxes(read, box.offset + box.headerSize, box.offset + box.size,
+                                      mdia);
+                  }))
+    return false;
+
+  TrackInfo track;
+  if (handler == FourCC("vide"))
+  {
+    track.type = CStreamDetail::VIDEO;
+    if (!ParseMp4Video(format, sampleEntry.data(), sampleEntry.size(), track))
+      return false;
+  }
+  else if (handler == FourCC("soun"))
+  {
+    track.type = CStreamDetail::AUDIO;
+    if (!ParseMp4Audio(format, sampleEntry.data(), sampleEntry.size(), track))
+      return false;
+  }
+  else if (handler == FourCC("sbtl") || handler == FourCC("subt") || handler == FourCC("clcp"))
+    track.type = CStreamDetail::SUBTITLE;
+  // text tracks may be chapters
+  else if (handler == FourCC("text"))
+    return false;
+  else
+    return true;
+
+  if (!ParseMp4Language(languageCode, track.language))
+    return false;
+
+  info.tracks.push_back(std::move(track));
+  return true;
+}
+
+bool ParseMp4(const CDVDContainerInspector::ReadFunc& read, uint64_t fileSize, ContainerInfo& info)
+{
+  static const std::array<uint32_t, 8> topLevel{FourCC("ftyp"), FourCC("moov"), FourCC("mdat"),
+                                                FourCC("free"), FourCC("skip"), FourCC("wide"),
+                                                FourCC("pnot"), FourCC("uuid")};
+  Box moov;
+  Box box;
+  int count = 0;
+  for (uint64_t offset = 0; moov.type == 0 && fileSize - offset >= 8; offset += box.size)
+  {
+    if (++count > MAX_TOP_LEVEL || !ReadBoxHeader(read, offset, fileSize, box) ||
+        (offset == 0 && std::ranges::find(topLevel, box.type) == topLevel.end()))
+      return false;
+    if (box.type == FourCC("moov"))
+      moov = box;
+  }
+  if (moov.type == 0)
+    return false;
+
+  std::vector<uint8_t> data;
+  uint64_t timescale = 0;
+  uint64_t duration = 0;
+  if (!ParseBoxes(read, moov.offset + moov.headerSize, moov.offset + moov.size,
+                  [&](const Box& child)
+                  {
+                    if (child.type == FourCC("mvhd"))
+                    {
+                      if (!ReadBoxPayload(read, fileSize, child, data))
+                        return false;
+                      CByteReader reader(data.data(), data.size());
+                      const bool version1 = reader.Read(1) == 1;
+                      reader.Skip(version1 ? 3 + 8 + 8 : 3 + 4 + 4);
+                      timescale = reader.Read(4);
+                      duration = reader.Read(version1 ? 8 : 4);
+                      return !reader.Failed();
+                    }
+                    if (child.type == FourCC("trak"))
+                      return ParseMp4Track(read, fileSize, child, info);
+                    // fragmented, the duration is the sum of the fragments
+                    return child.type != FourCC("mvex");
+                  }))
+    return false;
+
+  if (timescale == 0 || duration == 0 || duration == UINT32_MAX || duration == UINT64_MAX)
+    return false;
+
+  info.durationMs = static_cast<int64_t>(static_cast<double>(duration) * 1000.0 /
+                                         static_cast<double>(timescale));
+  return true;
+}
+} // unnamed namespace
+
+bool CDVDContainerInspector::CanInspect(const std::string& path)
+{
+  const std::string extension = URIUtils::GetExtension(path);
+  return !extension.empty() &&
+         std::ranges::any_of(extensions, [&extension](std::string_view ext)
+                             { return StringUtils::EqualsNoCase(extension.substr(1), ext); });
+}
+
+bool CDVDContainerInspector::GetStreamDetails(const std::string& path, CStreamDetails& details)
+{
+  XFILE::CFile file;
+  if (!file.Open(path, XFILE::READ_NO_CACHE))
+    return false;
+
+  const int64_t size = file.GetLength();
+  if (size <= 0)
+    return false;
+
+  CBlockReader reader(file, static_cast<uint64_t>(size));
+  const bool result = GetStreamDetails(
+      [&reader](uint64_t offset, size_t bytes, std::vector<uint8_t>& data)
+      { return reader.Read(offset, bytes, data); },
+      static_cast<uint64_t>(size), details);
+
+  CLog::LogF(LOGDEBUG, "{} {}",
+             result ? "got stream details from the headers of" : "falling back to the demuxer for",
+             CURL::GetRedacted(path));
+  return result;
+}
+
+bool CDVDContainerInspector::GetStreamDetails(const ReadFunc& read,
+                                              uint64_t size,
+                                              CStreamDetails& details)
+{
+  ContainerInfo info;
+  if (!ParseMatroska(read, size, info))
+  {
+    info = {};
+    if (!ParseMp4(read, size, info))
+      return false;
+  }
+  if (info.tracks.empty())
+    return false;
+
+  details.Reset();
+  for (const TrackInfo& track : info.tracks)
+  {
+    if (track.type == CStreamDetail::VIDEO)
+    {
+      CStreamDetailVideo* p = new CStreamDetailVideo();
+      p->m_iWidth = track.width;
+      p->m_iHeight = track.height;
+      p->m_fAspect = track.aspect;
+      if (p->m_fAspect == 0.0f && p->m_iHeight > 0)
+        p->m_fAspect = static_cast<float>(p->m_iWidth) / p->m_iHeight;
+      p->m_strCodec = track.codec;
+      p->m_iDuration = static_cast<int>(info.durationMs / 1000);
+      p->m_strLanguage = track.language;
+      p->m_strHdrType = CStreamDetails::HdrTypeToString(track.hdrType);
+      details.AddStream(p);
+    }
+    else if (track.type == CStreamDetail::AUDIO)
+    {
+      CStreamDetailAudio* p = new CStreamDetailAudio();
+      p->m_iChannels = track.channels;
+      p->m_strLanguage = track.language;
+      p->m_strCodec = track.codec;
+      details.AddStream(p);
+    }
+    else
+    {
+      CStreamDetailSubtitle* p = new CStreamDetailSubtitle();
+      p->m_strLanguage = track.language;
+      details.AddStream(p);
+    }
+  }
+
+  details.DetermineBestStreams();
+  return true;
+}
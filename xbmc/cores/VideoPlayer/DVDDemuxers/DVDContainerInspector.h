@@ -0,0 +1,47 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+class CStreamDetails;
+
+/*!
+ * \brief Stream details of Matroska and MP4 files from their headers alone
+ *
+ * Only the track headers are read, a few blocks of the file, instead of opening a demuxer that
+ * probes the streams. A file is left to the full probe when its details depend on the stream
+ * data: HDR10 and Dolby Vision video, whose HDR details come from a decoded frame, audio whose
+ * codec name depends on its profile (DTS, E-AC-3, TrueHD), stereoscopic video and fragmented
+ * or unusual files. The details are the ones the demuxer would have given.
+ */
+class CDVDContainerInspector
+{
+public:
+  /*!
+   * \brief Read size bytes at offset into data
+   * \return false if the file has fewer bytes there or the read budget is spent
+   */
+  using ReadFunc = std::function<bool(uint64_t offset, size_t size, std::vector<uint8_t>& data)>;
+
+  /*!
+   * \brief Whether the file has a container this can inspect, by its extension
+   */
+  static bool CanInspect(const std::string& path);
+
+  /*!
+   * \brief Fill the stream details from the headers of the file
+   * \return false to fall back to the demuxer, details are left untouched then
+   */
+  static bool GetStreamDetails(const std::string& path, CStreamDetails& details);
+  static bool GetStreamDetails(const ReadFunc& read, uint64_t size, CStreamDetails& details);
+};
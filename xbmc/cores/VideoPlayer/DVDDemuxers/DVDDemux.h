@@ -339,6 +339,12 @@ public:
    */
   virtual std::string GetFileName() { return ""; }
 
+  /*
+   * returns a description of the streams that allows a shorter probe the next time the same
+   * file is opened, empty if the demuxer has nothing worth caching
+   */
+  virtual std::string GetProbeInfo() const { return ""; }
+
   /*
    * return nr of subtitle streams, 0 if none
    */
@@ -244,6 +244,9 @@ bool CDVDDemuxFFmpeg::Open(const std::shared_ptr<CDVDInputStream>& pInput, bool
   m_speed = DVD_PLAYSPEED_NORMAL;
   m_program = UINT_MAX;
   m_seekToKeyFrame = false;
+  m_probeInfo.clear();
+  m_shareBuffers =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoZeroCopyPackets;
 
   const AVIOInterruptCB int_cb = { interrupt_cb, this };
 
@@ -508,6 +511,17 @@ bool CDVDDemuxFFmpeg::Open(const std::shared_ptr<CDVDInputStream>& pInput, bool
     if (m_pInput->IsStreamType(DVDSTREAM_TYPE_DVD))
       av_opt_set_int(m_pFormatContext, "analyzeduration", 500000, 0);
 
+    // the header described all streams completely when this file was played before, so the long
+    // analysis would find nothing new. Analyse very short like for dvds
+    const std::string headerInfo = GetStreamSignature();
+    if (!fileinfo && !m_checkTransportStream && !headerInfo.empty() &&
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoFastStart &&
+        pInput->GetProperty("probe_info").asString() == headerInfo)
+    {
+      CLog::Log(LOGDEBUG, "{} - using cached probe info, short analysis", __FUNCTION__);
+      av_opt_set_int(m_pFormatContext, "analyzeduration", 500000, 0);
+    }
+
     CLog::Log(LOGDEBUG, "{} - avformat_find_stream_info starting", __FUNCTION__);
     int iErr = avformat_find_stream_info(m_pFormatContext, NULL);
     if (iErr < 0)
@@ -529,6 +543,10 @@ bool CDVDDemuxFFmpeg::Open(const std::shared_ptr<CDVDInputStream>& pInput, bool
     }
     CLog::Log(LOGDEBUG, "{} - av_find_stream_info finished", __FUNCTION__);
 
+    if (iErr >= 0 && !m_checkTransportStream && !headerInfo.empty() &&
+        GetStreamSignature() == headerInfo)
+      m_probeInfo = headerInfo;
+
     // print some extra information
     av_dump_format(m_pFormatContext, 0, CURL::GetRedacted(strFile).c_str(), 0);
 
@@ -626,6 +644,8 @@ bool CDVDDemuxFFmpeg::Open(const std::shared_ptr<CDVDInputStream>& pInput, bool
       return false;
     m_pFormatContext->duration = duration;
   }
+  else
+    LoadKeyframeIndex();
 
   return true;
 }
@@ -637,6 +657,8 @@ void CDVDDemuxFFmpeg::Dispose()
 
   if (m_pFormatContext)
   {
+    SaveKeyframeIndex();
+
     if (m_ioContext && m_pFormatContext->pb && m_pFormatContext->pb != m_ioContext)
     {
       CLog::Log(LOGWARNING, "CDVDDemuxFFmpeg::Dispose - demuxer changed our byte context behind our back, possible memleak");
@@ -1069,7 +1091,7 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
               if (m_pkt.pkt.stream_index ==
                   (int)m_pFormatContext->programs[m_program]->stream_index[i])
               {
-                pPacket = CDVDDemuxUtils::AllocateDemuxPacket(m_pkt.pkt.size);
+                pPacket = CDVDDemuxUtils::AllocateDemuxPacketFromAVPacket(&m_pkt.pkt, m_shareBuffers);
                 break;
               }
             }
@@ -1078,7 +1100,7 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
               bReturnEmpty = true;
           }
           else
-            pPacket = CDVDDemuxUtils::AllocateDemuxPacket(m_pkt.pkt.size);
+            pPacket = CDVDDemuxUtils::AllocateDemuxPacketFromAVPacket(&m_pkt.pkt, m_shareBuffers);
         }
         else
           bReturnEmpty = true;
@@ -1092,13 +1114,7 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
             m_pkt.pkt.pts = AV_NOPTS_VALUE;
           }
 
-          // copy contents into our own packet
-          pPacket->iSize = m_pkt.pkt.size;
-
-          // maybe we can avoid a memcpy here by detecting where pkt.destruct is pointing too?
-          if (m_pkt.pkt.data)
-            memcpy(pPacket->pData, m_pkt.pkt.data, pPacket->iSize);
-
+          // payload is referenced from m_pkt.pkt, no copy needed
           pPacket->pts =
               ConvertTimestamp(m_pkt.pkt.pts, stream->time_base.den, stream->time_base.num);
           pPacket->dts =
@@ -1106,6 +1122,18 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
           pPacket->duration = DVD_SEC_TO_TIME((double)m_pkt.pkt.duration * stream->time_base.num /
                                               stream->time_base.den);
 
+          // keep the keyframes of the seek stream, about one per second is plenty for seeking
+          if ((m_pkt.pkt.flags & AV_PKT_FLAG_KEY) && m_pkt.pkt.pos >= 0 &&
+              m_pkt.pkt.dts != AV_NOPTS_VALUE && GetKeyframeIndexStream() == stream &&
+              (m_lastKeyframe == AV_NOPTS_VALUE || m_pkt.pkt.dts < m_lastKeyframe ||
+               av_rescale_q(m_pkt.pkt.dts - m_lastKeyframe, stream->time_base, AV_TIME_BASE_Q) >=
+                   AV_TIME_BASE))
+          {
+            av_add_index_entry(stream, m_pkt.pkt.pos, m_pkt.pkt.dts, 0, 0, AVINDEX_KEYFRAME);
+            m_lastKeyframe = m_pkt.pkt.dts;
+            m_keyframesAdded = true;
+          }
+
           CDVDDemuxUtils::StoreSideData(pPacket, &m_pkt.pkt);
 
           CDVDInputStream::IDisplayTime* inputStream = m_pInput->GetIDisplayTime();
@@ -1279,6 +1307,10 @@ bool CDVDDemuxFFmpeg::SeekTime(double time, bool backwards, double* startpts)
   int ret;
   {
     std::unique_lock lock(m_critSection);
+
+    // apply the cached keyframes, the binary search of the seek starts from them
+    GetKeyframeIndexStream();
+    m_lastKeyframe = AV_NOPTS_VALUE;
     ret = av_seek_frame(m_pFormatContext, m_seekStream, seek_pts, backwards ? AVSEEK_FLAG_BACKWARD : 0);
 
     if (ret < 0)
@@ -1367,6 +1399,79 @@ bool CDVDDemuxFFmpeg::SeekByte(int64_t pos)
   return (ret >= 0);
 }
 
+void CDVDDemuxFFmpeg::LoadKeyframeIndex()
+{
+  m_keyframeKey.clear();
+  m_keyframeIndex = {};
+  m_keyframeStream = -1;
+  m_lastKeyframe = AV_NOPTS_VALUE;
+  m_keyframesAdded = false;
+
+  // mpeg program and transport streams carry no index, libavformat seeks by a binary search over
+  // the file. The index entries give the search its bounds, so the more are known the less is read
+  const char* format = m_pFormatContext->iformat->name;
+  if (!m_pInput->IsStreamType(DVDSTREAM_TYPE_FILE) || m_pInput->IsRealtime() ||
+      (strcmp(format, "mpegts") != 0 && strcmp(format, "mpeg") != 0))
+    return;
+
+  m_keyframeKey = CDVDDemuxKeyframeCache::GetKey(m_pInput->GetFileName());
+  if (CDVDDemuxKeyframeCache::Load(m_pInput->GetFileName(), m_keyframeKey, m_keyframeIndex))
+    CLog::Log(LOGDEBUG, "{} - loaded {} cached keyframes", __FUNCTION__,
+              m_keyframeIndex.entries.size());
+}
+
+AVStream* CDVDDemuxFFmpeg::GetKeyframeIndexStream()
+{
+  if (m_keyframeKey.empty())
+    return nullptr;
+
+  // the stream seeks go to is only known once transport streams are ready
+  if (m_keyframeStream < 0)
+  {
+    m_keyframeStream =
+        m_seekStream >= 0 ? m_seekStream : av_find_default_stream_index(m_pFormatContext);
+    if (m_keyframeStream < 0)
+    {
+      m_keyframeKey.clear();
+      return nullptr;
+    }
+
+    AVStream* st = m_pFormatContext->streams[m_keyframeStream];
+    if (m_keyframeIndex.stream == m_keyframeStream &&
+        m_keyframeIndex.timeBaseNum == st->time_base.num &&
+        m_keyframeIndex.timeBaseDen == st->time_base.den)
+    {
+      for (const auto& entry : m_keyframeIndex.entries)
+        av_add_index_entry(st, entry.pos, entry.timestamp, 0, 0, AVINDEX_KEYFRAME);
+    }
+    m_keyframeIndex = {};
+  }
+  return m_pFormatContext->streams[m_keyframeStream];
+}
+
+void CDVDDemuxFFmpeg::SaveKeyframeIndex()
+{
+  if (!m_keyframesAdded || m_keyframeStream < 0)
+    return;
+
+  // the entries the seeks added are kept too
+  AVStream* st = m_pFormatContext->streams[m_keyframeStream];
+  CDVDDemuxKeyframeCache::Index index;
+  index.stream = m_keyframeStream;
+  index.timeBaseNum = st->time_base.num;
+  index.timeBaseDen = st->time_base.den;
+  const int count = avformat_index_get_entries_count(st);
+  index.entries.reserve(count);
+  for (int i = 0; i < count; i++)
+  {
+    const AVIndexEntry* entry = avformat_index_get_entry(st, i);
+    if (entry && (entry->flags & AVINDEX_KEYFRAME))
+      index.entries.push_back({entry->pos, entry->timestamp});
+  }
+  CDVDDemuxKeyframeCache::Save(m_pInput->GetFileName(), m_keyframeKey, index);
+  m_keyframesAdded = false;
+}
+
 int CDVDDemuxFFmpeg::GetStreamLength()
 {
   if (!m_pFormatContext)
@@ -2543,6 +2648,40 @@ void CDVDDemuxFFmpeg::GetL16Parameters(int &channels, int &samplerate)
   }
 }
 
+std::string CDVDDemuxFFmpeg::GetStreamSignature() const
+{
+  // the parameters avformat_find_stream_info would have to fill in if the header lacks them, the
+  // formats the decoders report are left out as they are always found with a short analysis
+  if (!m_pFormatContext || m_pFormatContext->nb_streams == 0 || !m_pFormatContext->streams)
+    return "";
+
+  std::string signature = std::to_string(m_pFormatContext->nb_streams);
+  for (unsigned int i = 0; i < m_pFormatContext->nb_streams; i++)
+  {
+    const AVStream* st = m_pFormatContext->streams[i];
+    const AVCodecParameters* par = st->codecpar;
+    if (par->codec_id == AV_CODEC_ID_NONE)
+      return "";
+
+    signature += StringUtils::Format("|{}:{}", static_cast<int>(par->codec_type),
+                                     static_cast<int>(par->codec_id));
+    if (par->codec_type == AVMEDIA_TYPE_VIDEO)
+    {
+      if (par->width <= 0 || par->height <= 0 || st->avg_frame_rate.den == 0)
+        return "";
+      signature += StringUtils::Format(":{}x{}:{}/{}", par->width, par->height,
+                                       st->avg_frame_rate.num, st->avg_frame_rate.den);
+    }
+    else if (par->codec_type == AVMEDIA_TYPE_AUDIO)
+    {
+      if (par->sample_rate <= 0 || par->ch_layout.nb_channels <= 0)
+        return "";
+      signature += StringUtils::Format(":{}:{}", par->sample_rate, par->ch_layout.nb_channels);
+    }
+  }
+  return signature;
+}
+
 StreamHdrType CDVDDemuxFFmpeg::DetermineHdrType(AVStream* pStream)
 {
   StreamHdrType hdrType = StreamHdrType::HDR_TYPE_NONE;
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "DVDDemux.h"
+#include "DVDDemuxKeyframeCache.h"
 #include "threads/CriticalSection.h"
 #include "threads/SystemClock.h"
 #include <map>
@@ -92,6 +93,7 @@ public:
   void Abort() override;
   void SetSpeed(int iSpeed) override;
   std::string GetFileName() override;
+  std::string GetProbeInfo() const override { return m_probeInfo; }
 
   DemuxPacket* Read() override;
   DemuxPacket* ReadInternal(bool keep);
@@ -143,6 +145,10 @@ protected:
   double SelectAspect(AVStream* st, bool& forced);
 
   StreamHdrType DetermineHdrType(AVStream* pStream);
+  std::string GetStreamSignature() const;
+  void LoadKeyframeIndex();
+  void SaveKeyframeIndex();
+  AVStream* GetKeyframeIndexStream();
 
   CCriticalSection m_critSection;
   std::map<int, CDemuxStream*> m_streams;
@@ -178,6 +184,15 @@ protected:
   int m_displayTime = 0;
   double m_dtsAtDisplayTime;
   bool m_seekToKeyFrame = false;
+  bool m_shareBuffers = true;
   double m_startTime = 0;
   std::vector<ChapterFFmpeg> m_chapters;
+  std::string m_probeInfo; ///< signature of streams fully described by the file header
+
+  // keyframe index of containers without one, empty key if no index is kept
+  std::string m_keyframeKey;
+  CDVDDemuxKeyframeCache::Index m_keyframeIndex; ///< the cached index until it is applied
+  int m_keyframeStream = -1;
+  int64_t m_lastKeyframe = 0;
+  bool m_keyframesAdded = false;
 };
@@ -0,0 +1,122 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DVDDemuxKeyframeCache.h"
+
+#include "URL.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "utils/Crc32.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <cstring>
+
+namespace
+{
+constexpr uint32_t KEYFRAME_CACHE_MAGIC = 0x4658454b; // "KEXF"
+constexpr uint32_t KEYFRAME_CACHE_VERSION = 1;
+
+std::string GetCacheFile(const std::string& file)
+{
+  return StringUtils::Format("special://temp/keyframes/{:08x}.bin", Crc32::Compute(file));
+}
+
+template<typename T>
+void Write(std::string& data, T value)
+{
+  data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool Read(const std::vector<uint8_t>& data, size_t& position, T& value)
+{
+  if (data.size() - position < sizeof(T))
+    return false;
+  std::memcpy(&value, data.data() + position, sizeof(T));
+  position += sizeof(T);
+  return true;
+}
+} // namespace
+
+std::string CDVDDemuxKeyframeCache::GetKey(const std::string& file)
+{
+  struct __stat64 buffer;
+  if (XFILE::CFile::Stat(file, &buffer) != 0 || buffer.st_size <= 0)
+    return {};
+
+  // the path is part of the key, the crc of the cache file name may collide
+  return StringUtils::Format("{}|{}|{}", file, static_cast<int64_t>(buffer.st_size),
+                             static_cast<int64_t>(buffer.st_mtime));
+}
+
+bool CDVDDemuxKeyframeCache::Load(const std::string& file, const std::string& key, Index& index)
+{
+  XFILE::CFile cacheFile;
+  std::vector<uint8_t> data;
+  if (key.empty() || cacheFile.LoadFile(GetCacheFile(file), data) <= 0)
+    return false;
+
+  size_t position = 0;
+  uint32_t magic;
+  uint32_t version;
+  uint32_t keySize;
+  if (!Read(data, position, magic) || magic != KEYFRAME_CACHE_MAGIC ||
+      !Read(data, position, version) || version != KEYFRAME_CACHE_VERSION ||
+      !Read(data, position, keySize) || data.size() - position < keySize ||
+      key.compare(0, std::string::npos, reinterpret_cast<const char*>(data.data() + position),
+                  keySize) != 0)
+    return false;
+  position += keySize;
+
+  int32_t stream;
+  int32_t timeBaseNum;
+  int32_t timeBaseDen;
+  uint32_t count;
+  if (!Read(data, position, stream) || !Read(data, position, timeBaseNum) ||
+      !Read(data, position, timeBaseDen) || !Read(data, position, count) ||
+      (data.size() - position) / sizeof(Entry) < count)
+  {
+    CLog::LogF(LOGWARNING, "Keyframe cache of {} is corrupt", CURL::GetRedacted(file));
+    return false;
+  }
+
+  index.stream = stream;
+  index.timeBaseNum = timeBaseNum;
+  index.timeBaseDen = timeBaseDen;
+  index.entries.resize(count);
+  std::memcpy(index.entries.data(), data.data() + position, count * sizeof(Entry));
+  return true;
+}
+
+void CDVDDemuxKeyframeCache::Save(const std::string& file, const std::string& key, const Index& index)
+{
+  if (key.empty() || index.entries.empty())
+    return;
+
+  std::string data;
+  data.reserve(key.size() + index.entries.size() * sizeof(Entry) + 28);
+  Write(data, KEYFRAME_CACHE_MAGIC);
+  Write(data, KEYFRAME_CACHE_VERSION);
+  Write(data, static_cast<uint32_t>(key.size()));
+  data.append(key);
+  Write(data, static_cast<int32_t>(index.stream));
+  Write(data, static_cast<int32_t>(index.timeBaseNum));
+  Write(data, static_cast<int32_t>(index.timeBaseDen));
+  Write(data, static_cast<uint32_t>(index.entries.size()));
+  data.append(reinterpret_cast<const char*>(index.entries.data()),
+              index.entries.size() * sizeof(Entry));
+
+  const std::string cacheFile = GetCacheFile(file);
+  XFILE::CDirectory::Create(URIUtils::GetDirectory(cacheFile));
+  XFILE::CFile output;
+  if (!output.OpenForWrite(cacheFile, true) ||
+      output.Write(data.data(), data.size()) != static_cast<ssize_t>(data.size()))
+    CLog::LogF(LOGDEBUG, "Unable to write the keyframe cache of {}", CURL::GetRedacted(file));
+}
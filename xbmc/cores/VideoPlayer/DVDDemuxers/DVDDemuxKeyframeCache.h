@@ -0,0 +1,53 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief Persistent keyframe index of files whose container has none
+ *
+ * The keyframe positions found while a file is read are stored under special://temp/keyframes,
+ * so they can be handed back to libavformat the next time the file is opened. The cache is
+ * bound to the size and modification time of the file.
+ */
+class CDVDDemuxKeyframeCache
+{
+public:
+  struct Entry
+  {
+    int64_t pos; //!< byte offset of the keyframe
+    int64_t timestamp; //!< dts in units of the stream time base
+  };
+
+  struct Index
+  {
+    int stream{-1};
+    int timeBaseNum{0};
+    int timeBaseDen{0};
+    std::vector<Entry> entries;
+  };
+
+  /*!
+   * \brief Get the key that identifies the current version of a file
+   * \return the key, empty if the file can't be cached
+   */
+  static std::string GetKey(const std::string& file);
+
+  /*!
+   * \brief Load the index of a file
+   * \param key the key the index was stored with
+   * \return false if there is no valid index for this key
+   */
+  static bool Load(const std::string& file, const std::string& key, Index& index);
+
+  static void Save(const std::string& file, const std::string& key, const Index& index);
+};
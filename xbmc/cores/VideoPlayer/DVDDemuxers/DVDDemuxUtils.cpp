@@ -9,6 +9,7 @@
 #include "DVDDemuxUtils.h"
 
 #include "cores/VideoPlayer/Interface/DemuxCrypto.h"
+#include "threads/CriticalSection.h"
 #include "utils/MemUtils.h"
 #include "utils/log.h"
 
@@ -19,13 +20,156 @@ extern "C"
 }
 
 #include <algorithm>
+#include <array>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+/*!
+ * \brief Recycles padded payload buffers and packet structures across packets.
+ *
+ * Buffers are grouped in power of two size classes from 4 KiB to 4 MiB, bigger payloads bypass
+ * the pool. The amount of memory kept around is bounded by MAX_CACHED_BYTES.
+ */
+class CDemuxPacketPool
+{
+public:
+  static CDemuxPacketPool& GetInstance()
+  {
+    // intentionally leaked, packets may still be released during static destruction
+    static CDemuxPacketPool* pool = new CDemuxPacketPool();
+    return *pool;
+  }
+
+  DemuxPacket* AllocatePacket()
+  {
+    {
+      std::unique_lock lock(m_section);
+      if (!m_packets.empty())
+      {
+        DemuxPacket* packet = m_packets.back();
+        m_packets.pop_back();
+        *packet = DemuxPacket();
+        return packet;
+      }
+    }
+    return new DemuxPacket();
+  }
+
+  void FreePacket(DemuxPacket* packet)
+  {
+    {
+      std::unique_lock lock(m_section);
+      if (m_packets.size() < MAX_CACHED_PACKETS)
+      {
+        m_packets.push_back(packet);
+        return;
+      }
+    }
+    delete packet;
+  }
+
+  uint8_t* AllocateBuffer(size_t size, int& sizeClass)
+  {
+    sizeClass = GetSizeClass(size);
+
+    {
+      std::unique_lock lock(m_section);
+      m_stats.allocations++;
+      if (sizeClass >= 0 && !m_buffers[sizeClass].empty())
+      {
+        uint8_t* buffer = m_buffers[sizeClass].back();
+        m_buffers[sizeClass].pop_back();
+        m_stats.poolHits++;
+        m_stats.cachedBytes -= GetClassSize(sizeClass);
+        return buffer;
+      }
+    }
+
+    const size_t capacity = sizeClass >= 0 ? GetClassSize(sizeClass) : size;
+    return static_cast<uint8_t*>(KODI::MEMORY::AlignedMalloc(capacity, 16));
+  }
+
+  void FreeBuffer(uint8_t* buffer, int sizeClass)
+  {
+    if (sizeClass >= 0)
+    {
+      std::unique_lock lock(m_section);
+      if (m_stats.cachedBytes + GetClassSize(sizeClass) <= MAX_CACHED_BYTES)
+      {
+        m_buffers[sizeClass].push_back(buffer);
+        m_stats.cachedBytes += GetClassSize(sizeClass);
+        return;
+      }
+    }
+    KODI::MEMORY::AlignedFree(buffer);
+  }
+
+  void CountWrapped()
+  {
+    std::unique_lock lock(m_section);
+    m_stats.allocations++;
+    m_stats.wrapped++;
+  }
+
+  DemuxPacketPoolStats GetStats()
+  {
+    std::unique_lock lock(m_section);
+    return m_stats;
+  }
+
+  void Trim()
+  {
+    std::unique_lock lock(m_section);
+    for (auto& buffers : m_buffers)
+    {
+      for (uint8_t* buffer : buffers)
+        KODI::MEMORY::AlignedFree(buffer);
+      buffers.clear();
+    }
+    for (DemuxPacket* packet : m_packets)
+      delete packet;
+    m_packets.clear();
+    m_stats.cachedBytes = 0;
+  }
+
+private:
+  static constexpr int MIN_CLASS_SHIFT = 12;
+  static constexpr int NUM_CLASSES = 11;
+  static constexpr uint64_t MAX_CACHED_BYTES = 32 * 1024 * 1024;
+  static constexpr size_t MAX_CACHED_PACKETS = 4096;
+
+  static int GetSizeClass(size_t size)
+  {
+    for (int sizeClass = 0; sizeClass < NUM_CLASSES; ++sizeClass)
+    {
+      if (size <= GetClassSize(sizeClass))
+        return sizeClass;
+    }
+    return -1;
+  }
+
+  static size_t GetClassSize(int sizeClass)
+  {
+    return static_cast<size_t>(1) << (MIN_CLASS_SHIFT + sizeClass);
+  }
+
+  CCriticalSection m_section;
+  std::array<std::vector<uint8_t*>, NUM_CLASSES> m_buffers;
+  std::vector<DemuxPacket*> m_packets;
+  DemuxPacketPoolStats m_stats;
+};
+} // namespace
 
 void CDVDDemuxUtils::FreeDemuxPacket(DemuxPacket* pPacket)
 {
   if (pPacket)
   {
-    if (pPacket->pData)
-      KODI::MEMORY::AlignedFree(pPacket->pData);
+    if (pPacket->m_avBuffer)
+      av_buffer_unref(&pPacket->m_avBuffer);
+    else if (pPacket->pData)
+      CDemuxPacketPool::GetInstance().FreeBuffer(pPacket->pData, pPacket->m_poolSizeClass);
     if (pPacket->iSideDataElems)
     {
       AVPacket* avPkt = av_packet_alloc();
@@ -49,13 +193,14 @@ void CDVDDemuxUtils::FreeDemuxPacket(DemuxPacket* pPacket)
     }
     if (pPacket->cryptoInfo)
       delete pPacket->cryptoInfo;
-    delete pPacket;
+    CDemuxPacketPool::GetInstance().FreePacket(pPacket);
   }
 }
 
 DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(int iDataSize)
 {
-  DemuxPacket* pPacket = new DemuxPacket();
+  CDemuxPacketPool& pool = CDemuxPacketPool::GetInstance();
+  DemuxPacket* pPacket = pool.AllocatePacket();
 
   if (iDataSize > 0)
   {
@@ -68,7 +213,8 @@ DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(int iDataSize)
      * Note, if the first 23 bits of the additional bytes are not 0 then damaged
      * MPEG bitstreams could cause overread and segfault
      */
-    pPacket->pData = static_cast<uint8_t*>(KODI::MEMORY::AlignedMalloc(iDataSize + AV_INPUT_BUFFER_PADDING_SIZE, 16));
+    pPacket->pData =
+        pool.AllocateBuffer(iDataSize + AV_INPUT_BUFFER_PADDING_SIZE, pPacket->m_poolSizeClass);
     if (!pPacket->pData)
     {
       FreeDemuxPacket(pPacket);
@@ -82,6 +228,45 @@ DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(int iDataSize)
   return pPacket;
 }
 
+DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacketFromAVPacket(const AVPacket* src,
+                                                             bool shareBuffer)
+{
+  // libavformat guarantees the padding for reference counted packets, so the payload can be
+  // handed to decoders as is
+  if (shareBuffer && src->buf && src->data && src->size > 0)
+  {
+    AVBufferRef* ref = av_buffer_ref(src->buf);
+    if (ref)
+    {
+      CDemuxPacketPool& pool = CDemuxPacketPool::GetInstance();
+      DemuxPacket* pPacket = pool.AllocatePacket();
+      pPacket->m_avBuffer = ref;
+      pPacket->pData = src->data;
+      pPacket->iSize = src->size;
+      pool.CountWrapped();
+      return pPacket;
+    }
+  }
+
+  DemuxPacket* pPacket = AllocateDemuxPacket(src->size);
+  if (pPacket && src->data && src->size > 0)
+  {
+    pPacket->iSize = src->size;
+    memcpy(pPacket->pData, src->data, src->size);
+  }
+  return pPacket;
+}
+
+DemuxPacketPoolStats CDVDDemuxUtils::GetPacketPoolStats()
+{
+  return CDemuxPacketPool::GetInstance().GetStats();
+}
+
+void CDVDDemuxUtils::TrimPacketPool()
+{
+  CDemuxPacketPool::GetInstance().Trim();
+}
+
 DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(unsigned int iDataSize, unsigned int encryptedSubsampleCount)
 {
   DemuxPacket *ret(AllocateDemuxPacket(iDataSize));
@@ -11,6 +11,7 @@
 #include "cores/VideoPlayer/Interface/DemuxPacket.h"
 
 #include <chrono>
+#include <cstdint>
 #include <span>
 #include <string>
 #include <vector>
@@ -18,6 +19,14 @@
 struct AVChapter;
 struct AVPacket;
 
+struct DemuxPacketPoolStats
+{
+  uint64_t allocations{0}; //!< packets handed out with a payload
+  uint64_t poolHits{0}; //!< payload buffers served from the pool
+  uint64_t wrapped{0}; //!< payloads referenced from an AVPacket instead of copied
+  uint64_t cachedBytes{0}; //!< memory currently held by the pool
+};
+
 struct ChapterFFmpeg
 {
   bool operator==(const ChapterFFmpeg&) const = default;
@@ -34,6 +43,23 @@ public:
   static DemuxPacket* AllocateDemuxPacket(int iDataSize = 0);
   static DemuxPacket* AllocateDemuxPacket(unsigned int iDataSize,
                                           unsigned int encryptedSubsampleCount);
+
+  /*!
+   * \brief Allocate a packet carrying the payload of a libavformat packet.
+   *
+   * If src is reference counted and shareBuffer is set the payload is shared by taking a
+   * reference on its buffer, otherwise it is copied into a pooled buffer. Timestamps and side
+   * data are not handled here.
+   */
+  static DemuxPacket* AllocateDemuxPacketFromAVPacket(const AVPacket* src, bool shareBuffer = true);
+
+  static DemuxPacketPoolStats GetPacketPoolStats();
+
+  /*!
+   * \brief Release all buffers cached by the packet pool, e.g. when playback has ended.
+   */
+  static void TrimPacketPool();
+
   static void StoreSideData(DemuxPacket* pkt, AVPacket* src);
   static std::vector<ChapterFFmpeg> LoadChapters(std::span<AVChapter*> chapters);
 };
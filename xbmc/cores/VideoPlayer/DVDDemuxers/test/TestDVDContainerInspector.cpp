@@ -0,0 +1,229 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDDemuxers/DVDContainerInspector.h"
+#include "utils/StreamDetails.h"
+
+#include <bit>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+using Bytes = std::vector<uint8_t>;
+
+Bytes operator+(Bytes a, const Bytes& b)
+{
+  a.insert(a.end(), b.begin(), b.end());
+  return a;
+}
+
+Bytes BigEndian(uint64_t value, size_t bytes)
+{
+  Bytes result(bytes);
+  for (size_t i = 0; i < bytes; ++i)
+    result[bytes - 1 - i] = static_cast<uint8_t>(value >> (8 * i));
+  return result;
+}
+
+Bytes Text(const std::string& text)
+{
+  return Bytes(text.begin(), text.end());
+}
+
+// EBML elements with an 8 byte size
+Bytes Element(uint32_t id, const Bytes& payload)
+{
+  const size_t idLength = id > 0xFFFFFF ? 4 : id > 0xFFFF ? 3 : id > 0xFF ? 2 : 1;
+  return BigEndian(id, idLength) + Bytes{0x01} + BigEndian(payload.size(), 7) + payload;
+}
+
+Bytes UInt(uint32_t id, uint64_t value)
+{
+  return Element(id, BigEndian(value, 8));
+}
+
+Bytes Float(uint32_t id, double value)
+{
+  return Element(id, BigEndian(std::bit_cast<uint64_t>(value), 8));
+}
+
+Bytes Box(const std::string& type, const Bytes& payload)
+{
+  return BigEndian(payload.size() + 8, 4) + Text(type) + payload;
+}
+
+bool Inspect(const Bytes& file, CStreamDetails& details)
+{
+  return CDVDContainerInspector::GetStreamDetails(
+      [&file](uint64_t offset, size_t size, std::vector<uint8_t>& data)
+      {
+        if (offset > file.size() || size > file.size() - offset)
+          return false;
+        data.assign(file.begin() + offset, file.begin() + offset + size);
+        return true;
+      },
+      file.size(), details);
+}
+
+Bytes Matroska(const Bytes& tracks)
+{
+  const Bytes header = Element(0x1A45DFA3, Element(0x4282, Text("matroska")));
+  const Bytes info = Element(0x1549A966, UInt(0x2AD7B1, 1000000) + Float(0x4489, 10500.0));
+  const Bytes cluster = Element(0x1F43B675, Bytes(16));
+  return header + Element(0x18538067, info + Element(0x1654AE6B, tracks) + cluster);
+}
+
+Bytes MatroskaVideo(const std::string& codec, const Bytes& video)
+{
+  return Element(0xAE, UInt(0x83, 1) + Element(0x86, Text(codec)) + Element(0xE0, video));
+}
+
+// AAC LC, 48 kHz, stereo
+const Bytes aacConfig{0x11, 0x90};
+
+Bytes Mp4AudioEntry(const std::string& format, uint16_t channels, const Bytes& children)
+{
+  return Box(format, Bytes(16) + BigEndian(channels, 2) + Bytes(10) + children);
+}
+
+Bytes Mp4VideoEntry(const std::string& format,
+                    uint16_t width,
+                    uint16_t height,
+                    const Bytes& children)
+{
+  return Box(format, Bytes(24) + BigEndian(width, 2) + BigEndian(height, 2) + Bytes(50) + children);
+}
+
+Bytes Mp4Track(const std::string& handler, const std::string& language, const Bytes& entry)
+{
+  const uint16_t code = static_cast<uint16_t>((language[0] - 0x60) << 10 |
+                                              (language[1] - 0x60) << 5 | (language[2] - 0x60));
+  const Bytes mdhd = Box("mdhd", Bytes(20) + BigEndian(code, 2) + Bytes(2));
+  const Bytes hdlr = Box("hdlr", Bytes(8) + Text(handler) + Bytes(13));
+  const Bytes stsd = Box("stsd", Bytes(4) + BigEndian(1, 4) + entry);
+  return Box("trak", Box("mdia", mdhd + hdlr + Box("minf", Box("stbl", stsd))));
+}
+
+Bytes Mp4(const Bytes& moovChildren)
+{
+  const Bytes mvhd = Box("mvhd", Bytes(12) + BigEndian(1000, 4) + BigEndian(10500, 4) + Bytes(80));
+  return Box("ftyp", Text("isom") + Bytes(4)) + Box("mdat", Bytes(1000)) +
+         Box("moov", mvhd + moovChildren);
+}
+
+Bytes Mp4a(const Bytes& config)
+{
+  // ES_Descriptor, DecoderConfigDescriptor for AAC, DecoderSpecificInfo
+  const Bytes specificInfo = Bytes{0x05, static_cast<uint8_t>(config.size())} + config;
+  const Bytes decoderConfig =
+      Bytes{0x04, static_cast<uint8_t>(13 + specificInfo.size()), 0x40, 0x15} + Bytes(11) +
+      specificInfo;
+  const Bytes es = Bytes{0x03, static_cast<uint8_t>(3 + decoderConfig.size()), 0, 1, 0} +
+                   decoderConfig;
+  return Mp4AudioEntry("mp4a", 2, Box("esds", Bytes(4) + es));
+}
+} // unnamed namespace
+
+TEST(TestDVDContainerInspector, CanInspect)
+{
+  EXPECT_TRUE(CDVDContainerInspector::CanInspect("/movies/movie.mkv"));
+  EXPECT_TRUE(CDVDContainerInspector::CanInspect("smb://server/movies/movie.MP4"));
+  EXPECT_FALSE(CDVDContainerInspector::CanInspect("/movies/movie.ts"));
+  EXPECT_FALSE(CDVDContainerInspector::CanInspect("/movies/movie"));
+}
+
+TEST(TestDVDContainerInspector, Matroska)
+{
+  const Bytes video = MatroskaVideo("V_MPEG4/ISO/AVC", UInt(0xB0, 1440) + UInt(0xBA, 1080) +
+                                                           UInt(0x54B0, 16) + UInt(0x54BA, 9));
+  const Bytes audio = Element(0xAE, UInt(0x83, 2) + Element(0x86, Text("A_AAC")) +
+                                        Element(0x63A2, aacConfig) +
+                                        Element(0xE1, UInt(0x9F, 2)));
+  const Bytes subtitle =
+      Element(0xAE, UInt(0x83, 0x11) + Element(0x86, Text("S_TEXT/UTF8")) +
+                        Element(0x22B59C, Text("ger")));
+
+  CStreamDetails details;
+  ASSERT_TRUE(Inspect(Matroska(video + audio + subtitle), details));
+  EXPECT_EQ("h264", details.GetVideoCodec());
+  EXPECT_EQ(1440, details.GetVideoWidth());
+  EXPECT_EQ(1080, details.GetVideoHeight());
+  EXPECT_NEAR(16.0f / 9.0f, details.GetVideoAspect(), 0.001f);
+  EXPECT_EQ(10, details.GetVideoDuration());
+  EXPECT_EQ("", details.GetVideoHdrType());
+  EXPECT_EQ("aac_lc", details.GetAudioCodec());
+  EXPECT_EQ(2, details.GetAudioChannels());
+  EXPECT_EQ("eng", details.GetAudioLanguage());
+  EXPECT_EQ("ger", details.GetSubtitleLanguage());
+}
+
+TEST(TestDVDContainerInspector, MatroskaFallback)
+{
+  const Bytes size = UInt(0xB0, 3840) + UInt(0xBA, 2160);
+  CStreamDetails details;
+
+  // HEVC without colour information may be HDR10 in the bitstream
+  EXPECT_FALSE(Inspect(Matroska(MatroskaVideo("V_MPEGH/ISO/HEVC", size)), details));
+  // PQ is HDR10, or HDR10+ found in the frames
+  EXPECT_FALSE(Inspect(
+      Matroska(MatroskaVideo("V_MPEGH/ISO/HEVC", size + Element(0x55B0, UInt(0x55BA, 16)))),
+      details));
+  // stereoscopic
+  EXPECT_FALSE(Inspect(
+      Matroska(MatroskaVideo("V_MPEG4/ISO/AVC", size + UInt(0x53B8, 1))), details));
+  // DTS is named after its profile
+  EXPECT_FALSE(Inspect(Matroska(Element(0xAE, UInt(0x83, 2) + Element(0x86, Text("A_DTS")) +
+                                                   Element(0xE1, UInt(0x9F, 6)))),
+                       details));
+  EXPECT_EQ(0, details.GetVideoStreamCount());
+
+  ASSERT_TRUE(Inspect(
+      Matroska(MatroskaVideo("V_MPEGH/ISO/HEVC", size + Element(0x55B0, UInt(0x55BA, 18)))),
+      details));
+  EXPECT_EQ("hevc", details.GetVideoCodec());
+  EXPECT_EQ("hlg", details.GetVideoHdrType());
+}
+
+TEST(TestDVDContainerInspector, Mp4)
+{
+  const Bytes pasp = Box("pasp", BigEndian(4, 4) + BigEndian(3, 4));
+  const Bytes video = Mp4Track("vide", "und", Mp4VideoEntry("avc1", 1440, 1080, pasp));
+  const Bytes audio = Mp4Track("soun", "fra", Mp4a(aacConfig));
+
+  CStreamDetails details;
+  ASSERT_TRUE(Inspect(Mp4(video + audio), details));
+  EXPECT_EQ("h264", details.GetVideoCodec());
+  EXPECT_EQ(1440, details.GetVideoWidth());
+  EXPECT_EQ(1080, details.GetVideoHeight());
+  EXPECT_NEAR(16.0f / 9.0f, details.GetVideoAspect(), 0.001f);
+  EXPECT_EQ(10, details.GetVideoDuration());
+  EXPECT_EQ("und", details.GetVideoLanguage());
+  EXPECT_EQ("aac_lc", details.GetAudioCodec());
+  EXPECT_EQ(2, details.GetAudioChannels());
+  EXPECT_EQ("fra", details.GetAudioLanguage());
+}
+
+TEST(TestDVDContainerInspector, Mp4Fallback)
+{
+  const Bytes video = Mp4Track("vide", "eng", Mp4VideoEntry("avc1", 1920, 1080, {}));
+  CStreamDetails details;
+
+  // fragmented
+  EXPECT_FALSE(Inspect(Mp4(video + Box("mvex", {})), details));
+  // Dolby Vision
+  EXPECT_FALSE(Inspect(
+      Mp4(Mp4Track("vide", "eng", Mp4VideoEntry("dvhe", 3840, 2160, {}))), details));
+  // E-AC-3 is named after its profile
+  EXPECT_FALSE(
+      Inspect(Mp4(video + Mp4Track("soun", "eng", Mp4AudioEntry("ec-3", 6, {}))), details));
+  // neither Matroska nor MP4
+  EXPECT_FALSE(Inspect(Bytes(4096, 0x47), details));
+}
@@ -13,6 +13,8 @@
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "ServiceBroker.h"
+#include "application/ApplicationComponents.h"
+#include "application/ApplicationPlayer.h"
 #include "filesystem/StackDirectory.h"
 #include "guilib/Texture.h"
 #include "network/NetworkFileItemClassify.h"
@@ -32,11 +34,13 @@
 #include "DVDCodecs/DVDFactoryCodec.h"
 #include "DVDCodecs/Video/DVDVideoCodec.h"
 #include "DVDCodecs/Video/DVDVideoCodecFFmpeg.h"
+#include "DVDDemuxers/DVDContainerInspector.h"
 #include "DVDDemuxers/DVDDemux.h"
 #include "DVDDemuxers/DVDDemuxUtils.h"
 #include "DVDDemuxers/DVDDemuxVobsub.h"
 #include "DVDDemuxers/DVDFactoryDemuxer.h"
 #include "DVDInputStreams/DVDFactoryInputStream.h"
+#include "DVDThumbExtractionPool.h"
 #include "Process/ProcessInfo.h"
 #include "TextureCache.h"
 #include "Util.h"
@@ -44,7 +48,10 @@
 #include "filesystem/File.h"
 #include "utils/LangCodeExpander.h"
 
+#include <atomic>
 #include <cstdlib>
+#include <cstring>
+#include <future>
 #include <memory>
 #include <string>
 
@@ -94,12 +101,102 @@ int DegreeToOrientation(int degrees)
   }
 }
 
+namespace
+{
+bool ScalePicture(VideoPicture& picture,
+                  uint8_t* dest,
+                  int destPitch,
+                  unsigned int width,
+                  unsigned int height)
+{
+  // software decoders give YUV420P, hardware ones NV12 at best, other formats stay on the GPU
+  const AVPixelFormat format = picture.videoBuffer->GetFormat();
+  if (format != AV_PIX_FMT_YUV420P && format != AV_PIX_FMT_NV12)
+    return false;
+
+  struct SwsContext* context =
+      sws_getContext(picture.iWidth, picture.iHeight, format, width, height, AV_PIX_FMT_BGRA,
+                     SWS_FAST_BILINEAR, NULL, NULL, NULL);
+  if (!context)
+    return false;
+
+  uint8_t* planes[YuvImage::MAX_PLANES] = {};
+  int stride[YuvImage::MAX_PLANES] = {};
+  picture.videoBuffer->SyncStart();
+  picture.videoBuffer->GetPlanes(planes);
+  picture.videoBuffer->GetStrides(stride);
+  const bool nv12 = format == AV_PIX_FMT_NV12;
+  const bool readable = planes[0] && planes[1] && (nv12 || planes[2]);
+  if (readable)
+  {
+    uint8_t* src[4] = {planes[0], planes[1], nv12 ? nullptr : planes[2], 0};
+    int srcStride[] = {stride[0], stride[1], nv12 ? 0 : stride[2], 0};
+    uint8_t* dst[] = {dest, 0, 0, 0};
+    int dstStride[] = {destPitch, 0, 0, 0};
+    sws_scale(context, src, srcStride, 0, picture.iHeight, dst, dstStride);
+  }
+  picture.videoBuffer->SyncEnd();
+  sws_freeContext(context);
+  return readable;
+}
+
+bool IsPlayingVideo()
+{
+  const auto& components = CServiceBroker::GetAppComponents();
+  const auto appPlayer = components.GetComponent<CApplicationPlayer>();
+  return appPlayer && appPlayer->IsPlayingVideo();
+}
+} // namespace
+
 std::unique_ptr<CTexture> CDVDFileInfo::ExtractThumbToTexture(const CFileItem& fileItem,
                                                               int chapterNumber)
 {
   if (!CanExtract(fileItem))
     return {};
 
+  if (!CDVDThumbExtractionPool::IsWorkerThread())
+  {
+    const std::string& path =
+        fileItem.GetDynPath().empty() ? fileItem.GetPath() : fileItem.GetDynPath();
+    auto future = CDVDThumbExtractionPool::GetInstance().Submit(
+        CDVDThumbExtractionPool::GetSource(path),
+        [&fileItem, chapterNumber] { return ExtractThumbToTexture(fileItem, chapterNumber); });
+    try
+    {
+      return future.get();
+    }
+    catch (const std::future_error&)
+    {
+      return {}; // dropped on shutdown
+    }
+  }
+
+  // one hardware decoder at a time, never next to one used for playback. Where its pictures
+  // live on the GPU only, software decoding is used from the first such picture on.
+  static std::atomic<bool> hardwareBusy{false};
+  static std::atomic<bool> hardwareReadable{true};
+  const bool hardware = hardwareReadable && !IsPlayingVideo() && !hardwareBusy.exchange(true);
+
+  bool unreadable = false;
+  std::unique_ptr<CTexture> result = DecodeThumb(fileItem, chapterNumber, hardware, unreadable);
+  if (hardware)
+    hardwareBusy = false;
+
+  if (unreadable)
+  {
+    if (hardwareReadable.exchange(false))
+      CLog::LogF(LOGINFO, "pictures of the hardware decoder can't be read back, thumbnails are "
+                          "decoded in software from now on");
+    result = DecodeThumb(fileItem, chapterNumber, false, unreadable);
+  }
+  return result;
+}
+
+std::unique_ptr<CTexture> CDVDFileInfo::DecodeThumb(const CFileItem& fileItem,
+                                                    int chapterNumber,
+                                                    bool hardware,
+                                                    bool& unreadable)
+{
   const std::string redactPath = CURL::GetRedacted(fileItem.GetPath());
   auto start = std::chrono::steady_clock::now();
 
@@ -152,10 +249,12 @@ std::unique_ptr<CTexture> CDVDFileInfo::ExtractThumbToTexture(const CFileItem& f
     std::unique_ptr<CProcessInfo> pProcessInfo(CProcessInfo::CreateInstance());
     std::vector<AVPixelFormat> pixFmts;
     pixFmts.push_back(AV_PIX_FMT_YUV420P);
+    if (hardware)
+      pixFmts.push_back(AV_PIX_FMT_NV12);
     pProcessInfo->SetPixFormats(pixFmts);
 
     CDVDStreamInfo hint(*demuxer->GetStream(demuxerId, nVideoStream), true);
-    hint.codecOptions = CODEC_FORCE_SOFTWARE;
+    hint.codecOptions = hardware ? CODEC_ALLOW_FALLBACK : CODEC_FORCE_SOFTWARE;
 
     std::unique_ptr<CDVDVideoCodec> pVideoCodec =
         CDVDFactoryCodec::CreateVideoCodec(hint, *pProcessInfo);
@@ -171,11 +270,49 @@ std::unique_ptr<CTexture> CDVDFileInfo::ExtractThumbToTexture(const CFileItem& f
       CLog::LogF(LOGDEBUG, "seeking to pos {}ms (total: {}ms) in {}", nSeekTo, nTotalLen,
                  redactPath);
 
-      if (demuxer->SeekTime(static_cast<double>(nSeekTo), true))
+      CDVDVideoCodec::VCReturn iDecoderState = CDVDVideoCodec::VC_NONE;
+      VideoPicture picture = {};
+      bool seeked = demuxer->SeekTime(static_cast<double>(nSeekTo), true);
+      if (seeked)
       {
-        CDVDVideoCodec::VCReturn iDecoderState = CDVDVideoCodec::VC_NONE;
-        VideoPicture picture = {};
+        // feed the keyframe the seek landed on and drain the decoder right away, the frames
+        // referencing it are never needed
+        bool added = false;
+        for (int abort_index = demuxer->GetNrOfStreams() * 20; !added && abort_index > 0;
+             abort_index--)
+        {
+          DemuxPacket* pPacket = demuxer->Read();
+          packetsTried++;
+          if (!pPacket)
+            break;
+          if (pPacket->iStreamId == nVideoStream)
+            added = pVideoCodec->AddData(*pPacket);
+          CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+        }
+
+        if (added)
+        {
+          pVideoCodec->SetCodecControl(DVD_CODEC_CTRL_DRAIN);
+          do
+          {
+            iDecoderState = pVideoCodec->GetPicture(&picture);
+          } while (iDecoderState == CDVDVideoCodec::VC_NONE ||
+                   (iDecoderState == CDVDVideoCodec::VC_PICTURE &&
+                    (picture.iFlags & DVP_FLAG_DROPPED)));
+          pVideoCodec->SetCodecControl(0);
+        }
+
+        // not every seek lands on a keyframe, decode on from the seek point until a frame shows
+        if (iDecoderState != CDVDVideoCodec::VC_PICTURE)
+        {
+          pVideoCodec->Reset();
+          iDecoderState = CDVDVideoCodec::VC_NONE;
+          seeked = demuxer->SeekTime(static_cast<double>(nSeekTo), true);
+        }
+      }
 
+      if (seeked && iDecoderState != CDVDVideoCodec::VC_PICTURE)
+      {
         // num streams * 160 frames, should get a valid frame, if not abort.
         int abort_index = demuxer->GetNrOfStreams() * 160;
         do
@@ -208,7 +345,10 @@ std::unique_ptr<CTexture> CDVDFileInfo::ExtractThumbToTexture(const CFileItem& f
           }
 
         } while (abort_index--);
+      }
 
+      if (seeked)
+      {
         if (iDecoderState == CDVDVideoCodec::VC_PICTURE && !(picture.iFlags & DVP_FLAG_DROPPED))
         {
           unsigned int nWidth =
@@ -221,23 +361,12 @@ std::unique_ptr<CTexture> CDVDFileInfo::ExtractThumbToTexture(const CFileItem& f
 
           result = CTexture::CreateTexture(nWidth, nHeight);
           result->SetAlpha(false);
-          struct SwsContext* context =
-              sws_getContext(picture.iWidth, picture.iHeight, AV_PIX_FMT_YUV420P, nWidth, nHeight,
-                             AV_PIX_FMT_BGRA, SWS_FAST_BILINEAR, NULL, NULL, NULL);
-
-          if (context)
+          result->SetOrientation(DegreeToOrientation(hint.orientation));
+          if (!ScalePicture(picture, result->GetPixels(), static_cast<int>(result->GetPitch()),
+                            nWidth, nHeight))
           {
-            uint8_t* planes[YuvImage::MAX_PLANES];
-            int stride[YuvImage::MAX_PLANES];
-            picture.videoBuffer->GetPlanes(planes);
-            picture.videoBuffer->GetStrides(stride);
-            uint8_t* src[4] = {planes[0], planes[1], planes[2], 0};
-            int srcStride[] = {stride[0], stride[1], stride[2], 0};
-            uint8_t* dst[] = {result->GetPixels(), 0, 0, 0};
-            int dstStride[] = {static_cast<int>(result->GetPitch()), 0, 0, 0};
-            result->SetOrientation(DegreeToOrientation(hint.orientation));
-            sws_scale(context, src, srcStride, 0, picture.iHeight, dst, dstStride);
-            sws_freeContext(context);
+            unreadable = pProcessInfo->IsVideoHwDecoder();
+            result.reset();
           }
         }
         else
@@ -256,6 +385,141 @@ std::unique_ptr<CTexture> CDVDFileInfo::ExtractThumbToTexture(const CFileItem& f
   return result;
 }
 
+std::unique_ptr<CTexture> CDVDFileInfo::ExtractThumbStripToTexture(
+    const CFileItem& fileItem,
+    std::chrono::milliseconds start,
+    std::chrono::milliseconds interval,
+    unsigned int columns,
+    unsigned int rows,
+    unsigned int tileWidth,
+    unsigned int tileHeight)
+{
+  if (!CanExtract(fileItem) || interval.count() <= 0 || columns == 0 || rows == 0)
+    return {};
+
+  const std::string redactPath = CURL::GetRedacted(fileItem.GetPath());
+  auto begin = std::chrono::steady_clock::now();
+
+  CFileItem item(fileItem);
+  item.SetMimeTypeForInternetFile();
+  auto pInputStream = CDVDFactoryInputStream::CreateInputStream(NULL, item);
+  if (!pInputStream || !pInputStream->Open())
+  {
+    CLog::LogF(LOGERROR, "Error opening {}", redactPath);
+    return {};
+  }
+
+  std::unique_ptr<CDVDDemux> demuxer{CDVDFactoryDemuxer::CreateDemuxer(pInputStream, true)};
+  if (!demuxer)
+  {
+    CLog::LogF(LOGERROR, "Error creating demuxer");
+    return {};
+  }
+
+  CDemuxStream* videoStream = nullptr;
+  for (CDemuxStream* pStream : demuxer->GetStreams())
+  {
+    if (!pStream)
+      continue;
+    if (!videoStream && pStream->type == StreamType::VIDEO &&
+        !(pStream->flags & AV_DISPOSITION_ATTACHED_PIC))
+      videoStream = pStream;
+    else
+      demuxer->EnableStream(pStream->demuxerId, pStream->uniqueId, false);
+  }
+
+  const int totalLength = demuxer->GetStreamLength();
+  if (!videoStream || start.count() >= totalLength)
+    return {};
+
+  std::unique_ptr<CProcessInfo> pProcessInfo(CProcessInfo::CreateInstance());
+  std::vector<AVPixelFormat> pixFmts;
+  pixFmts.push_back(AV_PIX_FMT_YUV420P);
+  pProcessInfo->SetPixFormats(pixFmts);
+
+  CDVDStreamInfo hint(*videoStream, true);
+  hint.codecOptions = CODEC_FORCE_SOFTWARE;
+  const int videoStreamId = videoStream->uniqueId;
+
+  std::unique_ptr<CDVDVideoCodec> pVideoCodec =
+      CDVDFactoryCodec::CreateVideoCodec(hint, *pProcessInfo);
+  if (!pVideoCodec)
+    return {};
+
+  auto result = CTexture::CreateTexture(columns * tileWidth, rows * tileHeight);
+  result->SetAlpha(false);
+  std::memset(result->GetPixels(), 0, result->GetPitch() * result->GetRows());
+
+  unsigned int tiles = 0;
+  for (unsigned int i = 0; i < columns * rows; i++)
+  {
+    const std::chrono::milliseconds time = start + interval * i;
+    if (time.count() >= totalLength)
+      break;
+
+    pVideoCodec->Reset();
+    if (!demuxer->SeekTime(static_cast<double>(time.count()), true))
+      continue;
+
+    // feed the keyframe the seek landed on and drain the decoder right away, the frames
+    // referencing it are never needed
+    bool added = false;
+    for (int abort_index = demuxer->GetNrOfStreams() * 20; !added && abort_index > 0;
+         abort_index--)
+    {
+      DemuxPacket* pPacket = demuxer->Read();
+      if (!pPacket)
+        break;
+      if (pPacket->iStreamId == videoStreamId)
+        added = pVideoCodec->AddData(*pPacket);
+      CDVDDemuxUtils::FreeDemuxPacket(pPacket);
+    }
+    if (!added)
+      continue;
+
+    VideoPicture picture = {};
+    CDVDVideoCodec::VCReturn iDecoderState;
+    pVideoCodec->SetCodecControl(DVD_CODEC_CTRL_DRAIN);
+    do
+    {
+      iDecoderState = pVideoCodec->GetPicture(&picture);
+    } while (iDecoderState == CDVDVideoCodec::VC_NONE ||
+             (iDecoderState == CDVDVideoCodec::VC_PICTURE && (picture.iFlags & DVP_FLAG_DROPPED)));
+    pVideoCodec->SetCodecControl(0);
+
+    if (iDecoderState != CDVDVideoCodec::VC_PICTURE)
+      continue;
+
+    double aspect = static_cast<double>(picture.iDisplayWidth) / picture.iDisplayHeight;
+    if (hint.forced_aspect && hint.aspect != 0)
+      aspect = hint.aspect;
+    unsigned int width = tileWidth;
+    unsigned int height = static_cast<unsigned int>(tileWidth / aspect) & ~1;
+    if (height > tileHeight)
+    {
+      height = tileHeight;
+      width = static_cast<unsigned int>(tileHeight * aspect) & ~1;
+    }
+    if (width == 0 || height == 0)
+      continue;
+
+    const unsigned int x = (i % columns) * tileWidth + (tileWidth - width) / 2;
+    const unsigned int y = (i / columns) * tileHeight + (tileHeight - height) / 2;
+    uint8_t* dest = result->GetPixels() + y * result->GetPitch() + x * 4;
+    if (ScalePicture(picture, dest, static_cast<int>(result->GetPitch()), width, height))
+      tiles++;
+  }
+
+  auto end = std::chrono::steady_clock::now();
+  auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - begin);
+  CLog::LogF(LOGDEBUG, "measured {} ms to extract {} strip tiles from file <{}>", duration.count(),
+             tiles, redactPath);
+
+  if (tiles == 0)
+    return {};
+  return result;
+}
+
 bool CDVDFileInfo::CanExtract(const CFileItem& fileItem)
 {
   if (fileItem.IsFolder())
@@ -305,6 +569,15 @@ bool CDVDFileInfo::GetFileStreamDetails(CFileItem *pItem)
   if (URIUtils::IsStack(playablePath))
     playablePath = XFILE::CStackDirectory::GetFirstStackedFile(playablePath);
 
+  // the headers of a single Matroska or MP4 file usually tell all, without probing the streams
+  if (playablePath == strFileNameAndPath && CDVDContainerInspector::CanInspect(playablePath) &&
+      CDVDContainerInspector::GetStreamDetails(playablePath,
+                                               pItem->GetVideoInfoTag()->m_streamDetails))
+  {
+    ProcessExternalSubtitles(pItem);
+    return true;
+  }
+
   CFileItem item(playablePath, false);
   item.SetMimeTypeForInternetFile();
   auto pInputStream = CDVDFactoryInputStream::CreateInputStream(NULL, item);
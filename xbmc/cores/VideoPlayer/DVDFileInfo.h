@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -23,9 +24,36 @@ class CTextureDetails;
 class CDVDFileInfo
 {
 public:
+  /*!
+   * @brief Extract the image of a chapter, or a frame at a third of the file without chapters.
+   *
+   * Runs on a worker of CDVDThumbExtractionPool, so callers on different threads extract side
+   * by side, a few at a time per network host. Only the keyframe the seek lands on is decoded,
+   * with a hardware decoder when no video is playing and its pictures can be read back.
+   * @param chapterNumber the chapter, 0 for none
+   * @return the image, nullptr if no frame could be extracted
+   */
   static std::unique_ptr<CTexture> ExtractThumbToTexture(const CFileItem& fileItem,
                                                          int chapterNumber = 0);
 
+  /*!
+   * @brief Extract a grid of small frames, one every interval starting at start.
+   *
+   * Only the keyframe each seek lands on is decoded, tiles past the end of the file stay black.
+   * @param start position of the first tile
+   * @param interval time between two tiles
+   * @param columns, rows size of the grid in tiles
+   * @param tileWidth, tileHeight size of a tile, frames are letterboxed into it
+   * @return the grid, nullptr if no frame could be extracted
+   */
+  static std::unique_ptr<CTexture> ExtractThumbStripToTexture(const CFileItem& fileItem,
+                                                              std::chrono::milliseconds start,
+                                                              std::chrono::milliseconds interval,
+                                                              unsigned int columns,
+                                                              unsigned int rows,
+                                                              unsigned int tileWidth,
+                                                              unsigned int tileHeight);
+
   /*!
    * @brief Can a thumbnail image and file stream details be extracted from this file item?
   */
@@ -37,6 +65,16 @@ public:
   static bool GetFileDuration(const std::string& path, int& duration);
 
 private:
+  /*!
+   * @brief ExtractThumbToTexture() in the calling thread
+   * @param hardware try a hardware decoder first
+   * @param[out] unreadable set if the hardware decoder gave a picture that can't be read back
+   */
+  static std::unique_ptr<CTexture> DecodeThumb(const CFileItem& fileItem,
+                                               int chapterNumber,
+                                               bool hardware,
+                                               bool& unreadable);
+
   static bool DemuxerToStreamDetails(const std::shared_ptr<CDVDInputStream>& pInputStream,
                                      CDVDDemux* pDemux,
                                      CStreamDetails& details,
@@ -9,10 +9,12 @@
 #include "InputStreamPVRBase.h"
 
 #include "ServiceBroker.h"
+#include "TimeshiftBuffer.h"
 #include "cores/VideoPlayer/DVDDemuxers/DVDDemux.h"
 #include "cores/VideoPlayer/Interface/DemuxPacket.h"
 #include "pvr/PVRManager.h"
 #include "pvr/addons/PVRClient.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/log.h"
@@ -45,6 +47,8 @@ bool CInputStreamPVRBase::Open()
     m_isOpen = true;
     m_eof = false;
     m_StreamProps->iStreamCount = 0;
+    if (CanUseCoreTimeshift() && !CanPausePVRStream())
+      OpenCoreTimeshift();
     return true;
   }
   else
@@ -53,10 +57,40 @@ bool CInputStreamPVRBase::Open()
   }
 }
 
+void CInputStreamPVRBase::OpenCoreTimeshift()
+{
+  const int bufferSize =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_iPVRTimeshiftBufferSize;
+  if (bufferSize <= 0)
+    return;
+
+  int chunkSize = GetBlockSize();
+  if (chunkSize <= 0)
+    chunkSize = 64 * 1024;
+
+  m_timeshiftRealtime = IsRealtimePVRStream();
+  m_timeshift = std::make_unique<CTimeshiftBuffer>(
+      [this](uint8_t* buf, int size) { return ReadPVRStream(buf, size); },
+      static_cast<int64_t>(bufferSize) * 1024 * 1024, static_cast<size_t>(chunkSize));
+  if (!m_timeshift->Open())
+  {
+    m_timeshift.reset();
+    return;
+  }
+
+  CLog::LogF(LOGDEBUG, "Using a timeshift buffer of {} MB for {}", bufferSize, m_item.GetPath());
+}
+
 void CInputStreamPVRBase::Close()
 {
   if (m_isOpen)
   {
+    // stop reading the source before it is closed
+    if (m_timeshift)
+    {
+      m_timeshift->Close();
+      m_timeshift.reset();
+    }
     ClosePVRStream();
     CDVDInputStream::Close();
     m_eof = true;
@@ -66,7 +100,7 @@ void CInputStreamPVRBase::Close()
 
 int CInputStreamPVRBase::Read(uint8_t* buf, int buf_size)
 {
-  int ret = ReadPVRStream(buf, buf_size);
+  int ret = m_timeshift ? m_timeshift->Read(buf, buf_size) : ReadPVRStream(buf, buf_size);
 
   // we currently don't support non completing reads
   if (ret == 0)
@@ -82,7 +116,7 @@ int64_t CInputStreamPVRBase::Seek(int64_t offset, int whence)
   if (whence == DVDSTREAM_SEEK_POSSIBLE)
     return CanSeek() ? 1 : 0;
 
-  int64_t ret = SeekPVRStream(offset, whence);
+  int64_t ret = m_timeshift ? m_timeshift->Seek(offset, whence) : SeekPVRStream(offset, whence);
 
   // if we succeed, we are not eof anymore
   if (ret >= 0)
@@ -93,6 +127,9 @@ int64_t CInputStreamPVRBase::Seek(int64_t offset, int whence)
 
 int64_t CInputStreamPVRBase::GetLength()
 {
+  if (m_timeshift)
+    return m_timeshift->GetLength();
+
   return GetPVRStreamLength();
 }
 
@@ -108,6 +145,10 @@ int CInputStreamPVRBase::GetBlockSize()
 
 bool CInputStreamPVRBase::GetTimes(Times &times)
 {
+  // the times of the source don't match the buffered stream
+  if (m_timeshift)
+    return false;
+
   return GetPVRStreamTimes(times);
 }
 
@@ -118,21 +159,26 @@ CDVDInputStream::ENextStream CInputStreamPVRBase::NextStream()
 
 bool CInputStreamPVRBase::CanPause()
 {
-  return CanPausePVRStream();
+  return m_timeshift || CanPausePVRStream();
 }
 
 bool CInputStreamPVRBase::CanSeek()
 {
-  return CanSeekPVRStream();
+  return m_timeshift || CanSeekPVRStream();
 }
 
 void CInputStreamPVRBase::Pause(bool bPaused)
 {
-  PausePVRStream(bPaused);
+  // the buffer keeps reading the source while paused
+  if (!m_timeshift)
+    PausePVRStream(bPaused);
 }
 
 bool CInputStreamPVRBase::IsRealtime()
 {
+  if (m_timeshift)
+    return m_timeshiftRealtime && m_timeshift->IsAtLiveEdge();
+
   return IsRealtimePVRStream();
 }
 
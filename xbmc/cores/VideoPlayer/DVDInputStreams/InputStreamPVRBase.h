@@ -15,6 +15,7 @@
 #include <vector>
 
 class CFileItem;
+class CTimeshiftBuffer;
 class IDemux;
 class IVideoPlayer;
 struct PVR_STREAM_PROPERTIES;
@@ -82,10 +83,19 @@ protected:
   virtual void PausePVRStream(bool paused) = 0;
   virtual bool GetPVRStreamTimes(Times& times) = 0;
 
+  /*!
+   * \brief Whether the stream may be buffered by the core if the source can't pause it
+   */
+  virtual bool CanUseCoreTimeshift() { return false; }
+
 private:
+  void OpenCoreTimeshift();
+
   bool m_eof = true;
   std::shared_ptr<PVR_STREAM_PROPERTIES> m_StreamProps;
   std::map<int, std::shared_ptr<CDemuxStream>> m_streamMap;
   std::shared_ptr<PVR::CPVRClient> m_client;
   bool m_isOpen{false};
+  std::unique_ptr<CTimeshiftBuffer> m_timeshift;
+  bool m_timeshiftRealtime{false};
 };
@@ -124,3 +124,9 @@ bool CInputStreamPVRChannel::GetPVRStreamTimes(Times& times)
     return false;
   }
 }
+
+bool CInputStreamPVRChannel::CanUseCoreTimeshift()
+{
+  // the add-on demuxer doesn't read from this stream
+  return !m_bDemuxActive;
+}
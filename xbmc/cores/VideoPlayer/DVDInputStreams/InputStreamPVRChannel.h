@@ -30,6 +30,7 @@ protected:
   bool IsRealtimePVRStream() override;
   void PausePVRStream(bool paused) override;
   bool GetPVRStreamTimes(Times& times) override;
+  bool CanUseCoreTimeshift() override;
 
 private:
   bool m_bDemuxActive = false;
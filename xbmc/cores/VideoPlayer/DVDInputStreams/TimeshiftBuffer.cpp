@@ -0,0 +1,245 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "TimeshiftBuffer.h"
+
+#include "Util.h"
+#include "filesystem/IFileTypes.h"
+#include "threads/SystemClock.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <utility>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr size_t MEMORY_RING_SIZE = 16 * 1024 * 1024;
+constexpr auto READ_TIMEOUT = 10s;
+} // unnamed namespace
+
+CTimeshiftBuffer::CTimeshiftBuffer(SourceReader source, int64_t diskSize, size_t chunkSize)
+  : CThread("TimeshiftBuffer"),
+    m_source(std::move(source)),
+    m_diskSize(std::max<int64_t>(diskSize, MEMORY_RING_SIZE)),
+    m_chunkSize(std::min(chunkSize, MEMORY_RING_SIZE))
+{
+}
+
+CTimeshiftBuffer::~CTimeshiftBuffer()
+{
+  Close();
+}
+
+bool CTimeshiftBuffer::Open()
+{
+  Close();
+
+  m_filename = CUtil::GetNextFilename("special://temp/timeshift{:03}.ts", 999);
+  if (m_filename.empty())
+  {
+    CLog::LogF(LOGERROR, "Unable to generate a new filename");
+    return false;
+  }
+
+  if (!m_fileWrite.OpenForWrite(m_filename, true) || !m_fileRead.Open(m_filename, XFILE::READ_NO_CACHE))
+  {
+    CLog::LogF(LOGERROR, "Failed to create the ring file {}", m_filename);
+    Close();
+    return false;
+  }
+
+  m_memory.resize(MEMORY_RING_SIZE);
+  m_startPosition = 0;
+  m_writePosition = 0;
+  m_readPosition = 0;
+  m_endOfInput = false;
+  Create();
+  return true;
+}
+
+void CTimeshiftBuffer::Close()
+{
+  // the source may block for a while, the thread finishes with the read in progress
+  StopThread(true);
+
+  m_fileWrite.Close();
+  m_fileRead.Close();
+  if (!m_filename.empty() && !XFILE::CFile::Delete(m_filename))
+    CLog::LogF(LOGWARNING, "Failed to delete the ring file {}", m_filename);
+  m_filename.clear();
+
+  std::unique_lock<CCriticalSection> lock(m_section);
+  m_memory.clear();
+  m_memory.shrink_to_fit();
+  m_startPosition = 0;
+  m_writePosition = 0;
+  m_readPosition = 0;
+  m_endOfInput = true;
+}
+
+void CTimeshiftBuffer::Process()
+{
+  std::vector<uint8_t> buffer(m_chunkSize);
+  while (!m_bStop)
+  {
+    const int read = m_source(buffer.data(), static_cast<int>(buffer.size()));
+    if (read <= 0)
+    {
+      if (read < 0)
+        CLog::LogF(LOGERROR, "Reading the source failed, ending the stream");
+      break;
+    }
+
+    if (!WriteToRing(buffer.data(), static_cast<size_t>(read)))
+      break;
+  }
+
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    m_endOfInput = true;
+  }
+  m_dataAvailable.Set();
+}
+
+bool CTimeshiftBuffer::WriteToRing(const uint8_t* buf, size_t size)
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+
+  // the oldest data is overwritten, a reader still there continues with what is left
+  const int64_t end = m_writePosition + static_cast<int64_t>(size);
+  m_startPosition = std::max(m_startPosition, end - m_diskSize);
+  if (m_readPosition < m_startPosition)
+  {
+    CLog::LogF(LOGDEBUG, "Ring is full, skipping {} bytes", m_startPosition - m_readPosition);
+    m_readPosition = m_startPosition;
+  }
+
+  for (size_t done = 0; done < size;)
+  {
+    const int64_t offset = (m_writePosition + static_cast<int64_t>(done)) % m_diskSize;
+    const size_t length = static_cast<size_t>(
+        std::min<int64_t>(static_cast<int64_t>(size - done), m_diskSize - offset));
+    if (m_fileWrite.Seek(offset, SEEK_SET) != offset ||
+        m_fileWrite.Write(buf + done, length) != static_cast<ssize_t>(length))
+    {
+      CLog::LogF(LOGERROR, "Failed to write to the ring file {}", m_filename);
+      return false;
+    }
+    done += length;
+  }
+
+  for (size_t done = 0; done < size;)
+  {
+    const size_t offset = (m_writePosition + done) % m_memory.size();
+    const size_t length = std::min(size - done, m_memory.size() - offset);
+    std::memcpy(m_memory.data() + offset, buf + done, length);
+    done += length;
+  }
+
+  m_writePosition = end;
+  m_dataAvailable.Set();
+  return true;
+}
+
+int CTimeshiftBuffer::Read(uint8_t* buf, int size)
+{
+  if (size <= 0)
+    return 0;
+
+  XbmcThreads::EndTime<> timeout{READ_TIMEOUT};
+  std::unique_lock<CCriticalSection> lock(m_section);
+  while (m_readPosition >= m_writePosition)
+  {
+    if (m_endOfInput)
+      return 0;
+
+    lock.unlock();
+    const bool signaled = m_dataAvailable.Wait(timeout.GetTimeLeft());
+    lock.lock();
+    if (!signaled && m_readPosition >= m_writePosition)
+    {
+      CLog::LogF(LOGERROR, "No data from the source for {} seconds", READ_TIMEOUT.count());
+      return -1;
+    }
+  }
+
+  const size_t length = static_cast<size_t>(
+      std::min<int64_t>(size, m_writePosition - m_readPosition));
+  if (m_writePosition - m_readPosition <= static_cast<int64_t>(m_memory.size()))
+  {
+    for (size_t done = 0; done < length;)
+    {
+      const size_t offset = (m_readPosition + done) % m_memory.size();
+      const size_t chunk = std::min(length - done, m_memory.size() - offset);
+      std::memcpy(buf + done, m_memory.data() + offset, chunk);
+      done += chunk;
+    }
+  }
+  else
+  {
+    for (size_t done = 0; done < length;)
+    {
+      const int64_t offset = (m_readPosition + static_cast<int64_t>(done)) % m_diskSize;
+      const size_t chunk = static_cast<size_t>(
+          std::min<int64_t>(static_cast<int64_t>(length - done), m_diskSize - offset));
+      if (m_fileRead.Seek(offset, SEEK_SET) != offset ||
+          m_fileRead.Read(buf + done, chunk) != static_cast<ssize_t>(chunk))
+      {
+        CLog::LogF(LOGERROR, "Failed to read from the ring file {}", m_filename);
+        return -1;
+      }
+      done += chunk;
+    }
+  }
+
+  m_readPosition += static_cast<int64_t>(length);
+  return static_cast<int>(length);
+}
+
+int64_t CTimeshiftBuffer::Seek(int64_t offset, int whence)
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+
+  int64_t target;
+  if (whence == SEEK_SET)
+    target = offset;
+  else if (whence == SEEK_CUR)
+    target = m_readPosition + offset;
+  else if (whence == SEEK_END)
+    target = m_writePosition + offset;
+  else
+    return -1;
+
+  if (target < m_startPosition || target > m_writePosition)
+    return -1;
+
+  m_readPosition = target;
+  return target;
+}
+
+int64_t CTimeshiftBuffer::GetLength() const
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  return m_writePosition;
+}
+
+bool CTimeshiftBuffer::IsEOF() const
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  return m_endOfInput && m_readPosition >= m_writePosition;
+}
+
+bool CTimeshiftBuffer::IsAtLiveEdge() const
+{
+  std::unique_lock<CCriticalSection> lock(m_section);
+  return m_writePosition - m_readPosition <= static_cast<int64_t>(m_memory.size());
+}
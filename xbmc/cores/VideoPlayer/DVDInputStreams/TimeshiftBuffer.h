@@ -0,0 +1,81 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "filesystem/File.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+#include "threads/Thread.h"
+
+#include <functional>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief Timeshift ring for live streams that can't be paused by their source
+ *
+ * A thread keeps reading the source and writes the data to a ring file in the temp folder, so
+ * the stream can be paused and rewound up to the size of the ring. The newest data is also kept
+ * in a small memory ring, reading at or close to the live edge never touches the disk. Positions
+ * are byte offsets from the start of the stream, the oldest data is dropped once the ring is full.
+ */
+class CTimeshiftBuffer : private CThread
+{
+public:
+  /*!
+   * \brief Reads up to size bytes from the stream
+   * \return the number of bytes read, 0 at the end of the stream, -1 on error
+   */
+  using SourceReader = std::function<int(uint8_t* buf, int size)>;
+
+  CTimeshiftBuffer(SourceReader source, int64_t diskSize, size_t chunkSize);
+  ~CTimeshiftBuffer() override;
+
+  /*!
+   * \brief Create the ring file and start reading the source
+   * \return false if the ring file can't be created
+   */
+  bool Open();
+  void Close();
+
+  int Read(uint8_t* buf, int size);
+  int64_t Seek(int64_t offset, int whence);
+
+  /*!
+   * \brief The position after the newest data
+   */
+  int64_t GetLength() const;
+
+  bool IsEOF() const;
+
+  /*!
+   * \brief Whether the reader is at the live edge, reading data that just arrived
+   */
+  bool IsAtLiveEdge() const;
+
+private:
+  void Process() override;
+  bool WriteToRing(const uint8_t* buf, size_t size);
+
+  SourceReader m_source;
+  const int64_t m_diskSize;
+  const size_t m_chunkSize;
+
+  mutable CCriticalSection m_section;
+  CEvent m_dataAvailable;
+  XFILE::CFile m_fileWrite;
+  XFILE::CFile m_fileRead;
+  std::string m_filename;
+  std::vector<uint8_t> m_memory; ///< ring of the newest data, indexed by position modulo its size
+  int64_t m_startPosition = 0; ///< oldest position still in the ring
+  int64_t m_writePosition = 0;
+  int64_t m_readPosition = 0;
+  bool m_endOfInput = false;
+};
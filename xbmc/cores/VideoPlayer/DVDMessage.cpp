@@ -17,9 +17,103 @@
 
 #include <algorithm>
 #include <mutex>
+#include <new>
+#include <vector>
 
 using namespace std::chrono_literals;
 
+namespace
+{
+/*!
+ * \brief Free list of equally sized memory blocks, shared by all threads.
+ */
+class CMsgBlockPool
+{
+public:
+  explicit CMsgBlockPool(size_t blockSize) : m_blockSize(blockSize) {}
+
+  void* Allocate()
+  {
+    {
+      std::unique_lock lock(m_section);
+      if (!m_blocks.empty())
+      {
+        void* block = m_blocks.back();
+        m_blocks.pop_back();
+        return block;
+      }
+    }
+    return ::operator new(m_blockSize);
+  }
+
+  void Free(void* block)
+  {
+    {
+      std::unique_lock lock(m_section);
+      if (m_blocks.size() < MAX_BLOCKS)
+      {
+        m_blocks.push_back(block);
+        return;
+      }
+    }
+    ::operator delete(block);
+  }
+
+private:
+  // enough for the deepest video + audio queues, anything above goes back to the heap
+  static constexpr size_t MAX_BLOCKS = 8192;
+
+  const size_t m_blockSize;
+  CCriticalSection m_section;
+  std::vector<void*> m_blocks;
+};
+
+/*!
+ * \brief Allocator for std::allocate_shared, recycles the combined control block and object.
+ */
+template<typename T>
+class CMsgPoolAllocator
+{
+public:
+  using value_type = T;
+
+  CMsgPoolAllocator() = default;
+  template<typename U>
+  explicit CMsgPoolAllocator(const CMsgPoolAllocator<U>&)
+  {
+  }
+
+  T* allocate(size_t n)
+  {
+    if (n != 1)
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    return static_cast<T*>(GetPool().Allocate());
+  }
+
+  void deallocate(T* p, size_t n)
+  {
+    if (n != 1)
+      ::operator delete(p);
+    else
+      GetPool().Free(p);
+  }
+
+  template<typename U>
+  bool operator==(const CMsgPoolAllocator<U>&) const
+  {
+    return true;
+  }
+
+private:
+  static CMsgBlockPool& GetPool()
+  {
+    // intentionally leaked, messages may still be released during static destruction
+    static CMsgBlockPool* pool = new CMsgBlockPool(sizeof(T));
+    return *pool;
+  }
+};
+} // namespace
+
 class CDVDMsgGeneralSynchronizePriv
 {
 public:
@@ -101,6 +195,12 @@ CDVDMsgDemuxerPacket::~CDVDMsgDemuxerPacket()
     CDVDDemuxUtils::FreeDemuxPacket(m_packet);
 }
 
+std::shared_ptr<CDVDMsgDemuxerPacket> CDVDMsgDemuxerPacket::Create(DemuxPacket* packet, bool drop)
+{
+  return std::allocate_shared<CDVDMsgDemuxerPacket>(CMsgPoolAllocator<CDVDMsgDemuxerPacket>(),
+                                                    packet, drop);
+}
+
 unsigned int CDVDMsgDemuxerPacket::GetPacketSize()
 {
   if (m_packet)
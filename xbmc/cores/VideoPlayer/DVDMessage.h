@@ -12,6 +12,7 @@
 #include "cores/IPlayer.h"
 
 #include <atomic>
+#include <memory>
 #include <string.h>
 #include <string>
 
@@ -295,6 +296,15 @@ class CDVDMsgDemuxerPacket : public CDVDMsg
 public:
   CDVDMsgDemuxerPacket(DemuxPacket* packet, bool drop = false);
   ~CDVDMsgDemuxerPacket() override;
+
+  /*!
+   * \brief Create a packet message from a pool of recycled message blocks.
+   *
+   * Use this on the demux path instead of std::make_shared, once the pool is warm no heap
+   * allocation happens per packet.
+   */
+  static std::shared_ptr<CDVDMsgDemuxerPacket> Create(DemuxPacket* packet, bool drop = false);
+
   DemuxPacket* GetPacket() { return m_packet; }
   unsigned int GetPacketSize();
   bool GetPacketDrop() { return m_drop; }
@@ -17,6 +17,44 @@
 
 using namespace std::chrono_literals;
 
+namespace
+{
+constexpr uint64_t RING_MAX_PACKETS = 0xFFFF;
+
+constexpr uint64_t MakeRingState(uint64_t generation, uint64_t count, uint64_t size)
+{
+  return ((generation & 0xFFFF) << 48) | ((count & 0xFFFF) << 32) | (size & 0xFFFFFFFF);
+}
+
+constexpr unsigned int RingGeneration(uint64_t state)
+{
+  return static_cast<unsigned int>(state >> 48);
+}
+
+constexpr unsigned int RingCount(uint64_t state)
+{
+  return static_cast<unsigned int>((state >> 32) & 0xFFFF);
+}
+
+constexpr int RingSize(uint64_t state)
+{
+  return static_cast<int>(state & 0xFFFFFFFF);
+}
+
+// true if generation a was stamped before generation b, takes wrap around into account
+constexpr bool IsOlderGeneration(unsigned int a, unsigned int b)
+{
+  return static_cast<int16_t>(static_cast<uint16_t>(a - b)) < 0;
+}
+
+DemuxPacket* GetDemuxPacket(const std::shared_ptr<CDVDMsg>& msg)
+{
+  if (!msg->IsType(CDVDMsg::DEMUXER_PACKET))
+    return nullptr;
+  return static_cast<CDVDMsgDemuxerPacket*>(msg.get())->GetPacket();
+}
+} // namespace
+
 CDVDMessageQueue::CDVDMessageQueue(const std::string &owner) : m_hEvent(true), m_owner(owner)
 {
   m_iDataSize     = 0;
@@ -32,20 +70,43 @@ CDVDMessageQueue::~CDVDMessageQueue()
 {
   // remove all remaining messages
   Flush(CDVDMsg::NONE);
+  DrainRing();
+}
+
+void CDVDMessageQueue::SetRingMode(size_t capacity)
+{
+  std::unique_lock producer(m_producerSection);
+  std::unique_lock lock(m_section);
+
+  if (m_bInitialized)
+  {
+    CLog::Log(LOGERROR, "CDVDMessageQueue({})::SetRingMode called on an initialized queue",
+              m_owner);
+    return;
+  }
+
+  m_ring = std::make_unique<XbmcThreads::CSPSCQueue<RingItem>>(capacity);
 }
 
 void CDVDMessageQueue::Init()
 {
+  DrainRing();
+
   m_iDataSize = 0;
   m_bAbortRequest = false;
   m_bInitialized = true;
   m_TimeBack = DVD_NOPTS_VALUE;
   m_TimeFront = DVD_NOPTS_VALUE;
   m_drain = false;
+  m_overflow = false;
+  m_lockedPending = false;
+  m_ringState = MakeRingState(RingGeneration(m_ringState), 0, 0);
+  m_flushAllGeneration = RingGeneration(m_ringState);
 }
 
 void CDVDMessageQueue::Flush(CDVDMsg::Message type)
 {
+  std::unique_lock producer(m_producerSection);
   std::unique_lock lock(m_section);
 
   m_messages.remove_if([type](const DVDMessageListItem &item){
@@ -56,11 +117,31 @@ void CDVDMessageQueue::Flush(CDVDMsg::Message type)
     return type == CDVDMsg::NONE || item.message->IsType(type);
   });
 
+  m_returnedMessages.remove_if([type](const DVDMessageListItem& item)
+                               { return type == CDVDMsg::NONE || item.message->IsType(type); });
+
   if (type == CDVDMsg::DEMUXER_PACKET ||  type == CDVDMsg::NONE)
   {
     m_iDataSize = 0;
     m_TimeBack = DVD_NOPTS_VALUE;
     m_TimeFront = DVD_NOPTS_VALUE;
+
+    // ring slots can only be released by the consumer, so bump the generation and let it skip
+    // the stale ones on its next Get()
+    if (m_ring)
+    {
+      const unsigned int generation = (RingGeneration(m_ringState) + 1) & 0xFFFF;
+      m_ringState = MakeRingState(generation, 0, 0);
+      if (type == CDVDMsg::NONE)
+        m_flushAllGeneration = generation;
+    }
+  }
+
+  if (m_ring)
+  {
+    if (m_messages.empty())
+      m_overflow = false;
+    UpdateLockedPending();
   }
 }
 
@@ -76,9 +157,11 @@ void CDVDMessageQueue::Abort()
 
 void CDVDMessageQueue::End()
 {
+  std::unique_lock producer(m_producerSection);
   std::unique_lock lock(m_section);
 
   Flush(CDVDMsg::NONE);
+  DrainRing();
 
   m_bInitialized = false;
   m_iDataSize = 0;
@@ -99,6 +182,9 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
                                          int priority,
                                          bool front)
 {
+  if (m_ring && priority == 0 && front)
+    return PutRing(pMsg);
+
   std::unique_lock lock(m_section);
 
   if (!m_bInitialized)
@@ -124,6 +210,13 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
                            });
     m_prioMessages.emplace(it, pMsg, priority);
   }
+  else if (m_ring)
+  {
+    // PutBack() from the consumer, hand it out again before anything from the ring
+    if (!AddRingPacket(GetDemuxPacket(pMsg)))
+      return MSGQ_OUT_OF_MEMORY;
+    m_returnedMessages.emplace_back(pMsg, priority);
+  }
   else
   {
     if (m_messages.empty())
@@ -139,7 +232,11 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
       m_messages.emplace_back(pMsg, priority);
   }
 
-  if (pMsg->IsType(CDVDMsg::DEMUXER_PACKET) && priority == 0)
+  if (m_ring)
+  {
+    UpdateLockedPending();
+  }
+  else if (pMsg->IsType(CDVDMsg::DEMUXER_PACKET) && priority == 0)
   {
     DemuxPacket* packet = static_cast<CDVDMsgDemuxerPacket*>(pMsg.get())->GetPacket();
     if (packet)
@@ -162,6 +259,9 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
                                          std::chrono::milliseconds timeout,
                                          int& priority)
 {
+  if (m_ring)
+    return GetRing(pMsg, timeout, priority);
+
   std::unique_lock lock(m_section);
 
   int ret = 0;
@@ -221,6 +321,251 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
   return (MsgQueueReturnCode)ret;
 }
 
+MsgQueueReturnCode CDVDMessageQueue::PutRing(const std::shared_ptr<CDVDMsg>& pMsg)
+{
+  std::unique_lock producer(m_producerSection);
+
+  if (!m_bInitialized)
+  {
+    CLog::Log(LOGWARNING, "CDVDMessageQueue({})::Put MSGQ_NOT_INITIALIZED", m_owner);
+    return MSGQ_NOT_INITIALIZED;
+  }
+  if (!pMsg)
+  {
+    CLog::Log(LOGFATAL, "CDVDMessageQueue({})::Put MSGQ_INVALID_MSG", m_owner);
+    return MSGQ_INVALID_MSG;
+  }
+
+  const DemuxPacket* packet = GetDemuxPacket(pMsg);
+  if (!AddRingPacket(packet))
+  {
+    CLog::Log(LOGERROR, "CDVDMessageQueue({})::Put MSGQ_OUT_OF_MEMORY", m_owner);
+    return MSGQ_OUT_OF_MEMORY;
+  }
+
+  // Flush() needs the producer lock, so the generation can't change until the slot is published
+  RingItem item{pMsg, RingGeneration(m_ringState)};
+  if (m_overflow || !m_ring->Push(std::move(item)))
+  {
+    std::unique_lock lock(m_section);
+    m_overflow = true;
+    m_messages.emplace_front(pMsg, 0);
+    UpdateLockedPending();
+    UpdateRingTimeFront(packet);
+    m_hEvent.Set();
+    return MSGQ_OK;
+  }
+
+  UpdateRingTimeFront(packet);
+
+  // pairs with the fence in GetRing(), only wake the consumer if it is about to sleep
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (m_waiting.load(std::memory_order_relaxed))
+    m_hEvent.Set();
+
+  return MSGQ_OK;
+}
+
+MsgQueueReturnCode CDVDMessageQueue::GetRing(std::shared_ptr<CDVDMsg>& pMsg,
+                                             std::chrono::milliseconds timeout,
+                                             int& priority)
+{
+  if (!m_bInitialized)
+  {
+    CLog::Log(LOGFATAL, "CDVDMessageQueue({})::Get MSGQ_NOT_INITIALIZED", m_owner);
+    return MSGQ_NOT_INITIALIZED;
+  }
+
+  while (!m_bAbortRequest)
+  {
+    if (priority > 0 || m_lockedPending)
+    {
+      std::unique_lock lock(m_section);
+      if (GetRingLocked(pMsg, priority))
+        return MSGQ_OK;
+      if (timeout == 0ms)
+        return MSGQ_TIMEOUT;
+
+      // reset under the lock, so that no locked Put() can slip in between
+      m_hEvent.Reset();
+    }
+    else
+    {
+      if (PopRing(pMsg))
+        return MSGQ_OK;
+      if (timeout == 0ms)
+        return MSGQ_TIMEOUT;
+
+      m_hEvent.Reset();
+    }
+
+    m_waiting.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // recheck, the producer may have published a slot before it saw m_waiting
+    const bool pending = priority == 0 && (m_lockedPending || !m_ring->Empty());
+    if (!pending && !m_bAbortRequest && !m_hEvent.Wait(timeout))
+    {
+      m_waiting = false;
+      return MSGQ_TIMEOUT;
+    }
+    m_waiting = false;
+  }
+
+  return MSGQ_ABORT;
+}
+
+bool CDVDMessageQueue::GetRingLocked(std::shared_ptr<CDVDMsg>& pMsg, int& priority)
+{
+  if (priority > 0 || !m_prioMessages.empty())
+  {
+    if (m_prioMessages.empty() || (m_prioMessages.back().priority < priority && !m_drain))
+      return false;
+
+    priority = m_prioMessages.back().priority;
+    pMsg = std::move(m_prioMessages.back().message);
+    m_prioMessages.pop_back();
+    UpdateLockedPending();
+    return true;
+  }
+
+  std::list<DVDMessageListItem>* msgs = nullptr;
+  if (!m_returnedMessages.empty())
+    msgs = &m_returnedMessages;
+  else if (PopRing(pMsg))
+    return true;
+  else if (!m_messages.empty())
+    msgs = &m_messages;
+
+  if (!msgs)
+  {
+    m_overflow = false;
+    UpdateLockedPending();
+    return false;
+  }
+
+  priority = 0;
+  pMsg = std::move(msgs->back().message);
+  msgs->pop_back();
+  ReleaseRingPacket(RingGeneration(m_ringState), GetDemuxPacket(pMsg));
+
+  if (m_messages.empty())
+    m_overflow = false;
+  UpdateLockedPending();
+  UpdateRingTimeBack();
+  return true;
+}
+
+bool CDVDMessageQueue::PopRing(std::shared_ptr<CDVDMsg>& pMsg)
+{
+  RingItem item;
+  while (m_ring->Pop(item))
+  {
+    const DemuxPacket* packet = GetDemuxPacket(item.message);
+    if (IsOlderGeneration(item.generation, m_flushAllGeneration))
+      continue;
+    if (!ReleaseRingPacket(item.generation, packet) && packet)
+      continue;
+
+    pMsg = std::move(item.message);
+    UpdateRingTimeBack();
+    return true;
+  }
+  return false;
+}
+
+void CDVDMessageQueue::DrainRing()
+{
+  if (!m_ring)
+    return;
+
+  RingItem item;
+  while (m_ring->Pop(item))
+    item.message.reset();
+}
+
+bool CDVDMessageQueue::AddRingPacket(const DemuxPacket* packet)
+{
+  if (!packet)
+    return true;
+
+  uint64_t state = m_ringState.load();
+  uint64_t newState;
+  do
+  {
+    if (RingCount(state) >= RING_MAX_PACKETS)
+      return false;
+    newState = MakeRingState(RingGeneration(state), RingCount(state) + 1,
+                             RingSize(state) + packet->iSize);
+  } while (!m_ringState.compare_exchange_weak(state, newState));
+
+  return true;
+}
+
+bool CDVDMessageQueue::ReleaseRingPacket(unsigned int generation, const DemuxPacket* packet)
+{
+  if (!packet)
+    return true;
+
+  uint64_t state = m_ringState.load();
+  uint64_t newState;
+  do
+  {
+    // packet was flushed, its size is no longer accounted for
+    if (RingGeneration(state) != generation)
+      return false;
+    newState = MakeRingState(generation, RingCount(state) - 1, RingSize(state) - packet->iSize);
+  } while (!m_ringState.compare_exchange_weak(state, newState));
+
+  return true;
+}
+
+void CDVDMessageQueue::UpdateRingTimeFront(const DemuxPacket* packet)
+{
+  if (!packet)
+    return;
+
+  if (packet->dts != DVD_NOPTS_VALUE)
+    m_TimeFront = packet->dts;
+  else if (packet->pts != DVD_NOPTS_VALUE)
+    m_TimeFront = packet->pts;
+
+  if (m_TimeBack == DVD_NOPTS_VALUE)
+    m_TimeBack = m_TimeFront.load();
+}
+
+void CDVDMessageQueue::UpdateRingTimeBack()
+{
+  // next message the consumer will see, ring slots are always older than the overflow lane
+  const DemuxPacket* packet = nullptr;
+  if (const RingItem* item = m_ring->Front())
+    packet = GetDemuxPacket(item->message);
+
+  if (!packet)
+    return;
+
+  if (packet->dts != DVD_NOPTS_VALUE)
+    m_TimeBack = packet->dts;
+  else if (packet->pts != DVD_NOPTS_VALUE)
+    m_TimeBack = packet->pts;
+
+  if (m_TimeFront == DVD_NOPTS_VALUE)
+    m_TimeFront = m_TimeBack.load();
+}
+
+void CDVDMessageQueue::UpdateLockedPending()
+{
+  m_lockedPending = !m_prioMessages.empty() || !m_returnedMessages.empty() || m_overflow;
+}
+
+int CDVDMessageQueue::DataSize() const
+{
+  if (m_ring)
+    return RingSize(m_ringState);
+
+  return m_iDataSize;
+}
+
 void CDVDMessageQueue::UpdateTimeFront()
 {
   if (!m_messages.empty())
@@ -238,7 +583,7 @@ void CDVDMessageQueue::UpdateTimeFront()
           m_TimeFront = packet->pts;
 
         if (m_TimeBack == DVD_NOPTS_VALUE)
-          m_TimeBack = m_TimeFront;
+          m_TimeBack = m_TimeFront.load();
       }
     }
   }
@@ -261,7 +606,7 @@ void CDVDMessageQueue::UpdateTimeBack()
           m_TimeBack = packet->pts;
 
         if (m_TimeFront == DVD_NOPTS_VALUE)
-          m_TimeFront = m_TimeBack;
+          m_TimeFront = m_TimeBack.load();
       }
     }
   }
@@ -275,6 +620,33 @@ unsigned CDVDMessageQueue::GetPacketCount(CDVDMsg::Message type)
     return 0;
 
   unsigned count = 0;
+
+  // messages in the ring can't be inspected from here, but packets are accounted for
+  if (m_ring)
+  {
+    if (type == CDVDMsg::DEMUXER_PACKET)
+      count += RingCount(m_ringState);
+    else
+    {
+      for (const auto& item : m_messages)
+      {
+        if (item.message->IsType(type))
+          count++;
+      }
+      for (const auto& item : m_returnedMessages)
+      {
+        if (item.message->IsType(type))
+          count++;
+      }
+    }
+    for (const auto& item : m_prioMessages)
+    {
+      if (item.message->IsType(type))
+        count++;
+    }
+    return count;
+  }
+
   for (const auto &item : m_messages)
   {
     if(item.message->IsType(type))
@@ -311,20 +683,21 @@ int CDVDMessageQueue::GetLevel(bool dataLevel) const
 {
   std::unique_lock lock(m_section);
 
-  if (m_iDataSize > m_iMaxDataSize)
+  const int dataSize = DataSize();
+  if (dataSize > m_iMaxDataSize)
     return 100;
-  if (m_iDataSize == 0)
+  if (dataSize == 0)
     return 0;
 
   if (IsDataBased() || dataLevel)
   {
-    return std::min(100, 100 * m_iDataSize / m_iMaxDataSize);
+    return std::min(100, 100 * dataSize / m_iMaxDataSize);
   }
 
   int level = std::min(100.0, ceil(100.0 * m_TimeSize * (m_TimeFront - m_TimeBack) / DVD_TIME_BASE ));
 
   // if we added lots of packets with NOPTS, make sure that the queue is not signalled empty
-  if (level == 0 && m_iDataSize != 0)
+  if (level == 0 && dataSize != 0)
   {
     CLog::Log(LOGDEBUG, "CDVDMessageQueue::GetLevel() - can't determine level");
     return 1;
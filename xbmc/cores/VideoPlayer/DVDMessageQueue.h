@@ -11,10 +11,13 @@
 #include "DVDMessage.h"
 #include "threads/CriticalSection.h"
 #include "threads/Event.h"
+#include "threads/SPSCQueue.h"
 
 #include <algorithm>
 #include <atomic>
+#include <cstdint>
 #include <list>
+#include <memory>
 #include <string>
 
 struct DVDMessageListItem
@@ -51,6 +54,20 @@ public:
   explicit CDVDMessageQueue(const std::string &owner);
   virtual ~CDVDMessageQueue();
 
+  /*!
+   * \brief Carry priority 0 messages (data packets) through a lock-free ring.
+   *
+   * Meant for the demuxer -> stream player queues. Put() of priority 0 messages from the
+   * producer and Get() from the single consumer thread then never contend on the queue lock,
+   * priority messages keep using their own locked lane. PutBack() must only be called from the
+   * consumer thread and Flush() only supports DEMUXER_PACKET and NONE for the ring contents.
+   * Must be called before Init().
+   *
+   * \param capacity Number of ring slots, rounded up to a power of two. Messages beyond that
+   *                 spill into a locked overflow list.
+   */
+  void SetRingMode(size_t capacity);
+
   void Init();
   void Flush(CDVDMsg::Message message = CDVDMsg::DEMUXER_PACKET);
   void Abort();
@@ -73,7 +90,7 @@ public:
     return Get(pMsg, timeout, priority);
   }
 
-  int GetDataSize() const { return m_iDataSize; }
+  int GetDataSize() const { return DataSize(); }
   double GetTimeSize() const;
   unsigned GetPacketCount(CDVDMsg::Message type);
   bool ReceivedAbortRequest() { return m_bAbortRequest; }
@@ -98,7 +115,26 @@ public:
   bool IsDataBased() const;
 
 private:
+  struct RingItem
+  {
+    std::shared_ptr<CDVDMsg> message;
+    unsigned int generation = 0;
+  };
+
   MsgQueueReturnCode Put(const std::shared_ptr<CDVDMsg>& pMsg, int priority, bool front);
+  MsgQueueReturnCode PutRing(const std::shared_ptr<CDVDMsg>& pMsg);
+  MsgQueueReturnCode GetRing(std::shared_ptr<CDVDMsg>& pMsg,
+                             std::chrono::milliseconds timeout,
+                             int& priority);
+  bool GetRingLocked(std::shared_ptr<CDVDMsg>& pMsg, int& priority);
+  bool PopRing(std::shared_ptr<CDVDMsg>& pMsg);
+  void DrainRing();
+  bool AddRingPacket(const DemuxPacket* packet);
+  bool ReleaseRingPacket(unsigned int generation, const DemuxPacket* packet);
+  void UpdateRingTimeFront(const DemuxPacket* packet);
+  void UpdateRingTimeBack();
+  void UpdateLockedPending();
+  int DataSize() const;
   void UpdateTimeFront();
   void UpdateTimeBack();
 
@@ -106,18 +142,28 @@ private:
   mutable CCriticalSection m_section;
 
   std::atomic<bool> m_bAbortRequest = false;
-  bool m_bInitialized;
+  std::atomic<bool> m_bInitialized;
   bool m_drain = false;
 
   int m_iDataSize;
-  double m_TimeFront;
-  double m_TimeBack;
+  std::atomic<double> m_TimeFront;
+  std::atomic<double> m_TimeBack;
   double m_TimeSize;
 
   int m_iMaxDataSize;
   std::string m_owner;
 
-  std::list<DVDMessageListItem> m_messages;
+  std::list<DVDMessageListItem> m_messages; // overflow lane in ring mode
   std::list<DVDMessageListItem> m_prioMessages;
+
+  // ring mode, see SetRingMode()
+  std::unique_ptr<XbmcThreads::CSPSCQueue<RingItem>> m_ring;
+  CCriticalSection m_producerSection; // serializes producers, always locked before m_section
+  std::list<DVDMessageListItem> m_returnedMessages; // PutBack() of priority 0 messages
+  std::atomic<uint64_t> m_ringState{0}; // generation:16 | packet count:16 | data size:32
+  std::atomic<unsigned int> m_flushAllGeneration{0};
+  std::atomic<bool> m_overflow{false};
+  std::atomic<bool> m_lockedPending{false};
+  std::atomic<bool> m_waiting{false};
 };
 
@@ -81,7 +81,7 @@ void CDVDStreamInfo::Clear()
   bitdepth = 0;
 }
 
-bool CDVDStreamInfo::Equal(const CDVDStreamInfo& right, int compare)
+bool CDVDStreamInfo::Equal(const CDVDStreamInfo& right, int compare) const
 {
   if (codec != right.codec || type != right.type ||
       ((compare & COMPARE_ID) && uniqueId != right.uniqueId) ||
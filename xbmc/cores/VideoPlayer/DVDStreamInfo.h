@@ -32,7 +32,7 @@ public:
   ~CDVDStreamInfo();
 
   void Clear(); // clears current information
-  bool Equal(const CDVDStreamInfo& right, int compare);
+  bool Equal(const CDVDStreamInfo& right, int compare) const;
   bool Equal(const CDemuxStream &right, bool withextradata);
 
   void Assign(const CDVDStreamInfo &right, bool withextradata);
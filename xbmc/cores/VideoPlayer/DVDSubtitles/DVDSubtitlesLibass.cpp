@@ -37,6 +37,9 @@ constexpr int ASS_BORDER_STYLE_OUTLINE = 1; // Outline + drop shadow
 constexpr int ASS_BORDER_STYLE_BOX = 3; // Box + drop shadow
 constexpr int ASS_BORDER_STYLE_SQUARE_BOX = 4; // Square box + outline
 
+// Number of frames the look-ahead worker renders ahead of the requested one
+constexpr size_t LOOKAHEAD_FRAMES = 8;
+
 // Convert RGB/ARGB to RGBA by also applying the opacity value
 COLOR::Color ConvColor(COLOR::Color argbColor, int opacity = 100)
 {
@@ -53,7 +56,7 @@ static void libass_log(int level, const char* fmt, va_list args, void* data)
   CLog::Log(LOGDEBUG, "CDVDSubtitlesLibass: [ass] {}", log);
 }
 
-CDVDSubtitlesLibass::CDVDSubtitlesLibass()
+CDVDSubtitlesLibass::CDVDSubtitlesLibass() : CThread("SubtitleLookAhead")
 {
   CLog::Log(LOGINFO, "CDVDSubtitlesLibass: Using libass version {0:x}", ass_library_version());
   CLog::Log(LOGINFO, "CDVDSubtitlesLibass: Creating ASS library structure");
@@ -73,6 +76,13 @@ CDVDSubtitlesLibass::CDVDSubtitlesLibass()
 
 CDVDSubtitlesLibass::~CDVDSubtitlesLibass()
 {
+  if (m_lookAhead)
+  {
+    StopThread(false);
+    m_lookAheadEvent.Set();
+    StopThread(true);
+  }
+
   if (m_track)
     ass_free_track(m_track);
   ass_renderer_done(m_renderer);
@@ -238,6 +248,7 @@ bool CDVDSubtitlesLibass::DecodeHeader(char* data, int size)
   m_track = ass_new_track(m_library);
 
   ass_process_codec_private(m_track, data, size);
+  InvalidateLookAhead();
   return true;
 }
 
@@ -251,6 +262,7 @@ bool CDVDSubtitlesLibass::DecodeDemuxPkt(const char* data, int size, double star
   }
 
   //! @bug libass isn't const correct
+  InvalidateLookAhead();
   ass_process_chunk(m_track, const_cast<char*>(data), size, DVD_TIME_TO_MSEC(start),
                     DVD_TIME_TO_MSEC(duration));
   return true;
@@ -267,6 +279,7 @@ bool CDVDSubtitlesLibass::CreateTrack()
 
   CLog::Log(LOGINFO, "CDVDSubtitlesLibass: Creating new ASS track");
   m_track = ass_new_track(m_library);
+  InvalidateLookAhead();
   if (m_track == NULL)
   {
     CLog::Log(LOGERROR, "{} - Failed to allocate ASS track.", __FUNCTION__);
@@ -303,6 +316,7 @@ bool CDVDSubtitlesLibass::CreateStyle()
   }
 
   m_defaultKodiStyleId = ass_alloc_style(m_track);
+  InvalidateLookAhead();
   return true;
 }
 
@@ -318,29 +332,231 @@ bool CDVDSubtitlesLibass::CreateTrack(char* buf, size_t size)
   CLog::Log(LOGINFO, "CDVDSubtitlesLibass: Creating m_track from SSA buffer");
 
   m_track = ass_read_memory(m_library, buf, size, 0);
+  InvalidateLookAhead();
   if (m_track == NULL)
     return false;
 
   return true;
 }
 
+void CDVDSubtitlesLibass::EnableLookAhead()
+{
+  if (m_lookAhead.exchange(true))
+    return;
+
+  CLog::Log(LOGDEBUG, "CDVDSubtitlesLibass: Rendering subtitles ahead of the playback");
+  Create();
+}
+
 ASS_Image* CDVDSubtitlesLibass::RenderImage(double pts,
                                             renderOpts opts,
                                             bool updateStyle,
                                             const std::shared_ptr<struct style>& subStyle,
                                             int* changes)
 {
+  if (m_lookAhead)
+    return RenderLookAheadImage(pts, opts, updateStyle, subStyle, changes);
+
   std::unique_lock lock(m_section);
+  if (!PrepareRender(opts, updateStyle, subStyle))
+    return nullptr;
+
+  // For posterity ass_render_frame have an inconsistent rendering for overlapped subtitles cases,
+  // if the playback occurs in sequence (without seeks) the overlapped subtitles lines will be rendered in right order
+  // if you seek forward/backward the video, the overlapped subtitles lines could be rendered in the wrong order
+  // this is a known side effect from libass devs and not a bug from our part
+  return ass_render_frame(m_renderer, m_track, DVD_TIME_TO_MSEC(pts), changes);
+}
+
+ASS_Image* CDVDSubtitlesLibass::RenderLookAheadImage(double pts,
+                                                     const renderOpts& opts,
+                                                     bool updateStyle,
+                                                     const std::shared_ptr<struct style>& subStyle,
+                                                     int* changes)
+{
+  ImageListPtr images;
+  bool found = false;
+  {
+    std::unique_lock lock(m_lookAheadSection);
+
+    // The worker renders one frame interval after the other, jumps (seeks) are not taken
+    if (m_hasRequestedPts && pts > m_requestedPts && pts - m_requestedPts < DVD_SEC_TO_TIME(1))
+      m_frameInterval = pts - m_requestedPts;
+    m_requestedPts = pts;
+    m_hasRequestedPts = true;
+
+    if (updateStyle || !(opts == m_lookAheadOpts) || subStyle != m_lookAheadStyle)
+    {
+      m_lookAheadOpts = opts;
+      m_lookAheadStyle = subStyle;
+      InvalidateLookAhead();
+    }
+
+    const unsigned int generation = m_lookAheadGeneration;
+    while (!m_lookAheadFrames.empty() &&
+           (m_lookAheadFrames.front().generation != generation ||
+            m_lookAheadFrames.front().pts < pts - m_frameInterval / 2))
+      m_lookAheadFrames.pop_front();
+
+    if (!m_lookAheadFrames.empty() &&
+        m_lookAheadFrames.front().pts <= pts + m_frameInterval / 2)
+    {
+      images = m_lookAheadFrames.front().images;
+      found = true;
+    }
+    else
+    {
+      // the frames don't follow the playback anymore, the worker starts over from this one
+      m_lookAheadFrames.clear();
+    }
+  }
+
+  if (!found)
+  {
+    std::unique_lock lock(m_section);
+    if (!PrepareRender(opts, updateStyle, subStyle))
+      return nullptr;
+
+    images = RenderCopy(pts);
+  }
+
+  m_lookAheadEvent.Set();
+
+  if (changes)
+    *changes = images != m_shownImages ? 2 : 0;
+
+  m_shownImages = std::move(images);
+  return m_shownImages ? m_shownImages->images.data() : nullptr;
+}
+
+CDVDSubtitlesLibass::ImageListPtr CDVDSubtitlesLibass::RenderCopy(double pts)
+{
+  int changes = 0;
+  ASS_Image* image = ass_render_frame(m_renderer, m_track, DVD_TIME_TO_MSEC(pts), &changes);
+  if (!image)
+  {
+    m_lastCopied.reset();
+    m_copiedBitmaps.clear();
+    return nullptr;
+  }
+
+  if (changes == 0 && m_lastCopied)
+    return m_lastCopied;
+
+  auto list = std::make_shared<ImageList>();
+  std::map<const unsigned char*, std::shared_ptr<const CopiedBitmap>> bitmaps;
+  for (; image; image = image->next)
+  {
+    std::shared_ptr<const CopiedBitmap>& bitmap = bitmaps[image->bitmap];
+    if (!bitmap)
+    {
+      // libass keeps the bitmaps of unchanged glyphs, which overlay renderers can reuse
+      const auto it = m_copiedBitmaps.find(image->bitmap);
+      bool same = it != m_copiedBitmaps.end() && it->second->width == image->w &&
+                  it->second->height == image->h;
+      for (int y = 0; same && y < image->h; ++y)
+        same = std::memcmp(it->second->data.data() + y * image->w,
+                           image->bitmap + y * image->stride, image->w) == 0;
+
+      if (same)
+        bitmap = it->second;
+      else
+      {
+        auto copy = std::make_shared<CopiedBitmap>();
+        copy->width = image->w;
+        copy->height = image->h;
+        copy->data.resize(static_cast<size_t>(image->w) * image->h);
+        for (int y = 0; y < image->h; ++y)
+          std::memcpy(copy->data.data() + y * image->w, image->bitmap + y * image->stride,
+                      image->w);
+        bitmap = std::move(copy);
+      }
+    }
+
+    ASS_Image copy = *image;
+    copy.bitmap = const_cast<unsigned char*>(bitmap->data.data());
+    copy.stride = image->w;
+    copy.next = nullptr;
+    list->images.emplace_back(copy);
+    list->bitmaps.emplace_back(bitmap);
+  }
+
+  for (size_t i = 1; i < list->images.size(); ++i)
+    list->images[i - 1].next = &list->images[i];
+
+  m_copiedBitmaps = std::move(bitmaps);
+  m_lastCopied = list;
+  return list;
+}
+
+void CDVDSubtitlesLibass::Process()
+{
+  while (!m_bStop)
+  {
+    double pts = 0.0;
+    unsigned int generation = 0;
+    renderOpts opts;
+    std::shared_ptr<struct style> subStyle;
+    bool idle = true;
+    {
+      std::unique_lock lock(m_lookAheadSection);
+      generation = m_lookAheadGeneration;
+      while (!m_lookAheadFrames.empty() && m_lookAheadFrames.front().generation != generation)
+        m_lookAheadFrames.pop_front();
+
+      if (m_hasRequestedPts && m_frameInterval > 0 && m_lookAheadStyle &&
+          m_lookAheadFrames.size() < LOOKAHEAD_FRAMES)
+      {
+        const bool continues =
+            !m_lookAheadFrames.empty() && m_lookAheadFrames.back().pts > m_requestedPts;
+        pts = (continues ? m_lookAheadFrames.back().pts : m_requestedPts) + m_frameInterval;
+        opts = m_lookAheadOpts;
+        subStyle = m_lookAheadStyle;
+        idle = false;
+      }
+    }
+
+    if (idle)
+    {
+      m_lookAheadEvent.Wait();
+      continue;
+    }
+
+    ImageListPtr images;
+    {
+      std::unique_lock lock(m_section);
+      // the style was applied when the options were taken, on the thread asking for frames
+      if (!m_renderer || !m_track || m_currentDefaultStyleId == ASS_NO_ID ||
+          !PrepareRender(opts, false, subStyle))
+      {
+        lock.unlock();
+        m_lookAheadEvent.Wait();
+        continue;
+      }
+
+      images = RenderCopy(pts);
+    }
+
+    std::unique_lock lock(m_lookAheadSection);
+    if (generation == m_lookAheadGeneration)
+      m_lookAheadFrames.push_back({pts, generation, std::move(images)});
+  }
+}
+
+bool CDVDSubtitlesLibass::PrepareRender(const renderOpts& opts,
+                                        bool updateStyle,
+                                        const std::shared_ptr<struct style>& subStyle)
+{
   if (!m_renderer || !m_track)
   {
     CLog::Log(LOGERROR, "{} - ASS renderer/ASS track not initialized.", __FUNCTION__);
-    return nullptr;
+    return false;
   }
 
   if (!subStyle)
   {
     CLog::Log(LOGERROR, "{} - The subtitle overlay style is not set.", __FUNCTION__);
-    return nullptr;
+    return false;
   }
 
   if (updateStyle || m_currentDefaultStyleId == ASS_NO_ID)
@@ -399,12 +615,7 @@ ASS_Image* CDVDSubtitlesLibass::RenderImage(double pts,
   ass_set_font_scale(m_renderer, static_cast<double>(fontScale));
 
   ass_set_line_position(m_renderer, opts.position);
-
-  // For posterity ass_render_frame have an inconsistent rendering for overlapped subtitles cases,
-  // if the playback occurs in sequence (without seeks) the overlapped subtitles lines will be rendered in right order
-  // if you seek forward/backward the video, the overlapped subtitles lines could be rendered in the wrong order
-  // this is a known side effect from libass devs and not a bug from our part
-  return ass_render_frame(m_renderer, m_track, DVD_TIME_TO_MSEC(pts), changes);
+  return true;
 }
 
 void CDVDSubtitlesLibass::ApplyStyle(const std::shared_ptr<struct style>& subStyle,
@@ -719,6 +930,7 @@ int CDVDSubtitlesLibass::AddEvent(const char* text,
     return ASS_NO_ID;
   }
 
+  InvalidateLookAhead();
   int eventId = ass_alloc_event(m_track);
   if (eventId >= 0)
   {
@@ -768,6 +980,7 @@ void CDVDSubtitlesLibass::AppendTextToEvent(int eventId, const char* text)
     strcpy(appendedText, assEvent->Text);
     strcat(appendedText, text);
     free(assEvent->Text);
+    InvalidateLookAhead();
     assEvent->Text = strdup(appendedText);
     delete[] appendedText;
   }
@@ -794,7 +1007,10 @@ void CDVDSubtitlesLibass::ChangeEventStopTime(int eventId, double stopTime)
 
   ASS_Event* assEvent = (assEvents + eventId);
   if (assEvent)
+  {
     assEvent->Duration = (DVD_TIME_TO_MSEC(stopTime) - assEvent->Start);
+    InvalidateLookAhead();
+  }
 }
 
 void CDVDSubtitlesLibass::FlushEvents()
@@ -807,6 +1023,7 @@ void CDVDSubtitlesLibass::FlushEvents()
   }
 
   ass_flush_events(m_track);
+  InvalidateLookAhead();
 }
 
 int CDVDSubtitlesLibass::DeleteEvents(int nEvents, int threshold)
@@ -823,6 +1040,8 @@ int CDVDSubtitlesLibass::DeleteEvents(int nEvents, int threshold)
   if (m_track->n_events < (threshold - nEvents))
     return m_track->n_events - 1;
 
+  InvalidateLookAhead();
+
   // Currently LibAss do not have delete event method we have to free the events
   // and reassign all events starting with the first empty position
   int n = 0;
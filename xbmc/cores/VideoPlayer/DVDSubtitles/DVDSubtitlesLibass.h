@@ -10,9 +10,15 @@
 
 #include "SubtitlesStyle.h"
 #include "threads/CriticalSection.h"
+#include "threads/Event.h"
+#include "threads/Thread.h"
 #include "utils/ColorUtils.h"
 
+#include <atomic>
+#include <deque>
+#include <map>
 #include <memory>
+#include <vector>
 
 #include <ass/ass.h>
 #include <ass/ass_types.h>
@@ -27,7 +33,7 @@ enum ASSSubType
   ADAPTED
 };
 
-class CDVDSubtitlesLibass
+class CDVDSubtitlesLibass : private CThread
 {
 public:
   CDVDSubtitlesLibass();
@@ -39,6 +45,14 @@ public:
   */
   void Configure();
 
+  /*!
+  * \brief Render the upcoming frames on a worker thread, ahead of the playback clock.
+  * Meant for subtitles whose events are all known in advance, like subtitle files.
+  * The images returned by RenderImage are then copies that stay valid until its next call,
+  * a frame that wasn't rendered ahead in time is rendered on the calling thread.
+  */
+  void EnableLookAhead();
+
   ASS_Image* RenderImage(double pts,
                          KODI::SUBTITLES::STYLE::renderOpts opts,
                          bool updateStyle,
@@ -149,6 +163,57 @@ protected:
 
 
 private:
+  struct CopiedBitmap
+  {
+    int width;
+    int height;
+    std::vector<unsigned char> data;
+  };
+
+  struct ImageList
+  {
+    std::vector<ASS_Image> images;
+    std::vector<std::shared_ptr<const CopiedBitmap>> bitmaps;
+  };
+
+  using ImageListPtr = std::shared_ptr<ImageList>;
+
+  struct LookAheadFrame
+  {
+    double pts;
+    unsigned int generation;
+    ImageListPtr images; // nullptr if nothing is shown
+  };
+
+  // implementation of CThread
+  void Process() override;
+
+  /*!
+  * \brief Check the state and set up the renderer for the given options, needs m_section
+  * \return True if a frame can be rendered, otherwise false
+  */
+  bool PrepareRender(const KODI::SUBTITLES::STYLE::renderOpts& opts,
+                     bool updateStyle,
+                     const std::shared_ptr<struct KODI::SUBTITLES::STYLE::style>& subStyle);
+
+  /*!
+  * \brief Render a frame and copy its images, needs m_section.
+  * Bitmaps that libass didn't change since the previous copy are shared with it.
+  */
+  ImageListPtr RenderCopy(double pts);
+
+  ASS_Image* RenderLookAheadImage(
+      double pts,
+      const KODI::SUBTITLES::STYLE::renderOpts& opts,
+      bool updateStyle,
+      const std::shared_ptr<struct KODI::SUBTITLES::STYLE::style>& subStyle,
+      int* changes);
+
+  /*!
+  * \brief Throw away the frames rendered ahead, called when the track changes
+  */
+  void InvalidateLookAhead() { m_lookAheadGeneration++; }
+
   void ConfigureAssOverride(const std::shared_ptr<struct KODI::SUBTITLES::STYLE::style>& subStyle,
                             ASS_Style* style);
   void ApplyStyle(const std::shared_ptr<struct KODI::SUBTITLES::STYLE::style>& subStyle,
@@ -166,4 +231,24 @@ private:
   // default allocated style ID for the kodi user configured subtitle style
   int m_defaultKodiStyleId{ASS_NO_ID};
   std::string m_defaultFontFamilyName;
+
+  std::atomic<bool> m_lookAhead{false};
+  std::atomic<unsigned int> m_lookAheadGeneration{0};
+
+  // Copies of the last rendered frame, protected by m_section
+  ImageListPtr m_lastCopied;
+  std::map<const unsigned char*, std::shared_ptr<const CopiedBitmap>> m_copiedBitmaps;
+
+  // Shared with the look-ahead worker
+  CCriticalSection m_lookAheadSection;
+  std::deque<LookAheadFrame> m_lookAheadFrames;
+  KODI::SUBTITLES::STYLE::renderOpts m_lookAheadOpts{};
+  std::shared_ptr<struct KODI::SUBTITLES::STYLE::style> m_lookAheadStyle;
+  double m_requestedPts{0.0};
+  bool m_hasRequestedPts{false};
+  double m_frameInterval{0.0};
+  CEvent m_lookAheadEvent;
+
+  // Accessed by the caller of RenderImage only
+  ImageListPtr m_shownImages;
 };
@@ -0,0 +1,196 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DVDThumbExtractionPool.h"
+
+#include "ServiceBroker.h"
+#include "URL.h"
+#include "application/ApplicationComponents.h"
+#include "application/ApplicationPlayer.h"
+#include "threads/Thread.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// a worker without work ends after this
+constexpr auto IDLE_TIMEOUT = 10s;
+// how often workers with queued but blocked tasks look at the throttle again
+constexpr auto RECHECK_INTERVAL = 1s;
+
+thread_local bool isWorkerThread = false;
+} // unnamed namespace
+
+class CDVDThumbExtractionPool::CWorker : private CThread
+{
+public:
+  explicit CWorker(CDVDThumbExtractionPool& pool) : CThread("ThumbExtractor"), m_pool(pool)
+  {
+    Create(true); // start work immediately, and kill ourselves when we're done
+  }
+
+  void Process() override
+  {
+    SetPriority(ThreadPriority::LOWEST);
+    isWorkerThread = true;
+
+    Task task;
+    while (m_pool.GetNextTask(task))
+    {
+      try
+      {
+        task.work();
+      }
+      catch (const std::exception& e)
+      {
+        CLog::LogF(LOGERROR, "extraction failed: {}", e.what());
+      }
+      catch (...)
+      {
+        CLog::LogF(LOGERROR, "extraction failed");
+      }
+      task.work = nullptr;
+      m_pool.OnTaskDone(task.source);
+    }
+
+    // the pool may be gone once this returns
+    m_pool.OnWorkerEnd();
+  }
+
+private:
+  CDVDThumbExtractionPool& m_pool;
+};
+
+CDVDThumbExtractionPool::CDVDThumbExtractionPool(unsigned int maxWorkers,
+                                                 unsigned int maxPerHost,
+                                                 ThrottleFunc throttle)
+  : m_maxWorkers(std::max(maxWorkers, 1u)),
+    m_maxPerHost(std::max(maxPerHost, 1u)),
+    m_throttle(std::move(throttle))
+{
+}
+
+CDVDThumbExtractionPool::~CDVDThumbExtractionPool()
+{
+  std::unique_lock lock(m_section);
+  m_stop = true;
+  m_queue.clear();
+  m_taskAvailable.notifyAll();
+  m_workerEnded.wait(lock, [this] { return m_threads == 0; });
+}
+
+CDVDThumbExtractionPool& CDVDThumbExtractionPool::GetInstance()
+{
+  // decoding is mostly single threaded here, leave half of the cores to the rest
+  static CDVDThumbExtractionPool pool(
+      std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u), 2,
+      []
+      {
+        const auto& components = CServiceBroker::GetAppComponents();
+        const auto appPlayer = components.GetComponent<CApplicationPlayer>();
+        return appPlayer && appPlayer->IsPlayingVideo();
+      });
+  return pool;
+}
+
+std::string CDVDThumbExtractionPool::GetSource(const std::string& path)
+{
+  if (!URIUtils::IsRemote(path))
+    return {};
+  return CURL(path).GetHostName();
+}
+
+bool CDVDThumbExtractionPool::IsWorkerThread()
+{
+  return isWorkerThread;
+}
+
+void CDVDThumbExtractionPool::Queue(const std::string& source, std::function<void()> work)
+{
+  std::unique_lock lock(m_section);
+  if (m_stop)
+    return; // dropping the task breaks its future
+
+  m_queue.push_back({source, std::move(work)});
+  if (m_idleWorkers > 0)
+  {
+    m_taskAvailable.notifyAll();
+  }
+  else if (m_workers < m_maxWorkers)
+  {
+    ++m_workers;
+    ++m_threads;
+    new CWorker(*this);
+  }
+}
+
+bool CDVDThumbExtractionPool::GetNextTask(Task& task)
+{
+  std::unique_lock lock(m_section);
+  while (!m_stop)
+  {
+    const bool throttled = m_throttle && m_throttle();
+    const auto it = std::ranges::find_if(m_queue, [this, throttled](const Task& queued)
+                                         { return CanStart(queued, throttled); });
+    if (it != m_queue.end())
+    {
+      task = std::move(*it);
+      m_queue.erase(it);
+      ++m_running;
+      ++m_runningPerSource[task.source];
+      return true;
+    }
+
+    ++m_idleWorkers;
+    const bool notified =
+        m_taskAvailable.wait(lock, m_queue.empty() ? IDLE_TIMEOUT : RECHECK_INTERVAL);
+    --m_idleWorkers;
+    if (!notified && m_queue.empty())
+      break;
+  }
+
+  // no longer counted as taking tasks, so tasks queued from now on start a new worker
+  --m_workers;
+  return false;
+}
+
+void CDVDThumbExtractionPool::OnTaskDone(const std::string& source)
+{
+  std::unique_lock lock(m_section);
+  --m_running;
+  const auto it = m_runningPerSource.find(source);
+  if (it != m_runningPerSource.end() && --it->second == 0)
+    m_runningPerSource.erase(it);
+  m_taskAvailable.notifyAll();
+}
+
+void CDVDThumbExtractionPool::OnWorkerEnd()
+{
+  std::unique_lock lock(m_section);
+  --m_threads;
+  m_workerEnded.notifyAll();
+}
+
+bool CDVDThumbExtractionPool::CanStart(const Task& task, bool throttled) const
+{
+  if (m_running >= (throttled ? 1 : m_maxWorkers))
+    return false;
+  if (task.source.empty())
+    return true;
+
+  const auto it = m_runningPerSource.find(task.source);
+  return it == m_runningPerSource.end() || it->second < m_maxPerHost;
+}
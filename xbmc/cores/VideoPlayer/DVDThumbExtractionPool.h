@@ -0,0 +1,115 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
+
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+/*!
+ * \brief Threads extracting thumbnails and chapter images of video files
+ *
+ * Extractions run side by side, at most a few at a time from the same network host so a NAS
+ * isn't flooded with seeks. Local files are only limited by the number of workers. While a
+ * video is playing a single extraction runs at a time. Workers are started when needed and
+ * end after a while without work.
+ */
+class CDVDThumbExtractionPool
+{
+public:
+  using ThrottleFunc = std::function<bool()>;
+
+  /*!
+   * \param maxWorkers extractions running at the same time
+   * \param maxPerHost extractions running at the same time from one network host
+   * \param throttle while it returns true only one extraction runs, nullptr for never
+   */
+  CDVDThumbExtractionPool(unsigned int maxWorkers,
+                          unsigned int maxPerHost,
+                          ThrottleFunc throttle = nullptr);
+
+  /*!
+   * \brief Drops the queued extractions, waits for the running ones
+   */
+  ~CDVDThumbExtractionPool();
+
+  static CDVDThumbExtractionPool& GetInstance();
+
+  /*!
+   * \brief The source extractions of a file count against, the host of remote files
+   * \return the host name, empty for local files
+   */
+  static std::string GetSource(const std::string& path);
+
+  /*!
+   * \brief Whether the calling thread is a worker of a pool
+   */
+  static bool IsWorkerThread();
+
+  unsigned int GetMaxWorkers() const { return m_maxWorkers; }
+
+  /*!
+   * \brief Run an extraction on a worker
+   * \param source as returned by GetSource()
+   * \return the future of its result, left broken if the pool is destroyed before it ran
+   */
+  template<typename F>
+  std::future<std::invoke_result_t<F>> Submit(const std::string& source, F&& extraction)
+  {
+    using Result = std::invoke_result_t<F>;
+    auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(extraction));
+    std::future<Result> future = task->get_future();
+    Queue(source, [task] { (*task)(); });
+    return future;
+  }
+
+private:
+  class CWorker;
+
+  struct Task
+  {
+    std::string source;
+    std::function<void()> work;
+  };
+
+  void Queue(const std::string& source, std::function<void()> work);
+
+  /*!
+   * \brief Wait for a task that may start
+   * \return false if the worker should end
+   */
+  bool GetNextTask(Task& task);
+  void OnTaskDone(const std::string& source);
+  void OnWorkerEnd();
+
+  bool CanStart(const Task& task, bool throttled) const;
+
+  const unsigned int m_maxWorkers;
+  const unsigned int m_maxPerHost;
+  const ThrottleFunc m_throttle;
+
+  CCriticalSection m_section;
+  XbmcThreads::ConditionVariable m_taskAvailable;
+  XbmcThreads::ConditionVariable m_workerEnded;
+  std::deque<Task> m_queue;
+  std::map<std::string, unsigned int, std::less<>> m_runningPerSource;
+  unsigned int m_running = 0;
+  unsigned int m_workers = 0; // taking tasks
+  unsigned int m_threads = 0; // not yet ended, some may be past their last task
+  unsigned int m_idleWorkers = 0;
+  bool m_stop = false;
+};
@@ -19,6 +19,8 @@ extern "C"
 {
 #endif /* __cplusplus */
 
+  struct AVBufferRef;
+
   struct DemuxPacket : DEMUX_PACKET
   {
     DemuxPacket()
@@ -43,6 +45,12 @@ extern "C"
 
     //! @brief PTS offset correction applied to the PTS and DTS.
     double m_ptsOffsetCorrection{0};
+
+    //! @brief Size class of the packet pool owning pData, -1 if pData is not pooled.
+    int m_poolSizeClass{-1};
+
+    //! @brief Reference on the ffmpeg buffer backing pData, nullptr if pData is owned.
+    AVBufferRef* m_avBuffer{nullptr};
   };
 
 #ifdef __cplusplus
@@ -77,6 +77,7 @@ void CProcessInfo::ResetVideoCodecInfo()
   m_videoLiveBitRate = 0;
   m_videoQueueLevel = 0;
   m_videoQueueDataLevel = 0;
+  m_videoDecodeTime = 0.0f;
   m_videoIsInterlaced = false;
   m_deintMethods.clear();
   m_deintMethods.push_back(EINTERLACEMETHOD::VS_INTERLACEMETHOD_NONE);
@@ -96,6 +97,7 @@ void CProcessInfo::ResetVideoCodecInfo()
     m_dataCache->SetVideoLiveBitRate(m_videoLiveBitRate);
     m_dataCache->SetVideoQueueLevel(m_videoQueueLevel);
     m_dataCache->SetVideoQueueDataLevel(m_videoQueueDataLevel);
+    m_dataCache->SetVideoDecodeTime(m_videoDecodeTime);
   }
 }
 
@@ -245,6 +247,23 @@ int CProcessInfo::GetVideoQueueDataLevel()
   return m_videoQueueDataLevel;
 }
 
+void CProcessInfo::SetVideoDecodeTime(float ms)
+{
+  std::unique_lock lock(m_videoCodecSection);
+
+  m_videoDecodeTime = ms;
+
+  if (m_dataCache)
+    m_dataCache->SetVideoDecodeTime(m_videoDecodeTime);
+}
+
+float CProcessInfo::GetVideoDecodeTime()
+{
+  std::unique_lock lock(m_videoCodecSection);
+
+  return m_videoDecodeTime;
+}
+
 void CProcessInfo::SetVideoFps(float fps)
 {
   std::unique_lock lock(m_videoCodecSection);
@@ -54,6 +54,12 @@ public:
   int GetVideoQueueLevel();
   void SetVideoQueueDataLevel(int level);
   int GetVideoQueueDataLevel();
+  /*!
+   * @brief Average time the decoder needs for one frame
+   * @param ms the decode time in milliseconds, 0 if unknown
+   */
+  void SetVideoDecodeTime(float ms);
+  float GetVideoDecodeTime();
   void SetVideoInterlaced(bool interlaced);
   bool GetVideoInterlaced();
   virtual EINTERLACEMETHOD GetFallbackDeintMethod();
@@ -156,6 +162,7 @@ protected:
   int m_videoLiveBitRate = 0;
   int m_videoQueueLevel = 0;
   int m_videoQueueDataLevel = 0;
+  float m_videoDecodeTime = 0.0f;
   bool m_videoIsInterlaced;
   std::list<EINTERLACEMETHOD> m_deintMethods;
   EINTERLACEMETHOD m_deintMethodDefault;
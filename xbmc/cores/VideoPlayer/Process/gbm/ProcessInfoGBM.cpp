@@ -34,6 +34,13 @@ CProcessInfoGBM::CProcessInfoGBM()
     m_videoBufferManager.RegisterPool(std::make_shared<CVideoBufferPoolDMA>());
 }
 
+CProcessInfoGBM::~CProcessInfoGBM()
+{
+  // the buffers are only kept for the decoders of this player, the pools hand them in on release
+  m_videoBufferManager.ReleasePools();
+  CVideoBufferDMACache::GetInstance().Clear();
+}
+
 EINTERLACEMETHOD CProcessInfoGBM::GetFallbackDeintMethod()
 {
 #if defined(__arm__)
@@ -21,6 +21,7 @@ public:
   static void Register();
 
   CProcessInfoGBM();
+  ~CProcessInfoGBM() override;
   EINTERLACEMETHOD GetFallbackDeintMethod() override;
   std::vector<AVPixelFormat> GetRenderFormats() override;
 };
@@ -29,6 +29,13 @@ CProcessInfoWayland::CProcessInfoWayland()
   m_videoBufferManager.RegisterPool(std::make_shared<CVideoBufferPoolDMA>());
 }
 
+CProcessInfoWayland::~CProcessInfoWayland()
+{
+  // the buffers are only kept for the decoders of this player, the pools hand them in on release
+  m_videoBufferManager.ReleasePools();
+  CVideoBufferDMACache::GetInstance().Clear();
+}
+
 void CProcessInfoWayland::SetSwDeinterlacingMethods()
 {
   // first populate with the defaults from base implementation
@@ -20,6 +20,7 @@ public:
   static void Register();
 
   CProcessInfoWayland();
+  ~CProcessInfoWayland() override;
   void SetSwDeinterlacingMethods() override;
   std::vector<AVPixelFormat> GetRenderFormats() override;
 };
@@ -0,0 +1,271 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoDecodeBenchmark.h"
+
+#include "DVDCodecs/DVDFactoryCodec.h"
+#include "DVDCodecs/Video/DVDVideoCodec.h"
+#include "DVDDemuxers/DVDDemux.h"
+#include "DVDDemuxers/DVDDemuxUtils.h"
+#include "DVDDemuxers/DVDFactoryDemuxer.h"
+#include "DVDInputStreams/DVDFactoryInputStream.h"
+#include "DVDInputStreams/DVDInputStream.h"
+#include "DVDStreamInfo.h"
+#include "FileItem.h"
+#include "Process/ProcessInfo.h"
+#include "URL.h"
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+#ifdef TARGET_POSIX
+#include <sys/resource.h>
+#endif
+
+extern "C"
+{
+#include <libavformat/avformat.h>
+}
+
+namespace
+{
+struct Usage
+{
+  double cpuSeconds = -1.0;
+  uint64_t peakMemory = 0;
+};
+
+Usage GetUsage()
+{
+  Usage usage;
+#ifdef TARGET_POSIX
+  rusage self;
+  if (getrusage(RUSAGE_SELF, &self) == 0)
+  {
+    usage.cpuSeconds = static_cast<double>(self.ru_utime.tv_sec + self.ru_stime.tv_sec) +
+                       static_cast<double>(self.ru_utime.tv_usec + self.ru_stime.tv_usec) / 1e6;
+#ifdef TARGET_DARWIN
+    usage.peakMemory = static_cast<uint64_t>(self.ru_maxrss);
+#else
+    usage.peakMemory = static_cast<uint64_t>(self.ru_maxrss) * 1024;
+#endif
+  }
+#endif
+  return usage;
+}
+
+/*!
+ * \brief The id the decoder was registered with in CDVDFactoryCodec
+ */
+std::string GetDecoderId(std::string decoder)
+{
+  StringUtils::ToLower(decoder);
+  if (decoder == "auto")
+    return {};
+  if (decoder == "drmprime")
+    return "drm_prime";
+  if (decoder == "mediacodec")
+    return "mediacodec_dec";
+  return decoder;
+}
+
+class CDecoderSelection
+{
+public:
+  explicit CDecoderSelection(const std::string& id) { CDVDFactoryCodec::SetVideoDecoder(id); }
+  ~CDecoderSelection() { CDVDFactoryCodec::SetVideoDecoder(""); }
+};
+} // unnamed namespace
+
+bool CVideoDecodeBenchmark::Run(const CFileItem& fileItem,
+                                const std::string& decoder,
+                                Result& result)
+{
+  const std::string redactPath = CURL::GetRedacted(fileItem.GetPath());
+
+  CFileItem item(fileItem);
+  item.SetMimeTypeForInternetFile();
+  auto inputStream = CDVDFactoryInputStream::CreateInputStream(nullptr, item);
+  if (!inputStream || !inputStream->Open())
+  {
+    CLog::LogF(LOGERROR, "unable to open {}", redactPath);
+    return false;
+  }
+
+  std::unique_ptr<CDVDDemux> demuxer{CDVDFactoryDemuxer::CreateDemuxer(inputStream, true)};
+  if (!demuxer)
+  {
+    CLog::LogF(LOGERROR, "unable to create a demuxer for {}", redactPath);
+    return false;
+  }
+
+  CDemuxStream* videoStream = nullptr;
+  for (CDemuxStream* stream : demuxer->GetStreams())
+  {
+    if (!stream)
+      continue;
+
+    // the first video stream that's no cover art, like the player does
+    if (!videoStream && stream->type == StreamType::VIDEO &&
+        !(stream->flags & AV_DISPOSITION_ATTACHED_PIC))
+      videoStream = stream;
+    else
+      demuxer->EnableStream(stream->demuxerId, stream->uniqueId, false);
+  }
+  if (!videoStream)
+  {
+    CLog::LogF(LOGERROR, "no video stream in {}", redactPath);
+    return false;
+  }
+  const int streamId = videoStream->uniqueId;
+
+  const std::string decoderId = GetDecoderId(decoder);
+  const bool software = decoderId == "software" || decoderId == "ffmpeg";
+  const CDecoderSelection selection(software ? "" : decoderId);
+
+  std::unique_ptr<CProcessInfo> processInfo(CProcessInfo::CreateInstance());
+  CDVDStreamInfo hint(*videoStream, true);
+  // ffmpeg is still used with its hardware accelerations when no platform decoder is asked for
+  hint.codecOptions = software ? CODEC_FORCE_SOFTWARE : CODEC_ALLOW_FALLBACK;
+
+  std::unique_ptr<CDVDVideoCodec> codec = CDVDFactoryCodec::CreateVideoCodec(hint, *processInfo);
+  if (!codec)
+  {
+    CLog::LogF(LOGERROR, "unable to open the decoder {} for {}", decoder, redactPath);
+    return false;
+  }
+
+  result = {};
+  result.streamSeconds = demuxer->GetStreamLength() / 1000.0;
+
+  const Usage startUsage = GetUsage();
+  const auto start = std::chrono::steady_clock::now();
+
+  VideoPicture picture = {};
+  DemuxPacket* packet = nullptr;
+  bool draining = false;
+  bool failed = false;
+  while (true)
+  {
+    const CDVDVideoCodec::VCReturn state = codec->GetPicture(&picture);
+    if (state == CDVDVideoCodec::VC_PICTURE)
+    {
+      if (picture.iFlags & DVP_FLAG_DROPPED)
+        result.dropped++;
+      else
+        result.frames++;
+      result.width = picture.iWidth;
+      result.height = picture.iHeight;
+
+      // give the buffer back before asking for the next picture, hardware decoders have few
+      if (picture.videoBuffer)
+      {
+        picture.videoBuffer->Release();
+        picture.videoBuffer = nullptr;
+      }
+      continue;
+    }
+
+    if (state == CDVDVideoCodec::VC_FATAL)
+    {
+      CLog::LogF(LOGERROR, "the decoder failed in {}", redactPath);
+      failed = true;
+      break;
+    }
+    if (state == CDVDVideoCodec::VC_EOF || (draining && state == CDVDVideoCodec::VC_BUFFER))
+      break;
+    if (state == CDVDVideoCodec::VC_ERROR)
+      result.errors++;
+    else if (state == CDVDVideoCodec::VC_FLUSHED)
+      codec->Reset();
+    else if (state == CDVDVideoCodec::VC_REOPEN)
+      codec->Reopen();
+
+    if (draining)
+      continue;
+
+    while (!packet)
+    {
+      packet = demuxer->Read();
+      if (!packet)
+        break;
+      if (packet->iStreamId != streamId)
+      {
+        CDVDDemuxUtils::FreeDemuxPacket(packet);
+        packet = nullptr;
+      }
+    }
+
+    if (!packet)
+    {
+      codec->SetCodecControl(DVD_CODEC_CTRL_DRAIN);
+      draining = true;
+      continue;
+    }
+
+    // a full decoder refuses the packet until its pictures are taken
+    if (codec->AddData(*packet))
+    {
+      CDVDDemuxUtils::FreeDemuxPacket(packet);
+      packet = nullptr;
+    }
+  }
+
+  if (packet)
+    CDVDDemuxUtils::FreeDemuxPacket(packet);
+
+  const auto end = std::chrono::steady_clock::now();
+  const Usage endUsage = GetUsage();
+
+  result.seconds = std::chrono::duration<double>(end - start).count();
+  if (startUsage.cpuSeconds >= 0.0 && endUsage.cpuSeconds >= 0.0)
+    result.cpuSeconds = endUsage.cpuSeconds - startUsage.cpuSeconds;
+  result.peakMemory = endUsage.peakMemory;
+  result.decoder = processInfo->GetVideoDecoderName();
+  result.pixelFormat = processInfo->GetVideoPixelFormat();
+
+  return !failed;
+}
+
+bool CVideoDecodeBenchmark::RunAndReport(const CFileItem& item, const std::string& decoder)
+{
+  const std::string redactPath = CURL::GetRedacted(item.GetPath());
+
+  Result result;
+  const bool success = Run(item, decoder, result);
+  std::string report;
+  if (!success && result.frames == 0)
+  {
+    report = StringUtils::Format("benchmark: {}: failed", redactPath);
+  }
+  else
+  {
+    const double fps = result.seconds > 0.0 ? result.frames / result.seconds : 0.0;
+    const double speed = result.seconds > 0.0 ? result.streamSeconds / result.seconds : 0.0;
+    report = StringUtils::Format(
+        "benchmark: {}: {} {} {}x{}, {} frames in {:.2f}s, {:.1f} fps, {:.2f}x real time, "
+        "{} dropped, {} errors",
+        redactPath, result.decoder, result.pixelFormat, result.width, result.height,
+        result.frames, result.seconds, fps, speed, result.dropped, result.errors);
+    if (result.cpuSeconds >= 0.0)
+      report += StringUtils::Format(", cpu {:.2f}s ({:.0f}%)", result.cpuSeconds,
+                                    result.seconds > 0.0 ? result.cpuSeconds * 100 / result.seconds
+                                                         : 0.0);
+    if (result.peakMemory > 0)
+      report += StringUtils::Format(", peak memory {} MiB", result.peakMemory / (1024 * 1024));
+    if (!success)
+      report += ", aborted";
+  }
+
+  CLog::Log(LOGINFO, "{}", report);
+  std::cout << report << std::endl;
+  return success;
+}
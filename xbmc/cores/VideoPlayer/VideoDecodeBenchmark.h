@@ -0,0 +1,52 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+class CFileItem;
+
+/*!
+ * \brief Decodes the video of a file as fast as the decoder allows, to qualify the hardware.
+ *
+ * The packets are fed to the decoder without a clock and the pictures are released right away,
+ * nothing is rendered. The results are written to the log and to stdout.
+ */
+class CVideoDecodeBenchmark
+{
+public:
+  struct Result
+  {
+    std::string decoder; //!< name reported by the decoder
+    std::string pixelFormat;
+    unsigned int width = 0;
+    unsigned int height = 0;
+    uint64_t frames = 0; //!< decoded pictures, without the dropped ones
+    uint64_t dropped = 0;
+    uint64_t errors = 0;
+    double streamSeconds = 0.0; //!< duration of the file
+    double seconds = 0.0; //!< wall time of the decode
+    double cpuSeconds = -1.0; //!< user and system time of the process, < 0 if unknown
+    uint64_t peakMemory = 0; //!< peak resident size of the process in bytes, 0 if unknown
+  };
+
+  /*!
+   * \brief Decode the first video stream of a file
+   * \param decoder auto or empty for the decoder the player would use, software, or the id of a
+   * platform decoder or of a hardware acceleration of ffmpeg like vaapi, drmprime or mediacodec
+   * \return false if the file couldn't be opened or decoded
+   */
+  static bool Run(const CFileItem& item, const std::string& decoder, Result& result);
+
+  /*!
+   * \brief Run() and report the results
+   */
+  static bool RunAndReport(const CFileItem& item, const std::string& decoder);
+};
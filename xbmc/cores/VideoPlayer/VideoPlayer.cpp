@@ -38,6 +38,7 @@
 #include "cores/FFmpeg.h"
 #include "cores/VideoPlayer/Process/ProcessInfo.h"
 #include "cores/VideoPlayer/VideoRenderers/RenderManager.h"
+#include "filesystem/File.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/StereoscopicsManager.h"
 #include "input/actions/Action.h"
@@ -60,6 +61,7 @@
 #include "utils/Variant.h"
 #include "utils/log.h"
 #include "video/Bookmark.h"
+#include "video/VideoDatabase.h"
 #include "video/VideoInfoTag.h"
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
@@ -897,6 +899,9 @@ bool CVideoPlayer::OpenInputStream()
 
   CLog::Log(LOGINFO, "Creating InputStream");
 
+  // the input stream takes a copy of the item, so the cached probe result must be set before
+  LoadProbeInfo();
+
   m_pInputStream = CDVDFactoryInputStream::CreateInputStream(this, m_item, true);
   if (m_pInputStream == nullptr)
   {
@@ -953,6 +958,47 @@ bool CVideoPlayer::OpenInputStream()
   return true;
 }
 
+void CVideoPlayer::LoadProbeInfo()
+{
+  m_probeInfoKey.clear();
+  m_probeInfo.clear();
+  m_item.ClearProperty("probe_info");
+  if (!CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoFastStart ||
+      NETWORK::IsInternetStream(m_item) || m_item.IsDiscImage() || m_item.IsPVR())
+    return;
+
+  // the size and the modification time tell whether the file is still the one probed before
+  struct __stat64 st;
+  if (XFILE::CFile::Stat(m_item.GetDynPath(), &st) != 0 || st.st_size <= 0)
+    return;
+  m_probeInfoKey = StringUtils::Format("{}|{}", static_cast<int64_t>(st.st_size),
+                                       static_cast<int64_t>(st.st_mtime));
+
+  CVideoDatabase db;
+  if (db.Open() && db.GetProbeInfo(m_item.GetDynPath(), m_probeInfoKey, m_probeInfo))
+    m_item.SetProperty("probe_info", m_probeInfo);
+}
+
+void CVideoPlayer::SaveProbeInfo()
+{
+  if (m_probeInfoKey.empty() || !m_pInputStream->IsStreamType(DVDSTREAM_TYPE_FILE))
+    return;
+
+  // only the first demuxer of the file counts, the streams may change later on
+  const std::string key = std::exchange(m_probeInfoKey, {});
+  const std::string info = m_pDemuxer->GetProbeInfo();
+  if (info == m_probeInfo)
+    return;
+
+  m_outboundEvents->Submit(
+      [path = m_item.GetDynPath(), key, info]()
+      {
+        CVideoDatabase db;
+        if (db.Open())
+          db.SetProbeInfo(path, key, info);
+      });
+}
+
 bool CVideoPlayer::OpenDemuxStream()
 {
   CloseDemuxer();
@@ -996,6 +1042,8 @@ bool CVideoPlayer::OpenDemuxStream()
 
   m_offset_pts = 0;
 
+  SaveProbeInfo();
+
   if (m_updateStreamDetails)
   {
     CFileItem item;
@@ -1902,7 +1950,7 @@ void CVideoPlayer::ProcessAudioData(CDemuxStream* pStream, DemuxPacket* pPacket)
       drop = true;
   }
 
-  m_VideoPlayerAudio->SendMessage(std::make_shared<CDVDMsgDemuxerPacket>(pPacket, drop));
+  m_VideoPlayerAudio->SendMessage(CDVDMsgDemuxerPacket::Create(pPacket, drop));
 
   if (!drop)
     m_CurrentAudio.packets++;
@@ -1928,7 +1976,8 @@ void CVideoPlayer::ProcessVideoData(CDemuxStream* pStream, DemuxPacket* pPacket)
   if (CheckSceneSkip(m_CurrentVideo))
     drop = true;
 
-  m_VideoPlayerVideo->SendMessage(std::make_shared<CDVDMsgDemuxerPacket>(pPacket, drop));
+  CServiceBroker::GetDataCacheCore().GetFrameTimeline().Record(FrameStage::DEMUX, pPacket->pts);
+  m_VideoPlayerVideo->SendMessage(CDVDMsgDemuxerPacket::Create(pPacket, drop));
 
   if (!drop)
     m_CurrentVideo.packets++;
@@ -1947,7 +1996,7 @@ void CVideoPlayer::ProcessSubData(CDemuxStream* pStream, DemuxPacket* pPacket)
   if (CheckSceneSkip(m_CurrentSubtitle))
     drop = true;
 
-  m_VideoPlayerSubtitle->SendMessage(std::make_shared<CDVDMsgDemuxerPacket>(pPacket, drop));
+  m_VideoPlayerSubtitle->SendMessage(CDVDMsgDemuxerPacket::Create(pPacket, drop));
 
   if(m_pInputStream && m_pInputStream->IsStreamType(DVDSTREAM_TYPE_DVD))
     m_VideoPlayerSubtitle->UpdateOverlayInfo(std::static_pointer_cast<CDVDInputStreamNavigator>(m_pInputStream), LIBDVDNAV_BUTTON_NORMAL);
@@ -1966,7 +2015,7 @@ void CVideoPlayer::ProcessTeletextData(CDemuxStream* pStream, DemuxPacket* pPack
   if (CheckSceneSkip(m_CurrentTeletext))
     drop = true;
 
-  m_VideoPlayerTeletext->SendMessage(std::make_shared<CDVDMsgDemuxerPacket>(pPacket, drop));
+  m_VideoPlayerTeletext->SendMessage(CDVDMsgDemuxerPacket::Create(pPacket, drop));
 }
 
 void CVideoPlayer::ProcessRadioRDSData(CDemuxStream* pStream, DemuxPacket* pPacket)
@@ -1982,7 +2031,7 @@ void CVideoPlayer::ProcessRadioRDSData(CDemuxStream* pStream, DemuxPacket* pPack
   if (CheckSceneSkip(m_CurrentRadioRDS))
     drop = true;
 
-  m_VideoPlayerRadioRDS->SendMessage(std::make_shared<CDVDMsgDemuxerPacket>(pPacket, drop));
+  m_VideoPlayerRadioRDS->SendMessage(CDVDMsgDemuxerPacket::Create(pPacket, drop));
 }
 
 void CVideoPlayer::ProcessAudioID3Data(CDemuxStream* pStream, DemuxPacket* pPacket)
@@ -1998,7 +2047,7 @@ void CVideoPlayer::ProcessAudioID3Data(CDemuxStream* pStream, DemuxPacket* pPack
   if (CheckSceneSkip(m_CurrentAudioID3))
     drop = true;
 
-  m_VideoPlayerAudioID3->SendMessage(std::make_shared<CDVDMsgDemuxerPacket>(pPacket, drop));
+  m_VideoPlayerAudioID3->SendMessage(CDVDMsgDemuxerPacket::Create(pPacket, drop));
 }
 
 CacheInfo CVideoPlayer::GetCachingTimes()
@@ -2858,6 +2907,7 @@ void CVideoPlayer::OnExit()
   m_pSubtitleDemuxer.reset();
   m_subtitleDemuxerMap.clear();
   m_pCCDemuxer.reset();
+  CDVDDemuxUtils::TrimPacketPool();
   if (m_pInputStream.use_count() > 1)
     throw std::runtime_error("m_pInputStream reference count is greater than 1");
   m_pInputStream.reset();
@@ -4223,11 +4273,20 @@ bool CVideoPlayer::OpenVideoStream(CDVDStreamInfo& hint, bool reset)
   if(m_CurrentVideo.id < 0 ||
      m_CurrentVideo.hint != hint)
   {
-    if (hint.codec == AV_CODEC_ID_MPEG2VIDEO || hint.codec == AV_CODEC_ID_H264)
-      m_pCCDemuxer.reset();
+    if (m_CurrentVideo.id >= 0 && CanKeepVideoCodec(hint))
+    {
+      // the new channel only differs in the stream ids, flushing the decoder is enough
+      CLog::Log(LOGINFO, "CVideoPlayer::OpenVideoStream - keeping the video codec");
+      player->SendMessage(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_RESET), 0);
+    }
+    else
+    {
+      if (hint.codec == AV_CODEC_ID_MPEG2VIDEO || hint.codec == AV_CODEC_ID_H264)
+        m_pCCDemuxer.reset();
 
-    if (!player->OpenStream(hint))
-      return false;
+      if (!player->OpenStream(hint))
+        return false;
+    }
 
     player->SendMessage(std::make_shared<CDVDMsgBool>(CDVDMsg::GENERAL_PAUSE, m_displayLost), 1);
 
@@ -4273,6 +4332,32 @@ bool CVideoPlayer::OpenVideoStream(CDVDStreamInfo& hint, bool reset)
   return true;
 }
 
+bool CVideoPlayer::CanKeepVideoCodec(const CDVDStreamInfo& hint) const
+{
+  const auto advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+  if (!advancedSettings->m_videoKeepCodecOnChannelSwitch)
+    return false;
+
+  // a live tv channel switch mostly brings the same format on another pid
+  if (!m_pInputStream || !m_pInputStream->IsStreamType(DVDSTREAM_TYPE_PVRMANAGER))
+    return false;
+
+  // these codecs repeat their parameter sets in the stream as long as they are not stored
+  // out of band like in avc1/hvc1 streams, so different extradata doesn't matter
+  // clang-format off
+  if ((hint.codec != AV_CODEC_ID_MPEG2VIDEO &&
+       hint.codec != AV_CODEC_ID_H264 &&
+       hint.codec != AV_CODEC_ID_HEVC) ||
+      hint.codec_tag == MKTAG('a','v','c','1') || hint.codec_tag == MKTAG('a','v','c','2') ||
+      hint.codec_tag == MKTAG('h','v','c','1'))
+    return false;
+  // clang-format on
+
+  return m_CurrentVideo.hint.Equal(
+      hint, CDVDStreamInfo::COMPARE_ALL & ~CDVDStreamInfo::COMPARE_ID &
+                ~CDVDStreamInfo::COMPARE_EXTRADATA);
+}
+
 bool CVideoPlayer::OpenSubtitleStream(const CDVDStreamInfo& hint)
 {
   IDVDStreamPlayer* player = GetStreamPlayer(m_CurrentSubtitle.player);
@@ -5572,6 +5657,10 @@ void CVideoPlayer::UpdatePlayState(double timeout)
 
   m_processInfo->SetPlayTimes(state.startTime, state.time, state.timeMin, state.timeMax);
 
+  const DemuxPacketPoolStats poolStats = CDVDDemuxUtils::GetPacketPoolStats();
+  CServiceBroker::GetDataCacheCore().SetDemuxPacketPoolStats(
+      poolStats.allocations, poolStats.poolHits, poolStats.wrapped, poolStats.cachedBytes);
+
   std::unique_lock lock(m_StateSection);
   m_State = state;
 }
@@ -5670,6 +5759,11 @@ bool CVideoPlayer::IsLiveStream() const
   return m_processInfo->IsRealtimeStream();
 }
 
+bool CVideoPlayer::IsRealtimeStream() const
+{
+  return IsLiveStream();
+}
+
 bool CVideoPlayer::Supports(EINTERLACEMETHOD method) const
 {
   if (!m_processInfo)
@@ -405,6 +405,7 @@ protected:
   void UpdateRenderBuffers(int queued, int discard, int free) override;
   void UpdateGuiRender(bool gui) override;
   void UpdateVideoRender(bool video) override;
+  bool IsRealtimeStream() const override;
 
   virtual void CreatePlayers();
   void DestroyPlayers();
@@ -413,6 +414,7 @@ protected:
   bool OpenStream(CCurrentStream& current, int64_t demuxerId, int iStream, int source, bool reset = true);
   bool OpenAudioStream(CDVDStreamInfo& hint, bool reset = true);
   bool OpenVideoStream(CDVDStreamInfo& hint, bool reset = true);
+  bool CanKeepVideoCodec(const CDVDStreamInfo& hint) const;
   bool OpenSubtitleStream(const CDVDStreamInfo& hint);
   bool OpenTeletextStream(CDVDStreamInfo& hint);
   bool OpenRadioRDSStream(CDVDStreamInfo& hint);
@@ -516,11 +518,17 @@ protected:
   int GetPreviousBookmark(std::chrono::milliseconds ts);
   int GetNextBookmark(std::chrono::milliseconds ts);
   std::optional<std::chrono::milliseconds> GetBookmarkPos(int idx);
+  void LoadProbeInfo();
+  void SaveProbeInfo();
 
   bool m_players_created;
 
   CFileItem m_item;
   CPlayerOptions m_playerOptions;
+
+  // cached demuxer probe result of m_item, the key is empty if the file can't be cached
+  std::string m_probeInfoKey;
+  std::string m_probeInfo;
   bool m_bAbortRequest;
   bool m_error;
   bool m_bCloseRequest;
@@ -67,6 +67,8 @@ CVideoPlayerAudio::CVideoPlayerAudio(CDVDClock* pClock,
   // allows max bitrate of 18 Mbit/s (TrueHD max peak) during m_messageQueueTimeSize seconds
   m_messageQueue.SetMaxDataSize(18 * messageQueueTimeSize / 8 * 1024 * 1024);
   m_messageQueue.SetMaxTimeSize(messageQueueTimeSize);
+  // TrueHD produces ~1200 packets per second
+  m_messageQueue.SetRingMode(16384);
 
   m_disconAdjustTimeMs = processInfo.GetMaxPassthroughOffSyncDuration();
 }
@@ -214,6 +216,17 @@ void CVideoPlayerAudio::UpdatePlayerInfo()
   else if (m_synctype == SYNC_RESAMPLE)
     s << ", rr:" << std::fixed << std::setprecision(5) << 1.0 / m_audioSink.GetResampleRatio();
 
+  // engine counters: sink underruns and the average time of one resample, mix and sink write run
+  AEPerfStats stats;
+  if (CServiceBroker::GetActiveAE()->GetPerfStats(stats))
+  {
+    auto average = [](const AEPerfStats::Timing& timing)
+    { return timing.count ? timing.totalMs / timing.count : 0.0; };
+    s << ", ur:" << stats.underruns << ", rs/mix/sink:" << std::fixed << std::setprecision(2)
+      << average(stats.resample) << "/" << average(stats.mix) << "/" << average(stats.sinkWrite)
+      << "ms";
+  }
+
   SInfo info;
   info.info        = s.str();
   info.pts         = m_audioSink.GetPlayingPts();
@@ -11,6 +11,7 @@
 #include "DVDCodecs/DVDFactoryCodec.h"
 #include "DVDCodecs/Overlay/DVDOverlay.h"
 #include "DVDCodecs/Overlay/DVDOverlayCodec.h"
+#include "DVDCodecs/Overlay/DVDOverlayLibass.h"
 #include "DVDCodecs/Overlay/DVDOverlaySpu.h"
 #include "DVDSubtitles/DVDSubtitleParser.h"
 #include "cores/VideoPlayer/Interface/DemuxPacket.h"
@@ -224,6 +225,15 @@ void CVideoPlayerSubtitle::Process(double pts, double offset)
       if(pOverlay->iPTSStopTime != 0.0)
         pOverlay->iPTSStopTime -= offset;
 
+      // All the events of a subtitle file are known, libass renders ahead of the clock
+      if (pOverlay->IsOverlayType(DVDOVERLAY_TYPE_TEXT) ||
+          pOverlay->IsOverlayType(DVDOVERLAY_TYPE_SSA))
+      {
+        auto libass = std::static_pointer_cast<CDVDOverlayLibass>(pOverlay)->GetLibassHandler();
+        if (libass)
+          libass->EnableLookAhead();
+      }
+
       m_pOverlayContainer->ProcessAndAddOverlayIfValid(pOverlay);
       pOverlay = m_pSubtitleFileParser->Parse(pts);
     }
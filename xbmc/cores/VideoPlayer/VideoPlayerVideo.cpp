@@ -13,6 +13,7 @@
 #include "DVDCodecs/Overlay/DVDOverlay.h"
 #include "DVDCodecs/Video/DVDVideoCodecFFmpeg.h"
 #include "ServiceBroker.h"
+#include "cores/DataCacheCore.h"
 #include "cores/VideoPlayer/Interface/DemuxPacket.h"
 #include "cores/VideoPlayer/Interface/TimingConstants.h"
 #include "settings/AdvancedSettings.h"
@@ -73,6 +74,7 @@ CVideoPlayerVideo::CVideoPlayerVideo(CDVDClock* pClock,
 
   m_messageQueue.SetMaxDataSize(sizeMB * 1024 * 1024);
   m_messageQueue.SetMaxTimeSize(messageQueueTimeSize);
+  m_messageQueue.SetRingMode(4096);
 
   m_iDroppedFrames = 0;
   m_fFrameRate = 25;
@@ -582,6 +584,8 @@ void CVideoPlayerVideo::Process()
         codecControl |= DVD_CODEC_CTRL_ROTATE;
       m_pVideoCodec->SetCodecControl(codecControl);
 
+      CServiceBroker::GetDataCacheCore().GetFrameTimeline().Record(FrameStage::DECODE_SUBMIT,
+                                                                   pPacket->pts);
       if (m_pVideoCodec->AddData(*pPacket))
       {
         // buffer packets so we can recover should decoder flush for some reason
@@ -699,6 +703,9 @@ bool CVideoPlayerVideo::ProcessDecoderOutput(double &frametime, double &pts)
     else if (m_picture.pts == DVD_NOPTS_VALUE)
       m_picture.pts = m_picture.dts;
 
+    CServiceBroker::GetDataCacheCore().GetFrameTimeline().Record(FrameStage::DECODE_RETURN,
+                                                                 m_picture.pts);
+
     // use forced aspect if any
     if (m_fForcedAspectRatio != 0.0f)
     {
@@ -64,6 +64,9 @@ public:
   // Return the internally created texture ID
   GLuint Texture() const { return m_texid; }
 
+  // Return the framebuffer handle
+  GLuint Framebuffer() const { return m_fbo; }
+
   // Begin rendering to FBO
   bool BeginRender();
   // Finish rendering to FBO
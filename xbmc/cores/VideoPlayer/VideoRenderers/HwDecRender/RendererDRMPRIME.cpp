@@ -19,6 +19,7 @@
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "settings/lib/Setting.h"
+#include "utils/DRMHelpers.h"
 #include "utils/log.h"
 #include "windowing/GraphicContext.h"
 #include "windowing/gbm/WinSystemGbm.h"
@@ -55,12 +56,18 @@ CBaseRenderer* CRendererDRMPRIME::Create(CVideoBuffer* buffer)
   if (!settings->GetBool(CSettings::SETTING_VIDEOPLAYER_USEPRIMEDECODER))
     return nullptr;
 
-  if (buffer && settings->GetInt(CSettings::SETTING_VIDEOPLAYER_USEPRIMERENDERER) == 0)
+  // 0: direct to plane, 2: direct to plane whenever the planes can take the video, EGL otherwise
+  const int method = settings->GetInt(CSettings::SETTING_VIDEOPLAYER_USEPRIMERENDERER);
+  if (buffer && (method == 0 || method == 2))
   {
     auto buf = dynamic_cast<CVideoBufferDRMPRIME*>(buffer);
     if (!buf)
       return nullptr;
 
+    // the planes scan out the decoder's range as is, only EGL can compress it
+    if (method == 2 && settings->GetBool(CSettings::SETTING_VIDEOSCREEN_LIMITEDRANGE))
+      return nullptr;
+
     auto winSystem = static_cast<CWinSystemGbm*>(CServiceBroker::GetWinSystem());
     if (!winSystem)
       return nullptr;
@@ -69,30 +76,29 @@ CBaseRenderer* CRendererDRMPRIME::Create(CVideoBuffer* buffer)
     if (!drm)
       return nullptr;
 
-    if (!buf->AcquireDescriptor())
-      return nullptr;
-
-    AVDRMFrameDescriptor* desc = buf->GetDescriptor();
-    if (!desc)
-    {
-      buf->ReleaseDescriptor();
+    uint32_t format;
+    uint64_t modifier;
+    if (!buf->GetFormatAndModifier(format, modifier))
       return nullptr;
-    }
 
-    AVDRMLayerDescriptor* layer = &desc->layers[0];
-    uint32_t format = layer->format;
-    uint64_t modifier = desc->objects[0].format_modifier;
     uint64_t width = buf->GetWidth();
     uint64_t height = buf->GetHeight();
 
-    buf->ReleaseDescriptor();
-
     auto gui = drm->GetGuiPlane();
     if (!gui)
       return nullptr;
 
+    // the gui keeps its own plane above the video, so it may overlap the video as long as that
+    // plane can blend. FindVideoAndGuiPlane checks this together with format, modifier and size.
     if (!drm->FindVideoAndGuiPlane(format, modifier, width, height))
+    {
+      if (method == 2)
+        CLog::Log(LOGDEBUG,
+                  "CRendererDRMPRIME::Create - no plane for {}x{} format:{} modifier:{}, using EGL",
+                  width, height, DRMHELPERS::FourCCToString(format),
+                  DRMHELPERS::ModifierToString(modifier));
       return nullptr;
+    }
 
     return new CRendererDRMPRIME();
   }
@@ -117,6 +123,8 @@ void CRendererDRMPRIME::Register()
 bool CRendererDRMPRIME::Configure(const VideoPicture& picture, float fps, unsigned int orientation)
 {
   m_format = picture.videoBuffer->GetFormat();
+  if (auto* buffer = dynamic_cast<CVideoBufferDRMPRIME*>(picture.videoBuffer))
+    buffer->GetFormatAndModifier(m_drmFormat, m_drmModifier);
   m_sourceWidth = picture.iWidth;
   m_sourceHeight = picture.iHeight;
   m_renderOrientation = orientation;
@@ -272,6 +280,14 @@ bool CRendererDRMPRIME::ConfigChanged(const VideoPicture& picture)
   if (picture.videoBuffer->GetFormat() != m_format)
     return true;
 
+  // a new layout may not fit the plane anymore, reconfiguring picks the renderer again
+  uint32_t format;
+  uint64_t modifier;
+  auto* buffer = dynamic_cast<CVideoBufferDRMPRIME*>(picture.videoBuffer);
+  if (buffer && buffer->GetFormatAndModifier(format, modifier) &&
+      (format != m_drmFormat || modifier != m_drmModifier))
+    return true;
+
   return false;
 }
 
@@ -51,6 +51,8 @@ private:
   bool m_bConfigured = false;
   int m_iLastRenderBuffer = -1;
   CRect m_planeDestRect;
+  uint32_t m_drmFormat = 0;
+  uint64_t m_drmModifier = 0;
 
   std::shared_ptr<CVideoLayerBridgeDRMPRIME> m_videoLayerBridge;
 
@@ -44,7 +44,9 @@ CBaseRenderer* CRendererDRMPRIMEGLES::Create(CVideoBuffer* buffer)
   if (!settings->GetBool(CSettings::SETTING_VIDEOPLAYER_USEPRIMEDECODER))
     return nullptr;
 
-  if (settings->GetInt(CSettings::SETTING_VIDEOPLAYER_USEPRIMERENDERER) != 1)
+  // in automatic mode drm_prime is asked first and only falls back to EGL if no plane fits
+  const int method = settings->GetInt(CSettings::SETTING_VIDEOPLAYER_USEPRIMERENDERER);
+  if (method != 1 && method != 2)
     return nullptr;
 
   auto buf = dynamic_cast<CVideoBufferDRMPRIME*>(buffer);
@@ -52,21 +54,11 @@ CBaseRenderer* CRendererDRMPRIMEGLES::Create(CVideoBuffer* buffer)
     return nullptr;
 
 #if defined(EGL_EXT_image_dma_buf_import_modifiers)
-  if (!buf->AcquireDescriptor())
+  uint32_t format;
+  uint64_t modifier;
+  if (!buf->GetFormatAndModifier(format, modifier))
     return nullptr;
 
-  auto desc = buf->GetDescriptor();
-  if (!desc)
-  {
-    buf->ReleaseDescriptor();
-    return nullptr;
-  }
-
-  uint64_t modifier = desc->objects[0].format_modifier;
-  uint32_t format = desc->layers[0].format;
-
-  buf->ReleaseDescriptor();
-
   auto winSystemEGL =
       dynamic_cast<KODI::WINDOWING::LINUX::CWinSystemEGL*>(CServiceBroker::GetWinSystem());
   if (!winSystemEGL)
@@ -90,6 +82,10 @@ bool CRendererDRMPRIMEGLES::Configure(const VideoPicture& picture,
                                       unsigned int orientation)
 {
   m_format = picture.videoBuffer->GetFormat();
+  if (auto* buffer = dynamic_cast<CVideoBufferDRMPRIME*>(picture.videoBuffer))
+    buffer->GetFormatAndModifier(m_drmFormat, m_drmModifier);
+  m_autoMethod = CServiceBroker::GetSettingsComponent()->GetSettings()->GetInt(
+                     CSettings::SETTING_VIDEOPLAYER_USEPRIMERENDERER) == 2;
   m_sourceWidth = picture.iWidth;
   m_sourceHeight = picture.iHeight;
   m_renderOrientation = orientation;
@@ -441,6 +437,14 @@ bool CRendererDRMPRIMEGLES::ConfigChanged(const VideoPicture& picture)
   if (picture.videoBuffer->GetFormat() != m_format)
     return true;
 
+  // in automatic mode a new layout may fit a plane, reconfiguring picks the renderer again
+  uint32_t format;
+  uint64_t modifier;
+  auto* buffer = dynamic_cast<CVideoBufferDRMPRIME*>(picture.videoBuffer);
+  if (m_autoMethod && buffer && buffer->GetFormatAndModifier(format, modifier) &&
+      (format != m_drmFormat || modifier != m_drmModifier))
+    return true;
+
   return false;
 }
 
@@ -69,6 +69,9 @@ private:
   void Render(unsigned int flags, int index);
 
   bool m_configured = false;
+  bool m_autoMethod = false;
+  uint32_t m_drmFormat = 0;
+  uint64_t m_drmModifier = 0;
   bool m_passthroughHDR{false};
   bool m_hdrFboActive{false};
 
@@ -133,6 +133,7 @@ CLinuxRendererGL::CLinuxRendererGL()
   m_CLUTsize = 0;
   m_cmsToken = -1;
   m_cmsOn = false;
+  m_toneMapLUT = std::make_shared<CToneMapLUT>();
 
   m_renderSystem = dynamic_cast<CRenderSystemGL*>(CServiceBroker::GetRenderSystem());
 
@@ -880,26 +881,18 @@ void CLinuxRendererGL::UpdateVideoFilter()
 
   case VS_SCALINGMETHOD_LANCZOS3_FAST:
   case VS_SCALINGMETHOD_SPLINE36_FAST:
+  case VS_SCALINGMETHOD_SPLINE36:
+  case VS_SCALINGMETHOD_LANCZOS3:
+    if (CanScaleSinglePass())
     {
-      EShaderFormat fmt = GetShaderFormat();
-      if (fmt == SHADER_NV12 || (fmt >= SHADER_YV12 && fmt <= SHADER_YV12_16))
-      {
-        unsigned int major, minor;
-        m_renderSystem->GetRenderVersion(major, minor);
-        if (major >= 4)
-        {
-          SetTextureFilter(GL_LINEAR);
-          m_renderQuality = RQ_SINGLEPASS;
-          return;
-        }
-      }
-
-      [[fallthrough]];
+      SetTextureFilter(GL_LINEAR);
+      m_renderQuality = RQ_SINGLEPASS;
+      return;
     }
 
+    [[fallthrough]];
+
   case VS_SCALINGMETHOD_LANCZOS2:
-  case VS_SCALINGMETHOD_SPLINE36:
-  case VS_SCALINGMETHOD_LANCZOS3:
   case VS_SCALINGMETHOD_CUBIC_B_SPLINE:
   case VS_SCALINGMETHOD_CUBIC_MITCHELL:
   case VS_SCALINGMETHOD_CUBIC_CATMULL:
@@ -974,6 +967,30 @@ void CLinuxRendererGL::UpdateVideoFilter()
   m_renderQuality = RQ_SINGLEPASS;
 }
 
+bool CLinuxRendererGL::CanScaleSinglePass()
+{
+  // the yuv2rgb filter shaders gather the source texels of the planar and semi planar formats
+  const EShaderFormat fmt = GetShaderFormat();
+  if (fmt != SHADER_NV12 && (fmt < SHADER_YV12 || fmt > SHADER_YV12_16))
+    return false;
+
+  unsigned int major, minor;
+  m_renderSystem->GetRenderVersion(major, minor);
+  if (major < 4)
+    return false;
+
+  if (m_scalingMethod == VS_SCALINGMETHOD_LANCZOS3_FAST ||
+      m_scalingMethod == VS_SCALINGMETHOD_SPLINE36_FAST)
+    return true;
+
+  // the full kernels skip the fbo, unless the hq scaler precision asks to scale in linear light
+  if (m_scalingMethod == VS_SCALINGMETHOD_LANCZOS3 || m_scalingMethod == VS_SCALINGMETHOD_SPLINE36)
+    return !m_intermediateGammaCorrection &&
+           CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoSinglePassScaling;
+
+  return false;
+}
+
 void CLinuxRendererGL::LoadShaders(int field)
 {
   m_reloadShaders = false;
@@ -994,19 +1011,30 @@ void CLinuxRendererGL::LoadShaders(int field)
     EShaderFormat shaderFormat = GetShaderFormat();
     std::shared_ptr<GLSLOutput> out;
     m_toneMapMethod = m_videoSettings.m_ToneMapMethod;
+
+    // the tone map LUT takes the calibration along in single pass, so the output stage doesn't
+    // need a second lookup
+    std::shared_ptr<CToneMapLUT> toneMapLUT;
+    if (m_toneMap &&
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoToneMapLUT)
+      toneMapLUT = m_toneMapLUT;
+    const bool lutCalibration =
+        toneMapLUT && m_cmsOn && m_renderQuality == RQ_SINGLEPASS && m_toneMapLUT->HasCalibration();
+    m_toneMapLUT->EnableCalibration(lutCalibration);
+
     if (m_renderQuality == RQ_SINGLEPASS)
     {
       out = std::make_shared<GLSLOutput>(GLSLOutput(4, m_useDithering, m_ditherDepth,
                                                     m_cmsOn ? m_fullRange : false,
-                                                    m_cmsOn ? m_tCLUTTex : 0,
+                                                    m_cmsOn && !lutCalibration ? m_tCLUTTex : 0,
                                                     m_CLUTsize));
 
-      if (m_scalingMethod == VS_SCALINGMETHOD_LANCZOS3_FAST || m_scalingMethod == VS_SCALINGMETHOD_SPLINE36_FAST)
+      if (CanScaleSinglePass())
       {
         m_pYUVShader = new YUV2RGBFilterShader4(
             m_textureTarget == GL_TEXTURE_RECTANGLE, shaderFormat, m_nonLinStretch,
             m_passthroughHDR ? m_srcPrimaries : AVColorPrimaries::AVCOL_PRI_BT709, m_srcPrimaries,
-            m_toneMap, m_toneMapMethod, m_scalingMethod, out);
+            m_toneMap, m_toneMapMethod, m_scalingMethod, out, toneMapLUT);
         if (!m_cmsOn)
           m_pYUVShader->SetConvertFullColorRange(m_fullRange);
 
@@ -1033,7 +1061,7 @@ void CLinuxRendererGL::LoadShaders(int field)
           m_nonLinStretch && m_renderQuality == RQ_SINGLEPASS,
           m_passthroughHDR ? m_srcPrimaries : AVColorPrimaries::AVCOL_PRI_BT709, m_srcPrimaries,
           m_toneMap, m_toneMapMethod, out,
-          m_intermediateGammaCorrection && m_renderQuality == RQ_MULTIPASS);
+          m_intermediateGammaCorrection && m_renderQuality == RQ_MULTIPASS, toneMapLUT);
 
       if (!m_cmsOn)
         m_pYUVShader->SetConvertFullColorRange(m_fullRange);
@@ -1076,6 +1104,7 @@ void CLinuxRendererGL::UnInit()
   }
 
   DeleteCLUT();
+  m_toneMapLUT->Free();
 
   if (m_bConfigured)
   {
@@ -2785,6 +2814,7 @@ bool CLinuxRendererGL::LoadCLUT()
   // load 3DLUT data
   glTexImage3D(GL_TEXTURE_3D, 0, GL_RGB16, m_CLUTsize, m_CLUTsize, m_CLUTsize, 0, GL_RGB,
                GL_UNSIGNED_SHORT, m_CLUT);
+  m_toneMapLUT->SetCalibration(m_CLUT, m_CLUTsize);
   free(m_CLUT);
   glActiveTexture(GL_TEXTURE0);
   return true;
@@ -2798,6 +2828,7 @@ void CLinuxRendererGL::DeleteCLUT()
     glDeleteTextures(1, &m_tCLUTTex);
     m_tCLUTTex = 0;
   }
+  m_toneMapLUT->SetCalibration(nullptr, 0);
 }
 
 void CLinuxRendererGL::CheckVideoParameters(int index)
@@ -34,6 +34,7 @@ namespace GL
 {
 class BaseYUV2RGBGLSLShader;
 class BaseVideoFilterShader;
+class CToneMapLUT;
 }
 } // namespace Shaders
 
@@ -98,6 +99,7 @@ protected:
   virtual void LoadShaders(int field=FIELD_FULL);
   void SetTextureFilter(GLenum method);
   void UpdateVideoFilter();
+  bool CanScaleSinglePass();
   void CheckVideoParameters(int index);
   AVColorPrimaries GetSrcPrimaries(AVColorPrimaries srcPrimaries, unsigned int width, unsigned int height);
 
@@ -238,6 +240,7 @@ protected:
   int m_CLUTsize;
   int m_cmsToken;
   bool m_cmsOn;
+  std::shared_ptr<Shaders::GL::CToneMapLUT> m_toneMapLUT;
 
   bool LoadCLUT();
   void DeleteCLUT();
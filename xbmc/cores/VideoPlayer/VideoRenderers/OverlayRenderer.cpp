@@ -610,12 +610,19 @@ std::shared_ptr<COverlay> CRenderer::ConvertLibass(SElement& e)
 
   if (o.m_textureid)
   {
-    if (o.m_pendingChange == 0)
+    std::map<unsigned int, std::shared_ptr<COverlay>>::iterator it =
+        m_textureCache.find(o.m_textureid);
+    if (it != m_textureCache.end() && it->second)
     {
-      std::map<unsigned int, std::shared_ptr<COverlay>>::iterator it =
-          m_textureCache.find(o.m_textureid);
-      if (it != m_textureCache.end())
+      if (o.m_pendingChange == 0)
+        return it->second;
+
+      // only the glyphs libass didn't hand out before are uploaded
+      if (it->second->Update(e.renderedImages, e.renderedFrameWidth, e.renderedFrameHeight))
+      {
+        o.m_pendingChange = 0; // consume
         return it->second;
+      }
     }
   }
 
@@ -61,6 +61,12 @@ namespace OVERLAY {
 
     virtual void Render(SRenderState& state) = 0;
 
+    /*!
+     * \brief Show the next change of libass subtitles, keeping the textures of this overlay
+     * \return false if this overlay can't be reused, a new one has to be created then
+     */
+    virtual bool Update(ASS_Image* images, float width, float height) { return false; }
+
     enum EType
     {
       TYPE_NONE,
@@ -177,8 +183,8 @@ namespace OVERLAY {
       double pts;
       std::shared_ptr<CDVDOverlay> overlay_dvd;
       // libass output cached by PrepareOverlays; read by ConvertLibass during
-      // render. libass owns the pointer; valid only until the next
-      // ass_render_frame call.
+      // render. The libass handler owns the pointer; valid only until the
+      // next RenderImage call.
       ASS_Image* renderedImages{nullptr};
       float renderedFrameWidth{0.0f};
       float renderedFrameHeight{0.0f};
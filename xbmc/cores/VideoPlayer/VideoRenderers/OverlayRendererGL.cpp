@@ -190,6 +190,7 @@ std::shared_ptr<COverlay> COverlay::Create(ASS_Image* images, float width, float
 }
 
 COverlayGlyphGL::COverlayGlyphGL(ASS_Image* images, float width, float height)
+  : m_atlas(static_cast<int>(width)), m_frameWidth(width), m_frameHeight(height)
 {
   m_width  = 1.0;
   m_height = 1.0;
@@ -198,29 +199,57 @@ COverlayGlyphGL::COverlayGlyphGL(ASS_Image* images, float width, float height)
   m_x      = 0.0f;
   m_y      = 0.0f;
 
-  SQuads quads;
-  if (!convert_quad(images, quads, static_cast<int>(width)))
+  Load(images);
+}
+
+bool COverlayGlyphGL::Update(ASS_Image* images, float width, float height)
+{
+  if (width != m_frameWidth || height != m_frameHeight)
+    return false;
+
+  Load(images);
+  return true;
+}
+
+void COverlayGlyphGL::Load(ASS_Image* images)
+{
+  m_vertex.clear();
+
+  std::vector<SQuad> quads;
+  if (!m_atlas.Update(images, quads))
     return;
 
-  glGenTextures(1, &m_texture);
+  if (!m_texture)
+    glGenTextures(1, &m_texture);
   glBindTexture(GL_TEXTURE_2D, m_texture);
 
-  LoadTexture(GL_TEXTURE_2D, quads.size_x, quads.size_y, quads.size_x, &m_u, &m_v, true,
-              quads.texture.data());
-
+  if (m_atlas.IsReset())
+  {
+    LoadTexture(GL_TEXTURE_2D, m_atlas.Width(), m_atlas.Height(), m_atlas.Width(), &m_u, &m_v,
+                true, m_atlas.Data());
+  }
+  else
+  {
+    // only the rows the new glyphs went to
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (const CGlyphAtlas::SRows& rows : m_atlas.GetDirtyRows())
+      glTexSubImage2D(GL_TEXTURE_2D, 0, 0, rows.y, m_atlas.Width(), rows.height, GL_RED,
+                      GL_UNSIGNED_BYTE, m_atlas.Data() + rows.y * m_atlas.Width());
+  }
+  m_atlas.SetUploaded();
 
-  float scale_u = m_u / quads.size_x;
-  float scale_v = m_v / quads.size_y;
+  float scale_u = m_u / m_atlas.Width();
+  float scale_v = m_v / m_atlas.Height();
 
-  float scale_x = 1.0f / width;
-  float scale_y = 1.0f / height;
+  float scale_x = 1.0f / m_frameWidth;
+  float scale_y = 1.0f / m_frameHeight;
 
-  m_vertex.resize(quads.quad.size() * 4);
+  m_vertex.resize(quads.size() * 4);
 
   VERTEX* vt = m_vertex.data();
-  SQuad* vs = quads.quad.data();
+  SQuad* vs = quads.data();
 
-  for (size_t i = 0; i < quads.quad.size(); i++)
+  for (size_t i = 0; i < quads.size(); i++)
   {
     for(int s = 0; s < 4; s++)
     {
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "OverlayRenderer.h"
+#include "OverlayRendererUtil.h"
 
 #include "system_gl.h"
 
@@ -46,6 +47,7 @@ namespace OVERLAY {
 
     ~COverlayGlyphGL() override;
 
+    bool Update(ASS_Image* images, float width, float height) override;
     void Render(SRenderState& state) override;
 
     struct VERTEX
@@ -60,6 +62,13 @@ namespace OVERLAY {
     GLuint m_texture = 0;
     float m_u;
     float m_v;
+
+  private:
+    void Load(ASS_Image* images);
+
+    CGlyphAtlas m_atlas;
+    float m_frameWidth;
+    float m_frameHeight;
   };
 
 }
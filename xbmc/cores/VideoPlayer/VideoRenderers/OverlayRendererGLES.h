@@ -10,6 +10,7 @@
 #pragma once
 
 #include "OverlayRenderer.h"
+#include "OverlayRendererUtil.h"
 
 #include "system_gl.h"
 
@@ -47,6 +48,7 @@ public:
 
   ~COverlayGlyphGLES() override;
 
+  bool Update(ASS_Image* images, float width, float height) override;
   void Render(SRenderState& state) override;
 
   struct VERTEX
@@ -61,6 +63,13 @@ public:
   GLuint m_texture = 0;
   float m_u;
   float m_v;
+
+private:
+  void Load(ASS_Image* images);
+
+  CGlyphAtlas m_atlas;
+  float m_frameWidth;
+  float m_frameHeight;
 };
 
 } // namespace OVERLAY
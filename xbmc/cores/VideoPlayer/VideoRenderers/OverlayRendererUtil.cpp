@@ -17,6 +17,12 @@
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
+#include <cstring>
+
+#define GLYPH_ATLAS_MIN_HEIGHT 64
+#define GLYPH_ATLAS_MAX_HEIGHT 2048
+
 namespace OVERLAY
 {
 
@@ -272,6 +278,150 @@ bool convert_quad(ASS_Image* images, SQuads& quads, int max_x)
   return true;
 }
 
+bool CGlyphAtlas::Update(ASS_Image* images, std::vector<SQuad>& quads)
+{
+  if (Place(images, quads, true))
+    return !quads.empty();
+
+  // full, start over with the bitmaps shown now, as large as they need
+  Reset();
+  Place(images, quads, false);
+  return !quads.empty();
+}
+
+void CGlyphAtlas::SetUploaded()
+{
+  m_reset = false;
+  m_dirtyRows.clear();
+}
+
+bool CGlyphAtlas::Place(ASS_Image* images, std::vector<SQuad>& quads, bool limitHeight)
+{
+  quads.clear();
+
+  for (ASS_Image* img = images; img; img = img->next)
+  {
+    // fully transparent or width or height is 0 -> not displayed
+    if ((img->color & 0xff) == 0xff || img->w == 0 || img->h == 0 || img->w >= m_width)
+      continue;
+
+    const SGlyph* glyph = GetGlyph(*img, limitHeight);
+    if (!glyph)
+      return false;
+
+    const unsigned int color = img->color;
+
+    SQuad& quad = quads.emplace_back();
+    quad.a = 255 - (color & 0xff);
+    quad.r = (color >> 24) & 0xff;
+    quad.g = (color >> 16) & 0xff;
+    quad.b = (color >> 8) & 0xff;
+
+    quad.u = glyph->u;
+    quad.v = glyph->v;
+
+    quad.x = img->dst_x;
+    quad.y = img->dst_y;
+
+    quad.w = img->w;
+    quad.h = img->h;
+  }
+  return true;
+}
+
+const CGlyphAtlas::SGlyph* CGlyphAtlas::GetGlyph(const ASS_Image& image, bool limitHeight)
+{
+  auto it = m_glyphs.find(image.bitmap);
+  if (it != m_glyphs.end() && it->second.w == image.w && it->second.h == image.h)
+  {
+    // libass may have freed the bitmap and rendered another one at its address
+    const SGlyph& glyph = it->second;
+    bool same = true;
+    for (int i = 0; i < image.h && same; i++)
+      same = memcmp(m_texture.data() + (glyph.v + i) * m_width + glyph.u,
+                    image.bitmap + image.stride * i, image.w) == 0;
+    if (same)
+      return &glyph;
+  }
+
+  SGlyph glyph{image.w, image.h, 0, 0};
+  if (!Allocate(image.w, image.h, limitHeight, glyph.u, glyph.v))
+    return nullptr;
+
+  for (int i = 0; i < image.h; i++)
+    memcpy(m_texture.data() + (glyph.v + i) * m_width + glyph.u, image.bitmap + image.stride * i,
+           image.w);
+  MarkDirty(glyph.v, glyph.h);
+
+  return &(m_glyphs[image.bitmap] = glyph);
+}
+
+bool CGlyphAtlas::Allocate(int w, int h, bool limitHeight, int& u, int& v)
+{
+  // keep a line of transparent pixels around each glyph, the texture is filtered
+  const int width = w + 1;
+  const int height = h + 1;
+
+  // the lowest shelf the glyph fits on, without wasting much of it
+  SShelf* best = nullptr;
+  for (SShelf& shelf : m_shelves)
+  {
+    if (shelf.height >= height && shelf.height <= height + height / 2 &&
+        shelf.x + width <= m_width && (!best || shelf.height < best->height))
+      best = &shelf;
+  }
+
+  if (!best)
+  {
+    if (limitHeight && m_nextY + height > GLYPH_ATLAS_MAX_HEIGHT)
+      return false;
+
+    best = &m_shelves.emplace_back(SShelf{m_nextY, height, 0});
+    m_nextY += height;
+
+    if (m_nextY > m_height)
+    {
+      // grow by doubling the height, the whole atlas is uploaded again then
+      int newHeight = std::max(m_height, GLYPH_ATLAS_MIN_HEIGHT);
+      while (newHeight < m_nextY)
+        newHeight *= 2;
+      m_height = newHeight;
+      m_texture.resize(static_cast<size_t>(m_width) * m_height);
+      m_reset = true;
+    }
+  }
+
+  u = best->x;
+  v = best->y;
+  best->x += width;
+  return true;
+}
+
+void CGlyphAtlas::MarkDirty(int y, int height)
+{
+  for (SRows& rows : m_dirtyRows)
+  {
+    if (y + height >= rows.y && y <= rows.y + rows.height)
+    {
+      const int end = std::max(rows.y + rows.height, y + height);
+      rows.y = std::min(rows.y, y);
+      rows.height = end - rows.y;
+      return;
+    }
+  }
+  m_dirtyRows.push_back({y, height});
+}
+
+void CGlyphAtlas::Reset()
+{
+  m_glyphs.clear();
+  m_shelves.clear();
+  m_dirtyRows.clear();
+  m_nextY = 0;
+  std::fill(m_texture.begin(), m_texture.end(), 0);
+  m_reset = true;
+}
+
 int GetStereoscopicDepth()
 {
   int depth = 0;
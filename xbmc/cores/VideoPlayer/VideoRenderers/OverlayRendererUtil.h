@@ -10,6 +10,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <unordered_map>
 #include <vector>
 
 class CDVDOverlayImage;
@@ -45,6 +46,81 @@ void convert_rgba(const CDVDOverlaySpu& o,
                   int& max_y,
                   std::vector<uint32_t>& rgba);
 bool convert_quad(ASS_Image* images, SQuads& quads, int max_x);
+
+/*!
+ * \brief Alpha texture of the glyph bitmaps of libass, kept between subtitle changes.
+ *
+ * libass hands out the same bitmap for a glyph as long as it looks the same, also when it moved
+ * or changed its color, the colors are in the quads. The atlas keeps the bitmaps it placed
+ * before, copies only new ones in and records the rows it changed, so only those need to be
+ * uploaded. When it is full it starts over with the bitmaps of the change.
+ */
+class CGlyphAtlas
+{
+public:
+  struct SRows
+  {
+    int y;
+    int height;
+  };
+
+  explicit CGlyphAtlas(int width) : m_width(width) {}
+
+  /*!
+   * \brief Place the images in the atlas
+   * \param images the images of libass
+   * \param quads [out] the quads rendering the images from the atlas
+   * \return false if none of the images is shown
+   */
+  bool Update(ASS_Image* images, std::vector<SQuad>& quads);
+
+  int Width() const { return m_width; }
+  int Height() const { return m_height; }
+  const uint8_t* Data() const { return m_texture.data(); }
+
+  /*!
+   * \brief Whether all of the atlas has to be uploaded, it was reset or grown
+   */
+  bool IsReset() const { return m_reset; }
+
+  /*!
+   * \brief The rows that changed since the last upload, full width
+   */
+  const std::vector<SRows>& GetDirtyRows() const { return m_dirtyRows; }
+
+  void SetUploaded();
+
+private:
+  struct SGlyph
+  {
+    int w;
+    int h;
+    int u;
+    int v;
+  };
+
+  struct SShelf
+  {
+    int y;
+    int height;
+    int x;
+  };
+
+  bool Place(ASS_Image* images, std::vector<SQuad>& quads, bool limitHeight);
+  const SGlyph* GetGlyph(const ASS_Image& image, bool limitHeight);
+  bool Allocate(int w, int h, bool limitHeight, int& u, int& v);
+  void MarkDirty(int y, int height);
+  void Reset();
+
+  const int m_width;
+  int m_height{0};
+  int m_nextY{0};
+  std::vector<uint8_t> m_texture;
+  std::vector<SShelf> m_shelves;
+  std::unordered_map<const unsigned char*, SGlyph> m_glyphs;
+  std::vector<SRows> m_dirtyRows;
+  bool m_reset{true};
+};
 int GetStereoscopicDepth();
 
 } // namespace OVERLAY
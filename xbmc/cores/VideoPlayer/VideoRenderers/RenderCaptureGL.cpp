@@ -28,6 +28,9 @@ CRenderCaptureGL::~CRenderCaptureGL()
 
     if (m_query)
       glDeleteQueries(1, &m_query);
+
+    if (m_fence)
+      glDeleteSync(m_fence);
   }
 
   delete[] m_pixels;
@@ -40,7 +43,13 @@ void CRenderCaptureGL::BeginRender()
     unsigned int major, minor, glversion;
     CServiceBroker::GetRenderSystem()->GetRenderVersion(major, minor);
     glversion = 10 * major + minor;
-    if (glversion >= 21)
+    if (glversion >= 32)
+    {
+      m_asyncSupported = true;
+      m_occlusionQuerySupported = true;
+      m_fenceSupported = true;
+    }
+    else if (glversion >= 21)
     {
       m_asyncSupported = true;
       m_occlusionQuerySupported = true;
@@ -63,7 +72,7 @@ void CRenderCaptureGL::BeginRender()
         CLog::Log(
             LOGWARNING,
             "CRenderCaptureGL: GL_ARB_pixel_buffer_object not supported, performance might suffer");
-      if (!UseOcclusionQuery())
+      if (!m_fenceSupported && !UseOcclusionQuery())
         CLog::Log(LOGWARNING,
                   "CRenderCaptureGL: GL_ARB_occlusion_query disabled, performance might suffer");
     }
@@ -76,7 +85,13 @@ void CRenderCaptureGL::BeginRender()
     if (!m_pbo)
       glGenBuffers(1, &m_pbo);
 
-    if (UseOcclusionQuery() && m_occlusionQuerySupported)
+    if (m_fence)
+    {
+      glDeleteSync(m_fence);
+      m_fence = nullptr;
+    }
+
+    if (!m_fenceSupported && UseOcclusionQuery() && m_occlusionQuerySupported)
     {
       //generate an occlusion query if we don't have one
       if (!m_query)
@@ -126,6 +141,11 @@ void CRenderCaptureGL::EndRender()
     if (m_query)
       glEndQuery(GL_SAMPLES_PASSED);
 
+    // a fence tells exactly when the read into the pbo is done, the readout polls it without
+    // stalling the render thread
+    if (m_fenceSupported && !(m_flags & CAPTUREFLAG_IMMEDIATELY))
+      m_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
     if (m_flags & CAPTUREFLAG_IMMEDIATELY)
       PboToBuffer();
     else
@@ -158,7 +178,13 @@ void CRenderCaptureGL::ReadOut()
     //so it can be mapped and read without a busy wait
 
     GLuint readout = 1;
-    if (m_query)
+    if (m_fence)
+    {
+      const GLenum status = glClientWaitSync(m_fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+      readout = status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED ||
+                status == GL_WAIT_FAILED;
+    }
+    else if (m_query)
       glGetQueryObjectuiv(m_query, GL_QUERY_RESULT_AVAILABLE, &readout);
 
     if (readout)
@@ -28,5 +28,7 @@ private:
   void PboToBuffer();
   GLuint m_pbo{0};
   GLuint m_query{0};
+  GLsync m_fence{nullptr};
   bool m_occlusionQuerySupported{false};
+  bool m_fenceSupported{false};
 };
@@ -8,22 +8,151 @@
 
 #include "RenderCaptureGLES.h"
 
+#include "ServiceBroker.h"
+#include "cores/IPlayer.h"
+#include "rendering/RenderSystem.h"
+#include "utils/log.h"
+
+#include <cstring>
+#include <utility>
+
 CRenderCaptureGLES::~CRenderCaptureGLES()
 {
+#if HAS_GLES == 3
+  if (m_pbo)
+    glDeleteBuffers(1, &m_pbo);
+
+  if (m_fence)
+    glDeleteSync(m_fence);
+#endif
+
   delete[] m_pixels;
 }
 
 void CRenderCaptureGLES::BeginRender()
 {
+  if (!m_asyncChecked)
+  {
+#if HAS_GLES == 3
+    unsigned int major, minor;
+    CServiceBroker::GetRenderSystem()->GetRenderVersion(major, minor);
+    m_asyncSupported = major >= 3;
+#endif
+    if (!m_asyncSupported && (m_flags & CAPTUREFLAG_CONTINUOUS))
+      CLog::Log(LOGWARNING,
+                "CRenderCaptureGLES: pixel buffer objects need GLES 3.0, performance might suffer");
+
+    m_asyncChecked = true;
+  }
+
   if (m_bufferSize != m_width * m_height * 4)
   {
     delete[] m_pixels;
     m_bufferSize = m_width * m_height * 4;
     m_pixels = new uint8_t[m_bufferSize];
+
+#if HAS_GLES == 3
+    if (m_asyncSupported)
+    {
+      if (!m_pbo)
+        glGenBuffers(1, &m_pbo);
+
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pbo);
+      glBufferData(GL_PIXEL_PACK_BUFFER, m_bufferSize, nullptr, GL_STREAM_READ);
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+#endif
   }
+
+#if HAS_GLES == 3
+  if (m_asyncSupported)
+  {
+    if (m_fence)
+    {
+      glDeleteSync(m_fence);
+      m_fence = nullptr;
+    }
+
+    // glReadPixels() writes into the pbo
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pbo);
+  }
+#endif
 }
 
 void CRenderCaptureGLES::EndRender()
 {
+#if HAS_GLES == 3
+  if (m_asyncSupported)
+  {
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    if (m_flags & CAPTUREFLAG_IMMEDIATELY)
+      PboToBuffer();
+    else
+    {
+      // the readout polls the fence, the render thread doesn't wait for the read
+      m_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+      SetState(CAPTURESTATE_NEEDSREADOUT);
+    }
+    return;
+  }
+#endif
+
+  SwapRedBlue(m_pixels);
   SetState(CAPTURESTATE_DONE);
 }
+
+void* CRenderCaptureGLES::GetRenderBuffer()
+{
+  if (m_asyncSupported)
+    return nullptr; //offset into the pbo
+
+  return m_pixels;
+}
+
+void CRenderCaptureGLES::ReadOut()
+{
+#if HAS_GLES == 3
+  if (!m_asyncSupported)
+    return;
+
+  if (m_fence)
+  {
+    const GLenum status = glClientWaitSync(m_fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    if (status == GL_TIMEOUT_EXPIRED)
+      return;
+  }
+
+  PboToBuffer();
+#endif
+}
+
+void CRenderCaptureGLES::PboToBuffer()
+{
+#if HAS_GLES == 3
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pbo);
+  const void* pboPtr = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, m_bufferSize, GL_MAP_READ_BIT);
+
+  if (pboPtr)
+  {
+    std::memcpy(m_pixels, pboPtr, m_bufferSize);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    SwapRedBlue(m_pixels);
+    SetState(CAPTURESTATE_DONE);
+  }
+  else
+  {
+    CLog::Log(LOGERROR, "CRenderCaptureGLES::PboToBuffer: glMapBufferRange failed");
+    SetState(CAPTURESTATE_FAILED);
+  }
+
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+}
+
+void CRenderCaptureGLES::SwapRedBlue(uint8_t* pixels) const
+{
+  // OpenGLES returns in RGBA order but CRenderCapture needs BGRA order
+  for (unsigned int i = 0; i < m_width * m_height; i++, pixels += 4)
+    std::swap(pixels[0], pixels[2]);
+}
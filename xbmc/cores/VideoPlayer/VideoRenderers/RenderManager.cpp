@@ -15,23 +15,43 @@
 #include "RenderFlags.h"
 #include "ServiceBroker.h"
 #include "application/Application.h"
+#include "cores/DataCacheCore.h"
 #include "cores/VideoPlayer/Interface/TimingConstants.h"
 #include "messaging/ApplicationMessenger.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "threads/SingleLock.h"
+#include "utils/MemUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/XTimeUtils.h"
 #include "utils/log.h"
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <mutex>
 
 using namespace std::chrono_literals;
 
+namespace
+{
+constexpr int QUEUE_DEPTH_MIN = 3;
+constexpr int QUEUE_DEPTH_LOW_MEMORY = 3;
+constexpr int QUEUE_CONTROL_WINDOW = 100; // flips between two decisions
+constexpr int QUEUE_CONTROL_CLEAN_WINDOWS = 5; // smooth windows before the queue gets shorter
+constexpr double QUEUE_CONTROL_MAX_JITTER = 0.5; // in display frames
+
+bool IsMemoryTight()
+{
+  KODI::MEMORY::MemoryStatus status{};
+  KODI::MEMORY::GetMemoryStatus(&status);
+  return status.totalPhys > 0 && status.availPhys < status.totalPhys / 10;
+}
+} // unnamed namespace
+
 void CRenderManager::CClockSync::Reset()
 {
   m_error = 0;
@@ -40,6 +60,18 @@ void CRenderManager::CClockSync::Reset()
   m_enabled = false;
 }
 
+void CRenderManager::CQueueControl::Reset(int maxDepth, bool lowLatency)
+{
+  m_maxDepth = maxDepth;
+  m_lowLatency = lowLatency;
+  m_depth = lowLatency ? std::min(QUEUE_DEPTH_MIN, maxDepth) : maxDepth;
+  m_errorMean = 0;
+  m_jitter = 0;
+  m_frames = 0;
+  m_troubles = 0;
+  m_cleanWindows = 0;
+}
+
 unsigned int CRenderManager::m_nextCaptureId = 0;
 
 CRenderManager::CRenderManager(CDVDClock &clock, IRenderMsg *player) :
@@ -203,6 +235,14 @@ bool CRenderManager::Configure()
     if (m_NumberBuffers > 0)
       m_QueueSize = std::min(m_NumberBuffers, renderbuffers);
 
+    // every buffer holds a picture in the renderer, allocate less of them when memory is tight
+    if (m_QueueSize > QUEUE_DEPTH_LOW_MEMORY && IsMemoryTight())
+    {
+      CLog::Log(LOGDEBUG, "CRenderManager::Configure - memory is tight, limit queue size to {}",
+                QUEUE_DEPTH_LOW_MEMORY);
+      m_QueueSize = QUEUE_DEPTH_LOW_MEMORY;
+    }
+
     if(m_QueueSize < 2)
     {
       m_QueueSize = 2;
@@ -234,13 +274,15 @@ bool CRenderManager::Configure()
     m_renderedDebugOverlay = false;
     m_renderDebug = false;
     m_clockSync.Reset();
+    m_queueControl.Reset(m_QueueSize, m_playerPort->IsRealtimeStream());
     m_dvdClock.SetVsyncAdjust(0);
     m_overlays.Reset();
     m_overlays.SetStereoMode(m_picture.stereoMode);
 
     m_renderState = STATE_CONFIGURED;
 
-    CLog::Log(LOGDEBUG, "CRenderManager::Configure - {}", m_QueueSize);
+    CLog::Log(LOGDEBUG, "CRenderManager::Configure - {}, depth {}", m_QueueSize,
+              m_queueControl.m_depth);
   }
   else
     m_renderState = STATE_UNCONFIGURED;
@@ -727,6 +769,8 @@ void CRenderManager::Render(bool clear, DWORD flags, DWORD alpha, bool gui)
   if (!gui || m_pRenderer->IsGuiLayer())
   {
     SPresent& m = m_Queue[m_presentsource];
+    CFrameTimeline& timeline = CServiceBroker::GetDataCacheCore().GetFrameTimeline();
+    const int64_t start = timeline.IsEnabled() ? CFrameTimeline::Now() : 0;
 
     if( m.presentmethod == PRESENT_METHOD_BOB )
       PresentFields(clear, flags, alpha);
@@ -734,6 +778,9 @@ void CRenderManager::Render(bool clear, DWORD flags, DWORD alpha, bool gui)
       PresentBlend(clear, flags, alpha);
     else
       PresentSingle(clear, flags, alpha);
+
+    if (start)
+      timeline.Record(FrameStage::PRESENT, m.pts, CFrameTimeline::Now() - start);
   }
 
   if (gui)
@@ -957,7 +1004,7 @@ bool CRenderManager::AddVideoPicture(const VideoPicture& picture, volatile std::
 {
   std::unique_lock lock(m_presentlock);
 
-  if (m_free.empty())
+  if (!HasFreeBuffer())
     return false;
 
   int index = m_free.front();
@@ -1015,6 +1062,8 @@ bool CRenderManager::AddVideoPicture(const VideoPicture& picture, volatile std::
   m.presentfield = displayField;
   m.presentmethod = presentmethod;
   m.pts = picture.pts;
+  CServiceBroker::GetDataCacheCore().GetFrameTimeline().Record(FrameStage::RENDER_QUEUE,
+                                                               picture.pts);
   m_queued.push_back(m_free.front());
   m_free.pop_front();
   m_playerPort->UpdateRenderBuffers(m_queued.size(), m_discard.size(), m_free.size());
@@ -1053,7 +1102,7 @@ void CRenderManager::AddOverlay(std::shared_ptr<CDVDOverlay> o, double pts)
   int idx;
   {
     std::unique_lock lock(m_presentlock);
-    if (m_free.empty())
+    if (!HasFreeBuffer())
       return;
     idx = m_free.front();
   }
@@ -1109,7 +1158,7 @@ int CRenderManager::WaitForBuffer(volatile std::atomic_bool& bStop,
   }
 
   XbmcThreads::EndTime<> endtime{timeout};
-  while(m_free.empty())
+  while (!HasFreeBuffer())
   {
     m_presentevent.wait(lock, std::min(50ms, timeout));
     if (endtime.IsTimePast() || bStop)
@@ -1209,13 +1258,18 @@ void CRenderManager::PrepareNextRender()
       ++iter;
     }
 
+    CFrameTimeline& timeline = CServiceBroker::GetDataCacheCore().GetFrameTimeline();
+
     // skip late frames
+    int skipped = 0;
     while (m_queued.front() != idx)
     {
       if (m_presentsourcePast >= 0)
       {
         m_discard.push_back(m_presentsourcePast);
         m_QueueSkip++;
+        skipped++;
+        timeline.Record(FrameStage::SKIP, m_Queue[m_presentsourcePast].pts);
       }
       m_presentsourcePast = m_queued.front();
       m_queued.pop_front();
@@ -1228,12 +1282,15 @@ void CRenderManager::PrepareNextRender()
     else
       m_lateframes = 0;
 
+    UpdateQueueDepth(renderPts - m_Queue[idx].pts, frametime, skipped + (lateframes > 0 ? 1 : 0));
+
     m_presentstep = PRESENT_FLIP;
     m_discard.push_back(m_presentsource);
     m_presentsource = idx;
     m_queued.pop_front();
     m_presentpts = m_Queue[idx].pts - m_displayLatency;
     m_presentevent.notifyAll();
+    timeline.Record(FrameStage::FLIP, m_Queue[idx].pts);
 
     m_playerPort->UpdateRenderBuffers(m_queued.size(), m_discard.size(), m_free.size());
   }
@@ -1246,6 +1303,8 @@ void CRenderManager::PrepareNextRender()
     m_queued.pop_front();
     m_presentpts = m_Queue[m_presentsource].pts - m_displayLatency - frametime / 2;
     m_presentevent.notifyAll();
+    CServiceBroker::GetDataCacheCore().GetFrameTimeline().Record(FrameStage::FLIP,
+                                                                 m_Queue[m_presentsource].pts);
   }
 }
 
@@ -1264,6 +1323,57 @@ void CRenderManager::DiscardBuffer()
   m_presentevent.notifyAll();
 }
 
+bool CRenderManager::HasFreeBuffer() const
+{
+  return !m_free.empty() &&
+         static_cast<int>(m_queued.size() + m_discard.size()) + 1 < m_queueControl.m_depth;
+}
+
+void CRenderManager::UpdateQueueDepth(double error, double frametime, int skipped)
+{
+  CQueueControl& control = m_queueControl;
+  if (frametime <= 0)
+    return;
+
+  error /= frametime;
+  control.m_errorMean += (error - control.m_errorMean) * 0.05;
+  control.m_jitter += (std::abs(error - control.m_errorMean) - control.m_jitter) * 0.05;
+  control.m_troubles += skipped;
+  if (++control.m_frames < QUEUE_CONTROL_WINDOW)
+    return;
+
+  const int depth = control.m_depth;
+  const bool troubled = control.m_troubles > 0 || control.m_jitter > QUEUE_CONTROL_MAX_JITTER;
+  control.m_lowLatency = m_playerPort->IsRealtimeStream();
+
+  if (IsMemoryTight())
+  {
+    control.m_depth--;
+    control.m_cleanWindows = 0;
+  }
+  else if (troubled)
+  {
+    control.m_depth++;
+    control.m_cleanWindows = 0;
+  }
+  else if (++control.m_cleanWindows >= QUEUE_CONTROL_CLEAN_WINDOWS)
+  {
+    // realtime streams run with the shortest queue that plays smooth, others with the full one
+    control.m_depth += control.m_lowLatency ? -1 : 1;
+    control.m_cleanWindows = 0;
+  }
+
+  control.m_depth = std::clamp(control.m_depth, std::min(QUEUE_DEPTH_MIN, control.m_maxDepth),
+                               control.m_maxDepth);
+  if (control.m_depth != depth)
+    CLog::Log(LOGDEBUG,
+              "CRenderManager::UpdateQueueDepth - depth {} -> {}, troubles: {}, jitter: {:.2f}",
+              depth, control.m_depth, control.m_troubles, control.m_jitter);
+
+  control.m_frames = 0;
+  control.m_troubles = 0;
+}
+
 bool CRenderManager::GetStats(int &lateframes, double &pts, int &queued, int &discard)
 {
   std::unique_lock lock(m_presentlock);
@@ -50,6 +50,7 @@ protected:
   virtual void UpdateGuiRender(bool gui) = 0;
   virtual void UpdateVideoRender(bool video) = 0;
   virtual CVideoSettings GetVideoSettings() const = 0;
+  virtual bool IsRealtimeStream() const = 0;
 };
 
 class CRenderManager
@@ -153,6 +154,8 @@ protected:
 
   void UpdateLatencyTweak();
   void CheckEnableClockSync();
+  bool HasFreeBuffer() const;
+  void UpdateQueueDepth(double error, double frametime, int skipped);
 
   CBaseRenderer *m_pRenderer = nullptr;
   OVERLAY::CRenderer m_overlays;
@@ -244,6 +247,27 @@ protected:
   };
   CClockSync m_clockSync;
 
+  /*!
+   * \brief Controls how many of the render buffers the player may fill
+   *
+   * The depth starts at the full queue, or small for realtime streams. It grows while frames are
+   * skipped, late or presented with a high jitter, and shrinks when memory is tight or, for
+   * realtime streams, after a while of smooth playback to keep the latency low.
+   */
+  struct CQueueControl
+  {
+    void Reset(int maxDepth, bool lowLatency);
+    int m_depth = NUM_BUFFERS; ///< max queued and unreleased buffers plus the presented one
+    int m_maxDepth = NUM_BUFFERS;
+    bool m_lowLatency = false;
+    double m_errorMean = 0; ///< moving average of the presentation error in display frames
+    double m_jitter = 0; ///< moving average of the deviation from m_errorMean
+    int m_frames = 0;
+    int m_troubles = 0; ///< skipped and late frames in the current window
+    int m_cleanWindows = 0;
+  };
+  CQueueControl m_queueControl;
+
   void RenderCapture(CRenderCapture* capture);
   void RemoveCaptures();
   CCriticalSection m_captCritSect;
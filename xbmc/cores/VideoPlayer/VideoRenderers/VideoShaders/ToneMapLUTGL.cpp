@@ -0,0 +1,265 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ToneMapLUTGL.h"
+
+#include "utils/GLUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+using namespace Shaders::GL;
+
+namespace
+{
+// the constants and curves of gl_tonemap.glsl
+constexpr float ST2084_m1 = 2610.0f / (4096.0f * 4.0f);
+constexpr float ST2084_m2 = (2523.0f / 4096.0f) * 128.0f;
+constexpr float ST2084_c1 = 3424.0f / 4096.0f;
+constexpr float ST2084_c2 = (2413.0f / 4096.0f) * 32.0f;
+constexpr float ST2084_c3 = (2392.0f / 4096.0f) * 32.0f;
+
+float InversePQ(float x)
+{
+  x = std::pow(std::max(x, 0.0f), 1.0f / ST2084_m2);
+  x = std::max(x - ST2084_c1, 0.0f) / (ST2084_c2 - ST2084_c3 * x);
+  return std::pow(x, 1.0f / ST2084_m1);
+}
+
+float Reinhard(float x, float p1)
+{
+  return x * (1.0f + x / (p1 * p1)) / (1.0f + x);
+}
+
+float Aces(float x)
+{
+  constexpr float A = 2.51f;
+  constexpr float B = 0.03f;
+  constexpr float C = 2.43f;
+  constexpr float D = 0.59f;
+  constexpr float E = 0.14f;
+  return (x * (A * x + B)) / (x * (C * x + D) + E);
+}
+
+float Hable(float x)
+{
+  constexpr float A = 0.15f;
+  constexpr float B = 0.5f;
+  constexpr float C = 0.1f;
+  constexpr float D = 0.2f;
+  constexpr float E = 0.02f;
+  constexpr float F = 0.3f;
+  return ((x * (A * x + C * B) + D * E) / (x * (A * x + B) + D * F)) - E / F;
+}
+} // unnamed namespace
+
+bool CToneMapLUT::Params::operator==(const Params& other) const
+{
+  return method == other.method && toneP1 == other.toneP1 && luminance == other.luminance &&
+         gammaSrc == other.gammaSrc && gammaDstInv == other.gammaDstInv &&
+         primMat == other.primMat && coefs == other.coefs;
+}
+
+CToneMapLUT::~CToneMapLUT()
+{
+  Free();
+}
+
+void CToneMapLUT::Free()
+{
+  if (m_texture)
+  {
+    glDeleteTextures(1, &m_texture);
+    m_texture = 0;
+  }
+  m_valid = false;
+}
+
+void CToneMapLUT::SetCalibration(const uint16_t* data, int size)
+{
+  if (data)
+  {
+    m_calibration.assign(data, data + size * size * size * 3);
+    m_calibrationSize = size;
+  }
+  else
+  {
+    m_calibration.clear();
+    m_calibrationSize = 0;
+  }
+  m_valid = false;
+}
+
+void CToneMapLUT::EnableCalibration(bool enable)
+{
+  if (enable != m_calibrationEnabled)
+  {
+    m_calibrationEnabled = enable;
+    m_valid = false;
+  }
+}
+
+bool CToneMapLUT::Bind(const Params& params)
+{
+  if (!m_valid || params != m_params)
+  {
+    m_params = params;
+    Build();
+  }
+
+  if (!m_valid)
+    return false;
+
+  glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT);
+  glBindTexture(GL_TEXTURE_3D, m_texture);
+  glActiveTexture(GL_TEXTURE0);
+  return true;
+}
+
+void CToneMapLUT::Build()
+{
+  const auto start = std::chrono::steady_clock::now();
+
+  const bool calibrate = m_calibrationEnabled && !m_calibration.empty();
+  std::vector<uint16_t> data(LUT_SIZE * LUT_SIZE * LUT_SIZE * 3);
+  uint16_t* out = data.data();
+  for (int b = 0; b < LUT_SIZE; ++b)
+  {
+    for (int g = 0; g < LUT_SIZE; ++g)
+    {
+      for (int r = 0; r < LUT_SIZE; ++r)
+      {
+        float rgb[3] = {static_cast<float>(r) / (LUT_SIZE - 1),
+                        static_cast<float>(g) / (LUT_SIZE - 1),
+                        static_cast<float>(b) / (LUT_SIZE - 1)};
+        Evaluate(rgb);
+        if (calibrate)
+          Calibrate(rgb);
+        for (float value : rgb)
+          *out++ = static_cast<uint16_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 65535.0f));
+      }
+    }
+  }
+
+  if (!m_texture)
+    glGenTextures(1, &m_texture);
+  if (!m_texture)
+  {
+    CLog::Log(LOGERROR, "CToneMapLUT::Build - error creating the LUT texture");
+    return;
+  }
+
+  glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT);
+  glBindTexture(GL_TEXTURE_3D, m_texture);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+  glTexImage3D(GL_TEXTURE_3D, 0, GL_RGB16, LUT_SIZE, LUT_SIZE, LUT_SIZE, 0, GL_RGB,
+               GL_UNSIGNED_SHORT, data.data());
+  glActiveTexture(GL_TEXTURE0);
+  VerifyGLState();
+
+  m_valid = true;
+  CLog::Log(LOGDEBUG, "CToneMapLUT::Build - method {}, luminance {}, calibration {}, took {} ms",
+            static_cast<int>(m_params.method), m_params.luminance, calibrate,
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start)
+                .count());
+}
+
+void CToneMapLUT::Evaluate(float (&rgb)[3]) const
+{
+  // same steps as the XBMC_COL_CONVERSION block of the YUV2RGB shaders, the matrix is applied
+  // the way GL reads the uploaded raw data
+  float lin[3];
+  for (int i = 0; i < 3; ++i)
+    lin[i] = std::pow(std::max(rgb[i], 0.0f), m_params.gammaSrc);
+  for (int i = 0; i < 3; ++i)
+  {
+    const float value = m_params.primMat[0][i] * lin[0] + m_params.primMat[1][i] * lin[1] +
+                        m_params.primMat[2][i] * lin[2];
+    rgb[i] = std::pow(std::max(value, 0.0f), m_params.gammaDstInv);
+  }
+
+  switch (m_params.method)
+  {
+    case VS_TONEMAPMETHOD_REINHARD:
+    {
+      const float luma =
+          rgb[0] * m_params.coefs[0] + rgb[1] * m_params.coefs[1] + rgb[2] * m_params.coefs[2];
+      if (luma <= 0.0f)
+        break;
+      const float scale = Reinhard(luma, m_params.toneP1) / luma;
+      for (float& value : rgb)
+        value *= scale;
+      break;
+    }
+    case VS_TONEMAPMETHOD_ACES:
+    {
+      const float scale = (10000.0f / m_params.luminance) * (2.0f / m_params.toneP1);
+      for (float& value : rgb)
+      {
+        value = Aces(InversePQ(value) * scale) * (1.24f / m_params.toneP1);
+        value = std::pow(std::max(value, 0.0f), 0.27f);
+      }
+      break;
+    }
+    case VS_TONEMAPMETHOD_HABLE:
+    {
+      const float wp = m_params.luminance / 100.0f;
+      const float white = Hable(wp);
+      for (float& value : rgb)
+      {
+        value = Hable(InversePQ(value) * m_params.toneP1 * wp) / white;
+        value = std::pow(std::max(value, 0.0f), 1.0f / 2.2f);
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void CToneMapLUT::Calibrate(float (&rgb)[3]) const
+{
+  // trilinear lookup, matching the sampling of the separate CMS pass
+  const int size = m_calibrationSize;
+  int index0[3];
+  int index1[3];
+  float frac[3];
+  for (int i = 0; i < 3; ++i)
+  {
+    const float pos = std::clamp(rgb[i], 0.0f, 1.0f) * (size - 1);
+    index0[i] = std::min(static_cast<int>(pos), size - 1);
+    index1[i] = std::min(index0[i] + 1, size - 1);
+    frac[i] = pos - index0[i];
+  }
+
+  auto sample = [this, size](int r, int g, int b, int channel)
+  { return m_calibration[((b * size + g) * size + r) * 3 + channel] / 65535.0f; };
+
+  for (int c = 0; c < 3; ++c)
+  {
+    const float c00 = sample(index0[0], index0[1], index0[2], c) * (1.0f - frac[0]) +
+                      sample(index1[0], index0[1], index0[2], c) * frac[0];
+    const float c10 = sample(index0[0], index1[1], index0[2], c) * (1.0f - frac[0]) +
+                      sample(index1[0], index1[1], index0[2], c) * frac[0];
+    const float c01 = sample(index0[0], index0[1], index1[2], c) * (1.0f - frac[0]) +
+                      sample(index1[0], index0[1], index1[2], c) * frac[0];
+    const float c11 = sample(index0[0], index1[1], index1[2], c) * (1.0f - frac[0]) +
+                      sample(index1[0], index1[1], index1[2], c) * frac[0];
+    const float c0 = c00 * (1.0f - frac[1]) + c10 * frac[1];
+    const float c1 = c01 * (1.0f - frac[1]) + c11 * frac[1];
+    rgb[c] = c0 * (1.0f - frac[2]) + c1 * frac[2];
+  }
+}
@@ -0,0 +1,91 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "ConversionMatrix.h"
+#include "cores/VideoSettings.h"
+
+#include <stdint.h>
+#include <vector>
+
+#include "system_gl.h"
+
+namespace Shaders
+{
+namespace GL
+{
+
+/*!
+ * \brief 3D LUT doing the whole HDR to SDR path of the YUV2RGB shaders in one lookup
+ *
+ * The LUT is indexed by the non-linear RGB of the source and holds the linearization, the gamut
+ * conversion, the tone mapping and, if set, the display calibration of the color manager. It is
+ * only rebuilt when the parameters change, which happens with new HDR metadata or settings, so
+ * the per pixel cost of the tone mapping shrinks to a single texture fetch.
+ */
+class CToneMapLUT
+{
+public:
+  struct Params
+  {
+    ETONEMAPMETHOD method{VS_TONEMAPMETHOD_OFF};
+    float toneP1{1.0f};
+    float luminance{100.0f};
+    float gammaSrc{1.0f};
+    float gammaDstInv{1.0f};
+    Matrix3 primMat;
+    Matrix3x1 coefs{};
+
+    bool operator==(const Params& other) const;
+    bool operator!=(const Params& other) const { return !(*this == other); }
+  };
+
+  static constexpr int LUT_SIZE = 64;
+  static constexpr int TEXTURE_UNIT = 6;
+
+  CToneMapLUT() = default;
+  ~CToneMapLUT();
+  CToneMapLUT(const CToneMapLUT&) = delete;
+  CToneMapLUT& operator=(const CToneMapLUT&) = delete;
+
+  /*!
+   * \brief Set the display calibration applied after the tone mapping
+   * \param data RGB 3D LUT of the color manager, nullptr to remove the calibration
+   * \param size edge length of the calibration LUT
+   */
+  void SetCalibration(const uint16_t* data, int size);
+  bool HasCalibration() const { return !m_calibration.empty(); }
+
+  /*!
+   * \brief Include the calibration in the LUT, the data is kept while it is disabled
+   */
+  void EnableCalibration(bool enable);
+
+  /*!
+   * \brief Rebuild the LUT if the parameters changed and bind it to TEXTURE_UNIT
+   * \return false if there is no valid texture
+   */
+  bool Bind(const Params& params);
+  void Free();
+
+private:
+  void Build();
+  void Evaluate(float (&rgb)[3]) const;
+  void Calibrate(float (&rgb)[3]) const;
+
+  Params m_params;
+  bool m_valid{false};
+  std::vector<uint16_t> m_calibration;
+  int m_calibrationSize{0};
+  bool m_calibrationEnabled{false};
+  GLuint m_texture{0};
+};
+
+} // namespace GL
+} // namespace Shaders
@@ -35,7 +35,8 @@ BaseYUV2RGBGLSLShader::BaseYUV2RGBGLSLShader(bool rect,
                                              AVColorPrimaries srcPrimaries,
                                              bool toneMap,
                                              ETONEMAPMETHOD toneMapMethod,
-                                             std::shared_ptr<GLSLOutput> output)
+                                             std::shared_ptr<GLSLOutput> output,
+                                             std::shared_ptr<CToneMapLUT> toneMapLUT)
 {
   m_width = 1;
   m_height = 1;
@@ -96,7 +97,13 @@ BaseYUV2RGBGLSLShader::BaseYUV2RGBGLSLShader(bool rect,
     m_toneMapping = true;
     m_toneMappingMethod = toneMapMethod;
     m_defines += "#define XBMC_TONE_MAPPING\n";
-    if (toneMapMethod == VS_TONEMAPMETHOD_REINHARD)
+    // the LUT replaces the whole color conversion, it's only worth it when tone mapping
+    if (toneMapLUT && m_colorConversion)
+    {
+      m_toneMapLUT = std::move(toneMapLUT);
+      m_defines += "#define KODI_TONE_MAPPING_LUT\n";
+    }
+    else if (toneMapMethod == VS_TONEMAPMETHOD_REINHARD)
       m_defines += "#define KODI_TONE_MAPPING_REINHARD\n";
     else if (toneMapMethod == VS_TONEMAPMETHOD_ACES)
       m_defines += "#define KODI_TONE_MAPPING_ACES\n";
@@ -141,6 +148,7 @@ void BaseYUV2RGBGLSLShader::OnCompiledAndLinked()
   m_hCoefsDst = glGetUniformLocation(ProgramHandle(), "m_coefsDst");
   m_hToneP1 = glGetUniformLocation(ProgramHandle(), "m_toneP1");
   m_hLuminance = glGetUniformLocation(ProgramHandle(), "m_luminance");
+  m_hToneLUT = glGetUniformLocation(ProgramHandle(), "m_toneLUT");
   VerifyGLState();
 
   if (m_glslOutput)
@@ -166,12 +174,24 @@ bool BaseYUV2RGBGLSLShader::OnEnabled()
   glUniformMatrix4fv(m_hModel, 1, GL_FALSE, m_model);
   glUniform1f(m_hAlpha, m_alpha);
 
+  CToneMapLUT::Params lutParams;
+  lutParams.method = m_toneMappingMethod;
+
   if (m_colorConversion)
   {
     Matrix3 primMat = m_convMatrix.GetPrimMat();
-    glUniformMatrix3fv(m_hPrimMat, 1, GL_FALSE, reinterpret_cast<GLfloat*>(primMat.ToRaw()));
-    glUniform1f(m_hGammaSrc, m_convMatrix.GetGammaSrc());
-    glUniform1f(m_hGammaDstInv, 1 / m_convMatrix.GetGammaDst());
+    if (m_toneMapLUT)
+    {
+      lutParams.primMat = primMat;
+      lutParams.gammaSrc = m_convMatrix.GetGammaSrc();
+      lutParams.gammaDstInv = 1 / m_convMatrix.GetGammaDst();
+    }
+    else
+    {
+      glUniformMatrix3fv(m_hPrimMat, 1, GL_FALSE, reinterpret_cast<GLfloat*>(primMat.ToRaw()));
+      glUniform1f(m_hGammaSrc, m_convMatrix.GetGammaSrc());
+      glUniform1f(m_hGammaDstInv, 1 / m_convMatrix.GetGammaDst());
+    }
   }
 
   if (m_toneMapping)
@@ -191,23 +211,34 @@ bool BaseYUV2RGBGLSLShader::OnEnabled()
       param *= m_toneMappingParam;
 
       Matrix3x1 coefs = m_convMatrix.GetRGBYuvCoefs(AVColorSpace::AVCOL_SPC_BT709);
-      glUniform3f(m_hCoefsDst, coefs[0], coefs[1], coefs[2]);
-      glUniform1f(m_hToneP1, param);
+      lutParams.coefs = coefs;
+      lutParams.toneP1 = param;
     }
     else if (m_toneMappingMethod == VS_TONEMAPMETHOD_ACES)
     {
-      const float lumin = CToneMappers::GetLuminanceValue(m_hasDisplayMetadata, m_displayMetadata,
-                                                          m_hasLightMetadata, m_lightMetadata);
-      glUniform1f(m_hLuminance, lumin);
-      glUniform1f(m_hToneP1, m_toneMappingParam);
+      lutParams.luminance = CToneMappers::GetLuminanceValue(
+          m_hasDisplayMetadata, m_displayMetadata, m_hasLightMetadata, m_lightMetadata);
+      lutParams.toneP1 = m_toneMappingParam;
     }
     else if (m_toneMappingMethod == VS_TONEMAPMETHOD_HABLE)
     {
-      const float lumin = CToneMappers::GetLuminanceValue(m_hasDisplayMetadata, m_displayMetadata,
-                                                          m_hasLightMetadata, m_lightMetadata);
-      const float param = (10000.0f / lumin) * (2.0f / m_toneMappingParam);
-      glUniform1f(m_hLuminance, lumin);
-      glUniform1f(m_hToneP1, param);
+      lutParams.luminance = CToneMappers::GetLuminanceValue(
+          m_hasDisplayMetadata, m_displayMetadata, m_hasLightMetadata, m_lightMetadata);
+      lutParams.toneP1 = (10000.0f / lutParams.luminance) * (2.0f / m_toneMappingParam);
+    }
+
+    // the LUT is only rebuilt when the metadata or the settings changed
+    if (m_toneMapLUT)
+    {
+      if (!m_toneMapLUT->Bind(lutParams))
+        return false;
+      glUniform1i(m_hToneLUT, CToneMapLUT::TEXTURE_UNIT);
+    }
+    else
+    {
+      glUniform3f(m_hCoefsDst, lutParams.coefs[0], lutParams.coefs[1], lutParams.coefs[2]);
+      glUniform1f(m_hToneP1, lutParams.toneP1);
+      glUniform1f(m_hLuminance, lutParams.luminance);
     }
   }
 
@@ -276,7 +307,8 @@ YUV2RGBProgressiveShader::YUV2RGBProgressiveShader(bool rect,
                                                    bool toneMap,
                                                    ETONEMAPMETHOD toneMapMethod,
                                                    std::shared_ptr<GLSLOutput> output,
-                                                   bool gammaCorrection)
+                                                   bool gammaCorrection,
+                                                   std::shared_ptr<CToneMapLUT> toneMapLUT)
   : BaseYUV2RGBGLSLShader(rect,
                           format,
                           stretch,
@@ -284,7 +316,8 @@ YUV2RGBProgressiveShader::YUV2RGBProgressiveShader(bool rect,
                           srcPrimaries,
                           toneMap,
                           toneMapMethod,
-                          std::move(output))
+                          std::move(output),
+                          std::move(toneMapLUT))
 {
   if (gammaCorrection)
     m_defines += "#define KODI_GAMMA_LINEARIZATION_FAST\n";
@@ -307,7 +340,8 @@ YUV2RGBFilterShader4::YUV2RGBFilterShader4(bool rect,
                                            bool toneMap,
                                            ETONEMAPMETHOD toneMapMethod,
                                            ESCALINGMETHOD method,
-                                           std::shared_ptr<GLSLOutput> output)
+                                           std::shared_ptr<GLSLOutput> output,
+                                           std::shared_ptr<CToneMapLUT> toneMapLUT)
   : BaseYUV2RGBGLSLShader(rect,
                           format,
                           stretch,
@@ -315,10 +349,15 @@ YUV2RGBFilterShader4::YUV2RGBFilterShader4(bool rect,
                           srcPrimaries,
                           toneMap,
                           toneMapMethod,
-                          std::move(output))
+                          std::move(output),
+                          std::move(toneMapLUT))
 {
   m_scaling = method;
-  PixelShader()->LoadSource("gl_yuv2rgb_filter4.glsl", m_defines);
+  // the full kernels have 6 taps, the fast ones fold them into 4
+  if (m_scaling == VS_SCALINGMETHOD_LANCZOS3 || m_scaling == VS_SCALINGMETHOD_SPLINE36)
+    PixelShader()->LoadSource("gl_yuv2rgb_filter6.glsl", m_defines);
+  else
+    PixelShader()->LoadSource("gl_yuv2rgb_filter4.glsl", m_defines);
   PixelShader()->AppendSource("gl_output.glsl");
 
   PixelShader()->InsertSource("gl_tonemap.glsl", "vec4 process()");
@@ -336,7 +375,8 @@ void YUV2RGBFilterShader4::OnCompiledAndLinked()
   BaseYUV2RGBGLSLShader::OnCompiledAndLinked();
   m_hKernTex = glGetUniformLocation(ProgramHandle(), "m_kernelTex");
 
-  if (m_scaling != VS_SCALINGMETHOD_LANCZOS3_FAST && m_scaling != VS_SCALINGMETHOD_SPLINE36_FAST)
+  if (m_scaling != VS_SCALINGMETHOD_LANCZOS3_FAST && m_scaling != VS_SCALINGMETHOD_SPLINE36_FAST &&
+      m_scaling != VS_SCALINGMETHOD_LANCZOS3 && m_scaling != VS_SCALINGMETHOD_SPLINE36)
   {
     CLog::Log(LOGERROR, "GL: BaseYUV2RGBGLSLShader4 - unsupported scaling {} will fallback",
               m_scaling);
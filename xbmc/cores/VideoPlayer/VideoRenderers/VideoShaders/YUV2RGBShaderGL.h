@@ -11,6 +11,7 @@
 #include "ConversionMatrix.h"
 #include "GLSLOutput.h"
 #include "ShaderFormats.h"
+#include "ToneMapLUTGL.h"
 #include "cores/VideoSettings.h"
 #include "guilib/Shader.h"
 #include "utils/TransformMatrix.h"
@@ -38,7 +39,8 @@ public:
                         AVColorPrimaries src,
                         bool toneMap,
                         ETONEMAPMETHOD toneMapMethod,
-                        std::shared_ptr<GLSLOutput> output);
+                        std::shared_ptr<GLSLOutput> output,
+                        std::shared_ptr<CToneMapLUT> toneMapLUT);
   ~BaseYUV2RGBGLSLShader() override;
 
   void SetField(int field) { m_field  = field; }
@@ -84,6 +86,7 @@ protected:
   bool m_toneMapping = false;
   ETONEMAPMETHOD m_toneMappingMethod = VS_TONEMAPMETHOD_OFF;
   float m_toneMappingParam = 1.0;
+  std::shared_ptr<CToneMapLUT> m_toneMapLUT;
 
   bool m_colorConversion{false};
 
@@ -113,6 +116,7 @@ protected:
   GLint m_hToneP1 = -1;
   GLint m_hCoefsDst = -1;
   GLint m_hLuminance = -1;
+  GLint m_hToneLUT = -1;
 
   // vertex shader attribute handles
   GLint m_hVertex = -1;
@@ -135,7 +139,8 @@ public:
                            bool toneMap,
                            ETONEMAPMETHOD toneMapMethod,
                            std::shared_ptr<GLSLOutput> output,
-                           bool gammaCorrection);
+                           bool gammaCorrection,
+                           std::shared_ptr<CToneMapLUT> toneMapLUT = nullptr);
 };
 
 class YUV2RGBFilterShader4 : public BaseYUV2RGBGLSLShader
@@ -149,7 +154,8 @@ public:
                        bool toneMap,
                        ETONEMAPMETHOD toneMapMethod,
                        ESCALINGMETHOD method,
-                       std::shared_ptr<GLSLOutput> output);
+                       std::shared_ptr<GLSLOutput> output,
+                       std::shared_ptr<CToneMapLUT> toneMapLUT = nullptr);
   ~YUV2RGBFilterShader4() override;
 
 protected:
@@ -0,0 +1,183 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxUtils.h"
+#include "cores/VideoPlayer/DVDMessage.h"
+#include "cores/VideoPlayer/DVDMessageQueue.h"
+#include "cores/VideoPlayer/Interface/DemuxPacket.h"
+#include "cores/VideoPlayer/Interface/TimingConstants.h"
+
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+std::shared_ptr<CDVDMsg> CreatePacket(int size, double dts)
+{
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(size);
+  packet->iSize = size;
+  packet->dts = dts;
+  packet->pts = dts;
+  return CDVDMsgDemuxerPacket::Create(packet);
+}
+
+double GetDts(const std::shared_ptr<CDVDMsg>& msg)
+{
+  return std::static_pointer_cast<CDVDMsgDemuxerPacket>(msg)->GetPacket()->dts;
+}
+} // namespace
+
+class TestDVDMessageQueue : public testing::TestWithParam<bool>
+{
+protected:
+  TestDVDMessageQueue()
+  {
+    if (GetParam())
+      m_queue.SetRingMode(4);
+    m_queue.SetMaxDataSize(1024 * 1024);
+    m_queue.Init();
+  }
+
+  ~TestDVDMessageQueue() override { m_queue.End(); }
+
+  CDVDMessageQueue m_queue{"test"};
+};
+
+TEST_P(TestDVDMessageQueue, FifoOrder)
+{
+  // more than the ring capacity, so the overflow lane is exercised as well
+  for (int i = 0; i < 10; ++i)
+    EXPECT_EQ(MSGQ_OK, m_queue.Put(CreatePacket(100, i * DVD_TIME_BASE)));
+
+  EXPECT_EQ(1000, m_queue.GetDataSize());
+  EXPECT_EQ(10u, m_queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET));
+
+  std::shared_ptr<CDVDMsg> msg;
+  for (int i = 0; i < 10; ++i)
+  {
+    ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms));
+    EXPECT_EQ(i * DVD_TIME_BASE, GetDts(msg));
+  }
+  EXPECT_EQ(MSGQ_TIMEOUT, m_queue.Get(msg, 0ms));
+  EXPECT_EQ(0, m_queue.GetDataSize());
+}
+
+TEST_P(TestDVDMessageQueue, PriorityFirst)
+{
+  m_queue.Put(CreatePacket(100, 0));
+  m_queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_RESYNC), 1);
+
+  std::shared_ptr<CDVDMsg> msg;
+  int priority = 0;
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms, priority));
+  EXPECT_TRUE(msg->IsType(CDVDMsg::GENERAL_RESYNC));
+  EXPECT_EQ(1, priority);
+
+  // only priority messages requested
+  EXPECT_EQ(MSGQ_TIMEOUT, m_queue.Get(msg, 0ms, priority));
+
+  priority = 0;
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms, priority));
+  EXPECT_TRUE(msg->IsType(CDVDMsg::DEMUXER_PACKET));
+}
+
+TEST_P(TestDVDMessageQueue, PutBack)
+{
+  m_queue.Put(CreatePacket(100, 0));
+  m_queue.Put(CreatePacket(100, DVD_TIME_BASE));
+
+  std::shared_ptr<CDVDMsg> msg;
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms));
+  EXPECT_EQ(0, GetDts(msg));
+  EXPECT_EQ(100, m_queue.GetDataSize());
+
+  m_queue.PutBack(msg);
+  EXPECT_EQ(200, m_queue.GetDataSize());
+
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms));
+  EXPECT_EQ(0, GetDts(msg));
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms));
+  EXPECT_EQ(DVD_TIME_BASE, GetDts(msg));
+}
+
+TEST_P(TestDVDMessageQueue, FlushKeepsControlMessages)
+{
+  m_queue.Put(CreatePacket(100, 0));
+  m_queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_RESYNC));
+  m_queue.Put(CreatePacket(100, DVD_TIME_BASE));
+
+  m_queue.Flush();
+  EXPECT_EQ(0, m_queue.GetDataSize());
+  EXPECT_EQ(0u, m_queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET));
+  EXPECT_EQ(0, m_queue.GetLevel());
+
+  m_queue.Put(CreatePacket(50, 2 * DVD_TIME_BASE));
+  EXPECT_EQ(50, m_queue.GetDataSize());
+
+  std::shared_ptr<CDVDMsg> msg;
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms));
+  EXPECT_TRUE(msg->IsType(CDVDMsg::GENERAL_RESYNC));
+  ASSERT_EQ(MSGQ_OK, m_queue.Get(msg, 0ms));
+  EXPECT_EQ(2 * DVD_TIME_BASE, GetDts(msg));
+  EXPECT_EQ(MSGQ_TIMEOUT, m_queue.Get(msg, 0ms));
+  EXPECT_EQ(0, m_queue.GetDataSize());
+}
+
+TEST_P(TestDVDMessageQueue, FlushAll)
+{
+  m_queue.Put(CreatePacket(100, 0));
+  m_queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_RESYNC));
+  m_queue.Flush(CDVDMsg::NONE);
+
+  std::shared_ptr<CDVDMsg> msg;
+  EXPECT_EQ(MSGQ_TIMEOUT, m_queue.Get(msg, 0ms));
+}
+
+TEST_P(TestDVDMessageQueue, Threaded)
+{
+  constexpr int COUNT = 5000;
+
+  std::thread consumer(
+      [this]()
+      {
+        std::shared_ptr<CDVDMsg> msg;
+        for (int i = 0; i < COUNT;)
+        {
+          if (m_queue.Get(msg, 1000ms) != MSGQ_OK)
+            break;
+          EXPECT_EQ(i * 1000.0, GetDts(msg));
+          i++;
+        }
+      });
+
+  for (int i = 0; i < COUNT; ++i)
+    m_queue.Put(CreatePacket(10, i * 1000.0));
+
+  consumer.join();
+  EXPECT_EQ(0, m_queue.GetDataSize());
+}
+
+TEST_P(TestDVDMessageQueue, Abort)
+{
+  std::thread consumer(
+      [this]()
+      {
+        std::shared_ptr<CDVDMsg> msg;
+        EXPECT_EQ(MSGQ_ABORT, m_queue.Get(msg, 10s));
+      });
+
+  std::this_thread::sleep_for(10ms);
+  m_queue.Abort();
+  consumer.join();
+}
+
+INSTANTIATE_TEST_SUITE_P(RingMode, TestDVDMessageQueue, testing::Bool());
@@ -0,0 +1,125 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDThumbExtractionPool.h"
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+class CConcurrency
+{
+public:
+  void Enter()
+  {
+    const int running = ++m_running;
+    int peak = m_peak;
+    while (running > peak && !m_peak.compare_exchange_weak(peak, running))
+    {
+    }
+  }
+
+  void Leave() { --m_running; }
+
+  int GetPeak() const { return m_peak; }
+
+private:
+  std::atomic<int> m_running{0};
+  std::atomic<int> m_peak{0};
+};
+} // unnamed namespace
+
+TEST(TestDVDThumbExtractionPool, Result)
+{
+  CDVDThumbExtractionPool pool(2, 1);
+  EXPECT_EQ(42, pool.Submit("", [] { return 42; }).get());
+  EXPECT_TRUE(pool.Submit("", [] { return CDVDThumbExtractionPool::IsWorkerThread(); }).get());
+  EXPECT_FALSE(CDVDThumbExtractionPool::IsWorkerThread());
+}
+
+TEST(TestDVDThumbExtractionPool, LimitPerHost)
+{
+  CDVDThumbExtractionPool pool(4, 2);
+  CConcurrency host;
+  CConcurrency all;
+  std::vector<std::future<void>> futures;
+  for (int i = 0; i < 8; ++i)
+  {
+    futures.push_back(pool.Submit("nas",
+                                  [&host, &all]
+                                  {
+                                    host.Enter();
+                                    all.Enter();
+                                    std::this_thread::sleep_for(20ms);
+                                    all.Leave();
+                                    host.Leave();
+                                  }));
+    futures.push_back(pool.Submit("",
+                                  [&all]
+                                  {
+                                    all.Enter();
+                                    std::this_thread::sleep_for(20ms);
+                                    all.Leave();
+                                  }));
+  }
+  for (auto& future : futures)
+    future.get();
+
+  EXPECT_LE(host.GetPeak(), 2);
+  EXPECT_GT(all.GetPeak(), 2);
+  EXPECT_LE(all.GetPeak(), 4);
+}
+
+TEST(TestDVDThumbExtractionPool, Throttle)
+{
+  std::atomic<bool> throttled{true};
+  CDVDThumbExtractionPool pool(4, 2, [&throttled] { return throttled.load(); });
+  CConcurrency all;
+  std::vector<std::future<void>> futures;
+  for (int i = 0; i < 6; ++i)
+    futures.push_back(pool.Submit("",
+                                  [&all]
+                                  {
+                                    all.Enter();
+                                    std::this_thread::sleep_for(10ms);
+                                    all.Leave();
+                                  }));
+  for (auto& future : futures)
+    future.get();
+
+  EXPECT_EQ(1, all.GetPeak());
+}
+
+TEST(TestDVDThumbExtractionPool, DropOnDestruction)
+{
+  auto pool = std::make_unique<CDVDThumbExtractionPool>(1, 1);
+  std::promise<void> started;
+  std::promise<void> gate;
+  auto running = pool->Submit("",
+                              [&started, opened = gate.get_future().share()]
+                              {
+                                started.set_value();
+                                opened.wait();
+                              });
+  auto queued = pool->Submit("", [] {});
+  started.get_future().wait();
+
+  std::thread destroy([&pool] { pool.reset(); });
+  EXPECT_THROW(queued.get(), std::future_error);
+  gate.set_value();
+  destroy.join();
+  EXPECT_NO_THROW(running.get());
+}
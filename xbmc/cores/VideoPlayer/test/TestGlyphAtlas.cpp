@@ -0,0 +1,109 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/VideoRenderers/OverlayRendererUtil.h"
+
+#include <vector>
+
+#include <ass/ass.h>
+#include <gtest/gtest.h>
+
+using namespace OVERLAY;
+
+namespace
+{
+ASS_Image MakeImage(std::vector<unsigned char>& bitmap, int w, int h, int x, int y)
+{
+  ASS_Image image{};
+  image.w = w;
+  image.h = h;
+  image.stride = w;
+  image.bitmap = bitmap.data();
+  image.color = 0xffffff00;
+  image.dst_x = x;
+  image.dst_y = y;
+  return image;
+}
+} // unnamed namespace
+
+TEST(TestGlyphAtlas, KeepsGlyphsBetweenChanges)
+{
+  std::vector<unsigned char> bitmap(8 * 4, 0x80);
+  ASS_Image image = MakeImage(bitmap, 8, 4, 10, 20);
+
+  CGlyphAtlas atlas(64);
+  std::vector<SQuad> quads;
+  ASSERT_TRUE(atlas.Update(&image, quads));
+  ASSERT_EQ(1u, quads.size());
+  EXPECT_TRUE(atlas.IsReset());
+  atlas.SetUploaded();
+
+  // moved and recolored, the bitmap stays where it is
+  const SQuad first = quads[0];
+  image.dst_x = 30;
+  image.color = 0x00ff0000;
+  ASSERT_TRUE(atlas.Update(&image, quads));
+  ASSERT_EQ(1u, quads.size());
+  EXPECT_EQ(first.u, quads[0].u);
+  EXPECT_EQ(first.v, quads[0].v);
+  EXPECT_EQ(30, quads[0].x);
+  EXPECT_EQ(0, quads[0].r);
+  EXPECT_FALSE(atlas.IsReset());
+  EXPECT_TRUE(atlas.GetDirtyRows().empty());
+}
+
+TEST(TestGlyphAtlas, UploadsOnlyNewGlyphs)
+{
+  std::vector<unsigned char> bitmap1(8 * 4, 0x80);
+  std::vector<unsigned char> bitmap2(8 * 10, 0x40);
+  ASS_Image image1 = MakeImage(bitmap1, 8, 4, 0, 0);
+  ASS_Image image2 = MakeImage(bitmap2, 8, 10, 20, 0);
+
+  CGlyphAtlas atlas(64);
+  std::vector<SQuad> quads;
+  ASSERT_TRUE(atlas.Update(&image1, quads));
+  atlas.SetUploaded();
+
+  image1.next = &image2;
+  ASSERT_TRUE(atlas.Update(&image1, quads));
+  ASSERT_EQ(2u, quads.size());
+  ASSERT_EQ(1u, atlas.GetDirtyRows().size());
+  EXPECT_EQ(quads[1].v, atlas.GetDirtyRows()[0].y);
+  EXPECT_EQ(10, atlas.GetDirtyRows()[0].height);
+  EXPECT_EQ(0x40, atlas.Data()[quads[1].v * atlas.Width() + quads[1].u]);
+}
+
+TEST(TestGlyphAtlas, CopiesChangedBitmap)
+{
+  std::vector<unsigned char> bitmap(8 * 4, 0x80);
+  ASS_Image image = MakeImage(bitmap, 8, 4, 0, 0);
+
+  CGlyphAtlas atlas(64);
+  std::vector<SQuad> quads;
+  ASSERT_TRUE(atlas.Update(&image, quads));
+  atlas.SetUploaded();
+
+  // another bitmap at the same address
+  std::fill(bitmap.begin(), bitmap.end(), 0x20);
+  ASSERT_TRUE(atlas.Update(&image, quads));
+  ASSERT_EQ(1u, quads.size());
+  EXPECT_FALSE(atlas.GetDirtyRows().empty());
+  EXPECT_EQ(0x20, atlas.Data()[quads[0].v * atlas.Width() + quads[0].u]);
+}
+
+TEST(TestGlyphAtlas, SkipsHiddenImages)
+{
+  std::vector<unsigned char> bitmap(8 * 4, 0x80);
+  ASS_Image image = MakeImage(bitmap, 8, 4, 0, 0);
+  image.color = 0xffffffff;
+
+  CGlyphAtlas atlas(64);
+  std::vector<SQuad> quads;
+  EXPECT_FALSE(atlas.Update(&image, quads));
+  EXPECT_TRUE(quads.empty());
+}
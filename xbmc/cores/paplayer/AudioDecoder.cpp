@@ -20,6 +20,7 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cmath>
 #include <mutex>
 
@@ -62,7 +63,7 @@ void CAudioDecoder::Destroy()
   m_canPlay = false;
 }
 
-bool CAudioDecoder::Create(const CFileItem &file, int64_t seekOffset)
+bool CAudioDecoder::Create(const CFileItem& file, int64_t seekOffset, unsigned int bufferTime)
 {
   Destroy();
 
@@ -100,8 +101,14 @@ bool CAudioDecoder::Create(const CFileItem &file, int64_t seekOffset)
     return false;
   }
 
-  /* allocate the pcmBuffer for 2 seconds of audio */
-  m_pcmBuffer.Create(2 * blockSize * m_codec->m_format.m_sampleRate);
+  /* allocate the pcmBuffer for the requested time of audio, but don't let a long buffer of a high
+     res stream grow without bounds */
+  const unsigned int bytesPerSecond = blockSize * m_codec->m_format.m_sampleRate;
+  m_queuedSize = bytesPerSecond * PCM_BUFFER_TIME / 1000;
+  const uint64_t bufferSize = static_cast<uint64_t>(bytesPerSecond) * bufferTime / 1000;
+  m_pcmBuffer.Create(static_cast<unsigned int>(std::clamp<uint64_t>(
+      bufferSize, m_queuedSize, std::max<uint64_t>(m_queuedSize, MAX_PCM_BUFFER_SIZE))));
+  m_queuedSize = m_queuedSize * 9 / 10;
 
   if (file.HasMusicInfoTag())
   {
@@ -244,6 +251,16 @@ uint8_t *CAudioDecoder::GetRawData(int &size)
   return nullptr;
 }
 
+bool CAudioDecoder::IsBufferFull()
+{
+  std::unique_lock lock(m_critSection);
+  if (!m_codec || m_eof)
+    return true;
+  if (m_codec->m_format.m_dataFormat == AE_FMT_RAW)
+    return m_rawBufferSize > 0;
+  return m_pcmBuffer.getMaxWriteSize() < INPUT_SAMPLES * (m_codec->m_bitsPerSample >> 3);
+}
+
 int CAudioDecoder::ReadSamples(int numsamples)
 {
   if (m_status == STATUS_NO_FILE || m_status == STATUS_ENDING || m_status == STATUS_ENDED)
@@ -275,7 +292,7 @@ int CAudioDecoder::ReadSamples(int numsamples)
         m_pcmBuffer.WriteData((char *)m_pcmInputBuffer, readSize);
 
         // update status
-        if (m_status == STATUS_QUEUING && m_pcmBuffer.getMaxReadSize() > m_pcmBuffer.getSize() * 0.9)
+        if (m_status == STATUS_QUEUING && m_pcmBuffer.getMaxReadSize() > m_queuedSize)
         {
           CLog::Log(LOGINFO, "AudioDecoder: File is queued");
           m_status = STATUS_QUEUED;
@@ -25,6 +25,9 @@ class ICodec;
 #define OUTPUT_SAMPLES PACKET_SIZE      // max number of output samples
 #define INPUT_SAMPLES  PACKET_SIZE      // number of input samples (distributed over channels)
 
+#define PCM_BUFFER_TIME 2000            // default time of decoded audio buffered in ms
+#define MAX_PCM_BUFFER_SIZE (32 * 1024 * 1024) // limit for longer buffers of high res streams
+
 #define STATUS_NO_FILE  0
 #define STATUS_QUEUING  1
 #define STATUS_QUEUED   2
@@ -43,7 +46,14 @@ public:
   CAudioDecoder();
   ~CAudioDecoder();
 
-  bool Create(const CFileItem &file, int64_t seekOffset);
+  /*!
+   \brief Open the codec of a file
+   \param file the file to decode
+   \param seekOffset position to start decoding at in ms
+   \param bufferTime time of decoded audio to buffer in ms, the decoder is queued (ready to play)
+   once it holds PCM_BUFFER_TIME of it
+   */
+  bool Create(const CFileItem& file, int64_t seekOffset, unsigned int bufferTime = PCM_BUFFER_TIME);
   void Destroy();
 
   int ReadSamples(int numsamples);
@@ -54,6 +64,7 @@ public:
   void SetTotalTime(int64_t time);
   void Start() { m_canPlay = true;}; // cause a pre-buffered stream to start.
   int GetStatus() { return m_status; }
+  bool IsBufferFull();
   void SetStatus(int status) { m_status = status; }
 
   AEAudioFormat GetFormat();
@@ -68,6 +79,7 @@ public:
 private:
   // pcm buffer
   CRingBuffer m_pcmBuffer;
+  unsigned int m_queuedSize = 0; // buffered bytes needed to be ready to play
 
   // output buffer (for transferring data from the Pcm Buffer to the rest of the audio chain)
   float m_outputBuffer[OUTPUT_SAMPLES];
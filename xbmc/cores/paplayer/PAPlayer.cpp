@@ -39,6 +39,8 @@ using namespace std::chrono_literals;
 #define TIME_TO_CACHE_NEXT_FILE 5000 /* 5 seconds before end of song, start caching the next song */
 #define FAST_XFADE_TIME           80 /* 80 milliseconds */
 #define MAX_SKIP_XFADE_TIME     2000 /* max 2 seconds crossfade on track skip */
+#define PREDECODE_TIME         10000 /* decode the first 10 seconds of the next song ahead */
+#define PREDECODE_TIMEOUT       2000 /* but don't hold back the next song longer than 2 seconds */
 
 // PAP: Psycho-acoustic Audio Player
 // Supporting all open  audio codec standards.
@@ -325,7 +327,8 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
     starttime = 0; // No resume point
   }
 
-  if (!si->m_decoder.Create(file, si->m_startOffset))
+  // a queued song gets a longer buffer, filled in the background before it starts playing
+  if (!si->m_decoder.Create(file, si->m_startOffset, fadeIn ? PREDECODE_TIME : PCM_BUFFER_TIME))
   {
     CLog::Log(LOGWARNING, "PAPlayer::QueueNextFileEx - Failed to create the decoder");
 
@@ -436,6 +439,18 @@ bool PAPlayer::QueueNextFileEx(const CFileItem &file, bool fadeIn)
     return false;
   }
 
+  /* pre-decode the start of a queued song while the current one still plays, so the transition
+     doesn't depend on how quick the storage is at that moment */
+  if (fadeIn)
+  {
+    XbmcThreads::EndTime<> timer(std::chrono::milliseconds(PREDECODE_TIMEOUT));
+    while (!si->m_decoder.IsBufferFull() && !timer.IsTimePast())
+    {
+      if (si->m_decoder.ReadSamples(PACKET_SIZE) != RET_SUCCESS)
+        break;
+    }
+  }
+
   /* add the stream to the list */
   std::unique_lock lock(m_streamsLock);
   m_streams.push_back(si);
@@ -19,7 +19,10 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "sqlitedataset.h"
+#include "threads/CriticalSection.h"
+#include "utils/Random.h"
 #include "utils/SortUtils.h"
+#include "utils/StartupTrace.h"
 #include "utils/StringUtils.h"
 #include "utils/log.h"
 
@@ -29,14 +32,63 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
+
+#include <fmt/ranges.h>
 
 using namespace dbiplus;
 
 namespace
 {
 constexpr int MAX_COMPRESS_COUNT = 20;
+
+/*! \brief Write counter shared by all connections to the same database.
+ Entries are never removed, there is only a handful of databases per process.
+ */
+std::atomic<uint64_t>& GetWriteCounter(const std::string& database)
+{
+  static CCriticalSection section;
+  static std::map<std::string, std::atomic<uint64_t>, std::less<>> counters;
+
+  std::unique_lock lock(section);
+  return counters[database];
+}
+
+/*! \brief SQLite connections of closed CDatabase objects, reused by the next one opening the same
+ database. Opening a connection reads the whole schema and runs the setup pragmas, which costs more
+ than most of the queries done on it, and the prepared statements of the connection are kept.
+ */
+constexpr size_t MAX_IDLE_CONNECTIONS = 4;
+
+CCriticalSection idleSection;
+std::map<std::string, std::vector<std::unique_ptr<Database>>, std::less<>> idleConnections;
+
+std::unique_ptr<Database> TakeIdleConnection(const std::string& key)
+{
+  std::unique_lock lock(idleSection);
+  auto it = idleConnections.find(key);
+  if (it == idleConnections.end() || it->second.empty())
+    return {};
+
+  std::unique_ptr<Database> db = std::move(it->second.back());
+  it->second.pop_back();
+  return db;
+}
+
+bool ReturnIdleConnection(const std::string& key, std::unique_ptr<Database>& db)
+{
+  std::unique_lock lock(idleSection);
+  auto& connections = idleConnections[key];
+  if (connections.size() >= MAX_IDLE_CONNECTIONS)
+    return false;
+
+  connections.emplace_back(std::move(db));
+  return true;
+}
 } // unnamed namespace
 
 CDatabase::Filter::Filter() = default;
@@ -337,6 +389,51 @@ int CDatabase::GetSingleValueInt(const std::string& query, Dataset& ds) const
   return ret;
 }
 
+int CDatabase::RestrictToRandomIds(std::string_view table,
+                                   std::string_view idField,
+                                   unsigned int count,
+                                   Filter& filter) const
+{
+  if (!m_pDB || !m_pDS)
+    return -1;
+
+  std::string query;
+  BuildSQL(StringUtils::Format("SELECT {} FROM {} ", idField, table), filter, query);
+
+  std::vector<int> ids;
+  try
+  {
+    if (!m_pDS->query(query))
+      return -1;
+
+    ids.reserve(m_pDS->num_rows());
+    while (!m_pDS->eof())
+    {
+      ids.push_back(m_pDS->fv(0).get_asInt());
+      m_pDS->next();
+    }
+    m_pDS->close();
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "Failed on query '{}'", query);
+    return -1;
+  }
+
+  // joins may list an id more than once
+  std::ranges::sort(ids);
+  ids.erase(std::ranges::unique(ids).begin(), ids.end());
+
+  const auto total = static_cast<int>(ids.size());
+  if (ids.size() > count)
+  {
+    ids.erase(KODI::UTILS::RandomSample(ids.begin(), ids.end(), count), ids.end());
+    filter.AppendWhere(StringUtils::Format("{} IN ({})", idField, fmt::join(ids, ",")));
+  }
+
+  return total;
+}
+
 int CDatabase::GetSingleValueInt(const std::string& strTable,
                                  const std::string& strColumn,
                                  const std::string& strWhereClause /* = std::string() */,
@@ -592,6 +689,23 @@ CDatabase::ConnectionState CDatabase::Connect(const std::string& dbName,
                                               const DatabaseSettings& dbSettings,
                                               bool create)
 {
+  CStartupTrace::CScope trace("CDatabase::Connect", dbName);
+
+  m_connectionKey.clear();
+  if (dbSettings.type == "sqlite3" && !create)
+  {
+    // the connection left behind by a closed CDatabase is already set up
+    m_connectionKey = dbSettings.host + "/" + dbName;
+    m_pDB = TakeIdleConnection(m_connectionKey);
+    if (m_pDB)
+    {
+      m_pDS.reset(m_pDB->CreateDataset());
+      m_pDS2.reset(m_pDB->CreateDataset());
+      m_openCount = 1;
+      return ConnectionState::STATE_CONNECTED;
+    }
+  }
+
   // create the appropriate database structure
   if (dbSettings.type == "sqlite3")
   {
@@ -624,6 +738,8 @@ CDatabase::ConnectionState CDatabase::Connect(const std::string& dbName,
   // database name is always required
   m_pDB->setDatabase(dbName.c_str());
 
+  m_pDB->setWriteCounter(&GetWriteCounter(dbSettings.host + ":" + dbSettings.port + "/" + dbName));
+
   // set configuration regardless if any are empty
   m_pDB->setConfig(dbSettings.key.c_str(), dbSettings.cert.c_str(), dbSettings.ca.c_str(),
                    dbSettings.capath.c_str(), dbSettings.ciphers.c_str(), dbSettings.connecttimeout,
@@ -672,6 +788,7 @@ CDatabase::ConnectionState CDatabase::Connect(const std::string& dbName,
   catch (DbErrors& error)
   {
     CLog::LogF(LOGERROR, "Failed with '{}'", error.getMsg());
+    m_connectionKey.clear();
     m_openCount = 1; // set to open so we can execute Close()
     Close();
     return ConnectionState::STATE_ERROR;
@@ -712,10 +829,46 @@ void CDatabase::Close()
     return;
   if (nullptr != m_pDS)
     m_pDS->close();
-  m_pDB->disconnect();
-  m_pDB.reset();
+
+  const bool reuse = !m_connectionKey.empty() && !m_pDB->in_transaction() && DropTemporaryTables();
   m_pDS.reset();
   m_pDS2.reset();
+  if (reuse && ReturnIdleConnection(m_connectionKey, m_pDB))
+    return;
+
+  m_pDB->disconnect();
+  m_pDB.reset();
+}
+
+bool CDatabase::DropTemporaryTables()
+{
+  // temporary tables belong to the connection, the next user must not find them
+  try
+  {
+    std::vector<std::string> tables;
+    m_pDS->query("SELECT name FROM sqlite_temp_master WHERE type = 'table'");
+    while (!m_pDS->eof())
+    {
+      tables.emplace_back(m_pDS->fv(0).get_asString());
+      m_pDS->next();
+    }
+    m_pDS->close();
+
+    for (const auto& table : tables)
+      m_pDS->exec(PrepareSQL("DROP TABLE temp.%s", table.c_str()));
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+  }
+  return false;
+}
+
+void CDatabase::CloseIdleConnections()
+{
+  std::unique_lock lock(idleSection);
+  idleConnections.clear();
 }
 
 bool CDatabase::Compress(bool bForce /* =true */)
@@ -802,6 +955,13 @@ void CDatabase::RollbackTransaction()
   }
 }
 
+uint64_t CDatabase::GetWriteGeneration() const
+{
+  if (!m_pDB)
+    return 0;
+  return m_pDB->getWriteGeneration();
+}
+
 bool CDatabase::InTransaction() const
 {
   try
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -109,6 +110,19 @@ public:
   virtual bool CommitTransaction();
   void RollbackTransaction();
   bool InTransaction() const;
+
+  /*!
+   * @brief Get the number of writes and commits executed on this database so far, by any
+   * connection of this process. Result caches compare it to detect changes, it does not see
+   * changes made by other clients of a shared (MySQL) database.
+   */
+  uint64_t GetWriteGeneration() const;
+
+  /*!
+   * @brief Close the SQLite connections kept for reuse after their CDatabase was closed.
+   */
+  static void CloseIdleConnections();
+
   void CopyDB(const std::string& latestDb);
   void DropAnalytics();
 
@@ -158,6 +172,20 @@ public:
    */
   int GetSingleValueInt(const std::string& query, dbiplus::Dataset& ds) const;
 
+  /*! \brief Restrict a random listing with a limit to a random sample of its ids.
+   Sorting a large listing by RANDOM() to keep a few rows reads all of its rows. Only the ids are
+   read instead and the filter is restricted to a sample of them, so only those rows are read.
+   \param table the table or view listed.
+   \param idField the id column of the listing.
+   \param count the number of ids to sample.
+   \param filter the filter of the listing, restricted when it matches more ids than the count.
+   \return the number of ids matching the filter, -1 on failure.
+   */
+  int RestrictToRandomIds(std::string_view table,
+                          std::string_view idField,
+                          unsigned int count,
+                          Filter& filter) const;
+
   /*!
    * @brief Delete values from a table.
    * @param strTable The table to delete the values from.
@@ -319,6 +347,7 @@ protected:
 private:
   void InitSettings(DatabaseSettings& dbSettings);
   void UpdateVersionNumber();
+  bool DropTemporaryTables();
 
   bool m_bMultiInsert{
       false}; /*!< True if there are any queries in the insert queue, false otherwise */
@@ -328,4 +357,6 @@ private:
 
   bool m_multipleExecute{false};
   std::vector<std::string> m_multipleQueries;
+
+  std::string m_connectionKey; ///< sqlite database file, the connection is reused when set
 };
@@ -166,6 +166,54 @@ void Dataset::parse_sql(std::string& sqlcmd) const
   } //for
 }
 
+std::string Dataset::bind_params(const std::string& sqlcmd, const StatementParams& params) const
+{
+  std::string bound;
+  bound.reserve(sqlcmd.size());
+
+  size_t param = 0;
+  bool quoted = false;
+  for (const char c : sqlcmd)
+  {
+    if (c == '\'')
+      quoted = !quoted;
+
+    if (c != '?' || quoted)
+    {
+      bound += c;
+      continue;
+    }
+
+    if (param >= params.size())
+      throw DbErrors("Missing parameter %zu for statement: %s", param + 1, sqlcmd.c_str());
+
+    const field_value& value = params[param++];
+    if (value.get_isNull())
+      bound += "NULL";
+    else if (value.get_fType() == fType::ft_String)
+      bound += db->prepare("'%s'", value.get_asString().c_str());
+    else if (value.get_fType() == fType::ft_Boolean)
+      bound += value.get_asBool() ? "1" : "0";
+    else
+      bound += value.get_asString();
+  }
+
+  if (param != params.size())
+    throw DbErrors("Too many parameters for statement: %s", sqlcmd.c_str());
+
+  return bound;
+}
+
+int Dataset::exec(const std::string& sqlcmd, const StatementParams& params)
+{
+  return exec(bind_params(sqlcmd, params));
+}
+
+bool Dataset::query(const std::string& sqlcmd, const StatementParams& params)
+{
+  return query(bind_params(sqlcmd, params));
+}
+
 void Dataset::close()
 {
   haveError = false;
@@ -14,13 +14,16 @@
 
 #include "qry_dat.h"
 
+#include <atomic>
 #include <cstdarg>
+#include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 namespace dbiplus
 {
@@ -65,6 +68,7 @@ protected:
   std::string capath;
   std::string ciphers; // SSL - Encryption info
   unsigned int connect_timeout; // seconds
+  std::atomic<uint64_t>* write_counter{nullptr}; // bumped on every write, may be shared
 
 public:
   /* constructor */
@@ -98,6 +102,19 @@ public:
   void setSequenceTable(const char* new_seq_table) { sequence_table = new_seq_table; }
   /* Get name of sequence table */
   const char* getSequenceTable() const { return sequence_table.c_str(); }
+  /* sets the counter bumped by every executed statement and commit */
+  void setWriteCounter(std::atomic<uint64_t>* counter) { write_counter = counter; }
+  /* gets the current value of the write counter, 0 if none is set */
+  uint64_t getWriteGeneration() const
+  {
+    return write_counter ? write_counter->load(std::memory_order_acquire) : 0;
+  }
+  /* called by the datasets after executing a statement without results */
+  void notifyWrite()
+  {
+    if (write_counter)
+      write_counter->fetch_add(1, std::memory_order_release);
+  }
   /* Sets configuration */
   virtual void setConfig(const char* newKey,
                          const char* newCert,
@@ -202,6 +219,7 @@ enum class sqlType
 
 using StringList = std::list<std::string>;
 using ParamList = std::map<std::string, field_value, std::less<>>;
+using StatementParams = std::vector<field_value>;
 
 class Dataset
 {
@@ -271,6 +289,9 @@ protected:
   /* Returns old field value (for :OLD) */
   virtual field_value f_old(const char* f);
 
+  /* Replaces the '?' placeholders outside of quotes with the escaped parameter values */
+  std::string bind_params(const std::string& sql, const StatementParams& params) const;
+
 public:
   /* constructor */
   Dataset();
@@ -310,6 +331,13 @@ public:
   virtual const void* getExecRes() = 0;
   /* as open, but with our query exec Sql */
   virtual bool query(const std::string& sql) = 0;
+
+  /*! \brief Run a statement with '?' placeholders, bound in order to the given parameters.
+   Backends supporting it compile the statement once per connection and reuse it for following
+   calls with the same sql, the default binds the values into the statement text.
+   */
+  virtual int exec(const std::string& sql, const StatementParams& params);
+  virtual bool query(const std::string& sql, const StatementParams& params);
   /* Close SQL Query*/
   virtual void close();
   /* Refresh dataset (reopen it and set the same cursor position) */
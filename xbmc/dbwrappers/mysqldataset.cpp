@@ -681,6 +681,7 @@ void MysqlDatabase::commit_transaction()
     assert(_in_transaction);
     mysql_commit(conn);
     mysql_autocommit(conn, true);
+    notifyWrite();
     CLog::LogFC(LOGDEBUG, LOGDATABASE, "Commit transaction");
     _in_transaction = false;
   }
@@ -1943,6 +1944,7 @@ int MysqlDataset::exec(const std::string& sql)
   const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
 
   CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} ms for query: {}", duration.count(), qry);
+  db->notifyWrite();
 
   if (res != MYSQL_OK)
   {
@@ -407,18 +407,49 @@ void SqliteDatabase::disconnect()
 {
   if (!active)
     return;
+  finalize_statements();
   sqlite3_close(conn);
   active = false;
   conn = nullptr; // Reset handle to avoid stale pointer usage after database is closed
 }
 
+sqlite3_stmt* SqliteDatabase::getStatement(const std::string& sql)
+{
+  // bounds the memory held by statements built from varying sql
+  constexpr size_t MAX_STATEMENTS = 64;
+
+  const auto it = statements.find(sql);
+  if (it != statements.end())
+    return it->second;
+
+  if (statements.size() >= MAX_STATEMENTS)
+    finalize_statements();
+
+  sqlite3_stmt* stmt = nullptr;
+  if (setErr(sqlite3_prepare_v2(conn, sql.c_str(), -1, &stmt, nullptr), sql.c_str()) != SQLITE_OK)
+    throw DbErrors("%s", getErrorMsg());
+
+  statements.try_emplace(sql, stmt);
+  return stmt;
+}
+
+void SqliteDatabase::finalize_statements()
+{
+  for (const auto& [sql, stmt] : statements)
+    sqlite3_finalize(stmt);
+  statements.clear();
+}
+
 int SqliteDatabase::postconnect()
 {
   if (!active)
     throw DbErrors("Cannot execute postconnect actions: no active connection...");
 
+  // with the write ahead log readers don't wait for a writer, e.g. the GUI for a library scan,
+  // and synchronous NORMAL only syncs at checkpoints
   static const char* sqlcmd{
-      "PRAGMA cache_size=4096; PRAGMA synchronous='NORMAL'; PRAGMA count_changes='OFF';"};
+      "PRAGMA journal_mode=WAL; PRAGMA cache_size=4096; PRAGMA synchronous='NORMAL'; "
+      "PRAGMA mmap_size=67108864; PRAGMA temp_store=MEMORY; PRAGMA count_changes='OFF';"};
   if (setErr(sqlite3_exec(getHandle(), sqlcmd, nullptr, nullptr, nullptr), sqlcmd) != SQLITE_OK)
   {
     throw DbErrors("%s", getErrorMsg());
@@ -612,6 +643,7 @@ void SqliteDatabase::commit_transaction()
   {
     assert(_in_transaction);
     sqlite3_exec(conn, "commit", nullptr, nullptr, nullptr);
+    notifyWrite();
     CLog::LogFC(LOGDEBUG, LOGDATABASE, "Sqlite commit transaction");
     _in_transaction = false;
   }
@@ -906,6 +938,7 @@ int SqliteDataset::exec(const std::string& sql)
   const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
 
   CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} ms for query: {}", duration.count(), qry);
+  db->notifyWrite();
 
   if (res == SQLITE_OK)
   {
@@ -933,6 +966,32 @@ int SqliteDataset::exec(const std::string& sql)
   }
 }
 
+int SqliteDataset::exec(const std::string& sql, const StatementParams& params)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  exec_res.clear();
+
+  const auto start = std::chrono::steady_clock::now();
+
+  sqlite3_stmt* stmt = static_cast<SqliteDatabase*>(db)->getStatement(sql);
+  bind_statement(stmt, sql, params);
+  while (sqlite3_step(stmt) == SQLITE_ROW)
+    ;
+  const int res = db->setErr(sqlite3_reset(stmt), sql.c_str());
+
+  const auto end = std::chrono::steady_clock::now();
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+  CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} ms for statement: {}", duration.count(), sql);
+  db->notifyWrite();
+
+  if (res != SQLITE_OK)
+    throw DbErrors("%s", db->getErrorMsg());
+  return res;
+}
+
 int SqliteDataset::exec()
 {
   return exec(sql);
@@ -943,21 +1002,8 @@ const void* SqliteDataset::getExecRes()
   return &exec_res;
 }
 
-bool SqliteDataset::query(const std::string& query)
+void SqliteDataset::fetch_rows(sqlite3_stmt* stmt)
 {
-  if (!handle())
-    throw DbErrors("No Database Connection");
-
-  // Must be a SELECT SQL query
-  assert(query.find("SELECT") != std::string::npos || query.find("select") != std::string::npos);
-
-  close();
-
-  sqlite3_stmt* stmt = nullptr;
-  if (db->setErr(sqlite3_prepare_v2(handle(), query.c_str(), -1, &stmt, nullptr), query.c_str()) !=
-      SQLITE_OK)
-    throw DbErrors("%s", db->getErrorMsg());
-
   // column headers
   const unsigned int numColumns = sqlite3_column_count(stmt);
   result.record_header.resize(numColumns);
@@ -997,6 +1043,66 @@ bool SqliteDataset::query(const std::string& query)
     }
     result.records.push_back(res);
   }
+}
+
+void SqliteDataset::bind_statement(sqlite3_stmt* stmt,
+                                   const std::string& sql,
+                                   const StatementParams& params)
+{
+  sqlite3_reset(stmt);
+  sqlite3_clear_bindings(stmt);
+
+  if (sqlite3_bind_parameter_count(stmt) != static_cast<int>(params.size()))
+    throw DbErrors("Parameter count mismatch for statement: %s", sql.c_str());
+
+  for (int i = 0; i < static_cast<int>(params.size()); i++)
+  {
+    const field_value& value = params[i];
+    int res;
+    if (value.get_isNull())
+      res = sqlite3_bind_null(stmt, i + 1);
+    else
+    {
+      switch (value.get_fType())
+      {
+        case fType::ft_String:
+        {
+          const std::string str = value.get_asString();
+          res = sqlite3_bind_text(stmt, i + 1, str.c_str(), static_cast<int>(str.size()),
+                                  SQLITE_TRANSIENT);
+          break;
+        }
+        case fType::ft_Float:
+        case fType::ft_Double:
+        case fType::ft_LongDouble:
+          res = sqlite3_bind_double(stmt, i + 1, value.get_asDouble());
+          break;
+        default:
+          res = sqlite3_bind_int64(stmt, i + 1, value.get_asInt64());
+          break;
+      }
+    }
+    if (db->setErr(res, sql.c_str()) != SQLITE_OK)
+      throw DbErrors("%s", db->getErrorMsg());
+  }
+}
+
+bool SqliteDataset::query(const std::string& query)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  // Must be a SELECT SQL query
+  assert(query.find("SELECT") != std::string::npos || query.find("select") != std::string::npos);
+
+  close();
+
+  sqlite3_stmt* stmt = nullptr;
+  if (db->setErr(sqlite3_prepare_v2(handle(), query.c_str(), -1, &stmt, nullptr), query.c_str()) !=
+      SQLITE_OK)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  fetch_rows(stmt);
   if (db->setErr(sqlite3_finalize(stmt), query.c_str()) == SQLITE_OK)
   {
     active = true;
@@ -1010,6 +1116,27 @@ bool SqliteDataset::query(const std::string& query)
   }
 }
 
+bool SqliteDataset::query(const std::string& sql, const StatementParams& params)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  close();
+
+  sqlite3_stmt* stmt = static_cast<SqliteDatabase*>(db)->getStatement(sql);
+  bind_statement(stmt, sql, params);
+  fetch_rows(stmt);
+
+  // the statement stays cached, reset returns the error of the last step
+  if (db->setErr(sqlite3_reset(stmt), sql.c_str()) != SQLITE_OK)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  active = true;
+  ds_state = dsSelect;
+  this->first();
+  return true;
+}
+
 void SqliteDataset::open(const std::string& sql)
 {
   set_select_sql(sql);
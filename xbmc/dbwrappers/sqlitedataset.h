@@ -15,8 +15,10 @@
 #include "dataset.h"
 
 #include <string>
+#include <unordered_map>
 
 struct sqlite3;
+struct sqlite3_stmt;
 
 namespace dbiplus
 {
@@ -31,6 +33,10 @@ protected:
   /* connect descriptor */
   sqlite3* conn{nullptr};
   bool _in_transaction{false};
+  /* statements compiled by SqliteDataset::exec/query with parameters, by sql text */
+  std::unordered_map<std::string, sqlite3_stmt*> statements;
+
+  void finalize_statements();
 
 public:
   /* default constructor */
@@ -42,6 +48,8 @@ public:
 
   /* func. returns connection handle with SQLite-server */
   sqlite3* getHandle() { return conn; }
+  /* func. returns the cached compiled statement for sql, compiling it on first use */
+  sqlite3_stmt* getStatement(const std::string& sql);
   /* func. returns current status about SQLite-server connection */
   int status() override;
   int setErr(int err_code, const char* qry) override;
@@ -105,6 +113,11 @@ protected:
 
   //static int sqlite_callback(void* res_ptr,int ncol, char** result, char** cols);
 
+  /* binds params to the placeholders of a cached statement */
+  void bind_statement(sqlite3_stmt* stmt, const std::string& sql, const StatementParams& params);
+  /* reads all rows of a stepped statement into the result set */
+  void fetch_rows(sqlite3_stmt* stmt);
+
   /* This function works only with MySQL database
   Filling the fields information from select statement */
   void fill_fields() override;
@@ -128,9 +141,11 @@ or insert() operations default = false) */
   /* func. executes a query without results to return */
   int exec() override;
   int exec(const std::string& sql) override;
+  int exec(const std::string& sql, const StatementParams& params) override;
   const void* getExecRes() override;
   /* as open, but with our query exec Sql */
   bool query(const std::string& query) override;
+  bool query(const std::string& sql, const StatementParams& params) override;
   /* func. closes a query */
   void close() override;
   /* Cancel changes, made in insert or edit states of dataset */
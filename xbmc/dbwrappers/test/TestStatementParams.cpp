@@ -0,0 +1,89 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/sqlitedataset.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+using namespace dbiplus;
+
+namespace
+{
+class TestStatementParams : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char dir[] = "/tmp/kodi-dbparams-XXXXXX";
+    ASSERT_NE(nullptr, mkdtemp(dir));
+    m_dir = dir;
+
+    m_db.setHostName(m_dir.c_str());
+    m_db.setDatabase("test.db");
+    ASSERT_EQ(DB_CONNECTION_OK, m_db.connect(true));
+
+    m_ds.reset(m_db.CreateDataset());
+    m_ds->exec("CREATE TABLE path (idPath INTEGER PRIMARY KEY, strPath TEXT, rating REAL)");
+  }
+
+  void TearDown() override
+  {
+    m_ds.reset();
+    m_db.disconnect();
+    std::remove((m_dir + "/test.db").c_str());
+    rmdir(m_dir.c_str());
+  }
+
+  std::string m_dir;
+  SqliteDatabase m_db;
+  std::unique_ptr<Dataset> m_ds;
+};
+} // namespace
+
+TEST_F(TestStatementParams, BindsValues)
+{
+  const std::string insert = "INSERT INTO path (idPath, strPath, rating) VALUES (NULL, ?, ?)";
+  m_ds->exec(insert, {field_value(std::string("/media/it's/")), field_value(7.5)});
+  m_ds->exec(insert, {field_value("/media/?/"), field_value(1.0)});
+
+  field_value empty;
+  empty.set_isNull();
+  m_ds->exec(insert, {field_value("/media/none/"), empty});
+
+  // the compiled statement is reused for every call with the same sql
+  const std::string select = "SELECT idPath, rating FROM path WHERE strPath = ?";
+  ASSERT_TRUE(m_ds->query(select, {field_value("/media/it's/")}));
+  ASSERT_EQ(1, m_ds->num_rows());
+  EXPECT_EQ(1, m_ds->fv("idPath").get_asInt());
+  EXPECT_DOUBLE_EQ(7.5, m_ds->fv("rating").get_asDouble());
+
+  ASSERT_TRUE(m_ds->query(select, {field_value("/media/?/")}));
+  ASSERT_EQ(1, m_ds->num_rows());
+  EXPECT_EQ(2, m_ds->fv("idPath").get_asInt());
+
+  ASSERT_TRUE(m_ds->query(select, {field_value("/media/none/")}));
+  ASSERT_EQ(1, m_ds->num_rows());
+  EXPECT_TRUE(m_ds->fv("rating").get_isNull());
+
+  ASSERT_TRUE(m_ds->query(select, {field_value("/missing/")}));
+  EXPECT_EQ(0, m_ds->num_rows());
+  m_ds->close();
+}
+
+TEST_F(TestStatementParams, ParameterCountMismatch)
+{
+  EXPECT_THROW(m_ds->query("SELECT idPath FROM path WHERE strPath = ?", {}), DbErrors);
+  EXPECT_THROW(m_ds->query("SELECT idPath FROM path WHERE idPath = ?",
+                           {field_value(1), field_value(2)}),
+               DbErrors);
+}
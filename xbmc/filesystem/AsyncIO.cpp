@@ -0,0 +1,101 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AsyncIO.h"
+
+#include "FileItemList.h"
+#include "ServiceBroker.h"
+#include "URL.h"
+#include "filesystem/File.h"
+#include "jobs/JobManager.h"
+#include "utils/URIUtils.h"
+
+#include <utility>
+
+using namespace XFILE;
+
+class CBlockingCall::CJob : public ::CJob
+{
+public:
+  CJob(CBlockingCall& call, std::coroutine_handle<> handle) : m_call(call), m_handle(handle) {}
+
+  ~CJob() override
+  {
+    // cancelled or not queued, the coroutine gets the result of a failed call
+    if (!m_done)
+      m_handle.resume();
+  }
+
+  const char* GetType() const override { return "asyncio"; }
+
+  RESOURCE GetResource(std::string& host) const override
+  {
+    if (!URIUtils::IsRemote(m_call.m_url))
+      return RESOURCE_DISK;
+
+    host = CURL(m_call.m_url).GetHostName();
+    return RESOURCE_NETWORK;
+  }
+
+  bool DoWork() override
+  {
+    // the call lives in the frame of the coroutine, which is gone once it returned
+    m_call.m_call();
+    m_done = true;
+    m_handle.resume();
+    return true;
+  }
+
+private:
+  CBlockingCall& m_call;
+  std::coroutine_handle<> m_handle;
+  bool m_done{false};
+};
+
+CBlockingCall::CBlockingCall(const CURL& url, std::function<void()> call)
+  : m_url(url.Get()),
+    m_call(std::move(call))
+{
+}
+
+bool CBlockingCall::await_suspend(std::coroutine_handle<> handle)
+{
+  const auto jobManager = CServiceBroker::GetJobManager();
+  if (!jobManager)
+  {
+    m_call();
+    return false;
+  }
+
+  // the coroutine may already continue on the worker when AddJob() returns, this is gone then
+  jobManager->AddJob(new CJob(*this, handle), nullptr, ::CJob::PRIORITY_NORMAL);
+  return true;
+}
+
+CTask<bool> XFILE::OpenAsync(CFile& file, const CURL& url, unsigned int flags)
+{
+  bool result{false};
+  co_await CBlockingCall(url, [&]() { result = file.Open(url, flags); });
+  co_return result;
+}
+
+CTask<ssize_t> XFILE::ReadAsync(CFile& file, const CURL& url, void* buffer, size_t size)
+{
+  ssize_t result{-1};
+  co_await CBlockingCall(url, [&]() { result = file.Read(buffer, size); });
+  co_return result;
+}
+
+CTask<bool> XFILE::GetDirectoryAsync(const CURL& url,
+                                     CFileItemList& items,
+                                     const CDirectory::CHints& hints)
+{
+  bool result{false};
+  co_await CBlockingCall(url, [&]() { result = CDirectory::GetDirectory(url, items, hints); });
+  co_return result;
+}
@@ -0,0 +1,66 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "filesystem/Directory.h"
+#include "threads/Task.h"
+
+#include <coroutine>
+#include <functional>
+#include <string>
+
+#include <sys/types.h>
+
+class CFileItemList;
+class CURL;
+
+namespace XFILE
+{
+class CFile;
+
+/*!
+ * \brief Awaitable that runs a blocking file system call on a worker of the job manager.
+ *
+ * The awaiting coroutine continues on the worker once the call returned. The calls are
+ * queued as jobs with the resource of the url, at most a few of them block on one remote host
+ * or the local disk at the same time, no matter how many coroutines wait for them. Runs the
+ * call on the calling thread when there is no job manager. When the job manager doesn't take
+ * the job or cancels it, the coroutine continues without the call, with the result of a
+ * failed call.
+ */
+class CBlockingCall
+{
+public:
+  CBlockingCall(const CURL& url, std::function<void()> call);
+
+  bool await_ready() const noexcept { return false; }
+  bool await_suspend(std::coroutine_handle<> handle);
+  void await_resume() const noexcept {}
+
+private:
+  class CJob;
+
+  std::string m_url;
+  std::function<void()> m_call;
+};
+
+/*!
+ * \brief Coroutine versions of the blocking CFile and CDirectory calls.
+ *
+ * Lets scanners and loaders keep many requests in flight from a few coroutines instead of a
+ * thread or a job per request. The file must not be used by anything else until the call
+ * returned.
+ */
+CTask<bool> OpenAsync(CFile& file, const CURL& url, unsigned int flags = 0);
+CTask<ssize_t> ReadAsync(CFile& file, const CURL& url, void* buffer, size_t size);
+CTask<bool> GetDirectoryAsync(const CURL& url,
+                              CFileItemList& items,
+                              const CDirectory::CHints& hints);
+
+} // namespace XFILE
@@ -402,6 +402,7 @@ void ProcessPlaylist(PlaylistMap& playlists, PlaylistInformation& titleInfo, Cli
 
 bool GetPlaylistsInformation(const CURL& url,
                              const std::string& realPath,
+                             const std::string& discId,
                              int flags,
                              CFileItemList& allTitles,
                              ClipMap& clips,
@@ -412,7 +413,7 @@ bool GetPlaylistsInformation(const CURL& url,
   {
     // Check cache
     const std::string& path{url.GetHostName()};
-    if (CServiceBroker::GetBlurayDiscCache()->GetMaps(path, playlists, clips, allTitles))
+    if (CServiceBroker::GetBlurayDiscCache()->GetMaps(path, discId, playlists, clips, allTitles))
     {
       CLog::LogF(LOGDEBUG, "Playlist information for {} retrieved from cache", path);
       return false;
@@ -455,7 +456,7 @@ bool GetPlaylistsInformation(const CURL& url,
     CLog::LogF(LOGDEBUG, "*** Playlist information End ***");
 
     // Cache
-    CServiceBroker::GetBlurayDiscCache()->SetMaps(path, playlists, clips, allTitles);
+    CServiceBroker::GetBlurayDiscCache()->SetMaps(path, discId, playlists, clips, allTitles);
     CLog::LogF(LOGDEBUG, "Playlist information for {} cached", path);
 
     return true;
@@ -625,7 +626,8 @@ bool CBlurayDirectory::GetDirectory(const CURL& url, CFileItemList& items)
     ClipMap clips;
     PlaylistMap playlists;
     CFileItemList allTitles;
-    GetPlaylistsInformation(m_url, m_realPath, m_flags, allTitles, clips, playlists, m_clipCache);
+    GetPlaylistsInformation(m_url, m_realPath, GetBlurayID(), m_flags, allTitles, clips, playlists,
+                            m_clipCache);
 
     CDiscDirectoryHelper helper;
 
@@ -8,12 +8,83 @@
 
 #include "BlurayDiscCache.h"
 
+#include "FileItem.h"
 #include "URL.h"
 #include "bluray/PlaylistStructure.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "utils/Archive.h"
+#include "utils/Digest.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <chrono>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 using namespace XFILE;
+using KODI::UTILITY::CDigest;
+
+namespace
+{
+// The maps of the discs opened in the previous sessions, reparsing all the playlists of a disc
+// image on a network share takes seconds
+constexpr const char* MAPS_FOLDER = "special://temp/bluraycache/";
+constexpr int MAPS_FILE_VERSION = 1;
+constexpr int MAX_MAPS_FILES = 100;
+
+// Without a volume id the disc id of libbluray is all zeros, it doesn't tell the discs apart
+bool IsDiscIdKnown(const std::string& discId)
+{
+  return discId.find_first_not_of('0') != std::string::npos;
+}
+
+void ArchiveDuration(CArchive& ar, std::chrono::milliseconds duration)
+{
+  ar << static_cast<long long>(duration.count());
+}
+
+std::chrono::milliseconds LoadDuration(CArchive& ar)
+{
+  long long duration;
+  ar >> duration;
+  return std::chrono::milliseconds(duration);
+}
+
+template<typename T>
+void ArchiveVector(CArchive& ar, const std::vector<T>& values)
+{
+  ar << values.size();
+  for (const auto& value : values)
+  {
+    if constexpr (std::is_same_v<T, std::chrono::milliseconds>)
+      ArchiveDuration(ar, value);
+    else
+      ar << value;
+  }
+}
+
+template<typename T>
+void LoadVector(CArchive& ar, std::vector<T>& values)
+{
+  size_t size;
+  ar >> size;
+  values.clear();
+  for (size_t i = 0; i < size; ++i)
+  {
+    if constexpr (std::is_same_v<T, std::chrono::milliseconds>)
+      values.emplace_back(LoadDuration(ar));
+    else
+    {
+      T value;
+      ar >> value;
+      values.emplace_back(value);
+    }
+  }
+}
+} // namespace
 
 CacheMap::iterator CBlurayDiscCache::SetDisc(const std::string& path)
 {
@@ -45,9 +116,20 @@ void CBlurayDiscCache::SetPlaylistInfo(const std::string& path,
 }
 
 void CBlurayDiscCache::SetMaps(const std::string& path,
+                               const std::string& discId,
                                const PlaylistMap& playlistmap,
                                const ClipMap& clipmap,
                                const CFileItemList& itemmap)
+{
+  SetCachedMaps(path, playlistmap, clipmap, itemmap);
+  if (IsDiscIdKnown(discId))
+    SaveMaps(GetMapsFile(path, discId), playlistmap, clipmap, itemmap);
+}
+
+void CBlurayDiscCache::SetCachedMaps(const std::string& path,
+                                     const PlaylistMap& playlistmap,
+                                     const ClipMap& clipmap,
+                                     const CFileItemList& itemmap)
 {
   std::unique_lock lock(m_cs);
 
@@ -107,9 +189,25 @@ bool CBlurayDiscCache::GetPlaylistInfo(const std::string& path,
 }
 
 bool CBlurayDiscCache::GetMaps(const std::string& path,
+                               const std::string& discId,
                                PlaylistMap& playlistmap,
                                ClipMap& clipmap,
-                               CFileItemList& itemmap) const
+                               CFileItemList& itemmap)
+{
+  if (GetCachedMaps(path, playlistmap, clipmap, itemmap))
+    return true;
+
+  if (!IsDiscIdKnown(discId) || !LoadMaps(GetMapsFile(path, discId), playlistmap, clipmap, itemmap))
+    return false;
+
+  SetCachedMaps(path, playlistmap, clipmap, itemmap);
+  return true;
+}
+
+bool CBlurayDiscCache::GetCachedMaps(const std::string& path,
+                                     PlaylistMap& playlistmap,
+                                     ClipMap& clipmap,
+                                     CFileItemList& itemmap) const
 {
   std::unique_lock lock(m_cs);
 
@@ -171,3 +269,135 @@ void CBlurayDiscCache::Clear()
   std::unique_lock lock(m_cs);
   m_cache.clear();
 }
+
+std::string CBlurayDiscCache::GetMapsFile(const std::string& path, const std::string& discId)
+{
+  // The item paths depend on the path the disc was opened from
+  std::string storedPath{CURL(path).GetWithoutOptions()};
+  URIUtils::RemoveSlashAtEnd(storedPath);
+
+  return URIUtils::AddFileToFolder(
+      MAPS_FOLDER, CDigest::Calculate(CDigest::Type::MD5, discId + "|" + storedPath) + ".cache");
+}
+
+void CBlurayDiscCache::SaveMaps(const std::string& file,
+                                const PlaylistMap& playlistmap,
+                                const ClipMap& clipmap,
+                                const CFileItemList& itemmap)
+{
+  if (!CDirectory::Exists(MAPS_FOLDER) && !CDirectory::Create(MAPS_FOLDER))
+    return;
+
+  CFile cacheFile;
+  if (!cacheFile.OpenForWrite(file, true))
+  {
+    CLog::LogF(LOGWARNING, "Unable to save the playlist information to {}", file);
+    return;
+  }
+
+  CArchive ar(&cacheFile, CArchive::store);
+  ar << MAPS_FILE_VERSION;
+
+  // only the members set by the directory when it builds the maps
+  ar << playlistmap.size();
+  for (const auto& [playlist, info] : playlistmap)
+  {
+    ar << playlist;
+    ArchiveDuration(ar, info.duration);
+    ArchiveVector(ar, info.clips);
+    ArchiveVector(ar, info.chapters);
+    ar << info.languages;
+  }
+
+  ar << clipmap.size();
+  for (const auto& [clip, info] : clipmap)
+  {
+    ar << clip;
+    ArchiveDuration(ar, info.duration);
+    ArchiveVector(ar, info.playlists);
+  }
+
+  CFileItemList items;
+  items.Copy(itemmap);
+  ar << items;
+  ar.Close();
+  cacheFile.Close();
+
+  PruneMapsFiles();
+}
+
+bool CBlurayDiscCache::LoadMaps(const std::string& file,
+                                PlaylistMap& playlistmap,
+                                ClipMap& clipmap,
+                                CFileItemList& itemmap)
+{
+  CFile cacheFile;
+  if (!cacheFile.Open(file))
+    return false;
+
+  try
+  {
+    CArchive ar(&cacheFile, CArchive::load);
+    int version;
+    ar >> version;
+    if (version != MAPS_FILE_VERSION)
+      return false;
+
+    PlaylistMap playlists;
+    size_t size;
+    ar >> size;
+    for (size_t i = 0; i < size; ++i)
+    {
+      PlaylistInformation info;
+      ar >> info.playlist;
+      info.duration = LoadDuration(ar);
+      LoadVector(ar, info.clips);
+      LoadVector(ar, info.chapters);
+      ar >> info.languages;
+      playlists[info.playlist] = std::move(info);
+    }
+
+    ClipMap clips;
+    ar >> size;
+    for (size_t i = 0; i < size; ++i)
+    {
+      unsigned int clip;
+      ar >> clip;
+      ClipInfo& info{clips[clip]};
+      info.duration = LoadDuration(ar);
+      LoadVector(ar, info.playlists);
+    }
+
+    CFileItemList items;
+    ar >> items;
+    ar.Close();
+
+    playlistmap = std::move(playlists);
+    clipmap = std::move(clips);
+    itemmap.Copy(items);
+  }
+  catch (const std::out_of_range&)
+  {
+    CLog::LogF(LOGERROR, "Corrupt playlist information {}", file);
+    cacheFile.Close();
+    CFile::Delete(file);
+    return false;
+  }
+
+  CLog::LogF(LOGDEBUG, "Playlist information loaded from {}", file);
+  return true;
+}
+
+void CBlurayDiscCache::PruneMapsFiles()
+{
+  CFileItemList items;
+  if (!CDirectory::GetDirectory(MAPS_FOLDER, items, ".cache", DIR_FLAG_NO_FILE_DIRS))
+    return;
+  if (items.Size() <= MAX_MAPS_FILES)
+    return;
+
+  // the oldest go first
+  items.Sort(SortBy::DATE, SortOrder::ASCENDING);
+  for (int i = 0; i < items.Size() - MAX_MAPS_FILES; ++i)
+    CFile::Delete(items[i]->GetPath());
+}
@@ -48,7 +48,12 @@ public:
   void SetPlaylistInfo(const std::string& path,
                        unsigned int playlist,
                        const BlurayPlaylistInformation& playlistInfo);
+  /*!
+   * \brief Cache the playlists of a disc and the titles made of them.
+   * \param discId the id of the disc, when not empty the maps are also saved for the next sessions
+   */
   void SetMaps(const std::string& path,
+               const std::string& discId,
                const PlaylistMap& playlistmap,
                const ClipMap& clipmap,
                const CFileItemList& itemmap);
@@ -59,10 +64,16 @@ public:
   bool GetPlaylistInfo(const std::string& path,
                        unsigned int playlist,
                        BlurayPlaylistInformation& playlistInfo) const;
+  /*!
+   * \brief Get the cached playlists of a disc and the titles made of them.
+   * \param discId the id of the disc, when not empty the maps saved by a previous session are
+   * loaded if they aren't cached yet
+   */
   bool GetMaps(const std::string& path,
+               const std::string& discId,
                PlaylistMap& playlistmap,
                ClipMap& clipmap,
-               CFileItemList& itemmap) const;
+               CFileItemList& itemmap);
   bool GetPlaylistStreamInfo(const std::string& path,
                              unsigned int playlist,
                              StreamMap& streams) const;
@@ -70,6 +81,26 @@ public:
   void ClearDisc(const std::string& path);
 
 private:
+  void SetCachedMaps(const std::string& path,
+                     const PlaylistMap& playlistmap,
+                     const ClipMap& clipmap,
+                     const CFileItemList& itemmap);
+  bool GetCachedMaps(const std::string& path,
+                     PlaylistMap& playlistmap,
+                     ClipMap& clipmap,
+                     CFileItemList& itemmap) const;
+
+  static std::string GetMapsFile(const std::string& path, const std::string& discId);
+  static void SaveMaps(const std::string& file,
+                       const PlaylistMap& playlistmap,
+                       const ClipMap& clipmap,
+                       const CFileItemList& itemmap);
+  static bool LoadMaps(const std::string& file,
+                       PlaylistMap& playlistmap,
+                       ClipMap& clipmap,
+                       CFileItemList& itemmap);
+  static void PruneMapsFiles();
+
   CacheMap m_cache;
 
   mutable CCriticalSection m_cs;
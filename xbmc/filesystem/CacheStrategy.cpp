@@ -445,3 +445,19 @@ CCacheStrategy *CDoubleCache::CreateNew()
   return new CDoubleCache(m_pCache->CreateNew());
 }
 
+bool CDoubleCache::ReadsSourceDirectly()
+{
+  return m_pCache->ReadsSourceDirectly();
+}
+
+int64_t CDoubleCache::FillFromSource(size_t iSize)
+{
+  return m_pCache->FillFromSource(iSize);
+}
+
+bool CDoubleCache::Resize(size_t front, size_t back)
+{
+  if (m_pCacheOld)
+    m_pCacheOld->Resize(front, back);
+  return m_pCache->Resize(front, back);
+}
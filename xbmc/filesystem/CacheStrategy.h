@@ -55,6 +55,28 @@ public:
 
   virtual CCacheStrategy *CreateNew() = 0;
 
+  /*!
+   \brief Whether the strategy fetches data from the source itself
+   \return true if FillFromSource() is used to fill the cache instead of WriteToCache()
+   */
+  virtual bool ReadsSourceDirectly() { return false; }
+
+  /*!
+   \brief Make up to iSize more bytes of the source available for reading
+   \param iSize maximum amount of data to make available, as returned by GetMaxWriteSize()
+   \return number of bytes made available, 0 at end of source, CACHE_RC_ERROR on failure
+   \sa ReadsSourceDirectly
+   */
+  virtual int64_t FillFromSource(size_t iSize) { return CACHE_RC_ERROR; }
+
+  /*!
+   \brief Change the amount of memory used by the cache, keeping the cached forward data
+   \param front new forward buffer size
+   \param back new guaranteed back buffer size
+   \return false if not supported or the current forward data does not fit yet
+   */
+  virtual bool Resize(size_t front, size_t back) { return false; }
+
   CEvent m_space;
 protected:
   bool  m_bEndOfInput = false;
@@ -124,6 +146,10 @@ public:
 
   CCacheStrategy *CreateNew() override;
 
+  bool ReadsSourceDirectly() override;
+  int64_t FillFromSource(size_t iSize) override;
+  bool Resize(size_t front, size_t back) override;
+
 protected:
   CCacheStrategy *m_pCache;
   CCacheStrategy *m_pCacheOld;
@@ -277,3 +277,59 @@ CCacheStrategy *CCircularCache::CreateNew()
   return new CCircularCache(m_size - m_size_back, m_size_back);
 }
 
+bool CCircularCache::Resize(size_t front, size_t back)
+{
+  std::unique_lock lock(m_sync);
+
+  const size_t size = front + back;
+  if (size == m_size)
+  {
+    m_size_back = back;
+    return true;
+  }
+
+  // never drop data that was not read yet
+  if (m_buf == NULL || m_end - m_cur > static_cast<int64_t>(front))
+    return false;
+
+#ifdef TARGET_WINDOWS
+  HANDLE handle = CreateFileMapping(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, size, NULL);
+  if (handle == NULL)
+    return false;
+  uint8_t* buf = (uint8_t*)MapViewOfFile(handle, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+  if (buf == NULL)
+  {
+    CloseHandle(handle);
+    return false;
+  }
+#else
+  uint8_t* buf = new uint8_t[size];
+#endif
+
+  // move the newest data over, keeping as much of the back buffer as fits
+  const int64_t beg = std::max(m_beg, m_end - static_cast<int64_t>(size));
+  for (int64_t pos = beg; pos < m_end;)
+  {
+    const size_t src = pos % m_size;
+    const size_t dst = pos % size;
+    const size_t len = std::min({static_cast<size_t>(m_end - pos), m_size - src, size - dst});
+    memcpy(buf + dst, m_buf + src, len);
+    pos += len;
+  }
+
+#ifdef TARGET_WINDOWS
+  UnmapViewOfFile(m_buf);
+  CloseHandle(m_handle);
+  m_handle = handle;
+#else
+  delete[] m_buf;
+#endif
+  m_buf = buf;
+  m_beg = beg;
+  m_size = size;
+  m_size_back = back;
+
+  m_space.Set();
+
+  return true;
+}
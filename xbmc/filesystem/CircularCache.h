@@ -37,6 +37,8 @@ public:
     bool IsCachedPosition(int64_t iFilePosition) override;
 
     CCacheStrategy *CreateNew() override;
+
+    bool Resize(size_t front, size_t back) override;
 protected:
   int64_t m_beg = 0; /**< index in file (not buffer) of beginning of valid data */
   int64_t m_end = 0; /**< index in file (not buffer) of end of valid data */
@@ -530,6 +530,10 @@ void CCurlFile::SetCommonOptions(CReadState* state, bool failOnError /* = true *
   // resolves. Unfortunately, c-ares does not yet support IPv6.
   g_curlInterface.easy_setopt(h, CURLOPT_NOSIGNAL, CURL_ON);
 
+  // share DNS lookups and TLS sessions with the other sessions
+  if (g_curlInterface.GetShare())
+    g_curlInterface.easy_setopt(h, CURLOPT_SHARE, g_curlInterface.GetShare());
+
   if (failOnError)
   {
     // not interested in failed requests
@@ -83,6 +83,7 @@ namespace XFILE
       void SetBufferSize(unsigned int size);
 
       const CHttpHeader& GetHttpHeader() const { return m_state->m_httpheader; }
+      long GetResponseCode() const { return m_httpresponse; }
       const std::string& GetURL() const { return m_url; }
       std::string GetRedirectURL();
 
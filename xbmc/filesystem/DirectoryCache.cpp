@@ -9,20 +9,35 @@
 #include "DirectoryCache.h"
 
 #include "Directory.h"
+#include "File.h"
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "ServiceBroker.h"
 #include "URL.h"
+#include "jobs/JobManager.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/Archive.h"
+#include "utils/Crc32.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
 #include <algorithm>
 #include <climits>
+#include <ctime>
 #include <mutex>
+#include <stdexcept>
 
 // Maximum number of directories to keep in our cache
 #define MAX_CACHED_DIRS 50
 
+// Folder and format version of the persistent listings
+#define PERSISTENT_CACHE_PATH "special://temp/dircache/"
+#define PERSISTENT_CACHE_VERSION 1
+// Listings without a modification time to validate against expire after this many seconds
+#define PERSISTENT_CACHE_MAX_AGE (24 * 60 * 60)
+
 using namespace XFILE;
 
 namespace
@@ -44,6 +59,40 @@ std::string getDirKey(const CURL& url)
   return dirPath;
 }
 
+std::string getPersistentFile(const std::string& storedPath)
+{
+  return StringUtils::Format(PERSISTENT_CACHE_PATH "{:08x}.dc", Crc32::Compute(storedPath));
+}
+
+struct PersistentHeader
+{
+  std::string path;
+  int cacheType{0};
+  long long modified{0}; //!< modification time of the directory, 0 if the protocol has none
+  long long stored{0};
+};
+
+bool readPersistentHeader(CArchive& ar, PersistentHeader& header)
+{
+  int version = 0;
+  ar >> version;
+  if (version != PERSISTENT_CACHE_VERSION)
+    return false;
+  ar >> header.path;
+  ar >> header.cacheType;
+  ar >> header.modified;
+  ar >> header.stored;
+  return true;
+}
+
+long long getModificationTime(const CURL& url)
+{
+  struct __stat64 buffer = {};
+  if (CFile::Stat(url, &buffer) != 0)
+    return 0;
+  return static_cast<long long>(buffer.st_mtime);
+}
+
 } // Unnamed namespace
 
 CDirectoryCache::CDir::CDir(CacheType cacheType) : m_Items(std::make_unique<CFileItemList>())
@@ -61,6 +110,20 @@ void CDirectoryCache::CDir::SetLastAccess(unsigned int &accessCounter)
   m_lastAccess = accessCounter++;
 }
 
+void CDirectoryCache::CDir::SetLifetime(unsigned int seconds)
+{
+  if (seconds > 0)
+    m_expires = std::chrono::steady_clock::now() + std::chrono::seconds(seconds);
+  else
+    m_expires = {};
+}
+
+bool CDirectoryCache::CDir::IsExpired() const
+{
+  return m_expires != std::chrono::steady_clock::time_point{} &&
+         std::chrono::steady_clock::now() >= m_expires;
+}
+
 CDirectoryCache::CDirectoryCache(void)
 {
   m_accessCounter = 0;
@@ -74,28 +137,41 @@ CDirectoryCache::~CDirectoryCache(void) = default;
 
 bool CDirectoryCache::GetDirectory(const CURL& url, CFileItemList& items, bool retrieveAll)
 {
-  std::unique_lock lock(m_cs);
+  {
+    std::unique_lock lock(m_cs);
 
-  const std::string storedPath = getKey(url);
+    const std::string storedPath = getKey(url);
 
-  auto i = m_cache.find(storedPath);
-  if (i != m_cache.end())
-  {
-    CDir& dir = i->second;
-    if (dir.m_cacheType == CacheType::ALWAYS || (dir.m_cacheType == CacheType::ONCE && retrieveAll))
+    auto i = m_cache.find(storedPath);
+    if (i != m_cache.end())
     {
-      items.Copy(*dir.m_Items);
-      dir.SetLastAccess(m_accessCounter);
+      CDir& dir = i->second;
+      if (dir.IsExpired())
+        m_cache.erase(i);
+      else if (dir.m_cacheType == CacheType::ALWAYS ||
+          (dir.m_cacheType == CacheType::ONCE && retrieveAll))
+      {
+        items.Copy(*dir.m_Items);
+        dir.SetLastAccess(m_accessCounter);
 #ifdef _DEBUG
-      m_cacheHits += items.Size();
+        m_cacheHits += items.Size();
 #endif
-      return true;
+        return true;
+      }
     }
   }
+
+  // the disk copy needs a stat of the directory, don't hold the lock during network access
+  if (UsePersistentCache(url))
+    return GetPersistentDirectory(url, items, retrieveAll);
+
   return false;
 }
 
-void CDirectoryCache::SetDirectory(const CURL& url, const CFileItemList& items, CacheType cacheType)
+void CDirectoryCache::SetDirectory(const CURL& url,
+                                   const CFileItemList& items,
+                                   CacheType cacheType,
+                                   unsigned int lifetime)
 {
   if (cacheType == CacheType::NEVER)
     return; // nothing to do
@@ -121,13 +197,22 @@ void CDirectoryCache::SetDirectory(const CURL& url, const CFileItemList& items,
   CDir dir(cacheType);
   dir.m_Items->Copy(items);
   dir.SetLastAccess(m_accessCounter);
+  dir.SetLifetime(lifetime);
   m_cache.emplace(storedPath, std::move(dir));
+  lock.unlock();
+
+  // the disk copy has no notion of the lifetime
+  if (lifetime == 0 && UsePersistentCache(url))
+    SetPersistentDirectory(url, items, cacheType);
 }
 
 void CDirectoryCache::ClearFile(const CURL& url)
 {
   const std::string dirPath = getDirKey(url);
   m_cache.erase(dirPath);
+
+  if (UsePersistentCache(url))
+    ClearPersistentDirectory(dirPath);
 }
 
 void CDirectoryCache::ClearDirectory(const CURL& url)
@@ -136,6 +221,10 @@ void CDirectoryCache::ClearDirectory(const CURL& url)
 
   const std::string storedPath = getKey(url);
   m_cache.erase(storedPath);
+  lock.unlock();
+
+  if (UsePersistentCache(url))
+    ClearPersistentDirectory(storedPath);
 }
 
 void CDirectoryCache::ClearSubPaths(const CURL& url)
@@ -145,14 +234,22 @@ void CDirectoryCache::ClearSubPaths(const CURL& url)
   const std::string storedPath = getKey(url);
   std::erase_if(m_cache, [&storedPath](const auto& i)
                 { return URIUtils::PathHasParent(i.first, storedPath); });
+  lock.unlock();
+
+  if (UsePersistentCache(url))
+    ClearPersistentSubPaths(storedPath);
 }
 
 void CDirectoryCache::AddFile(const CURL& url)
 {
-  std::unique_lock lock(m_cs);
-
   const std::string dirPath = getDirKey(url);
 
+  // the listing on disk can't be updated in place, the next browse writes it again
+  if (UsePersistentCache(url))
+    ClearPersistentDirectory(dirPath);
+
+  std::unique_lock lock(m_cs);
+
   const auto i{m_cache.find(dirPath)};
   if (i != m_cache.cend())
   {
@@ -194,6 +291,22 @@ void CDirectoryCache::Clear()
   m_cache.clear();
 }
 
+void CDirectoryCache::Trim()
+{
+  std::unique_lock lock(m_cs);
+  std::erase_if(m_cache, [](const auto& dir)
+                { return dir.second.m_cacheType != CacheType::ALWAYS || dir.second.IsExpired(); });
+}
+
+unsigned int CDirectoryCache::GetItemCount() const
+{
+  std::unique_lock lock(m_cs);
+  unsigned int count = 0;
+  for (const auto& [path, dir] : m_cache)
+    count += dir.m_Items->Size();
+  return count;
+}
+
 void CDirectoryCache::InitCache(const std::set<std::string>& dirs)
 {
   for (const std::string& dirPath : dirs)
@@ -213,6 +326,9 @@ void CDirectoryCache::CheckIfFull()
 {
   std::unique_lock lock(m_cs);
 
+  // listings with a lifetime are kept as always cached, drop the ones that are past it
+  std::erase_if(m_cache, [](const auto& dir) { return dir.second.IsExpired(); });
+
   // find the last accessed folder, and remove if the number of cached folders is too many
   auto lastAccessed = m_cache.end();
   unsigned int numCached = 0;
@@ -231,6 +347,173 @@ void CDirectoryCache::CheckIfFull()
     m_cache.erase(lastAccessed);
 }
 
+bool CDirectoryCache::UsePersistentCache(const CURL& url)
+{
+  const auto settingsComponent = CServiceBroker::GetSettingsComponent();
+  if (!settingsComponent)
+    return false;
+  const auto advancedSettings = settingsComponent->GetAdvancedSettings();
+  if (!advancedSettings || !advancedSettings->m_dirCachePersistent)
+    return false;
+
+  const std::string& path = url.Get();
+  return URIUtils::IsSmb(path) || URIUtils::IsNfs(path) || URIUtils::IsDAV(path) ||
+         URIUtils::IsUPnP(path);
+}
+
+bool CDirectoryCache::GetPersistentDirectory(const CURL& url,
+                                             CFileItemList& items,
+                                             bool retrieveAll)
+{
+  const std::string storedPath = getKey(url);
+  const std::string cacheFile = getPersistentFile(storedPath);
+
+  PersistentHeader header;
+  CFileItemList cached;
+  {
+    std::unique_lock lock(m_persistCs);
+
+    CFile file;
+    if (!file.Open(cacheFile))
+      return false;
+
+    try
+    {
+      CArchive ar(&file, CArchive::load);
+      if (!readPersistentHeader(ar, header) || header.path != storedPath)
+        return false;
+      ar >> cached;
+    }
+    catch (const std::out_of_range&)
+    {
+      CLog::Log(LOGERROR, "{} - corrupt listing cache {}", __FUNCTION__,
+                CURL::GetRedacted(cacheFile));
+      file.Close();
+      CFile::Delete(cacheFile);
+      return false;
+    }
+  }
+
+  const CacheType cacheType = static_cast<CacheType>(header.cacheType);
+  if (header.modified != 0)
+  {
+    if (getModificationTime(url) != header.modified)
+      return false;
+  }
+  else if ((!retrieveAll && cacheType != CacheType::ALWAYS) ||
+           std::time(nullptr) - header.stored > PERSISTENT_CACHE_MAX_AGE)
+    return false;
+
+  CLog::Log(LOGDEBUG, "{} - using {} cached items for {}", __FUNCTION__, cached.Size(),
+            url.GetRedacted());
+
+  // keep it in memory as well, so FileExists() and friends benefit from it
+  {
+    std::unique_lock lock(m_cs);
+    m_cache.erase(storedPath);
+    CheckIfFull();
+
+    CDir dir(cacheType);
+    dir.m_Items->Copy(cached);
+    dir.SetLastAccess(m_accessCounter);
+    m_cache.emplace(storedPath, std::move(dir));
+  }
+
+  items.Copy(cached);
+  return true;
+}
+
+void CDirectoryCache::SetPersistentDirectory(const CURL& url,
+                                             const CFileItemList& items,
+                                             CacheType cacheType)
+{
+  const std::string storedPath = getKey(url);
+
+  unsigned int generation;
+  {
+    std::unique_lock lock(m_persistCs);
+    generation = ++m_persistCounter;
+    m_persistPending[storedPath] = generation;
+  }
+
+  auto list = std::make_shared<CFileItemList>();
+  list->Copy(items);
+
+  // stat and write in the background, the caller is usually waiting to show the listing
+  CServiceBroker::GetJobManager()->Submit(
+      [this, url, storedPath, list, cacheType, generation]()
+      {
+        const long long modified = getModificationTime(url);
+
+        std::unique_lock lock(m_persistCs);
+        const auto it = m_persistPending.find(storedPath);
+        if (it == m_persistPending.end() || it->second != generation)
+          return; // cleared or replaced meanwhile
+        m_persistPending.erase(it);
+
+        CDirectory::Create(PERSISTENT_CACHE_PATH);
+
+        CFile file;
+        if (!file.OpenForWrite(getPersistentFile(storedPath), true))
+          return;
+
+        CArchive ar(&file, CArchive::store);
+        ar << PERSISTENT_CACHE_VERSION;
+        ar << storedPath;
+        ar << static_cast<int>(cacheType);
+        ar << modified;
+        ar << static_cast<long long>(std::time(nullptr));
+        ar << *list;
+        ar.Close();
+        file.Close();
+      },
+      CJob::PRIORITY_LOW);
+}
+
+void CDirectoryCache::ClearPersistentDirectory(const std::string& storedPath)
+{
+  std::unique_lock lock(m_persistCs);
+  m_persistPending.erase(storedPath);
+
+  const std::string cacheFile = getPersistentFile(storedPath);
+  if (CFile::Exists(cacheFile, false))
+    CFile::Delete(cacheFile);
+}
+
+void CDirectoryCache::ClearPersistentSubPaths(const std::string& storedPath)
+{
+  std::unique_lock lock(m_persistCs);
+  std::erase_if(m_persistPending, [&storedPath](const auto& i)
+                { return URIUtils::PathHasParent(i.first, storedPath); });
+
+  // file names are hashes, the path is only known from the header
+  CFileItemList files;
+  if (!CDirectory::GetDirectory(PERSISTENT_CACHE_PATH, files, ".dc", DIR_FLAG_BYPASS_CACHE))
+    return;
+
+  for (const auto& item : files)
+  {
+    PersistentHeader header;
+    CFile file;
+    if (!file.Open(item->GetPath()))
+      continue;
+
+    bool remove = true;
+    try
+    {
+      CArchive ar(&file, CArchive::load);
+      remove = !readPersistentHeader(ar, header) || URIUtils::PathHasParent(header.path, storedPath);
+    }
+    catch (const std::out_of_range&)
+    {
+    }
+    file.Close();
+
+    if (remove)
+      CFile::Delete(item->GetPath());
+  }
+}
+
 #ifdef _DEBUG
 void CDirectoryCache::PrintStats() const
 {
@@ -11,6 +11,7 @@
 #include "IDirectory.h"
 #include "threads/CriticalSection.h"
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <set>
@@ -33,6 +34,9 @@ namespace XFILE
       void SetLastAccess(unsigned int &accessCounter);
       unsigned int GetLastAccess() const { return m_lastAccess; }
 
+      void SetLifetime(unsigned int seconds);
+      bool IsExpired() const;
+
       std::unique_ptr<CFileItemList> m_Items;
       CacheType m_cacheType;
 
@@ -40,16 +44,29 @@ namespace XFILE
       CDir(const CDir&) = delete;
       CDir& operator=(const CDir&) = delete;
       unsigned int m_lastAccess;
+      std::chrono::steady_clock::time_point m_expires; //!< default constructed if it never expires
     };
   public:
     CDirectoryCache(void);
     virtual ~CDirectoryCache(void);
     bool GetDirectory(const CURL& url, CFileItemList& items, bool retrieveAll = false);
-    void SetDirectory(const CURL& url, const CFileItemList& items, CacheType cacheType);
+    /*! \brief Cache a copy of the listing.
+     \param lifetime seconds after which the listing is dropped, 0 keeps it until it's cleared
+     */
+    void SetDirectory(const CURL& url,
+                      const CFileItemList& items,
+                      CacheType cacheType,
+                      unsigned int lifetime = 0);
     void ClearDirectory(const CURL& url);
     void ClearFile(const CURL& url);
     void ClearSubPaths(const CURL& url);
     void Clear();
+    /*! \brief Drop the listings that aren't always cached, to give memory back.
+     */
+    void Trim();
+    /*! \brief Number of items in the cached listings.
+     */
+    unsigned int GetItemCount() const;
     void AddFile(const CURL& url);
     bool FileExists(const CURL& url, bool& foundInCache);
 #ifdef _DEBUG
@@ -60,6 +77,16 @@ namespace XFILE
     void ClearCache(std::set<std::string>& dirs);
     void CheckIfFull();
 
+    /*! \brief On disk copy of network listings, see <network><persistentdircache>.
+     Listings are validated against the modification time of the directory (one stat instead of
+     a full listing), protocols without one are only served for DIR_FLAG_READ_CACHE requests.
+     */
+    static bool UsePersistentCache(const CURL& url);
+    bool GetPersistentDirectory(const CURL& url, CFileItemList& items, bool retrieveAll);
+    void SetPersistentDirectory(const CURL& url, const CFileItemList& items, CacheType cacheType);
+    void ClearPersistentDirectory(const std::string& storedPath);
+    void ClearPersistentSubPaths(const std::string& storedPath);
+
     struct StringHash
     {
       using is_transparent = void; // Enables heterogeneous operations.
@@ -76,6 +103,11 @@ namespace XFILE
 
     unsigned int m_accessCounter;
 
+    //! pending writes of persistent listings, a clear in between cancels them
+    std::unordered_map<std::string, unsigned int, StringHash, std::equal_to<>> m_persistPending;
+    unsigned int m_persistCounter{0};
+    CCriticalSection m_persistCs;
+
 #ifdef _DEBUG
     unsigned int m_cacheHits;
     unsigned int m_cacheMisses;
@@ -16,6 +16,19 @@
 
 namespace XCURL
 {
+namespace
+{
+void ShareLock(CURL_HANDLE* handle, curl_lock_data data, curl_lock_access access, void* userptr)
+{
+  static_cast<CCriticalSection*>(userptr)[data].lock();
+}
+
+void ShareUnlock(CURL_HANDLE* handle, curl_lock_data data, void* userptr)
+{
+  static_cast<CCriticalSection*>(userptr)[data].unlock();
+}
+} // unnamed namespace
+
 CURLcode DllLibCurl::global_init(long flags)
 {
   return curl_global_init(flags);
@@ -56,6 +69,16 @@ CURL_HANDLE* DllLibCurl::easy_duphandle(CURL_HANDLE* handle)
   return curl_easy_duphandle(handle);
 }
 
+CURLSH* DllLibCurl::share_init()
+{
+  return curl_share_init();
+}
+
+CURLSHcode DllLibCurl::share_cleanup(CURLSH* share)
+{
+  return curl_share_cleanup(share);
+}
+
 CURLM* DllLibCurl::multi_init()
 {
   return curl_multi_init();
@@ -119,6 +142,17 @@ DllLibCurlGlobal::DllLibCurlGlobal()
   {
     CLog::Log(LOGERROR, "Error initializing libcurl");
   }
+
+  // connections stay with their session, libcurl doesn't support sharing them across threads
+  m_share = share_init();
+  if (m_share)
+  {
+    share_setopt(m_share, CURLSHOPT_LOCKFUNC, ShareLock);
+    share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, ShareUnlock);
+    share_setopt(m_share, CURLSHOPT_USERDATA, m_shareLocks);
+    share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+  }
 }
 
 DllLibCurlGlobal::~DllLibCurlGlobal()
@@ -132,6 +166,8 @@ DllLibCurlGlobal::~DllLibCurlGlobal()
     if (session.m_multi)
       multi_cleanup(session.m_multi);
   }
+  if (m_share && share_cleanup(m_share) != CURLSHE_OK)
+    CLog::Log(LOGWARNING, "Share handle of libcurl still in use");
   // close libcurl
   curl_global_cleanup();
 }
@@ -47,6 +47,13 @@ public:
   }
   void easy_cleanup(CURL_HANDLE* handle);
   virtual CURL_HANDLE* easy_duphandle(CURL_HANDLE* handle);
+  CURLSH* share_init();
+  template<typename... Args>
+  CURLSHcode share_setopt(CURLSH* share, CURLSHoption option, Args... args)
+  {
+    return curl_share_setopt(share, option, std::forward<Args>(args)...);
+  }
+  CURLSHcode share_cleanup(CURLSH* share);
   CURLM* multi_init(void);
   CURLMcode multi_add_handle(CURLM* multi_handle, CURL_HANDLE* easy_handle);
   CURLMcode multi_perform(CURLM* multi_handle, int* running_handles);
@@ -82,6 +89,13 @@ public:
   CURL_HANDLE* easy_duphandle(CURL_HANDLE* easy_handle) override;
   void CheckIdle();
 
+  /*!
+   * \brief The share handle for CURLOPT_SHARE, it holds the DNS cache and the TLS sessions of all
+   * the easy handles. A new connection to a host resumes the TLS session of an earlier one, no
+   * matter which session it belongs to.
+   */
+  CURLSH* GetShare() const { return m_share; }
+
   /* overloaded load and unload with reference counter */
 
   /* structure holding a session info */
@@ -100,6 +114,10 @@ public:
 
   VEC_CURLSESSIONS m_sessions;
   CCriticalSection m_critSection;
+
+private:
+  CURLSH* m_share{nullptr};
+  CCriticalSection m_shareLocks[CURL_LOCK_DATA_LAST];
 };
 } // namespace XCURL
 
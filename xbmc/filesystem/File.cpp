@@ -24,12 +24,194 @@
 #endif
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/Condition.h"
+#include "threads/Thread.h"
 #include "utils/BitstreamStats.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
+#include "utils/XTimeUtils.h"
 #include "utils/log.h"
 
+#include <array>
+#include <mutex>
+
 using namespace XFILE;
+using namespace std::chrono_literals;
+
+namespace
+{
+// two of them are in use while copying, large enough to keep network shares streaming
+constexpr int COPY_BUFFER_SIZE = 4 * 1024 * 1024;
+// times a copy carries on from where reading or writing failed, for network hiccups
+constexpr int COPY_RESUME_ATTEMPTS = 3;
+constexpr auto COPY_RESUME_DELAY = 1s;
+
+/*!
+ * \brief Reads the source of a copy ahead on its own thread, so reading and writing overlap
+ */
+class CCopyReader : public CThread
+{
+public:
+  struct Chunk
+  {
+    std::vector<char> data;
+    size_t size = 0;
+  };
+
+  CCopyReader(CFile& file, const std::string& path, size_t bufferSize)
+    : CThread("FileCopy"), m_file(file), m_path(path)
+  {
+    for (Chunk& chunk : m_chunks)
+      chunk.data.resize(bufferSize);
+  }
+
+  ~CCopyReader() override { Abort(); }
+
+  /*!
+   * \brief Wait for the next chunk, nullptr at the end of the file or if reading failed
+   */
+  const Chunk* GetChunk()
+  {
+    std::unique_lock lock(m_section);
+    m_condition.wait(m_section, [this] { return m_filled > 0 || m_eof || m_failed; });
+    return m_filled > 0 ? &m_chunks[m_readIndex] : nullptr;
+  }
+
+  /*!
+   * \brief Hand the chunk of GetChunk() back to be filled again
+   */
+  void ReleaseChunk()
+  {
+    {
+      std::unique_lock lock(m_section);
+      m_readIndex ^= 1;
+      --m_filled;
+    }
+    m_condition.notifyAll();
+  }
+
+  bool Failed() const
+  {
+    std::unique_lock lock(m_section);
+    return m_failed;
+  }
+
+  void Abort()
+  {
+    {
+      std::unique_lock lock(m_section);
+      m_bStop = true;
+    }
+    m_condition.notifyAll();
+    StopThread();
+  }
+
+protected:
+  void Process() override
+  {
+    while (true)
+    {
+      {
+        std::unique_lock lock(m_section);
+        m_condition.wait(m_section, [this] { return m_filled < m_chunks.size() || m_bStop; });
+        if (m_bStop)
+          return;
+      }
+
+      // the chunk being filled isn't handed out until it's counted as filled
+      Chunk& chunk = m_chunks[m_writeIndex];
+      const ssize_t read = Read(chunk);
+
+      {
+        std::unique_lock lock(m_section);
+        if (read < 0)
+          m_failed = true;
+        else if (read == 0)
+          m_eof = true;
+        else
+        {
+          chunk.size = static_cast<size_t>(read);
+          m_writeIndex ^= 1;
+          ++m_filled;
+        }
+      }
+      m_condition.notifyAll();
+
+      if (read <= 0)
+        return;
+    }
+  }
+
+private:
+  ssize_t Read(Chunk& chunk)
+  {
+    bool open = true;
+    for (int attempt = 0;; ++attempt)
+    {
+      if (open)
+      {
+        const ssize_t read = m_file.Read(chunk.data.data(), chunk.data.size());
+        if (read >= 0)
+        {
+          m_position += read;
+          return read;
+        }
+      }
+
+      if (attempt == COPY_RESUME_ATTEMPTS || m_bStop)
+        return -1;
+
+      CLog::Log(LOGWARNING, "CFile::Copy - read failed at {} of {}, resuming", m_position,
+                CURL::GetRedacted(m_path));
+      Sleep(COPY_RESUME_DELAY);
+      m_file.Close();
+      open = m_file.Open(m_path, READ_TRUNCATED | READ_NO_BUFFER) &&
+             m_file.Seek(m_position, SEEK_SET) == static_cast<int64_t>(m_position);
+    }
+  }
+
+  CFile& m_file;
+  const std::string m_path;
+  int64_t m_position = 0;
+
+  mutable CCriticalSection m_section;
+  XbmcThreads::ConditionVariable m_condition;
+  std::array<Chunk, 2> m_chunks;
+  unsigned int m_filled = 0;
+  unsigned int m_readIndex = 0;
+  unsigned int m_writeIndex = 0;
+  bool m_eof = false;
+  bool m_failed = false;
+};
+
+bool WriteResuming(CFile& file, const CURL& dest, int64_t position, const char* data, size_t size)
+{
+  bool open = true;
+  for (int attempt = 0;; ++attempt)
+  {
+    size_t written = 0;
+    while (open && written < size)
+    {
+      const ssize_t write = file.Write(data + written, size - written);
+      if (write <= 0)
+        break;
+      written += write;
+    }
+    if (open && written == size)
+      return true;
+
+    if (attempt == COPY_RESUME_ATTEMPTS)
+      return false;
+
+    CLog::Log(LOGWARNING, "CFile::Copy - write failed at {} of {}, resuming", position,
+              dest.GetRedacted());
+    KODI::TIME::Sleep(COPY_RESUME_DELAY);
+    file.Close();
+    // the whole chunk is written again from where it started
+    open = file.OpenForWrite(dest, false) && file.Seek(position, SEEK_SET) == position;
+  }
+}
+} // unnamed namespace
 
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
@@ -110,6 +292,21 @@ bool CFile::Copy(const CURL& url2, const CURL& dest, XFILE::IFileCallback* pCall
         }
       }
     }
+    // let the server copy the file if it can, then the data doesn't travel here and back
+    const CURL serverSource(URIUtils::SubstitutePath(url));
+    const CURL serverDest(URIUtils::SubstitutePath(dest));
+    if (serverSource.GetProtocol() == serverDest.GetProtocol())
+    {
+      std::unique_ptr<IFile> loader(CFileFactory::CreateLoader(serverSource));
+      if (loader && loader->CopyOnServer(URIUtils::AddCredentials(serverSource),
+                                         URIUtils::AddCredentials(serverDest), pCallback,
+                                         pContext))
+      {
+        file.Close();
+        return true;
+      }
+    }
+
     if (CFile::Exists(dest))
       CFile::Delete(dest);
     if (!newFile.OpenForWrite(dest, true))  // overwrite always
@@ -118,10 +315,11 @@ bool CFile::Copy(const CURL& url2, const CURL& dest, XFILE::IFileCallback* pCall
       return false;
     }
 
-    int iBufferSize = DetermineChunkSize(file.GetChunkSize(), 128 * 1024);
-
-    std::vector<char> buffer(iBufferSize);
-    ssize_t iRead, iWrite;
+    // a multiple of the chunk size of the source
+    const int chunkSize = file.GetChunkSize();
+    const int bufferSize = chunkSize > 1
+                               ? (COPY_BUFFER_SIZE + chunkSize - 1) / chunkSize * chunkSize
+                               : COPY_BUFFER_SIZE;
 
     unsigned long long llFileSize = file.GetLength();
     unsigned long long llPos = 0;
@@ -131,37 +329,34 @@ bool CFile::Copy(const CURL& url2, const CURL& dest, XFILE::IFileCallback* pCall
     float start = 0.0f;
     auto& components = CServiceBroker::GetAppComponents();
     const auto appPower = components.GetComponent<CApplicationPowerHandling>();
+
+    CCopyReader reader(file, url.Get(), bufferSize);
+    reader.Create();
     while (true)
     {
       appPower->ResetScreenSaver();
 
-      iRead = file.Read(buffer.data(), buffer.size());
-      if (iRead == 0) break;
-      else if (iRead < 0)
+      const CCopyReader::Chunk* chunk = reader.GetChunk();
+      if (!chunk)
       {
-        CLog::Log(LOGERROR, "{} - Failed read from file {}", __FUNCTION__, url.GetRedacted());
-        llFileSize = (uint64_t)-1;
+        if (reader.Failed())
+        {
+          CLog::Log(LOGERROR, "{} - Failed read from file {}", __FUNCTION__, url.GetRedacted());
+          llFileSize = (uint64_t)-1;
+        }
         break;
       }
 
       /* write data and make sure we managed to write it all */
-      iWrite = 0;
-      while(iWrite < iRead)
-      {
-        ssize_t iWrite2 = newFile.Write(buffer.data() + iWrite, iRead - iWrite);
-        if(iWrite2 <=0)
-          break;
-        iWrite+=iWrite2;
-      }
-
-      if (iWrite != iRead)
+      if (!WriteResuming(newFile, dest, llPos, chunk->data.data(), chunk->size))
       {
         CLog::Log(LOGERROR, "{} - Failed write to file {}", __FUNCTION__, dest.GetRedacted());
         llFileSize = (uint64_t)-1;
         break;
       }
 
-      llPos += iRead;
+      llPos += chunk->size;
+      reader.ReleaseChunk();
 
       // calculate the current and average speeds
       float end = timer.GetElapsedSeconds();
@@ -185,6 +380,7 @@ bool CFile::Copy(const CURL& url2, const CURL& dest, XFILE::IFileCallback* pCall
     }
 
     /* close both files */
+    reader.Abort();
     newFile.Close();
     file.Close();
 
@@ -9,8 +9,11 @@
 #include "FileCache.h"
 
 #include "CircularCache.h"
+#include "CurlFile.h"
+#include "RangeReadAhead.h"
 #include "ServiceBroker.h"
 #include "URL.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "threads/Thread.h"
@@ -28,11 +31,28 @@
 #include <memory>
 
 #ifdef TARGET_POSIX
+#include "MappedFileCache.h"
+#include "SpecialProtocol.h"
 #include "platform/posix/ConvUtils.h"
+#include "platform/posix/filesystem/PosixFile.h"
+#endif
+
+#if defined(HAVE_LIBURING)
+#include "UringReadAhead.h"
 #endif
 
 using namespace XFILE;
 
+namespace
+{
+// adaptive memory cache: playback time to buffer, lower bound and re-evaluation interval
+constexpr size_t ADAPTIVE_CACHE_SECONDS = 60;
+constexpr size_t ADAPTIVE_CACHE_MIN_SIZE = 4 * 1024 * 1024;
+constexpr auto ADAPTIVE_CACHE_INTERVAL = std::chrono::seconds(10);
+// smaller files are buffered quickly enough over a single connection
+constexpr int64_t RANGE_READ_AHEAD_MIN_SIZE = 64 * 1024 * 1024;
+} // namespace
+
 class CWriteRate
 {
 public:
@@ -135,6 +155,47 @@ bool CFileCache::Open(const CURL& url)
 
   m_fileSize = m_source.GetLength();
 
+  const auto advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+
+#if defined(TARGET_POSIX)
+  // plain local files (including kernel mounted shares) can be accessed by path directly
+  std::string localPath;
+  if (dynamic_cast<CPosixFile*>(m_source.GetImplementation()))
+    localPath = CURL(CSpecialProtocol::TranslatePath(url)).GetFileName();
+
+  const bool mapSource =
+      !localPath.empty() && cacheMemSize > 0 && advancedSettings->m_cacheMapLocalFiles;
+#endif
+
+#if defined(HAVE_LIBURING)
+  // keep several reads in flight on local files, this mostly helps kernel mounted network shares
+  const int readAheadDepth = advancedSettings->m_cacheReadAheadDepth;
+  if (readAheadDepth > 1 && !localPath.empty() && !mapSource)
+  {
+    m_readAhead = std::make_unique<CUringReadAhead>();
+    if (m_readAhead->Open(localPath, m_chunkSize, readAheadDepth))
+      CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> using io_uring read-ahead with {} reads in flight",
+                __FUNCTION__, m_sourcePath, readAheadDepth);
+    else
+      m_readAhead.reset();
+  }
+#endif
+
+  // fetch several ranges of large HTTP files at once, a single connection on a high latency link
+  // only gets a fraction of the bandwidth
+  const int rangeConnections = advancedSettings->m_cacheRangeConnections;
+  if (rangeConnections > 1 && m_seekPossible == 1 && m_fileSize >= RANGE_READ_AHEAD_MIN_SIZE &&
+      (url.IsProtocol("http") || url.IsProtocol("https")) &&
+      dynamic_cast<CCurlFile*>(m_source.GetImplementation()))
+  {
+    m_rangeReadAhead = std::make_unique<CRangeReadAhead>();
+    if (m_rangeReadAhead->Open(url, m_fileSize, rangeConnections))
+      CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> fetching ranges over {} connections",
+                __FUNCTION__, m_sourcePath, rangeConnections);
+    else
+      m_rangeReadAhead.reset();
+  }
+
   if (!m_pCache)
   {
     if (cacheMemSize == 0)
@@ -143,6 +204,7 @@ bool CFileCache::Open(const CURL& url)
       m_pCache = std::make_unique<CSimpleFileCache>();
       m_forwardCacheSize = 0;
       m_maxForward = m_fileSize;
+      m_cacheSizeLimit = 0;
     }
     else
     {
@@ -183,9 +245,30 @@ bool CFileCache::Open(const CURL& url)
       const size_t back = cacheSize / 4;
       const size_t front = cacheSize - back;
 
-      m_pCache = std::make_unique<CCircularCache>(front, back);
+#if defined(TARGET_POSIX)
+      if (mapSource)
+      {
+        CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> serving cache from a {} bytes mapping window",
+                  __FUNCTION__, m_sourcePath, cacheSize);
+        m_pCache = std::make_unique<CMappedFileCache>(localPath, front, back);
+      }
+      else
+#endif
+        m_pCache = std::make_unique<CCircularCache>(front, back);
       m_forwardCacheSize = front;
       m_maxForward = m_forwardCacheSize;
+
+      // size audio/video buffers by their bitrate, so low bitrate streams don't pin the whole
+      // configured memory while high bitrate ones can use all of it
+      m_cacheSize = cacheSize;
+      m_cacheSizeLimit = 0;
+#if defined(TARGET_POSIX)
+      if (!mapSource)
+#endif
+      {
+        if ((m_flags & READ_AUDIO_VIDEO) && advancedSettings->m_cacheAdaptiveSize)
+          m_cacheSizeLimit = cacheSize;
+      }
     }
 
     if (m_flags & READ_MULTI_STREAM)
@@ -206,6 +289,7 @@ bool CFileCache::Open(const CURL& url)
   m_readPos = 0;
   m_writePos = 0;
   m_writeRate = 1024 * 1024;
+  m_writeRateSet = false;
   m_writeRateActual = 0;
   m_writeRateLowSpeed = 0;
   m_bFilling = true;
@@ -228,6 +312,7 @@ void CFileCache::Process()
 
   // create our read buffer
   std::unique_ptr<char[]> buffer(new char[m_chunkSize]);
+  const bool directFill = m_pCache->ReadsSourceDirectly();
   if (buffer == nullptr)
   {
     CLog::Log(LOGERROR, "CFileCache::{} - <{}> failed to allocate read buffer", __FUNCTION__,
@@ -245,6 +330,8 @@ void CFileCache::Process()
 
   CWriteRate limiter;
   CWriteRate average;
+  CWriteRate consumption;
+  auto nextAdaptTime = std::chrono::steady_clock::now() + ADAPTIVE_CACHE_INTERVAL;
 
   while (!m_bStop)
   {
@@ -259,9 +346,19 @@ void CFileCache::Process()
       const bool cacheReachEOF = (cacheMaxPos == m_fileSize);
 
       bool sourceSeekFailed = false;
-      if (!cacheReachEOF)
+      if (!cacheReachEOF && m_rangeReadAhead)
+      {
+        // the ranges are fetched over their own connections, the source isn't read anymore
+        m_rangeReadAhead->Seek(cacheMaxPos);
+        m_nSeekResult = cacheMaxPos;
+      }
+      else if (!cacheReachEOF)
       {
         m_nSeekResult = m_source.Seek(cacheMaxPos, SEEK_SET);
+#if defined(HAVE_LIBURING)
+        if (m_readAhead && m_nSeekResult == cacheMaxPos)
+          m_readAhead->Seek(cacheMaxPos);
+#endif
         if (m_nSeekResult != cacheMaxPos)
         {
           CLog::Log(LOGERROR, "CFileCache::{} - <{}> error {} seeking. Seek returned {}",
@@ -279,6 +376,7 @@ void CFileCache::Process()
         assert(m_writePos == cacheMaxPos);
         average.Reset(m_writePos, bCompleteReset); // Can only recalculate new average from scratch after a full reset (empty cache)
         limiter.Reset(m_writePos);
+        consumption.Reset(m_readPos);
         m_nSeekResult = m_seekPos;
         if (bCompleteReset)
         {
@@ -338,7 +436,18 @@ void CFileCache::Process()
 
     ssize_t iRead = 0;
     if (maxSourceRead > 0)
-      iRead = m_source.Read(buffer.get(), maxSourceRead);
+    {
+      if (directFill)
+        iRead = m_pCache->FillFromSource(maxSourceRead);
+      else if (m_rangeReadAhead)
+        iRead = m_rangeReadAhead->Read(buffer.get(), maxSourceRead);
+#if defined(HAVE_LIBURING)
+      else if (m_readAhead)
+        iRead = m_readAhead->Read(buffer.get(), maxSourceRead);
+      else
+#endif
+        iRead = m_source.Read(buffer.get(), maxSourceRead);
+    }
     if (iRead <= 0)
     {
       // Check for actual EOF and retry as long as we still have data in our cache
@@ -388,7 +497,8 @@ void CFileCache::Process()
       }
     }
 
-    int iTotalWrite = 0;
+    // a strategy reading the source itself already holds the data
+    int iTotalWrite = directFill ? static_cast<int>(iRead) : 0;
     while (!m_bStop && (iTotalWrite < iRead))
     {
       int iWrite = 0;
@@ -441,9 +551,46 @@ void CFileCache::Process()
         m_bFilling = false;
       }
     }
+
+    if (m_cacheSizeLimit > 0 && std::chrono::steady_clock::now() >= nextAdaptTime)
+    {
+      AdaptCacheSize(consumption.Rate(m_readPos));
+      nextAdaptTime = std::chrono::steady_clock::now() + ADAPTIVE_CACHE_INTERVAL;
+    }
   }
 }
 
+void CFileCache::AdaptCacheSize(uint32_t readRate)
+{
+  // the rate given by the player is the stream bitrate, trust it over the measured one
+  if (m_writeRateSet)
+    readRate = std::max(readRate, m_writeRate);
+  if (readRate == 0)
+    return;
+
+  const size_t minSize =
+      std::min(std::max<size_t>(ADAPTIVE_CACHE_MIN_SIZE, m_chunkSize * 2), m_cacheSizeLimit);
+  const size_t target = std::clamp<size_t>(static_cast<size_t>(readRate) * ADAPTIVE_CACHE_SECONDS,
+                                           minSize, m_cacheSizeLimit);
+
+  // grow right away, only shrink when well below the current size to avoid reallocating on
+  // every small bitrate change
+  if (target == m_cacheSize || (target < m_cacheSize && target * 2 > m_cacheSize))
+    return;
+
+  const size_t back = target / 4;
+  const size_t front = target - back;
+  if (!m_pCache->Resize(front, back))
+    return; // unread data doesn't fit yet, try again later
+
+  CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> resized memory cache from {} to {} bytes for {} B/s",
+            __FUNCTION__, m_sourcePath, m_cacheSize, target, readRate);
+
+  m_cacheSize = target;
+  m_forwardCacheSize = front;
+  m_maxForward = front;
+}
+
 void CFileCache::OnExit()
 {
   m_bStop = true;
@@ -583,6 +730,10 @@ void CFileCache::Close()
   if (m_pCache)
     m_pCache->Close();
 
+#if defined(HAVE_LIBURING)
+  m_readAhead.reset();
+#endif
+  m_rangeReadAhead.reset();
   m_source.Close();
 }
 
@@ -629,6 +780,7 @@ int CFileCache::IoControl(IOControl request, void* param)
   if (request == IOControl::CACHE_SETRATE)
   {
     m_writeRate = *static_cast<uint32_t*>(param);
+    m_writeRateSet = true;
 
     const double mBits = m_writeRate / 1024.0 / 1024.0 * 8.0; // Mbit/s
 
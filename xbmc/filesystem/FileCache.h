@@ -22,6 +22,10 @@ using namespace std::chrono_literals;
 
 namespace XFILE
 {
+  class CRangeReadAhead;
+#if defined(HAVE_LIBURING)
+  class CUringReadAhead;
+#endif
 
   class CFileCache : public IFile, public CThread
   {
@@ -58,9 +62,15 @@ namespace XFILE
     }
 
   private:
+    void AdaptCacheSize(uint32_t readRate);
+
     std::unique_ptr<CCacheStrategy> m_pCache;
     int m_seekPossible = 0;
     CFile m_source;
+#if defined(HAVE_LIBURING)
+    std::unique_ptr<CUringReadAhead> m_readAhead;
+#endif
+    std::unique_ptr<CRangeReadAhead> m_rangeReadAhead;
     std::string m_sourcePath;
     CEvent m_seekEvent;
     CEvent m_seekEnded;
@@ -70,10 +80,13 @@ namespace XFILE
     int64_t m_writePos = 0;
     unsigned m_chunkSize = 0;
     uint32_t m_writeRate = 0;
+    bool m_writeRateSet = false;
     uint32_t m_writeRateActual = 0;
     uint32_t m_writeRateLowSpeed = 0;
     int64_t m_forwardCacheSize = 0;
     int64_t m_maxForward = 0;
+    size_t m_cacheSize = 0;
+    size_t m_cacheSizeLimit = 0; // 0 if the cache size is not adapted to the stream
     bool m_bFilling = false;
     std::atomic<int64_t> m_fileSize;
     unsigned int m_flags;
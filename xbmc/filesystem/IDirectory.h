@@ -136,6 +136,13 @@ public:
   */
   virtual CacheType GetCacheType(const CURL& url) const { return CacheType::ONCE; }
 
+  /*!
+  \brief How long a listing cached as CacheType::ALWAYS stays valid
+  \param url Directory at hand.
+  \return Returns the lifetime in seconds, 0 keeps it until the cache is cleared.
+  */
+  virtual unsigned int GetCacheLifetime(const CURL& url) const { return 0; }
+
   void SetMask(const std::string& strMask);
   void SetFlags(int flags);
 
@@ -133,6 +133,19 @@ public:
 
   virtual bool Delete(const CURL& url) { return false; }
   virtual bool Rename(const CURL& url, const CURL& urlnew) { return false; }
+
+  /*!
+   \brief Copy a file within the server, without the data going through this device.
+   \param pCallback progress of the copy and to cancel it, may be null
+   \return false if not supported between these files or failed, the data is then copied by CFile
+   */
+  virtual bool CopyOnServer(const CURL& url,
+                            const CURL& urlnew,
+                            IFileCallback* pCallback,
+                            void* pContext)
+  {
+    return false;
+  }
   virtual bool SetHidden(const CURL& url, bool hidden) { return false; }
 
   virtual int IoControl(IOControl request, void* param) { return -1; }
@@ -0,0 +1,292 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MappedFileCache.h"
+
+#include "threads/SystemClock.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+CMappedFileCache::CMappedFileCache(const std::string& path, size_t front, size_t back)
+  : m_path(path), m_size(front + back), m_sizeBack(back)
+{
+}
+
+CMappedFileCache::~CMappedFileCache()
+{
+  Close();
+}
+
+int CMappedFileCache::Open()
+{
+  Close();
+
+  m_fd = open(m_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (m_fd < 0)
+  {
+    CLog::Log(LOGERROR, "CMappedFileCache::{} - failed to open <{}>: {}", __FUNCTION__, m_path,
+              strerror(errno));
+    return CACHE_RC_ERROR;
+  }
+
+  const long pageSize = sysconf(_SC_PAGESIZE);
+  if (pageSize > 0)
+    m_pageSize = static_cast<size_t>(pageSize);
+
+  m_fileSize = GetFileSize();
+  m_beg = 0;
+  m_end = 0;
+  m_cur = 0;
+
+  if (!MapWindow(0))
+  {
+    Close();
+    return CACHE_RC_ERROR;
+  }
+
+  return CACHE_RC_OK;
+}
+
+void CMappedFileCache::Close()
+{
+  UnmapWindow();
+
+  if (m_fd >= 0)
+  {
+    close(m_fd);
+    m_fd = -1;
+  }
+}
+
+size_t CMappedFileCache::GetMaxWriteSize(const size_t& iRequestSize)
+{
+  std::unique_lock lock(m_sync);
+
+  const size_t back = static_cast<size_t>(m_cur - m_beg);
+  const size_t front = static_cast<size_t>(m_end - m_cur);
+  const size_t limit = m_size - std::min(back, m_sizeBack) - front;
+
+  return std::min(iRequestSize, limit);
+}
+
+int CMappedFileCache::WriteToCache(const char* pBuffer, size_t iSize)
+{
+  // data comes straight from the mapped source, see FillFromSource()
+  return CACHE_RC_ERROR;
+}
+
+int64_t CMappedFileCache::FillFromSource(size_t iSize)
+{
+  int64_t start;
+  int64_t end;
+  {
+    std::unique_lock lock(m_sync);
+
+    // the file may still be growing (e.g. a recording in progress)
+    if (m_end + static_cast<int64_t>(iSize) > m_fileSize)
+      m_fileSize = GetFileSize();
+
+    start = m_end;
+    end = std::min(m_end + static_cast<int64_t>(iSize), m_fileSize);
+    if (end <= start)
+      return 0;
+
+    // Slide the window forward, GetMaxWriteSize() made sure the guaranteed back buffer is kept.
+    // A window left behind by a failed remap in Reset() is replaced here as well.
+    if (start < m_mapOffset || end > m_mapOffset + static_cast<int64_t>(m_mapLength))
+    {
+      if (!MapWindow(start < m_mapOffset ? start : end - static_cast<int64_t>(m_size)))
+        return CACHE_RC_ERROR;
+    }
+  }
+
+  // Fault the pages in without holding the lock, so the reader can keep consuming meanwhile.
+  // Only this thread ever replaces the mapping.
+  size_t pos = static_cast<size_t>(start - m_mapOffset);
+  pos -= pos % m_pageSize;
+  const size_t last = static_cast<size_t>(end - m_mapOffset);
+  madvise(m_map + pos, last - pos, MADV_WILLNEED);
+  for (; pos < last; pos += m_pageSize)
+    static_cast<void>(*static_cast<volatile uint8_t*>(m_map + pos));
+
+  std::unique_lock lock(m_sync);
+  m_end = end;
+  m_written.Set();
+
+  return end - start;
+}
+
+int CMappedFileCache::ReadFromCache(char* pBuffer, size_t iMaxSize)
+{
+  std::unique_lock lock(m_sync);
+
+  const size_t avail = static_cast<size_t>(m_end - m_cur);
+  if (avail == 0)
+  {
+    if (IsEndOfInput())
+      return 0;
+    else
+      return CACHE_RC_WOULD_BLOCK;
+  }
+
+  const size_t len = std::min(iMaxSize, avail);
+  if (len == 0)
+    return 0;
+
+  memcpy(pBuffer, m_map + (m_cur - m_mapOffset), len);
+  m_cur += len;
+
+  m_space.Set();
+
+  return static_cast<int>(len);
+}
+
+int64_t CMappedFileCache::WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout)
+{
+  std::unique_lock lock(m_sync);
+  int64_t avail = m_end - m_cur;
+
+  if (timeout == 0ms || IsEndOfInput())
+    return avail;
+
+  if (iMinAvail > m_size - m_sizeBack)
+    iMinAvail = m_size - m_sizeBack;
+
+  XbmcThreads::EndTime<> endtime{timeout};
+  while (!IsEndOfInput() && avail < iMinAvail && !endtime.IsTimePast())
+  {
+    lock.unlock();
+    m_written.Wait(50ms);
+    lock.lock();
+    avail = m_end - m_cur;
+  }
+
+  return avail;
+}
+
+int64_t CMappedFileCache::Seek(int64_t iFilePosition)
+{
+  std::unique_lock lock(m_sync);
+
+  // faulting in the next few pages is cheaper than a reset of the window
+  if (iFilePosition >= m_end && iFilePosition < m_end + 100000)
+  {
+    m_cur = m_end;
+
+    lock.unlock();
+    WaitForData(static_cast<uint32_t>(iFilePosition - m_cur), 5s);
+    lock.lock();
+  }
+
+  if (iFilePosition >= m_beg && iFilePosition <= m_end)
+  {
+    m_cur = iFilePosition;
+    return iFilePosition;
+  }
+
+  return CACHE_RC_ERROR;
+}
+
+bool CMappedFileCache::Reset(int64_t iSourcePosition)
+{
+  std::unique_lock lock(m_sync);
+  if (IsCachedPosition(iSourcePosition))
+  {
+    m_cur = iSourcePosition;
+    return false;
+  }
+
+  MapWindow(iSourcePosition);
+  m_beg = iSourcePosition;
+  m_end = iSourcePosition;
+  m_cur = iSourcePosition;
+
+  return true;
+}
+
+int64_t CMappedFileCache::CachedDataEndPosIfSeekTo(int64_t iFilePosition)
+{
+  if (IsCachedPosition(iFilePosition))
+    return m_end;
+  return iFilePosition;
+}
+
+int64_t CMappedFileCache::CachedDataStartPos()
+{
+  return m_beg;
+}
+
+int64_t CMappedFileCache::CachedDataEndPos()
+{
+  return m_end;
+}
+
+bool CMappedFileCache::IsCachedPosition(int64_t iFilePosition)
+{
+  return iFilePosition >= m_beg && iFilePosition <= m_end;
+}
+
+CCacheStrategy* CMappedFileCache::CreateNew()
+{
+  return new CMappedFileCache(m_path, m_size - m_sizeBack, m_sizeBack);
+}
+
+bool CMappedFileCache::MapWindow(int64_t position)
+{
+  const int64_t pageSize = static_cast<int64_t>(m_pageSize);
+  const int64_t offset = std::max<int64_t>(position, 0) / pageSize * pageSize;
+  // one extra page so an unaligned window of m_size bytes always fits
+  const size_t length = m_size + m_pageSize;
+
+  void* map = mmap(nullptr, length, PROT_READ, MAP_SHARED, m_fd, static_cast<off_t>(offset));
+  if (map == MAP_FAILED)
+  {
+    CLog::Log(LOGERROR, "CMappedFileCache::{} - failed to map <{}> at {}: {}", __FUNCTION__,
+              m_path, offset, strerror(errno));
+    return false;
+  }
+  madvise(map, length, MADV_SEQUENTIAL);
+
+  UnmapWindow();
+  m_map = static_cast<uint8_t*>(map);
+  m_mapLength = length;
+  m_mapOffset = offset;
+  m_beg = std::max(m_beg, offset);
+
+  return true;
+}
+
+void CMappedFileCache::UnmapWindow()
+{
+  if (m_map)
+  {
+    munmap(m_map, m_mapLength);
+    m_map = nullptr;
+    m_mapLength = 0;
+  }
+}
+
+int64_t CMappedFileCache::GetFileSize()
+{
+  struct stat st;
+  if (fstat(m_fd, &st) != 0)
+    return m_fileSize;
+  return static_cast<int64_t>(st.st_size);
+}
@@ -0,0 +1,77 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "CacheStrategy.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
+
+#include <string>
+
+namespace XFILE
+{
+
+/*!
+ * \brief Cache strategy serving a local file straight from a sliding memory mapping.
+ *
+ * Instead of copying source reads into a private buffer, the cache thread only advances a
+ * window over the mapped file and faults the pages in ahead of the reader. ReadFromCache() then
+ * copies directly out of the page cache, so data is copied once instead of three times. The
+ * window size plays the role of the memory buffer size of CCircularCache, including the
+ * guaranteed back buffer.
+ */
+class CMappedFileCache : public CCacheStrategy
+{
+public:
+  CMappedFileCache(const std::string& path, size_t front, size_t back);
+  ~CMappedFileCache() override;
+
+  int Open() override;
+  void Close() override;
+
+  size_t GetMaxWriteSize(const size_t& iRequestSize) override;
+  int WriteToCache(const char* pBuffer, size_t iSize) override;
+  int ReadFromCache(char* pBuffer, size_t iMaxSize) override;
+  int64_t WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout) override;
+
+  int64_t Seek(int64_t iFilePosition) override;
+  bool Reset(int64_t iSourcePosition) override;
+
+  int64_t CachedDataEndPosIfSeekTo(int64_t iFilePosition) override;
+  int64_t CachedDataStartPos() override;
+  int64_t CachedDataEndPos() override;
+  bool IsCachedPosition(int64_t iFilePosition) override;
+
+  CCacheStrategy* CreateNew() override;
+
+  bool ReadsSourceDirectly() override { return true; }
+  int64_t FillFromSource(size_t iSize) override;
+
+private:
+  bool MapWindow(int64_t position);
+  void UnmapWindow();
+  int64_t GetFileSize();
+
+  std::string m_path;
+  int m_fd = -1;
+  size_t m_size; //!< window size, front + back
+  size_t m_sizeBack; //!< guaranteed size of the back buffer
+  size_t m_pageSize = 4096;
+  uint8_t* m_map = nullptr;
+  size_t m_mapLength = 0;
+  int64_t m_mapOffset = 0; //!< file offset of the mapping, page aligned
+  int64_t m_fileSize = 0;
+  int64_t m_beg = 0; //!< file offset of the first byte still available
+  int64_t m_end = 0; //!< file offset past the last byte faulted in
+  int64_t m_cur = 0; //!< current read position
+  CCriticalSection m_sync;
+  CEvent m_written;
+};
+
+} // namespace XFILE
@@ -17,12 +17,17 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/SystemClock.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
 #include <inttypes.h>
 #include <mutex>
+#include <vector>
 
 #include <nfsc/libnfs-raw-mount.h>
 #include <nfsc/libnfs.h>
@@ -30,9 +35,12 @@
 #ifdef TARGET_WINDOWS
 #include <fcntl.h>
 #include <sys\stat.h>
+#include <winsock2.h>
 #ifndef S_ISDIR
 #define S_ISDIR(m) (((m) & _S_IFDIR) != 0)
 #endif
+#else
+#include <poll.h>
 #endif
 
 #if defined(TARGET_WINDOWS)
@@ -60,8 +68,39 @@ constexpr int NFS4ERR_EXPIRED = -11; // client session expired due idle time gre
 
 constexpr auto SETTING_NFS_VERSION = "nfs.version";
 constexpr auto SETTING_NFS_CHUNKSIZE = "nfs.chunksize";
+
+// reads after opening or seeking before the file is considered to be read sequentially
+constexpr unsigned int SEQUENTIAL_READS = 2;
+// upper limit for the data of the READ calls in flight
+constexpr size_t MAX_READ_AHEAD = 8 * 1024 * 1024;
+constexpr size_t MIN_READ_AHEAD_DEPTH = 2;
+constexpr int POLL_INTERVAL_MS = 100;
+
+int PollContext(struct nfs_context* context, int timeoutMs, short& revents)
+{
+  struct pollfd pfd = {};
+  pfd.fd = nfs_get_fd(context);
+  pfd.events = static_cast<short>(nfs_which_events(context));
+#ifdef TARGET_WINDOWS
+  const int ret = WSAPoll(&pfd, 1, timeoutMs);
+#else
+  const int ret = poll(&pfd, 1, timeoutMs);
+#endif
+  revents = pfd.revents;
+  return ret;
+}
 } // unnamed namespace
 
+struct CNFSFile::ReadRequest
+{
+  CNFSFile* file = nullptr; //!< nullptr once the file dropped the request, the callback frees it
+  int64_t offset = 0;
+  std::vector<char> data;
+  int result = 0; //!< number of bytes read or a negative error
+  bool done = false;
+  std::chrono::steady_clock::time_point sent;
+};
+
 CNfsConnection::CNfsConnection()
   : m_pNfsContext(NULL),
     m_exportPath(""),
@@ -602,19 +641,12 @@ CNFSFile::~CNFSFile()
 
 int64_t CNFSFile::GetPosition()
 {
-  int ret = 0;
-  uint64_t offset = 0;
   std::unique_lock lock(gNfsConnection);
 
   if (gNfsConnection.GetNfsContext() == NULL || m_pFileHandle == NULL) return 0;
 
-  ret = nfs_lseek(gNfsConnection.GetNfsContext(), m_pFileHandle, 0, SEEK_CUR, &offset);
-
-  if (ret < 0)
-  {
-    CLog::Log(LOGERROR, "NFS: Failed to lseek({})", nfs_get_error(gNfsConnection.GetNfsContext()));
-  }
-  return offset;
+  // reads don't move the position of the handle, they are sent with their offset
+  return m_position;
 }
 
 int64_t CNFSFile::GetLength()
@@ -686,6 +718,10 @@ bool CNFSFile::Open(const CURL& url)
   }
 
   m_fileSize = tmpBuffer.st_size;//cache the size of this file
+  m_position = 0;
+  m_sequentialReads = 0;
+  m_minLatency = {};
+  m_chunkTime = {};
   // We've successfully opened the file!
   return true;
 }
@@ -752,11 +788,27 @@ ssize_t CNFSFile::Read(void *lpBuf, size_t uiBufSize)
 
   if (m_pFileHandle == NULL || m_pNfsContext == NULL )
     return -1;
+
+  // a file that is still growing is read past the size it had when it was opened
+  if (m_sequentialReads >= SEQUENTIAL_READS && m_position < m_fileSize)
+  {
+    numberOfBytesRead = ReadAhead(lpBuf, uiBufSize);
+  }
+  else
+  {
+    DropReads(false);
 #ifdef LIBNFS_API_V2
-  numberOfBytesRead = nfs_read(m_pNfsContext, m_pFileHandle, lpBuf, uiBufSize);
+    numberOfBytesRead = nfs_pread(m_pNfsContext, m_pFileHandle, lpBuf, uiBufSize, m_position);
 #else
-  numberOfBytesRead = nfs_read(m_pNfsContext, m_pFileHandle, uiBufSize, (char *)lpBuf);
+    numberOfBytesRead =
+        nfs_pread(m_pNfsContext, m_pFileHandle, m_position, uiBufSize, (char*)lpBuf);
 #endif
+    if (numberOfBytesRead > 0)
+    {
+      m_position += numberOfBytesRead;
+      m_sequentialReads++;
+    }
+  }
 
   lock.unlock(); //no need to keep the connection lock after that
 
@@ -778,6 +830,12 @@ int64_t CNFSFile::Seek(int64_t iFilePosition, int iWhence)
   std::unique_lock lock(gNfsConnection);
   if (m_pFileHandle == NULL || m_pNfsContext == NULL) return -1;
 
+  // the position of the handle lags behind while reading ahead
+  if (iWhence == SEEK_CUR)
+  {
+    iFilePosition += m_position;
+    iWhence = SEEK_SET;
+  }
 
   ret = nfs_lseek(m_pNfsContext, m_pFileHandle, iFilePosition, iWhence, &offset);
   if (ret < 0)
@@ -786,7 +844,216 @@ int64_t CNFSFile::Seek(int64_t iFilePosition, int iWhence)
               iFilePosition, iWhence, m_fileSize, nfs_get_error(m_pNfsContext));
     return -1;
   }
-  return (int64_t)offset;
+
+  // a short skip forward keeps the reads in flight that are still needed
+  const int64_t target = static_cast<int64_t>(offset);
+  if (!m_reads.empty() && target >= m_position &&
+      target < m_reads.back()->offset + static_cast<int64_t>(m_reads.back()->data.size()))
+  {
+    while (target >= m_reads.front()->offset + static_cast<int64_t>(m_reads.front()->data.size()))
+    {
+      if (!m_reads.front()->done)
+      {
+        m_reads.front()->file = nullptr;
+        m_reads.front().release();
+      }
+      m_reads.pop_front();
+    }
+  }
+  else
+  {
+    DropReads(false);
+    m_sequentialReads = 0;
+  }
+
+  m_position = target;
+  return target;
+}
+
+ssize_t CNFSFile::ReadAhead(void* lpBuf, size_t uiBufSize)
+{
+  if (!QueueReads())
+    return -1;
+
+  const ReadRequest& request = *m_reads.front();
+  if (!WaitForRead(request))
+  {
+    DropReads(false);
+    return -1;
+  }
+
+  if (request.result < 0)
+  {
+    CLog::Log(LOGERROR, "{} - Error( offset: {}, {}, {} )", __FUNCTION__, request.offset,
+              request.result, nfs_get_error(m_pNfsContext));
+    DropReads(false);
+    return -1;
+  }
+
+  // the server may return less than requested, the rest is requested again
+  const int64_t end = request.offset + request.result;
+  const bool shortRead = request.result < static_cast<int>(request.data.size());
+  if (m_position >= end)
+  {
+    DropReads(false);
+    return request.result == 0 ? 0 : ReadAhead(lpBuf, uiBufSize);
+  }
+
+  const size_t offset = static_cast<size_t>(m_position - request.offset);
+  const size_t amount = std::min(uiBufSize, static_cast<size_t>(request.result) - offset);
+  std::memcpy(lpBuf, request.data.data() + offset, amount);
+  m_position += amount;
+
+  if (m_position == end)
+  {
+    if (shortRead)
+      DropReads(false);
+    else
+      m_reads.pop_front();
+  }
+
+  // the requests behind it keep the server busy while the caller processes the data
+  QueueReads();
+  return static_cast<ssize_t>(amount);
+}
+
+bool CNFSFile::QueueReads()
+{
+  const size_t chunkSize = std::max<size_t>(gNfsConnection.GetMaxReadChunkSize(), 1);
+  const size_t depth = GetReadAheadDepth(chunkSize);
+
+  int64_t next = m_position;
+  if (!m_reads.empty())
+    next = m_reads.back()->offset + static_cast<int64_t>(m_reads.back()->data.size());
+
+  while (m_reads.size() < depth && next < m_fileSize)
+  {
+    auto request = std::make_unique<ReadRequest>();
+    request->file = this;
+    request->offset = next;
+    request->data.resize(static_cast<size_t>(std::min<int64_t>(chunkSize, m_fileSize - next)));
+    request->sent = std::chrono::steady_clock::now();
+
+#ifdef LIBNFS_API_V2
+    const int ret = nfs_pread_async(m_pNfsContext, m_pFileHandle, request->data.data(),
+                                    request->data.size(), next, ReadCallback, request.get());
+#else
+    const int ret = nfs_pread_async(m_pNfsContext, m_pFileHandle, next, request->data.size(),
+                                    ReadCallback, request.get());
+#endif
+    if (ret != 0)
+    {
+      CLog::Log(LOGERROR, "{} - Error( offset: {}, {} )", __FUNCTION__, next,
+                nfs_get_error(m_pNfsContext));
+      return !m_reads.empty();
+    }
+
+    next += static_cast<int64_t>(request->data.size());
+    m_reads.emplace_back(std::move(request));
+  }
+  return !m_reads.empty();
+}
+
+bool CNFSFile::WaitForRead(const ReadRequest& request)
+{
+  const uint32_t timeout =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_nfsTimeout;
+  XbmcThreads::EndTime<> endTime{timeout > 0 ? std::chrono::milliseconds(timeout * 1000)
+                                             : XbmcThreads::EndTime<>::Max()};
+
+  // replies for other files of the context are processed as well, the connection is locked
+  while (!request.done)
+  {
+    short revents = 0;
+    const int ret = PollContext(m_pNfsContext, POLL_INTERVAL_MS, revents);
+    if (ret < 0 && errno != EINTR)
+    {
+      CLog::Log(LOGERROR, "{} - poll failed ({})", __FUNCTION__, errno);
+      return false;
+    }
+
+    if (nfs_service(m_pNfsContext, ret > 0 ? revents : 0) < 0)
+    {
+      CLog::Log(LOGERROR, "{} - Error( {} )", __FUNCTION__, nfs_get_error(m_pNfsContext));
+      return false;
+    }
+
+    if (!request.done && endTime.IsTimePast())
+    {
+      CLog::Log(LOGERROR, "{} - no reply for the read at {} after {}s", __FUNCTION__,
+                request.offset, timeout);
+      return false;
+    }
+  }
+  return true;
+}
+
+void CNFSFile::DropReads(bool wait)
+{
+  for (auto& request : m_reads)
+  {
+    if (!request->done && wait)
+      WaitForRead(*request);
+
+    // the callback frees a request that is still in flight
+    if (!request->done)
+    {
+      request->file = nullptr;
+      request.release();
+    }
+  }
+  m_reads.clear();
+}
+
+size_t CNFSFile::GetReadAheadDepth(size_t chunkSize) const
+{
+  const size_t maxDepth = std::max(MIN_READ_AHEAD_DEPTH, MAX_READ_AHEAD / chunkSize);
+  if (m_chunkTime.count() <= 0)
+    return MIN_READ_AHEAD_DEPTH;
+
+  // enough chunks to keep the link busy for a round trip, the bandwidth delay product
+  const size_t depth = static_cast<size_t>(m_minLatency / m_chunkTime) + 1;
+  return std::clamp(depth, MIN_READ_AHEAD_DEPTH, maxDepth);
+}
+
+void CNFSFile::ReadCallback(int status, struct nfs_context* nfs, void* data, void* privateData)
+{
+  auto* request = static_cast<ReadRequest*>(privateData);
+  if (!request->file)
+  {
+    delete request;
+    return;
+  }
+
+#ifndef LIBNFS_API_V2
+  // older versions return the data in their own buffer
+  if (status > 0)
+  {
+    status = std::min(status, static_cast<int>(request->data.size()));
+    std::memcpy(request->data.data(), data, static_cast<size_t>(status));
+  }
+#endif
+  request->result = status;
+  request->done = true;
+  request->file->ReadCompleted(*request);
+}
+
+void CNFSFile::ReadCompleted(const ReadRequest& request)
+{
+  using namespace std::chrono;
+
+  if (request.result <= 0)
+    return;
+
+  // the quickest reply is a round trip, the gaps between the replies give the transfer time
+  const auto now = steady_clock::now();
+  const auto latency = now - request.sent;
+  const auto busy = now - std::max(request.sent, m_lastCompletion);
+  m_lastCompletion = now;
+
+  if (m_minLatency.count() == 0 || latency < m_minLatency)
+    m_minLatency = latency;
+  m_chunkTime = m_chunkTime.count() == 0 ? busy : (m_chunkTime * 7 + busy) / 8;
 }
 
 int CNFSFile::Truncate(int64_t iSize)
@@ -818,6 +1085,8 @@ void CNFSFile::Close()
     // remove it from keep alive list before closing
     // so keep alive code doesn't process it anymore
     gNfsConnection.removeFromKeepAliveList(m_pFileHandle);
+    // the replies of the reads in flight refer to the handle
+    DropReads(true);
     ret = nfs_close(m_pNfsContext, m_pFileHandle);
 
 	  if (ret < 0)
@@ -828,6 +1097,8 @@ void CNFSFile::Close()
     m_pFileHandle = NULL;
     m_pNfsContext = NULL;
     m_fileSize = 0;
+    m_position = 0;
+    m_sequentialReads = 0;
     m_exportPath.clear();
   }
 }
@@ -882,6 +1153,7 @@ ssize_t CNFSFile::Write(const void* lpBuf, size_t uiBufSize)
       break;
     }
   }
+  m_position += numberOfBytesWritten;
   //return total number of written bytes
   return numberOfBytesWritten;
 }
@@ -985,6 +1257,8 @@ bool CNFSFile::OpenForWrite(const CURL& url, bool bOverWrite)
   {
     m_fileSize = 0;
   }
+  m_position = 0;
+  m_sequentialReads = 0;
 
   // We've successfully opened the file!
   return true;
@@ -15,8 +15,10 @@
 #include "threads/CriticalSection.h"
 
 #include <chrono>
+#include <deque>
 #include <list>
 #include <map>
+#include <memory>
 
 struct nfs_stat_64;
 
@@ -143,6 +145,24 @@ namespace XFILE
     struct nfsfh *m_pFileHandle;
     struct nfs_context *m_pNfsContext;//current nfs context
     std::string m_exportPath;
+
+  private:
+    // sequential reads keep several READ calls in flight, all of it runs under gNfsConnection
+    struct ReadRequest;
+    static void ReadCallback(int status, struct nfs_context* nfs, void* data, void* privateData);
+    void ReadCompleted(const ReadRequest& request);
+    ssize_t ReadAhead(void* lpBuf, size_t uiBufSize);
+    bool QueueReads();
+    bool WaitForRead(const ReadRequest& request);
+    void DropReads(bool wait);
+    size_t GetReadAheadDepth(size_t chunkSize) const;
+
+    std::deque<std::unique_ptr<ReadRequest>> m_reads; //!< contiguous requests from m_position on
+    int64_t m_position = 0;
+    unsigned int m_sequentialReads = 0; //!< reads since the file was opened or seeked
+    std::chrono::steady_clock::duration m_minLatency{}; //!< round trip of a single read
+    std::chrono::steady_clock::duration m_chunkTime{}; //!< time it takes to transfer a chunk
+    std::chrono::steady_clock::time_point m_lastCompletion;
   };
 }
 
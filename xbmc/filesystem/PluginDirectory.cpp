@@ -89,6 +89,7 @@ bool CPluginDirectory::StartScript(const std::string& strPath, bool resume)
   m_cancelled = false;
   m_success = false;
   m_totalItems = 0;
+  m_cacheLifetime = 0;
 
   // run the script
   return RunScript(this, addon, strPath, resume);
@@ -193,7 +194,11 @@ bool CPluginDirectory::AddItems(int handle, const CFileItemList *items, int tota
   return !dir->m_cancelled;
 }
 
-void CPluginDirectory::EndOfDirectory(int handle, bool success, bool replaceListing, bool cacheToDisc)
+void CPluginDirectory::EndOfDirectory(int handle,
+                                      bool success,
+                                      bool replaceListing,
+                                      bool cacheToDisc,
+                                      unsigned int cacheLifetime)
 {
   std::unique_lock lock(GetScriptsLock());
   CPluginDirectory* dir = GetScriptFromHandle(handle);
@@ -205,6 +210,7 @@ void CPluginDirectory::EndOfDirectory(int handle, bool success, bool replaceList
                                                : CFileItemList::CacheType::NEVER);
 
   dir->m_success = success;
+  dir->m_cacheLifetime = success ? cacheLifetime : 0;
   dir->m_listItems->SetReplaceListing(replaceListing);
 
   if (!dir->m_listItems->HasSortDetails())
@@ -553,6 +559,12 @@ void CPluginDirectory::CancelDirectory()
   m_cancelled = true;
 }
 
+CacheType CPluginDirectory::GetCacheType(const CURL& url) const
+{
+  // the script is run again for each fetch unless it declared how long its listing stays valid
+  return m_cacheLifetime > 0 ? CacheType::ALWAYS : CacheType::ONCE;
+}
+
 float CPluginDirectory::GetProgress() const
 {
   if (m_totalItems > 0)
@@ -34,6 +34,8 @@ public:
   bool Exists(const CURL& url) override { return true; }
   float GetProgress() const override;
   void CancelDirectory() override;
+  CacheType GetCacheType(const CURL& url) const override;
+  unsigned int GetCacheLifetime(const CURL& url) const override { return m_cacheLifetime; }
   static bool RunScriptWithParams(const std::string& strPath, bool resume);
 
   /*! \brief Get a reproducible CFileItem by trying to recursively resolve the plugin paths
@@ -62,7 +64,11 @@ public:
   // callbacks from python
   static bool AddItem(int handle, const CFileItem *item, int totalItems);
   static bool AddItems(int handle, const CFileItemList *items, int totalItems);
-  static void EndOfDirectory(int handle, bool success, bool replaceListing, bool cacheToDisc);
+  static void EndOfDirectory(int handle,
+                             bool success,
+                             bool replaceListing,
+                             bool cacheToDisc,
+                             unsigned int cacheLifetime = 0);
   static void AddSortMethod(int handle,
                             SortMethod sortMethod,
                             const std::string& labelMask,
@@ -88,5 +94,6 @@ private:
   std::atomic<bool> m_cancelled;
   bool m_success = false; // set by script in EndOfDirectory
   int m_totalItems = 0; // set by script in AddDirectoryItem
+  unsigned int m_cacheLifetime = 0; // set by script in EndOfDirectory
 };
 }
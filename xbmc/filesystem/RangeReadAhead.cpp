@@ -0,0 +1,221 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "RangeReadAhead.h"
+
+#include "CurlFile.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+using namespace XFILE;
+using namespace std::chrono_literals;
+
+namespace
+{
+// large segments keep the number of new requests low, every request costs round trips
+constexpr size_t SEGMENT_SIZE = 4 * 1024 * 1024;
+// the data of a segment is made available to the reader in steps of this size
+constexpr size_t FETCH_SIZE = 64 * 1024;
+constexpr auto READ_TIMEOUT = 60s;
+} // unnamed namespace
+
+CRangeReadAhead::~CRangeReadAhead()
+{
+  Close();
+}
+
+bool CRangeReadAhead::Open(const CURL& url, int64_t length, unsigned int connections)
+{
+  Close();
+
+  if (length <= 0 || connections == 0)
+    return false;
+
+  m_length = length;
+  m_maxSegments = connections * 2;
+
+  // the connections are opened at the same time, each of them needs a few round trips
+  unsigned int pending = connections;
+  bool failed = false;
+  for (unsigned int i = 0; i < connections; ++i)
+  {
+    m_files.emplace_back(std::make_unique<CCurlFile>());
+    m_threads.emplace_back(
+        [this, &file = *m_files.back(), url, &pending, &failed]()
+        {
+          const bool opened = file.Open(url);
+
+          std::unique_lock lock(m_section);
+          pending--;
+          if (!opened)
+            failed = true;
+          m_condition.notifyAll();
+          if (opened)
+            Fetch(file, lock);
+        });
+  }
+
+  bool success;
+  {
+    std::unique_lock lock(m_section);
+    m_condition.wait(lock, [&pending]() { return pending == 0; });
+    success = !failed;
+  }
+
+  if (!success)
+  {
+    CLog::Log(LOGDEBUG, "CRangeReadAhead::{} - failed to open {} connections to <{}>",
+              __FUNCTION__, connections, url.GetRedacted());
+    Close();
+  }
+  return success;
+}
+
+void CRangeReadAhead::Close()
+{
+  {
+    std::unique_lock lock(m_section);
+    m_stop = true;
+    Drop();
+    m_condition.notifyAll();
+  }
+
+  // returns once the connection closed its file, a read in progress is aborted
+  for (auto& file : m_files)
+    file->Cancel();
+  for (auto& thread : m_threads)
+    thread.join();
+
+  m_threads.clear();
+  m_files.clear();
+  m_stop = false;
+  m_length = 0;
+  m_position = 0;
+  m_nextOffset = 0;
+}
+
+void CRangeReadAhead::Seek(int64_t position)
+{
+  std::unique_lock lock(m_section);
+  Drop();
+  m_position = position;
+  m_nextOffset = position;
+  m_condition.notifyAll();
+}
+
+ssize_t CRangeReadAhead::Read(char* buffer, size_t size)
+{
+  std::unique_lock lock(m_section);
+  if (m_position >= m_length || size == 0)
+    return 0;
+
+  // the first segment holds the next byte
+  if (!m_condition.wait(lock, READ_TIMEOUT,
+                        [this]()
+                        {
+                          if (m_segments.empty())
+                            return false;
+                          const Segment& segment = *m_segments.front();
+                          return segment.failed ||
+                                 segment.filled > static_cast<size_t>(m_position - segment.offset);
+                        }))
+  {
+    CLog::Log(LOGERROR, "CRangeReadAhead::{} - no data at position {} after {} seconds",
+              __FUNCTION__, m_position, READ_TIMEOUT.count());
+    return -1;
+  }
+
+  std::shared_ptr<Segment> segment = m_segments.front();
+  if (segment->failed)
+  {
+    // fetch the rest again, the caller decides whether to retry
+    CLog::Log(LOGWARNING, "CRangeReadAhead::{} - fetching the segment at {} failed",
+              __FUNCTION__, segment->offset);
+    Drop();
+    m_nextOffset = m_position;
+    m_condition.notifyAll();
+    return -1;
+  }
+
+  const size_t offset = static_cast<size_t>(m_position - segment->offset);
+  const size_t amount = std::min(size, segment->filled - offset);
+  std::memcpy(buffer, segment->data.data() + offset, amount);
+  m_position += amount;
+
+  if (offset + amount == segment->data.size())
+  {
+    m_segments.pop_front();
+    m_condition.notifyAll();
+  }
+  return static_cast<ssize_t>(amount);
+}
+
+void CRangeReadAhead::Fetch(CCurlFile& file, std::unique_lock<CCriticalSection>& lock)
+{
+  while (true)
+  {
+    m_condition.wait(lock,
+                     [this]()
+                     {
+                       return m_stop ||
+                              (m_nextOffset < m_length && m_segments.size() < m_maxSegments);
+                     });
+    if (m_stop)
+      break;
+
+    auto segment = std::make_shared<Segment>();
+    segment->offset = m_nextOffset;
+    segment->data.resize(
+        static_cast<size_t>(std::min<int64_t>(SEGMENT_SIZE, m_length - m_nextOffset)));
+    m_nextOffset += static_cast<int64_t>(segment->data.size());
+    m_segments.push_back(segment);
+    lock.unlock();
+
+    // a connection that fetched the segment before this one continues without a new request
+    bool ok = file.GetPosition() == segment->offset ||
+              file.Seek(segment->offset, SEEK_SET) == segment->offset;
+    while (ok)
+    {
+      // only this connection changes filled, the reader doesn't touch the data behind it
+      const size_t filled = segment->filled;
+      const ssize_t read = file.Read(segment->data.data() + filled,
+                                     std::min(FETCH_SIZE, segment->data.size() - filled));
+
+      lock.lock();
+      if (read > 0)
+        segment->filled += static_cast<size_t>(read);
+      else
+        ok = false;
+      m_condition.notifyAll();
+      if (segment->dropped || segment->filled == segment->data.size())
+        break;
+      lock.unlock();
+    }
+
+    if (!lock.owns_lock())
+      lock.lock();
+    if (!ok && !segment->dropped)
+    {
+      segment->failed = true;
+      m_condition.notifyAll();
+    }
+  }
+
+  lock.unlock();
+  file.Close();
+}
+
+void CRangeReadAhead::Drop()
+{
+  for (auto& segment : m_segments)
+    segment->dropped = true;
+  m_segments.clear();
+}
@@ -0,0 +1,88 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "URL.h"
+#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <sys/types.h>
+
+namespace XFILE
+{
+class CCurlFile;
+
+/*!
+ * \brief Sequential read-ahead on a HTTP file that fetches several byte ranges at once.
+ *
+ * A single connection on a high latency link is limited by its TCP window, not by the
+ * bandwidth. Every connection of this class fetches a segment of the file with a range
+ * request, the segments are returned in order as soon as their data arrives. Used by CFileCache
+ * in place of blocking reads on its source. Read() and Seek() must come from the cache thread.
+ */
+class CRangeReadAhead
+{
+public:
+  CRangeReadAhead() = default;
+  ~CRangeReadAhead();
+
+  CRangeReadAhead(const CRangeReadAhead&) = delete;
+  CRangeReadAhead& operator=(const CRangeReadAhead&) = delete;
+
+  /*!
+   * \brief Open the connections to the file
+   * \param length length of the file, the server must support range requests
+   * \return false if one of the connections can't be opened
+   */
+  bool Open(const CURL& url, int64_t length, unsigned int connections);
+  void Close();
+
+  /*!
+   * \brief Drop all fetched segments and continue reading at position.
+   */
+  void Seek(int64_t position);
+
+  /*!
+   * \brief Read up to size bytes at the current position.
+   * \return number of bytes read, 0 on end of file, -1 on error
+   */
+  ssize_t Read(char* buffer, size_t size);
+
+private:
+  struct Segment
+  {
+    int64_t offset = 0;
+    std::vector<char> data; //!< sized to the segment, filled in by the connection
+    size_t filled = 0;
+    bool failed = false;
+    bool dropped = false; //!< the segment is no longer needed, the connection stops fetching it
+  };
+
+  void Fetch(CCurlFile& file, std::unique_lock<CCriticalSection>& lock);
+  void Drop();
+
+  std::vector<std::unique_ptr<CCurlFile>> m_files;
+  std::vector<std::thread> m_threads;
+  CCriticalSection m_section;
+  XbmcThreads::ConditionVariable m_condition;
+  std::deque<std::shared_ptr<Segment>> m_segments; //!< contiguous segments from m_position on
+  int64_t m_length = 0;
+  int64_t m_position = 0; //!< position of the next byte returned by Read()
+  int64_t m_nextOffset = 0; //!< start of the next segment to fetch
+  size_t m_maxSegments = 0;
+  bool m_stop = false;
+};
+
+} // namespace XFILE
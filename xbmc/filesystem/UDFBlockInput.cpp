@@ -10,10 +10,19 @@
 
 #include "filesystem/File.h"
 
+#include <algorithm>
+#include <cstring>
 #include <mutex>
 
 #include <udfread/udfread.h>
 
+namespace
+{
+// 64k chunks, 1 MiB of cache per opened image
+constexpr uint32_t CHUNK_BLOCKS = 32;
+constexpr size_t MAX_CACHED_CHUNKS = 16;
+} // namespace
+
 int CUDFBlockInput::Close(udfread_block_input* bi)
 {
   auto m_bi = reinterpret_cast<UDF_BI*>(bi);
@@ -36,19 +45,74 @@ int CUDFBlockInput::Read(
   auto m_bi = reinterpret_cast<UDF_BI*>(bi);
   std::unique_lock lock(m_bi->lock);
 
+  // big reads of the file contents are efficient as they are
+  if (blocks >= CHUNK_BLOCKS)
+    return ReadBlocks(m_bi, lba, buf, blocks);
+
+  auto* out = static_cast<uint8_t*>(buf);
+  uint32_t done = 0;
+  while (done < blocks)
+  {
+    const uint32_t block = lba + done;
+    const CachedChunk* chunk = GetChunk(m_bi, block - block % CHUNK_BLOCKS);
+    if (!chunk)
+      return done > 0 ? static_cast<int>(done) : -1;
+    if (block - chunk->lba >= chunk->blocks)
+      break; // end of the image
+
+    const uint32_t count = std::min(blocks - done, chunk->lba + chunk->blocks - block);
+    std::memcpy(out + static_cast<size_t>(done) * UDF_BLOCK_SIZE,
+                chunk->data.data() + static_cast<size_t>(block - chunk->lba) * UDF_BLOCK_SIZE,
+                static_cast<size_t>(count) * UDF_BLOCK_SIZE);
+    done += count;
+  }
+
+  return static_cast<int>(done);
+}
+
+int CUDFBlockInput::ReadBlocks(UDF_BI* bi, uint32_t lba, void* buf, uint32_t blocks)
+{
   int64_t pos = static_cast<int64_t>(lba) * UDF_BLOCK_SIZE;
 
-  if (m_bi->fp->Seek(pos, SEEK_SET) != pos)
+  if (bi->fp->Seek(pos, SEEK_SET) != pos)
     return -1;
 
-  ssize_t size = blocks * UDF_BLOCK_SIZE;
-  ssize_t read = m_bi->fp->Read(buf, size);
+  ssize_t size = static_cast<ssize_t>(blocks) * UDF_BLOCK_SIZE;
+  ssize_t read = bi->fp->Read(buf, size);
   if (read > 0)
     return static_cast<int>(read / UDF_BLOCK_SIZE);
 
   return static_cast<int>(read);
 }
 
+const CUDFBlockInput::CachedChunk* CUDFBlockInput::GetChunk(UDF_BI* bi, uint32_t lba)
+{
+  const auto it = bi->chunksByLba.find(lba);
+  if (it != bi->chunksByLba.end())
+  {
+    bi->chunks.splice(bi->chunks.begin(), bi->chunks, it->second);
+    return &bi->chunks.front();
+  }
+
+  CachedChunk chunk;
+  chunk.lba = lba;
+  chunk.data.resize(static_cast<size_t>(CHUNK_BLOCKS) * UDF_BLOCK_SIZE);
+  const int read = ReadBlocks(bi, lba, chunk.data.data(), CHUNK_BLOCKS);
+  if (read < 0)
+    return nullptr;
+  chunk.blocks = static_cast<uint32_t>(read);
+
+  bi->chunks.emplace_front(std::move(chunk));
+  bi->chunksByLba.emplace(lba, bi->chunks.begin());
+  if (bi->chunks.size() > MAX_CACHED_CHUNKS)
+  {
+    bi->chunksByLba.erase(bi->chunks.back().lba);
+    bi->chunks.pop_back();
+  }
+
+  return &bi->chunks.front();
+}
+
 udfread_block_input* CUDFBlockInput::GetBlockInput(const std::string& file)
 {
   auto fp = std::make_shared<XFILE::CFile>();
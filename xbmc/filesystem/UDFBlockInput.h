@@ -10,7 +10,12 @@
 
 #include "threads/CriticalSection.h"
 
+#include <cstdint>
+#include <list>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <udfread/blockinput.h>
 
@@ -32,12 +37,34 @@ private:
   static uint32_t Size(udfread_block_input* bi);
   static int Read(udfread_block_input* bi, uint32_t lba, void* buf, uint32_t nblocks, int flags);
 
+  //! Aligned blocks of the image read at once
+  struct CachedChunk
+  {
+    uint32_t lba{0};
+    uint32_t blocks{0}; // less than a full chunk at the end of the image
+    std::vector<uint8_t> data;
+  };
+
   struct UDF_BI
   {
     struct udfread_block_input bi;
     std::shared_ptr<XFILE::CFile> fp{nullptr};
     CCriticalSection lock;
+
+    // The chunks read last, most recently used first. libudfread reads the file system
+    // structures and the ends of the extents a block at a time, which are tiny requests to a
+    // network share.
+    std::list<CachedChunk> chunks;
+    std::unordered_map<uint32_t, std::list<CachedChunk>::iterator> chunksByLba;
   };
 
+  static int ReadBlocks(UDF_BI* bi, uint32_t lba, void* buf, uint32_t nblocks);
+
+  /*!
+   * \brief Get a chunk from the cache, reading it on a miss.
+   * \return the chunk or nullptr when it can't be read
+   */
+  static const CachedChunk* GetChunk(UDF_BI* bi, uint32_t lba);
+
   std::unique_ptr<UDF_BI> m_bi{nullptr};
 };
@@ -0,0 +1,213 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "UringReadAhead.h"
+
+#include "utils/log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace XFILE;
+
+CUringReadAhead::~CUringReadAhead()
+{
+  Close();
+}
+
+bool CUringReadAhead::Open(const std::string& path, unsigned int chunkSize, unsigned int depth)
+{
+  Close();
+
+  if (chunkSize == 0 || depth == 0)
+    return false;
+
+  m_fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (m_fd < 0)
+  {
+    CLog::Log(LOGDEBUG, "CUringReadAhead::{} - failed to open <{}>: {}", __FUNCTION__, path,
+              strerror(errno));
+    return false;
+  }
+
+  const int ret = io_uring_queue_init(depth, &m_ring, 0);
+  if (ret < 0)
+  {
+    CLog::Log(LOGDEBUG, "CUringReadAhead::{} - io_uring not available: {}", __FUNCTION__,
+              strerror(-ret));
+    Close();
+    return false;
+  }
+  m_ringInitialized = true;
+
+  // sequential access hint for the page cache / NFS client read-ahead
+  posix_fadvise(m_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+  m_chunkSize = chunkSize;
+  m_slots.resize(depth);
+  for (Slot& slot : m_slots)
+    slot.data = std::make_unique<char[]>(chunkSize);
+
+  Seek(0);
+  return true;
+}
+
+void CUringReadAhead::Close()
+{
+  if (m_ringInitialized)
+  {
+    Drain();
+    io_uring_queue_exit(&m_ring);
+    m_ringInitialized = false;
+  }
+
+  if (m_fd >= 0)
+  {
+    close(m_fd);
+    m_fd = -1;
+  }
+
+  m_slots.clear();
+  m_head = 0;
+  m_queued = 0;
+  m_headPos = 0;
+}
+
+void CUringReadAhead::Seek(int64_t position)
+{
+  // buffers of outstanding reads can only be reused once the kernel is done with them
+  Drain();
+
+  m_head = 0;
+  m_queued = 0;
+  m_headPos = 0;
+  m_nextOffset = position;
+}
+
+ssize_t CUringReadAhead::Read(char* buffer, size_t size)
+{
+  if (!m_ringInitialized)
+    return -1;
+
+  Submit();
+
+  Slot& slot = m_slots[m_head];
+  while (!slot.done)
+  {
+    if (!WaitCompletion())
+      return -1;
+  }
+
+  if (slot.result < 0)
+  {
+    const int error = -slot.result;
+    const int64_t offset = slot.offset + static_cast<int64_t>(m_headPos);
+    Seek(offset);
+
+    if (error == EAGAIN || error == EINTR)
+      return Read(buffer, size);
+
+    CLog::Log(LOGERROR, "CUringReadAhead::{} - read at {} failed: {}", __FUNCTION__, offset,
+              strerror(error));
+    return -1;
+  }
+
+  const size_t result = static_cast<size_t>(slot.result);
+  if (result == 0)
+  {
+    // end of file, queue from here again on the next call in case the file grows
+    Seek(slot.offset);
+    return 0;
+  }
+
+  const size_t count = std::min(size, result - m_headPos);
+  memcpy(buffer, slot.data.get() + m_headPos, count);
+  m_headPos += count;
+
+  if (m_headPos == result)
+  {
+    if (result == m_chunkSize)
+    {
+      slot.done = false;
+      m_head = (m_head + 1) % m_slots.size();
+      m_queued--;
+      m_headPos = 0;
+    }
+    else
+    {
+      // short read, whatever was queued behind it starts at the wrong offset
+      Seek(slot.offset + static_cast<int64_t>(result));
+    }
+  }
+
+  return static_cast<ssize_t>(count);
+}
+
+void CUringReadAhead::Submit()
+{
+  bool queued = false;
+  while (m_queued < m_slots.size())
+  {
+    io_uring_sqe* sqe = io_uring_get_sqe(&m_ring);
+    if (!sqe)
+      break;
+
+    Slot& slot = m_slots[(m_head + m_queued) % m_slots.size()];
+    slot.offset = m_nextOffset;
+    slot.result = 0;
+    slot.done = false;
+
+    io_uring_prep_read(sqe, m_fd, slot.data.get(), m_chunkSize, static_cast<__u64>(slot.offset));
+    io_uring_sqe_set_data(sqe, &slot);
+
+    m_nextOffset += m_chunkSize;
+    m_queued++;
+    m_inFlight++;
+    queued = true;
+  }
+
+  if (queued)
+    io_uring_submit(&m_ring);
+}
+
+bool CUringReadAhead::WaitCompletion()
+{
+  io_uring_cqe* cqe = nullptr;
+  int ret;
+  do
+  {
+    ret = io_uring_wait_cqe(&m_ring, &cqe);
+  } while (ret == -EINTR);
+
+  if (ret < 0)
+  {
+    CLog::Log(LOGERROR, "CUringReadAhead::{} - waiting for completion failed: {}", __FUNCTION__,
+              strerror(-ret));
+    return false;
+  }
+
+  Slot* slot = static_cast<Slot*>(io_uring_cqe_get_data(cqe));
+  slot->result = cqe->res;
+  slot->done = true;
+  m_inFlight--;
+  io_uring_cqe_seen(&m_ring, cqe);
+  return true;
+}
+
+void CUringReadAhead::Drain()
+{
+  while (m_inFlight > 0)
+  {
+    if (!WaitCompletion())
+      break;
+  }
+}
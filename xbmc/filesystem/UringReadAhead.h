@@ -0,0 +1,77 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <liburing.h>
+#include <sys/types.h>
+
+namespace XFILE
+{
+
+/*!
+ * \brief Sequential read-ahead on a local file descriptor backed by io_uring.
+ *
+ * Keeps up to depth chunk sized reads in flight ahead of the current position, so a high
+ * latency mount (e.g. a kernel NFS or CIFS share) is not limited to one outstanding request.
+ * Used by CFileCache in place of blocking reads on its source. Not thread safe, all calls
+ * must come from the cache thread.
+ */
+class CUringReadAhead
+{
+public:
+  CUringReadAhead() = default;
+  ~CUringReadAhead();
+
+  CUringReadAhead(const CUringReadAhead&) = delete;
+  CUringReadAhead& operator=(const CUringReadAhead&) = delete;
+
+  bool Open(const std::string& path, unsigned int chunkSize, unsigned int depth);
+  void Close();
+
+  /*!
+   * \brief Drop all queued reads and continue reading at position.
+   */
+  void Seek(int64_t position);
+
+  /*!
+   * \brief Read up to size bytes at the current position.
+   * \return number of bytes read, 0 on end of file, -1 on error
+   */
+  ssize_t Read(char* buffer, size_t size);
+
+private:
+  struct Slot
+  {
+    std::unique_ptr<char[]> data;
+    int64_t offset = 0;
+    int result = 0;
+    bool done = false;
+  };
+
+  void Submit();
+  bool WaitCompletion();
+  void Drain();
+
+  io_uring m_ring{};
+  bool m_ringInitialized = false;
+  int m_fd = -1;
+  unsigned int m_chunkSize = 0;
+  std::vector<Slot> m_slots;
+  size_t m_head = 0; //!< oldest queued slot
+  size_t m_queued = 0; //!< number of slots holding a read, completed or not
+  size_t m_inFlight = 0; //!< number of submitted reads without completion
+  size_t m_headPos = 0; //!< bytes of the oldest slot already returned
+  int64_t m_nextOffset = 0; //!< file offset of the next read to queue
+};
+
+} // namespace XFILE
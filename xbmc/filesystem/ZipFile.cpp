@@ -12,17 +12,26 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cstdint>
 
 #include <sys/stat.h>
 
 static constexpr uint64_t ZIP_CACHE_LIMIT = 4ull * 1024 * 1024;
+static constexpr size_t ZIP_READ_BUFFER_SIZE = 256 * 1024;
+
+// Distance between the inflate checkpoints in the uncompressed data, and their number. Each one
+// holds the 32k window of zlib.
+static constexpr int64_t ZIP_CHECKPOINT_INTERVAL = 1024 * 1024;
+static constexpr size_t ZIP_MAX_CHECKPOINTS = 16;
 
 using namespace XFILE;
 
-CZipFile::CZipFile() : m_szStringBuffer(nullptr), m_szStartOfStringBuffer(nullptr)
+CZipFile::CZipFile()
+  : m_szBuffer(ZIP_READ_BUFFER_SIZE),
+    m_szStringBuffer(nullptr),
+    m_szStartOfStringBuffer(nullptr)
 {
-  memset(m_szBuffer, 0, sizeof(m_szBuffer));
 }
 
 CZipFile::~CZipFile()
@@ -96,13 +105,74 @@ bool CZipFile::InitDecompress()
       return false;
     }
   }
-  m_ZStream.next_in = reinterpret_cast<Bytef*>(m_szBuffer);
+  m_ZStream.next_in = reinterpret_cast<Bytef*>(m_szBuffer.data());
+  m_ZStream.avail_in = 0;
+  m_ZStream.total_out = 0;
+
+  return true;
+}
+
+void CZipFile::RestartDecompress()
+{
+  m_iFilePos = 0;
+  m_iZipFilePos = 0;
+  m_bFlush = false;
+  inflateEnd(&m_ZStream);
+  inflateInit2(&m_ZStream, -MAX_WBITS); // simply restart zlib
+  mFile.Seek(mZipItem.offset, SEEK_SET);
+  m_ZStream.next_in = reinterpret_cast<Bytef*>(m_szBuffer.data());
   m_ZStream.avail_in = 0;
   m_ZStream.total_out = 0;
+}
+
+void CZipFile::AddCheckpoint()
+{
+  Checkpoint& checkpoint = m_checkpoints.emplace_back();
+  if (inflateCopy(&checkpoint.stream, &m_ZStream) != Z_OK)
+  {
+    m_checkpoints.pop_back();
+    return;
+  }
+
+  checkpoint.filePos = m_iFilePos;
+  checkpoint.zipFilePos = m_iZipFilePos - m_ZStream.avail_in;
+  checkpoint.flush = m_bFlush;
+}
+
+bool CZipFile::RestoreCheckpoint(int64_t iFilePosition)
+{
+  // the checkpoints are in ascending order, find the last one at or before the position
+  auto it = std::ranges::upper_bound(m_checkpoints, iFilePosition, {}, &Checkpoint::filePos);
+  if (it == m_checkpoints.begin())
+    return false;
+  Checkpoint& checkpoint = *--it;
+  if (checkpoint.filePos <= m_iFilePos && m_iFilePos <= iFilePosition)
+    return false; // inflating on from here is shorter
+
+  inflateEnd(&m_ZStream);
+  if (inflateCopy(&m_ZStream, &checkpoint.stream) != Z_OK)
+  {
+    ClearCheckpoints();
+    RestartDecompress();
+    return true;
+  }
 
+  m_iFilePos = checkpoint.filePos;
+  m_iZipFilePos = checkpoint.zipFilePos;
+  m_bFlush = checkpoint.flush;
+  mFile.Seek(mZipItem.offset + m_iZipFilePos, SEEK_SET);
+  m_ZStream.next_in = reinterpret_cast<Bytef*>(m_szBuffer.data());
+  m_ZStream.avail_in = 0;
   return true;
 }
 
+void CZipFile::ClearCheckpoints()
+{
+  for (Checkpoint& checkpoint : m_checkpoints)
+    inflateEnd(&checkpoint.stream);
+  m_checkpoints.clear();
+}
+
 int64_t CZipFile::GetLength()
 {
   return static_cast<int64_t>(mZipItem.usize);
@@ -164,17 +234,11 @@ int64_t CZipFile::Seek(int64_t iFilePosition, int iWhence)
         return -1;
       // read until position in 128k blocks.. only way to do it due to format.
       // can't start in the middle of data since then we'd have no clue where
-      // we are in uncompressed data..
+      // we are in uncompressed data.. unless we kept the inflate state there
       if (iFilePosition < m_iFilePos)
       {
-        m_iFilePos = 0;
-        m_iZipFilePos = 0;
-        inflateEnd(&m_ZStream);
-        inflateInit2(&m_ZStream,-MAX_WBITS); // simply restart zlib
-        mFile.Seek(mZipItem.offset,SEEK_SET);
-        m_ZStream.next_in = reinterpret_cast<Bytef*>(m_szBuffer);
-        m_ZStream.avail_in = 0;
-        m_ZStream.total_out = 0;
+        if (!RestoreCheckpoint(iFilePosition))
+          RestartDecompress();
         while (m_iFilePos < iFilePosition)
         {
           const ssize_t iToRead =
@@ -194,6 +258,7 @@ int64_t CZipFile::Seek(int64_t iFilePosition, int iWhence)
       if (m_iFilePos + iFilePosition > static_cast<int64_t>(mZipItem.usize))
         return -1;
       iFilePosition += m_iFilePos;
+      RestoreCheckpoint(iFilePosition);
       while (m_iFilePos < iFilePosition)
       {
         ssize_t iToRead = (iFilePosition - m_iFilePos)>blockSize ? blockSize : iFilePosition - m_iFilePos;
@@ -336,6 +401,12 @@ ssize_t CZipFile::Read(void* lpBuf, size_t uiBufSize)
       iDecompressed = m_ZStream.total_out-prevOut;
     }
     m_iFilePos += static_cast<int64_t>(iDecompressed);
+
+    const int64_t lastCheckpoint = m_checkpoints.empty() ? 0 : m_checkpoints.back().filePos;
+    if (m_checkpoints.size() < ZIP_MAX_CHECKPOINTS &&
+        m_iFilePos >= lastCheckpoint + ZIP_CHECKPOINT_INTERVAL)
+      AddCheckpoint();
+
     return static_cast<unsigned int>(iDecompressed);
   }
   else if (mZipItem.method == 0) // uncompressed. just read from file, but mind our boundaries.
@@ -363,23 +434,24 @@ void CZipFile::Close()
 {
   if (mZipItem.method == 8 && !m_bCached && m_iRead != -1)
     inflateEnd(&m_ZStream);
+  ClearCheckpoints();
 
   mFile.Close();
 }
 
 bool CZipFile::FillBuffer()
 {
-  ssize_t sToRead = 65535;
-  if (m_iZipFilePos + 65535 > static_cast<int64_t>(mZipItem.csize))
+  ssize_t sToRead = static_cast<ssize_t>(m_szBuffer.size());
+  if (m_iZipFilePos + sToRead > static_cast<int64_t>(mZipItem.csize))
     sToRead = static_cast<ssize_t>(mZipItem.csize - m_iZipFilePos);
 
   if (sToRead <= 0)
     return false; // eof!
 
-  if (mFile.Read(m_szBuffer,sToRead) != sToRead)
+  if (mFile.Read(m_szBuffer.data(), sToRead) != sToRead)
     return false;
   m_ZStream.avail_in = static_cast<unsigned int>(sToRead);
-  m_ZStream.next_in = reinterpret_cast<Byte*>(m_szBuffer);
+  m_ZStream.next_in = reinterpret_cast<Byte*>(m_szBuffer.data());
   m_iZipFilePos += sToRead;
   return true;
 }
@@ -12,6 +12,9 @@
 #include "IFile.h"
 #include "ZipManager.h"
 
+#include <deque>
+#include <vector>
+
 #include <zlib.h>
 
 namespace XFILE
@@ -41,21 +44,41 @@ namespace XFILE
 
   private:
     bool InitDecompress();
+    void RestartDecompress();
     bool FillBuffer();
     void DestroyBuffer(void* lpBuffer, int iBufSize);
+
+    // A copy of the inflate state at a position of the uncompressed data. Seeking resumes from
+    // the nearest one before the position instead of inflating again from the start.
+    struct Checkpoint
+    {
+      int64_t filePos = 0;
+      int64_t zipFilePos = 0; // position of the compressed data not consumed yet
+      bool flush = false;
+      z_stream stream{};
+    };
+    void AddCheckpoint();
+    /*!
+     * \brief Resume inflating from the nearest checkpoint before a position.
+     * \return false when there is none or it isn't nearer than the current position
+     */
+    bool RestoreCheckpoint(int64_t iFilePosition);
+    void ClearCheckpoints();
+
     CFile mFile;
     SZipEntry mZipItem{};
     int64_t m_iFilePos = 0; // position in _uncompressed_ data read
     int64_t m_iZipFilePos = 0; // position in _compressed_ data
     int m_iAvailBuffer = 0;
     z_stream m_ZStream{};
-    char m_szBuffer[65535]; // 64k buffer for compressed data
+    std::vector<char> m_szBuffer; // buffer for compressed data
     char* m_szStringBuffer;
     char* m_szStartOfStringBuffer; // never allocated!
     size_t m_iDataInStringBuffer = 0;
     int m_iRead = -1;
     bool m_bFlush = false;
     bool m_bCached = false;
+    std::deque<Checkpoint> m_checkpoints; // zlib points back to the stream, it can't be moved
   };
 }
 
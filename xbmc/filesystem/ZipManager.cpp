@@ -28,6 +28,9 @@ using namespace XFILE;
 
 static constexpr size_t ZC_FLAG_EFS = 1 << 11; // general purpose bit 11 - zip holds utf-8 filenames
 
+// Number of archives whose central directory is kept
+static constexpr size_t ZIP_LISTING_CACHE_SIZE = 32;
+
 CZipManager::CZipManager() = default;
 
 CZipManager::~CZipManager() = default;
@@ -43,19 +46,29 @@ bool CZipManager::GetZipList(const CURL& url, std::vector<SZipEntry>& items)
     return false;
   }
 
-  const auto it = mZipMap.find(strFile);
-  if (it != mZipMap.end()) // already listed, just return it if not changed, else release and reread
   {
-    const auto it2 = mZipDate.find(strFile);
-    if (m_StatData.st_mtime == it2->second)
+    std::unique_lock lock(m_critSection);
+    // already listed, just return it if not changed, else reread
+    const CZipListing* listing = FindInCache(strFile);
+    if (listing && listing->mtime == m_StatData.st_mtime)
     {
-      items = it->second;
+      items = listing->items;
       return true;
     }
-    mZipMap.erase(it);
-    mZipDate.erase(it2);
   }
 
+  // the archive is parsed unlocked, listing a big one on a network share takes a while
+  if (!ReadZipList(url, items))
+    return false;
+
+  AddToCache(strFile, m_StatData.st_mtime, items);
+  return true;
+}
+
+bool CZipManager::ReadZipList(const CURL& url, std::vector<SZipEntry>& items) const
+{
+  const std::string strFile = url.GetHostName();
+
   CFile mFile;
   if (!mFile.Open(strFile))
   {
@@ -77,9 +90,6 @@ bool CZipManager::GetZipList(const CURL& url, std::vector<SZipEntry>& items)
     CLog::LogF(LOGWARNING,
                "ZIP split archive header found. Trying to process as a single archive..");
 
-  // push date for update detection
-  mZipDate.insert(make_pair(strFile, m_StatData.st_mtime));
-
   const bool Is64{IsZip64(mFile)};
 
   // Look for end of central directory record
@@ -269,36 +279,76 @@ bool CZipManager::GetZipList(const CURL& url, std::vector<SZipEntry>& items)
     ze.offset = static_cast<int64_t>(ze.lhdrOffset) + LHDR_SIZE + ze.flength + ze.elength;
   }
 
-  mZipMap.insert(make_pair(strFile, items));
   mFile.Close();
   return true;
 }
 
-bool CZipManager::GetZipEntry(const CURL& url, SZipEntry& item)
+void CZipManager::AddToCache(const std::string& strFile,
+                             int64_t mtime,
+                             const std::vector<SZipEntry>& items)
 {
-  const std::string& strFile = url.GetHostName();
-
-  std::map<std::string, std::vector<SZipEntry> >::iterator it = mZipMap.find(strFile);
-  std::vector<SZipEntry> items;
-  if (it == mZipMap.end()) // we need to list the zip
+  CZipListing listing;
+  listing.path = strFile;
+  listing.mtime = mtime;
+  listing.items = items;
+  listing.itemsByName.reserve(items.size());
+  for (size_t i = 0; i < items.size(); ++i)
+    listing.itemsByName.emplace(items[i].name, i); // the first of duplicate names wins
+
+  std::unique_lock lock(m_critSection);
+  const auto it = m_listingsByPath.find(strFile);
+  if (it != m_listingsByPath.end())
   {
-    GetZipList(url,items);
+    m_listings.erase(it->second);
+    m_listingsByPath.erase(it);
   }
-  else
+
+  m_listings.emplace_front(std::move(listing));
+  m_listingsByPath.emplace(strFile, m_listings.begin());
+
+  while (m_listings.size() > ZIP_LISTING_CACHE_SIZE)
   {
-    items = it->second;
+    m_listingsByPath.erase(m_listings.back().path);
+    m_listings.pop_back();
   }
+}
+
+const CZipManager::CZipListing* CZipManager::FindInCache(const std::string& strFile)
+{
+  const auto it = m_listingsByPath.find(strFile);
+  if (it == m_listingsByPath.end())
+    return nullptr;
+
+  m_listings.splice(m_listings.begin(), m_listings, it->second);
+  return &m_listings.front();
+}
 
+bool CZipManager::GetZipEntry(const CURL& url, SZipEntry& item)
+{
+  const std::string& strFile = url.GetHostName();
   const std::string& strFileName = url.GetFileName();
-  for (const auto& it2 : items)
+
+  std::unique_lock lock(m_critSection);
+  const CZipListing* listing = FindInCache(strFile);
+  if (!listing) // we need to list the zip
   {
-    if (std::string(it2.name) == strFileName)
-    {
-      item = it2;
-      return true;
-    }
+    lock.unlock();
+    std::vector<SZipEntry> items;
+    if (!GetZipList(url, items))
+      return false;
+
+    lock.lock();
+    listing = FindInCache(strFile);
+    if (!listing)
+      return false;
   }
-  return false;
+
+  const auto it = listing->itemsByName.find(strFileName);
+  if (it == listing->itemsByName.end())
+    return false;
+
+  item = listing->items[it->second];
+  return true;
 }
 
 bool CZipManager::ExtractArchive(const std::string& strArchive, const std::string& strPath)
@@ -365,12 +415,12 @@ void CZipManager::readCHeader(const char* buffer, SZipEntry& info)
 void CZipManager::release(const std::string& strPath)
 {
   CURL url(strPath);
-  std::map<std::string, std::vector<SZipEntry> >::iterator it= mZipMap.find(url.GetHostName());
-  if (it != mZipMap.end())
+  std::unique_lock lock(m_critSection);
+  const auto it = m_listingsByPath.find(url.GetHostName());
+  if (it != m_listingsByPath.end())
   {
-    std::map<std::string,int64_t>::iterator it2=mZipDate.find(url.GetHostName());
-    mZipMap.erase(it);
-    mZipDate.erase(it2);
+    m_listings.erase(it->second);
+    m_listingsByPath.erase(it);
   }
 }
 
@@ -8,10 +8,13 @@
 
 #pragma once
 
+#include "threads/CriticalSection.h"
+
 #include <cstdint>
 #include <cstring>
-#include <map>
+#include <list>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // See http://www.pkware.com/documents/casestudies/APPNOTE.TXT
@@ -80,8 +83,30 @@ public:
   static void ParseZip64ExtraField(const char* buf, uint16_t length, SZipEntry& info);
 
 private:
-  std::map<std::string,std::vector<SZipEntry> > mZipMap;
-  std::map<std::string, int64_t> mZipDate;
+  //! The parsed central directory of an archive
+  struct CZipListing
+  {
+    std::string path;
+    int64_t mtime = 0;
+    std::vector<SZipEntry> items;
+    std::unordered_map<std::string, size_t> itemsByName; // position in items
+  };
+
+  //! Parse the central directory of an archive, not using the cache
+  bool ReadZipList(const CURL& url, std::vector<SZipEntry>& items) const;
+  void AddToCache(const std::string& strFile, int64_t mtime, const std::vector<SZipEntry>& items);
+
+  /*!
+   * \brief Find a listed archive and make it the most recently used one.
+   * \return the listing or nullptr when the archive isn't cached
+   */
+  const CZipListing* FindInCache(const std::string& strFile);
+
+  CCriticalSection m_critSection;
+  // The listed archives, most recently used first. Comics, skins and subtitle packs get opened
+  // again and again, and listing them parses the whole central directory.
+  std::list<CZipListing> m_listings;
+  std::unordered_map<std::string, std::list<CZipListing>::iterator> m_listingsByPath;
 
   static bool ReadZip64EOCD(XFILE::CFile& file, uint64_t& cdirOffset, uint64_t& cdirSize);
 
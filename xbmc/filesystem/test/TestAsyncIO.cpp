@@ -0,0 +1,73 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "URL.h"
+#include "filesystem/AsyncIO.h"
+#include "filesystem/File.h"
+#include "jobs/JobManager.h"
+#include "test/TestUtils.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+CTask<std::string> ReadStart(const CURL& url, size_t size)
+{
+  CFile file;
+  if (!co_await OpenAsync(file, url))
+    co_return {};
+
+  std::string data(size, '\0');
+  const ssize_t read = co_await ReadAsync(file, url, data.data(), data.size());
+  data.resize(read > 0 ? static_cast<size_t>(read) : 0);
+  co_return data;
+}
+} // namespace
+
+class TestAsyncIO : public testing::Test
+{
+protected:
+  TestAsyncIO() { CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>()); }
+
+  ~TestAsyncIO() override
+  {
+    CServiceBroker::GetJobManager()->CancelJobs();
+    CServiceBroker::GetJobManager()->Restart();
+    CServiceBroker::UnregisterJobManager();
+  }
+};
+
+TEST_F(TestAsyncIO, Read)
+{
+  const CURL url(XBMC_REF_FILE_PATH("/xbmc/filesystem/test/reffile.txt"));
+  EXPECT_EQ("About", ReadStart(url, 5).Get());
+}
+
+TEST_F(TestAsyncIO, OpenMissingFile)
+{
+  const CURL url(XBMC_REF_FILE_PATH("/xbmc/filesystem/test/missing.txt"));
+  EXPECT_EQ("", ReadStart(url, 5).Get());
+}
+
+TEST_F(TestAsyncIO, WithoutJobManager)
+{
+  CServiceBroker::GetJobManager()->CancelJobs();
+  CServiceBroker::GetJobManager()->Restart();
+  CServiceBroker::UnregisterJobManager();
+
+  const CURL url(XBMC_REF_FILE_PATH("/xbmc/filesystem/test/reffile.txt"));
+  EXPECT_EQ("About", ReadStart(url, 5).Get());
+
+  CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>());
+}
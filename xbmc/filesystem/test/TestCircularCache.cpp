@@ -0,0 +1,98 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/CircularCache.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+std::vector<char> MakeData(size_t size)
+{
+  std::vector<char> data(size);
+  for (size_t i = 0; i < size; ++i)
+    data[i] = static_cast<char>(i * 13 + i / 251);
+  return data;
+}
+
+void Write(CCircularCache& cache, const std::vector<char>& data, size_t& written, size_t size)
+{
+  const size_t end = written + size;
+  while (written < end)
+  {
+    const int ret = cache.WriteToCache(data.data() + written, end - written);
+    ASSERT_GT(ret, 0);
+    written += ret;
+  }
+}
+
+void Read(CCircularCache& cache, const std::vector<char>& data, size_t& read, size_t size)
+{
+  std::vector<char> buffer(size);
+  size_t done = 0;
+  while (done < size)
+  {
+    const int ret = cache.ReadFromCache(buffer.data() + done, size - done);
+    ASSERT_GT(ret, 0);
+    done += ret;
+  }
+  EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), data.begin() + read));
+  read += size;
+}
+} // namespace
+
+TEST(TestCircularCache, ShrinkKeepsUnreadData)
+{
+  const std::vector<char> data = MakeData(100000);
+  CCircularCache cache(30000, 10000);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  size_t written = 0;
+  size_t read = 0;
+  Write(cache, data, written, 25000);
+  Read(cache, data, read, 5000);
+  Write(cache, data, written, 10000); // wraps around
+
+  // 30000 bytes unread, does not fit a 20000 bytes front buffer
+  EXPECT_FALSE(cache.Resize(20000, 5000));
+
+  Read(cache, data, read, 15000);
+  ASSERT_TRUE(cache.Resize(20000, 5000));
+  EXPECT_EQ(static_cast<int64_t>(written), cache.CachedDataEndPos());
+  EXPECT_EQ(static_cast<int64_t>(written - 25000), cache.CachedDataStartPos());
+  EXPECT_EQ(static_cast<int64_t>(read), cache.Seek(read));
+
+  Write(cache, data, written, cache.GetMaxWriteSize(100000));
+  Read(cache, data, read, written - read);
+}
+
+TEST(TestCircularCache, Grow)
+{
+  const std::vector<char> data = MakeData(100000);
+  CCircularCache cache(6000, 2000);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  size_t written = 0;
+  size_t read = 0;
+  Write(cache, data, written, 6000);
+  Read(cache, data, read, 5000);
+  Write(cache, data, written, 3000);
+
+  ASSERT_TRUE(cache.Resize(45000, 15000));
+  EXPECT_EQ(static_cast<int64_t>(written), cache.CachedDataEndPos());
+  EXPECT_EQ(60000u - (written - cache.CachedDataStartPos()), cache.GetMaxWriteSize(100000));
+
+  Write(cache, data, written, 40000);
+  Read(cache, data, read, written - read);
+  EXPECT_EQ(CACHE_RC_WOULD_BLOCK, cache.ReadFromCache(nullptr, 1));
+}
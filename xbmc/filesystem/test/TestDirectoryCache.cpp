@@ -12,6 +12,9 @@
 #include "filesystem/DirectoryCache.h"
 #include "filesystem/IDirectory.h"
 
+#include <chrono>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 using namespace XFILE;
@@ -111,6 +114,21 @@ TEST_F(TestDirectoryCache, CacheTypeAlways)
   EXPECT_EQ(1, GetCacheDirectory(*cache, "ftp://test/directory/", false)->Size());
 }
 
+TEST_F(TestDirectoryCache, CacheLifetime)
+{
+  CURL url("plugin://plugin.test/directory/");
+  CFileItemList items;
+  AddFile(items, CURL("plugin://plugin.test/directory/file1.txt"));
+
+  cache->SetDirectory(url, items, CacheType::ALWAYS, 3600);
+  EXPECT_EQ(1, GetCacheDirectory(*cache, "plugin://plugin.test/directory/", false)->Size());
+
+  // a listing past its lifetime isn't returned anymore
+  cache->SetDirectory(url, items, CacheType::ALWAYS, 1);
+  std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+  EXPECT_FALSE(ExistsInCache(*cache, "plugin://plugin.test/directory/"));
+}
+
 // URL normalization tests
 TEST_F(TestDirectoryCache, URLNormalization)
 {
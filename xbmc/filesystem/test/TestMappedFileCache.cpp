@@ -0,0 +1,110 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/MappedFileCache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+using namespace XFILE;
+
+namespace
+{
+constexpr size_t FILE_SIZE = 1024 * 1024 + 123;
+
+class TestMappedFileCache : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char path[] = "/tmp/kodi-mappedcache-XXXXXX";
+    const int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    m_path = path;
+
+    m_data.resize(FILE_SIZE);
+    for (size_t i = 0; i < m_data.size(); ++i)
+      m_data[i] = static_cast<char>(i * 7 + i / 4096);
+    ASSERT_EQ(static_cast<ssize_t>(m_data.size()), write(fd, m_data.data(), m_data.size()));
+    close(fd);
+  }
+
+  void TearDown() override { unlink(m_path.c_str()); }
+
+  std::string m_path;
+  std::vector<char> m_data;
+};
+} // namespace
+
+TEST_F(TestMappedFileCache, SequentialRead)
+{
+  // small window so the mapping has to slide many times
+  CMappedFileCache cache(m_path, 48 * 1024, 16 * 1024);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+  EXPECT_TRUE(cache.ReadsSourceDirectly());
+
+  std::vector<char> result;
+  char buffer[10000];
+  while (true)
+  {
+    const size_t space = cache.GetMaxWriteSize(32 * 1024);
+    if (space > 0)
+    {
+      const int64_t filled = cache.FillFromSource(space);
+      ASSERT_GE(filled, 0);
+      if (filled == 0)
+        cache.EndOfInput();
+    }
+
+    const int read = cache.ReadFromCache(buffer, sizeof(buffer));
+    if (read == 0)
+      break;
+    if (read == CACHE_RC_WOULD_BLOCK)
+      continue;
+    ASSERT_GT(read, 0);
+    result.insert(result.end(), buffer, buffer + read);
+  }
+
+  EXPECT_EQ(m_data, result);
+}
+
+TEST_F(TestMappedFileCache, SeekAndReset)
+{
+  CMappedFileCache cache(m_path, 48 * 1024, 16 * 1024);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+
+  ASSERT_EQ(32 * 1024, cache.FillFromSource(32 * 1024));
+  EXPECT_EQ(0, cache.CachedDataStartPos());
+  EXPECT_EQ(32 * 1024, cache.CachedDataEndPos());
+
+  // within the cached range
+  EXPECT_EQ(1000, cache.Seek(1000));
+  char buffer[100];
+  ASSERT_EQ(100, cache.ReadFromCache(buffer, sizeof(buffer)));
+  EXPECT_EQ(0, memcmp(buffer, m_data.data() + 1000, sizeof(buffer)));
+
+  // far outside, the caller has to reset
+  EXPECT_EQ(CACHE_RC_ERROR, cache.Seek(500000));
+  EXPECT_TRUE(cache.Reset(500001));
+  EXPECT_EQ(500001, cache.CachedDataStartPos());
+  EXPECT_EQ(CACHE_RC_WOULD_BLOCK, cache.ReadFromCache(buffer, sizeof(buffer)));
+
+  ASSERT_EQ(4096, cache.FillFromSource(4096));
+  ASSERT_EQ(100, cache.ReadFromCache(buffer, sizeof(buffer)));
+  EXPECT_EQ(0, memcmp(buffer, m_data.data() + 500001, sizeof(buffer)));
+
+  // fill stops at the end of the file
+  EXPECT_TRUE(cache.Reset(FILE_SIZE - 10));
+  EXPECT_EQ(10, cache.FillFromSource(4096));
+  EXPECT_EQ(0, cache.FillFromSource(4096));
+}
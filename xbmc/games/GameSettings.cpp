@@ -34,6 +34,7 @@ const std::string SETTING_GAMES_SHOW_OSD_HELP = "gamesgeneral.showosdhelp";
 const std::string SETTING_GAMES_ENABLEAUTOSAVE = "gamesgeneral.enableautosave";
 const std::string SETTING_GAMES_ENABLEREWIND = "gamesgeneral.enablerewind";
 const std::string SETTING_GAMES_REWINDTIME = "gamesgeneral.rewindtime";
+const std::string SETTING_GAMES_RUNAHEAD = "gamesgeneral.runahead";
 const std::string SETTING_GAMES_ACHIEVEMENTS_USERNAME = "gamesachievements.username";
 const std::string SETTING_GAMES_ACHIEVEMENTS_PASSWORD = "gamesachievements.password";
 const std::string SETTING_GAMES_ACHIEVEMENTS_TOKEN = "gamesachievements.token";
@@ -52,7 +53,7 @@ CGameSettings::CGameSettings()
   m_settings = CServiceBroker::GetSettingsComponent()->GetSettings();
 
   m_settings->RegisterCallback(this, {SETTING_GAMES_ENABLEREWIND, SETTING_GAMES_REWINDTIME,
-                                      SETTING_GAMES_ACHIEVEMENTS_USERNAME,
+                                      SETTING_GAMES_RUNAHEAD, SETTING_GAMES_ACHIEVEMENTS_USERNAME,
                                       SETTING_GAMES_ACHIEVEMENTS_PASSWORD,
                                       SETTING_GAMES_ACHIEVEMENTS_LOGGED_IN});
 }
@@ -105,6 +106,13 @@ unsigned int CGameSettings::MaxRewindTimeSec()
   return static_cast<unsigned int>(std::max(rewindTimeSec, 0));
 }
 
+unsigned int CGameSettings::RunAheadFrames()
+{
+  int runAheadFrames = m_settings->GetInt(SETTING_GAMES_RUNAHEAD);
+
+  return static_cast<unsigned int>(std::max(runAheadFrames, 0));
+}
+
 std::string CGameSettings::GetRAUsername() const
 {
   return m_settings->GetString(SETTING_GAMES_ACHIEVEMENTS_USERNAME);
@@ -122,7 +130,8 @@ void CGameSettings::OnSettingChanged(const std::shared_ptr<const CSetting>& sett
 
   const std::string& settingId = setting->GetId();
 
-  if (settingId == SETTING_GAMES_ENABLEREWIND || settingId == SETTING_GAMES_REWINDTIME)
+  if (settingId == SETTING_GAMES_ENABLEREWIND || settingId == SETTING_GAMES_REWINDTIME ||
+      settingId == SETTING_GAMES_RUNAHEAD)
   {
     SetChanged();
     NotifyObservers(ObservableMessageSettingsChanged);
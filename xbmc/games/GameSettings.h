@@ -38,6 +38,7 @@ public:
   bool AutosaveEnabled();
   bool RewindEnabled();
   unsigned int MaxRewindTimeSec();
+  unsigned int RunAheadFrames();
   std::string GetRAUsername() const;
   std::string GetRAToken() const;
 
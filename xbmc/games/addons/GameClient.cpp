@@ -530,7 +530,7 @@ void CGameClient::CloseFile()
   }
 }
 
-void CGameClient::RunFrame()
+void CGameClient::RunFrame(FRAME_OUTPUT output /* = FRAME_OUTPUT::ALL */)
 {
   IGameInputCallback* input;
 
@@ -548,7 +548,9 @@ void CGameClient::RunFrame()
   {
     try
     {
+      m_frameOutput = output;
       LogError(m_ifc.game->toAddon->RunFrame(m_ifc.game), "RunFrame()");
+      m_frameOutput = FRAME_OUTPUT::ALL;
       m_hasFrameRun = true;
     }
     catch (...)
@@ -728,10 +730,32 @@ void CGameClient::cb_add_stream_data(KODI_HANDLE kodiInstance,
   if (packet == nullptr)
     return;
 
+  CGameClient* gameClient = static_cast<CGameClient*>(kodiInstance);
+  if (gameClient == nullptr)
+    return;
+
   IGameClientStream* gameClientStream = static_cast<IGameClientStream*>(stream);
   if (gameClientStream == nullptr)
     return;
 
+  // Called from RunFrame(), drop the output of frames that aren't presented
+  const bool isAudio = packet->type == GAME_STREAM_AUDIO;
+  switch (gameClient->m_frameOutput)
+  {
+    case FRAME_OUTPUT::VIDEO:
+      if (isAudio)
+        return;
+      break;
+    case FRAME_OUTPUT::AUDIO:
+      if (!isAudio)
+        return;
+      break;
+    case FRAME_OUTPUT::NONE:
+      return;
+    default:
+      break;
+  }
+
   gameClientStream->AddData(*packet);
 }
 
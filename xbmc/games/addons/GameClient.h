@@ -40,6 +40,22 @@ class CGameClientInput;
 class CGameClientProperties;
 class IGameInputCallback;
 
+/*!
+ * \ingroup games
+ *
+ * \brief The streams a frame is presented on
+ *
+ * Frames that are run but not presented, such as the frames emulated ahead of
+ * the presented one, keep their video or audio from the player.
+ */
+enum class FRAME_OUTPUT
+{
+  ALL,
+  VIDEO,
+  AUDIO,
+  NONE,
+};
+
 /*!
  * \ingroup games
  *
@@ -170,7 +186,7 @@ public:
   size_t GetSerializeSize() const { return m_serializeSize; }
   double GetFrameRate() const { return m_framerate; }
   double GetSampleRate() const { return m_samplerate; }
-  void RunFrame();
+  void RunFrame(FRAME_OUTPUT output = FRAME_OUTPUT::ALL);
 
   // Access memory
   size_t SerializeSize() const { return m_serializeSize; }
@@ -265,6 +281,7 @@ private:
   bool m_bRequiresGameLoop = false;
   size_t m_serializeSize = 0;
   IGameInputCallback* m_input = nullptr; // The input callback passed to OpenFile()
+  FRAME_OUTPUT m_frameOutput = FRAME_OUTPUT::ALL; // Output of the frame RunFrame() is running
   double m_framerate = 0.0; // Video frame rate (fps)
   double m_samplerate = 0.0; // Audio sample rate (Hz)
   GAME_REGION m_region = GAME_REGION_UNKNOWN; // Region of the loaded game
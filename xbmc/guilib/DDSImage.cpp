@@ -71,6 +71,19 @@ unsigned char *CDDSImage::GetData() const
   return m_data;
 }
 
+bool CDDSImage::HasAlpha() const
+{
+  return (m_desc.pixelFormat.flags & ddpf_alphapixels) != 0;
+}
+
+void CDDSImage::SetAlpha(bool hasAlpha)
+{
+  if (hasAlpha)
+    m_desc.pixelFormat.flags |= ddpf_alphapixels;
+  else
+    m_desc.pixelFormat.flags &= ~ddpf_alphapixels;
+}
+
 bool CDDSImage::ReadFile(const std::string &inputFile)
 {
   // open the file
@@ -100,6 +113,21 @@ bool CDDSImage::ReadFile(const std::string &inputFile)
   return true;
 }
 
+bool CDDSImage::WriteFile(const std::string& outputFile) const
+{
+  if (!m_data)
+    return false;
+
+  CFile file;
+  if (!file.OpenForWrite(outputFile, true))
+    return false;
+
+  const char magic[] = "DDS ";
+  return file.Write(magic, 4) == 4 &&
+         file.Write(&m_desc, sizeof(m_desc)) == static_cast<ssize_t>(sizeof(m_desc)) &&
+         file.Write(m_data, m_desc.linearSize) == static_cast<ssize_t>(m_desc.linearSize);
+}
+
 unsigned int CDDSImage::GetStorageRequirements(unsigned int width,
                                                unsigned int height,
                                                XB_FMT format)
@@ -25,9 +25,16 @@ public:
   XB_FMT GetFormat() const;
   unsigned int GetSize() const;
   unsigned char *GetData() const;
+  bool HasAlpha() const;
+  void SetAlpha(bool hasAlpha);
 
   bool ReadFile(const std::string &file);
 
+  /*!
+   \brief Write the image as a DDS file, which can be loaded without decoding.
+   */
+  bool WriteFile(const std::string& file) const;
+
 private:
   void Allocate(unsigned int width, unsigned int height, XB_FMT format);
   static const char* GetFourCC(XB_FMT format);
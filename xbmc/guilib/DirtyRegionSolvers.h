@@ -37,3 +37,14 @@ private:
   float m_costNewRegion;
   float m_costPerArea;
 };
+
+/*!
+ \brief Cost reduction solver that also culls the rendering of occluded controls
+
+ The regions are merged like CGreedyDirtyRegionSolver does. In addition, while rendering each
+ region, controls and windows beneath an opaque control covering the whole region are skipped.
+ \sa CGUIControl::OccludesRegion
+ */
+class COcclusionDirtyRegionSolver : public CGreedyDirtyRegionSolver
+{
+};
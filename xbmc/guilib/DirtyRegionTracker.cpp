@@ -38,6 +38,10 @@ void CDirtyRegionTracker::SelectAlgorithm()
       CLog::Log(LOGDEBUG, "guilib: Fill viewport on change for solving rendering passes");
       m_solver = new CFillViewportOnChangeRegionSolver();
       break;
+    case DIRTYREGION_SOLVER_OCCLUSION:
+      CLog::Log(LOGDEBUG, "guilib: Cost reduction with occlusion culling for solving rendering passes");
+      m_solver = new COcclusionDirtyRegionSolver();
+      break;
     case DIRTYREGION_SOLVER_COST_REDUCTION:
       CLog::Log(LOGDEBUG, "guilib: Cost reduction as algorithm for solving rendering passes");
       m_solver = new CGreedyDirtyRegionSolver();
@@ -16,7 +16,9 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <mutex>
 
 extern "C"
 {
@@ -24,6 +26,7 @@ extern "C"
 #include <libavutil/imgutils.h>
 #include <libavcodec/avcodec.h>
 #include <libavutil/avutil.h>
+#include <libavutil/hwcontext.h>
 #include <libswscale/swscale.h>
 #include <libavutil/pixdesc.h>
 }
@@ -116,6 +119,49 @@ static int64_t mem_file_seek(void *h, int64_t pos, int whence)
   return mbuf->pos;
 }
 
+namespace
+{
+// smaller images decode faster in software than the round trip through the GPU takes
+constexpr int MIN_HARDWARE_PIXELS = 1280 * 720;
+
+std::mutex hwDeviceMutex;
+bool hwDeviceProbed = false;
+AVBufferRef* hwDevice = nullptr; // shared by all images, lives until exit
+std::atomic<bool> v4l2Unavailable{false};
+
+AVBufferRef* GetHardwareDevice()
+{
+  std::unique_lock lock(hwDeviceMutex);
+  if (!hwDeviceProbed)
+  {
+    hwDeviceProbed = true;
+    if (av_hwdevice_ctx_create(&hwDevice, AV_HWDEVICE_TYPE_VAAPI, nullptr, nullptr, 0) < 0)
+      hwDevice = nullptr;
+    else
+      CLog::Log(LOGINFO, "CFFmpegImage: decoding large JPEG images with VA-API");
+  }
+  return hwDevice ? av_buffer_ref(hwDevice) : nullptr;
+}
+
+AVPixelFormat GetHardwareFormat(AVCodecContext* avctx, const AVPixelFormat* formats)
+{
+  for (const AVPixelFormat* format = formats; *format != AV_PIX_FMT_NONE; ++format)
+  {
+    if (*format == AV_PIX_FMT_VAAPI)
+      return *format;
+  }
+
+  // the hardware can't decode this one, take the first software format
+  for (const AVPixelFormat* format = formats; *format != AV_PIX_FMT_NONE; ++format)
+  {
+    const AVPixFmtDescriptor* descriptor = av_pix_fmt_desc_get(*format);
+    if (descriptor && !(descriptor->flags & AV_PIX_FMT_FLAG_HWACCEL))
+      return *format;
+  }
+  return AV_PIX_FMT_NONE;
+}
+} // namespace
+
 CFFmpegImage::CFFmpegImage(const std::string& strMimeType) : m_strMimeType(strMimeType)
 {
   m_hasAlpha = false;
@@ -128,6 +174,11 @@ CFFmpegImage::~CFFmpegImage()
   av_frame_free(&m_pFrame);
   // someone could have forgotten to call us
   CleanupLocalOutputBuffer();
+  Close();
+}
+
+void CFFmpegImage::Close()
+{
   if (m_fctx)
   {
     avcodec_free_context(&m_codec_ctx);
@@ -145,7 +196,7 @@ bool CFFmpegImage::LoadImageFromMemory(unsigned char* buffer, unsigned int bufSi
                                       unsigned int width, unsigned int height)
 {
 
-  if (!Initialize(buffer, bufSize))
+  if (!Initialize(buffer, bufSize, true))
   {
     //log
     return false;
@@ -154,10 +205,54 @@ bool CFFmpegImage::LoadImageFromMemory(unsigned char* buffer, unsigned int bufSi
   av_frame_free(&m_pFrame);
   m_pFrame = ExtractFrame();
 
+  const bool hardware = m_codec_ctx->hw_device_ctx ||
+                        m_codec_ctx->codec != avcodec_find_decoder(m_codec_ctx->codec_id);
+  if (!m_pFrame && hardware)
+  {
+    CLog::LogF(LOGDEBUG, "Hardware decoding failed, retrying in software");
+    Close();
+    if (!Initialize(buffer, bufSize, false))
+      return false;
+    m_pFrame = ExtractFrame();
+  }
+
   return !(m_pFrame == nullptr);
 }
 
-bool CFFmpegImage::Initialize(unsigned char* buffer, size_t bufSize)
+bool CFFmpegImage::OpenDecoder(const AVCodec* codec,
+                               const AVCodecParameters* params,
+                               AVBufferRef* device)
+{
+  m_codec_ctx = avcodec_alloc_context3(codec);
+  if (!m_codec_ctx)
+  {
+    av_buffer_unref(&device);
+    return false;
+  }
+
+  if (avcodec_parameters_to_context(m_codec_ctx, params) < 0)
+  {
+    av_buffer_unref(&device);
+    avcodec_free_context(&m_codec_ctx);
+    return false;
+  }
+
+  if (device)
+  {
+    m_codec_ctx->hw_device_ctx = device; // owned by the context now
+    m_codec_ctx->get_format = GetHardwareFormat;
+  }
+
+  if (avcodec_open2(m_codec_ctx, codec, NULL) < 0)
+  {
+    avcodec_free_context(&m_codec_ctx);
+    return false;
+  }
+
+  return true;
+}
+
+bool CFFmpegImage::Initialize(unsigned char* buffer, size_t bufSize, bool allowHardware)
 {
   int bufferSize = 4096;
   uint8_t* fbuffer = (uint8_t*)av_malloc(bufferSize + AV_INPUT_BUFFER_PADDING_SIZE);
@@ -263,26 +358,27 @@ bool CFFmpegImage::Initialize(unsigned char* buffer, size_t bufSize)
   }
   AVCodecParameters* codec_params = m_fctx->streams[0]->codecpar;
   const AVCodec* codec = avcodec_find_decoder(codec_params->codec_id);
-  m_codec_ctx = avcodec_alloc_context3(codec);
-  if (!m_codec_ctx)
-  {
-    avformat_close_input(&m_fctx);
-    FreeIOCtx(&m_ioctx);
-    return false;
-  }
 
-  if (avcodec_parameters_to_context(m_codec_ctx, codec_params) < 0)
+  bool opened = false;
+  if (allowHardware && codec_params->codec_id == AV_CODEC_ID_MJPEG &&
+      codec_params->width * codec_params->height >= MIN_HARDWARE_PIXELS &&
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_imageHardwareDecode)
   {
-    avformat_close_input(&m_fctx);
-    avcodec_free_context(&m_codec_ctx);
-    FreeIOCtx(&m_ioctx);
-    return false;
+    if (AVBufferRef* device = GetHardwareDevice())
+      opened = OpenDecoder(codec, codec_params, device);
+    else if (!v4l2Unavailable)
+    {
+      // V4L2 memory to memory decoders return frames in system memory
+      const AVCodec* v4l2 = avcodec_find_decoder_by_name("mjpeg_v4l2m2m");
+      opened = v4l2 && OpenDecoder(v4l2, codec_params, nullptr);
+      if (!opened)
+        v4l2Unavailable = true;
+    }
   }
 
-  if (avcodec_open2(m_codec_ctx, codec, NULL) < 0)
+  if (!opened && !OpenDecoder(codec, codec_params, nullptr))
   {
     avformat_close_input(&m_fctx);
-    avcodec_free_context(&m_codec_ctx);
     FreeIOCtx(&m_ioctx);
     return false;
   }
@@ -325,6 +421,23 @@ AVFrame* CFFmpegImage::ExtractFrame()
     av_packet_unref(&pkt);
     return nullptr;
   }
+
+  if (frame->format == AV_PIX_FMT_VAAPI)
+  {
+    // download the decoded picture, scaling and conversion happen in software as before
+    AVFrame* swFrame = av_frame_alloc();
+    if (!swFrame || av_hwframe_transfer_data(swFrame, frame, 0) < 0 ||
+        av_frame_copy_props(swFrame, frame) < 0)
+    {
+      CLog::LogF(LOGDEBUG, "Could not transfer the hardware decoded frame");
+      av_frame_free(&swFrame);
+      av_frame_free(&frame);
+      av_packet_unref(&pkt);
+      return nullptr;
+    }
+    av_frame_free(&frame);
+    frame = swFrame;
+  }
   //we need milliseconds
 
 #if LIBAVCODEC_VERSION_MAJOR < 60
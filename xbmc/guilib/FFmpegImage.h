@@ -52,6 +52,9 @@ struct AVFrame;
 struct AVIOContext;
 struct AVFormatContext;
 struct AVCodecContext;
+struct AVCodecParameters;
+struct AVCodec;
+struct AVBufferRef;
 struct AVPacket;
 
 class CFFmpegImage : public IImage
@@ -71,12 +74,18 @@ public:
                                   unsigned int &bufferoutSize) override;
   void ReleaseThumbnailBuffer() override;
 
-  bool Initialize(unsigned char* buffer, size_t bufSize);
+  /*!
+   \brief Open the image for decoding.
+   \param allowHardware decode large JPEGs with VA-API or V4L2 if that's enabled and available
+   */
+  bool Initialize(unsigned char* buffer, size_t bufSize, bool allowHardware = false);
 
   std::shared_ptr<Frame> ReadFrame();
 
 private:
   static void FreeIOCtx(AVIOContext** ioctx);
+  bool OpenDecoder(const AVCodec* codec, const AVCodecParameters* params, AVBufferRef* device);
+  void Close();
   AVFrame* ExtractFrame();
   bool DecodeFrame(AVFrame* m_pFrame, unsigned int width, unsigned int height, unsigned int pitch, unsigned char * const pixels);
   static int EncodeFFmpegFrame(AVCodecContext *avctx, AVPacket *pkt, int *got_packet, AVFrame *frame);
@@ -0,0 +1,81 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GPUMemoryBudget.h"
+
+#include "ServiceBroker.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/MemUtils.h"
+
+namespace
+{
+uint64_t GetDefaultBudget()
+{
+  static const uint64_t budget = []
+  {
+    KODI::MEMORY::MemoryStatus status{};
+    KODI::MEMORY::GetMemoryStatus(&status);
+    return status.totalPhys / 8;
+  }();
+  return budget;
+}
+} // unnamed namespace
+
+CGPUMemoryBudget& CGPUMemoryBudget::GetInstance()
+{
+  static CGPUMemoryBudget budget;
+  return budget;
+}
+
+void CGPUMemoryBudget::SetUsage(Consumer consumer, uint64_t bytes)
+{
+  m_usage[static_cast<size_t>(consumer)] = bytes;
+}
+
+void CGPUMemoryBudget::Add(Consumer consumer, uint64_t bytes)
+{
+  m_usage[static_cast<size_t>(consumer)] += bytes;
+}
+
+void CGPUMemoryBudget::Remove(Consumer consumer, uint64_t bytes)
+{
+  m_usage[static_cast<size_t>(consumer)] -= bytes;
+}
+
+uint64_t CGPUMemoryBudget::GetUsage(Consumer consumer) const
+{
+  return m_usage[static_cast<size_t>(consumer)];
+}
+
+uint64_t CGPUMemoryBudget::GetTotalUsage() const
+{
+  uint64_t total = 0;
+  for (const auto& usage : m_usage)
+    total += usage;
+  return total;
+}
+
+uint64_t CGPUMemoryBudget::GetBudget() const
+{
+  const auto settingsComponent = CServiceBroker::GetSettingsComponent();
+  if (settingsComponent)
+  {
+    const auto advancedSettings = settingsComponent->GetAdvancedSettings();
+    if (advancedSettings && advancedSettings->m_guiTextureMemory > 0)
+      return static_cast<uint64_t>(advancedSettings->m_guiTextureMemory) * 1024 * 1024;
+  }
+  return GetDefaultBudget();
+}
+
+uint64_t CGPUMemoryBudget::GetExcess() const
+{
+  const uint64_t budget = GetBudget();
+  const uint64_t total = GetTotalUsage();
+  return total > budget ? total - budget : 0;
+}
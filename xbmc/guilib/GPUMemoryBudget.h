@@ -0,0 +1,55 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/*!
+ \ingroup textures
+ \brief Process wide account of the graphics memory used by the GUI textures and video buffers
+
+ On SoCs the GUI textures and the decoded video frames come out of the same memory (VRAM or
+ CMA). The users report what they hold, the texture managers get rid of their unused textures,
+ the least recently released first, while the total is over the budget. Textures still referenced
+ by a control are never evicted, so what is on screen stays loaded.
+
+ The budget is <gui><texturememory> of advancedsettings.xml in MiB, by default an eighth of the
+ physical memory.
+ */
+class CGPUMemoryBudget
+{
+public:
+  enum class Consumer
+  {
+    GUI_TEXTURES,
+    LARGE_TEXTURES,
+    VIDEO_BUFFERS,
+  };
+
+  static CGPUMemoryBudget& GetInstance();
+
+  /*! \brief Replace the usage of a consumer that counts its memory as a whole */
+  void SetUsage(Consumer consumer, uint64_t bytes);
+  void Add(Consumer consumer, uint64_t bytes);
+  void Remove(Consumer consumer, uint64_t bytes);
+
+  uint64_t GetUsage(Consumer consumer) const;
+  uint64_t GetTotalUsage() const;
+  uint64_t GetBudget() const;
+
+  /*! \brief Bytes the consumers are over the budget, 0 while within it */
+  uint64_t GetExcess() const;
+
+private:
+  CGPUMemoryBudget() = default;
+
+  std::array<std::atomic<uint64_t>, 3> m_usage{};
+};
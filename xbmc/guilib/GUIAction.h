@@ -107,6 +107,10 @@ public:
    * Get the total number of actions
   */
   size_t GetActionCount() const;
+  /**
+   * Get the executable actions
+   */
+  const std::vector<CExecutableAction>& GetActions() const { return m_actions; }
   /**
    * Get navigation route that meet its conditions first
    */
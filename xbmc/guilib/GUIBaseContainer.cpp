@@ -10,9 +10,11 @@
 
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "GUIComponent.h"
 #include "GUIInfoManager.h"
 #include "GUIListItemLayout.h"
 #include "GUIMessage.h"
+#include "GUIWindowManager.h"
 #include "ServiceBroker.h"
 #include "guilib/GUIListItem.h"
 #include "guilib/guiinfo/GUIInfoLabels.h"
@@ -276,10 +278,19 @@ void CGUIBaseContainer::ProcessItem(float posX,
     if (item->GetLayout())
       item->GetLayout()->Process(item.get(), m_parentID, currentTime, dirtyregions);
   }
+  TrackLaidOutItem(item);
 
   CServiceBroker::GetWinSystem()->GetGfxContext().RestoreOrigin();
 }
 
+void CGUIBaseContainer::TrackLaidOutItem(const std::shared_ptr<CGUIListItem>& item)
+{
+  // the index is set by Process() just before the item is processed
+  m_laidOutItems.insert_or_assign(item.get(),
+                                  std::make_pair(std::weak_ptr<CGUIListItem>(item),
+                                                 static_cast<int>(item->GetCurrentItem()) - 1));
+}
+
 void CGUIBaseContainer::Render()
 {
   if (!m_layout || !m_focusedLayout) return;
@@ -1031,6 +1042,7 @@ void CGUIBaseContainer::UpdateLayout(bool updateAllItems)
   { // free memory of items
     for (iItems it = m_items.begin(); it != m_items.end(); ++it)
       (*it)->FreeMemory();
+    m_laidOutItems.clear();
   }
   // and recalculate the layout
   CalculateLayout();
@@ -1115,7 +1127,9 @@ void CGUIBaseContainer::AssignDepth()
 
 void CGUIBaseContainer::UpdateListProvider(bool forceRefresh /* = false */)
 {
-  if (m_listProvider)
+  // a refresh can wait for the next frame once this one is out of time
+  if (m_listProvider &&
+      (forceRefresh || CServiceBroker::GetGUI()->GetWindowManager().GetFrameBudget().HasTime()))
   {
     if (m_listProvider->Update(forceRefresh))
     {
@@ -1124,8 +1138,13 @@ void CGUIBaseContainer::UpdateListProvider(bool forceRefresh /* = false */)
       CGUIListItem *current = (currentItem >= 0 && currentItem < (int)m_items.size()) ? m_items[currentItem].get() : NULL;
       const std::string prevSelectedPath((current && current->IsFileItem()) ? static_cast<CFileItem *>(current)->GetPath() : "");
 
+      // providers keep the instances of unchanged items, so the focused one stays focused
+      const std::shared_ptr<CGUIListItem> lastItem = m_lastItem;
+
       Reset();
       m_listProvider->Fetch(m_items);
+      if (lastItem && std::ranges::find(m_items, lastItem) != m_items.end())
+        m_lastItem = lastItem;
       SetPageControlRange();
       // update the newly selected item
       bool found = false;
@@ -1381,17 +1400,28 @@ void CGUIBaseContainer::SetRenderOffset(const CPoint &offset)
 
 void CGUIBaseContainer::FreeMemory(int keepStart, int keepEnd)
 {
-  if (keepStart < keepEnd)
-  { // remove before keepStart and after keepEnd
-    for (int i = 0; i < keepStart && i < (int)m_items.size(); ++i)
-      m_items[i]->FreeMemory();
-    for (int i = std::max(keepEnd + 1, 0); i < (int)m_items.size(); ++i)
-      m_items[i]->FreeMemory();
-  }
-  else
-  { // wrapping
-    for (int i = std::max(keepEnd + 1, 0); i < keepStart && i < (int)m_items.size(); ++i)
-      m_items[i]->FreeMemory();
+  const auto keep = [keepStart, keepEnd](int index)
+  {
+    if (keepStart < keepEnd)
+      return index >= keepStart && index <= keepEnd;
+    // wrapping
+    return index <= keepEnd || index >= keepStart;
+  };
+
+  for (auto it = m_laidOutItems.begin(); it != m_laidOutItems.end();)
+  {
+    const auto& [weakItem, index] = it->second;
+    const std::shared_ptr<CGUIListItem> item = weakItem.lock();
+    if (item && keep(index) && index < static_cast<int>(m_items.size()) && m_items[index] == item)
+    {
+      ++it;
+      continue;
+    }
+
+    // out of range, or the list changed since the item was shown
+    if (item)
+      item->FreeMemory();
+    it = m_laidOutItems.erase(it);
   }
 }
 
@@ -20,6 +20,7 @@
 #include <list>
 #include <memory>
 #include <optional>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -238,6 +239,12 @@ protected:
 
 private:
   bool OnContextMenu();
+  void TrackLaidOutItem(const std::shared_ptr<CGUIListItem>& item);
+
+  /*! \brief Items this container created or used layouts for, with the index they were shown at.
+   FreeMemory() only visits these, not every item of the (possibly huge) list on each frame. */
+  std::unordered_map<const CGUIListItem*, std::pair<std::weak_ptr<CGUIListItem>, int>>
+      m_laidOutItems;
 
   int m_cursor;
   int m_offset;
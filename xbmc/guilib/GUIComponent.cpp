@@ -20,6 +20,7 @@
 #include "URL.h"
 #include "dialogs/GUIDialogYesNo.h"
 #include "handlers/GUIAnnouncementHandlerContainer.h"
+#include "utils/MemoryPressure.h"
 
 #include <memory>
 
@@ -52,10 +53,44 @@ void CGUIComponent::Init()
   m_guiInfoManager->Initialize();
 
   CServiceBroker::RegisterGUI(this);
+
+  // both are trimmed from the application thread, which is where their unused textures are freed
+  if (const auto memoryPressure = CServiceBroker::GetMemoryPressureManager())
+  {
+    m_memoryCaches.push_back(memoryPressure->RegisterCache(
+        "textures", 10,
+        [this]
+        {
+          return CMemoryPressureManager::Usage{m_pTextureManager->GetMemoryUsage() +
+                                                   m_pTextureManager->GetUnusedMemoryUsage(),
+                                               0};
+        },
+        [this](MemoryPressure pressure)
+        {
+          m_pTextureManager->FreeUnusedTextures();
+          if (pressure == MemoryPressure::CRITICAL)
+            m_pTextureManager->Flush();
+        }));
+    m_memoryCaches.push_back(memoryPressure->RegisterCache(
+        "largetextures", 20,
+        [this]
+        {
+          return CMemoryPressureManager::Usage{m_pLargeTextureManager->GetMemoryUsage(),
+                                               m_pLargeTextureManager->GetImageCount()};
+        },
+        [this](MemoryPressure) { m_pLargeTextureManager->CleanupUnusedImages(true); }));
+  }
 }
 
 void CGUIComponent::Deinit()
 {
+  if (const auto memoryPressure = CServiceBroker::GetMemoryPressureManager())
+  {
+    for (const unsigned int id : m_memoryCaches)
+      memoryPressure->UnregisterCache(id);
+  }
+  m_memoryCaches.clear();
+
   CServiceBroker::UnregisterGUI();
 
   if (m_pWindowManager)
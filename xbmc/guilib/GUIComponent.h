@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 class CGUIWindowManager;
 class CGUITextureManager;
@@ -62,5 +63,8 @@ protected:
   std::unique_ptr<CGUIColorManager> m_guiColorManager;
   std::unique_ptr<CGUIAudioManager> m_guiAudioManager;
   std::unique_ptr<CGUIAnnouncementHandlerContainer> m_announcementHandlerContainer;
+
+  //! ids of the texture caches registered with the memory pressure manager
+  std::vector<unsigned int> m_memoryCaches;
   std::shared_ptr<ADDON::CSkinInfo> m_skinInfo;
 };
@@ -512,6 +512,22 @@ void CGUIControl::MarkDirtyRegion(const unsigned int dirtyState)
   m_controlDirtyState |= dirtyState;
 }
 
+bool CGUIControl::OccludesRegion(const CRect& region) const
+{
+  // the cached transform includes the animations and those of the parents
+  if (!IsVisible() || m_isCulled || !IsOpaque() || m_cachedTransform.alpha < 1.0f)
+    return false;
+
+  // the render region is the bounding box on screen, it is only exact without rotation
+  const float(&m)[3][4] = m_cachedTransform.m;
+  if (m[0][1] != 0.0f || m[0][2] != 0.0f || m[1][0] != 0.0f || m[1][2] != 0.0f ||
+      m[2][0] != 0.0f || m[2][1] != 0.0f)
+    return false;
+
+  return m_renderRegion.x1 <= region.x1 && m_renderRegion.y1 <= region.y1 &&
+         m_renderRegion.x2 >= region.x2 && m_renderRegion.y2 >= region.y2;
+}
+
 CRect CGUIControl::CalcRenderRegion() const
 {
   CPoint tl(GetXPosition(), GetYPosition());
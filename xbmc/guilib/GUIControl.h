@@ -197,6 +197,20 @@ public:
    */
   virtual CRect CalcRenderRegion() const;
 
+  /*! \brief Opacity hint of the control
+   \return true if the control draws every pixel of its render region fully opaque
+   \sa OccludesRegion
+   */
+  virtual bool IsOpaque() const { return false; }
+
+  /*! \brief Check if anything rendered beneath this control is hidden within the given region
+   The control has to be opaque, visible, without fading and axis aligned on screen, with a render
+   region covering the whole given region.
+   \param region the region in screen coordinates
+   \return true if the region is fully covered by this control
+   */
+  virtual bool OccludesRegion(const CRect& region) const;
+
   /*! \brief Set actions to perform on navigation
    \param actions ActionMap of actions
    \sa SetNavigationAction
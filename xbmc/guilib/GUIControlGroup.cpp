@@ -9,11 +9,16 @@
 #include "GUIControlGroup.h"
 
 #include "GUIMessage.h"
+#include "IDirtyRegionSolver.h"
 #include "ServiceBroker.h"
 #include "input/mouse/MouseEvent.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <utility>
 
 using namespace KODI;
@@ -109,11 +114,28 @@ void CGUIControlGroup::Render()
 {
   CPoint pos(GetPosition());
   CServiceBroker::GetWinSystem()->GetGfxContext().SetOrigin(pos.x, pos.y);
+
+  // skip the children hidden beneath an opaque child covering the region we render
+  auto first = m_children.begin();
+  if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiAlgorithmDirtyRegions ==
+      DIRTYREGION_SOLVER_OCCLUSION)
+  {
+    const CRect& region = CServiceBroker::GetWinSystem()->GetGfxContext().GetScissors();
+    for (auto it = m_children.rbegin(); it != m_children.rend(); ++it)
+    {
+      if ((*it)->OccludesRegion(region))
+      {
+        first = std::prev(it.base());
+        break;
+      }
+    }
+  }
+
   CGUIControl *focusedControl = NULL;
   if (CServiceBroker::GetWinSystem()->GetGfxContext().GetRenderOrder() ==
       RENDER_ORDER_FRONT_TO_BACK)
   {
-    for (auto it = m_children.rbegin(); it != m_children.rend(); ++it)
+    for (auto it = m_children.rbegin(); it != std::make_reverse_iterator(first); ++it)
     {
       if (m_renderFocusedLast && (*it)->HasFocus())
         focusedControl = (*it);
@@ -123,14 +145,22 @@ void CGUIControlGroup::Render()
   }
   else
   {
-    for (auto* control : m_children)
+    for (auto it = first; it != m_children.end(); ++it)
     {
-      if (m_renderFocusedLast && control->HasFocus())
-        focusedControl = control;
+      if (m_renderFocusedLast && (*it)->HasFocus())
+        focusedControl = (*it);
       else
-        control->DoRender();
+        (*it)->DoRender();
     }
   }
+  // the focused control is rendered last, so it is on top of any occluder
+  if (!focusedControl && m_renderFocusedLast && first != m_children.begin())
+  {
+    auto it = std::find_if(m_children.begin(), first,
+                           [](const CGUIControl* control) { return control->HasFocus(); });
+    if (it != first)
+      focusedControl = *it;
+  }
   if (focusedControl)
     focusedControl->DoRender();
   CGUIControl::Render();
@@ -144,6 +174,16 @@ void CGUIControlGroup::RenderEx()
   CGUIControl::RenderEx();
 }
 
+bool CGUIControlGroup::OccludesRegion(const CRect& region) const
+{
+  if (!IsVisible() || m_isCulled)
+    return false;
+
+  return std::any_of(m_children.begin(), m_children.end(),
+                     [&region](const CGUIControl* control)
+                     { return control->OccludesRegion(region); });
+}
+
 bool CGUIControlGroup::OnAction(const CAction &action)
 {
   return false;
@@ -37,6 +37,7 @@ public:
   bool OnMessage(CGUIMessage& message) override;
   virtual bool SendControlMessage(CGUIMessage& message);
   bool HasFocus() const override;
+  bool OccludesRegion(const CRect& region) const override;
   void AllocResources() override;
   void FreeResources(bool immediately = false) override;
   void DynamicResourceAlloc(bool bOnOff) override;
@@ -42,6 +42,8 @@ public:
 
   void Process(unsigned int currentTime, CDirtyRegionList &dirtyregions) override;
   void Render() override;
+  // the children are clipped to the list, their render regions don't tell what is covered
+  bool OccludesRegion(const CRect& region) const override { return false; }
   bool OnAction(const CAction& action) override;
   bool OnMessage(CGUIMessage& message) override;
 
@@ -12,10 +12,14 @@
 #include "ServiceBroker.h"
 #include "Texture.h"
 #include "URL.h"
+#include "filesystem/Directory.h"
 #include "filesystem/File.h"
 #include "filesystem/SpecialProtocol.h"
 #include "rendering/RenderSystem.h"
 #include "threads/SystemClock.h"
+#include "utils/Crc32.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
 #include "utils/MathUtils.h"
 #include "utils/log.h"
 #include "windowing/GraphicContext.h"
@@ -58,7 +62,13 @@ constexpr unsigned int SPACING_BETWEEN_CHARACTERS_IN_TEXTURE = 1;
 constexpr int CHAR_CHUNK = 64; // 64 chars allocated at a time (2048 bytes)
 constexpr int GLYPH_STRENGTH_BOLD = 24;
 constexpr int GLYPH_STRENGTH_LIGHT = -48;
+constexpr uint32_t GLYPH_CACHE_MAGIC = 0x594c474b; // "KGLY"
+constexpr uint32_t GLYPH_CACHE_VERSION = 1;
+constexpr size_t MAX_PREWARM_GLYPHS = 1024; // keep loading the font quick
+constexpr size_t SHAPED_TEXT_CACHE_SIZE = 512; // labels on screen plus some scrolling
 constexpr int TAB_SPACE_LENGTH = 4;
+constexpr float SDF_REFERENCE_SIZE = 32.0f; // larger fonts are drawn from glyphs of this size
+constexpr unsigned int SDF_SPREAD = 8; // FreeType's default distance range around the outline
 
 // \brief Check for conflicting alignments
 void ValidateAlignments(uint32_t& aligns)
@@ -236,6 +246,8 @@ void CGUIFontTTF::ClearCharacterCache()
 
 void CGUIFontTTF::Clear()
 {
+  SaveGlyphCache();
+
   m_texture.reset();
   m_texture = nullptr;
   memset(m_charquick, 0, sizeof(m_charquick));
@@ -255,6 +267,8 @@ void CGUIFontTTF::Clear()
 
   m_vertexTrans.clear();
   m_vertex.clear();
+  m_shapedTextCache.clear();
+  m_shapedTextLRU.clear();
 
   m_fontFileInMemory.clear();
 }
@@ -321,11 +335,21 @@ bool CGUIFontTTF::Load(
 
   m_height = height;
 
+  // distance fields stay sharp when magnified, so big sizes share the glyphs of a small one
+  m_sdf = false;
+#if !defined(HAS_DX) && (FREETYPE_MAJOR > 2 || (FREETYPE_MAJOR == 2 && FREETYPE_MINOR >= 11))
+  m_sdf = m_renderSystem->UseSDFFonts();
+#endif
+  m_glyphScale = m_sdf ? std::max(1.0f, height / SDF_REFERENCE_SIZE) : 1.0f;
+  m_textureCellHeight =
+      m_sdf ? static_cast<unsigned int>(std::ceil(m_cellHeight / m_glyphScale)) + 2 * SDF_SPREAD
+            : m_cellHeight;
+
   m_texture.reset();
   m_texture = nullptr;
 
   m_textureHeight = 0;
-  m_textureWidth = ((m_cellHeight * CHARS_PER_TEXTURE_LINE) & ~63) + 64;
+  m_textureWidth = ((m_textureCellHeight * CHARS_PER_TEXTURE_LINE) & ~63) + 64;
 
   m_textureWidth = CTexture::PadPow2(m_textureWidth);
 
@@ -337,9 +361,87 @@ bool CGUIFontTTF::Load(
   m_posX = m_textureWidth;
   m_posY = -static_cast<int>(GetTextureLineHeight());
 
+  m_glyphCacheFile = StringUtils::Format(
+      "special://temp/fontcache/{}-{:08x}.glyphs", URIUtils::GetFileName(strFilename),
+      Crc32::ComputeFromLowerCase(
+          StringUtils::Format("{}|{:f}|{:f}|{}", strFilename, height, aspect, border)));
+  PrewarmCharacters();
+
   return true;
 }
 
+void CGUIFontTTF::PrewarmCharacters()
+{
+  const std::vector<character_t> glyphs = LoadGlyphCache();
+  if (glyphs.empty())
+  {
+    // never used before, at least have basic latin ready for the first frame
+    for (character_t letter = 0x20; letter < 0x7f; ++letter)
+    {
+      if (!GetCharacter(letter, 0))
+        break;
+    }
+  }
+  else
+  {
+    for (const character_t glyphAndStyle : glyphs)
+    {
+      // GetCharacter() takes the style in bits 24-26, the cache stores it in bits 16-18
+      if (!GetCharacter((glyphAndStyle >> 16) << 24, glyphAndStyle & 0xffff))
+        break;
+    }
+  }
+  m_savedGlyphCount = m_char.size();
+}
+
+std::vector<character_t> CGUIFontTTF::LoadGlyphCache() const
+{
+  XFILE::CFile file;
+  if (m_glyphCacheFile.empty() || !file.Open(m_glyphCacheFile))
+    return {};
+
+  uint32_t header[3];
+  if (file.Read(header, sizeof(header)) != sizeof(header) || header[0] != GLYPH_CACHE_MAGIC ||
+      header[1] != GLYPH_CACHE_VERSION || header[2] > MAX_PREWARM_GLYPHS)
+    return {};
+
+  std::vector<character_t> glyphs(header[2]);
+  const ssize_t size = glyphs.size() * sizeof(character_t);
+  if (file.Read(glyphs.data(), size) != size)
+    return {};
+  return glyphs;
+}
+
+void CGUIFontTTF::SaveGlyphCache()
+{
+  if (m_glyphCacheFile.empty() || m_char.size() <= m_savedGlyphCount)
+    return;
+
+  XFILE::CDirectory::Create(URIUtils::GetDirectory(m_glyphCacheFile));
+
+  std::vector<character_t> glyphs;
+  glyphs.reserve(std::min(m_char.size(), MAX_PREWARM_GLYPHS));
+  for (const Character& ch : m_char)
+  {
+    if (glyphs.size() == MAX_PREWARM_GLYPHS)
+      break;
+    glyphs.emplace_back(ch.m_glyphAndStyle);
+  }
+
+  const uint32_t header[3] = {GLYPH_CACHE_MAGIC, GLYPH_CACHE_VERSION,
+                              static_cast<uint32_t>(glyphs.size())};
+  XFILE::CFile file;
+  if (!file.OpenForWrite(m_glyphCacheFile, true) ||
+      file.Write(header, sizeof(header)) != sizeof(header) ||
+      file.Write(glyphs.data(), glyphs.size() * sizeof(character_t)) !=
+          static_cast<ssize_t>(glyphs.size() * sizeof(character_t)))
+  {
+    CLog::LogF(LOGDEBUG, "Unable to write the glyph cache {}", m_glyphCacheFile);
+    return;
+  }
+  m_savedGlyphCount = m_char.size();
+}
+
 void CGUIFontTTF::Begin()
 {
   if (m_nestedBeginCount == 0 && m_texture && FirstBegin())
@@ -766,7 +868,7 @@ float CGUIFontTTF::GetTextWidthInternal(std::span<const character_t> text,
       // and not advance distance - this makes sure that italic text isn't
       // choped on the end (as render width is larger than advance then).
       if (std::next(it) == glyphs.end())
-        width += std::max(c->m_right - c->m_left + c->m_offsetX, c->m_advance);
+        width += std::max((c->m_right - c->m_left) * m_glyphScale + c->m_offsetX, c->m_advance);
       else if ((ch & 0xffff) == static_cast<character_t>('\t'))
         width += GetTabSpaceLength();
       else
@@ -806,7 +908,7 @@ float CGUIFontTTF::GetLineHeight(float lineSpacing) const
 
 unsigned int CGUIFontTTF::GetTextureLineHeight() const
 {
-  return m_cellHeight + SPACING_BETWEEN_CHARACTERS_IN_TEXTURE;
+  return m_textureCellHeight + SPACING_BETWEEN_CHARACTERS_IN_TEXTURE;
 }
 
 unsigned int CGUIFontTTF::GetMaxFontHeight() const
@@ -817,12 +919,39 @@ unsigned int CGUIFontTTF::GetMaxFontHeight() const
 std::vector<CGUIFontTTF::Glyph> CGUIFontTTF::GetHarfBuzzShapedGlyphs(
     std::span<const character_t> text)
 {
-  std::vector<Glyph> glyphs;
   if (text.empty())
+    return {};
+
+  // shaping only looks at the characters, not at their style or color
+  std::u16string key;
+  key.reserve(text.size());
+  for (const auto& character : text)
+    key.push_back(static_cast<char16_t>(character & 0xffff));
+
+  const auto cached = m_shapedTextCache.find(key);
+  if (cached != m_shapedTextCache.end())
   {
-    return glyphs;
+    m_shapedTextLRU.splice(m_shapedTextLRU.begin(), m_shapedTextLRU, cached->second);
+    return cached->second->second;
   }
 
+  std::vector<Glyph> glyphs = ShapeText(text);
+
+  if (m_shapedTextLRU.size() == SHAPED_TEXT_CACHE_SIZE)
+  {
+    m_shapedTextCache.erase(m_shapedTextLRU.back().first);
+    m_shapedTextLRU.pop_back();
+  }
+  m_shapedTextLRU.emplace_front(std::move(key), glyphs);
+  m_shapedTextCache.emplace(m_shapedTextLRU.front().first, m_shapedTextLRU.begin());
+
+  return glyphs;
+}
+
+std::vector<CGUIFontTTF::Glyph> CGUIFontTTF::ShapeText(std::span<const character_t> text) const
+{
+  std::vector<Glyph> glyphs;
+
   std::vector<hb_script_t> scripts;
   std::vector<RunInfo> runs;
   hb_unicode_funcs_t* ufuncs = hb_unicode_funcs_get_default();
@@ -1032,8 +1161,22 @@ bool CGUIFontTTF::CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character*
   }
   if (m_stroker)
     FT_Glyph_StrokeBorder(&glyph, m_stroker, 0, 1);
+
+  FT_Render_Mode renderMode = FT_RENDER_MODE_NORMAL;
+#if FREETYPE_MAJOR > 2 || (FREETYPE_MAJOR == 2 && FREETYPE_MINOR >= 11)
+  if (m_sdf)
+  {
+    if (m_glyphScale > 1.0f)
+    {
+      const FT_Fixed scale = static_cast<FT_Fixed>(0x10000 / m_glyphScale);
+      FT_Matrix matrix{scale, 0, 0, scale};
+      FT_Glyph_Transform(glyph, &matrix, nullptr);
+    }
+    renderMode = FT_RENDER_MODE_SDF;
+  }
+#endif
   // render the glyph
-  if (FT_Glyph_To_Bitmap(&glyph, FT_RENDER_MODE_NORMAL, nullptr, 1))
+  if (FT_Glyph_To_Bitmap(&glyph, renderMode, nullptr, 1))
   {
     CLog::LogF(LOGDEBUG, "Failed to render glyph {:x} to a bitmap", glyphIndex);
     return false;
@@ -1070,6 +1213,9 @@ bool CGUIFontTTF::CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character*
           FT_Done_Glyph(glyph);
           return false;
         }
+        // grow geometrically, so filling the texture only reallocates and copies it a few times
+        newHeight = std::min(std::max(newHeight, m_textureHeight * 2),
+                             m_renderSystem->GetMaxTextureSize());
 
         std::unique_ptr<CTexture> newTexture = ReallocTexture(newHeight);
         if (!newTexture)
@@ -1094,8 +1240,9 @@ bool CGUIFontTTF::CacheCharacter(FT_UInt glyphIndex, uint32_t style, Character*
   // set the character in our table
   ch->m_glyphAndStyle = (style << 16) | glyphIndex;
   ch->m_glyphIndex = glyphIndex;
-  ch->m_offsetX = static_cast<short>(bitGlyph->left);
-  ch->m_offsetY = static_cast<short>(m_cellBaseLine - bitGlyph->top);
+  ch->m_offsetX = static_cast<short>(MathUtils::round_int(bitGlyph->left * m_glyphScale));
+  ch->m_offsetY = static_cast<short>(
+      MathUtils::round_int(m_cellBaseLine - bitGlyph->top * m_glyphScale));
   ch->m_left = isEmptyGlyph ? 0.0f : (static_cast<float>(m_posX));
   ch->m_top = isEmptyGlyph ? 0.0f : (static_cast<float>(m_posY));
   ch->m_right = ch->m_left + bitmap.width;
@@ -1134,8 +1281,8 @@ void CGUIFontTTF::RenderCharacter(CGraphicContext& context,
 {
   // actual image width isn't same as the character width as that is
   // just baseline width and height should include the descent
-  const float width = ch->m_right - ch->m_left;
-  const float height = ch->m_bottom - ch->m_top;
+  const float width = (ch->m_right - ch->m_left) * m_glyphScale;
+  const float height = (ch->m_bottom - ch->m_top) * m_glyphScale;
 
   // return early if nothing to render
   if (width == 0 || height == 0)
@@ -1276,29 +1423,31 @@ void CGUIFontTTF::RenderCharacter(CGraphicContext& context,
   if (roundX)
     xOffset = (vertex.x1 - std::floor(vertex.x1));
   float yOffset = (vertex.y1 - std::floor(vertex.y1));
+  // half a texel, which covers more pixels when the glyphs are magnified
+  const float grow = 0.5f * m_glyphScale;
 
   v[0].u = tl;
   v[0].v = tt;
-  v[0].x = vertex.x1 - xOffset - 0.5f;
-  v[0].y = vertex.y1 - yOffset - 0.5f;
+  v[0].x = vertex.x1 - xOffset - grow;
+  v[0].y = vertex.y1 - yOffset - grow;
   v[0].z = 0;
 
   v[1].u = tl;
   v[1].v = tb;
-  v[1].x = vertex.x1 - xOffset - 0.5f;
-  v[1].y = vertex.y2 - yOffset + 0.5f;
+  v[1].x = vertex.x1 - xOffset - grow;
+  v[1].y = vertex.y2 - yOffset + grow;
   v[1].z = 0;
 
   v[2].u = tr;
   v[2].v = tt;
-  v[2].x = vertex.x2 - xOffset + 0.5f;
-  v[2].y = vertex.y1 - yOffset - 0.5f;
+  v[2].x = vertex.x2 - xOffset + grow;
+  v[2].y = vertex.y1 - yOffset - grow;
   v[2].z = 0;
 
   v[3].u = tr;
   v[3].v = tb;
-  v[3].x = vertex.x2 - xOffset + 0.5f;
-  v[3].y = vertex.y2 - yOffset + 0.5f;
+  v[3].x = vertex.x2 - xOffset + grow;
+  v[3].y = vertex.y2 - yOffset + grow;
   v[3].z = 0;
 #endif
 }
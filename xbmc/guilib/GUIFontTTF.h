@@ -12,9 +12,12 @@
 #include "utils/ColorUtils.h"
 #include "utils/Geometry.h"
 
+#include <list>
 #include <memory>
 #include <stdint.h>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <ft2build.h>
@@ -147,7 +150,11 @@ protected:
   void AddReference();
   void RemoveReference();
 
+  /*! \brief Shape the text, reusing the result of the last few hundred texts shaped with
+   this font. Labels get measured and laid out again much more often than they change.
+   */
   std::vector<Glyph> GetHarfBuzzShapedGlyphs(std::span<const character_t> text);
+  std::vector<Glyph> ShapeText(std::span<const character_t> text) const;
 
   float GetTextWidthInternal(std::span<const character_t> text);
   float GetTextWidthInternal(std::span<const character_t> text, const std::vector<Glyph>& glyph);
@@ -182,6 +189,13 @@ protected:
                        std::vector<SVertex>& vertices);
   void ClearCharacterCache();
 
+  /*! \brief Cache the glyphs this font used last time, so the first frames don't have to
+   rasterize them. Fonts without a glyph cache get basic latin.
+   */
+  void PrewarmCharacters();
+  std::vector<character_t> LoadGlyphCache() const;
+  void SaveGlyphCache();
+
   virtual std::unique_ptr<CTexture> ReallocTexture(unsigned int& newHeight) = 0;
   virtual bool CopyCharToTexture(FT_BitmapGlyph bitGlyph,
                                  unsigned int x1,
@@ -211,6 +225,8 @@ protected:
   KODI::UTILS::COLOR::Color m_color{KODI::UTILS::COLOR::NONE};
 
   std::vector<Character> m_char; // our characters
+  std::string m_glyphCacheFile; // glyphs used by this font, to prewarm it next time
+  size_t m_savedGlyphCount{0};
 
   // room for the first MAX_GLYPH_IDX glyphs in 7 styles
   Character* m_charquick[LOOKUPTABLE_SIZE]{nullptr};
@@ -220,6 +236,10 @@ protected:
 
   unsigned int m_cellBaseLine{0};
   unsigned int m_cellHeight{0};
+  unsigned int m_textureCellHeight{0}; // m_cellHeight as stored in the texture
+
+  bool m_sdf{false}; // glyphs are signed distance fields
+  float m_glyphScale{1.0f}; // size of the drawn glyphs relative to the texture
   unsigned int m_maxFontHeight{0};
 
   unsigned int m_nestedBeginCount{0}; // speedups
@@ -274,6 +294,10 @@ protected:
   CGUIFontCache<CGUIFontCacheStaticPosition, CGUIFontCacheStaticValue> m_staticCache;
   CGUIFontCache<CGUIFontCacheDynamicPosition, CGUIFontCacheDynamicValue> m_dynamicCache;
 
+  using ShapedText = std::pair<std::u16string, std::vector<Glyph>>;
+  std::list<ShapedText> m_shapedTextLRU; // most recently used first
+  std::unordered_map<std::u16string_view, std::list<ShapedText>::iterator> m_shapedTextCache;
+
   CRenderSystemBase* m_renderSystem;
 
 private:
@@ -0,0 +1,72 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIFrameBudget.h"
+
+#include "utils/log.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// share of the frame period for input and GUI processing, the rest is left for rendering
+constexpr float PROCESS_BUDGET_SHARE = 0.5f;
+// used if the display doesn't report a refresh rate
+constexpr float DEFAULT_FPS = 60.0f;
+constexpr auto REPORT_INTERVAL = 10s;
+} // namespace
+
+void CGUIFrameBudget::BeginFrame(float fps)
+{
+  if (fps <= 0.0f)
+    fps = DEFAULT_FPS;
+
+  const std::chrono::duration<float> period(1.0f / fps);
+  m_framePeriod = std::chrono::duration_cast<Clock::duration>(period);
+  m_frameStart = Clock::now();
+  m_processDeadline =
+      m_frameStart + std::chrono::duration_cast<Clock::duration>(period * PROCESS_BUDGET_SHARE);
+  m_inFrame = true;
+}
+
+void CGUIFrameBudget::EndFrame()
+{
+  if (!m_inFrame)
+    return;
+  m_inFrame = false;
+
+  const auto now = Clock::now();
+  m_reportFrames++;
+  if (now - m_frameStart > m_framePeriod)
+  {
+    m_missedFrames++;
+    m_reportMissedFrames++;
+  }
+
+  if (now - m_lastReport < REPORT_INTERVAL)
+    return;
+
+  if (m_reportMissedFrames > 0)
+    CLog::Log(LOGDEBUG,
+              "CGUIFrameBudget: {} of {} frames missed their deadline, {} updates deferred",
+              m_reportMissedFrames, m_reportFrames, m_reportDeferredUpdates);
+  m_lastReport = now;
+  m_reportFrames = 0;
+  m_reportMissedFrames = 0;
+  m_reportDeferredUpdates = 0;
+}
+
+bool CGUIFrameBudget::HasTime()
+{
+  if (!m_inFrame || Clock::now() < m_processDeadline)
+    return true;
+
+  m_deferredUpdates++;
+  m_reportDeferredUpdates++;
+  return false;
+}
@@ -0,0 +1,59 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <chrono>
+
+/*!
+ \ingroup winman
+ \brief Time budget of the GUI processing of a frame
+
+ The application starts a frame before processing input and the GUI and ends it before presenting
+ the frame. Controls check HasTime() before work that can wait a frame without any visible effect,
+ such as periodic info updates or list provider refreshes, and skip it once the processing share of
+ the frame period is spent. Frames that take longer than the display's frame period are counted as
+ missed.
+ */
+class CGUIFrameBudget
+{
+public:
+  /*! \brief Start the budget of a new frame
+   \param fps the refresh rate of the display
+   */
+  void BeginFrame(float fps);
+
+  /*! \brief End the current frame and check it against its deadline
+   */
+  void EndFrame();
+
+  /*! \brief Check if there is time left for deferrable work in the current frame
+   Every call without time left counts as deferred work.
+   \return true if the work should be done in this frame
+   */
+  bool HasTime();
+
+  unsigned int GetMissedFrames() const { return m_missedFrames; }
+  unsigned int GetDeferredUpdates() const { return m_deferredUpdates; }
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  Clock::time_point m_frameStart;
+  Clock::time_point m_processDeadline;
+  Clock::duration m_framePeriod{};
+  bool m_inFrame{false};
+
+  unsigned int m_missedFrames{0};
+  unsigned int m_deferredUpdates{0};
+
+  Clock::time_point m_lastReport;
+  unsigned int m_reportFrames{0};
+  unsigned int m_reportMissedFrames{0};
+  unsigned int m_reportDeferredUpdates{0};
+};
@@ -89,6 +89,7 @@ public:
   float GetTextureHeight() const;
 
   CRect CalcRenderRegion() const override;
+  bool IsOpaque() const override { return m_textureCurrent->IsOpaque(); }
 
 #ifdef _DEBUG
   void DumpTextureUse() override;
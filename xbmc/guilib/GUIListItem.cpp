@@ -84,31 +84,51 @@ const std::wstring& CGUIListItem::GetSortLabel() const
   return m_sortLabel;
 }
 
+KODI::ART::Artwork& CGUIListItem::GetMutableArt(std::shared_ptr<KODI::ART::Artwork>& art)
+{
+  if (!art)
+    art = std::make_shared<KODI::ART::Artwork>();
+  else if (art.use_count() > 1)
+    art = std::make_shared<KODI::ART::Artwork>(*art);
+  return *art;
+}
+
 void CGUIListItem::SetArt(const std::string& type, std::string_view url)
 {
-  const auto i = m_art.find(type);
-  if (i == m_art.end() || i->second != url)
+  if (m_art)
   {
-    m_art[type] = url;
-    SetInvalid();
+    const auto i = m_art->find(type);
+    if (i != m_art->end() && i->second == url)
+      return;
   }
+  GetMutableArt(m_art)[type] = url;
+  SetInvalid();
 }
 
 void CGUIListItem::SetArt(const KODI::ART::Artwork& art)
 {
-  m_art = art;
+  if (art.empty())
+    m_art.reset();
+  else
+    m_art = std::make_shared<KODI::ART::Artwork>(art);
   SetInvalid();
 }
 
 void CGUIListItem::SetArtFallback(const std::string& from, std::string_view to)
 {
-  m_artFallbacks[from] = to;
+  if (m_artFallbacks)
+  {
+    const auto i = m_artFallbacks->find(from);
+    if (i != m_artFallbacks->end() && i->second == to)
+      return;
+  }
+  GetMutableArt(m_artFallbacks)[from] = to;
 }
 
 void CGUIListItem::ClearArt()
 {
-  m_art.clear();
-  m_artFallbacks.clear();
+  m_art.reset();
+  m_artFallbacks.reset();
   SetProperty("libraryartfilled", false);
 }
 
@@ -120,23 +140,30 @@ void CGUIListItem::AppendArt(const KODI::ART::Artwork& art, const std::string& p
 
 std::string CGUIListItem::GetArt(const std::string &type) const
 {
-  auto i = m_art.find(type);
-  if (i != m_art.end())
+  if (!m_art)
+    return "";
+
+  auto i = m_art->find(type);
+  if (i != m_art->end())
     return i->second;
 
-  i = m_artFallbacks.find(type);
-  if (i != m_artFallbacks.end())
+  if (m_artFallbacks)
   {
-    const auto j = m_art.find(i->second);
-    if (j != m_art.end())
-      return j->second;
+    i = m_artFallbacks->find(type);
+    if (i != m_artFallbacks->end())
+    {
+      const auto j = m_art->find(i->second);
+      if (j != m_art->end())
+        return j->second;
+    }
   }
   return "";
 }
 
 const KODI::ART::Artwork& CGUIListItem::GetArt() const
 {
-  return m_art;
+  static const KODI::ART::Artwork noArt;
+  return m_art ? *m_art : noArt;
 }
 
 bool CGUIListItem::HasArt(const std::string &type) const
@@ -225,14 +252,17 @@ void CGUIListItem::Archive(CArchive &ar)
       ar << name;
       ar << value;
     }
-    ar << static_cast<int>(m_art.size());
-    for (const auto& [type, url] : m_art)
+    const KODI::ART::Artwork& art = GetArt();
+    ar << static_cast<int>(art.size());
+    for (const auto& [type, url] : art)
     {
       ar << type;
       ar << url;
     }
-    ar << static_cast<int>(m_artFallbacks.size());
-    for (const auto& [type, url] : m_artFallbacks)
+    static const KODI::ART::Artwork noFallbacks;
+    const KODI::ART::Artwork& artFallbacks = m_artFallbacks ? *m_artFallbacks : noFallbacks;
+    ar << static_cast<int>(artFallbacks.size());
+    for (const auto& [type, url] : artFallbacks)
     {
       ar << type;
       ar << url;
@@ -268,7 +298,7 @@ void CGUIListItem::Archive(CArchive &ar)
       std::string value;
       ar >> key;
       ar >> value;
-      m_art.try_emplace(key, value);
+      GetMutableArt(m_art).try_emplace(key, value);
     }
     ar >> mapSize;
     for (int i = 0; i < mapSize; i++)
@@ -277,7 +307,7 @@ void CGUIListItem::Archive(CArchive &ar)
       std::string value;
       ar >> key;
       ar >> value;
-      m_artFallbacks.try_emplace(key, value);
+      GetMutableArt(m_artFallbacks).try_emplace(key, value);
     }
     ar >> m_currentItem;
     SetInvalid();
@@ -294,7 +324,7 @@ void CGUIListItem::Serialize(CVariant& value) const
   for (const auto& [propname, propvalue] : m_mapProperties)
     value["properties"][propname] = propvalue;
 
-  for (const auto& [type, url] : m_art)
+  for (const auto& [type, url] : GetArt())
     value["art"][type] = url;
 
   value["current"] = m_currentItem;
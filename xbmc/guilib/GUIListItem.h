@@ -14,9 +14,9 @@
 */
 
 #include "utils/Artwork.h"
+#include "utils/FlatMap.h"
 
 #include <cstdint>
-#include <map>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -169,7 +169,8 @@ public:
     bool operator()(const std::string_view& s1, const std::string_view& s2) const;
   };
 
-  using PropertyMap = std::map<std::string, CVariant, CaseInsensitiveCompare>;
+  //! most items have a handful of properties, they are kept in a single allocation
+  using PropertyMap = KODI::UTILS::CFlatMap<std::string, CVariant, CaseInsensitiveCompare>;
   const PropertyMap& GetProperties() const { return m_mapProperties; }
 
   void SetProperties(const PropertyMap& props);
@@ -201,6 +202,11 @@ private:
 
   PropertyMap m_mapProperties;
 
-  KODI::ART::Artwork m_art;
-  KODI::ART::Artwork m_artFallbacks;
+  /*! \brief Get the art map of the item to change it.
+   Copies of an item share their art maps until one of them changes its art.
+   */
+  static KODI::ART::Artwork& GetMutableArt(std::shared_ptr<KODI::ART::Artwork>& art);
+
+  std::shared_ptr<KODI::ART::Artwork> m_art; ///< nullptr when the item has no art
+  std::shared_ptr<KODI::ART::Artwork> m_artFallbacks;
 };
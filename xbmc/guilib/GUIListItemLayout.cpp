@@ -9,15 +9,25 @@
 #include "GUIListItemLayout.h"
 
 #include "FileItem.h"
+#include "GUIComponent.h"
 #include "GUIControlFactory.h"
 #include "GUIImage.h"
 #include "GUIInfoManager.h"
 #include "GUIListLabel.h"
+#include "GUIWindowManager.h"
 #include "ServiceBroker.h"
 #include "utils/XBMCTinyXML.h"
 
 using namespace KODI::GUILIB;
 
+namespace
+{
+// the item layouts of a container are created together, spread their periodic info updates over
+// this many phases of the update interval so they don't all refresh in the same frame
+constexpr unsigned int INFO_UPDATE_PHASES = 8;
+unsigned int infoUpdatePhase = 0;
+} // namespace
+
 CGUIListItemLayout::CGUIListItemLayout()
 : m_group(0, 0, 0, 0, 0, 0)
 {
@@ -39,7 +49,10 @@ CGUIListItemLayout::CGUIListItemLayout(const CGUIListItemLayout& from, CGUIContr
     m_infoUpdateMillis(from.m_infoUpdateMillis)
 {
   m_group.SetParentControl(control);
-  m_infoUpdateTimeout.Set(m_infoUpdateMillis);
+  if (m_infoUpdateMillis != XbmcThreads::EndTime<decltype(m_infoUpdateMillis)>::Max())
+    m_infoUpdateOffset = m_infoUpdateMillis * (infoUpdatePhase++ % INFO_UPDATE_PHASES) /
+                         INFO_UPDATE_PHASES;
+  m_infoUpdateTimeout.Set(m_infoUpdateMillis + m_infoUpdateOffset);
 
   // m_group was just created, cloned controls with resources must be allocated
   // before use
@@ -76,9 +89,10 @@ void CGUIListItemLayout::Process(CGUIListItem *item, int parentID, unsigned int
     if (!item->IsFileItem())
       delete fileItem;
 
-    m_infoUpdateTimeout.Set(m_infoUpdateMillis);
+    m_infoUpdateTimeout.Set(m_infoUpdateMillis + m_infoUpdateOffset);
   }
-  else if (m_infoUpdateTimeout.IsTimePast())
+  else if (m_infoUpdateTimeout.IsTimePast() &&
+           CServiceBroker::GetGUI()->GetWindowManager().GetFrameBudget().HasTime())
   {
     m_isPlaying.Update(INFO::DEFAULT_CONTEXT, item);
     m_group.UpdateInfo(item);
@@ -65,6 +65,7 @@ protected:
   KODI::GUILIB::GUIINFO::CGUIInfoBool m_isPlaying;
   std::chrono::milliseconds m_infoUpdateMillis =
       XbmcThreads::EndTime<decltype(m_infoUpdateMillis)>::Max();
+  std::chrono::milliseconds m_infoUpdateOffset{0}; // phase of the periodic info update
   XbmcThreads::EndTime<> m_infoUpdateTimeout;
 };
 
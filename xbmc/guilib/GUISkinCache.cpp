@@ -0,0 +1,297 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUISkinCache.h"
+
+#include "GUIComponent.h"
+#include "GUIInfoManager.h"
+#include "ServiceBroker.h"
+#include "addons/AddonVersion.h"
+#include "addons/Skin.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "utils/Crc32.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/XBMCTinyXML.h"
+#include "utils/log.h"
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+constexpr uint32_t SKIN_CACHE_MAGIC = 0x434b534b; // "KSKC"
+constexpr uint32_t SKIN_CACHE_VERSION = 1;
+
+enum class NodeType : uint8_t
+{
+  ELEMENT = 0,
+  TEXT = 1,
+  CDATA = 2,
+};
+
+/*!
+ \brief Identifies the sources of a cached window, so the cache is dropped whenever the skin, the
+ window file or one of the include files changed
+ */
+std::string GetSourceKey(const std::string& xmlFile)
+{
+  auto skin = CServiceBroker::GetGUI()->GetSkinInfo();
+  if (!skin)
+    return {};
+
+  std::string key = StringUtils::Format("{}|{}", skin->ID(), skin->Version().asString());
+  auto addFile = [&key](const std::string& file)
+  {
+    struct __stat64 buffer;
+    if (XFILE::CFile::Stat(file, &buffer) != 0)
+      return false;
+    key += StringUtils::Format("|{}|{}|{}", file, static_cast<int64_t>(buffer.st_mtime),
+                               static_cast<int64_t>(buffer.st_size));
+    return true;
+  };
+
+  if (!addFile(xmlFile))
+    return {};
+  for (const auto& file : skin->GetIncludeFiles())
+  {
+    if (!addFile(file))
+      return {};
+  }
+  return key;
+}
+
+std::string GetCacheFile(const std::string& xmlFile)
+{
+  auto skin = CServiceBroker::GetGUI()->GetSkinInfo();
+  if (!skin)
+    return {};
+
+  return StringUtils::Format("special://temp/skincache/{}/{:08x}.bin", skin->ID(),
+                             Crc32::Compute(xmlFile));
+}
+
+class CWriter
+{
+public:
+  void WriteU32(uint32_t value) { m_data.append(reinterpret_cast<const char*>(&value), 4); }
+  void WriteU8(uint8_t value) { m_data.push_back(static_cast<char>(value)); }
+  void WriteString(const std::string& value)
+  {
+    WriteU32(static_cast<uint32_t>(value.size()));
+    m_data.append(value);
+  }
+
+  void WriteElement(const TiXmlElement* element)
+  {
+    WriteString(element->ValueStr());
+
+    uint32_t attributes = 0;
+    for (const TiXmlAttribute* attribute = element->FirstAttribute(); attribute;
+         attribute = attribute->Next())
+      attributes++;
+    WriteU32(attributes);
+    for (const TiXmlAttribute* attribute = element->FirstAttribute(); attribute;
+         attribute = attribute->Next())
+    {
+      WriteString(attribute->Name());
+      WriteString(attribute->ValueStr());
+    }
+
+    // comments and the like are dropped, they have no meaning for the controls
+    uint32_t children = 0;
+    for (const TiXmlNode* child = element->FirstChild(); child; child = child->NextSibling())
+    {
+      if (child->Type() == TiXmlNode::TINYXML_ELEMENT || child->Type() == TiXmlNode::TINYXML_TEXT)
+        children++;
+    }
+    WriteU32(children);
+    for (const TiXmlNode* child = element->FirstChild(); child; child = child->NextSibling())
+    {
+      if (child->Type() == TiXmlNode::TINYXML_ELEMENT)
+      {
+        WriteU8(static_cast<uint8_t>(NodeType::ELEMENT));
+        WriteElement(child->ToElement());
+      }
+      else if (child->Type() == TiXmlNode::TINYXML_TEXT)
+      {
+        WriteU8(static_cast<uint8_t>(child->ToText()->CDATA() ? NodeType::CDATA : NodeType::TEXT));
+        WriteString(child->ValueStr());
+      }
+    }
+  }
+
+  const std::string& GetData() const { return m_data; }
+
+private:
+  std::string m_data;
+};
+
+class CReader
+{
+public:
+  explicit CReader(const std::vector<uint8_t>& data) : m_data(data) {}
+
+  bool ReadU32(uint32_t& value)
+  {
+    if (m_data.size() - m_position < 4)
+      return false;
+    std::memcpy(&value, m_data.data() + m_position, 4);
+    m_position += 4;
+    return true;
+  }
+
+  bool ReadU8(uint8_t& value)
+  {
+    if (m_position >= m_data.size())
+      return false;
+    value = m_data[m_position++];
+    return true;
+  }
+
+  bool ReadString(std::string& value)
+  {
+    uint32_t size;
+    if (!ReadU32(size) || m_data.size() - m_position < size)
+      return false;
+    value.assign(reinterpret_cast<const char*>(m_data.data() + m_position), size);
+    m_position += size;
+    return true;
+  }
+
+  bool ReadElement(TiXmlElement& element)
+  {
+    uint32_t attributes;
+    if (!ReadU32(attributes))
+      return false;
+    for (uint32_t i = 0; i < attributes; ++i)
+    {
+      std::string name;
+      std::string value;
+      if (!ReadString(name) || !ReadString(value))
+        return false;
+      element.SetAttribute(name, value);
+    }
+
+    uint32_t children;
+    if (!ReadU32(children))
+      return false;
+    for (uint32_t i = 0; i < children; ++i)
+    {
+      uint8_t type;
+      std::string value;
+      if (!ReadU8(type) || !ReadString(value))
+        return false;
+
+      // link the nodes before filling them, so the tree isn't copied level by level
+      if (type == static_cast<uint8_t>(NodeType::ELEMENT))
+      {
+        auto* child = new TiXmlElement(value);
+        element.LinkEndChild(child);
+        if (!ReadElement(*child))
+          return false;
+      }
+      else
+      {
+        auto* text = new TiXmlText(value);
+        text->SetCDATA(type == static_cast<uint8_t>(NodeType::CDATA));
+        element.LinkEndChild(text);
+      }
+    }
+    return true;
+  }
+
+private:
+  const std::vector<uint8_t>& m_data;
+  size_t m_position{0};
+};
+} // namespace
+
+std::unique_ptr<TiXmlElement> CGUISkinCache::Load(const std::string& xmlFile,
+                                                  std::map<INFO::InfoPtr, bool>& includeConditions)
+{
+  const std::string cacheFile = GetCacheFile(xmlFile);
+  if (cacheFile.empty())
+    return nullptr;
+
+  XFILE::CFile file;
+  std::vector<uint8_t> data;
+  if (file.LoadFile(cacheFile, data) <= 0)
+    return nullptr;
+
+  CReader reader(data);
+  uint32_t magic;
+  uint32_t version;
+  std::string key;
+  if (!reader.ReadU32(magic) || magic != SKIN_CACHE_MAGIC || !reader.ReadU32(version) ||
+      version != SKIN_CACHE_VERSION || !reader.ReadString(key) || key != GetSourceKey(xmlFile))
+    return nullptr;
+
+  // the window was resolved with these include conditions, it is only valid if they still match
+  CGUIInfoManager& infoMgr = CServiceBroker::GetGUI()->GetInfoManager();
+  std::map<INFO::InfoPtr, bool> conditions;
+  uint32_t count;
+  if (!reader.ReadU32(count))
+    return nullptr;
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    std::string expression;
+    uint8_t value;
+    if (!reader.ReadString(expression) || !reader.ReadU8(value))
+      return nullptr;
+
+    INFO::InfoPtr condition = infoMgr.Register(expression);
+    if (!condition || condition->Get(INFO::DEFAULT_CONTEXT) != (value != 0))
+      return nullptr;
+    conditions.try_emplace(condition, value != 0);
+  }
+
+  std::string name;
+  if (!reader.ReadString(name))
+    return nullptr;
+  auto root = std::make_unique<TiXmlElement>(name);
+  if (!reader.ReadElement(*root))
+  {
+    CLog::LogF(LOGWARNING, "Skin cache file {} is corrupt", cacheFile);
+    return nullptr;
+  }
+
+  includeConditions.insert(conditions.begin(), conditions.end());
+  return root;
+}
+
+void CGUISkinCache::Save(const std::string& xmlFile,
+                         const TiXmlElement* root,
+                         const std::map<INFO::InfoPtr, bool>& includeConditions)
+{
+  const std::string cacheFile = GetCacheFile(xmlFile);
+  const std::string key = GetSourceKey(xmlFile);
+  if (!root || cacheFile.empty() || key.empty())
+    return;
+
+  CWriter writer;
+  writer.WriteU32(SKIN_CACHE_MAGIC);
+  writer.WriteU32(SKIN_CACHE_VERSION);
+  writer.WriteString(key);
+  writer.WriteU32(static_cast<uint32_t>(includeConditions.size()));
+  for (const auto& [condition, value] : includeConditions)
+  {
+    writer.WriteString(condition->GetExpression());
+    writer.WriteU8(value ? 1 : 0);
+  }
+  writer.WriteString(root->ValueStr());
+  writer.WriteElement(root);
+
+  XFILE::CDirectory::Create(URIUtils::GetDirectory(cacheFile));
+  XFILE::CFile file;
+  const std::string& data = writer.GetData();
+  if (!file.OpenForWrite(cacheFile, true) ||
+      file.Write(data.data(), data.size()) != static_cast<ssize_t>(data.size()))
+    CLog::LogF(LOGDEBUG, "Unable to write the skin cache file {}", cacheFile);
+}
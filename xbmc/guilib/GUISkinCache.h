@@ -0,0 +1,47 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "interfaces/info/InfoBool.h"
+
+#include <map>
+#include <memory>
+#include <string>
+
+class TiXmlElement;
+
+/*!
+ \ingroup winman
+ \brief Cache of the include resolved window XML of the current skin
+
+ The windows are stored in a compact binary form under special://temp/skincache, together with
+ the values of the include conditions used to resolve them. A cached window is only used if the
+ skin version, the window and include files and all these conditions are still the same, so
+ loading it skips both the XML parsing and the include expansion.
+ */
+class CGUISkinCache
+{
+public:
+  /*! \brief Load a window from the cache
+   \param xmlFile path of the window XML file
+   \param includeConditions [out] the include conditions of the cached window
+   \return the include resolved root element, or nullptr if there is no valid cache entry
+   */
+  static std::unique_ptr<TiXmlElement> Load(const std::string& xmlFile,
+                                            std::map<INFO::InfoPtr, bool>& includeConditions);
+
+  /*! \brief Store an include resolved window in the cache
+   \param xmlFile path of the window XML file
+   \param root the include resolved root element
+   \param includeConditions the include conditions used to resolve the window
+   */
+  static void Save(const std::string& xmlFile,
+                   const TiXmlElement* root,
+                   const std::map<INFO::InfoPtr, bool>& includeConditions);
+};
@@ -311,6 +311,9 @@ void CGUITexture::Render(float left,
 
   int orientation = GetOrientation();
   OrientateTexture(texture, u3, v3, orientation);
+  if (m_texture.m_inAtlas)
+    texture += CPoint(m_texture.m_texOffsetX * m_texCoordsScaleU,
+                      m_texture.m_texOffsetY * m_texCoordsScaleV);
 
   if (m_diffuse.size())
   {
@@ -320,6 +323,9 @@ void CGUITexture::Render(float left,
     diffuse.y1 *= m_diffuseScaleV / v3; diffuse.y2 *= m_diffuseScaleV / v3;
     diffuse += m_diffuseOffset;
     OrientateTexture(diffuse, m_diffuseU, m_diffuseV, m_info.orientation);
+    if (m_diffuse.m_inAtlas)
+      diffuse += CPoint(static_cast<float>(m_diffuse.m_texOffsetX) / m_diffuse.m_texWidth,
+                        static_cast<float>(m_diffuse.m_texOffsetY) / m_diffuse.m_texHeight);
   }
 
   float x[4], y[4], z[4];
@@ -648,6 +654,21 @@ bool CGUITexture::ReadyToRender() const
   return m_texture.size() > 0;
 }
 
+bool CGUITexture::IsOpaque() const
+{
+  if (!m_visible || !m_info.m_infill || m_currentFrame >= m_texture.size())
+    return false;
+
+  const KODI::UTILS::COLOR::Color color =
+      (m_info.diffuseColor) ? (KODI::UTILS::COLOR::Color)m_info.diffuseColor : m_diffuseColor;
+  if (m_alpha != 0xFF || ((color >> 24) & 0xFF) != 0xFF)
+    return false;
+
+  if (m_texture.m_textures[m_currentFrame]->HasAlpha())
+    return false;
+  return !m_diffuse.size() || !m_diffuse.m_textures[0]->HasAlpha();
+}
+
 void CGUITexture::OrientateTexture(CRect& rect, float width, float height, int orientation)
 {
   switch (orientation & 3)
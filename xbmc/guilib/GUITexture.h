@@ -129,6 +129,12 @@ public:
   }
   bool ReadyToRender() const;
 
+  /*!
+   * @brief Check if the texture covers its render rect fully opaque, i.e. it is filled and neither
+   * the colors nor the textures have any transparency.
+   */
+  bool IsOpaque() const;
+
 protected:
   CGUITexture(float posX, float posY, float width, float height, const CTextureInfo& texture);
   CGUITexture(const CGUITexture& left);
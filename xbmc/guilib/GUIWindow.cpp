@@ -14,6 +14,7 @@
 #include "GUIControlGroup.h"
 #include "GUIControlProfiler.h"
 #include "GUIInfoManager.h"
+#include "GUISkinCache.h"
 #include "GUIWindowManager.h"
 #include "ServiceBroker.h"
 #include "addons/Skin.h"
@@ -126,6 +127,14 @@ bool CGUIWindow::Load(const std::string& strFileName, bool bContainsPath)
 
 bool CGUIWindow::LoadXML(const std::string &strPath, const std::string &strLowerPath)
 {
+  // windows already resolved with the current include conditions are loaded from the skin cache
+  std::unique_ptr<TiXmlElement> cachedRoot = CGUISkinCache::Load(strPath, m_xmlIncludeConditions);
+  if (cachedRoot)
+  {
+    CLog::Log(LOGDEBUG, "Using cached xml for {}", strPath);
+    return Load(cachedRoot.get());
+  }
+
   // load window xml if we don't have it stored yet
   if (!m_windowXMLRootElement)
   {
@@ -154,7 +163,9 @@ bool CGUIWindow::LoadXML(const std::string &strPath, const std::string &strLower
   else
     CLog::Log(LOGDEBUG, "Using already stored xml root node for {}", strPath);
 
-  return Load(Prepare(m_windowXMLRootElement).get());
+  std::unique_ptr<TiXmlElement> preparedRoot = Prepare(m_windowXMLRootElement);
+  CGUISkinCache::Save(strPath, preparedRoot.get(), m_xmlIncludeConditions);
+  return Load(preparedRoot.get());
 }
 
 std::unique_ptr<TiXmlElement> CGUIWindow::Prepare(const std::unique_ptr<TiXmlElement>& rootElement)
@@ -752,23 +763,16 @@ void CGUIWindow::AllocResources(bool forceLoad /*= false */)
 #ifdef _DEBUG
   const auto start = std::chrono::steady_clock::now();
 #endif
-  // use forceLoad to determine if window needs (re)loading
-  forceLoad |= NeedLoad() || (m_loadType == LOAD_EVERY_TIME);
+  // use forceLoad to determine if window needs (re)loading, a preloaded window is still fresh
+  forceLoad |= NeedLoad() || (m_loadType == LOAD_EVERY_TIME && !m_preloaded);
+  m_preloaded = false;
 
   // if window is loaded and load is forced we have to free window resources first
   if (m_windowLoaded && forceLoad)
     FreeResources(true);
 
   if (forceLoad)
-  {
-    std::string xmlFile = GetProperty("xmlfile").asString();
-    if (!xmlFile.empty())
-    {
-      bool bHasPath =
-          xmlFile.find('\\') != std::string::npos || xmlFile.find('/') != std::string::npos;
-      Load(xmlFile, bHasPath);
-    }
-  }
+    LoadXMLFile();
 
 #ifdef _DEBUG
   const auto skinLoadEnd = std::chrono::steady_clock::now();
@@ -794,6 +798,32 @@ void CGUIWindow::AllocResources(bool forceLoad /*= false */)
   m_bAllocated = true;
 }
 
+bool CGUIWindow::Preload()
+{
+  if (m_active || m_windowLoaded)
+    return false;
+
+  m_preloaded = LoadXMLFile();
+  return m_preloaded;
+}
+
+void CGUIWindow::DropPreload()
+{
+  if (m_preloaded && !m_active && m_loadType == LOAD_EVERY_TIME)
+    ClearAll();
+  m_preloaded = false;
+}
+
+bool CGUIWindow::LoadXMLFile()
+{
+  std::string xmlFile = GetProperty("xmlfile").asString();
+  if (xmlFile.empty())
+    return false;
+
+  bool bHasPath = xmlFile.find('\\') != std::string::npos || xmlFile.find('/') != std::string::npos;
+  return Load(xmlFile, bHasPath);
+}
+
 void CGUIWindow::FreeResources(bool forceUnload /*= false */)
 {
   m_bAllocated = false;
@@ -819,6 +849,7 @@ void CGUIWindow::ClearAll()
   OnWindowUnload();
   CGUIControlGroup::ClearAll();
   m_windowLoaded = false;
+  m_preloaded = false;
   m_dynamicResourceAlloc = true;
   m_visibleCondition.reset();
 }
@@ -118,6 +118,13 @@ public:
   void ClearAll() override;
   using CGUIControlGroup::AllocResources;
   virtual void AllocResources(bool forceLoad = false);
+  /*! \brief Load the window ahead of its activation, so opening it doesn't have to load it
+   \return true if the window was loaded
+   */
+  bool Preload();
+  /*! \brief Unload a preloaded window that wasn't opened in the end
+   */
+  void DropPreload();
   void FreeResources(bool forceUnLoad = false) override;
   void DynamicResourceAlloc(bool bOnOff) override;
   virtual bool IsDialog() const { return false; }
@@ -205,6 +212,11 @@ protected:
    */
   virtual bool LoadXML(const std::string& strPath, const std::string &strLowerPath);
 
+  /*!
+   \brief Loads the window from the file in its xmlfile property
+   */
+  bool LoadXMLFile();
+
   /*!
    \brief Loads the window from the given XML element
    \param pRootElement the XML element
@@ -247,6 +259,7 @@ protected:
   RESOLUTION_INFO m_coordsRes; // resolution that the window coordinates are in.
   bool m_needsScaling;
   bool m_windowLoaded;  // true if the window's xml file has been loaded
+  bool m_preloaded = false; // loaded by Preload() and not activated since
   LOAD_TYPE m_loadType;
   bool m_dynamicResourceAlloc;
   bool m_closing;
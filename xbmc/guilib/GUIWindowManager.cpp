@@ -67,6 +67,7 @@
 #include "windows/GUIWindowStartup.h"
 #include "windows/GUIWindowSystemInfo.h"
 
+#include <iterator>
 #include <mutex>
 
 // Dialog includes
@@ -166,6 +167,9 @@ using namespace PERIPHERALS;
 
 namespace
 {
+// how long the preload hint has to settle, so scrolling through a menu doesn't load every window
+constexpr auto PRELOAD_DELAY = std::chrono::milliseconds(500);
+
 bool PreValidateMessage(CGUIMessage& message, CGUIWindow& window)
 {
   // Click message: check that the underlying control hasn't been disabled by core code.
@@ -1260,6 +1264,37 @@ bool RenderOrderSortFunction(const std::shared_ptr<CGUIWindow>& first,
   return first->GetRenderOrder() < second->GetRenderOrder();
 }
 
+/*!
+ \brief Get the dialogs in render order, without those hidden beneath an opaque dialog that covers
+ the current render region
+ \param dialogs the active dialogs
+ \param windowOccluded [out] true if the active window is hidden beneath a dialog
+ \return the dialogs to render
+ */
+std::vector<std::shared_ptr<CGUIWindow>> GetDialogRenderList(
+    const std::vector<std::shared_ptr<CGUIWindow>>& dialogs, bool& windowOccluded)
+{
+  auto renderList = dialogs;
+  stable_sort(renderList.begin(), renderList.end(), RenderOrderSortFunction);
+
+  windowOccluded = false;
+  if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiAlgorithmDirtyRegions !=
+      DIRTYREGION_SOLVER_OCCLUSION)
+    return renderList;
+
+  const CRect& region = CServiceBroker::GetWinSystem()->GetGfxContext().GetScissors();
+  for (auto it = renderList.rbegin(); it != renderList.rend(); ++it)
+  {
+    if ((*it)->IsDialogRunning() && (*it)->OccludesRegion(region))
+    {
+      windowOccluded = true;
+      renderList.erase(renderList.begin(), std::prev(it.base()));
+      break;
+    }
+  }
+  return renderList;
+}
+
 void CGUIWindowManager::Process(unsigned int currentTime)
 {
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
@@ -1299,6 +1334,40 @@ void CGUIWindowManager::Process(unsigned int currentTime)
 
   for (auto& itr : m_dirtyregions)
     m_tracker.MarkDirtyRegion(itr);
+
+  ProcessPreload();
+}
+
+void CGUIWindowManager::PreloadWindow(int id)
+{
+  std::unique_lock lock(CServiceBroker::GetWinSystem()->GetGfxContext());
+  if (id == m_preloadWindow || id == m_preloadedWindow)
+    return;
+
+  m_preloadWindow = id;
+  m_preloadTime = std::chrono::steady_clock::now() + PRELOAD_DELAY;
+}
+
+void CGUIWindowManager::ProcessPreload()
+{
+  if (m_preloadWindow == WINDOW_INVALID || std::chrono::steady_clock::now() < m_preloadTime)
+    return;
+
+  const int id = m_preloadWindow;
+  m_preloadWindow = WINDOW_INVALID;
+
+  // keep a single preloaded window around
+  CGUIWindow* previous = GetWindow(m_preloadedWindow);
+  if (previous)
+    previous->DropPreload();
+  m_preloadedWindow = WINDOW_INVALID;
+
+  CGUIWindow* window = GetWindow(id);
+  if (window && !window->IsActive() && window->Preload())
+  {
+    CLog::LogF(LOGDEBUG, "preloaded window {}", id);
+    m_preloadedWindow = id;
+  }
 }
 
 void CGUIWindowManager::MarkDirty()
@@ -1331,17 +1400,18 @@ void CGUIWindowManager::RenderPass() const
 
 void CGUIWindowManager::RenderPassSingle() const
 {
+  // we render the dialogs based on their render order.
+  bool windowOccluded;
+  const auto renderList = GetDialogRenderList(m_activeDialogs, windowOccluded);
+
   CGUIWindow* pWindow = GetWindow(GetActiveWindow());
   if (pWindow)
   {
     pWindow->ClearBackground();
-    pWindow->DoRender();
+    if (!windowOccluded)
+      pWindow->DoRender();
   }
 
-  // we render the dialogs based on their render order.
-  auto renderList = m_activeDialogs;
-  stable_sort(renderList.begin(), renderList.end(), RenderOrderSortFunction);
-
   for (const auto& window : renderList)
   {
     if (window->IsDialogRunning())
@@ -1355,8 +1425,10 @@ void CGUIWindowManager::RenderPassDual() const
   if (pWindow)
     pWindow->ClearBackground();
 
-  auto renderList = m_activeDialogs;
-  stable_sort(renderList.begin(), renderList.end(), RenderOrderSortFunction);
+  bool windowOccluded;
+  const auto renderList = GetDialogRenderList(m_activeDialogs, windowOccluded);
+  if (windowOccluded)
+    pWindow = nullptr;
 
   // first the opaque pass, rendering from front to back
   CServiceBroker::GetWinSystem()->GetGfxContext().SetRenderOrder(RENDER_ORDER_FRONT_TO_BACK);
@@ -1588,6 +1660,8 @@ void CGUIWindowManager::DeInitialize()
     pWindow->FreeResources(true);
   }
   UnloadNotOnDemandWindows();
+  m_preloadWindow = WINDOW_INVALID;
+  m_preloadedWindow = WINDOW_INVALID;
 
   m_vecMsgTargets.erase( m_vecMsgTargets.begin(), m_vecMsgTargets.end() );
 
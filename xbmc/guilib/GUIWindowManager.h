@@ -9,12 +9,14 @@
 #pragma once
 
 #include "DirtyRegionTracker.h"
+#include "GUIFrameBudget.h"
 #include "GUIWindow.h"
 #include "IMsgTargetCallback.h"
 #include "IWindowManagerCallback.h"
 #include "guilib/WindowIDs.h"
 #include "messaging/IMessageTarget.h"
 
+#include <chrono>
 #include <list>
 #include <memory>
 #include <unordered_map>
@@ -106,6 +108,11 @@ public:
    */
   bool HasDirtyRegions() const { return !m_dirtyregions.empty(); }
 
+  /*! \brief Get the processing time budget of the current frame
+   \sa CGUIFrameBudget
+   */
+  CGUIFrameBudget& GetFrameBudget() { return m_frameBudget; }
+
   /*! \brief Rendering of the current window and any dialogs
    Render is called every frame to draw the current window and any dialogs.
    It should only be called from the application thread.
@@ -235,6 +242,13 @@ public:
 
   bool HasVisibleControls();
 
+  /*! \brief Load a window which is likely to be opened next, e.g. the target of the focused home
+   menu entry. Only the latest hint is kept, and it is only loaded once it settled for a moment
+   so scrolling through a menu doesn't load every window on the way.
+   \param id the window id
+   */
+  void PreloadWindow(int id);
+
 #ifdef _DEBUG
   void DumpTextureUse();
 #endif
@@ -278,6 +292,8 @@ private:
 
   bool HandleAction(const CAction &action) const;
 
+  void ProcessPreload();
+
   std::unordered_map<int, std::shared_ptr<CGUIWindow>> m_mapWindows;
   std::vector<std::shared_ptr<CGUIWindow>> m_vecCustomWindows;
   std::vector<std::shared_ptr<CGUIWindow>> m_activeDialogs;
@@ -297,4 +313,9 @@ private:
 
   CDirtyRegionList m_dirtyregions;
   CDirtyRegionTracker m_tracker;
+  CGUIFrameBudget m_frameBudget;
+
+  int m_preloadWindow{WINDOW_INVALID}; // next window to preload
+  int m_preloadedWindow{WINDOW_INVALID}; // window preloaded and not opened yet
+  std::chrono::steady_clock::time_point m_preloadTime;
 };
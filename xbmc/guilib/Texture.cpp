@@ -156,6 +156,8 @@ bool CTexture::LoadFromFileInternal(const std::string& texturePath,
     if (image.ReadFile(texturePath))
     {
       Update(image.GetWidth(), image.GetHeight(), 0, image.GetFormat(), image.GetData(), false);
+      if (image.GetFormat() == XB_FMT_A8R8G8B8)
+        SetAlpha(image.HasAlpha());
       return true;
     }
     return false;
@@ -255,6 +257,11 @@ bool CTexture::LoadIImage(IImage* pImage,
   if (pImage->Width() == 0 || pImage->Height() == 0)
     return false;
 
+  // the pixels are kept as they're stored and rotated when rendered, so a picture that is
+  // turned by 90 degrees (EXIF orientation 5 to 8) is fitted into the turned ideal size
+  if (pImage->Orientation() >= 5 && pImage->Orientation() <= 8)
+    std::swap(idealWidth, idealHeight);
+
   unsigned int width = idealWidth ? idealWidth : pImage->Width();
   unsigned int height = idealHeight ? idealHeight : pImage->Height();
 
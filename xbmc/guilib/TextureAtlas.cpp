@@ -0,0 +1,111 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "TextureAtlas.h"
+
+#include "ServiceBroker.h"
+#include "Texture.h"
+#include "rendering/RenderSystem.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+constexpr unsigned int PAGE_SIZE = 1024;
+constexpr unsigned int BORDER = 1;
+constexpr unsigned int BYTES_PER_PIXEL = 4;
+} // namespace
+
+std::optional<CTextureAtlas::Region> CTextureAtlas::Add(unsigned int width,
+                                                        unsigned int height,
+                                                        unsigned int pitch,
+                                                        const uint8_t* pixels,
+                                                        bool hasAlpha)
+{
+  if (width == 0 || height == 0 || width > MAX_IMAGE_SIZE || height > MAX_IMAGE_SIZE)
+    return {};
+
+  const unsigned int cellWidth = width + 2 * BORDER;
+  const unsigned int cellHeight = height + 2 * BORDER;
+
+  // pages can't be changed anymore once they've been uploaded
+  if (!m_page || !m_page->GetPixels())
+  {
+    if (!NewPage())
+      return {};
+  }
+
+  // fill the page shelf by shelf, a shelf is as high as its highest image
+  if (m_cursorX + cellWidth > m_pageSize)
+  {
+    m_shelfY += m_shelfHeight;
+    m_cursorX = 0;
+    m_shelfHeight = 0;
+  }
+  if (m_shelfY + cellHeight > m_pageSize)
+  {
+    if (!NewPage())
+      return {};
+  }
+
+  const unsigned int cellX = m_cursorX;
+  const unsigned int cellY = m_shelfY;
+  m_cursorX += cellWidth;
+  m_shelfHeight = std::max(m_shelfHeight, cellHeight);
+
+  uint8_t* destination = m_page->GetPixels();
+  const unsigned int destinationPitch = m_page->GetPitch();
+  const size_t rowSize = static_cast<size_t>(width) * BYTES_PER_PIXEL;
+  for (unsigned int row = 0; row < cellHeight; ++row)
+  {
+    // the border repeats the outermost pixels of the image
+    const unsigned int sourceRow = std::clamp(row, BORDER, height) - BORDER;
+    const uint8_t* source = pixels + static_cast<size_t>(sourceRow) * pitch;
+    uint8_t* target = destination + static_cast<size_t>(cellY + row) * destinationPitch +
+                      static_cast<size_t>(cellX) * BYTES_PER_PIXEL;
+
+    std::memcpy(target, source, BYTES_PER_PIXEL);
+    std::memcpy(target + BYTES_PER_PIXEL, source, rowSize);
+    std::memcpy(target + BYTES_PER_PIXEL + rowSize, source + rowSize - BYTES_PER_PIXEL,
+                BYTES_PER_PIXEL);
+  }
+
+  if (hasAlpha)
+    m_page->SetAlpha(true);
+
+  return Region{m_page, cellX + BORDER, cellY + BORDER};
+}
+
+void CTextureAtlas::Reset()
+{
+  m_page.reset();
+}
+
+bool CTextureAtlas::NewPage()
+{
+  m_page.reset();
+
+  const unsigned int size =
+      std::min(PAGE_SIZE, CServiceBroker::GetRenderSystem()->GetMaxTextureSize());
+  std::shared_ptr<CTexture> page = CTexture::CreateTexture(size, size, XB_FMT_A8R8G8B8);
+  if (!page || !page->GetPixels() || page->GetTextureWidth() < MAX_IMAGE_SIZE + 2 * BORDER ||
+      page->GetTextureHeight() < MAX_IMAGE_SIZE + 2 * BORDER)
+    return false;
+
+  // opaque until an image with alpha is added, the unused space is never sampled
+  std::memset(page->GetPixels(), 0, static_cast<size_t>(page->GetPitch()) * page->GetRows());
+  page->SetAlpha(false);
+
+  m_page = std::move(page);
+  m_pageSize = std::min(m_page->GetTextureWidth(), m_page->GetTextureHeight());
+  m_cursorX = 0;
+  m_shelfY = 0;
+  m_shelfHeight = 0;
+  return true;
+}
@@ -0,0 +1,61 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+class CTexture;
+
+/*!
+ \ingroup textures
+ \brief Packs small skin images into shared textures.
+
+ Images are copied into the current page with a one pixel border repeating their edges, so
+ linear filtering doesn't pick up the neighbouring images. A page only takes new images until it
+ has been uploaded to the GPU, after that a new page is started.
+ */
+class CTextureAtlas
+{
+public:
+  static constexpr unsigned int MAX_IMAGE_SIZE = 128;
+
+  struct Region
+  {
+    std::shared_ptr<CTexture> page;
+    unsigned int x; //!< left of the image in the page, in pixels
+    unsigned int y; //!< top of the image in the page, in pixels
+  };
+
+  /*!
+   \brief Copy a BGRA image into the atlas.
+   \param pitch bytes per row of pixels
+   \return the location of the image, nothing if it's too big for the atlas
+   */
+  std::optional<Region> Add(unsigned int width,
+                            unsigned int height,
+                            unsigned int pitch,
+                            const uint8_t* pixels,
+                            bool hasAlpha);
+
+  /*!
+   \brief Stop adding to the current page, it's kept alive by the images using it.
+   */
+  void Reset();
+
+private:
+  bool NewPage();
+
+  std::shared_ptr<CTexture> m_page;
+  unsigned int m_pageSize{0};
+  unsigned int m_cursorX{0};
+  unsigned int m_shelfY{0};
+  unsigned int m_shelfHeight{0};
+};
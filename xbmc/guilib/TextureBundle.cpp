@@ -44,10 +44,11 @@ std::vector<std::string> CTextureBundle::GetTexturesFromPath(const std::string&
     return {};
 }
 
-std::optional<CTextureBundleXBT::Texture> CTextureBundle::LoadTexture(const std::string& filename)
+std::optional<CTextureBundleXBT::Texture> CTextureBundle::LoadTexture(const std::string& filename,
+                                                                      CTextureAtlas* atlas)
 {
   if (m_useXBT)
-    return m_tbXBT.LoadTexture(filename);
+    return m_tbXBT.LoadTexture(filename, atlas);
   else
     return {};
 }
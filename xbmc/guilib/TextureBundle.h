@@ -33,9 +33,11 @@ public:
    * \brief Load texture from bundle
    *
    * \param[in] filename name of the texture to load
+   * \param[in] atlas if set, small images are packed into it instead of getting their own texture
    * \return std::optional<CTextureBundleXBT::Texture> if texture was loaded
    */
-  std::optional<CTextureBundleXBT::Texture> LoadTexture(const std::string& filename);
+  std::optional<CTextureBundleXBT::Texture> LoadTexture(const std::string& filename,
+                                                        CTextureAtlas* atlas = nullptr);
 
   /*!
    * \brief Load animation from bundle
@@ -150,7 +150,7 @@ std::vector<std::string> CTextureBundleXBT::GetTexturesFromPath(const std::strin
 }
 
 std::optional<CTextureBundleXBT::Texture> CTextureBundleXBT::LoadTexture(
-    const std::string& filename)
+    const std::string& filename, CTextureAtlas* atlas)
 {
   std::string name = Normalize(filename);
 
@@ -167,6 +167,13 @@ std::optional<CTextureBundleXBT::Texture> CTextureBundleXBT::LoadTexture(
   texture.width = frame.GetWidth();
   texture.height = frame.GetHeight();
 
+  if (atlas && file.GetFrames().size() == 1)
+  {
+    texture.region = AddFrameToAtlas(frame, *atlas);
+    if (texture.region)
+      return std::make_optional<Texture>(std::move(texture));
+  }
+
   texture.texture = ConvertFrameToTexture(filename, frame);
   if (!texture.texture)
     return {};
@@ -211,48 +218,67 @@ std::optional<CTextureBundleXBT::Animation> CTextureBundleXBT::LoadAnim(const st
 std::unique_ptr<CTexture> CTextureBundleXBT::ConvertFrameToTexture(const std::string& name,
                                                                    const CXBTFFrame& frame)
 {
-  // found texture - allocate the necessary buffers
-  std::vector<unsigned char> buffer(static_cast<size_t>(frame.GetPackedSize()));
-
-  // load the compressed texture
-  if (!m_XBTFReader->Load(frame, buffer.data()))
+  // load the texture, unpacked straight from the bundle's memory where it is mapped
+  std::optional<std::vector<uint8_t>> buffer = UnpackFrame(*m_XBTFReader, frame);
+  if (!buffer)
   {
     CLog::Log(LOGERROR, "Error loading texture: {}", name);
     return {};
   }
 
-  // check if it's packed with lzo
-  if (frame.IsPacked())
-  { // unpack
-    std::vector<unsigned char> unpacked(static_cast<size_t>(frame.GetUnpackedSize()));
-    lzo_uint s = (lzo_uint)frame.GetUnpackedSize();
-    if (lzo1x_decompress_safe(buffer.data(), static_cast<lzo_uint>(buffer.size()), unpacked.data(),
-                              &s, NULL) != LZO_E_OK ||
-        s != frame.GetUnpackedSize())
-    {
-      CLog::Log(LOGERROR, "Error loading texture: {}: Decompression error", name);
-      return {};
-    }
-    buffer = std::move(unpacked);
-  }
-
   // create an xbmc texture
   std::unique_ptr<CTexture> texture = CTexture::CreateTexture();
 
   if (frame.GetKDFormatType())
   {
-    texture->UploadFromMemory(frame.GetWidth(), frame.GetHeight(), 0, buffer.data(),
+    texture->UploadFromMemory(frame.GetWidth(), frame.GetHeight(), 0, buffer->data(),
                               frame.GetKDFormat(), frame.GetKDAlpha(), frame.GetKDSwizzle());
   }
   else if (frame.GetFormat() == XB_FMT_A8R8G8B8)
   {
     KD_TEX_ALPHA alpha = frame.HasAlpha() ? KD_TEX_ALPHA_STRAIGHT : KD_TEX_ALPHA_OPAQUE;
-    texture->UploadFromMemory(frame.GetWidth(), frame.GetHeight(), 0, buffer.data(),
+    texture->UploadFromMemory(frame.GetWidth(), frame.GetHeight(), 0, buffer->data(),
                               KD_TEX_FMT_SDR_BGRA8, alpha, KD_TEX_SWIZ_RGBA);
   }
   return texture;
 }
 
+std::optional<CTextureAtlas::Region> CTextureBundleXBT::AddFrameToAtlas(const CXBTFFrame& frame,
+                                                                         CTextureAtlas& atlas)
+{
+  if (frame.GetWidth() > CTextureAtlas::MAX_IMAGE_SIZE ||
+      frame.GetHeight() > CTextureAtlas::MAX_IMAGE_SIZE)
+    return {};
+
+  // only plain BGRA images can be copied into a page as they are
+  bool hasAlpha;
+  if (frame.GetKDFormatType())
+  {
+    if (frame.GetKDFormat() != KD_TEX_FMT_SDR_BGRA8 || frame.GetKDSwizzle() != KD_TEX_SWIZ_RGBA ||
+        frame.GetKDAlpha() == KD_TEX_ALPHA_PREMULTIPLIED)
+      return {};
+    hasAlpha = frame.GetKDAlpha() != KD_TEX_ALPHA_OPAQUE;
+  }
+  else if (frame.GetFormat() == XB_FMT_A8R8G8B8)
+    hasAlpha = frame.HasAlpha();
+  else
+    return {};
+
+  const unsigned int pitch = frame.GetWidth() * 4;
+  const size_t size = static_cast<size_t>(pitch) * frame.GetHeight();
+
+  // the atlas copies the pixels of an unpacked frame straight from the mapped bundle
+  const uint8_t* mapped = frame.IsPacked() ? nullptr : m_XBTFReader->GetPackedData(frame);
+  if (mapped && frame.GetPackedSize() >= size)
+    return atlas.Add(frame.GetWidth(), frame.GetHeight(), pitch, mapped, hasAlpha);
+
+  const std::optional<std::vector<uint8_t>> pixels = UnpackFrame(*m_XBTFReader, frame);
+  if (!pixels || pixels->size() < size)
+    return {};
+
+  return atlas.Add(frame.GetWidth(), frame.GetHeight(), pitch, pixels->data(), hasAlpha);
+}
+
 void CTextureBundleXBT::SetThemeBundle(bool themeBundle)
 {
   m_themeBundle = themeBundle;
@@ -272,17 +298,28 @@ std::string CTextureBundleXBT::Normalize(std::string name)
 std::optional<std::vector<uint8_t>> CTextureBundleXBT::UnpackFrame(const CXBTFReader& reader,
                                                                    const CXBTFFrame& frame)
 {
-  // load the compressed texture
-  std::vector<uint8_t> packedBuffer(static_cast<size_t>(frame.GetPackedSize()));
-  if (!reader.Load(frame, packedBuffer.data()))
+  // the compressed texture, read from the file unless the bundle is memory mapped
+  const size_t packedSize = static_cast<size_t>(frame.GetPackedSize());
+  const uint8_t* packedData = reader.GetPackedData(frame);
+  std::vector<uint8_t> packedBuffer;
+  if (!packedData)
   {
-    CLog::Log(LOGERROR, "CTextureBundleXBT: error loading frame");
-    return std::nullopt;
+    packedBuffer.resize(packedSize);
+    if (!reader.Load(frame, packedBuffer.data()))
+    {
+      CLog::Log(LOGERROR, "CTextureBundleXBT: error loading frame");
+      return std::nullopt;
+    }
+    packedData = packedBuffer.data();
   }
 
   // if the frame isn't packed there's nothing else to be done
   if (!frame.IsPacked())
+  {
+    if (packedBuffer.empty())
+      packedBuffer.assign(packedData, packedData + packedSize);
     return packedBuffer;
+  }
 
   // make sure lzo is initialized
   if (lzo_init() != LZO_E_OK)
@@ -293,8 +330,8 @@ std::optional<std::vector<uint8_t>> CTextureBundleXBT::UnpackFrame(const CXBTFRe
 
   lzo_uint size = static_cast<lzo_uint>(frame.GetUnpackedSize());
   std::vector<uint8_t> unpackedBuffer(static_cast<size_t>(frame.GetUnpackedSize()));
-  if (lzo1x_decompress_safe(packedBuffer.data(), static_cast<lzo_uint>(packedBuffer.size()),
-                            unpackedBuffer.data(), &size, nullptr) != LZO_E_OK ||
+  if (lzo1x_decompress_safe(packedData, static_cast<lzo_uint>(packedSize), unpackedBuffer.data(),
+                            &size, nullptr) != LZO_E_OK ||
       size != frame.GetUnpackedSize())
   {
     CLog::Log(LOGERROR,
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Texture.h"
+#include "TextureAtlas.h"
 
 #include <cstdint>
 #include <ctime>
@@ -36,6 +37,7 @@ public:
   struct Texture
   {
     std::unique_ptr<CTexture> texture;
+    std::optional<CTextureAtlas::Region> region; //!< set instead of texture if packed into an atlas
     int width;
     int height;
   };
@@ -43,7 +45,7 @@ public:
   /*!
    * \brief See CTextureBundle::LoadTexture
    */
-  std::optional<Texture> LoadTexture(const std::string& filename);
+  std::optional<Texture> LoadTexture(const std::string& filename, CTextureAtlas* atlas = nullptr);
 
   struct Animation
   {
@@ -66,6 +68,8 @@ public:
 private:
   bool OpenBundle();
   std::unique_ptr<CTexture> ConvertFrameToTexture(const std::string& name, const CXBTFFrame& frame);
+  std::optional<CTextureAtlas::Region> AddFrameToAtlas(const CXBTFFrame& frame,
+                                                       CTextureAtlas& atlas);
 
   time_t m_TimeStamp;
 
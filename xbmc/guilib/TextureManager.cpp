@@ -14,8 +14,11 @@
 #include "commons/ilog.h"
 #include "filesystem/Directory.h"
 #include "filesystem/File.h"
+#include "guilib/GPUMemoryBudget.h"
 #include "guilib/TextureBundle.h"
 #include "guilib/TextureFormats.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
@@ -56,6 +59,9 @@ CTextureArray::CTextureArray(int width, int height, int loops,  bool texCoordsAr
   m_orientation = 0;
   m_texWidth = 0;
   m_texHeight = 0;
+  m_texOffsetX = 0;
+  m_texOffsetY = 0;
+  m_inAtlas = false;
   m_texCoordsArePixels = false;
 }
 
@@ -82,6 +88,9 @@ void CTextureArray::Reset()
   m_orientation = 0;
   m_texWidth = 0;
   m_texHeight = 0;
+  m_texOffsetX = 0;
+  m_texOffsetY = 0;
+  m_inAtlas = false;
   m_texCoordsArePixels = false;
   m_scalingMethod = TEXTURE_SCALING::UNKNOWN;
 }
@@ -90,6 +99,10 @@ void CTextureArray::SetScalingMethod(TEXTURE_SCALING scalingMethod)
 {
   m_scalingMethod = scalingMethod;
 
+  // atlas pages are shared by many images and keep the default linear scaling
+  if (m_inAtlas)
+    return;
+
   for (const std::shared_ptr<CTexture>& texture : m_textures)
     texture->SetScalingMethod(m_scalingMethod);
 }
@@ -221,6 +234,17 @@ void CTextureMap::Add(std::unique_ptr<CTexture> texture, int delay)
   m_texture.Add(std::move(texture), delay);
 }
 
+void CTextureMap::Add(const CTextureAtlas::Region& region, int width, int height)
+{
+  // only count the part of the page used by this image
+  m_memUsage += sizeof(CTexture) + (width * height * 4);
+
+  m_texture.Add(region.page, 100);
+  m_texture.m_texOffsetX = region.x;
+  m_texture.m_texOffsetY = region.y;
+  m_texture.m_inAtlas = true;
+}
+
 /************************************************************************/
 /*                                                                      */
 /************************************************************************/
@@ -440,14 +464,25 @@ const CTextureArray& CGUITextureManager::Load(const std::string& strTextureName,
   int width = 0, height = 0;
   if (bundle >= 0)
   {
+    const bool useAtlas =
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiTextureAtlas;
     std::optional<CTextureBundleXBT::Texture> texture =
-        m_TexBundle[bundle].LoadTexture(strTextureName);
+        m_TexBundle[bundle].LoadTexture(strTextureName, useAtlas ? &m_atlas : nullptr);
     if (!texture)
     {
       CLog::Log(LOGERROR, "Texture manager unable to load bundled file: {}", strTextureName);
       return emptyTexture;
     }
 
+    if (texture.value().region)
+    {
+      CTextureMap* pMap = new CTextureMap(strTextureName, texture.value().width,
+                                          texture.value().height, 0);
+      pMap->Add(texture.value().region.value(), texture.value().width, texture.value().height);
+      m_vecTextures.push_back(pMap);
+      return pMap->GetTexture();
+    }
+
     pTexture = std::move(texture.value().texture);
     width = texture.value().width;
     height = texture.value().height;
@@ -525,6 +560,21 @@ void CGUITextureManager::FreeUnusedTextures(unsigned int timeDelay)
       ++i;
   }
 
+  // over the budget the least recently released textures go first, whatever their delay
+  auto& budget = CGPUMemoryBudget::GetInstance();
+  budget.SetUsage(CGPUMemoryBudget::Consumer::GUI_TEXTURES,
+                  GetMemoryUsage() + GetUnusedMemoryUsage());
+  uint64_t excess = budget.GetExcess();
+  while (excess > 0 && !m_unusedTextures.empty())
+  {
+    CTextureMap* pMap = m_unusedTextures.front().first;
+    const uint64_t memUsage = pMap->GetMemoryUsage();
+    excess -= std::min(excess, memUsage);
+    budget.Remove(CGPUMemoryBudget::Consumer::GUI_TEXTURES, memUsage);
+    delete pMap;
+    m_unusedTextures.pop_front();
+  }
+
 #if defined(HAS_GL) || defined(HAS_GLES)
   for (unsigned int i = 0; i < m_unusedHwTextures.size(); ++i)
   {
@@ -564,6 +614,7 @@ void CGUITextureManager::Cleanup()
   m_TexBundle[1].Close();
   m_TexBundle[0] = CTextureBundle(true);
   m_TexBundle[1] = CTextureBundle();
+  m_atlas.Reset();
   FreeUnusedTextures();
 }
 
@@ -611,6 +662,14 @@ unsigned int CGUITextureManager::GetMemoryUsage() const
   return memUsage;
 }
 
+uint32_t CGUITextureManager::GetUnusedMemoryUsage() const
+{
+  uint32_t memUsage = 0;
+  for (const auto& [texture, released] : m_unusedTextures)
+    memUsage += texture->GetMemoryUsage();
+  return memUsage;
+}
+
 void CGUITextureManager::SetTexturePath(const std::string &texturePath)
 {
   std::unique_lock lock(m_section);
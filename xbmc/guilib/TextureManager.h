@@ -9,6 +9,7 @@
 #pragma once
 
 #include "GUIComponent.h"
+#include "TextureAtlas.h"
 #include "TextureBundle.h"
 #include "TextureScaling.h"
 #include "threads/CriticalSection.h"
@@ -52,6 +53,9 @@ public:
   int m_loops;
   int m_texWidth;
   int m_texHeight;
+  int m_texOffsetX; //!< position of the image in its texture if that's shared with others
+  int m_texOffsetY;
+  bool m_inAtlas;
   bool m_texCoordsArePixels;
   TEXTURE_SCALING m_scalingMethod{TEXTURE_SCALING::UNKNOWN};
 };
@@ -71,6 +75,7 @@ public:
   virtual ~CTextureMap();
 
   void Add(std::unique_ptr<CTexture> texture, int delay);
+  void Add(const CTextureAtlas::Region& region, int width, int height);
   bool Release();
 
   const std::string& GetName() const;
@@ -110,6 +115,7 @@ public:
   void Cleanup();
   void Dump() const;
   uint32_t GetMemoryUsage() const;
+  uint32_t GetUnusedMemoryUsage() const; ///< Memory of the released textures not freed yet
   void Flush();
   std::string GetTexturePath(const std::string& textureName, bool directory = false);
   std::vector<std::string> GetBundledTexturesFromPath(const std::string& texturePath);
@@ -128,6 +134,7 @@ protected:
   typedef std::vector<CTextureMap*>::iterator ivecTextures;
   // we have 2 texture bundles (one for the base textures, one for the theme)
   CTextureBundle m_TexBundle[2];
+  CTextureAtlas m_atlas;
 
   std::vector<std::string> m_texturePaths;
   CCriticalSection m_section;
@@ -21,6 +21,10 @@
 #include "platform/win32/PlatformDefs.h"
 #endif
 
+#if defined(TARGET_POSIX)
+#include <sys/mman.h>
+#endif
+
 static bool ReadString(FILE* file, char* str, size_t max_length)
 {
   if (file == nullptr || str == nullptr || max_length <= 0)
@@ -174,9 +178,29 @@ bool CXBTFReader::Open(const std::string& path)
   if (pos != GetHeaderSize())
     return false;
 
+  Map();
+
   return true;
 }
 
+void CXBTFReader::Map()
+{
+#if defined(TARGET_POSIX)
+  // the frames decompress straight from the page cache instead of from copies of it
+  struct stat fileStat;
+  if (fstat(fileno(m_file), &fileStat) == -1 || fileStat.st_size <= 0)
+    return;
+
+  const size_t size = static_cast<size_t>(fileStat.st_size);
+  void* map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileno(m_file), 0);
+  if (map == MAP_FAILED)
+    return;
+
+  m_map = static_cast<const unsigned char*>(map);
+  m_mapSize = size;
+#endif
+}
+
 bool CXBTFReader::IsOpen() const
 {
   return m_file != nullptr;
@@ -184,6 +208,15 @@ bool CXBTFReader::IsOpen() const
 
 void CXBTFReader::Close()
 {
+#if defined(TARGET_POSIX)
+  if (m_map != nullptr)
+  {
+    munmap(const_cast<unsigned char*>(m_map), m_mapSize);
+    m_map = nullptr;
+    m_mapSize = 0;
+  }
+#endif
+
   if (m_file != nullptr)
   {
     fclose(m_file);
@@ -211,6 +244,12 @@ bool CXBTFReader::Load(const CXBTFFrame& frame, unsigned char* buffer) const
   if (m_file == nullptr)
     return false;
 
+  if (const unsigned char* data = GetPackedData(frame))
+  {
+    memcpy(buffer, data, static_cast<size_t>(frame.GetPackedSize()));
+    return true;
+  }
+
 #if defined(TARGET_DARWIN) || defined(TARGET_FREEBSD)
   if (fseeko(m_file, static_cast<off_t>(frame.GetOffset()), SEEK_SET) == -1)
 #elif defined(TARGET_ANDROID)
@@ -225,3 +264,12 @@ bool CXBTFReader::Load(const CXBTFFrame& frame, unsigned char* buffer) const
 
   return true;
 }
+
+const unsigned char* CXBTFReader::GetPackedData(const CXBTFFrame& frame) const
+{
+  if (m_map == nullptr || frame.GetOffset() > m_mapSize ||
+      frame.GetPackedSize() > m_mapSize - frame.GetOffset())
+    return nullptr;
+
+  return m_map + frame.GetOffset();
+}
@@ -29,9 +29,20 @@ public:
 
   bool Load(const CXBTFFrame& frame, unsigned char* buffer) const;
 
+  /*!
+   * \brief Get the packed data of a frame without copying it, where the bundle is memory mapped.
+   * \return the frame.GetPackedSize() bytes of the frame, nullptr if the bundle isn't mapped and
+   * Load() has to read them.
+   */
+  const unsigned char* GetPackedData(const CXBTFFrame& frame) const;
+
 private:
+  void Map();
+
   std::string m_path;
   FILE* m_file = nullptr;
+  const unsigned char* m_map = nullptr;
+  size_t m_mapSize = 0;
 };
 
 typedef std::shared_ptr<CXBTFReader> CXBTFReaderPtr;
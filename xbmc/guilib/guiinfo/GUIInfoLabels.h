@@ -83,7 +83,8 @@ constexpr uint32_t PLAYER_SCENE_MARKERS              = 71;
 constexpr uint32_t PLAYER_HAS_SCENE_MARKERS          = 72;
 constexpr uint32_t PLAYER_BOOKMARKS                  = 73;
 constexpr uint32_t PLAYER_HAS_BOOKMARKS              = 74;
-// unused id 75 to 80
+constexpr uint32_t PLAYER_SEEK_PREVIEW               = 75;
+// unused id 76 to 80
 
 // Keep player infolabels that work with offset and position together
 constexpr uint32_t PLAYER_PATH                       = 81;
@@ -806,6 +807,7 @@ constexpr uint32_t PLAYER_PROCESS_AUDIO_QUEUE_LEVEL  = PLAYER_PROCESS_START + 16
 constexpr uint32_t PLAYER_PROCESS_AUDIO_QUEUE_DATA_LEVEL = PLAYER_PROCESS_START + 17;
 constexpr uint32_t PLAYER_PROCESS_VIDEO_QUEUE_LEVEL  = PLAYER_PROCESS_START + 18;
 constexpr uint32_t PLAYER_PROCESS_VIDEO_QUEUE_DATA_LEVEL = PLAYER_PROCESS_START + 19;
+constexpr uint32_t PLAYER_PROCESS_VIDEO_DECODE_TIME  = PLAYER_PROCESS_START + 20;
 
 constexpr uint32_t ADDON_INFOS_START                 = 1600;
 constexpr uint32_t ADDON_SETTING_STRING              = ADDON_INFOS_START;
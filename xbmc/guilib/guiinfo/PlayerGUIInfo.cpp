@@ -32,6 +32,7 @@
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
+#include "video/VideoSeekPreview.h"
 #include "windowing/WinSystem.h"
 
 #include <charconv>
@@ -282,6 +283,14 @@ bool CPlayerGUIInfo::GetLabel(std::string& value,
     case PLAYER_SEEKNUMERIC:
       value = GetSeekTime(static_cast<TIME_FORMAT>(info.GetData1()));
       return !value.empty();
+    case PLAYER_SEEK_PREVIEW:
+    {
+      const double seekTime =
+          g_application.GetTime() + m_appPlayer->GetSeekHandler().GetSeekSize();
+      value = KODI::VIDEO::CVideoSeekPreview::GetTileImage(
+          *item, std::chrono::milliseconds(static_cast<int64_t>(seekTime * 1000)));
+      return !value.empty();
+    }
     case PLAYER_CACHELEVEL:
     {
       int iLevel = m_appPlayer->GetCacheLevel();
@@ -374,6 +383,13 @@ bool CPlayerGUIInfo::GetLabel(std::string& value,
     case PLAYER_PROCESS_VIDEO_QUEUE_DATA_LEVEL:
       value = std::to_string(CServiceBroker::GetDataCacheCore().GetVideoQueueDataLevel());
       return true;
+    case PLAYER_PROCESS_VIDEO_DECODE_TIME:
+    {
+      const float decodeTime = CServiceBroker::GetDataCacheCore().GetVideoDecodeTime();
+      if (decodeTime > 0.0f)
+        value = StringUtils::Format("{:.2f}", decodeTime);
+      return true;
+    }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
     // PLAYLIST_*
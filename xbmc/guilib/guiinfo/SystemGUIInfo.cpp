@@ -57,7 +57,12 @@ CSystemGUIInfo::CSystemGUIInfo()
 
 std::string CSystemGUIInfo::GetSystemHeatInfo(int info) const
 {
-  if (CTimeUtils::GetFrameTime() - m_lastSysHeatInfoTime >= SYSTEM_HEAT_UPDATE_INTERVAL)
+  // polled less often while idle
+  const auto appPower =
+      CServiceBroker::GetAppComponents().GetComponent<CApplicationPowerHandling>();
+  const unsigned int interval =
+      SYSTEM_HEAT_UPDATE_INTERVAL * (appPower && appPower->IsIdle() ? 5 : 1);
+  if (CTimeUtils::GetFrameTime() - m_lastSysHeatInfoTime >= interval)
   {
     m_lastSysHeatInfoTime = CTimeUtils::GetFrameTime();
     CServiceBroker::GetCPUInfo()->GetTemperature(m_cpuTemp);
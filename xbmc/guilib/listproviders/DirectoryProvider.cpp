@@ -21,6 +21,7 @@
 #include "jobs/JobManager.h"
 #include "music/MusicFileItemClassify.h"
 #include "music/MusicThumbLoader.h"
+#include "music/tags/MusicInfoTag.h"
 #include "pictures/PictureThumbLoader.h"
 #include "pvr/PVRManager.h"
 #include "pvr/PVRThumbLoader.h"
@@ -38,6 +39,7 @@
 #include "utils/guilib/GUIBuiltinsUtils.h"
 #include "utils/guilib/GUIContentUtils.h"
 #include "utils/log.h"
+#include "video/Bookmark.h"
 #include "video/VideoFileItemClassify.h"
 #include "video/VideoInfoTag.h"
 #include "video/VideoThumbLoader.h"
@@ -46,8 +48,10 @@
 #include "video/guilib/VideoSelectActionProcessor.h"
 
 #include <atomic>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <utility>
 
 using namespace XFILE;
@@ -113,8 +117,76 @@ private:
   ISubscriberCallback& m_callback;
 };
 
+/*!
+ \brief The listing of a directory as fetched by a CDirectoryJob, shared by all providers with the
+ same url, sort, limit, browse mode and target
+ */
+struct CDirectoryProvider::CResult
+{
+  std::string key;
+  std::vector<CGUIStaticItemPtr> items;
+  std::string target;
+  std::vector<InfoTagType> itemTypes;
+};
+
 namespace
 {
+/*!
+ \brief Process wide cache of the directory results in use
+
+ The cache only holds weak references, a result lives as long as one of the providers showing it.
+ Every provider of a result is subscribed to its invalidation, so a result still in the cache is
+ up to date and a provider with the same settings, e.g. a widget on another window, can show it
+ without fetching the directory again.
+ */
+class CDirectoryResultCache
+{
+public:
+  static std::shared_ptr<const CDirectoryProvider::CResult> Get(const std::string& key)
+  {
+    std::unique_lock lock(GetSection());
+    const auto it = GetResults().find(key);
+    return it != GetResults().end() ? it->second.lock() : nullptr;
+  }
+
+  static void Set(const std::shared_ptr<const CDirectoryProvider::CResult>& result)
+  {
+    std::unique_lock lock(GetSection());
+    std::erase_if(GetResults(), [](const auto& entry) { return entry.second.expired(); });
+    GetResults().insert_or_assign(result->key, result);
+  }
+
+  static void Remove(const std::string& key)
+  {
+    std::unique_lock lock(GetSection());
+    GetResults().erase(key);
+  }
+
+private:
+  static CCriticalSection& GetSection()
+  {
+    static CCriticalSection section;
+    return section;
+  }
+
+  static std::map<std::string, std::weak_ptr<const CDirectoryProvider::CResult>>& GetResults()
+  {
+    static std::map<std::string, std::weak_ptr<const CDirectoryProvider::CResult>> results;
+    return results;
+  }
+};
+
+std::string GetResultKey(const std::string& url,
+                         const std::string& target,
+                         const SortDescription& sort,
+                         unsigned int limit,
+                         CDirectoryProvider::BrowseMode browse)
+{
+  return StringUtils::Format("{}|{}|{}|{}|{}|{}", url, static_cast<int>(sort.sortBy),
+                             static_cast<int>(sort.sortOrder), limit, static_cast<int>(browse),
+                             target);
+}
+
 class CAddonsSubscriber : public CDirectoryProvider::CSubscriber
 {
 public:
@@ -217,6 +289,52 @@ std::unique_ptr<CDirectoryProvider::CSubscriber> GetSubscriber(const std::string
     return std::make_unique<CDirectoryProvider::CSubscriber>(invalidate);
 }
 
+/*!
+ \brief Identifies an item across refreshes of the same directory
+ */
+std::string GetItemKey(const CGUIStaticItem& item)
+{
+  int dbId = -1;
+  if (item.HasVideoInfoTag())
+    dbId = item.GetVideoInfoTag()->m_iDbId;
+  else if (item.HasMusicInfoTag())
+    dbId = item.GetMusicInfoTag()->GetDatabaseId();
+  return StringUtils::Format("{}|{}", item.GetPath(), dbId);
+}
+
+/*!
+ \brief Whether a refreshed item shows the same as the current one, so the current one (with its
+ layouts and loaded art) can be kept
+ */
+bool IsUnchanged(const CGUIStaticItem& current, const CGUIStaticItem& item)
+{
+  if (current.GetLabel() != item.GetLabel() || current.GetLabel2() != item.GetLabel2() ||
+      current.GetArt() != item.GetArt() || current.GetProperties() != item.GetProperties() ||
+      current.IsFolder() != item.IsFolder())
+    return false;
+
+  if (current.HasVideoInfoTag() != item.HasVideoInfoTag() ||
+      current.HasMusicInfoTag() != item.HasMusicInfoTag())
+    return false;
+
+  if (item.HasVideoInfoTag())
+  {
+    const CVideoInfoTag* currentTag = current.GetVideoInfoTag();
+    const CVideoInfoTag* tag = item.GetVideoInfoTag();
+    const CBookmark currentResume = currentTag->GetResumePoint();
+    const CBookmark resume = tag->GetResumePoint();
+    if (currentTag->GetPlayCount() != tag->GetPlayCount() ||
+        currentResume.timeInSeconds != resume.timeInSeconds ||
+        currentResume.totalTimeInSeconds != resume.totalTimeInSeconds)
+      return false;
+  }
+  if (item.HasMusicInfoTag() &&
+      current.GetMusicInfoTag()->GetPlayCount() != item.GetMusicInfoTag()->GetPlayCount())
+    return false;
+
+  return true;
+}
+
 class CDirectoryJob : public CJob
 {
 public:
@@ -226,7 +344,8 @@ public:
                 int limit,
                 CDirectoryProvider::BrowseMode browse,
                 int parentID)
-    : m_url(url),
+    : m_key(GetResultKey(url, target, sort, limit, browse)),
+      m_url(url),
       m_target(target),
       m_sort(sort),
       m_limit(limit),
@@ -242,7 +361,7 @@ public:
     if (strcmp(job->GetType(), GetType()) == 0)
     {
       const auto* dirJob = dynamic_cast<const CDirectoryJob*>(job);
-      if (dirJob && dirJob->m_url == m_url)
+      if (dirJob && dirJob->m_key == m_key)
         return true;
     }
     return false;
@@ -340,17 +459,23 @@ public:
     }
   }
 
-  const std::vector<CGUIStaticItemPtr>& GetItems() const { return m_items; }
-  const std::string& GetTarget() const { return m_target; }
-  std::vector<InfoTagType> GetItemTypes(std::vector<InfoTagType>& itemTypes) const
+  std::shared_ptr<const CDirectoryProvider::CResult> GetResult()
   {
-    itemTypes.clear();
-    for (const auto& [type, _] : m_thumbloaders)
-      itemTypes.emplace_back(type);
-    return itemTypes;
+    if (!m_result)
+    {
+      auto result = std::make_shared<CDirectoryProvider::CResult>();
+      result->key = m_key;
+      result->items = m_items;
+      result->target = m_target;
+      for (const auto& [type, _] : m_thumbloaders)
+        result->itemTypes.emplace_back(type);
+      m_result = std::move(result);
+    }
+    return m_result;
   }
 
 private:
+  std::string m_key;
   std::string m_url;
   std::string m_target;
   SortDescription m_sort;
@@ -359,6 +484,7 @@ private:
   int m_parentID;
   std::vector<CGUIStaticItemPtr> m_items;
   std::map<InfoTagType, std::shared_ptr<CThumbLoader>> m_thumbloaders;
+  std::shared_ptr<const CDirectoryProvider::CResult> m_result;
 };
 } // unnamed namespace
 
@@ -428,13 +554,61 @@ void CDirectoryProvider::StartDirectoryJob()
   m_lastJobStartedAt = std::chrono::system_clock::now();
   m_nextJobTimer.Stop();
 
+  const std::string target = m_target.GetLabel(GetParentId(), false);
+  const std::string key =
+      GetResultKey(m_currentUrl, target, m_currentSort, m_currentLimit, m_currentBrowse);
+  if (std::shared_ptr<const CResult> result = CDirectoryResultCache::Get(key);
+      result && result != m_result)
+  {
+    // another provider with the same settings already has the current listing
+    CLog::Log(LOGDEBUG, "CDirectoryProvider[{}]: using shared result", m_currentUrl);
+    SetResult(result);
+    return;
+  }
+
   CLog::Log(LOGDEBUG, "CDirectoryProvider[{}]: refreshing...", m_currentUrl);
   m_jobID = CServiceBroker::GetJobManager()->AddJob(
-      new CDirectoryJob(m_currentUrl, m_target.GetLabel(GetParentId(), false), m_currentSort,
-                        m_currentLimit, m_currentBrowse, GetParentId()),
+      new CDirectoryJob(m_currentUrl, target, m_currentSort, m_currentLimit, m_currentBrowse,
+                        GetParentId()),
       this);
 }
 
+void CDirectoryProvider::SetResult(const std::shared_ptr<const CResult>& result)
+{
+  // Keep the current instances of the items that did not change, so their layouts and loaded
+  // art survive the refresh and only new or changed items are laid out again
+  std::unordered_multimap<std::string, CGUIStaticItemPtr> currentItems;
+  for (const auto& item : m_items)
+    currentItems.emplace(GetItemKey(*item), item);
+
+  // Deep copy the other items since the result is shared with other providers,
+  // and each container needs independent visibility state and layout
+  std::vector<CGUIStaticItemPtr> items;
+  items.reserve(result->items.size());
+  size_t kept = 0;
+  for (const auto& item : result->items)
+  {
+    auto it = currentItems.find(GetItemKey(*item));
+    if (it != currentItems.end() && IsUnchanged(*it->second, *item))
+    {
+      items.emplace_back(std::move(it->second));
+      currentItems.erase(it);
+      kept++;
+    }
+    else
+      items.emplace_back(std::make_shared<CGUIStaticItem>(*item));
+  }
+  CLog::Log(LOGDEBUG, "CDirectoryProvider[{}]: kept {} of {} items", m_currentUrl, kept,
+            items.size());
+  m_items = std::move(items);
+
+  m_currentTarget = result->target;
+  m_itemTypes = result->itemTypes;
+  m_result = result;
+  if (m_updateState == UpdateState::OK)
+    m_updateState = UpdateState::DONE;
+}
+
 bool CDirectoryProvider::Update(bool forceRefresh)
 {
   // we never need to force refresh here
@@ -511,6 +685,7 @@ void CDirectoryProvider::Reset()
     m_lastJobStartedAt = {};
     m_nextJobTimer.Stop();
     m_items.clear();
+    m_result.reset();
     m_currentTarget.clear();
     m_currentUrl.clear();
     m_itemTypes.clear();
@@ -539,25 +714,9 @@ void CDirectoryProvider::OnJobComplete(unsigned int jobID, bool success, CJob* j
   std::unique_lock lock(m_section);
   if (success)
   {
-    if (job->GetPendingCallbackCount() > 1)
-    {
-      // Deep copy items since other callbacks will also receive this job's results,
-      // and each container needs independent visibility state and layout
-      const auto& sourceItems = static_cast<CDirectoryJob*>(job)->GetItems();
-      m_items.clear();
-      m_items.reserve(sourceItems.size());
-      for (const auto& item : sourceItems)
-        m_items.emplace_back(std::make_shared<CGUIStaticItem>(*item));
-    }
-    else
-    {
-      m_items = static_cast<CDirectoryJob*>(job)->GetItems();
-    }
-
-    m_currentTarget = static_cast<CDirectoryJob*>(job)->GetTarget();
-    static_cast<CDirectoryJob*>(job)->GetItemTypes(m_itemTypes);
-    if (m_updateState == UpdateState::OK)
-      m_updateState = UpdateState::DONE;
+    std::shared_ptr<const CResult> result = static_cast<CDirectoryJob*>(job)->GetResult();
+    CDirectoryResultCache::Set(result);
+    SetResult(result);
   }
   m_jobID = 0;
 
@@ -618,6 +777,8 @@ bool CDirectoryProvider::OnEventPublished(Topic topic /*= Topic::UNSPECIFIED*/)
       return std::ranges::find(m_itemTypes, InfoTagType::AUDIO) == m_itemTypes.cend();
   }
   m_updateState = UpdateState::INVALIDATED;
+  if (m_result)
+    CDirectoryResultCache::Remove(m_result->key);
   return true;
 }
 
@@ -83,6 +83,7 @@ public:
 
   // Implementation detail.
   class CSubscriber;
+  struct CResult;
 
 private:
   enum class UpdateState
@@ -93,6 +94,7 @@ private:
   };
 
   void StartDirectoryJob();
+  void SetResult(const std::shared_ptr<const CResult>& result);
 
   // ITimerCallback implementation
   void OnTimeout() override;
@@ -116,6 +118,7 @@ private:
   BrowseMode m_currentBrowse{BrowseMode::AUTO};
   std::vector<CGUIStaticItemPtr> m_items;
   std::vector<InfoTagType> m_itemTypes;
+  std::shared_ptr<const CResult> m_result; ///< \brief keeps the shared result of the directory alive
   mutable CCriticalSection m_section;
 
   bool UpdateURL();
@@ -0,0 +1,51 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIFrameBudget.h"
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+TEST(TestGUIFrameBudget, OutsideOfFrame)
+{
+  CGUIFrameBudget budget;
+  EXPECT_TRUE(budget.HasTime());
+  budget.EndFrame();
+  EXPECT_EQ(budget.GetMissedFrames(), 0u);
+  EXPECT_EQ(budget.GetDeferredUpdates(), 0u);
+}
+
+TEST(TestGUIFrameBudget, WithinBudget)
+{
+  CGUIFrameBudget budget;
+  budget.BeginFrame(1.0f);
+  EXPECT_TRUE(budget.HasTime());
+  budget.EndFrame();
+  EXPECT_EQ(budget.GetMissedFrames(), 0u);
+  EXPECT_EQ(budget.GetDeferredUpdates(), 0u);
+}
+
+TEST(TestGUIFrameBudget, MissedDeadline)
+{
+  CGUIFrameBudget budget;
+  budget.BeginFrame(1000.0f);
+  std::this_thread::sleep_for(5ms);
+  EXPECT_FALSE(budget.HasTime());
+  EXPECT_FALSE(budget.HasTime());
+  budget.EndFrame();
+  EXPECT_EQ(budget.GetMissedFrames(), 1u);
+  EXPECT_EQ(budget.GetDeferredUpdates(), 2u);
+
+  // the next frame starts with a fresh budget
+  budget.BeginFrame(1.0f);
+  EXPECT_TRUE(budget.HasTime());
+}
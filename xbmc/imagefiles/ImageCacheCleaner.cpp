@@ -16,6 +16,8 @@
 #include "utils/log.h"
 #include "video/VideoDatabase.h"
 
+#include <unordered_set>
+
 namespace IMAGE_FILES
 {
 std::optional<IMAGE_FILES::CImageCacheCleaner> CImageCacheCleaner::Create()
@@ -93,8 +95,8 @@ CleanerResult CImageCacheCleaner::ScanOldestCache(unsigned int imageLimit)
   usedImages.insert(usedImages.end(), std::make_move_iterator(nextUsedImages.begin()),
                     std::make_move_iterator(nextUsedImages.end()));
 
-  std::erase_if(images, [&usedImages](const std::string& image)
-                { return std::ranges::find(usedImages, image) != usedImages.cend(); });
+  const std::unordered_set<std::string> used(usedImages.begin(), usedImages.end());
+  std::erase_if(images, [&used](const std::string& image) { return used.contains(image); });
 
   m_textureDB->SetKeepCachedImages(usedImages);
 
@@ -104,4 +106,9 @@ CleanerResult CImageCacheCleaner::ScanOldestCache(unsigned int imageLimit)
 
   return CleanerResult{processedCount, keptCount, std::move(images)};
 }
+
+unsigned int CImageCacheCleaner::CountOldestCache(unsigned int imageLimit) const
+{
+  return m_textureDB->GetOldestCachedImagesCount(imageLimit);
+}
 } // namespace IMAGE_FILES
@@ -46,6 +46,11 @@ public:
 
   CleanerResult ScanOldestCache(unsigned int imageLimit);
 
+  /*!
+   * @brief Get the number of old images a full clean processes, in scans of imageLimit images.
+   */
+  unsigned int CountOldestCache(unsigned int imageLimit) const;
+
 private:
   CImageCacheCleaner();
   bool m_valid;
@@ -0,0 +1,181 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ImageCachePrecacher.h"
+
+#include "ServiceBroker.h"
+#include "TextureCache.h"
+#include "TextureDatabase.h"
+#include "URL.h"
+#include "imagefiles/ImageFileURL.h"
+#include "music/MusicDatabase.h"
+#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
+#include "utils/log.h"
+#include "video/VideoDatabase.h"
+
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+namespace
+{
+// downloads are mostly waiting on the network, decoding is bounded by the cores
+constexpr unsigned int MAX_WORKERS = 8;
+// don't hammer a single web server (or NAS) with every worker at once
+constexpr unsigned int MAX_REQUESTS_PER_HOST = 2;
+
+struct HostQueue
+{
+  std::deque<std::string> images;
+  unsigned int active{0};
+};
+} // namespace
+
+namespace IMAGE_FILES
+{
+std::optional<IMAGE_FILES::CImageCachePrecacher> CImageCachePrecacher::Create()
+{
+  auto result = CImageCachePrecacher();
+  if (result.m_valid)
+    return result;
+  return {};
+}
+
+CImageCachePrecacher::CImageCachePrecacher() : m_textureDB(std::make_unique<CTextureDatabase>())
+{
+  bool valid = true;
+  if (!m_textureDB->Open())
+  {
+    valid = false;
+    CLog::LogF(LOGWARNING, "failed to initialize image cache precacher: failed to open texture DB");
+  }
+
+  m_videoDB = std::make_unique<CVideoDatabase>();
+  if (!m_videoDB->Open())
+  {
+    valid = false;
+    CLog::LogF(LOGWARNING, "failed to initialize image cache precacher: failed to open video DB");
+  }
+
+  m_musicDB = std::make_unique<CMusicDatabase>();
+  if (!m_musicDB->Open())
+  {
+    valid = false;
+    CLog::LogF(LOGWARNING, "failed to initialize image cache precacher: failed to open music DB");
+  }
+  m_valid = valid;
+}
+
+CImageCachePrecacher::~CImageCachePrecacher()
+{
+  if (m_musicDB)
+    m_musicDB->Close();
+  if (m_videoDB)
+    m_videoDB->Close();
+  if (m_textureDB)
+    m_textureDB->Close();
+}
+
+std::vector<std::string> CImageCachePrecacher::GetUncachedImages() const
+{
+  auto images = m_videoDB->GetArtURLs();
+  auto musicImages = m_musicDB->GetArtURLs();
+  images.insert(images.end(), std::make_move_iterator(musicImages.begin()),
+                std::make_move_iterator(musicImages.end()));
+
+  const auto cachedImages = m_textureDB->GetCachedImages();
+  std::unordered_set<std::string> skip(cachedImages.begin(), cachedImages.end());
+
+  std::vector<std::string> result;
+  for (const auto& image : images)
+  {
+    std::string key = ToCacheKey(image);
+    if (!key.empty() && skip.insert(key).second)
+      result.emplace_back(std::move(key));
+  }
+
+  CLog::LogF(LOGDEBUG, "found {} library images, {} of them not cached yet", images.size(),
+             result.size());
+  return result;
+}
+
+PrecacherResult CImageCachePrecacher::CacheImages(std::vector<std::string> images,
+                                                  const ProgressCallback& progress)
+{
+  const unsigned int total = images.size();
+  if (total == 0)
+    return {0, 0};
+
+  std::map<std::string, HostQueue> hosts;
+  for (auto& image : images)
+  {
+    const std::string host = CURL(CImageFileURL(image).GetTargetFile()).GetHostName();
+    hosts[host].images.emplace_back(std::move(image));
+  }
+
+  CCriticalSection section;
+  XbmcThreads::ConditionVariable condition;
+  PrecacherResult result{0, 0};
+  bool stop = false;
+
+  auto worker = [&]()
+  {
+    std::unique_lock lock(section);
+    while (true)
+    {
+      auto next = hosts.end();
+      condition.wait(lock,
+                     [&]()
+                     {
+                       next = std::ranges::find_if(
+                           hosts, [](const auto& host)
+                           { return host.second.active < MAX_REQUESTS_PER_HOST &&
+                                    !host.second.images.empty(); });
+                       return stop || next != hosts.end() ||
+                              std::ranges::all_of(hosts, [](const auto& host)
+                                                  { return host.second.images.empty(); });
+                     });
+      if (stop || next == hosts.end())
+        return;
+
+      HostQueue& queue = next->second;
+      const std::string image = std::move(queue.images.front());
+      queue.images.pop_front();
+      queue.active++;
+
+      lock.unlock();
+      CTextureDetails details;
+      const bool success = CServiceBroker::GetTextureCache()->CacheImage(image, details);
+      lock.lock();
+
+      queue.active--;
+      if (success)
+        result.cachedCount++;
+      else
+        result.failedCount++;
+      if (!progress(result.cachedCount + result.failedCount, total))
+        stop = true;
+      condition.notifyAll();
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (unsigned int i = 0; i < std::min(MAX_WORKERS, total); ++i)
+    workers.emplace_back(worker);
+  for (auto& thread : workers)
+    thread.join();
+
+  CLog::LogF(LOGINFO, "cached {} library images, {} failed{}", result.cachedCount,
+             result.failedCount, stop ? ", stopped before the end" : "");
+  return result;
+}
+} // namespace IMAGE_FILES
@@ -0,0 +1,74 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+class CTextureDatabase;
+class CVideoDatabase;
+class CMusicDatabase;
+
+namespace IMAGE_FILES
+{
+struct PrecacherResult
+{
+  unsigned int cachedCount;
+  unsigned int failedCount;
+};
+
+/*!
+ * @brief Cache the artwork of the media library ahead of browsing it.
+ *
+ * Images already in the texture database are skipped, so an interrupted run picks up where it
+ * stopped the next time.
+ */
+class CImageCachePrecacher
+{
+public:
+  /*!
+   * @brief Called after every image with the number of images done and the total.
+   * @return false to stop caching
+   */
+  using ProgressCallback = std::function<bool(unsigned int done, unsigned int total)>;
+
+  static std::optional<IMAGE_FILES::CImageCachePrecacher> Create();
+  ~CImageCachePrecacher();
+  CImageCachePrecacher(const CImageCachePrecacher&) = delete;
+  CImageCachePrecacher& operator=(const CImageCachePrecacher&) = delete;
+  CImageCachePrecacher(CImageCachePrecacher&&) = default;
+  CImageCachePrecacher& operator=(CImageCachePrecacher&&) = default;
+
+  /*!
+   * @brief Get the library images that are not in the image cache yet.
+   * @return the cache keys of the images
+   */
+  std::vector<std::string> GetUncachedImages() const;
+
+  /*!
+   * @brief Cache the given images on a small pool of threads, with a limit on the parallel
+   * requests to each host.
+   * @param images cache keys of the images
+   * @param progress called after every image
+   */
+  static PrecacherResult CacheImages(std::vector<std::string> images,
+                                     const ProgressCallback& progress);
+
+private:
+  CImageCachePrecacher();
+  bool m_valid;
+
+  std::unique_ptr<CTextureDatabase> m_textureDB;
+  std::unique_ptr<CVideoDatabase> m_videoDB;
+  std::unique_ptr<CMusicDatabase> m_musicDB;
+};
+} // namespace IMAGE_FILES
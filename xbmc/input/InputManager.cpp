@@ -344,6 +344,38 @@ void CInputManager::QueueAction(const CAction& action)
   }
 
   m_queuedActions.push_back(action);
+
+  OnInputReceived(std::chrono::steady_clock::now());
+}
+
+void CInputManager::OnInputReceived(std::chrono::steady_clock::time_point time)
+{
+  std::unique_lock lock(m_inputLatencyMutex);
+  if (m_pendingInputTime == std::chrono::steady_clock::time_point{} || time < m_pendingInputTime)
+    m_pendingInputTime = time;
+}
+
+void CInputManager::OnFramePresented()
+{
+  std::unique_lock lock(m_inputLatencyMutex);
+  if (m_pendingInputTime == std::chrono::steady_clock::time_point{})
+    return;
+
+  const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - m_pendingInputTime);
+  m_pendingInputTime = {};
+
+  // smooth over about 8 inputs, a single late frame shouldn't dominate
+  if (m_inputLatency.count() == 0)
+    m_inputLatency = latency;
+  else
+    m_inputLatency += (latency - m_inputLatency) / 8;
+}
+
+std::chrono::microseconds CInputManager::GetInputLatency() const
+{
+  std::unique_lock lock(m_inputLatencyMutex);
+  return m_inputLatency;
 }
 
 void CInputManager::QueueCecKey(const CKey& key)
@@ -462,21 +494,17 @@ bool CInputManager::OnEvent(XBMC_Event& newEvent)
       if ((actionId >= ACTION_TOUCH_TAP && actionId <= ACTION_GESTURE_END) ||
           (actionId >= ACTION_MOUSE_START && actionId <= ACTION_MOUSE_END))
       {
-        auto action =
-            new CAction(actionId, 0, newEvent.touch.x, newEvent.touch.y, newEvent.touch.x2,
-                        newEvent.touch.y2, newEvent.touch.x3, newEvent.touch.y3);
-        CServiceBroker::GetAppMessenger()->PostMsg(TMSG_GUI_ACTION, WINDOW_INVALID, -1,
-                                                   static_cast<void*>(action));
+        // queued instead of posted to the messenger, so it is processed before the gui of this
+        // frame rather than after the next render
+        QueueAction(CAction(actionId, 0, newEvent.touch.x, newEvent.touch.y, newEvent.touch.x2,
+                            newEvent.touch.y2, newEvent.touch.x3, newEvent.touch.y3));
       }
       else
       {
         if (actionId == ACTION_BUILT_IN_FUNCTION && !actionString.empty())
-          CServiceBroker::GetAppMessenger()->PostMsg(
-              TMSG_GUI_ACTION, WINDOW_INVALID, -1,
-              static_cast<void*>(new CAction(actionId, actionString)));
+          QueueAction(CAction(actionId, actionString));
         else
-          CServiceBroker::GetAppMessenger()->PostMsg(TMSG_GUI_ACTION, WINDOW_INVALID, -1,
-                                                     static_cast<void*>(new CAction(actionId)));
+          QueueAction(CAction(actionId));
       }
 
       break;
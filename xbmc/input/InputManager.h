@@ -19,6 +19,7 @@
 #include "utils/Observer.h"
 #include "windowing/XBMC_events.h"
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -225,6 +226,22 @@ public:
    */
   void QueueAction(const CAction& action);
 
+  /*!
+   * \brief Note the arrival of input, the time until the next frame is presented is measured
+   * \param time when the input arrived from the window system or the input device
+   */
+  void OnInputReceived(std::chrono::steady_clock::time_point time);
+
+  /*!
+   * \brief Called after a frame has been handed to the display
+   */
+  void OnFramePresented();
+
+  /*!
+   * \brief Average time from the arrival of input to the presentation of the next frame
+   */
+  std::chrono::microseconds GetInputLatency() const;
+
   /*!
    * \brief Process CEC input
    */
@@ -307,6 +324,11 @@ private:
 
   std::vector<CKey> m_queuedCecKeys;
   CCriticalSection m_cecKeyMutex;
+
+  // The oldest input not presented yet and the smoothed input to present latency
+  std::chrono::steady_clock::time_point m_pendingInputTime;
+  std::chrono::microseconds m_inputLatency{0};
+  mutable CCriticalSection m_inputLatencyMutex;
   CCriticalSection m_cecHandlingMutex;
 
   // Button translation
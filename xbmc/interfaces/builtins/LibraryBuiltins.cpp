@@ -11,6 +11,7 @@
 #include "GUIUserMessages.h"
 #include "MediaSource.h"
 #include "ServiceBroker.h"
+#include "TextureCache.h"
 #include "dialogs/GUIDialogFileBrowser.h"
 #include "dialogs/GUIDialogYesNo.h"
 #include "guilib/GUIComponent.h"
@@ -390,6 +391,17 @@ static int RefreshAlbum(const std::vector<std::string>& params)
   return 0;
 }
 
+/*! \brief Cache all artwork of the media library in the background.
+ *  \param params The parameters.
+ *  \details params[0] = "true" to hide the progress bar (optional).
+ */
+static int PrecacheImages(const std::vector<std::string>& params)
+{
+  const bool silent = !params.empty() && StringUtils::EqualsNoCase(params[0], "true");
+  CServiceBroker::GetTextureCache()->PrecacheAllLibraryImages(!silent);
+  return 0;
+}
+
 // Note: For new Texts with comma add a "\" before!!! Is used for table text.
 //
 /// \page page_List_of_built_in_functions
@@ -436,6 +448,12 @@ static int RefreshAlbum(const std::vector<std::string>& params)
 ///     @param[in] actorthumbs           Add "actorthumbs" to include other actor thumbs.
 ///   }
 ///   \table_row2_l{
+///     <b>`precacheimages([silent])`</b>
+///     ,
+///     Cache all artwork of the video and music library in the background
+///     @param[in] silent                Add "true" to hide the progress bar (optional).
+///   }
+///   \table_row2_l{
 ///     <b>`updatelibrary([type\, suppressDialogs])`</b>
 ///     ,
 ///     Update the selected library (music or video)
@@ -467,6 +485,8 @@ CBuiltins::CommandMap CLibraryBuiltins::GetOperations() const
   return {{"cleanlibrary", {"Clean the video/music library", 1, CleanLibrary}},
           {"exportlibrary", {"Export the video/music library", 1, ExportLibrary}},
           {"exportlibrary2", {"Export the video/music library", 1, ExportLibrary2}},
+          {"precacheimages",
+           {"Cache all artwork of the video and music library", 0, PrecacheImages}},
           {"updatelibrary", {"Update the selected library (music or video)", 1, UpdateLibrary}},
           {"videolibrary.search",
            {"Brings up a search dialog which will search the library", 0, SearchVideoLibrary}},
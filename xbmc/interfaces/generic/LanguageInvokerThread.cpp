@@ -9,7 +9,9 @@
 #include "LanguageInvokerThread.h"
 
 #include "ScriptInvocationManager.h"
+#include "utils/log.h"
 
+#include <chrono>
 #include <utility>
 
 CLanguageInvokerThread::CLanguageInvokerThread(std::shared_ptr<ILanguageInvoker> invoker,
@@ -101,11 +103,19 @@ void CLanguageInvokerThread::Process()
     return;
 
   std::unique_lock<std::mutex> lckdl(m_mutex);
+  bool reused = false;
   do
   {
     m_restart = false;
+    const auto start = std::chrono::steady_clock::now();
     m_invoker->Execute(m_script, m_args);
 
+    const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    CLog::Log(LOGDEBUG, "CLanguageInvokerThread({}): {} ran in {} ms with a {} invoker", GetId(),
+              m_script, duration.count(), reused ? "reused" : "new");
+    reused = true;
+
     if (m_invoker->GetState() != InvokerStateScriptDone)
       m_reusable = false;
 
@@ -25,6 +25,12 @@
 #include <utility>
 #include <vector>
 
+namespace
+{
+// Number of add-ons whose invoker (e.g. Python interpreter) is kept warm between runs
+constexpr size_t MAX_REUSABLE_INVOKERS = 3;
+} // unnamed namespace
+
 CScriptInvocationManager::~CScriptInvocationManager()
 {
   Uninitialize();
@@ -64,7 +70,7 @@ void CScriptInvocationManager::Uninitialize()
   Process();
 
   // it is safe to release early, thread must be in m_scripts too
-  m_lastInvokerThread = nullptr;
+  m_reusableInvokerThreads.clear();
 
   // make sure all scripts are done
   std::vector<LanguageInvokerThread> tempList;
@@ -161,14 +167,12 @@ int CScriptInvocationManager::GetReusablePluginHandle(const std::string& script)
 {
   std::unique_lock lock(m_critSection);
 
-  if (m_lastInvokerThread)
-  {
-    if (m_lastInvokerThread->Reuseable(script))
-      return m_lastPluginHandle;
-    m_lastInvokerThread->Release();
-    m_lastInvokerThread = nullptr;
-  }
-  return -1;
+  const auto it = std::ranges::find_if(m_reusableInvokerThreads, [&script](const auto& reusable)
+                                       { return reusable.thread->Reuseable(script); });
+  if (it == m_reusableInvokerThreads.end())
+    return -1;
+
+  return it->pluginHandle;
 }
 
 std::shared_ptr<ILanguageInvoker> CScriptInvocationManager::GetLanguageInvoker(
@@ -176,17 +180,18 @@ std::shared_ptr<ILanguageInvoker> CScriptInvocationManager::GetLanguageInvoker(
 {
   std::unique_lock lock(m_critSection);
 
-  if (m_lastInvokerThread)
+  const auto reusable =
+      std::ranges::find_if(m_reusableInvokerThreads, [&script](const auto& reusable)
+                           { return reusable.thread->Reuseable(script); });
+  if (reusable != m_reusableInvokerThreads.end())
   {
-    if (m_lastInvokerThread->Reuseable(script))
-    {
-      CLog::Log(LOGDEBUG, "{} - Reusing LanguageInvokerThread {} for script {}", __FUNCTION__,
-                m_lastInvokerThread->GetId(), script);
-      m_lastInvokerThread->GetInvoker()->Reset();
-      return m_lastInvokerThread->GetInvoker();
-    }
-    m_lastInvokerThread->Release();
-    m_lastInvokerThread = nullptr;
+    CLog::Log(LOGDEBUG, "{} - Reusing LanguageInvokerThread {} for script {}", __FUNCTION__,
+              reusable->thread->GetId(), script);
+    m_reusableInvokerThreads.splice(m_reusableInvokerThreads.begin(), m_reusableInvokerThreads,
+                                    reusable);
+    // no longer reusable by anybody else until it ran the script again
+    reusable->thread->GetInvoker()->Reset();
+    return reusable->thread->GetInvoker();
   }
 
   std::string extension = URIUtils::GetExtension(script);
@@ -238,34 +243,45 @@ int CScriptInvocationManager::ExecuteAsync(
 
   std::unique_lock lock(m_critSection);
 
-  if (m_lastInvokerThread && m_lastInvokerThread->GetInvoker() == languageInvoker)
+  const auto reusable =
+      std::ranges::find_if(m_reusableInvokerThreads, [&languageInvoker](const auto& reusable)
+                           { return reusable.thread->GetInvoker() == languageInvoker; });
+  if (reusable != m_reusableInvokerThreads.end())
   {
     if (addon != nullptr)
-      m_lastInvokerThread->SetAddon(addon);
+      reusable->thread->SetAddon(addon);
 
-    // After we leave the lock, m_lastInvokerThread can be released -> copy!
-    auto invokerThread = m_lastInvokerThread;
+    // After we leave the lock, the reusable invoker can be released -> copy!
+    auto invokerThread = reusable->thread;
     lock.unlock();
     invokerThread->Execute(script, arguments);
 
     return invokerThread->GetId();
   }
 
-  m_lastInvokerThread = std::make_shared<CLanguageInvokerThread>(languageInvoker, this, reuseable);
-  if (m_lastInvokerThread == nullptr)
+  auto invokerThread = std::make_shared<CLanguageInvokerThread>(languageInvoker, this, reuseable);
+  if (invokerThread == nullptr)
     return -1;
 
   if (addon != nullptr)
-    m_lastInvokerThread->SetAddon(addon);
+    invokerThread->SetAddon(addon);
 
-  m_lastInvokerThread->SetId(m_nextId++);
-  m_lastPluginHandle = pluginHandle;
+  invokerThread->SetId(m_nextId++);
 
-  LanguageInvokerThread thread = {m_lastInvokerThread, script, false};
-  m_scripts.insert(std::make_pair(m_lastInvokerThread->GetId(), thread));
-  m_scriptPaths.insert(std::make_pair(script, m_lastInvokerThread->GetId()));
-  // After we leave the lock, m_lastInvokerThread can be released -> copy!
-  auto invokerThread = m_lastInvokerThread;
+  if (reuseable)
+  {
+    m_reusableInvokerThreads.push_front({invokerThread, pluginHandle});
+    if (m_reusableInvokerThreads.size() > MAX_REUSABLE_INVOKERS)
+    {
+      // the least recently used invoker ends once it's idle
+      m_reusableInvokerThreads.back().thread->Release();
+      m_reusableInvokerThreads.pop_back();
+    }
+  }
+
+  LanguageInvokerThread thread = {invokerThread, script, false};
+  m_scripts.insert(std::make_pair(invokerThread->GetId(), thread));
+  m_scriptPaths.insert(std::make_pair(script, invokerThread->GetId()));
   lock.unlock();
   invokerThread->Execute(script, arguments);
 
@@ -391,6 +407,9 @@ void CScriptInvocationManager::OnExecutionDone(int scriptId)
   const auto script = m_scripts.find(scriptId);
   if (script != m_scripts.end())
     script->second.done = true;
+
+  std::erase_if(m_reusableInvokerThreads, [scriptId](const auto& reusable)
+                { return reusable.thread->GetId() == scriptId; });
 }
 
 CScriptInvocationManager::LanguageInvokerThread CScriptInvocationManager::getInvokerThread(int scriptId) const
@@ -12,6 +12,7 @@
 #include "interfaces/generic/ILanguageInvoker.h"
 #include "threads/CriticalSection.h"
 
+#include <list>
 #include <map>
 #include <memory>
 #include <set>
@@ -34,7 +35,7 @@ public:
   std::shared_ptr<ILanguageInvoker> GetLanguageInvoker(const std::string& script);
 
   /*!
-  * \brief Returns addon_handle if last reusable invoker is ready to use.
+  * \brief Returns addon_handle if a reusable invoker of the script is ready to use.
   */
   int GetReusablePluginHandle(const std::string& script);
 
@@ -143,12 +144,18 @@ private:
   using LanguageInvokerThreadMap = std::map<int, LanguageInvokerThread>;
   using LanguageInvocationHandlerMap = std::map<std::string, ILanguageInvocationHandler*>;
 
+  struct ReusableInvokerThread
+  {
+    std::shared_ptr<CLanguageInvokerThread> thread;
+    int pluginHandle;
+  };
+
   LanguageInvokerThread getInvokerThread(int scriptId) const;
 
   LanguageInvocationHandlerMap m_invocationHandlers;
   LanguageInvokerThreadMap m_scripts;
-  std::shared_ptr<CLanguageInvokerThread> m_lastInvokerThread;
-  int m_lastPluginHandle = -1;
+  // Invokers kept warm for the add-ons that reuse them, the most recently used first
+  std::list<ReusableInvokerThread> m_reusableInvokerThreads;
 
   std::map<std::string, int> m_scriptPaths;
   int m_nextId = 0;
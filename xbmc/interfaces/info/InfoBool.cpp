@@ -12,8 +12,8 @@
 
 namespace INFO
 {
-InfoBool::InfoBool(const std::string& expression, int context, unsigned int& refreshCounter)
-  : m_context(context), m_expression(expression), m_parentRefreshCounter(refreshCounter)
+InfoBool::InfoBool(const std::string& expression, int context, InfoBoolCounters& counters)
+  : m_context(context), m_expression(expression), m_counters(counters)
 {
   StringUtils::ToLower(m_expression);
 }
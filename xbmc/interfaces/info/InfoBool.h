@@ -16,6 +16,17 @@ class CGUIInfoManager;
 
 namespace INFO
 {
+/*!
+ \ingroup info
+ \brief Counters shared by all the info bools of an info manager
+ */
+struct InfoBoolCounters
+{
+  unsigned int refresh = 0; ///< bumped every frame, marks all values dirty
+  unsigned int change = 1; ///< bumped when a change notified source (e.g. skin settings) changed
+  unsigned int evaluations = 0; ///< values updated since the last frame
+};
+
 /*!
  \ingroup info
  \brief Base class, wrapping boolean conditions and expressions
@@ -23,7 +34,7 @@ namespace INFO
 class InfoBool
 {
 public:
-  InfoBool(const std::string &expression, int context, unsigned int &refreshCounter);
+  InfoBool(const std::string& expression, int context, InfoBoolCounters& counters);
   virtual ~InfoBool() = default;
 
   virtual void Initialize(CGUIInfoManager* infoMgr) { m_infoMgr = infoMgr; }
@@ -36,11 +47,25 @@ public:
   inline bool Get(int contextWindow, const CGUIListItem* item = nullptr)
   {
     if (item && m_listItemDependent)
+    {
       Update(contextWindow, item);
-    else if (m_refreshCounter != m_parentRefreshCounter || m_refreshCounter == 0)
+      m_counters.evaluations++;
+    }
+    else if (m_changeNotified)
+    {
+      // the sources of this value tell us when they change, no need to refresh every frame
+      if (m_changeCounter != m_counters.change)
+      {
+        Update(contextWindow, nullptr);
+        m_changeCounter = m_counters.change;
+        m_counters.evaluations++;
+      }
+    }
+    else if (m_refreshCounter != m_counters.refresh || m_refreshCounter == 0)
     {
       Update(contextWindow, nullptr);
-      m_refreshCounter = m_parentRefreshCounter;
+      m_refreshCounter = m_counters.refresh;
+      m_counters.evaluations++;
     }
     return m_value;
   }
@@ -68,16 +93,19 @@ public:
 
   const std::string &GetExpression() const { return m_expression; }
   bool ListItemDependent() const { return m_listItemDependent; }
+  bool ChangeNotified() const { return m_changeNotified; }
 protected:
   bool m_value = false; ///< current value
   int m_context;               ///< contextual information to go with the condition
   bool m_listItemDependent = false; ///< do not cache if a listitem pointer is given
+  bool m_changeNotified = false; ///< only depends on sources which notify the info manager of changes
   std::string  m_expression;   ///< original expression
   CGUIInfoManager* m_infoMgr;
 
 private:
   unsigned int m_refreshCounter = 0;
-  unsigned int &m_parentRefreshCounter;
+  unsigned int m_changeCounter = 0;
+  InfoBoolCounters& m_counters;
 };
 
 typedef std::shared_ptr<InfoBool> InfoPtr;
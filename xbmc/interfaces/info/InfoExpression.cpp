@@ -11,16 +11,24 @@
 #include "GUIInfoManager.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <list>
 #include <memory>
 #include <stack>
 
 using namespace INFO;
 
+namespace
+{
+constexpr int RESULT_TRUE = -1;
+constexpr int RESULT_FALSE = -2;
+} // namespace
+
 void InfoSingle::Initialize(CGUIInfoManager* infoMgr)
 {
   InfoBool::Initialize(infoMgr);
   m_condition = m_infoMgr->TranslateSingleString(m_expression, m_listItemDependent);
+  m_changeNotified = !m_listItemDependent && m_infoMgr->IsChangeNotified(m_condition);
 }
 
 void InfoSingle::Update(int contextWindow, const CGUIListItem* item)
@@ -37,8 +45,11 @@ void InfoExpression::Initialize(CGUIInfoManager* infoMgr)
   if (!Parse(m_expression))
   {
     CLog::Log(LOGERROR, "Error parsing boolean expression {}", m_expression);
-    m_expression_tree = std::make_shared<InfoLeaf>(m_infoMgr->Register("false", 0), false);
+    Link(std::make_shared<InfoLeaf>(m_infoMgr->Register("false", 0), false));
   }
+  m_changeNotified = !m_listItemDependent &&
+                     std::ranges::all_of(m_program, [](const auto& instruction)
+                                         { return instruction.info->ChangeNotified(); });
 }
 
 void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
@@ -46,32 +57,34 @@ void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
   // use propagated context in case this info expression has the default context (i.e. if not tied to a specific window)
   // its value might depend on the context in which the evaluation was called
   int context = m_context == DEFAULT_CONTEXT ? contextWindow : m_context;
-  m_value = m_expression_tree->Evaluate(context, item);
+  int next = 0;
+  while (next >= 0)
+  {
+    const Instruction& instruction = m_program[next];
+    next = (instruction.invert ^ instruction.info->Get(context, item)) ? instruction.onTrue
+                                                                        : instruction.onFalse;
+  }
+  m_value = next == RESULT_TRUE;
 }
 
 /* Expressions are rewritten at parse time into a form which favours the
- * formation of groups of associative nodes. These groups are then reordered at
- * evaluation time such that nodes whose value renders the evaluation of the
- * remainder of the group unnecessary tend to be evaluated first (these are
- * true nodes for OR subexpressions, or false nodes for AND subexpressions).
- * The end effect is to minimise the number of leaf nodes that need to be
- * evaluated in order to determine the value of the expression. The runtime
- * adaptability has the advantage of not being customised for any particular skin.
+ * formation of groups of associative nodes, and then compiled into a flat
+ * list of leaves with a jump target for either value of each leaf. The
+ * evaluation only visits the leaves needed to determine the value of the
+ * expression, without walking the tree.
  *
  * The modifications to the expression at parse time fall into two groups:
  * 1) Moving logical NOTs so that they are only applied to leaf nodes.
- *    For example, rewriting ![A+B]|C as !A|!B|C allows reordering such that
- *    any of the three leaves can be evaluated first.
+ *    For example, rewriting ![A+B]|C as !A|!B|C, so every leaf can jump
+ *    straight to the result.
  * 2) Combining adjacent AND or OR operations such that each path from the root
  *    to a leaf encounters a strictly alternating pattern of AND and OR
  *    operations. So [A|B]|[C|D+[[E|F]|G] becomes A|B|C|[D+[E|F|G]].
+ *
+ * Leaves are registered with the info manager, so the same condition used by
+ * several expressions (or windows) is only evaluated once per frame.
  */
 
-bool InfoExpression::InfoLeaf::Evaluate(int contextWindow, const CGUIListItem* item)
-{
-  return m_invert ^ m_info->Get(contextWindow, item);
-}
-
 InfoExpression::InfoAssociativeGroup::InfoAssociativeGroup(
     node_type_t type,
     const InfoSubexpressionPtr &left,
@@ -92,27 +105,49 @@ void InfoExpression::InfoAssociativeGroup::Merge(const std::shared_ptr<InfoAssoc
   m_children.splice(m_children.end(), other->m_children);
 }
 
-bool InfoExpression::InfoAssociativeGroup::Evaluate(int contextWindow, const CGUIListItem* item)
+/* Leaves are compiled from the last to the first, so the jump targets of a
+ * leaf are known when it is emitted: in an AND group a true child continues
+ * with the next child and a false child ends the group, an OR group is the
+ * other way round. The list is reversed at the end so it starts with the
+ * first leaf and only jumps forward.
+ */
+int InfoExpression::Compile(const InfoSubexpressionPtr& node, int onTrue, int onFalse)
 {
-  /* Handle either AND or OR by using the relation
-   * A AND B == !(!A OR !B)
-   * to convert ANDs into ORs
-   */
-  std::list<InfoSubexpressionPtr>::iterator last = m_children.end();
-  std::list<InfoSubexpressionPtr>::iterator it = m_children.begin();
-  bool use_and = (m_type == NODE_AND);
-  bool result = use_and ^ (*it)->Evaluate(contextWindow, item);
-  while (!result && ++it != last)
+  if (node->Type() == NODE_LEAF)
   {
-    result = use_and ^ (*it)->Evaluate(contextWindow, item);
-    if (result)
-    {
-      /* Move this child to the head of the list so we evaluate faster next time */
-      m_children.push_front(*it);
-      m_children.erase(it);
-    }
+    const auto& leaf = std::static_pointer_cast<InfoLeaf>(node);
+    m_program.push_back({leaf->Info(), leaf->Invert(), onTrue, onFalse});
+    return static_cast<int>(m_program.size()) - 1;
+  }
+
+  const auto& children = std::static_pointer_cast<InfoAssociativeGroup>(node)->Children();
+  int next = -1;
+  for (auto it = children.rbegin(); it != children.rend(); ++it)
+  {
+    if (it == children.rbegin())
+      next = Compile(*it, onTrue, onFalse);
+    else if (node->Type() == NODE_AND)
+      next = Compile(*it, next, onFalse);
+    else
+      next = Compile(*it, onTrue, next);
+  }
+  return next;
+}
+
+void InfoExpression::Link(const InfoSubexpressionPtr& tree)
+{
+  m_program.clear();
+  Compile(tree, RESULT_TRUE, RESULT_FALSE);
+
+  std::ranges::reverse(m_program);
+  const int last = static_cast<int>(m_program.size()) - 1;
+  for (auto& instruction : m_program)
+  {
+    if (instruction.onTrue >= 0)
+      instruction.onTrue = last - instruction.onTrue;
+    if (instruction.onFalse >= 0)
+      instruction.onFalse = last - instruction.onFalse;
   }
-  return use_and ^ result;
 }
 
 /* Expressions are parsed using the shunting-yard algorithm. Binary operators
@@ -303,6 +338,6 @@ bool InfoExpression::Parse(const std::string &expression)
   while (!operator_stack.empty())
     OperatorPop(operator_stack, invert, nodes);
 
-  m_expression_tree = nodes.top();
+  Link(nodes.top());
   return true;
 }
@@ -24,8 +24,8 @@ namespace INFO
 class InfoSingle : public InfoBool
 {
 public:
-  InfoSingle(const std::string& expression, int context, unsigned int& refreshCounter)
-    : InfoBool(expression, context, refreshCounter)
+  InfoSingle(const std::string& expression, int context, InfoBoolCounters& counters)
+    : InfoBool(expression, context, counters)
   {
   }
   void Initialize(CGUIInfoManager* infoMgr) override;
@@ -41,8 +41,8 @@ private:
 class InfoExpression : public InfoBool
 {
 public:
-  InfoExpression(const std::string& expression, int context, unsigned int& refreshCounter)
-    : InfoBool(expression, context, refreshCounter)
+  InfoExpression(const std::string& expression, int context, InfoBoolCounters& counters)
+    : InfoBool(expression, context, counters)
   {
   }
   ~InfoExpression() override = default;
@@ -69,12 +69,11 @@ private:
     NODE_OR,
   } node_type_t;
 
-  // An abstract base class for nodes in the expression tree
+  // An abstract base class for nodes in the expression tree, which is only used while parsing
   class InfoSubexpression
   {
   public:
     virtual ~InfoSubexpression(void) = default; // so we can destruct derived classes using a pointer to their base class
-    virtual bool Evaluate(int contextWindow, const CGUIListItem* item) = 0;
     virtual node_type_t Type() const=0;
   };
 
@@ -85,8 +84,9 @@ private:
   {
   public:
     InfoLeaf(InfoPtr info, bool invert) : m_info(std::move(info)), m_invert(invert) {}
-    bool Evaluate(int contextWindow, const CGUIListItem* item) override;
     node_type_t Type() const override { return NODE_LEAF; }
+    const InfoPtr& Info() const { return m_info; }
+    bool Invert() const { return m_invert; }
 
   private:
     InfoPtr m_info;
@@ -100,8 +100,8 @@ private:
     InfoAssociativeGroup(node_type_t type, const InfoSubexpressionPtr &left, const InfoSubexpressionPtr &right);
     void AddChild(const InfoSubexpressionPtr &child);
     void Merge(const std::shared_ptr<InfoAssociativeGroup>& other);
-    bool Evaluate(int contextWindow, const CGUIListItem* item) override;
     node_type_t Type() const override { return m_type; }
+    const std::list<InfoSubexpressionPtr>& Children() const { return m_children; }
 
   private:
     node_type_t m_type;
@@ -111,7 +111,19 @@ private:
   static operator_t GetOperator(char ch);
   static void OperatorPop(std::stack<operator_t> &operator_stack, bool &invert, std::stack<InfoSubexpressionPtr> &nodes);
   bool Parse(const std::string &expression);
-  InfoSubexpressionPtr m_expression_tree;
+  int Compile(const InfoSubexpressionPtr& node, int onTrue, int onFalse);
+  void Link(const InfoSubexpressionPtr& tree);
+
+  // One leaf of the compiled expression. Evaluation starts at the first instruction and
+  // follows onTrue or onFalse until it reaches RESULT_TRUE or RESULT_FALSE.
+  struct Instruction
+  {
+    InfoPtr info;
+    bool invert;
+    int onTrue;
+    int onFalse;
+  };
+  std::vector<Instruction> m_program;
 };
 
 };
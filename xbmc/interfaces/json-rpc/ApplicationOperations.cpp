@@ -17,6 +17,9 @@
 #include "input/actions/Action.h"
 #include "input/actions/ActionIDs.h"
 #include "messaging/ApplicationMessenger.h"
+#include "threads/ThreadRegistry.h"
+#include "utils/MemUtils.h"
+#include "utils/MemoryPressure.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 
@@ -109,6 +112,84 @@ JSONRPC_STATUS CApplicationOperations::Quit(const std::string &method, ITranspor
   return ACK;
 }
 
+JSONRPC_STATUS CApplicationOperations::GetMemoryUsage(const std::string& method,
+                                                      ITransportLayer* transport,
+                                                      IClient* client,
+                                                      const CVariant& parameterObject,
+                                                      CVariant& result)
+{
+  KODI::MEMORY::MemoryStatus status{};
+  KODI::MEMORY::GetMemoryStatus(&status);
+  result["system"]["total"] = status.totalPhys;
+  result["system"]["available"] = status.availPhys;
+  result["system"]["load"] = status.memoryLoad;
+
+  result["pressure"] = "none";
+  result["caches"] = CVariant(CVariant::VariantTypeArray);
+  const auto memoryPressure = CServiceBroker::GetMemoryPressureManager();
+  if (!memoryPressure)
+    return OK;
+
+  switch (memoryPressure->GetLastPressure())
+  {
+    case MemoryPressure::MODERATE:
+      result["pressure"] = "moderate";
+      break;
+    case MemoryPressure::CRITICAL:
+      result["pressure"] = "critical";
+      break;
+    default:
+      break;
+  }
+
+  for (const auto& cache : memoryPressure->GetUsage())
+  {
+    CVariant usage(CVariant::VariantTypeObject);
+    usage["name"] = cache.name;
+    usage["priority"] = cache.priority;
+    usage["bytes"] = cache.usage.bytes;
+    usage["items"] = cache.usage.items;
+    result["caches"].push_back(usage);
+  }
+
+  return OK;
+}
+
+JSONRPC_STATUS CApplicationOperations::GetThreadUsage(const std::string& method,
+                                                      ITransportLayer* transport,
+                                                      IClient* client,
+                                                      const CVariant& parameterObject,
+                                                      CVariant& result)
+{
+  const auto toVariant = [](const CThreadRegistry::ThreadInfo& info)
+  {
+    CVariant usage(CVariant::VariantTypeObject);
+    usage["name"] = info.name;
+    usage["subsystem"] = info.subsystem;
+    usage["cputime"] =
+        std::chrono::duration_cast<std::chrono::milliseconds>(info.usage.cpuTime).count();
+    usage["cpu"] = info.cpuPercent;
+    usage["wakeups"] = info.usage.wakeups;
+    usage["wakeupspersecond"] = info.wakeupsPerSecond;
+    return usage;
+  };
+
+  const auto threads = CThreadRegistry::Sample();
+  result["threads"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& thread : threads)
+    result["threads"].push_back(toVariant(thread));
+
+  result["subsystems"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& subsystem : CThreadRegistry::BySubsystem(threads))
+  {
+    CVariant usage = toVariant(subsystem);
+    usage.erase("subsystem");
+    result["subsystems"].push_back(usage);
+  }
+
+  return OK;
+}
+
 JSONRPC_STATUS CApplicationOperations::GetPropertyValue(const std::string &property, CVariant &result)
 {
   if (property == "volume" || property == "muted")
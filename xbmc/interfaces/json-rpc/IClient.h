@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 namespace JSONRPC
 {
   class IClient
@@ -17,5 +20,14 @@ namespace JSONRPC
     virtual int GetPermissionFlags() = 0;
     virtual int GetAnnouncementFlags() = 0;
     virtual bool SetAnnouncementFlags(int flags) = 0;
+
+    /*!
+     \brief Limit the notifications of the enabled announcement flags to the given methods
+     \param methods names like "VideoLibrary.OnScanFinished", "Player.*" matches a whole
+     namespace and an empty list doesn't limit the notifications
+     \return false if the client doesn't support subscriptions
+     */
+    virtual bool SetSubscriptions(const std::vector<std::string>& methods) { return false; }
+    virtual std::vector<std::string> GetSubscriptions() { return {}; }
   };
 }
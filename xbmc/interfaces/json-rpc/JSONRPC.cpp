@@ -24,14 +24,20 @@
 #include "input/WindowTranslator.h"
 #include "input/actions/ActionTranslator.h"
 #include "interfaces/AnnouncementManager.h"
+#include "jobs/JobManager.h"
 #include "playlists/SmartPlayList.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
+#include <memory>
 #include <string.h>
+#include <vector>
 
 using namespace KODI;
 using namespace JSONRPC;
@@ -176,16 +182,22 @@ JSONRPC_STATUS CJSONRPC::GetConfiguration(const std::string &method, ITransportL
   for (int i = 1; i <= ANNOUNCEMENT::ANNOUNCE_ALL; i *= 2)
     result["notifications"][AnnouncementFlagToString((ANNOUNCEMENT::AnnouncementFlag)i)] = (flags & i) == i;
 
+  result["subscriptions"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& subscription : client->GetSubscriptions())
+    result["subscriptions"].push_back(subscription);
+
   return OK;
 }
 
 JSONRPC_STATUS CJSONRPC::SetConfiguration(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant& parameterObject, CVariant &result)
 {
-  int flags = 0;
   int oldFlags = client->GetAnnouncementFlags();
+  // without notifications only the subscriptions are changed
+  int flags = oldFlags;
 
   if (parameterObject.isMember("notifications"))
   {
+    flags = 0;
     CVariant notifications = parameterObject["notifications"];
     if ((notifications["Player"].isNull() && (oldFlags & ANNOUNCEMENT::Player)) ||
         (notifications["Player"].isBoolean() && notifications["Player"].asBoolean()))
@@ -219,6 +231,17 @@ JSONRPC_STATUS CJSONRPC::SetConfiguration(const std::string &method, ITransportL
   if (!client->SetAnnouncementFlags(flags))
     return BadPermission;
 
+  if (parameterObject["subscriptions"].isArray())
+  {
+    std::vector<std::string> subscriptions;
+    for (CVariant::const_iterator_array itr = parameterObject["subscriptions"].begin_array();
+         itr != parameterObject["subscriptions"].end_array(); ++itr)
+      subscriptions.push_back(itr->asString());
+
+    if (!client->SetSubscriptions(subscriptions))
+      return BadPermission;
+  }
+
   return GetConfiguration(method, transport, client, parameterObject, result);
 }
 
@@ -257,18 +280,7 @@ std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer
         hasResponse = true;
       }
       else
-      {
-        for (CVariant::const_iterator_array itr = inputroot.begin_array();
-             itr != inputroot.end_array(); ++itr)
-        {
-          CVariant response;
-          if (HandleMethodCall(*itr, response, transport, client))
-          {
-            outputroot.append(response);
-            hasResponse = true;
-          }
-        }
-      }
+        hasResponse = HandleBatchCall(inputroot, outputroot, transport, client);
     }
     else
       hasResponse = HandleMethodCall(inputroot, outputroot, transport, client);
@@ -287,6 +299,123 @@ std::string CJSONRPC::MethodCall(const std::string &inputString, ITransportLayer
   return str;
 }
 
+namespace
+{
+constexpr size_t MAX_BATCH_WORKERS = 8;
+
+// consecutive read-only calls of a batch, shared with the jobs helping to execute them
+struct ReadOnlyCalls
+{
+  std::vector<const CVariant*> requests;
+  std::vector<CVariant> responses;
+  std::vector<char> hasResponses;
+  ITransportLayer* transport{nullptr};
+  IClient* client{nullptr};
+
+  CCriticalSection section;
+  CEvent callDone;
+  size_t next{0};
+  size_t running{0};
+};
+
+bool IsReadOnlyCall(const CVariant& request)
+{
+  if (!request.isObject() || !request["method"].isString())
+    return false;
+
+  std::string methodName = request["method"].asString();
+  StringUtils::ToLower(methodName);
+  return CJSONServiceDescription::IsReadOnly(methodName);
+}
+} // unnamed namespace
+
+bool CJSONRPC::HandleBatchCall(const CVariant& requests, CVariant& responses, ITransportLayer *transport, IClient *client)
+{
+  bool hasResponse = false;
+  auto addResponse = [&](const CVariant& response)
+  {
+    responses.append(response);
+    hasResponse = true;
+  };
+
+  for (unsigned int index = 0; index < requests.size();)
+  {
+    // calls changing something keep their place, only the read-only calls in between them run
+    // side by side
+    unsigned int end = index;
+    while (end < requests.size() && IsReadOnlyCall(requests[end]))
+      end++;
+
+    if (end - index < 2)
+    {
+      CVariant response;
+      if (HandleMethodCall(requests[index], response, transport, client))
+        addResponse(response);
+      index++;
+      continue;
+    }
+
+    auto calls = std::make_shared<ReadOnlyCalls>();
+    for (unsigned int call = index; call < end; call++)
+      calls->requests.push_back(&requests[call]);
+    calls->responses.resize(calls->requests.size());
+    calls->hasResponses.resize(calls->requests.size(), 0);
+    calls->transport = transport;
+    calls->client = client;
+
+    // a worker executes calls until none is left, the caller is one of them so the batch
+    // completes even if no job gets to run
+    auto work = [](ReadOnlyCalls& calls)
+    {
+      while (true)
+      {
+        size_t call;
+        {
+          std::unique_lock lock(calls.section);
+          if (calls.next >= calls.requests.size())
+            return;
+          call = calls.next++;
+          calls.running++;
+        }
+
+        calls.hasResponses[call] = HandleMethodCall(*calls.requests[call], calls.responses[call],
+                                                    calls.transport, calls.client);
+
+        {
+          std::unique_lock lock(calls.section);
+          calls.running--;
+        }
+        calls.callDone.Set();
+      }
+    };
+
+    const size_t workers = std::min(calls->requests.size(), MAX_BATCH_WORKERS) - 1;
+    for (size_t worker = 0; worker < workers; worker++)
+      CServiceBroker::GetJobManager()->Submit([calls, work] { work(*calls); },
+                                              CJob::PRIORITY_HIGH);
+
+    work(*calls);
+    while (true)
+    {
+      {
+        std::unique_lock lock(calls->section);
+        if (calls->running == 0)
+          break;
+      }
+      calls->callDone.Wait();
+    }
+
+    for (size_t call = 0; call < calls->requests.size(); call++)
+    {
+      if (calls->hasResponses[call])
+        addResponse(calls->responses[call]);
+    }
+    index = end;
+  }
+
+  return hasResponse;
+}
+
 bool CJSONRPC::HandleMethodCall(const CVariant& request, CVariant& response, ITransportLayer *transport, IClient *client)
 {
   JSONRPC_STATUS errorCode = OK;
@@ -31,9 +31,26 @@
 #include "utils/log.h"
 
 #include <memory>
+#include <unordered_set>
 
 using namespace JSONRPC;
 
+namespace
+{
+// Finds out whether the values are distinct strings without
+// comparing every pair of them
+bool AreUniqueStrings(const CVariant& values)
+{
+  std::unordered_set<std::string> strings;
+  for (auto it = values.begin_array(); it != values.end_array(); ++it)
+  {
+    if (!it->isString() || !strings.insert(it->asString()).second)
+      return false;
+  }
+  return true;
+}
+} // unnamed namespace
+
 std::map<std::string, CVariant> CJSONServiceDescription::m_notifications = std::map<std::string, CVariant>();
 CJSONServiceDescription::CJsonRpcMethodMap CJSONServiceDescription::m_actionMap;
 std::map<std::string, JSONSchemaTypeDefinitionPtr> CJSONServiceDescription::m_types = std::map<std::string, JSONSchemaTypeDefinitionPtr>();
@@ -68,6 +85,9 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
   { "Player.Zoom",                                  CPlayerOperations::Zoom },
   { "Player.SetViewMode",                           CPlayerOperations::SetViewMode },
   { "Player.GetViewMode",                           CPlayerOperations::GetViewMode },
+  { "Player.SetFrameTimeline",                      CPlayerOperations::SetFrameTimeline },
+  { "Player.GetFrameTimeline",                      CPlayerOperations::GetFrameTimeline },
+  { "Player.GetAudioEngineStats",                   CPlayerOperations::GetAudioEngineStats },
   { "Player.Rotate",                                CPlayerOperations::Rotate },
 
   { "Player.Open",                                  CPlayerOperations::Open },
@@ -236,6 +256,8 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
   { "Application.SetVolume",                        CApplicationOperations::SetVolume },
   { "Application.SetMute",                          CApplicationOperations::SetMute },
   { "Application.Quit",                             CApplicationOperations::Quit },
+  { "Application.GetMemoryUsage",                   CApplicationOperations::GetMemoryUsage },
+  { "Application.GetThreadUsage",                   CApplicationOperations::GetThreadUsage },
 
 // Favourites operations
   { "Favourites.GetFavourites",                     CFavouritesOperations::GetFavourites },
@@ -243,6 +265,7 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
 
 // Textures operations
   { "Textures.GetTextures",                         CTextureOperations::GetTextures },
+  { "Textures.PrecacheTextures",                    CTextureOperations::PrecacheTextures },
   { "Textures.RemoveTexture",                       CTextureOperations::RemoveTexture },
 
 // Settings operations
@@ -666,9 +689,43 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
                                                CVariant& outputValue,
                                                CVariant& errorData) const
 {
-  if (!name.empty())
-    errorData["name"] = name;
-  SchemaValueTypeToJson(type, errorData["type"]);
+  // The fast paths only accept values, the full validation
+  // is needed anyway to describe what is wrong
+  if (checkKind == CheckKind::Simple)
+  {
+    if (IsType(value, type) && (!value.isNull() || HasType(type, NullValue)))
+    {
+      outputValue = value;
+      return OK;
+    }
+  }
+  else if (checkKind == CheckKind::StringEnum)
+  {
+    if (value.isString() && stringEnums.find(value.asString()) != stringEnums.end())
+    {
+      outputValue = value;
+      return OK;
+    }
+  }
+
+  JSONRPC_STATUS status = CheckValue(value, outputValue, errorData);
+  if (status != OK)
+  {
+    // Only describe the type if a nested definition
+    // (e.g. an extended type) hasn't done so already
+    if (!name.empty() && !errorData.isMember("name"))
+      errorData["name"] = name;
+    if (!errorData.isMember("type"))
+      SchemaValueTypeToJson(type, errorData["type"]);
+  }
+
+  return status;
+}
+
+JSONRPC_STATUS JSONSchemaTypeDefinition::CheckValue(const CVariant& value,
+                                                    CVariant& outputValue,
+                                                    CVariant& errorData) const
+{
   std::string errorMessage;
 
   // Let's check the type of the provided parameter
@@ -846,7 +903,7 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
     }
 
     // If every array element is unique we need to check each one
-    if (uniqueItems)
+    if (uniqueItems && !AreUniqueStrings(outputValue))
     {
       for (unsigned int checkingIndex = 0; checkingIndex < outputValue.size(); checkingIndex++)
       {
@@ -953,12 +1010,17 @@ JSONRPC_STATUS JSONSchemaTypeDefinition::Check(const CVariant& value,
   if (!enums.empty())
   {
     bool valid = false;
-    for (const auto& enumItr : enums)
+    if (!stringEnums.empty())
+      valid = value.isString() && stringEnums.find(value.asString()) != stringEnums.end();
+    else
     {
-      if (enumItr == value)
+      for (const auto& enumItr : enums)
       {
-        valid = true;
-        break;
+        if (enumItr == value)
+        {
+          valid = true;
+          break;
+        }
       }
     }
 
@@ -1253,6 +1315,55 @@ void JSONSchemaTypeDefinition::ResolveReference()
   referencedTypeSet = true;
 }
 
+void JSONSchemaTypeDefinition::Compile()
+{
+  // Guard against cycles like ResolveReference()
+  if (compiled)
+    return;
+
+  compiled = true;
+
+  for (const auto& it : extends)
+    it->Compile();
+  for (const auto& it : unionTypes)
+    it->Compile();
+  for (const auto& it : items)
+    it->Compile();
+  for (const auto& it : additionalItems)
+    it->Compile();
+  for (const auto& it : properties)
+    it.second->Compile();
+
+  if (additionalProperties)
+    additionalProperties->Compile();
+
+  stringEnums.clear();
+  for (const auto& it : enums)
+  {
+    if (!it.isString())
+    {
+      stringEnums.clear();
+      break;
+    }
+    stringEnums.insert(it.asString());
+  }
+
+  checkKind = CheckKind::Full;
+  if (!unionTypes.empty() || !extends.empty() || HasType(type, ArrayValue) ||
+      HasType(type, ObjectValue) || minLength > 0 || maxLength >= 0)
+    return;
+
+  if (!enums.empty())
+  {
+    if (type == StringValue && !stringEnums.empty())
+      checkKind = CheckKind::StringEnum;
+  }
+  else if (minimum == -std::numeric_limits<double>::max() &&
+           maximum == std::numeric_limits<double>::max() && !exclusiveMinimum &&
+           !exclusiveMaximum && divisibleBy == 0)
+    checkKind = CheckKind::Simple;
+}
+
 JSONSchemaTypeDefinition::CJsonSchemaPropertiesMap::CJsonSchemaPropertiesMap() :
    m_propertiesmap(std::map<std::string, JSONSchemaTypeDefinitionPtr>())
 {
@@ -1320,6 +1431,15 @@ bool JsonRpcMethod::Parse(const CVariant &value)
   else
     permission = StringToPermission(value.isMember("permission") ? value["permission"].asString() : "");
 
+  if (value.isMember("readonly") && value["readonly"].isBoolean())
+    readOnly = value["readonly"].asBoolean();
+  else
+  {
+    std::string lowerName = name;
+    StringUtils::ToLower(lowerName);
+    readOnly = permission == ReadData && lowerName.find(".get") != std::string::npos;
+  }
+
   description = GetString(value["description"], "");
 
   // Check whether there are parameters defined
@@ -1450,7 +1570,9 @@ JSONRPC_STATUS JsonRpcMethod::checkParameter(const CVariant& requestParameters,
   if (ParameterExists(requestParameters, type->name, position))
   {
     // Get the parameter
-    CVariant parameterValue = GetParameter(requestParameters, type->name, position);
+    const CVariant& parameterValue = IsValueMember(requestParameters, type->name)
+                                         ? requestParameters[type->name]
+                                         : requestParameters[position];
 
     // Evaluate the type of the parameter
     JSONRPC_STATUS status = type->Check(parameterValue, outputParameters[type->name], errorData["stack"]);
@@ -1480,6 +1602,16 @@ void CJSONServiceDescription::ResolveReferences()
 {
   for (const auto& it : m_types)
     it.second->ResolveReference();
+
+  // All the definitions are complete now so they
+  // can be prepared for validating method calls
+  for (const auto& it : m_types)
+    it.second->Compile();
+  for (auto method = m_actionMap.begin(); method != m_actionMap.end(); ++method)
+  {
+    for (const auto& parameter : method->second.parameters)
+      parameter->Compile();
+  }
 }
 
 void CJSONServiceDescription::Cleanup()
@@ -1980,6 +2112,12 @@ JSONRPC_STATUS CJSONServiceDescription::CheckCall(const char* const method, cons
   return MethodNotFound;
 }
 
+bool CJSONServiceDescription::IsReadOnly(const std::string& method)
+{
+  CJsonRpcMethodMap::JsonRpcMethodIterator iter = m_actionMap.find(method);
+  return iter != m_actionMap.end() && iter->second.readOnly;
+}
+
 JSONSchemaTypeDefinitionPtr CJSONServiceDescription::GetType(const std::string &identification)
 {
   std::map<std::string, JSONSchemaTypeDefinitionPtr>::iterator iter = m_types.find(identification);
@@ -14,6 +14,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace JSONRPC
@@ -41,6 +42,12 @@ namespace JSONRPC
     void Print(bool isParameter, bool isGlobal, bool printDefault, bool printDescriptions, CVariant &output) const;
     void ResolveReference();
 
+    /*!
+     \brief Prepares the fast paths of Check(), the references
+     of the type must have been resolved already
+     */
+    void Compile();
+
     std::string missingReference;
 
     /*!
@@ -211,6 +218,33 @@ namespace JSONRPC
      \brief Type definition for additional properties
      */
     JSONSchemaTypeDefinitionPtr additionalProperties;
+
+    /*!
+     \brief How Check() validates a value (set by Compile())
+     */
+    enum class CheckKind
+    {
+      Full, ///< validation against the whole definition
+      Simple, ///< the value only needs to be of the right type
+      StringEnum ///< the value must be one of stringEnums
+    };
+    CheckKind checkKind = CheckKind::Full;
+
+    /*!
+     \brief Whether Compile() has been called already
+     */
+    bool compiled = false;
+
+    /*!
+     \brief The values of "enum" for lookups in case
+     they are all strings
+     */
+    std::unordered_set<std::string> stringEnums;
+
+  private:
+    JSONRPC_STATUS CheckValue(const CVariant& value,
+                              CVariant& outputValue,
+                              CVariant& errorData) const;
   };
 
   /*!
@@ -251,6 +285,14 @@ namespace JSONRPC
      to execute the method
      */
     OperationPermission permission = ReadData;
+    /*!
+     \brief Whether the method only reads data, so it
+     can be executed concurrently with other calls of
+     a batch. Defaults to Get* methods needing no more
+     than the ReadData permission unless "readonly" is
+     set in the json schema description
+     */
+    bool readOnly = false;
     /*!
      \brief Description of the method
      */
@@ -385,6 +427,13 @@ namespace JSONRPC
      */
     static JSONRPC_STATUS CheckCall(const char* method, const CVariant &requestParameters, ITransportLayer *transport, IClient *client, bool notification, MethodCall &methodCall, CVariant &outputParameters);
 
+    /*!
+     \brief Whether the given method only reads data
+     \param method Lower case name of the method
+     \return True if the method exists and is read-only
+     */
+    static bool IsReadOnly(const std::string& method);
+
     static JSONSchemaTypeDefinitionPtr GetType(const std::string &identification);
 
     static void ResolveReferences();
@@ -23,6 +23,8 @@
 #include "application/ApplicationComponents.h"
 #include "application/ApplicationPlayer.h"
 #include "application/ApplicationPowerHandling.h"
+#include "cores/AudioEngine/Interfaces/AE.h"
+#include "cores/DataCacheCore.h"
 #include "cores/playercorefactory/PlayerCoreFactory.h"
 #include "guilib/GUIComponent.h"
 #include "guilib/GUIWindowManager.h"
@@ -802,6 +804,53 @@ JSONRPC_STATUS CPlayerOperations::GetViewMode(const std::string &method, ITransp
   return OK;
 }
 
+JSONRPC_STATUS CPlayerOperations::SetFrameTimeline(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
+{
+  CServiceBroker::GetDataCacheCore().GetFrameTimeline().Enable(
+      parameterObject["enabled"].asBoolean(),
+      static_cast<size_t>(parameterObject["capacity"].asUnsignedInteger()));
+  return ACK;
+}
+
+JSONRPC_STATUS CPlayerOperations::GetFrameTimeline(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
+{
+  CServiceBroker::GetDataCacheCore().GetFrameTimeline().GetChromeTrace(result);
+  return OK;
+}
+
+JSONRPC_STATUS CPlayerOperations::GetAudioEngineStats(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
+{
+  IAE* ae = CServiceBroker::GetActiveAE();
+  AEPerfStats stats;
+  if (!ae || !ae->GetPerfStats(stats))
+    return FailedToExecute;
+
+  auto timing = [](const AEPerfStats::Timing& timing)
+  {
+    CVariant value(CVariant::VariantTypeObject);
+    value["count"] = timing.count;
+    value["totaltime"] = timing.totalMs;
+    value["maxtime"] = timing.maxMs;
+    return value;
+  };
+
+  result["underruns"] = stats.underruns;
+  result["resample"] = timing(stats.resample);
+  result["mix"] = timing(stats.mix);
+  result["sinkwrite"] = timing(stats.sinkWrite);
+  result["sinkdelay"] = stats.sinkDelay;
+  result["streams"] = CVariant(CVariant::VariantTypeArray);
+  for (const auto& stream : stats.streams)
+  {
+    CVariant value(CVariant::VariantTypeObject);
+    value["id"] = stream.id;
+    value["bufferedtime"] = stream.bufferedTime;
+    value["resampleratio"] = stream.resampleRatio;
+    result["streams"].push_back(value);
+  }
+  return OK;
+}
+
 JSONRPC_STATUS CPlayerOperations::Rotate(const std::string &method, ITransportLayer *transport, IClient *client, const CVariant &parameterObject, CVariant &result)
 {
   switch (GetPlayer(parameterObject["playerid"]))
@@ -97,3 +97,16 @@ JSONRPC_STATUS CTextureOperations::RemoveTexture(const std::string &method, ITra
 
   return ACK;
 }
+
+JSONRPC_STATUS CTextureOperations::PrecacheTextures(const std::string& method,
+                                                    ITransportLayer* transport,
+                                                    IClient* client,
+                                                    const CVariant& parameterObject,
+                                                    CVariant& result)
+{
+  if (!CServiceBroker::GetTextureCache()->PrecacheAllLibraryImages(
+          parameterObject["showprogress"].asBoolean()))
+    return FailedToExecute;
+
+  return ACK;
+}
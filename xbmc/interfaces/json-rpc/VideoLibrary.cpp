@@ -24,6 +24,7 @@
 #include "video/VideoLibraryQueue.h"
 
 #include <memory>
+#include <set>
 
 using namespace JSONRPC;
 
@@ -77,6 +78,20 @@ JSONRPC_STATUS CVideoLibrary::GetMovies(const std::string &method, ITransportLay
   if (setID < 0)
     setID = 0;
 
+  // same options GetMoviesNav() adds for the ids
+  CVideoDbUrl jsonUrl = videoUrl;
+  if (genreID > 0)
+    jsonUrl.AddOption("genreid", genreID);
+  else if (year > 0)
+    jsonUrl.AddOption("year", year);
+  else if (setID > 0)
+    jsonUrl.AddOption("setid", setID);
+
+  JSONRPC_STATUS status;
+  if (HandleItemsJSON(MediaTypeMovie, videodatabase, jsonUrl.ToString(), sorting, parameterObject,
+                      result, status))
+    return status;
+
   CFileItemList items;
   if (!videodatabase.GetMoviesNav(videoUrl.ToString(), items, genreID, year, -1, -1, -1, -1, setID, -1, sorting, RequiresAdditionalDetails(MediaTypeMovie, parameterObject)))
     return InvalidParams;
@@ -178,6 +193,11 @@ JSONRPC_STATUS CVideoLibrary::GetTVShows(const std::string &method, ITransportLa
     videoUrl.AddOption("xsp", xsp);
   }
 
+  JSONRPC_STATUS status;
+  if (HandleItemsJSON(MediaTypeTvShow, videodatabase, videoUrl.ToString(), sorting, parameterObject,
+                      result, status))
+    return status;
+
   CFileItemList items;
   CDatabase::Filter nofilter;
   if (!videodatabase.GetTvShowsByWhere(videoUrl.ToString(), nofilter, items, sorting, RequiresAdditionalDetails(MediaTypeTvShow, parameterObject)))
@@ -289,6 +309,11 @@ JSONRPC_STATUS CVideoLibrary::GetEpisodes(const std::string &method, ITransportL
       videoUrl.AddOption("season", season);
   }
 
+  JSONRPC_STATUS status;
+  if (HandleItemsJSON(MediaTypeEpisode, videodatabase, videoUrl.ToString(), sorting,
+                      parameterObject, result, status))
+    return status;
+
   CFileItemList items;
   if (!videodatabase.GetEpisodesByWhere(videoUrl.ToString(), CDatabase::Filter(), items, false, sorting, RequiresAdditionalDetails(MediaTypeEpisode, parameterObject)))
     return InvalidParams;
@@ -1157,6 +1182,45 @@ JSONRPC_STATUS CVideoLibrary::HandleItems(const char *idProperty, const char *re
   return OK;
 }
 
+bool CVideoLibrary::HandleItemsJSON(const MediaType& mediaType,
+                                    CVideoDatabase& videodatabase,
+                                    const std::string& baseDir,
+                                    const SortDescription& sorting,
+                                    const CVariant& parameterObject,
+                                    CVariant& result,
+                                    JSONRPC_STATUS& status)
+{
+  std::set<std::string, std::less<>> fields;
+  const CVariant& properties = parameterObject["properties"];
+  for (CVariant::const_iterator_array field = properties.begin_array();
+       field != properties.end_array(); ++field)
+    fields.insert(field->asString());
+
+  if (!CVideoDatabase::CanGetByWhereJSON(mediaType, fields))
+    return false;
+
+  int total = 0;
+  bool success = false;
+  if (mediaType == MediaTypeMovie)
+    success = videodatabase.GetMoviesByWhereJSON(fields, baseDir, result, total, sorting);
+  else if (mediaType == MediaTypeTvShow)
+    success = videodatabase.GetTvShowsByWhereJSON(fields, baseDir, result, total, sorting);
+  else if (mediaType == MediaTypeEpisode)
+    success = videodatabase.GetEpisodesByWhereJSON(fields, baseDir, result, total, sorting);
+
+  if (!success)
+  {
+    status = InvalidParams;
+    return true;
+  }
+
+  int start, end;
+  HandleLimits(parameterObject, result, total, start, end);
+
+  status = OK;
+  return true;
+}
+
 JSONRPC_STATUS CVideoLibrary::RemoveVideo(const CVariant &parameterObject)
 {
   CVideoDatabase videodatabase;
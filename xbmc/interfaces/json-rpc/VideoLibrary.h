@@ -89,6 +89,16 @@ namespace JSONRPC
   private:
     static int RequiresAdditionalDetails(const MediaType& mediaType, const CVariant &parameterObject);
     static JSONRPC_STATUS HandleItems(const char *idProperty, const char *resultName, CFileItemList &items, const CVariant &parameterObject, CVariant &result, bool limit = true);
+    /*! \brief Fill result straight from the database if it can provide all requested properties
+    * \return false if the listing has to be built from file items, otherwise status is set
+    */
+    static bool HandleItemsJSON(const MediaType& mediaType,
+                                CVideoDatabase& videodatabase,
+                                const std::string& baseDir,
+                                const SortDescription& sorting,
+                                const CVariant& parameterObject,
+                                CVariant& result,
+                                JSONRPC_STATUS& status);
     static JSONRPC_STATUS RemoveVideo(const CVariant &parameterObject);
     static void UpdateVideoTag(const CVariant& parameterObject,
                                CVideoInfoTag& details,
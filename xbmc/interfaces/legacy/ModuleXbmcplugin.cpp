@@ -10,14 +10,109 @@
 
 #include "FileItem.h"
 #include "FileItemList.h"
+#include "InfoTagVideo.h"
 #include "SortFileItem.h"
 #include "filesystem/PluginDirectory.h"
+#include "utils/StringUtils.h"
+#include "utils/log.h"
+#include "video/VideoInfoTag.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <set>
 
 namespace XBMCAddon
 {
 
   namespace xbmcplugin
   {
+    namespace
+    {
+    String GetString(const xbmcgui::InfoLabelValue& value)
+    {
+      return value.which() == first ? value.former() : emptyString;
+    }
+
+    std::vector<String> GetStrings(const xbmcgui::InfoLabelValue& value)
+    {
+      if (value.which() == first)
+        return {value.former()};
+
+      std::vector<String> strings;
+      if (value.which() == second)
+      {
+        for (const auto& entry : value.later())
+        {
+          if (entry.which() == first)
+            strings.emplace_back(entry.former());
+        }
+      }
+      return strings;
+    }
+
+    Properties GetProperties(const xbmcgui::InfoLabelDict& dict)
+    {
+      Properties properties;
+      for (const auto& [key, value] : dict)
+        properties.emplace(key, GetString(value));
+      return properties;
+    }
+
+    void SetVideoInfo(CVideoInfoTag* tag,
+                      const xbmcgui::InfoLabelDict& info,
+                      std::set<std::string>& unknownKeys)
+    {
+      using xbmc::InfoTagVideo;
+      for (const auto& [name, value] : info)
+      {
+        const std::string key = StringUtils::ToLower(name);
+        const String str = GetString(value);
+        const int number = static_cast<int>(strtol(str.c_str(), nullptr, 10));
+
+        if (key == "mediatype")
+          InfoTagVideo::setMediaTypeRaw(tag, str);
+        else if (key == "title")
+          InfoTagVideo::setTitleRaw(tag, str);
+        else if (key == "originaltitle")
+          InfoTagVideo::setOriginalTitleRaw(tag, str);
+        else if (key == "sorttitle")
+          InfoTagVideo::setSortTitleRaw(tag, str);
+        else if (key == "plot")
+          InfoTagVideo::setPlotRaw(tag, str);
+        else if (key == "plotoutline")
+          InfoTagVideo::setPlotOutlineRaw(tag, str);
+        else if (key == "tagline")
+          InfoTagVideo::setTagLineRaw(tag, str);
+        else if (key == "tvshowtitle")
+          InfoTagVideo::setTvShowTitleRaw(tag, str);
+        else if (key == "premiered")
+          InfoTagVideo::setPremieredRaw(tag, str);
+        else if (key == "year")
+          InfoTagVideo::setYearRaw(tag, number);
+        else if (key == "season")
+          InfoTagVideo::setSeasonRaw(tag, number);
+        else if (key == "episode")
+          InfoTagVideo::setEpisodeRaw(tag, number);
+        else if (key == "duration")
+          InfoTagVideo::setDurationRaw(tag, number);
+        else if (key == "playcount")
+          InfoTagVideo::setPlaycountRaw(tag, number);
+        else if (key == "genre")
+          InfoTagVideo::setGenresRaw(tag, GetStrings(value));
+        else if (key == "studio")
+          InfoTagVideo::setStudiosRaw(tag, GetStrings(value));
+        else if (key == "director")
+          InfoTagVideo::setDirectorsRaw(tag, GetStrings(value));
+        else if (key == "writer")
+          InfoTagVideo::setWritersRaw(tag, GetStrings(value));
+        else if (key == "country")
+          InfoTagVideo::setCountriesRaw(tag, GetStrings(value));
+        else
+          unknownKeys.emplace("video." + name);
+      }
+    }
+    } // unnamed namespace
+
     bool addDirectoryItem(int handle, const String& url, const xbmcgui::ListItem* listItem,
                           bool isFolder, int totalItems)
     {
@@ -50,11 +145,63 @@ namespace XBMCAddon
       return XFILE::CPluginDirectory::AddItems(handle, &fitems, totalItems);
     }
 
-    void endOfDirectory(int handle, bool succeeded, bool updateListing,
-                        bool cacheToDisc)
+    bool addDirectoryItemsFromDicts(int handle,
+                                    const std::vector<DirectoryItemDict>& items,
+                                    int totalItems)
+    {
+      CFileItemList fitems;
+      std::set<std::string> unknownKeys;
+      for (const auto& dict : items)
+      {
+        // offscreen, the item isn't shown before it's added
+        AddonClass::Ref<xbmcgui::ListItem> listItem(
+            new xbmcgui::ListItem(emptyString, emptyString, emptyString, true));
+        CFileItem& item = *listItem->item;
+
+        for (const auto& [key, value] : dict)
+        {
+          if (value.which() == second)
+          {
+            if (key == "art")
+              listItem->setArt(GetProperties(value.later()));
+            else if (key == "properties")
+              listItem->setProperties(GetProperties(value.later()));
+            else if (key == "video")
+              SetVideoInfo(item.GetVideoInfoTag(), value.later(), unknownKeys);
+            else
+              unknownKeys.emplace(key);
+          }
+          else if (key == "path")
+            item.SetPath(value.former());
+          else if (key == "label")
+            item.SetLabel(value.former());
+          else if (key == "label2")
+            item.SetLabel2(value.former());
+          else if (key == "isFolder")
+            item.SetFolder(StringUtils::EqualsNoCase(value.former(), "true") ||
+                           value.former() == "1");
+          else
+            unknownKeys.emplace(key);
+        }
+
+        fitems.Add(listItem->item);
+      }
+
+      if (!unknownKeys.empty())
+        CLog::Log(LOGWARNING, "xbmcplugin.addDirectoryItemsFromDicts: unknown keys {}",
+                  StringUtils::Join(unknownKeys, ", "));
+
+      // call the directory class to add our items
+      return XFILE::CPluginDirectory::AddItems(handle, &fitems, totalItems);
+    }
+
+    void endOfDirectory(
+        int handle, bool succeeded, bool updateListing, bool cacheToDisc, int cacheLifetime)
     {
       // tell the directory class that we're done
-      XFILE::CPluginDirectory::EndOfDirectory(handle, succeeded, updateListing, cacheToDisc);
+      const auto lifetime = static_cast<unsigned int>(std::max(cacheLifetime, 0));
+      XFILE::CPluginDirectory::EndOfDirectory(handle, succeeded, updateListing, cacheToDisc,
+                                              lifetime);
     }
 
     void setResolvedUrl(int handle, bool succeeded, const xbmcgui::ListItem* listItem)
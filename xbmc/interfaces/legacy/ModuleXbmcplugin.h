@@ -9,6 +9,8 @@
 #pragma once
 
 #include "AddonString.h"
+#include "Alternative.h"
+#include "Dictionary.h"
 #include "ListItem.h"
 #include "SortFileItem.h"
 #include "Tuple.h"
@@ -34,6 +36,13 @@ namespace XBMCAddon
     /// development time and a more consistent user experience.
     //
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    // A value of a directory item for addDirectoryItemsFromDicts, either a String or a
+    // dictionary of art, properties or info labels.
+    typedef Alternative<StringOrInt, XBMCAddon::xbmcgui::InfoLabelDict> DirectoryItemValue;
+    typedef Dictionary<DirectoryItemValue> DirectoryItemDict;
+#endif
+
 #ifdef DOXYGEN_SHOULD_USE_THIS
     ///
     /// \ingroup python_xbmcplugin
@@ -108,7 +117,58 @@ namespace XBMCAddon
 #ifdef DOXYGEN_SHOULD_USE_THIS
     ///
     /// \ingroup python_xbmcplugin
-    /// @brief \python_func{ xbmcplugin.endOfDirectory(handle[, succeeded, updateListing, cacheToDisc]) }
+    /// @brief \python_func{ xbmcplugin.addDirectoryItemsFromDicts(handle, items[, totalItems]) }
+    /// Callback function to pass directory contents back to Kodi as a list of
+    /// dictionaries.
+    ///
+    /// Kodi creates the items from the dictionaries in one call, without a
+    /// ListItem and a call of its setters for every item. Prefer it over
+    /// addDirectoryItems() for listings of thousands of entries.
+    ///
+    /// @param handle               integer - handle the plugin was started
+    ///                             with.
+    /// @param items                List - list of dictionaries, one per item.
+    /// @param totalItems           [opt] integer - total number of items
+    ///                             that will be passed.(used for progressbar)
+    /// @return                     Returns a bool for successful completion.
+    ///
+    /// The keys of an item dictionary:
+    /// | Key        | Value                                                    |
+    /// |-----------:|:---------------------------------------------------------|
+    /// | path       | string - url of the entry                                |
+    /// | label      | string - label of the entry                              |
+    /// | label2     | string - second label of the entry                       |
+    /// | isFolder   | bool - True=folder / False=not a folder(default)         |
+    /// | art        | dictionary - art as for ListItem.setArt()                |
+    /// | properties | dictionary - properties as for ListItem.setProperties()  |
+    /// | video      | dictionary - video info labels: mediatype, title, originaltitle, sorttitle, plot, plotoutline, tagline, tvshowtitle, premiered, year, season, episode, duration (in seconds), playcount, genre, studio, director, writer and country (lists of strings) |
+    ///
+    /// @remark You may call this more than once to add items in chunks.
+    ///
+    ///
+    /// ------------------------------------------------------------------------
+    /// @python_v22 New function added.
+    ///
+    /// **Example:**
+    /// ~~~~~~~~~~~~~{.py}
+    /// ..
+    /// items = [{"path": url, "label": title, "isFolder": True,
+    ///           "art": {"thumb": thumb}, "video": {"title": title, "year": 2024}}]
+    /// if not xbmcplugin.addDirectoryItemsFromDicts(int(sys.argv[1]), items): raise
+    /// ..
+    /// ~~~~~~~~~~~~~
+    ///
+    addDirectoryItemsFromDicts(...);
+#else
+    bool addDirectoryItemsFromDicts(int handle,
+                                    const std::vector<DirectoryItemDict>& items,
+                                    int totalItems = 0);
+#endif
+
+#ifdef DOXYGEN_SHOULD_USE_THIS
+    ///
+    /// \ingroup python_xbmcplugin
+    /// @brief \python_func{ xbmcplugin.endOfDirectory(handle[, succeeded, updateListing, cacheToDisc, cacheLifetime]) }
     /// Callback function to tell Kodi that the end of the directory listing in
     /// a virtualPythonFolder module is reached.
     ///
@@ -122,21 +182,33 @@ namespace XBMCAddon
     /// @param cacheToDisc          [opt] bool - True=Folder will cache if
     ///                             extended time(default)/False=this folder
     ///                             will never cache to disc.
+    /// @param cacheLifetime        [opt] integer - Seconds the listing stays
+    ///                             valid. Going back to the folder within that
+    ///                             time takes the listing from memory instead
+    ///                             of running the plugin again, a refresh of
+    ///                             the container still runs it. 0=the plugin
+    ///                             runs for each visit(default).
     ///
     ///
     /// ------------------------------------------------------------------------
+    /// @python_v22 New param added (cacheLifetime).
     ///
     /// **Example:**
     /// ~~~~~~~~~~~~~{.py}
     /// ..
     /// xbmcplugin.endOfDirectory(int(sys.argv[1]), cacheToDisc=False)
+    /// # the listing doesn't change for the next ten minutes
+    /// xbmcplugin.endOfDirectory(int(sys.argv[1]), cacheLifetime=600)
     /// ..
     /// ~~~~~~~~~~~~~
     ///
     endOfDirectory(...);
 #else
-    void endOfDirectory(int handle, bool succeeded = true, bool updateListing = false,
-                        bool cacheToDisc = true);
+    void endOfDirectory(int handle,
+                        bool succeeded = true,
+                        bool updateListing = false,
+                        bool cacheToDisc = true,
+                        int cacheLifetime = 0);
 #endif
 
 #ifdef DOXYGEN_SHOULD_USE_THIS
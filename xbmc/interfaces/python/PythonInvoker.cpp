@@ -260,9 +260,25 @@ bool CPythonInvoker::execute(const std::string& script, std::vector<std::wstring
     }
   }
   else
+  {
     // swap in my thread m_threadState
     PyThreadState_Swap(m_threadState);
 
+    // The imported modules stay warm, but every run starts with the globals of a new script
+    PyObject* moduleDict = PyModule_GetDict(PyImport_AddModule("__main__"));
+    PyObject* builtins = PyDict_GetItemString(moduleDict, "__builtins__");
+    Py_XINCREF(builtins);
+    PyDict_Clear(moduleDict);
+    PyObject* name = PyUnicode_FromString("__main__");
+    PyDict_SetItemString(moduleDict, "__name__", name);
+    Py_DECREF(name);
+    if (builtins)
+    {
+      PyDict_SetItemString(moduleDict, "__builtins__", builtins);
+      Py_DECREF(builtins);
+    }
+  }
+
   PyObject* sysArgv = PyList_New(0);
 
   if (arguments.empty())
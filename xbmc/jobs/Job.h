@@ -9,6 +9,7 @@
 #pragma once
 
 #include <stddef.h>
+#include <string>
 
 class CJobManager;
 
@@ -47,6 +48,18 @@ public:
     PRIORITY_DEDICATED, // will create a new worker if no worker is available at queue time
   };
 
+  /*!
+   \brief What a job spends most of its time on. CJobManager limits the number of jobs running
+   at the same time per resource, on top of the worker limits of the priorities.
+   \sa GetResource()
+   */
+  enum RESOURCE
+  {
+    RESOURCE_CPU = 0, // decoding, scaling, database work
+    RESOURCE_DISK, // reading and writing local files
+    RESOURCE_NETWORK, // reading from a remote host, limited per host
+  };
+
   CJob() = default;
 
   /*!
@@ -96,6 +109,20 @@ public:
    */
   virtual bool Equals(const CJob* job) const { return false; }
 
+  /*!
+   \brief Function that returns the resource the job spends most of its time on.
+
+   CJob subclasses that read from a remote host or work on local files should implement this,
+   so they don't take all workers while jobs of other resources wait. Called once when the job
+   is added.
+
+   \param host [out] the host a RESOURCE_NETWORK job reads from.
+   \return the resource of the job.
+
+   \sa CJobManager::AddJob()
+   */
+  virtual RESOURCE GetResource(std::string& host) const { return RESOURCE_CPU; }
+
   /*!
    \brief Function to set a callback for jobs to report progress.
 
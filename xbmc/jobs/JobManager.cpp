@@ -22,6 +22,13 @@
 
 using namespace std::chrono_literals;
 
+namespace
+{
+// local disks and NAS shares slow down a lot once several jobs seek on them at the same time
+constexpr unsigned int MAX_DISK_JOBS = 2;
+constexpr unsigned int MAX_NETWORK_JOBS_PER_HOST = 2;
+} // unnamed namespace
+
 bool CJob::ShouldCancel(unsigned int progress, unsigned int total) const
 {
   if (m_progressCallback)
@@ -88,38 +95,38 @@ struct CJobManager::JobFinder
 
 bool CJobManager::IsRunning() const
 {
-  std::unique_lock lock(m_section);
   return m_running;
 }
 
 void CJobManager::Restart()
 {
-  std::unique_lock lock(m_section);
-
-  if (m_running)
+  bool running{false};
+  if (!m_running.compare_exchange_strong(running, true))
     throw std::logic_error("CJobManager already running");
-  m_running = true;
 }
 
 void CJobManager::CancelJobs()
 {
-  std::unique_lock lock(m_section);
+  // AddJob() checks this with the lock of the queue held, no job is queued after the queue is
+  // cleared. A job a worker took before is found in m_processing below.
   m_running = false;
 
   // clear any pending jobs
-  for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED;
-       ++priority)
+  for (JobLane& lane : m_lanes)
   {
-    std::ranges::for_each(m_jobQueue[priority],
+    std::unique_lock laneLock(lane.section);
+    std::ranges::for_each(lane.queue,
                           [](CWorkItem& wi)
                           {
                             for (auto* callback : wi.GetCallbacks())
                               callback->OnJobAbort(wi.GetId(), wi.GetJob());
                             wi.FreeJob();
                           });
-    m_jobQueue[priority].clear();
+    lane.queue.clear();
   }
 
+  std::unique_lock lock(m_section);
+
   // cancel any callbacks on jobs still processing
   std::ranges::for_each(m_processing,
                         [](CWorkItem& wi)
@@ -141,69 +148,86 @@ void CJobManager::CancelJobs()
 
 unsigned int CJobManager::AddJob(CJob* job, IJobCallback* callback, CJob::PRIORITY priority)
 {
-  std::unique_lock lock(m_section);
-
+  // also keeps the abort callbacks of CancelJobs() from taking the locks in the wrong order
   if (!m_running)
   {
     delete job;
     return 0;
   }
 
-  // Check if we have this job already in the queue - if so, add callback to existing job
-  auto it = std::ranges::find_if(m_jobQueue[priority],
-                                 [job](const CWorkItem& wi) { return wi.GetJob()->Equals(job); });
-  if (it != m_jobQueue[priority].end())
-  {
-    it->AddCallback(callback);
-    delete job;
-    return it->GetId();
-  }
+  std::string host;
+  const CJob::RESOURCE resource = job->GetResource(host);
 
-  // Check if an equal job is already processing - if so, add callback to it.
-  // Note: Jobs that have moved to completion phase (removed from m_processing)
-  // won't be found here, causing a new job to be created. This is intentional -
-  // the completing job's results are about to be delivered to existing callbacks.
-  auto procIt = std::ranges::find_if(m_processing, [job](const CWorkItem& wi)
-                                     { return wi.GetJob()->Equals(job); });
-  if (procIt != m_processing.end())
+  unsigned int id{0};
   {
-    procIt->AddCallback(callback);
-    delete job;
-    return procIt->GetId();
-  }
+    JobLane& lane = m_lanes[priority];
+    std::unique_lock laneLock(lane.section);
 
-  // increment the job counter, ensuring 0 (invalid job) is never hit
-  m_jobCounter++;
-  if (m_jobCounter == 0)
-    m_jobCounter++;
+    if (!m_running)
+    {
+      delete job;
+      return 0;
+    }
 
-  // create a work item for this job
-  CWorkItem work(job, m_jobCounter, priority, callback);
-  m_jobQueue[priority].emplace_back(work);
+    // Check if we have this job already in the queue - if so, add callback to existing job
+    auto it = std::ranges::find_if(lane.queue,
+                                   [job](const CWorkItem& wi) { return wi.GetJob()->Equals(job); });
+    if (it != lane.queue.end())
+    {
+      it->AddCallback(callback);
+      delete job;
+      return it->GetId();
+    }
+
+    // Check if an equal job is already processing - if so, add callback to it.
+    // Note: Jobs that have moved to completion phase (removed from m_processing)
+    // won't be found here, causing a new job to be created. This is intentional -
+    // the completing job's results are about to be delivered to existing callbacks.
+    {
+      std::unique_lock lock(m_section);
+      auto procIt = std::ranges::find_if(m_processing, [job](const CWorkItem& wi)
+                                         { return wi.GetJob()->Equals(job); });
+      if (procIt != m_processing.end())
+      {
+        procIt->AddCallback(callback);
+        delete job;
+        return procIt->GetId();
+      }
+    }
+
+    // increment the job counter, ensuring 0 (invalid job) is never hit
+    id = ++m_jobCounter;
+    if (id == 0)
+      id = ++m_jobCounter;
+
+    // create a work item for this job
+    lane.queue.emplace_back(job, id, priority, callback, resource, std::move(host));
+  }
 
   StartWorkers(priority);
-  return work.GetId();
+  return id;
 }
 
 void CJobManager::CancelJob(unsigned int jobID)
 {
-  std::unique_lock lock(m_section);
-
-  // check whether we have this job in the queue
-  for (unsigned int priority = CJob::PRIORITY_LOW_PAUSABLE; priority <= CJob::PRIORITY_DEDICATED;
-       ++priority)
+  // check whether we have this job in the queue. A worker moves a job to m_processing with
+  // the lock of its queue held, the job is found in one of the two.
+  for (JobLane& lane : m_lanes)
   {
-    const auto i = std::ranges::find_if(m_jobQueue[priority],
-                                        [jobID](const auto& wi) { return wi.GetId() == jobID; });
-    if (i != m_jobQueue[priority].cend())
+    std::unique_lock laneLock(lane.section);
+    const auto i =
+        std::ranges::find_if(lane.queue, [jobID](const auto& wi) { return wi.GetId() == jobID; });
+    if (i != lane.queue.cend())
     {
       CWorkItem item(std::move(*i));
-      m_jobQueue[priority].erase(i);
+      lane.queue.erase(i);
       item.FreeJob();
       return;
     }
   }
+
   // or if we're processing it
+  std::unique_lock lock(m_section);
   const auto it =
       std::ranges::find_if(m_processing, [jobID](const auto& wi) { return wi.GetId() == jobID; });
   if (it != m_processing.cend())
@@ -231,22 +255,31 @@ void CJobManager::StartWorkers(CJob::PRIORITY priority)
 
 CJob* CJobManager::PopJob()
 {
-  std::unique_lock lock(m_section);
   for (int priority = CJob::PRIORITY_DEDICATED; priority >= CJob::PRIORITY_LOW_PAUSABLE; --priority)
   {
     // Check whether we're pausing pausable jobs
     if (priority == CJob::PRIORITY_LOW_PAUSABLE && m_pauseJobs)
       continue;
 
-    if (!m_jobQueue[priority].empty() &&
-        m_processing.size() < GetMaxWorkers(CJob::PRIORITY(priority)))
-    {
-      // pop the job off the queue
-      const CWorkItem job{m_jobQueue[priority].front()};
-      m_jobQueue[priority].pop_front();
+    JobLane& lane = m_lanes[priority];
+    std::unique_lock laneLock(lane.section);
+    if (lane.queue.empty())
+      continue;
 
-      // add to the processing vector
-      m_processing.emplace_back(job);
+    std::unique_lock lock(m_section);
+    if (m_processing.size() >= GetMaxWorkers(CJob::PRIORITY(priority)))
+      continue;
+
+    // dedicated jobs don't take a shared worker, the resource limits don't apply to them
+    const auto it = priority == CJob::PRIORITY_DEDICATED
+                        ? lane.queue.begin()
+                        : std::ranges::find_if(lane.queue, [this](const CWorkItem& wi)
+                                               { return CanStart(wi); });
+    if (it != lane.queue.end())
+    {
+      // pop the job off the queue and add it to the processing vector
+      CWorkItem& job = m_processing.emplace_back(std::move(*it));
+      lane.queue.erase(it);
       job.GetJob()->SetProgressCallback(this);
       return job.GetJob();
     }
@@ -254,15 +287,40 @@ CJob* CJobManager::PopJob()
   return nullptr;
 }
 
+bool CJobManager::CanStart(const CWorkItem& item) const
+{
+  const auto running = std::ranges::count_if(
+      m_processing,
+      [&item](const CWorkItem& wi)
+      {
+        return wi.GetPriority() != CJob::PRIORITY_DEDICATED &&
+               wi.GetResource() == item.GetResource() &&
+               (item.GetResource() != CJob::RESOURCE_NETWORK || wi.GetHost() == item.GetHost());
+      });
+  return static_cast<unsigned int>(running) < GetMaxJobs(item.GetResource());
+}
+
+unsigned int CJobManager::GetMaxJobs(CJob::RESOURCE resource)
+{
+  switch (resource)
+  {
+    case CJob::RESOURCE_DISK:
+      return MAX_DISK_JOBS;
+    case CJob::RESOURCE_NETWORK:
+      return MAX_NETWORK_JOBS_PER_HOST;
+    case CJob::RESOURCE_CPU:
+    default:
+      return std::max(1U, std::thread::hardware_concurrency());
+  }
+}
+
 void CJobManager::PauseJobs()
 {
-  std::unique_lock lock(m_section);
   m_pauseJobs = true;
 }
 
 void CJobManager::UnPauseJobs()
 {
-  std::unique_lock lock(m_section);
   m_pauseJobs = false;
 }
 
@@ -292,7 +350,6 @@ int CJobManager::IsProcessing(const std::string& type) const
 
 CJob* CJobManager::GetNextJob()
 {
-  std::unique_lock lock(m_section);
   while (m_running)
   {
     // grab a job off the queue if we have one
@@ -300,10 +357,7 @@ CJob* CJobManager::GetNextJob()
     if (job)
       return job;
     // no jobs are left - sleep for 30 seconds to allow new jobs to come in
-    lock.unlock();
-    bool newJob = m_jobEvent.Wait(30000ms);
-    lock.lock();
-    if (!newJob)
+    if (!m_jobEvent.Wait(30000ms))
       break;
   }
   // ensure no jobs have come in during the period after
@@ -19,6 +19,7 @@
 #include <queue>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 class IJobCallback;
@@ -32,6 +33,11 @@ class IJobCallback;
  on priority levels.  Lower priority jobs are executed only if there are sufficient
  spare worker threads free to allow for higher priority jobs that may arise.
 
+ Every priority has its own queue and lock, adding a job only blocks the jobs of the same
+ priority. The running jobs are guarded by a separate lock, always taken after a queue's.
+ The number of running jobs is also limited per resource (CJob::GetResource()), a queued job
+ waits while the jobs of its resource are at the limit and jobs behind it may start first.
+
  \sa CJob and IJobCallback
  */
 class CJobManager final
@@ -180,10 +186,17 @@ private:
   class CWorkItem
   {
   public:
-    CWorkItem(CJob* job, unsigned int id, CJob::PRIORITY priority, IJobCallback* callback)
+    CWorkItem(CJob* job,
+              unsigned int id,
+              CJob::PRIORITY priority,
+              IJobCallback* callback,
+              CJob::RESOURCE resource,
+              std::string host)
       : m_job(job),
         m_id(id),
-        m_priority(priority)
+        m_priority(priority),
+        m_resource(resource),
+        m_host(std::move(host))
     {
       if (callback)
         m_callbacks.push_back(callback);
@@ -213,12 +226,16 @@ private:
       return callback;
     }
     CJob::PRIORITY GetPriority() const { return m_priority; }
+    CJob::RESOURCE GetResource() const { return m_resource; }
+    const std::string& GetHost() const { return m_host; }
 
   private:
     CJob* m_job{nullptr};
     unsigned int m_id{0};
     std::vector<IJobCallback*> m_callbacks;
     CJob::PRIORITY m_priority{CJob::PRIORITY::PRIORITY_LOW};
+    CJob::RESOURCE m_resource{CJob::RESOURCE_CPU};
+    std::string m_host;
   };
 
   /*! \brief Pop a job off the job queue and add to the processing queue ready to process
@@ -230,20 +247,32 @@ private:
   void RemoveWorker(const CJobWorker* worker);
   static unsigned int GetMaxWorkers(CJob::PRIORITY priority);
 
-  unsigned int m_jobCounter{0};
+  /*! \brief Whether another job of the resource of item may start, needs m_section
+   */
+  bool CanStart(const CWorkItem& item) const;
+  static unsigned int GetMaxJobs(CJob::RESOURCE resource);
+
+  std::atomic<unsigned int> m_jobCounter{0};
 
   using JobQueue = std::deque<CWorkItem>;
   using Processing = std::vector<CWorkItem>;
   using Workers = std::vector<CJobWorker*>;
 
-  std::array<JobQueue, CJob::PRIORITY_DEDICATED + 1> m_jobQueue;
-  bool m_pauseJobs{false};
+  struct JobLane
+  {
+    mutable CCriticalSection section;
+    JobQueue queue;
+  };
+
+  std::array<JobLane, CJob::PRIORITY_DEDICATED + 1> m_lanes;
+  std::atomic<bool> m_pauseJobs{false};
+
+  mutable CCriticalSection m_section; ///< guards the running jobs, workers and pending callbacks
   Processing m_processing;
   Workers m_workers;
 
-  mutable CCriticalSection m_section;
   CEvent m_jobEvent;
-  bool m_running{true};
+  std::atomic<bool> m_running{true};
 
   // Tracks pending callback count for jobs in completion phase, used by CJob::IsShared()
   std::unordered_map<const CJob*, std::atomic<size_t>> m_pendingCallbacks;
@@ -63,6 +63,7 @@
 #include "utils/Random.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
+#include "utils/XMLStreamWriter.h"
 #include "utils/XMLUtils.h"
 #include "utils/log.h"
 
@@ -252,6 +253,10 @@ void CMusicDatabase::CreateTables()
 
   CLog::Log(LOGINFO, "create removed_link table");
   m_pDS->exec("CREATE TABLE removed_link (idArtist INTEGER, idMedia INTEGER, idRole INTEGER)");
+
+  CLog::Log(LOGINFO, "create album_played table");
+  m_pDS->exec("CREATE TABLE album_played (idAlbum INTEGER PRIMARY KEY, "
+              "iTimesPlayed INTEGER NOT NULL DEFAULT 0, lastplayed VARCHAR(20) DEFAULT NULL)");
 }
 
 void CMusicDatabase::CreateAnalytics()
@@ -308,6 +313,7 @@ void CMusicDatabase::CreateAnalytics()
               "  DELETE FROM song WHERE song.idAlbum = old.idAlbum;"
               "  DELETE FROM album_artist WHERE album_artist.idAlbum = old.idAlbum;"
               "  DELETE FROM album_source WHERE album_source.idAlbum = old.idAlbum;"
+              "  DELETE FROM album_played WHERE album_played.idAlbum = old.idAlbum;"
               "  DELETE FROM art WHERE media_id=old.idAlbum AND media_type='album';"
               " END");
   m_pDS->exec("CREATE TRIGGER tgrDeleteArtist AFTER delete ON artist FOR EACH ROW BEGIN"
@@ -504,14 +510,13 @@ void CMusicDatabase::CreateViews()
               "bScrapedMBID,"
               "lastScraped,"
               "dateAdded, dateNew, dateModified, "
-              "(SELECT ROUND(AVG(song.iTimesPlayed)) FROM song "
-              "WHERE song.idAlbum = album.idAlbum) AS iTimesPlayed, "
+              "album_played.iTimesPlayed AS iTimesPlayed, "
               "strReleaseType, "
               "iDiscTotal, "
-              "(SELECT MAX(song.lastplayed) FROM song "
-              "WHERE song.idAlbum = album.idAlbum) AS lastplayed, "
+              "album_played.lastplayed AS lastplayed, "
               "iAlbumDuration "
-              "FROM album");
+              "FROM album "
+              "LEFT JOIN album_played ON album_played.idAlbum = album.idAlbum");
 
   CLog::Log(LOGINFO, "create artist view");
   m_pDS->exec("CREATE VIEW artistview AS SELECT"
@@ -722,7 +727,10 @@ void CMusicDatabase::SplitPath(const std::string& strFileNameAndPath,
 
 bool CMusicDatabase::AddAlbum(CAlbum& album, int idSource)
 {
-  BeginTransaction();
+  // the scanner adds several albums in one transaction
+  const bool inTransaction{InTransaction()};
+  if (!inTransaction)
+    BeginTransaction();
   SetLibraryLastUpdated();
 
   album.idAlbum = AddAlbum(album.strAlbum, //
@@ -813,21 +821,7 @@ bool CMusicDatabase::AddAlbum(CAlbum& album, int idSource)
                              song->songVideoURL, //
                              song->replayGain);
 
-      // Song must have at least one artist so set artist to [Missing]
-      if (song->artistCredits.empty())
-        AddSongArtist(BLANKARTIST_ID, song->idSong, ROLE_ARTIST, BLANKARTIST_NAME, 0);
-
-      for (auto artistCredit = song->artistCredits.begin();
-           artistCredit != song->artistCredits.end(); ++artistCredit)
-      {
-        artistCredit->idArtist =
-            AddArtist(artistCredit->GetArtist(), artistCredit->GetMusicBrainzArtistID(),
-                      artistCredit->GetSortName());
-        AddSongArtist(
-            artistCredit->idArtist, song->idSong, ROLE_ARTIST,
-            artistCredit->GetArtist(), // we don't have song artist breakdowns from scrapers, yet
-            static_cast<int>(std::distance(song->artistCredits.begin(), artistCredit)));
-      }
+      AddSongArtists(song->idSong, song->artistCredits);
       // Having added artist credits (maybe with MBID) add the other contributing artists (no MBID)
       // and use COMPOSERSORT tag data to provide sort names for artists that are composers
       AddSongContributors(song->idSong, song->GetContributors(), song->GetComposerSort());
@@ -844,6 +838,7 @@ bool CMusicDatabase::AddAlbum(CAlbum& album, int idSource)
   int albumDuration = GetSingleValueInt(strSQL);
   m_pDS->exec(PrepareSQL("UPDATE album SET iAlbumDuration = %i WHERE idAlbum = %i", albumDuration,
                          album.idAlbum));
+  UpdateAlbumPlayed(album.idAlbum);
 
   // Add album sources
   if (idSource > 0)
@@ -902,7 +897,8 @@ bool CMusicDatabase::AddAlbum(CAlbum& album, int idSource)
                       albumdateadded.c_str(), strIDs.c_str(), albumdateadded.c_str());
   m_pDS->exec(strSQL);
 
-  CommitTransaction();
+  if (!inTransaction)
+    CommitTransaction();
   return true;
 }
 
@@ -1089,17 +1085,25 @@ int CMusicDatabase::AddSong(const int idSong,
 
     if (idSong <= 1)
     {
+      bool found;
       if (!strMusicBrainzTrackID.empty())
-        strSQL = PrepareSQL("SELECT idSong FROM song WHERE "
-                            "idAlbum = %i AND iTrack=%i AND strMusicBrainzTrackID = '%s'",
-                            idAlbum, iTrack, strMusicBrainzTrackID.c_str());
+      {
+        strSQL = "SELECT idSong FROM song WHERE "
+                 "idAlbum = ? AND iTrack = ? AND strMusicBrainzTrackID = ?";
+        found = m_pDS->query(strSQL, {dbiplus::field_value(idAlbum), dbiplus::field_value(iTrack),
+                                      dbiplus::field_value(strMusicBrainzTrackID)});
+      }
       else
-        strSQL = PrepareSQL("SELECT idSong FROM song WHERE "
-                            "idAlbum=%i AND strFileName='%s' AND strTitle='%s' AND iTrack=%i "
-                            "AND strMusicBrainzTrackID IS NULL",
-                            idAlbum, strFileName.c_str(), strTitle.c_str(), iTrack);
+      {
+        strSQL = "SELECT idSong FROM song WHERE "
+                 "idAlbum = ? AND strFileName = ? AND strTitle = ? AND iTrack = ? "
+                 "AND strMusicBrainzTrackID IS NULL";
+        found = m_pDS->query(strSQL, {dbiplus::field_value(idAlbum),
+                                      dbiplus::field_value(strFileName),
+                                      dbiplus::field_value(strTitle), dbiplus::field_value(iTrack)});
+      }
 
-      if (!m_pDS->query(strSQL))
+      if (!found)
         return -1;
     }
     if (m_pDS->num_rows() == 0)
@@ -1299,18 +1303,7 @@ bool CMusicDatabase::UpdateSong(CSong& song, bool bArtists /*= true*/, bool bArt
   {
     //Replace song artists and contributors
     DeleteSongArtistsBySong(song.idSong);
-    // Song must have at least one artist so set artist to [Missing]
-    if (song.artistCredits.empty())
-      AddSongArtist(BLANKARTIST_ID, song.idSong, ROLE_ARTIST, BLANKARTIST_NAME, 0);
-    for (auto artistCredit = song.artistCredits.begin(); artistCredit != song.artistCredits.end();
-         ++artistCredit)
-    {
-      artistCredit->idArtist =
-          AddArtist(artistCredit->GetArtist(), artistCredit->GetMusicBrainzArtistID(),
-                    artistCredit->GetSortName());
-      AddSongArtist(artistCredit->idArtist, song.idSong, ROLE_ARTIST, artistCredit->GetArtist(),
-                    static_cast<int>(std::distance(song.artistCredits.begin(), artistCredit)));
-    }
+    AddSongArtists(song.idSong, song.artistCredits);
     // Having added artist credits (maybe with MBID) add the other contributing artists (MBID unknown)
     // and use COMPOSERSORT tag data to provide sort names for artists that are composers
     AddSongContributors(song.idSong, song.GetContributors(), song.GetComposerSort());
@@ -1408,7 +1401,11 @@ int CMusicDatabase::UpdateSong(int idSong,
   bool status = ExecuteQuery(strSQL);
 
   if (status)
+  {
+    UpdateAlbumPlayed(GetSingleValueInt(PrepareSQL("SELECT idAlbum FROM song WHERE idSong = %i",
+                                                   idSong)));
     AnnounceUpdate(MediaTypeSong, idSong);
+  }
   return idSong;
 }
 
@@ -1938,6 +1935,11 @@ int CMusicDatabase::AddArtist(const std::string& strArtist,
     }
     else
     {
+      // scans credit the same artists on song after song, most of them without MusicBrainz ID
+      auto it = m_artistCache.find(strArtist);
+      if (it != m_artistCache.end())
+        return it->second;
+
       strSQL =
           PrepareSQL("SELECT idArtist FROM artist WHERE strArtist LIKE '%s'", strArtist.c_str());
 
@@ -1946,6 +1948,7 @@ int CMusicDatabase::AddArtist(const std::string& strArtist,
       {
         int idArtist = m_pDS->fv("idArtist").get_asInt();
         m_pDS->close();
+        m_artistCache.try_emplace(strArtist, idArtist);
         return idArtist;
       }
       m_pDS->close();
@@ -1964,7 +1967,10 @@ int CMusicDatabase::AddArtist(const std::string& strArtist,
                           strArtist.c_str(), strMusicBrainzArtistID.c_str(), bScrapedMBID);
 
     m_pDS->exec(strSQL);
-    return static_cast<int>(m_pDS->lastinsertid());
+    const auto idArtist = static_cast<int>(m_pDS->lastinsertid());
+    if (strMusicBrainzArtistID.empty())
+      m_artistCache.try_emplace(strArtist, idArtist);
+    return idArtist;
   }
   catch (...)
   {
@@ -1997,6 +2003,9 @@ int CMusicDatabase::UpdateArtist(int idArtist,
   if (idArtist < 0)
     return -1;
 
+  // the name may change, the cached lookups by name must not find the artist under the old one
+  m_artistCache.clear();
+
   // Check another artist with this mbid not already exist (an alias for example)
   bool useMBIDNull = strMusicBrainzArtistID.empty();
   bool isScrapedMBID = bScrapedMBID;
@@ -2493,6 +2502,12 @@ int CMusicDatabase::AddRole(std::string_view strRole)
       return -1;
     if (nullptr == m_pDS)
       return -1;
+
+    // every contributor of every song looks up its role, there are only a few of them
+    auto it = m_roleCache.find(strRole);
+    if (it != m_roleCache.end())
+      return it->second;
+
     strSQL = PrepareSQL("SELECT idRole FROM role WHERE strRole LIKE '%s'", strRole.data());
     m_pDS->query(strSQL);
     if (m_pDS->num_rows() > 0)
@@ -2506,6 +2521,7 @@ int CMusicDatabase::AddRole(std::string_view strRole)
       idRole = static_cast<int>(m_pDS->lastinsertid());
       m_pDS->close();
     }
+    m_roleCache.try_emplace(std::string(strRole), idRole);
   }
   catch (...)
   {
@@ -2531,6 +2547,32 @@ bool CMusicDatabase::AddSongArtist(
   return ExecuteQuery(strSQL);
 }
 
+bool CMusicDatabase::AddSongArtists(int idSong, std::vector<CArtistCredit>& artistCredits)
+{
+  // Song must have at least one artist so set artist to [Missing]
+  if (artistCredits.empty())
+    return AddSongArtist(BLANKARTIST_ID, idSong, ROLE_ARTIST, BLANKARTIST_NAME, 0);
+
+  // all the links of the song are written with a single statement
+  std::vector<std::string> values;
+  values.reserve(artistCredits.size());
+  for (auto artistCredit = artistCredits.begin(); artistCredit != artistCredits.end();
+       ++artistCredit)
+  {
+    artistCredit->idArtist = AddArtist(artistCredit->GetArtist(),
+                                       artistCredit->GetMusicBrainzArtistID(),
+                                       artistCredit->GetSortName());
+    // we don't have song artist breakdowns from scrapers, yet
+    values.emplace_back(PrepareSQL(
+        "(%i, %i, %i, '%s', %i)", artistCredit->idArtist, idSong, ROLE_ARTIST,
+        artistCredit->GetArtist().c_str(),
+        static_cast<int>(std::distance(artistCredits.begin(), artistCredit))));
+  }
+  return ExecuteQuery("REPLACE INTO song_artist (idArtist, idSong, idRole, strArtist, iOrder) "
+                      "VALUES " +
+                      StringUtils::Join(values, ", "));
+}
+
 int CMusicDatabase::AddSongContributor(int idSong,
                                        const std::string& strRole,
                                        const std::string& strArtist,
@@ -2704,11 +2746,17 @@ bool CMusicDatabase::AddSongGenres(int idSong, const std::vector<std::string>& g
       return false;
     unsigned int index = 0;
     std::vector<std::string> modgenres = genres;
+    std::vector<std::string> values;
+    values.reserve(modgenres.size());
     for (auto& strGenre : modgenres)
     {
       int idGenre = AddGenre(strGenre); // Genre string trimmed and matched case-insensitively
-      strSQL = PrepareSQL("INSERT INTO song_genre (idGenre, idSong, iOrder) VALUES(%i,%i,%i)",
-                          idGenre, idSong, index++);
+      values.emplace_back(PrepareSQL("(%i,%i,%i)", idGenre, idSong, index++));
+    }
+    if (!values.empty())
+    {
+      strSQL = "INSERT INTO song_genre (idGenre, idSong, iOrder) VALUES " +
+               StringUtils::Join(values, ",");
       if (!ExecuteQuery(strSQL))
         return false;
     }
@@ -3077,8 +3125,8 @@ int CMusicDatabase::AddPath(const std::string& strPath1)
     if (it != m_pathCache.end())
       return it->second;
 
-    strSQL = PrepareSQL("SELECT * FROM path WHERE strPath='%s'", strPath.c_str());
-    m_pDS->query(strSQL);
+    strSQL = "SELECT * FROM path WHERE strPath = ?";
+    m_pDS->query(strSQL, {dbiplus::field_value(strPath)});
     if (m_pDS->num_rows() == 0)
     {
       m_pDS->close();
@@ -4055,6 +4103,8 @@ void CMusicDatabase::IncrementPlayCount(const CFileItem& item)
                                  "WHERE idSong=%i",
                                  strDateNow.c_str(), idSong);
     m_pDS->exec(sql);
+    UpdateAlbumPlayed(
+        GetSingleValueInt(PrepareSQL("SELECT idAlbum FROM song WHERE idSong = %i", idSong)));
   }
   catch (...)
   {
@@ -4129,6 +4179,8 @@ void CMusicDatabase::EmptyCache()
 {
   m_genreCache.erase(m_genreCache.begin(), m_genreCache.end());
   m_pathCache.erase(m_pathCache.begin(), m_pathCache.end());
+  m_roleCache.clear();
+  m_artistCache.clear();
 }
 
 bool CMusicDatabase::Search(const std::string& search, CFileItemList& items)
@@ -4581,6 +4633,30 @@ bool CMusicDatabase::DeleteRemovedLinks()
   return false;
 }
 
+void CMusicDatabase::UpdateAlbumPlayed(int idAlbum /* = -1 */)
+{
+  std::string strSQL;
+  try
+  {
+    if (nullptr == m_pDB)
+      return;
+    if (nullptr == m_pDS)
+      return;
+
+    const std::string where = idAlbum < 0 ? "" : PrepareSQL(" WHERE idAlbum = %i", idAlbum);
+    strSQL = "DELETE FROM album_played" + where;
+    m_pDS->exec(strSQL);
+    strSQL = "INSERT INTO album_played (idAlbum, iTimesPlayed, lastplayed) "
+             "SELECT idAlbum, ROUND(AVG(iTimesPlayed)), MAX(lastplayed) FROM song" +
+             where + " GROUP BY idAlbum";
+    m_pDS->exec(strSQL);
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed ({})", strSQL);
+  }
+}
+
 bool CMusicDatabase::CleanupOrphanedItems()
 {
   // paths aren't cleaned up here - they're cleaned up in RemoveSongsFromPath()
@@ -4590,6 +4666,10 @@ bool CMusicDatabase::CleanupOrphanedItems()
   if (nullptr == m_pDS)
     return false;
   SetLibraryLastUpdated();
+  // artists, genres and roles are removed, so their cached ids may no longer exist
+  EmptyCache();
+  // albums may have lost songs
+  UpdateAlbumPlayed();
   if (!CleanupAlbums())
     return false;
   if (!CleanupArtists())
@@ -6246,6 +6326,12 @@ bool CMusicDatabase::GetSongsFullByWhere(const std::string& baseDir,
     if (extended)
       extFilter.AppendGroup("songview.idSong");
 
+    // A random pick of a few songs only reads the rows of a sample of their ids, the random sort
+    // below then only shuffles those
+    if (limitedInSQL && sorting.sortBy == SortBy::RANDOM && sorting.limitStart == 0 &&
+        sorting.limitEnd > 0 && total > sorting.limitEnd)
+      RestrictToRandomIds("songview", "songview.idSong", sorting.limitEnd, extFilter);
+
     // Apply any limiting directly in SQL
     if (limitedInSQL)
     {
@@ -7237,11 +7323,11 @@ const std::array<TranslateJSONField, 35> JSONtoDBAlbum = {{
   { "totaldiscs",               "integer", true,  "iDiscTotal",             "" },
   { "sortartist",                "string", true,  "strArtistSort",          "" },
   { "musicbrainzreleasegroupid", "string", true,  "strReleaseGroupMBID",    "" },
-  { "playcount",                "integer", true,  "iTimesPlayed",           "" },  // Scalar subquery in view
+  { "playcount",                "integer", true,  "iTimesPlayed",           "" },  // From album_played in view
   { "dateadded",                 "string", true,  "dateAdded",              "" },
   { "datenew",                   "string", true,  "dateNew",                "" },
   { "datemodified",              "string", true,  "dateModified",           "" },
-  { "lastplayed",                "string", true,  "lastPlayed",             "" },  // Scalar subquery in view
+  { "lastplayed",                "string", true,  "lastPlayed",             "" },  // From album_played in view
   { "originaldate",              "string", true,  "strOrigReleaseDate",     "" },
   { "releasedate",               "string", true,  "strReleaseDate",         "" },
   { "albumstatus",               "string", true,  "strReleaseStatus",       "" },
@@ -7261,12 +7347,8 @@ const std::array<TranslateJSONField, 35> JSONtoDBAlbum = {{
    Album "fanart" and "art" fields of JSON schema are fetched using thumbloader
    and separate queries to allow for fallback strategy.
 
-   Using albmview, rather than album table, as view has scalar subqueries for
-   playcount and lastplayed already defined. Needed as MySQL does
-   not support use of scalar subquery field alias names in where clauses (they
-   have to be repeated) and these fields can be used by filter rules.
-   Using this view is no slower than the album table as these scalar fields are
-   only calculated (slowing query) when field is in field list.
+   Using albmview, rather than album table, as view has playcount and lastplayed
+   already joined from album_played. These fields can be used by filter rules.
    */
 }};
 // clang-format on
@@ -9362,6 +9444,16 @@ void CMusicDatabase::UpdateTables(int version)
   if (version < 83)
     m_pDS->exec("ALTER TABLE song ADD strVideoURL TEXT");
 
+  if (version < 85)
+  {
+    // Album playcount and last played date held in a table rather than aggregated by albumview
+    m_pDS->exec("CREATE TABLE album_played (idAlbum INTEGER PRIMARY KEY, "
+                "iTimesPlayed INTEGER NOT NULL DEFAULT 0, lastplayed VARCHAR(20) DEFAULT NULL)");
+    m_pDS->exec("INSERT INTO album_played (idAlbum, iTimesPlayed, lastplayed) "
+                "SELECT idAlbum, ROUND(AVG(iTimesPlayed)), MAX(lastplayed) FROM song "
+                "GROUP BY idAlbum");
+  }
+
   // Set the version of tag scanning required.
   // Not every schema change requires the tags to be rescanned, set to the highest schema version
   // that needs this. Forced rescanning (of music files that have not changed since they were
@@ -9382,7 +9474,7 @@ void CMusicDatabase::UpdateTables(int version)
 
 int CMusicDatabase::GetSchemaVersion() const
 {
-  return 84;
+  return 85;
 }
 
 int CMusicDatabase::GetMusicNeedsTagScan()
@@ -11481,10 +11573,9 @@ int CMusicDatabase::GetSongIDFromPath(const std::string& filePath)
     SplitPath(filePath, strPath, strFileName);
     URIUtils::AddSlashAtEnd(strPath);
 
-    std::string sql = PrepareSQL("SELECT idSong FROM song JOIN path ON song.idPath = path.idPath "
-                                 "WHERE song.strFileName='%s' AND path.strPath='%s'",
-                                 strFileName.c_str(), strPath.c_str());
-    if (!m_pDS->query(sql))
+    if (!m_pDS->query("SELECT idSong FROM song JOIN path ON song.idPath = path.idPath "
+                      "WHERE song.strFileName = ? AND path.strPath = ?",
+                      {dbiplus::field_value(strFileName), dbiplus::field_value(strPath)}))
       return -1;
 
     if (m_pDS->num_rows() == 0)
@@ -11857,6 +11948,20 @@ void CMusicDatabase::ExportToXML(const CLibExportSettings& settings,
     if (nullptr == m_pDS2)
       return;
 
+    // A single file is written item by item, without keeping the library in memory
+    std::string xmlFile;
+    CXMLStreamWriter xmlWriter;
+    if (settings.IsSingleFile())
+    {
+      xmlFile = URIUtils::AddFileToFolder(
+          strFolder, "kodi_musicdb" + CDateTime::GetCurrentDateTime().GetAsDBDate() + ".xml");
+      if (CFile::Exists(xmlFile))
+        xmlFile = URIUtils::AddFileToFolder(
+            strFolder, "kodi_musicdb" + CDateTime::GetCurrentDateTime().GetAsSaveString() + ".xml");
+      if (!xmlWriter.Open(xmlFile, "musicdb"))
+        return;
+    }
+
     // Create our xml document
     CXBMCTinyXML xmlDoc;
     TiXmlDeclaration decl("1.0", "UTF-8", "yes");
@@ -11906,6 +12011,7 @@ void CMusicDatabase::ExportToXML(const CLibExportSettings& settings,
         {
           // Save album to xml, including album path
           album.Save(pMain, "album", strAlbumPath);
+          xmlWriter.Flush(*pMain);
         }
         else
         { // Separate files and artwork
@@ -12018,7 +12124,7 @@ void CMusicDatabase::ExportToXML(const CLibExportSettings& settings,
     // Export song playback history to single file only
     if (settings.IsSingleFile() && settings.IsItemExported(ELIBEXPORT_SONGS))
     {
-      if (!ExportSongHistory(pMain, progressDialog))
+      if (!ExportSongHistory(pMain, progressDialog, &xmlWriter))
         return;
     }
 
@@ -12088,6 +12194,7 @@ void CMusicDatabase::ExportToXML(const CLibExportSettings& settings,
               XMLUtils::SetString(&additionalNode, type.c_str(), url);
             pMain->LastChild()->InsertEndChild(additionalNode);
           }
+          xmlWriter.Flush(*pMain);
         }
         else
         { // Separate files: artist.nfo and artwork in strFolder/<artist name>
@@ -12158,12 +12265,9 @@ void CMusicDatabase::ExportToXML(const CLibExportSettings& settings,
 
     if (settings.IsSingleFile())
     {
-      std::string xmlFile = URIUtils::AddFileToFolder(
-          strFolder, "kodi_musicdb" + CDateTime::GetCurrentDateTime().GetAsDBDate() + ".xml");
-      if (CFile::Exists(xmlFile))
-        xmlFile = URIUtils::AddFileToFolder(
-            strFolder, "kodi_musicdb" + CDateTime::GetCurrentDateTime().GetAsSaveString() + ".xml");
-      xmlDoc.SaveFile(xmlFile);
+      xmlWriter.Flush(*pMain);
+      if (!xmlWriter.Close())
+        iFailCount++;
 
       CVariant data;
       data["file"] = xmlFile;
@@ -12189,7 +12293,9 @@ void CMusicDatabase::ExportToXML(const CLibExportSettings& settings,
             CServiceBroker::GetResourcesComponent().GetLocalizeStrings().Get(15011), iFailCount)});
 }
 
-bool CMusicDatabase::ExportSongHistory(TiXmlNode* pNode, CGUIDialogProgress* progressDialog)
+bool CMusicDatabase::ExportSongHistory(TiXmlNode* pNode,
+                                       CGUIDialogProgress* progressDialog /* = nullptr */,
+                                       CXMLStreamWriter* writer /* = nullptr */)
 {
   try
   {
@@ -12235,6 +12341,9 @@ bool CMusicDatabase::ExportSongHistory(TiXmlNode* pNode, CGUIDialogProgress* pro
       if (userrating)
         userrating->ToElement()->SetAttribute("max", 10);
 
+      if ((current % 100) == 0 && writer)
+        writer->Flush(*pNode);
+
       if ((current % 100) == 0 && progressDialog)
       {
         progressDialog->SetLine(1, CVariant{m_pDS->fv("strAlbum").get_asString()});
@@ -12677,6 +12786,7 @@ bool CMusicDatabase::ImportSongHistory(const std::string& xmlFile,
         return false;
       }
     }
+    UpdateAlbumPlayed();
     CommitTransaction();
 
     // Tidy up temp table (index also removed)
@@ -13942,12 +14052,42 @@ std::vector<std::string> CMusicDatabase::GetUsedImages(
     sql.pop_back(); // remove last ','
     sql += ")";
 
-    // add arttype filters if set to "Basic"
-    if (artworkLevel == CSettings::MUSICLIBRARY_ARTWORK_LEVEL_BASIC)
+    sql += GetArtworkLevelFilter(artworkLevel);
+
+    if (!m_pDS->query(sql))
+      return {};
+
+    std::vector<std::string> result;
+    while (!m_pDS->eof())
     {
-      sql += PrepareSQL(" AND (media_type = 'album' AND type = 'thumb' OR media_type = 'artist' "
-                        "AND type IN ('thumb', 'fanart'))");
+      result.push_back(m_pDS->fv(0).get_asString());
+      m_pDS->next();
     }
+    m_pDS->close();
+
+    return result;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+  }
+  return {};
+}
+
+std::vector<std::string> CMusicDatabase::GetArtURLs() const
+{
+  try
+  {
+    if (!m_pDB || !m_pDS)
+      return {};
+
+    int artworkLevel = CServiceBroker::GetSettingsComponent()->GetSettings()->GetInt(
+        CSettings::SETTING_MUSICLIBRARY_ARTWORKLEVEL);
+    if (artworkLevel == CSettings::MUSICLIBRARY_ARTWORK_LEVEL_NONE)
+      return {};
+
+    std::string sql = "SELECT DISTINCT url FROM art WHERE url <> ''";
+    sql += GetArtworkLevelFilter(artworkLevel);
 
     if (!m_pDS->query(sql))
       return {};
@@ -13968,3 +14108,12 @@ std::vector<std::string> CMusicDatabase::GetUsedImages(
   }
   return {};
 }
+
+std::string CMusicDatabase::GetArtworkLevelFilter(int artworkLevel) const
+{
+  // add arttype filters if set to "Basic"
+  if (artworkLevel == CSettings::MUSICLIBRARY_ARTWORK_LEVEL_BASIC)
+    return " AND (media_type = 'album' AND type = 'thumb' OR media_type = 'artist' "
+           "AND type IN ('thumb', 'fanart'))";
+  return {};
+}
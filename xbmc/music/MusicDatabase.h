@@ -36,6 +36,7 @@ class CMediaSource;
 class CMusicDbUrl;
 class CMusicRole;
 class CSong;
+class CXMLStreamWriter;
 enum class ReleaseType;
 class ReplayGain;
 class TiXmlNode;
@@ -488,6 +489,7 @@ public:
   bool AddSongArtist(
       int idArtist, int idSong, std::string_view strRole, std::string_view strArtist, int iOrder);
   bool AddSongArtist(int idArtist, int idSong, int idRole, std::string_view strArtist, int iOrder);
+  bool AddSongArtists(int idSong, std::vector<CArtistCredit>& artistCredits);
   int AddSongContributor(int idSong,
                          const std::string& strRole,
                          const std::string& strArtist,
@@ -702,7 +704,13 @@ public:
   /////////////////////////////////////////////////
   void ExportToXML(const CLibExportSettings& settings,
                    CGUIDialogProgress* progressDialog = nullptr);
-  bool ExportSongHistory(TiXmlNode* pNode, CGUIDialogProgress* progressDialog = nullptr);
+  /*!
+   * \brief Add the songs with a playback history to a node.
+   * \param writer if given, the songs are written to it as they are added
+   */
+  bool ExportSongHistory(TiXmlNode* pNode,
+                         CGUIDialogProgress* progressDialog = nullptr,
+                         CXMLStreamWriter* writer = nullptr);
   void ImportFromXML(const std::string& xmlFile, CGUIDialogProgress* progressDialog = nullptr);
   bool ImportSongHistory(const std::string& xmlFile,
                          const int total,
@@ -873,6 +881,13 @@ public:
    */
   std::vector<std::string> GetUsedImages(const std::vector<std::string>& imagesToCheck) const;
 
+  /*!
+   * @brief Get the distinct art URLs of the library, limited to the configured artwork level.
+   * Used to pre-cache the library images.
+   * @return the art URLs.
+   */
+  std::vector<std::string> GetArtURLs() const;
+
 protected:
   void CreateTables() override;
   void CreateAnalytics() override;
@@ -882,6 +897,12 @@ protected:
   const char* GetBaseDBName() const override { return "MyMusic"; }
 
 private:
+  /*! \brief Get the SQL limiting the art table to the art types of the given artwork level
+   \param artworkLevel the musiclibrary.artworklevel setting
+   \return " AND (...)" to append to a query, empty to keep all art
+   */
+  std::string GetArtworkLevelFilter(int artworkLevel) const;
+
   /*! \brief (Re)Create the generic database views for songs and albums
    */
   virtual void CreateViews();
@@ -916,6 +937,12 @@ private:
 
   bool DeleteRemovedLinks();
 
+  /*! \brief Update the playcount and last played date of albums from their songs
+   Navigation reads them from the album_played table instead of aggregating the songs every time.
+   \param idAlbum the album whose songs changed, -1 to update all albums
+   */
+  void UpdateAlbumPlayed(int idAlbum = -1);
+
   bool CleanupSongs(CGUIDialogProgress* progressDialog = nullptr);
   bool CleanupSongsByIds(const std::string& strSongIds);
   bool CleanupPaths();
@@ -976,6 +1003,8 @@ private:
 
   std::map<std::string, int, std::less<>> m_genreCache;
   std::map<std::string, int, std::less<>> m_pathCache;
+  std::map<std::string, int, std::less<>> m_roleCache;
+  std::map<std::string, int, std::less<>> m_artistCache; ///< artists added or found by name only
   bool m_translateBlankArtist{true};
 
   // Fields should be ordered as they
@@ -50,6 +50,7 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/CriticalSection.h"
 #include "utils/Digest.h"
 #include "utils/FileExtensionProvider.h"
 #include "utils/FileUtils.h"
@@ -59,8 +60,11 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <mutex>
 #include <string_view>
+#include <thread>
 #include <utility>
+#include <vector>
 
 using namespace KODI;
 using namespace MUSIC_INFO;
@@ -70,6 +74,14 @@ using namespace MUSIC_GRABBER;
 using namespace ADDON;
 using KODI::UTILITY::CDigest;
 
+namespace
+{
+// reading tags mostly waits on the file system, more readers than that just queue up on a share
+constexpr unsigned int MAX_TAG_READERS = 4;
+// every commit syncs the database file, a folder with many albums is written in a few of them
+constexpr int SONGS_PER_COMMIT = 500;
+} // unnamed namespace
+
 CMusicInfoScanner::CMusicInfoScanner()
 : m_fileCountReader(this, "MusicFileCounter")
 {
@@ -587,11 +599,9 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
   std::vector<std::string> regexps =
       CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_audioExcludeFromScanRegExps;
 
+  std::vector<CFileItemPtr> songItems;
   for (int i = 0; i < items.Size(); ++i)
   {
-    if (m_bStop)
-      return InfoRet::CANCELLED;
-
     CFileItemPtr pItem = items[i];
 
     if (CUtil::ExcludeFileOrFolder(pItem->GetPath(), regexps, &m_regexpCache))
@@ -601,21 +611,19 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
         MUSIC::IsLyrics(*pItem))
       continue;
 
+    songItems.emplace_back(pItem);
+  }
+
+  LoadTags(songItems);
+
+  for (const auto& pItem : songItems)
+  {
+    if (m_bStop)
+      return InfoRet::CANCELLED;
+
     m_currentItem++;
 
     CMusicInfoTag& tag = *pItem->GetMusicInfoTag();
-    // Forced rescan must re-read tags from disk even if the item arrives with
-    // tag.Loaded() already true (e.g. DB-enriched directory listings). The
-    // folder-level SCAN_RESCAN check above (line 521) bypasses the path-hash
-    // skip, but without this check ScanTags would still reuse cached tag
-    // state on a per-file basis, defeating "Do full tag scan even when
-    // unchanged".
-    if (!tag.Loaded() || (m_flags & SCAN_RESCAN))
-    {
-      std::unique_ptr<IMusicInfoTagLoader> pLoader (CMusicInfoTagLoaderFactory::CreateLoader(*pItem));
-      if (nullptr != pLoader)
-        pLoader->Load(pItem->GetPath(), tag);
-    }
 
     if (m_handle && m_itemCount>0)
       m_handle->SetPercentage(static_cast<float>(m_currentItem * 100) / static_cast<float>(m_itemCount));
@@ -639,6 +647,58 @@ CInfoScanner::InfoRet CMusicInfoScanner::ScanTags(const CFileItemList& items,
   return InfoRet::ADDED;
 }
 
+void CMusicInfoScanner::LoadTags(const std::vector<std::shared_ptr<CFileItem>>& items)
+{
+  CCriticalSection section;
+  size_t next = 0;
+
+  // the items are independent, every reader takes the next one that isn't loaded yet
+  const auto reader = [this, &items, &section, &next]()
+  {
+    while (!m_bStop)
+    {
+      size_t index;
+      {
+        std::unique_lock lock(section);
+        if (next == items.size())
+          return;
+        index = next++;
+      }
+
+      CFileItem& item = *items[index];
+      CMusicInfoTag& tag = *item.GetMusicInfoTag();
+      // Forced rescan must re-read tags from disk even if the item arrives with
+      // tag.Loaded() already true (e.g. DB-enriched directory listings). The
+      // folder-level SCAN_RESCAN check in DoScan bypasses the path-hash
+      // skip, but without this check ScanTags would still reuse cached tag
+      // state on a per-file basis, defeating "Do full tag scan even when
+      // unchanged".
+      if (!tag.Loaded() || (m_flags & SCAN_RESCAN))
+      {
+        std::unique_ptr<IMusicInfoTagLoader> pLoader(
+            CMusicInfoTagLoaderFactory::CreateLoader(item));
+        if (nullptr != pLoader)
+          pLoader->Load(item.GetPath(), tag);
+      }
+    }
+  };
+
+  const unsigned int readers =
+      static_cast<unsigned int>(std::min<size_t>(MAX_TAG_READERS, items.size()));
+  if (readers <= 1)
+  {
+    reader();
+    return;
+  }
+
+  std::vector<std::thread> threads;
+  for (unsigned int i = 1; i < readers; ++i)
+    threads.emplace_back(reader);
+  reader();
+  for (auto& thread : threads)
+    thread.join();
+}
+
 static bool SortSongsByTrack(const CSong& song, const CSong& song2)
 {
   return song.iTrack < song2.iTrack;
@@ -983,8 +1043,10 @@ int CMusicInfoScanner::RetrieveMusicInfo(const std::string& strDirectory, CFileI
   */
 
   int numAdded = 0;
+  int numUncommitted = 0;
 
   // Add all albums to the library, and hence any new song or album artists or other contributors
+  m_musicDatabase.BeginTransaction();
   for (auto& album : albums)
   {
     if (m_bStop)
@@ -999,7 +1061,15 @@ int CMusicInfoScanner::RetrieveMusicInfo(const std::string& strDirectory, CFileI
     m_albumsAdded.insert(album.idAlbum);
 
     numAdded += static_cast<int>(album.songs.size());
+    numUncommitted += static_cast<int>(album.songs.size());
+    if (numUncommitted >= SONGS_PER_COMMIT)
+    {
+      m_musicDatabase.CommitTransaction();
+      m_musicDatabase.BeginTransaction();
+      numUncommitted = 0;
+    }
   }
+  m_musicDatabase.CommitTransaction();
   return numAdded;
 }
 
@@ -1186,10 +1256,20 @@ void CMusicInfoScanner::FindArtForAlbums(std::vector<CAlbum>& albums, const std:
     }
     else
     { // more than one piece of art was found for these songs, so cache per song
+      // songs with the same embedded image refer to the first of them, so the image is only
+      // extracted and cached once instead of once per song
+      std::vector<const CSong*> embedded;
       for (auto& k : album.songs)
       {
-        if (k.strThumb.empty() && !k.embeddedArt.Empty())
-          k.strThumb = IMAGE_FILES::URLFromFile(k.strFileName, "music");
+        if (!k.strThumb.empty() || k.embeddedArt.Empty())
+          continue;
+        const auto match =
+            std::find_if(embedded.begin(), embedded.end(), [&k](const CSong* song)
+                         { return song->embeddedArt.Matches(k.embeddedArt); });
+        k.strThumb = IMAGE_FILES::URLFromFile(
+            match != embedded.end() ? (*match)->strFileName : k.strFileName, "music");
+        if (match == embedded.end())
+          embedded.push_back(&k);
       }
     }
   }
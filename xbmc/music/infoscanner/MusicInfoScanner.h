@@ -14,10 +14,13 @@
 #include "threads/Thread.h"
 #include "utils/RegExp.h"
 
+#include <memory>
 #include <string>
+#include <vector>
 
 class CAlbum;
 class CArtist;
+class CFileItem;
 class CFileItemList;
 class CGUIDialogProgressBarHandle;
 class CScraperUrl;
@@ -259,6 +262,12 @@ protected:
    \param scannedItems [in] list to populate with the scannedItems
    */
   InfoRet ScanTags(const CFileItemList& items, CFileItemList& scannedItems);
+
+  /*! \brief Load the tags of the given songs, several files are read at the same time
+   \param items the songs, their tags are loaded unless they are already and this isn't a rescan
+   */
+  void LoadTags(const std::vector<std::shared_ptr<CFileItem>>& items);
+
   int GetPathHash(const CFileItemList &items, std::string &hash);
 
   void Run() override;
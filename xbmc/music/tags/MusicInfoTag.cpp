@@ -751,9 +751,10 @@ void CMusicInfoTag::SetMusicBrainzReleaseType(std::string_view releaseType)
   m_strMusicBrainzReleaseType = releaseType;
 }
 
-void CMusicInfoTag::SetCoverArtInfo(size_t size, const std::string &mimeType)
+void CMusicInfoTag::SetCoverArtInfo(const uint8_t* data, size_t size, const std::string& mimeType)
 {
   m_coverArt.Set(size, mimeType);
+  m_coverArt.SetHash(data, size);
 }
 
 void CMusicInfoTag::SetReplayGain(const ReplayGain& aGain)
@@ -883,7 +884,8 @@ void CMusicInfoTag::SetSong(const CSong& song)
   SetDateAdded(song.dateAdded);
   SetDateUpdated(song.dateUpdated);
   SetDateNew(song.dateNew);
-  SetCoverArtInfo(song.embeddedArt.m_size, song.embeddedArt.m_mime);
+  m_coverArt.Set(song.embeddedArt.m_size, song.embeddedArt.m_mime);
+  m_coverArt.m_hash = song.embeddedArt.m_hash;
   SetRating(song.rating);
   SetUserrating(song.userrating);
   SetVotes(song.votes);
@@ -918,7 +920,7 @@ void CMusicInfoTag::Serialize(CVariant& value) const
   if (m_type.compare(MediaTypeArtist) == 0 && m_artist.size() == 1)
     value["artist"] = m_artist[0];
   else
-    value["artist"] = m_artist;
+    value["artist"] = GetArtist();
   // There are situations where the individual artist(s) are not queried from the song_artist and artist tables e.g. playlist,
   // only artist description from song table. Since processing of the ARTISTS tag was added the individual artists may not always
   // be accurately derived by simply splitting the artist desc. Hence m_artist is only populated when the individual artists are
@@ -932,10 +934,10 @@ void CMusicInfoTag::Serialize(CVariant& value) const
   value["displayartist"] = GetArtistString();
   value["displayalbumartist"] = GetAlbumArtistString();
   value["sortartist"] = GetArtistSort();
-  value["album"] = m_strAlbum;
-  value["albumartist"] = m_albumArtist;
-  value["sortalbumartist"] = m_strAlbumArtistSort;
-  value["genre"] = m_genre;
+  value["album"] = GetAlbum();
+  value["albumartist"] = GetAlbumArtist();
+  value["sortalbumartist"] = GetAlbumArtistSort();
+  value["genre"] = GetGenre();
   value["duration"] = m_iDuration;
   value["track"] = GetTrackNumber();
   value["disc"] = GetDiscNumber();
@@ -1006,19 +1008,19 @@ void CMusicInfoTag::ToSortable(SortItem& sortable, Field field) const
       break;
     }
     case Field::ARTIST:
-      sortable[Field::ARTIST] = m_strArtistDesc;
+      sortable[Field::ARTIST] = m_strArtistDesc.Get();
       break;
     case Field::ARTIST_SORT:
-      sortable[Field::ARTIST_SORT] = m_strArtistSort;
+      sortable[Field::ARTIST_SORT] = GetArtistSort();
       break;
     case Field::ALBUM:
-      sortable[Field::ALBUM] = m_strAlbum;
+      sortable[Field::ALBUM] = GetAlbum();
       break;
     case Field::ALBUM_ARTIST:
-      sortable[Field::ALBUM_ARTIST] = m_strAlbumArtistDesc;
+      sortable[Field::ALBUM_ARTIST] = m_strAlbumArtistDesc.Get();
       break;
     case Field::GENRE:
-      sortable[Field::GENRE] = m_genre;
+      sortable[Field::GENRE] = GetGenre();
       break;
     case Field::TIME:
       sortable[Field::TIME] = m_iDuration;
@@ -15,6 +15,7 @@
 #include "utils/IArchivable.h"
 #include "utils/ISerializable.h"
 #include "utils/ISortable.h"
+#include "utils/SharedStrings.h"
 
 #include <string>
 #include <string_view>
@@ -147,7 +148,7 @@ public:
   void SetDateNew(const CDateTime& dateNew);
   void SetCompilation(bool compilation);
   void SetBoxset(bool boxset);
-  void SetCoverArtInfo(size_t size, const std::string &mimeType);
+  void SetCoverArtInfo(const uint8_t* data, size_t size, const std::string& mimeType);
   void SetReplayGain(const ReplayGain& aGain);
   void SetAlbumReleaseType(ReleaseType releaseType);
   void SetType(MediaType_view mediaType);
@@ -208,15 +209,16 @@ private:
 
   std::string m_strURL;
   std::string m_strTitle;
-  std::vector<std::string> m_artist;
-  std::string m_strArtistSort;
-  std::string m_strArtistDesc;
+  // repeated for every song of an artist or album, shared between the tags
+  CSharedStringList m_artist;
+  CSharedString m_strArtistSort;
+  CSharedString m_strArtistDesc;
   std::string m_strComposerSort;
-  std::string m_strAlbum;
-  std::vector<std::string> m_albumArtist;
-  std::string m_strAlbumArtistDesc;
-  std::string m_strAlbumArtistSort;
-  std::vector<std::string> m_genre;
+  CSharedString m_strAlbum;
+  CSharedStringList m_albumArtist;
+  CSharedString m_strAlbumArtistDesc;
+  CSharedString m_strAlbumArtistSort;
+  CSharedStringList m_genre;
   std::string m_strMusicBrainzTrackID;
   std::vector<std::string> m_musicBrainzArtistID;
   std::vector<std::string> m_musicBrainzArtistHints;
@@ -9,6 +9,8 @@
 
 #include "filesystem/File.h"
 
+#include <algorithm>
+#include <cstring>
 #include <limits>
 
 #include <taglib/taglib.h>
@@ -18,6 +20,14 @@ using namespace XFILE;
 using namespace TagLib;
 using namespace MUSIC_INFO;
 
+namespace
+{
+constexpr int64_t BLOCK_SIZE = 64 * 1024;
+// a 2 MB cache holds the head and the tail of any file, larger reads (pictures) bypass it
+constexpr size_t MAX_CACHED_BLOCKS = 32;
+constexpr size_t MAX_CACHED_READ = 4 * BLOCK_SIZE;
+} // unnamed namespace
+
 /*!
  * Construct a File object and opens the \a file.  \a file should be a
  * be an XBMC Vfile.
@@ -37,6 +47,12 @@ TagLibVFSStream::TagLibVFSStream(const std::string& strFileName, bool readOnly)
   }
   m_strFileName = strFileName;
   m_bIsReadOnly = readOnly || !m_bIsOpen;
+
+  if (readOnly && m_bIsOpen)
+  {
+    m_length = m_file.GetLength();
+    m_bIsCached = m_length > 0;
+  }
 }
 
 /*!
@@ -69,7 +85,8 @@ ByteVector TagLibVFSStream::readBlock(TagLib::ulong length)
 #else
   ByteVector byteVector(static_cast<TagLib::uint>(length));
 #endif
-  ssize_t read = m_file.Read(byteVector.data(), length);
+  ssize_t read = m_bIsCached ? readCached(byteVector.data(), length)
+                             : m_file.Read(byteVector.data(), length);
   if (read > 0)
     byteVector.resize(read);
   else
@@ -87,6 +104,91 @@ ByteVector TagLibVFSStream::readBlock(TagLib::ulong length)
  * for a ByteVector.  And even this function is significantly slower than
  * doing output with a char[].
  */
+ssize_t TagLibVFSStream::readCached(char* buffer, size_t length)
+{
+  if (m_position >= m_length || length == 0)
+    return 0;
+  length = static_cast<size_t>(std::min<int64_t>(length, m_length - m_position));
+
+  if (length > MAX_CACHED_READ)
+  {
+    if (m_file.Seek(m_position, SEEK_SET) != m_position)
+      return -1;
+    size_t done = 0;
+    while (done < length)
+    {
+      const ssize_t read = m_file.Read(buffer + done, length - done);
+      if (read <= 0)
+        break;
+      done += static_cast<size_t>(read);
+    }
+    m_position += static_cast<int64_t>(done);
+    return static_cast<ssize_t>(done);
+  }
+
+  size_t done = 0;
+  while (done < length)
+  {
+    const int64_t position = m_position + static_cast<int64_t>(done);
+    const int64_t index = position / BLOCK_SIZE;
+    auto it = m_blocks.find(index);
+    if (it == m_blocks.end())
+    {
+      // the blocks the read still needs are loaded together
+      const int64_t last = (m_position + static_cast<int64_t>(length) - 1) / BLOCK_SIZE;
+      int64_t end = index + 1;
+      while (end <= last && m_blocks.find(end) == m_blocks.end())
+        end++;
+      if (!loadBlocks(index, end))
+        break;
+      it = m_blocks.find(index);
+    }
+
+    const size_t offset = static_cast<size_t>(position - index * BLOCK_SIZE);
+    if (offset >= it->second.size())
+      break;
+    const size_t amount = std::min(length - done, it->second.size() - offset);
+    std::memcpy(buffer + done, it->second.data() + offset, amount);
+    done += amount;
+  }
+
+  m_position += static_cast<int64_t>(done);
+  return done > 0 ? static_cast<ssize_t>(done) : -1;
+}
+
+bool TagLibVFSStream::loadBlocks(int64_t first, int64_t end)
+{
+  const int64_t start = first * BLOCK_SIZE;
+  const size_t size = static_cast<size_t>(std::min(end * BLOCK_SIZE, m_length) - start);
+  std::vector<char> data(size);
+
+  if (m_file.Seek(start, SEEK_SET) != start)
+    return false;
+  size_t done = 0;
+  while (done < size)
+  {
+    const ssize_t read = m_file.Read(data.data() + done, size - done);
+    if (read <= 0)
+      break;
+    done += static_cast<size_t>(read);
+  }
+  if (done == 0)
+    return false;
+
+  if (m_blocks.size() + static_cast<size_t>(end - first) > MAX_CACHED_BLOCKS)
+    m_blocks.clear();
+
+  for (int64_t index = first; index < end; ++index)
+  {
+    const size_t offset = static_cast<size_t>((index - first) * BLOCK_SIZE);
+    if (offset >= done)
+      break;
+    const size_t amount = std::min(static_cast<size_t>(BLOCK_SIZE), done - offset);
+    m_blocks[index].assign(data.begin() + offset, data.begin() + offset + amount);
+  }
+  return true;
+}
+
 void TagLibVFSStream::writeBlock(const ByteVector &data)
 {
   m_file.Write(data.data(), data.size());
@@ -288,6 +390,23 @@ void TagLibVFSStream::seek(TagLib::offset_t offset, Position p)
 void TagLibVFSStream::seek(long offset, Position p)
 #endif
 {
+  if (m_bIsCached)
+  {
+    int64_t startPos;
+    if (p == Beginning)
+      startPos = 0;
+    else if (p == Current)
+      startPos = m_position;
+    else if (p == End)
+      startPos = m_length;
+    else
+      return; // wrong Position value
+
+    // the position is kept here, it is forced into the file like below
+    m_position = std::clamp<int64_t>(startPos + offset, 0, m_length);
+    return;
+  }
+
   const long fileLen = length();
   if (m_bIsReadOnly && fileLen > 0)
   {
@@ -347,7 +466,7 @@ void TagLibVFSStream::clear()
 #if (TAGLIB_MAJOR_VERSION >= 2)
 TagLib::offset_t TagLibVFSStream::tell() const
 {
-  int64_t pos = m_file.GetPosition();
+  int64_t pos = m_bIsCached ? m_position : m_file.GetPosition();
   if (pos > std::numeric_limits<TagLib::offset_t>::max())
     return -1;
   else
@@ -356,7 +475,7 @@ TagLib::offset_t TagLibVFSStream::tell() const
 #else
 long TagLibVFSStream::tell() const
 {
-  int64_t pos = m_file.GetPosition();
+  int64_t pos = m_bIsCached ? m_position : m_file.GetPosition();
   if (pos > std::numeric_limits<long>::max())
     return -1;
   else
@@ -370,11 +489,15 @@ long TagLibVFSStream::tell() const
 #if (TAGLIB_MAJOR_VERSION >= 2)
 TagLib::offset_t TagLibVFSStream::length()
 {
+  if (m_bIsCached)
+    return static_cast<TagLib::offset_t>(m_length);
   return static_cast<TagLib::offset_t>(m_file.GetLength());
 }
 #else
 long TagLibVFSStream::length()
 {
+  if (m_bIsCached)
+    return static_cast<long>(m_length);
   return static_cast<long>(m_file.GetLength());
 }
 #endif
@@ -10,6 +10,10 @@
 
 #include "filesystem/File.h"
 
+#include <map>
+#include <stdint.h>
+#include <vector>
+
 #include <taglib/taglib.h>
 #include <taglib/tiostream.h>
 
@@ -148,10 +152,22 @@ namespace MUSIC_INFO
 #endif
 
   private:
+    /*!
+     * Reads from the blocks of the file kept in memory, loading the missing ones in one request.
+     * TagLib reads small pieces at the start and the end of a file, on a network share each of
+     * them would cost a round trip.
+     */
+    ssize_t readCached(char* buffer, size_t length);
+    bool loadBlocks(int64_t first, int64_t end);
+
     std::string   m_strFileName;
     XFILE::CFile  m_file;
     bool          m_bIsReadOnly;
     bool          m_bIsOpen;
+    bool          m_bIsCached = false; //!< read-only with a known length, reads use m_blocks
+    int64_t       m_length = 0;
+    int64_t       m_position = 0;
+    std::map<int64_t, std::vector<char>> m_blocks; //!< by block index
   };
 }
 
@@ -109,7 +109,8 @@ void SetFlacArt(FLAC::File *flacFile, EmbeddedArt *art, CMusicInfoTag &tag)
   {
     if (c)
     {
-      tag.SetCoverArtInfo(c->data().size(), c->mimeType().to8Bit(true));
+      tag.SetCoverArtInfo(reinterpret_cast<const uint8_t*>(c->data().data()), c->data().size(),
+                          c->mimeType().to8Bit(true));
       if (art)
         art->Set(reinterpret_cast<const uint8_t*>(c->data().data()), c->data().size(), c->mimeType().to8Bit(true));
       return; // one is enough
@@ -221,7 +222,8 @@ bool CTagLoaderTagLib::ParseTag(ASF::Tag* asf,
     else if (it->first == "WM/Picture")
     { // picture
       ASF::Picture pic = it->second.front().toPicture();
-      tag.SetCoverArtInfo(pic.picture().size(), pic.mimeType().toCString());
+      tag.SetCoverArtInfo(reinterpret_cast<const uint8_t*>(pic.picture().data()),
+                          pic.picture().size(), pic.mimeType().toCString());
       if (art)
         art->Set(reinterpret_cast<const uint8_t *>(pic.picture().data()), pic.picture().size(), pic.mimeType().toCString());
     }
@@ -524,7 +526,7 @@ bool CTagLoaderTagLib::ParseTag(ID3v2::Tag* id3v2,
 #else
       TagLib::uint size =            picture->picture().size();
 #endif
-      tag.SetCoverArtInfo(size, mime);
+      tag.SetCoverArtInfo(reinterpret_cast<const uint8_t*>(picture->picture().data()), size, mime);
       if (art)
         art->Set(reinterpret_cast<const uint8_t*>(picture->picture().data()), size, mime);
 
@@ -668,7 +670,7 @@ bool CTagLoaderTagLib::ParseTag(APE::Tag* ape,
         mime = "image/bmp";
       if ((offset > 0) && (offset <= tdata.size()) && (!mime.empty()))
       {
-        tag.SetCoverArtInfo(bv.size(), mime);
+        tag.SetCoverArtInfo(reinterpret_cast<const uint8_t*>(bv.data()), bv.size(), mime);
         if (art)
           art->Set(reinterpret_cast<const uint8_t*>(bv.data()), bv.size(), mime);
       }
@@ -851,7 +853,7 @@ bool CTagLoaderTagLib::ParseTag(Ogg::XiphComment* xiph,
 #else
       TagLib::uint size =            pictures[i].data().size();
 #endif
-      tag.SetCoverArtInfo(size, mime);
+      tag.SetCoverArtInfo(reinterpret_cast<const uint8_t*>(pictures[i].data().data()), size, mime);
       if (art)
         art->Set(reinterpret_cast<const uint8_t*>(pictures[i].data().data()), size, mime);
 
@@ -873,7 +875,8 @@ bool CTagLoaderTagLib::ParseTag(Ogg::XiphComment* xiph,
   {
     if (c)
     {
-      tag.SetCoverArtInfo(c->data().size(), c->mimeType().to8Bit(true));
+      tag.SetCoverArtInfo(reinterpret_cast<const uint8_t*>(c->data().data()), c->data().size(),
+                          c->mimeType().to8Bit(true));
       if (art)
         art->Set(reinterpret_cast<const uint8_t*>(c->data().data()), c->data().size(), c->mimeType().to8Bit(true));
       break; // one is enough
@@ -1007,7 +1010,8 @@ bool CTagLoaderTagLib::ParseTag(MP4::Tag* mp4,
         }
         if (mime.empty())
           continue;
-        tag.SetCoverArtInfo(pt->data().size(), mime);
+        tag.SetCoverArtInfo(reinterpret_cast<const uint8_t*>(pt->data().data()), pt->data().size(),
+                            mime);
         if (art)
           art->Set(reinterpret_cast<const uint8_t *>(pt->data().data()), pt->data().size(), mime);
         break; // one is enough
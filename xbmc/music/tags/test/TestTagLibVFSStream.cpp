@@ -0,0 +1,82 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/File.h"
+#include "music/tags/TagLibVFSStream.h"
+#include "test/TestUtils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace MUSIC_INFO;
+
+namespace
+{
+constexpr size_t FILE_SIZE = 1024 * 1024 + 123;
+
+class TestTagLibVFSStream : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_data.resize(FILE_SIZE);
+    for (size_t i = 0; i < m_data.size(); ++i)
+      m_data[i] = static_cast<char>((i * 7 + i / 251) & 0xff);
+
+    ASSERT_NE(nullptr, m_file = XBMC_CREATETEMPFILE(""));
+    m_file->Close();
+    ASSERT_TRUE(m_file->OpenForWrite(XBMC_TEMPFILEPATH(m_file), true));
+    ASSERT_EQ(static_cast<ssize_t>(m_data.size()), m_file->Write(m_data.data(), m_data.size()));
+    m_file->Close();
+  }
+
+  void TearDown() override { EXPECT_TRUE(XBMC_DELETETEMPFILE(m_file)); }
+
+  void ExpectRead(TagLibVFSStream& stream, int64_t position, size_t length)
+  {
+    stream.seek(position);
+    const TagLib::ByteVector block = stream.readBlock(length);
+    const size_t expected = std::min(length, m_data.size() - static_cast<size_t>(position));
+    ASSERT_EQ(expected, block.size());
+    EXPECT_EQ(0, std::memcmp(m_data.data() + position, block.data(), expected));
+    EXPECT_EQ(position + static_cast<int64_t>(expected), static_cast<int64_t>(stream.tell()));
+  }
+
+  XFILE::CFile* m_file = nullptr;
+  std::vector<char> m_data;
+};
+} // namespace
+
+TEST_F(TestTagLibVFSStream, ReadsLikeTheFile)
+{
+  TagLibVFSStream stream(XBMC_TEMPFILEPATH(m_file), true);
+  ASSERT_TRUE(stream.isOpen());
+  EXPECT_EQ(static_cast<int64_t>(FILE_SIZE), static_cast<int64_t>(stream.length()));
+
+  // the way TagLib looks for tags: headers at the start, footers at the end
+  ExpectRead(stream, 0, 10);
+  ExpectRead(stream, 10, 4000);
+  ExpectRead(stream, FILE_SIZE - 128, 128);
+  ExpectRead(stream, FILE_SIZE - 160, 32);
+  // across blocks, larger than the cache handles and past the end
+  ExpectRead(stream, 65536 - 5, 10);
+  ExpectRead(stream, 100000, 300000);
+  ExpectRead(stream, 200000, 1024);
+  ExpectRead(stream, FILE_SIZE - 10, 100);
+
+  stream.seek(0, TagLib::IOStream::End);
+  EXPECT_EQ(0u, stream.readBlock(10).size());
+  stream.seek(-20, TagLib::IOStream::Current);
+  EXPECT_EQ(static_cast<int64_t>(FILE_SIZE - 20), static_cast<int64_t>(stream.tell()));
+  stream.seek(10, TagLib::IOStream::End);
+  EXPECT_EQ(static_cast<int64_t>(FILE_SIZE), static_cast<int64_t>(stream.tell()));
+}
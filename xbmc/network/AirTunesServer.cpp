@@ -62,6 +62,13 @@
 using namespace XFILE;
 using namespace std::chrono_literals;
 
+namespace
+{
+// shairplay delivers the audio in time from its own jitter buffer, anything the pipe holds on
+// top of this only delays the playback
+constexpr auto MAX_BUFFERED_AUDIO = 500ms;
+} // namespace
+
 CAirTunesServer *CAirTunesServer::ServerInstance = NULL;
 std::string CAirTunesServer::m_macAddress;
 std::string CAirTunesServer::m_metadata[3];
@@ -75,6 +82,8 @@ CCriticalSection CAirTunesServer::m_actionQueueLock;
 std::list<CAction> CAirTunesServer::m_actionQueue;
 CEvent CAirTunesServer::m_processActions;
 int CAirTunesServer::m_sampleRate = 44100;
+int64_t CAirTunesServer::m_maxBufferedBytes = 0;
+bool CAirTunesServer::m_droppingAudio = false;
 
 unsigned int CAirTunesServer::m_cachedStartTime = 0;
 unsigned int CAirTunesServer::m_cachedEndTime = 0;
@@ -385,6 +394,9 @@ void* CAirTunesServer::AudioOutputFunctions::audio_init(void *cls, int bits, int
   item->SetMimeType("audio/x-xbmc-pcm");
   m_streamStarted = true;
   m_sampleRate = samplerate;
+  m_maxBufferedBytes = static_cast<int64_t>(samplerate) * channels * (bits / 8) *
+                       MAX_BUFFERED_AUDIO.count() / 1000;
+  m_droppingAudio = false;
 
   CServiceBroker::GetAppMessenger()->PostMsg(TMSG_MEDIA_PLAY, 0, 0, static_cast<void*>(item));
 
@@ -505,7 +517,20 @@ void  CAirTunesServer::AudioOutputFunctions::audio_set_volume(void *cls, void *s
 void  CAirTunesServer::AudioOutputFunctions::audio_process(void *cls, void *session, const void *buffer, int buflen)
 {
   XFILE::CPipeFile *pipe=(XFILE::CPipeFile *)cls;
-  pipe->Write(buffer, buflen);
+
+  // drop the audio the player is behind instead of queueing it, the latency would never be
+  // caught up: while opening the player, or when it stalls
+  if (pipe->GetAvailableRead() + buflen > m_maxBufferedBytes)
+  {
+    if (!m_droppingAudio)
+      CLog::Log(LOGDEBUG, "AIRTUNES: Player is behind, dropping audio");
+    m_droppingAudio = true;
+  }
+  else
+  {
+    m_droppingAudio = false;
+    pipe->Write(buffer, buflen);
+  }
 
   // in case there are some play times cached that are not yet sent to the player - do it here
   InformPlayerAboutPlayTimes();
@@ -17,6 +17,7 @@
 #include "threads/CriticalSection.h"
 #include "threads/Thread.h"
 
+#include <cstdint>
 #include <list>
 #include <string>
 #include <vector>
@@ -84,6 +85,8 @@ private:
   static std::list<CAction> m_actionQueue;
   static CEvent m_processActions;
   static int m_sampleRate;
+  static int64_t m_maxBufferedBytes;
+  static bool m_droppingAudio;
   static unsigned int m_cachedStartTime;
   static unsigned int m_cachedEndTime;
   static unsigned int m_cachedCurrentTime;
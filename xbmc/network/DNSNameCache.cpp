@@ -9,9 +9,11 @@
 #include "DNSNameCache.h"
 
 #include "network/Network.h"
+#include "threads/Event.h"
 #include "utils/log.h"
 
 #include <mutex>
+#include <thread>
 #include <tuple>
 #include <utility>
 
@@ -29,6 +31,33 @@
 #include <sys/socket.h>
 #endif
 
+struct CDNSNameCache::PendingLookup
+{
+  CEvent m_finished{true};
+  std::string m_ip; //!< set by the query before m_finished, empty if it failed
+};
+
+namespace
+{
+std::string Resolve(const std::string& hostName)
+{
+  addrinfo hints{};
+  addrinfo* res;
+
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_flags |= AI_CANONNAME;
+
+  std::string ipAddress;
+  if (getaddrinfo(hostName.c_str(), nullptr, &hints, &res) == 0)
+  {
+    ipAddress = CNetworkBase::GetIpStr(res->ai_addr);
+    freeaddrinfo(res);
+  }
+  return ipAddress;
+}
+} // unnamed namespace
+
 bool CDNSNameCache::Lookup(const std::string& strHostName, std::string& strIpAddress)
 {
   if (strHostName.empty() && strIpAddress.empty())
@@ -47,27 +76,86 @@ bool CDNSNameCache::Lookup(const std::string& strHostName, std::string& strIpAdd
   }
 
   // check if there's a custom entry or if it's already cached
+  CollectPendingLookup(strHostName);
   if (GetCached(strHostName, strIpAddress))
     return true;
 
+  // don't wait for the resolver again if the host can't be resolved anyway
+  if (IsUnresolvable(strHostName))
+  {
+    CLog::Log(LOGDEBUG, "Host '{}' recently failed to resolve", strHostName);
+    return false;
+  }
+
   // perform dns lookup
-  addrinfo hints{};
-  addrinfo* res;
+  std::shared_ptr<PendingLookup> pending;
+  {
+    std::lock_guard lock(m_critical);
+    auto& lookup = m_pendingLookups[strHostName];
+    if (!lookup)
+    {
+      // the query only touches its own state, it may outlive the cache
+      lookup = std::make_shared<PendingLookup>();
+      std::thread(
+          [lookup, strHostName]()
+          {
+            lookup->m_ip = Resolve(strHostName);
+            lookup->m_finished.Set();
+          })
+          .detach();
+    }
+    pending = lookup;
+  }
 
-  hints.ai_family = AF_UNSPEC;
-  hints.ai_socktype = SOCK_STREAM;
-  hints.ai_flags |= AI_CANONNAME;
+  if (!pending->m_finished.Wait(LOOKUP_TIMEOUT))
+  {
+    // the result of the query replaces the failure once it is there
+    CLog::Log(LOGERROR, "Lookup of host '{}' timed out", strHostName);
+    AddResult(strHostName, "");
+    return false;
+  }
 
-  if (getaddrinfo(strHostName.c_str(), nullptr, &hints, &res) == 0)
+  CollectPendingLookup(strHostName);
+  if (pending->m_ip.empty())
   {
-    strIpAddress = CNetworkBase::GetIpStr(res->ai_addr);
-    freeaddrinfo(res);
-    Add(strHostName, strIpAddress);
-    return true;
+    CLog::Log(LOGERROR, "Unable to lookup host: '{}'", strHostName);
+    return false;
   }
 
-  CLog::Log(LOGERROR, "Unable to lookup host: '{}'", strHostName);
-  return false;
+  strIpAddress = pending->m_ip;
+  return true;
+}
+
+void CDNSNameCache::AddResult(const std::string& strHostName, const std::string& strIpAddress)
+{
+  std::lock_guard lock(m_critical);
+
+  const auto expirationTime =
+      std::chrono::steady_clock::now() + (strIpAddress.empty() ? NEGATIVE_TTL : TTL);
+  auto [iter, inserted] = m_hostToIp.try_emplace(strHostName, strIpAddress, expirationTime);
+  if (!inserted && iter->second.m_expirationTime)
+    iter->second = CacheEntry(strIpAddress, expirationTime);
+}
+
+void CDNSNameCache::CollectPendingLookup(const std::string& strHostName)
+{
+  std::lock_guard lock(m_critical);
+
+  auto iter = m_pendingLookups.find(strHostName);
+  if (iter == m_pendingLookups.end() || !iter->second->m_finished.Signaled())
+    return;
+
+  AddResult(strHostName, iter->second->m_ip);
+  m_pendingLookups.erase(iter);
+}
+
+bool CDNSNameCache::IsUnresolvable(const std::string& strHostName) const
+{
+  std::lock_guard lock(m_critical);
+
+  auto iter = m_hostToIp.find(strHostName);
+  return iter != m_hostToIp.end() && iter->second.m_ip.empty() &&
+         iter->second.m_expirationTime > std::chrono::steady_clock::now();
 }
 
 bool CDNSNameCache::GetCached(const std::string& strHostName, std::string& strIpAddress) const
@@ -79,8 +167,12 @@ bool CDNSNameCache::GetCached(const std::string& strHostName, std::string& strIp
     if (!iter->second.m_expirationTime ||
         iter->second.m_expirationTime > std::chrono::steady_clock::now())
     {
-      strIpAddress = iter->second.m_ip;
-      return true;
+      // a failed lookup is cached as well, it doesn't provide an IP though
+      if (!iter->second.m_ip.empty())
+      {
+        strIpAddress = iter->second.m_ip;
+        return true;
+      }
     }
     else
       m_hostToIp.erase(iter);
@@ -105,9 +197,8 @@ bool CDNSNameCache::GetCached(const std::string& strHostName, std::string& strIp
 
 void CDNSNameCache::Add(const std::string& strHostName, const std::string& strIpAddress)
 {
-  std::lock_guard lock(m_critical);
-  m_hostToIp.emplace(std::piecewise_construct, std::forward_as_tuple(strHostName),
-                     std::forward_as_tuple(strIpAddress, std::chrono::steady_clock::now() + TTL));
+  if (!strIpAddress.empty())
+    AddResult(strHostName, strIpAddress);
 }
 
 void CDNSNameCache::AddPermanent(const std::string& strHostName, const std::string& strIpAddress)
@@ -11,6 +11,7 @@
 #include "threads/CriticalSection.h"
 
 #include <chrono>
+#include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -44,7 +45,10 @@ public:
   /*!
    * \brief Get the IP for the hostname from the cache or query it form the DNS
    *
-   * If a successful DNS query was performed the result is added to the cache for the duration of \ref TTL
+   * If a successful DNS query was performed the result is added to the cache for the duration of \ref TTL,
+   * a failed one for the duration of \ref NEGATIVE_TTL. The query runs in the background, the caller
+   * waits for \ref LOOKUP_TIMEOUT at most. A query that takes longer still fills the cache when it
+   * finishes, concurrent lookups of a hostname share one query.
    *
    * \param strHostName The hostname to look up
    * \param[out] strIpAddress Contains the IP for the hostname if the info can be provided, otherwise unchanged
@@ -55,15 +59,35 @@ public:
 
 private:
   static constexpr std::chrono::seconds TTL{60};
+  static constexpr std::chrono::seconds NEGATIVE_TTL{15};
+  static constexpr std::chrono::seconds LOOKUP_TIMEOUT{5};
 
   struct CacheEntry
   {
     CacheEntry(std::string ip, std::optional<std::chrono::steady_clock::time_point> expirationTime);
 
-    std::string m_ip;
+    std::string m_ip; //!< empty if the hostname can't be resolved
     std::optional<std::chrono::steady_clock::time_point> m_expirationTime;
   };
 
+  struct PendingLookup;
+
+  /*!
+   * \brief Store the result of a query in the cache, an empty IP caches the failure
+   */
+  void AddResult(const std::string& strHostName, const std::string& strIpAddress);
+
+  /*!
+   * \brief Move the result of a finished query for the hostname into the cache
+   */
+  void CollectPendingLookup(const std::string& strHostName);
+
+  /*!
+   * \brief Whether a recent query for the hostname failed
+   */
+  bool IsUnresolvable(const std::string& strHostName) const;
+
   mutable CCriticalSection m_critical;
   mutable std::unordered_map<std::string, CacheEntry> m_hostToIp;
+  std::unordered_map<std::string, std::shared_ptr<PendingLookup>> m_pendingLookups;
 };
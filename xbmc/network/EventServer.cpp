@@ -36,6 +36,12 @@ using namespace EVENTCLIENT;
 using namespace SOCKETS;
 using namespace std::chrono_literals;
 
+namespace
+{
+// packets read at once before the events they carry are processed
+constexpr int MAX_PACKETS_PER_WAKEUP = 64;
+} // namespace
+
 /************************************************************************/
 /* CEventServer                                                         */
 /************************************************************************/
@@ -46,8 +52,9 @@ CEventServer::CEventServer() : CThread("EventServer")
   m_bStop         = false;
   m_bRefreshSettings = false;
 
-  // default timeout in ms for receiving a single packet
-  m_iListenTimeout = 1000;
+  // timeout in ms for receiving a packet. StopServer() wakes the server up, it only times out
+  // in case that didn't reach it.
+  m_iListenTimeout = 10000;
 }
 
 void CEventServer::RemoveInstance()
@@ -88,9 +95,28 @@ void CEventServer::StartServer()
 void CEventServer::StopServer(bool bWait)
 {
   CZeroconf::GetInstance()->RemoveService("services.eventserver");
+  m_bStop = true;
+  WakeUp();
   StopThread(bWait);
 }
 
+void CEventServer::WakeUp()
+{
+  const int port = m_iBoundPort;
+  if (!port)
+    return;
+
+  // an empty datagram returns the server from waiting for packets
+  std::unique_ptr<CUDPSocket> socket = CSocketFactory::CreateUDPSocket();
+  if (!socket || !socket->Bind(true, 0, 0))
+    return;
+
+  CAddress addr("127.0.0.1");
+  addr.saddr.saddr4.sin_port = htons(port);
+  socket->SendTo(addr, 0, nullptr);
+  socket->Close();
+}
+
 void CEventServer::Cleanup()
 {
   if (m_pSocket)
@@ -149,6 +175,7 @@ void CEventServer::Run()
     CLog::Log(LOGERROR, "ES: Could not listen on port {}", m_iPort);
     return;
   }
+  m_iBoundPort = m_pSocket->Port();
 
   // publish service
   std::vector<std::pair<std::string, std::string>> txt;
@@ -165,11 +192,14 @@ void CEventServer::Run()
   {
     try
     {
-      // start listening until we timeout
-      if (listener.Listen(m_iListenTimeout))
+      // wait for packets, then read all those that arrived before processing their events
+      for (int packets = 0; packets < MAX_PACKETS_PER_WAKEUP && !m_bStop &&
+                            listener.Listen(packets == 0 ? m_iListenTimeout : 0);
+           ++packets)
       {
+        // the empty datagram of WakeUp() carries nothing to process
         CAddress addr;
-        if ((packetSize = m_pSocket->Read(addr, PACKET_SIZE, m_pPacketBuffer.data())) > -1)
+        if ((packetSize = m_pSocket->Read(addr, PACKET_SIZE, m_pPacketBuffer.data())) > 0)
         {
           ProcessPacket(addr, packetSize);
         }
@@ -192,6 +222,7 @@ void CEventServer::Run()
   }
 
   CLog::Log(LOGINFO, "ES: UDP Event server stopped");
+  m_iBoundPort = 0;
   m_bRunning = false;
   Cleanup();
 }
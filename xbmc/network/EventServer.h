@@ -44,8 +44,11 @@ namespace EVENTSERVER
 
     void RefreshSettings()
     {
-      std::unique_lock lock(m_critSection);
-      m_bRefreshSettings = true;
+      {
+        std::unique_lock lock(m_critSection);
+        m_bRefreshSettings = true;
+      }
+      WakeUp();
     }
 
     // start / stop server
@@ -61,6 +64,7 @@ namespace EVENTSERVER
   protected:
     void Cleanup();
     void Run();
+    void WakeUp();
     void ProcessPacket(SOCKETS::CAddress& addr, int packetSize);
     void ProcessEvents();
     void RefreshClients();
@@ -69,6 +73,7 @@ namespace EVENTSERVER
     static std::unique_ptr<CEventServer> m_pInstance;
     std::unique_ptr<SOCKETS::CUDPSocket> m_pSocket;
     int              m_iPort;
+    std::atomic<int> m_iBoundPort = 0;
     int              m_iListenTimeout;
     int              m_iMaxClients;
     std::vector<uint8_t> m_pPacketBuffer;
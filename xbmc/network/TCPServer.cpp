@@ -14,11 +14,14 @@
 #include "network/Network.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/StringUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 #include "websocket/WebSocketManager.h"
 
+#include <algorithm>
 #include <mutex>
+#include <optional>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -257,17 +260,28 @@ void CTCPServer::Announce(ANNOUNCEMENT::AnnouncementFlag flag,
   if (m_connections.empty())
     return;
 
-  std::string str = IJSONRPCAnnouncer::AnnouncementToJSONRPC(flag, sender, message, data, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_jsonOutputCompact);
+  // serialized once and framed once per kind of client, no matter how many receive it
+  std::optional<CAnnouncement> announcement;
+  const std::string method =
+      StringUtils::Format("{}.{}", ANNOUNCEMENT::AnnouncementFlagToString(flag), message);
 
   for (unsigned int i = 0; i < m_connections.size(); i++)
   {
     {
       std::unique_lock connLock(m_connections[i]->m_critSection);
-      if ((m_connections[i]->GetAnnouncementFlags() & flag) == 0)
+      if ((m_connections[i]->GetAnnouncementFlags() & flag) == 0 ||
+          !m_connections[i]->IsSubscribed(method))
         continue;
     }
 
-    m_connections[i]->Send(str.c_str(), str.size());
+    if (!announcement)
+      announcement.emplace(method, IJSONRPCAnnouncer::AnnouncementToJSONRPC(
+                                       flag, sender, message, data,
+                                       CServiceBroker::GetSettingsComponent()
+                                           ->GetAdvancedSettings()
+                                           ->m_jsonOutputCompact));
+
+    m_connections[i]->Send(*announcement);
   }
 }
 
@@ -559,6 +573,58 @@ bool CTCPServer::CTCPClient::SetAnnouncementFlags(int flags)
   return true;
 }
 
+bool CTCPServer::CTCPClient::SetSubscriptions(const std::vector<std::string>& methods)
+{
+  std::unique_lock lock(m_critSection);
+  m_subscriptions = methods;
+  return true;
+}
+
+std::vector<std::string> CTCPServer::CTCPClient::GetSubscriptions()
+{
+  std::unique_lock lock(m_critSection);
+  return m_subscriptions;
+}
+
+bool CTCPServer::CTCPClient::IsSubscribed(const std::string& method) const
+{
+  if (m_subscriptions.empty())
+    return true;
+
+  return std::ranges::any_of(m_subscriptions,
+                             [&method](const std::string& subscription)
+                             {
+                               if (subscription.ends_with(".*"))
+                                 return StringUtils::StartsWithNoCase(
+                                     method, subscription.substr(0, subscription.size() - 1));
+                               return StringUtils::EqualsNoCase(subscription, method);
+                             });
+}
+
+const std::string& CTCPServer::CAnnouncement::GetWebSocketFrame(bool deflate)
+{
+  std::string& frame = deflate ? m_deflatedFrame : m_frame;
+  if (!frame.empty())
+    return frame;
+
+  std::string compressed;
+  int8_t extension = 0;
+  const std::string* payload = &m_json;
+  if (deflate && CWebSocket::Deflate(m_json.data(), m_json.size(), compressed))
+  {
+    payload = &compressed;
+    extension = WebSocketExtensionCompressed;
+  }
+
+  const CWebSocketFrame webSocketFrame(WebSocketTextFrame, payload->data(),
+                                       static_cast<uint32_t>(payload->size()), true, false, 0,
+                                       extension);
+  if (webSocketFrame.IsValid())
+    frame.assign(webSocketFrame.GetFrameData(),
+                 static_cast<size_t>(webSocketFrame.GetFrameLength()));
+  return frame;
+}
+
 void CTCPServer::CTCPClient::Send(const char *data, unsigned int size)
 {
   unsigned int sent = 0;
@@ -569,6 +635,11 @@ void CTCPServer::CTCPClient::Send(const char *data, unsigned int size)
   } while (sent < size);
 }
 
+void CTCPServer::CTCPClient::Send(CAnnouncement& announcement)
+{
+  Send(announcement.GetJSON().c_str(), announcement.GetJSON().size());
+}
+
 void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
 {
   m_new = false;
@@ -659,6 +730,7 @@ void CTCPServer::CTCPClient::Copy(const CTCPClient& client)
   m_cliaddr           = client.m_cliaddr;
   m_addrlen           = client.m_addrlen;
   m_announcementflags = client.m_announcementflags;
+  m_subscriptions     = client.m_subscriptions;
   m_beginBrackets     = client.m_beginBrackets;
   m_endBrackets       = client.m_endBrackets;
   m_beginChar         = client.m_beginChar;
@@ -713,6 +785,16 @@ void CTCPServer::CWebSocketClient::Send(const char *data, unsigned int size)
     CTCPClient::Send(frames.at(index)->GetFrameData(), (unsigned int)frames.at(index)->GetFrameLength());
 }
 
+void CTCPServer::CWebSocketClient::Send(CAnnouncement& announcement)
+{
+  if (m_websocket->GetState() != WebSocketStateConnected)
+    return;
+
+  const std::string& frame = announcement.GetWebSocketFrame(m_websocket->IsDeflateEnabled());
+  if (!frame.empty())
+    CTCPClient::Send(frame.data(), static_cast<unsigned int>(frame.size()));
+}
+
 void CTCPServer::CWebSocketClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
 {
   bool send;
@@ -742,8 +824,13 @@ void CTCPServer::CWebSocketClient::PushBuffer(CTCPServer *host, const char *buff
       }
       else
       {
-        for (unsigned int index = 0; index < frames.size(); index++)
-          CTCPClient::PushBuffer(host, frames.at(index)->GetApplicationData(), (int)frames.at(index)->GetLength());
+        std::string data;
+        if (!m_websocket->GetMessageData(msg, data))
+        {
+          delete msg;
+          return Disconnect();
+        }
+        CTCPClient::PushBuffer(host, data.c_str(), static_cast<int>(data.size()));
       }
 
       delete msg;
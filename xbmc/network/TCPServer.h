@@ -50,6 +50,29 @@ namespace JSONRPC
     bool InitializeTCP();
     void Deinitialize();
 
+    /*!
+     * \brief An announcement serialized once for all clients, the websocket frames are only built
+     * when a client needs them
+     */
+    class CAnnouncement
+    {
+    public:
+      CAnnouncement(std::string method, std::string json)
+        : m_method(std::move(method)), m_json(std::move(json))
+      {
+      }
+
+      const std::string& GetMethod() const { return m_method; }
+      const std::string& GetJSON() const { return m_json; }
+      const std::string& GetWebSocketFrame(bool deflate);
+
+    private:
+      std::string m_method;
+      std::string m_json;
+      std::string m_frame;
+      std::string m_deflatedFrame;
+    };
+
     class CTCPClient : public IClient
     {
     public:
@@ -63,8 +86,12 @@ namespace JSONRPC
       int GetPermissionFlags() override;
       int GetAnnouncementFlags() override;
       bool SetAnnouncementFlags(int flags) override;
+      bool SetSubscriptions(const std::vector<std::string>& methods) override;
+      std::vector<std::string> GetSubscriptions() override;
+      bool IsSubscribed(const std::string& method) const;
 
       virtual void Send(const char *data, unsigned int size);
+      virtual void Send(CAnnouncement& announcement);
       virtual void PushBuffer(CTCPServer *host, const char *buffer, int length);
       virtual void Disconnect();
 
@@ -81,6 +108,7 @@ namespace JSONRPC
     private:
       bool m_new;
       int m_announcementflags;
+      std::vector<std::string> m_subscriptions;
       int m_beginBrackets, m_endBrackets;
       char m_beginChar, m_endChar;
       std::string m_buffer;
@@ -96,6 +124,7 @@ namespace JSONRPC
       ~CWebSocketClient() override;
 
       void Send(const char *data, unsigned int size) override;
+      void Send(CAnnouncement& announcement) override;
       void PushBuffer(CTCPServer *host, const char *buffer, int length) override;
       void Disconnect() override;
 
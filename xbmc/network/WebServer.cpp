@@ -10,8 +10,11 @@
 
 #include "CompileInfo.h"
 #include "ServiceBroker.h"
+#include "URL.h"
 #include "XBDateTime.h"
 #include "filesystem/File.h"
+#include "filesystem/SpecialProtocol.h"
+#include "jobs/JobManager.h"
 #include "network/httprequesthandler/HTTPRequestHandlerUtils.h"
 #include "network/httprequesthandler/IHTTPRequestHandler.h"
 #include "settings/Settings.h"
@@ -30,12 +33,16 @@
 #include <utility>
 
 #if defined(TARGET_POSIX)
+#include <fcntl.h>
 #include <pthread.h>
+#include <unistd.h>
 #endif
 
 #include <inttypes.h>
 
 #define MAX_POST_BUFFER_SIZE 2048
+// event loops of the daemon, handlers that may block are created in jobs
+#define WEBSERVER_THREAD_POOL_SIZE 8u
 
 #define PAGE_FILE_NOT_FOUND \
   "<html><head><title>File not found</title></head><body>File not found</body></html>"
@@ -92,6 +99,29 @@ static MHD_Response* create_response(size_t size, const void* data, int free, in
   return MHD_create_response_from_buffer(size, const_cast<void*>(data), mode);
 }
 
+#if defined(TARGET_POSIX)
+static MHD_Response* create_local_file_response(const std::string& filePath,
+                                                uint64_t offset,
+                                                uint64_t size)
+{
+  // only plain paths of the local file system, everything else goes through the vfs
+  const std::string localPath = CSpecialProtocol::TranslatePath(filePath);
+  if (!CURL(localPath).GetProtocol().empty())
+    return nullptr;
+
+  const int fd = open(localPath.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    return nullptr;
+
+  // libmicrohttpd closes the descriptor with the response and sends it with sendfile() where it
+  // can, i.e. without TLS
+  MHD_Response* response = MHD_create_response_from_fd_at_offset64(size, fd, offset);
+  if (response == nullptr)
+    close(fd);
+  return response;
+}
+#endif
+
 MHD_RESULT CWebServer::AskForAuthentication(const HTTPRequest& request) const
 {
   struct MHD_Response* response = create_response(0, nullptr, MHD_NO, MHD_NO);
@@ -199,50 +229,19 @@ MHD_RESULT CWebServer::HandlePartialRequest(struct MHD_Connection* connection,
   if (isNewRequest)
   {
     // look for a IHTTPRequestHandler which can take care of the current request
+    // the connection is resumed once the handler exists, see below
+    if (CreateRequestHandlerInBackground(request, conHandler.get()))
+    {
+      *con_cls = conHandler.release();
+      return MHD_YES;
+    }
+
     auto handler = FindRequestHandler(request);
     if (handler != nullptr)
     {
       // if we got a GET request we need to check if it should be cached
       if (request.method == GET || request.method == HEAD)
-      {
-        if (handler->CanBeCached())
-        {
-          bool cacheable = IsRequestCacheable(request);
-
-          CDateTime lastModified;
-          if (handler->GetLastModifiedDate(lastModified) && lastModified.IsValid())
-          {
-            // handle If-Modified-Since or If-Unmodified-Since
-            std::string ifModifiedSince = HTTPRequestHandlerUtils::GetRequestHeaderValue(
-                connection, MHD_HEADER_KIND, MHD_HTTP_HEADER_IF_MODIFIED_SINCE);
-            std::string ifUnmodifiedSince = HTTPRequestHandlerUtils::GetRequestHeaderValue(
-                connection, MHD_HEADER_KIND, MHD_HTTP_HEADER_IF_UNMODIFIED_SINCE);
-
-            CDateTime ifModifiedSinceDate;
-            CDateTime ifUnmodifiedSinceDate;
-            // handle If-Modified-Since (but only if the response is cacheable)
-            if (cacheable && ifModifiedSinceDate.SetFromRFC1123DateTime(ifModifiedSince) &&
-                lastModified.GetAsUTCDateTime() <= ifModifiedSinceDate)
-            {
-              struct MHD_Response* response = create_response(0, nullptr, MHD_NO, MHD_NO);
-              if (response == nullptr)
-              {
-                m_logger->error("failed to create a HTTP 304 response");
-                return MHD_NO;
-              }
-
-              return FinalizeRequest(handler, MHD_HTTP_NOT_MODIFIED, response);
-            }
-            // handle If-Unmodified-Since
-            else if (ifUnmodifiedSinceDate.SetFromRFC1123DateTime(ifUnmodifiedSince) &&
-                     lastModified.GetAsUTCDateTime() > ifUnmodifiedSinceDate)
-              return SendErrorResponse(request, MHD_HTTP_PRECONDITION_FAILED, request.method);
-          }
-
-          // pass the requested ranges on to the request handler
-          handler->SetRequestRanged(IsRequestRanged(request, lastModified));
-        }
-      }
+        return HandleGetRequest(request, handler);
       // if we got a POST request we need to take care of the POST data
       else if (request.method == POST)
       {
@@ -286,6 +285,10 @@ MHD_RESULT CWebServer::HandlePartialRequest(struct MHD_Connection* connection,
       return HandleRequest(conHandler->requestHandler);
     }
 
+    // the handler was created in the background while the connection was suspended
+    if ((request.method == GET || request.method == HEAD) && conHandler->requestHandler != nullptr)
+      return HandleGetRequest(request, conHandler->requestHandler);
+
     // it's unusual to get more than one call to AnswerToConnection for none-POST requests, but
     // let's handle it anyway
     auto requestHandler = FindRequestHandler(request);
@@ -297,6 +300,73 @@ MHD_RESULT CWebServer::HandlePartialRequest(struct MHD_Connection* connection,
   return SendErrorResponse(request, MHD_HTTP_NOT_FOUND, request.method);
 }
 
+MHD_RESULT CWebServer::HandleGetRequest(const HTTPRequest& request,
+                                        const std::shared_ptr<IHTTPRequestHandler>& handler)
+{
+  if (handler->CanBeCached())
+  {
+    bool cacheable = IsRequestCacheable(request);
+
+    // handle If-None-Match, it takes precedence over If-Modified-Since
+    std::string etag;
+    if (handler->GetETag(etag))
+    {
+      const std::string ifNoneMatch = HTTPRequestHandlerUtils::GetRequestHeaderValue(
+          request.connection, MHD_HEADER_KIND, MHD_HTTP_HEADER_IF_NONE_MATCH);
+      if (!ifNoneMatch.empty())
+      {
+        if (cacheable && HTTPRequestHandlerUtils::MatchesETag(ifNoneMatch, etag))
+        {
+          struct MHD_Response* response = create_response(0, nullptr, MHD_NO, MHD_NO);
+          if (response == nullptr)
+          {
+            m_logger->error("failed to create a HTTP 304 response");
+            return MHD_NO;
+          }
+
+          return FinalizeRequest(handler, MHD_HTTP_NOT_MODIFIED, response);
+        }
+        cacheable = false;
+      }
+    }
+
+    CDateTime lastModified;
+    if (handler->GetLastModifiedDate(lastModified) && lastModified.IsValid())
+    {
+      // handle If-Modified-Since or If-Unmodified-Since
+      std::string ifModifiedSince = HTTPRequestHandlerUtils::GetRequestHeaderValue(
+          request.connection, MHD_HEADER_KIND, MHD_HTTP_HEADER_IF_MODIFIED_SINCE);
+      std::string ifUnmodifiedSince = HTTPRequestHandlerUtils::GetRequestHeaderValue(
+          request.connection, MHD_HEADER_KIND, MHD_HTTP_HEADER_IF_UNMODIFIED_SINCE);
+
+      CDateTime ifModifiedSinceDate;
+      CDateTime ifUnmodifiedSinceDate;
+      // handle If-Modified-Since (but only if the response is cacheable)
+      if (cacheable && ifModifiedSinceDate.SetFromRFC1123DateTime(ifModifiedSince) &&
+          lastModified.GetAsUTCDateTime() <= ifModifiedSinceDate)
+      {
+        struct MHD_Response* response = create_response(0, nullptr, MHD_NO, MHD_NO);
+        if (response == nullptr)
+        {
+          m_logger->error("failed to create a HTTP 304 response");
+          return MHD_NO;
+        }
+
+        return FinalizeRequest(handler, MHD_HTTP_NOT_MODIFIED, response);
+      }
+      // handle If-Unmodified-Since
+      else if (ifUnmodifiedSinceDate.SetFromRFC1123DateTime(ifUnmodifiedSince) &&
+               lastModified.GetAsUTCDateTime() > ifUnmodifiedSinceDate)
+        return SendErrorResponse(request, MHD_HTTP_PRECONDITION_FAILED, request.method);
+    }
+
+    // pass the requested ranges on to the request handler
+    handler->SetRequestRanged(IsRequestRanged(request, lastModified));
+  }
+
+  return HandleRequest(handler);
+}
+
 MHD_RESULT CWebServer::HandlePostField(void* cls,
                                        enum MHD_ValueKind kind,
                                        const char* key,
@@ -394,6 +464,11 @@ MHD_RESULT CWebServer::FinalizeRequest(const std::shared_ptr<IHTTPRequestHandler
   if (handler->GetLastModifiedDate(lastModified) && lastModified.IsValid())
     handler->AddResponseHeader(MHD_HTTP_HEADER_LAST_MODIFIED, lastModified.GetAsRFC1123DateTime());
 
+  // if the request handler has set an entity tag, add it
+  std::string etag;
+  if (handler->CanBeCached() && handler->GetETag(etag))
+    handler->AddResponseHeader(MHD_HTTP_HEADER_ETAG, etag);
+
   // check if the request handler has set Cache-Control and add it if not
   if (!handler->HasResponseHeader(MHD_HTTP_HEADER_CACHE_CONTROL))
   {
@@ -442,7 +517,7 @@ MHD_RESULT CWebServer::FinalizeRequest(const std::shared_ptr<IHTTPRequestHandler
   return SendResponse(request, responseStatus, response);
 }
 
-std::shared_ptr<IHTTPRequestHandler> CWebServer::FindRequestHandler(
+const IHTTPRequestHandler* CWebServer::FindRequestHandlerPrototype(
     const HTTPRequest& request) const
 {
   // look for a IHTTPRequestHandler which can take care of the current request
@@ -451,13 +526,54 @@ std::shared_ptr<IHTTPRequestHandler> CWebServer::FindRequestHandler(
                                          return requestHandler->CanHandleRequest(request);
                                        });
 
+  return requestHandlerIt != m_requestHandlers.cend() ? *requestHandlerIt : nullptr;
+}
+
+std::shared_ptr<IHTTPRequestHandler> CWebServer::FindRequestHandler(
+    const HTTPRequest& request) const
+{
   // we found a matching IHTTPRequestHandler so let's get a new instance for this request
-  if (requestHandlerIt != m_requestHandlers.cend())
-    return std::shared_ptr<IHTTPRequestHandler>((*requestHandlerIt)->Create(request));
+  const IHTTPRequestHandler* prototype = FindRequestHandlerPrototype(request);
+  if (prototype != nullptr)
+    return std::shared_ptr<IHTTPRequestHandler>(prototype->Create(request));
 
   return nullptr;
 }
 
+bool CWebServer::CreateRequestHandlerInBackground(const HTTPRequest& request,
+                                                  ConnectionHandler* connectionHandler)
+{
+#if (MHD_VERSION >= 0x00095900)
+  if (request.method != GET && request.method != HEAD)
+    return false;
+
+  const IHTTPRequestHandler* prototype = FindRequestHandlerPrototype(request);
+  if (prototype == nullptr || !prototype->MayBlock())
+    return false;
+
+  {
+    std::unique_lock lock(m_pendingSection);
+    m_pendingRequests++;
+  }
+
+  // libmicrohttpd calls AnswerToConnection again after the connection was resumed
+  MHD_suspend_connection(request.connection);
+  CServiceBroker::GetJobManager()->Submit(
+      [this, prototype, request, connectionHandler]()
+      {
+        connectionHandler->requestHandler.reset(prototype->Create(request));
+        MHD_resume_connection(request.connection);
+
+        std::unique_lock lock(m_pendingSection);
+        m_pendingRequests--;
+        m_pendingDone.notifyAll();
+      });
+  return true;
+#else
+  return false;
+#endif
+}
+
 bool CWebServer::IsRequestCacheable(const HTTPRequest& request) const
 {
   // handle Cache-Control
@@ -887,18 +1003,29 @@ MHD_RESULT CWebServer::CreateFileDownloadResponse(
   // set the initial write position
   context->ranges.GetFirstPosition(context->writePosition);
 
-  // create the response object
-  response =
-      MHD_create_response_from_callback(totalLength, 2048, &CWebServer::ContentReaderCallback,
-                                        context.get(), &CWebServer::ContentReaderFreeCallback);
+  response = nullptr;
+#if defined(TARGET_POSIX)
+  // a single range of a local file is sent straight from the file, without copying it through the
+  // vfs and the content reader callback
+  if (context->rangeCountTotal == 1 && fileLength > 0)
+    response = create_local_file_response(filePath, context->writePosition, totalLength);
+#endif
+
   if (response == nullptr)
   {
-    m_logger->error("failed to create a HTTP response for {} to be filled from{}", request.pathUrl,
-                    filePath);
-    return MHD_NO;
-  }
+    // create the response object
+    response = MHD_create_response_from_callback(totalLength, 64 * 1024,
+                                                 &CWebServer::ContentReaderCallback, context.get(),
+                                                 &CWebServer::ContentReaderFreeCallback);
+    if (response == nullptr)
+    {
+      m_logger->error("failed to create a HTTP response for {} to be filled from{}",
+                      request.pathUrl, filePath);
+      return MHD_NO;
+    }
 
-  context.release(); // ownership was passed to mhd
+    context.release(); // ownership was passed to mhd
+  }
 
   // add Content-Range header
   if (ranged)
@@ -1196,26 +1323,37 @@ struct MHD_Daemon* CWebServer::StartMHD(unsigned int flags, int port)
 
   MHD_set_panic_func(&panicHandlerForMHD, nullptr);
 
+#if (MHD_VERSION >= 0x00095900)
+  // a few event loops (epoll where available) instead of a thread and stack per connection,
+  // handlers that may block are created in a job while their connection is suspended
+  const unsigned int threadingFlags =
+      MHD_USE_INTERNAL_POLLING_THREAD | MHD_USE_AUTO | MHD_ALLOW_SUSPEND_RESUME;
+#else
+  // one thread per connection
+  // WARNING: set MHD_OPTION_CONNECTION_TIMEOUT to something higher than 1
+  // otherwise on libmicrohttpd 0.4.4-1 it spins a busy loop
+  const unsigned int threadingFlags =
+      MHD_USE_THREAD_PER_CONNECTION
+#if (MHD_VERSION >= 0x00095207)
+      | MHD_USE_INTERNAL_POLLING_THREAD /* MHD_USE_THREAD_PER_CONNECTION must be used only with
+                                           MHD_USE_INTERNAL_POLLING_THREAD since 0.9.54 */
+#endif
+      ;
+#endif
+
   if (CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
           CSettings::SETTING_SERVICES_WEBSERVERSSL) &&
       MHD_is_feature_supported(MHD_FEATURE_SSL) == MHD_YES && LoadCert(m_key, m_cert))
     // SSL enabled
     return MHD_start_daemon(
-        flags |
-            // one thread per connection
-            // WARNING: set MHD_OPTION_CONNECTION_TIMEOUT to something higher than 1
-            // otherwise on libmicrohttpd 0.4.4-1 it spins a busy loop
-            MHD_USE_THREAD_PER_CONNECTION
-#if (MHD_VERSION >= 0x00095207)
-            |
-            MHD_USE_INTERNAL_POLLING_THREAD /* MHD_USE_THREAD_PER_CONNECTION must be used only with
-                                               MHD_USE_INTERNAL_POLLING_THREAD since 0.9.54 */
-#endif
-            | MHD_USE_DEBUG /* Print MHD error messages to log */
+        flags | threadingFlags | MHD_USE_DEBUG /* Print MHD error messages to log */
             | MHD_USE_SSL,
         port, 0, 0, &CWebServer::AnswerToConnection, this,
 
         MHD_OPTION_EXTERNAL_LOGGER, &logFromMHD, 0, MHD_OPTION_CONNECTION_LIMIT, 512,
+#if (MHD_VERSION >= 0x00095900)
+        MHD_OPTION_THREAD_POOL_SIZE, WEBSERVER_THREAD_POOL_SIZE,
+#endif
         MHD_OPTION_CONNECTION_TIMEOUT, timeout, MHD_OPTION_URI_LOG_CALLBACK,
         &CWebServer::UriRequestLogger, this, MHD_OPTION_THREAD_STACK_SIZE, m_thread_stacksize,
         MHD_OPTION_HTTPS_MEM_KEY, m_key.c_str(), MHD_OPTION_HTTPS_MEM_CERT, m_cert.c_str(),
@@ -1223,20 +1361,13 @@ struct MHD_Daemon* CWebServer::StartMHD(unsigned int flags, int port)
 
   // No SSL
   return MHD_start_daemon(
-      flags |
-          // one thread per connection
-          // WARNING: set MHD_OPTION_CONNECTION_TIMEOUT to something higher than 1
-          // otherwise on libmicrohttpd 0.4.4-1 it spins a busy loop
-          MHD_USE_THREAD_PER_CONNECTION
-#if (MHD_VERSION >= 0x00095207)
-          | MHD_USE_INTERNAL_POLLING_THREAD /* MHD_USE_THREAD_PER_CONNECTION must be used only with
-                                               MHD_USE_INTERNAL_POLLING_THREAD since 0.9.54 */
-#endif
-          | MHD_USE_DEBUG /* Print MHD error messages to log */
-      ,
+      flags | threadingFlags | MHD_USE_DEBUG /* Print MHD error messages to log */,
       port, 0, 0, &CWebServer::AnswerToConnection, this,
 
       MHD_OPTION_EXTERNAL_LOGGER, &logFromMHD, 0, MHD_OPTION_CONNECTION_LIMIT, 512,
+#if (MHD_VERSION >= 0x00095900)
+      MHD_OPTION_THREAD_POOL_SIZE, WEBSERVER_THREAD_POOL_SIZE,
+#endif
       MHD_OPTION_CONNECTION_TIMEOUT, timeout, MHD_OPTION_URI_LOG_CALLBACK,
       &CWebServer::UriRequestLogger, this, MHD_OPTION_THREAD_STACK_SIZE, m_thread_stacksize,
       MHD_OPTION_END);
@@ -1276,6 +1407,12 @@ bool CWebServer::Stop()
   if (!m_running)
     return true;
 
+  // suspended connections must be resumed before the daemons are stopped
+  {
+    std::unique_lock lock(m_pendingSection);
+    m_pendingDone.wait(lock, [this] { return m_pendingRequests == 0; });
+  }
+
   if (m_daemon_ip6 != nullptr)
     MHD_stop_daemon(m_daemon_ip6);
 
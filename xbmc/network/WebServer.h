@@ -9,6 +9,7 @@
 #pragma once
 
 #include "network/httprequesthandler/IHTTPRequestHandler.h"
+#include "threads/Condition.h"
 #include "threads/CriticalSection.h"
 #include "utils/logtypes.h"
 
@@ -59,7 +60,12 @@ protected:
 private:
   struct MHD_Daemon* StartMHD(unsigned int flags, int port);
 
+  const IHTTPRequestHandler* FindRequestHandlerPrototype(const HTTPRequest& request) const;
   std::shared_ptr<IHTTPRequestHandler> FindRequestHandler(const HTTPRequest& request) const;
+  bool CreateRequestHandlerInBackground(const HTTPRequest& request,
+                                        ConnectionHandler* connectionHandler);
+  MHD_RESULT HandleGetRequest(const HTTPRequest& request,
+                              const std::shared_ptr<IHTTPRequestHandler>& handler);
 
   MHD_RESULT AskForAuthentication(const HTTPRequest& request) const;
   bool IsAuthenticated(const HTTPRequest& request) const;
@@ -120,6 +126,9 @@ private:
   std::string m_cert;
   mutable CCriticalSection m_critSection;
   std::vector<IHTTPRequestHandler *> m_requestHandlers;
+  CCriticalSection m_pendingSection;
+  XbmcThreads::ConditionVariable m_pendingDone;
+  unsigned int m_pendingRequests = 0; //!< connections suspended until their handler is created
 
   Logger m_logger;
 };
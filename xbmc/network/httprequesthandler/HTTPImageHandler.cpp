@@ -11,6 +11,7 @@
 #include "URL.h"
 #include "filesystem/ImageFile.h"
 #include "network/WebServer.h"
+#include "network/httprequesthandler/HTTPRequestHandlerUtils.h"
 #include "utils/FileUtils.h"
 
 
@@ -35,6 +36,8 @@ CHTTPImageHandler::CHTTPImageHandler(const HTTPRequest &request)
       {
         SetLastModifiedDate(&statBuffer);
         SetCanBeCached(true);
+        // the stat is of the cached image, recaching it changes the tag
+        m_etag = HTTPRequestHandlerUtils::CreateETag(statBuffer.st_mtime, statBuffer.st_size);
       }
     }
     else
@@ -49,3 +52,12 @@ bool CHTTPImageHandler::CanHandleRequest(const HTTPRequest &request) const
 {
   return request.pathUrl.find("/image/") == 0;
 }
+
+bool CHTTPImageHandler::GetETag(std::string& etag) const
+{
+  if (m_etag.empty())
+    return false;
+
+  etag = m_etag;
+  return true;
+}
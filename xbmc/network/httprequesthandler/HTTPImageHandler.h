@@ -22,8 +22,13 @@ public:
   bool CanHandleRequest(const HTTPRequest &request) const override;
 
   int GetPriority() const override { return 5; }
+  bool MayBlock() const override { return true; }
   int GetMaximumAgeForCaching() const override { return 60 * 60 * 24 * 7; }
+  bool GetETag(std::string& etag) const override;
 
 protected:
   explicit CHTTPImageHandler(const HTTPRequest &request);
+
+private:
+  std::string m_etag;
 };
@@ -8,14 +8,19 @@
 
 #include "HTTPImageTransformationHandler.h"
 
+#include "ServiceBroker.h"
+#include "TextureCache.h"
 #include "TextureCacheJob.h"
 #include "URL.h"
+#include "filesystem/File.h"
 #include "filesystem/ImageFile.h"
+#include "imagefiles/ImageFileURL.h"
 #include "network/WebServer.h"
 #include "network/httprequesthandler/HTTPRequestHandlerUtils.h"
 #include "utils/Mime.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
+#include "utils/log.h"
 
 #include <charconv>
 #include <map>
@@ -29,7 +34,6 @@ static const std::string ImageBasePath = "/image/";
 CHTTPImageTransformationHandler::CHTTPImageTransformationHandler()
   : m_url(),
     m_lastModified(),
-    m_buffer(NULL),
     m_responseData()
 { }
 
@@ -37,7 +41,6 @@ CHTTPImageTransformationHandler::CHTTPImageTransformationHandler(const HTTPReque
   : IHTTPRequestHandler(request),
     m_url(),
     m_lastModified(),
-    m_buffer(NULL),
     m_responseData()
 {
   m_url = m_request.pathUrl.substr(ImageBasePath.size());
@@ -65,13 +68,38 @@ CHTTPImageTransformationHandler::CHTTPImageTransformationHandler(const HTTPReque
   StringUtils::ToLower(ext);
   m_response.contentType = CMime::GetMimeType(ext);
 
-  //! @todo determine the maximum age
+  // get the transformation options
+  std::map<std::string, std::string> options;
+  HTTPRequestHandlerUtils::GetRequestHeaderValues(m_request.connection, MHD_GET_ARGUMENT_KIND, options);
+
+  std::map<std::string, std::string>::const_iterator option = options.find(TRANSFORMATION_OPTION_WIDTH);
+  if (option != options.end())
+  {
+    const std::string& str = option->second;
+    std::from_chars(str.data(), str.data() + str.size(), m_width);
+  }
+
+  option = options.find(TRANSFORMATION_OPTION_HEIGHT);
+  if (option != options.end())
+  {
+    const std::string& str = option->second;
+    std::from_chars(str.data(), str.data() + str.size(), m_height);
+  }
 
-  // determine the last modified date
+  option = options.find(TRANSFORMATION_OPTION_SCALING_ALGORITHM);
+  if (option != options.end())
+    m_scalingAlgorithm = CPictureScalingAlgorithm::FromString(option->second);
+
+  // determine the last modified date and the entity tag of the transformed image
   struct __stat64 statBuffer;
   if (imageFile.Stat(pathToUrl, &statBuffer) != 0)
     return;
 
+  m_etag = HTTPRequestHandlerUtils::CreateETag(
+      statBuffer.st_mtime, statBuffer.st_size,
+      StringUtils::Format("{}x{}-{}", m_width, m_height,
+                          CPictureScalingAlgorithm::ToString(m_scalingAlgorithm)));
+
   struct tm *time;
 #ifdef HAVE_LOCALTIME_R
   struct tm result = {};
@@ -88,8 +116,6 @@ CHTTPImageTransformationHandler::CHTTPImageTransformationHandler(const HTTPReque
 CHTTPImageTransformationHandler::~CHTTPImageTransformationHandler()
 {
   m_responseData.clear();
-  delete m_buffer;
-  m_buffer = NULL;
 }
 
 bool CHTTPImageTransformationHandler::CanHandleRequest(const HTTPRequest &request) const
@@ -111,35 +137,24 @@ MHD_RESULT CHTTPImageTransformationHandler::HandleRequest()
   if (m_response.type == HTTPError)
     return MHD_YES;
 
-  // get the transformation options
-  std::map<std::string, std::string> options;
-  HTTPRequestHandlerUtils::GetRequestHeaderValues(m_request.connection, MHD_GET_ARGUMENT_KIND, options);
-
-  unsigned int width = 0;
-  std::map<std::string, std::string>::const_iterator option = options.find(TRANSFORMATION_OPTION_WIDTH);
-  if (option != options.end())
-  {
-    const std::string& str = option->second;
-    std::from_chars(str.data(), str.data() + str.size(), width);
-  }
-
-  unsigned int height = 0;
-  option = options.find(TRANSFORMATION_OPTION_HEIGHT);
-  if (option != options.end())
+  // transformed images are kept in the texture cache, the source tag in the key makes sure an
+  // outdated transformation isn't used anymore once the source image changed
+  std::string cacheKey;
+  if (!m_etag.empty())
   {
-    const std::string& str = option->second;
-    std::from_chars(str.data(), str.data() + str.size(), height);
+    IMAGE_FILES::CImageFileURL imageURL{m_url};
+    imageURL.AddOption("transform", m_etag.substr(1, m_etag.size() - 2));
+    cacheKey = imageURL.ToString();
+
+    bool needsRecaching = false;
+    const std::string cachedFile =
+        CServiceBroker::GetTextureCache()->CheckCachedImage(cacheKey, needsRecaching);
+    XFILE::CFile file;
+    if (!cachedFile.empty() && file.LoadFile(cachedFile, m_data) <= 0)
+      m_data.clear();
   }
 
-  auto scalingAlgorithm{CPictureScalingAlgorithm::NoAlgorithm};
-  option = options.find(TRANSFORMATION_OPTION_SCALING_ALGORITHM);
-  if (option != options.end())
-    scalingAlgorithm = CPictureScalingAlgorithm::FromString(option->second);
-
-  // resize the image into the local buffer
-  size_t bufferSize;
-  if (!CTextureCacheJob::ResizeTexture(m_url, height, width, scalingAlgorithm, m_buffer,
-                                       bufferSize))
+  if (m_data.empty() && !TransformImage(cacheKey))
   {
     m_response.status = MHD_HTTP_INTERNAL_SERVER_ERROR;
     m_response.type = HTTPError;
@@ -148,18 +163,18 @@ MHD_RESULT CHTTPImageTransformationHandler::HandleRequest()
   }
 
   // store the size of the image
-  m_response.totalLength = bufferSize;
+  m_response.totalLength = m_data.size();
 
   // nothing else to do if the request is not ranged
   if (!GetRequestedRanges(m_response.totalLength))
   {
-    m_responseData.emplace_back(m_buffer, 0, m_response.totalLength - 1);
+    m_responseData.emplace_back(m_data.data(), 0, m_response.totalLength - 1);
     return MHD_YES;
   }
 
   for (HttpRanges::const_iterator range = m_request.ranges.Begin(); range != m_request.ranges.End(); ++range)
-    m_responseData.emplace_back(m_buffer + range->GetFirstPosition(), range->GetFirstPosition(),
-                                range->GetLastPosition());
+    m_responseData.emplace_back(m_data.data() + range->GetFirstPosition(),
+                                range->GetFirstPosition(), range->GetLastPosition());
 
   return MHD_YES;
 }
@@ -172,3 +187,49 @@ bool CHTTPImageTransformationHandler::GetLastModifiedDate(CDateTime &lastModifie
   lastModified = m_lastModified;
   return true;
 }
+
+bool CHTTPImageTransformationHandler::GetETag(std::string& etag) const
+{
+  if (m_etag.empty())
+    return false;
+
+  etag = m_etag;
+  return true;
+}
+
+bool CHTTPImageTransformationHandler::TransformImage(const std::string& cacheKey)
+{
+  // resize the image into the local buffer
+  uint8_t* buffer = nullptr;
+  size_t bufferSize = 0;
+  if (!CTextureCacheJob::ResizeTexture(m_url, m_height, m_width, m_scalingAlgorithm, buffer,
+                                       bufferSize))
+    return false;
+
+  m_data.assign(buffer, buffer + bufferSize);
+  delete[] buffer;
+
+  if (cacheKey.empty())
+    return true;
+
+  // the encoder picks the format from the extension of the source image
+  std::string ext = URIUtils::GetExtension(CURL(m_url).GetHostName());
+  StringUtils::ToLower(ext);
+  CTextureDetails details;
+  details.file = CTextureCache::GetCacheFile(cacheKey) + (ext == ".png" ? ".png" : ".jpg");
+
+  XFILE::CFile file;
+  const std::string cachedFile = CTextureCache::GetCachedPath(details.file);
+  if (!file.OpenForWrite(cachedFile, true) ||
+      file.Write(m_data.data(), m_data.size()) != static_cast<ssize_t>(m_data.size()))
+  {
+    CLog::LogF(LOGDEBUG, "Unable to cache the transformed image {}", cachedFile);
+    return true;
+  }
+  file.Close();
+
+  // never recached, the entry is dropped by the cleanup once the source changed
+  details.updateable = false;
+  CServiceBroker::GetTextureCache()->AddCachedTexture(cacheKey, details);
+  return true;
+}
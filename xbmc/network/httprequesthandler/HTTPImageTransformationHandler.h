@@ -10,9 +10,11 @@
 
 #include "XBDateTime.h"
 #include "network/httprequesthandler/IHTTPRequestHandler.h"
+#include "pictures/PictureScalingAlgorithm.h"
 
 #include <stdint.h>
 #include <string>
+#include <vector>
 
 class CHTTPImageTransformationHandler : public IHTTPRequestHandler
 {
@@ -27,7 +29,9 @@ public:
 
   bool CanHandleRanges() const override { return true; }
   bool CanBeCached() const override { return true; }
+  int GetMaximumAgeForCaching() const override { return 60 * 60 * 24 * 7; }
   bool GetLastModifiedDate(CDateTime &lastModified) const override;
+  bool GetETag(std::string& etag) const override;
 
   HttpResponseRanges GetResponseData() const override { return m_responseData; }
 
@@ -38,9 +42,19 @@ protected:
   explicit CHTTPImageTransformationHandler(const HTTPRequest &request);
 
 private:
+  /*!
+   * \brief Resize the image into m_data and add it to the texture cache under cacheKey
+   */
+  bool TransformImage(const std::string& cacheKey);
+
   std::string m_url;
   CDateTime m_lastModified;
+  std::string m_etag;
+
+  unsigned int m_width = 0;
+  unsigned int m_height = 0;
+  CPictureScalingAlgorithm::Algorithm m_scalingAlgorithm = CPictureScalingAlgorithm::NoAlgorithm;
 
-  uint8_t* m_buffer;
+  std::vector<uint8_t> m_data;
   HttpResponseRanges m_responseData;
 };
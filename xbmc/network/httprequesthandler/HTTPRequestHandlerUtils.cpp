@@ -62,6 +62,35 @@ bool HTTPRequestHandlerUtils::GetRequestedRanges(struct MHD_Connection *connecti
   return ranges.Parse(GetRequestHeaderValue(connection, MHD_HEADER_KIND, MHD_HTTP_HEADER_RANGE), totalLength);
 }
 
+std::string HTTPRequestHandlerUtils::CreateETag(int64_t modificationTime,
+                                                int64_t size,
+                                                const std::string& variant)
+{
+  std::string etag = StringUtils::Format("\"{:x}-{:x}", modificationTime, size);
+  if (!variant.empty())
+    etag += "-" + variant;
+  return etag + "\"";
+}
+
+bool HTTPRequestHandlerUtils::MatchesETag(const std::string& ifNoneMatch, const std::string& etag)
+{
+  if (etag.empty())
+    return false;
+
+  // If-None-Match uses the weak comparison, a W/ prefix doesn't matter
+  for (auto tag : StringUtils::Split(ifNoneMatch, ","))
+  {
+    StringUtils::Trim(tag);
+    if (tag == "*")
+      return true;
+    if (tag.starts_with("W/"))
+      tag.erase(0, 2);
+    if (tag == etag)
+      return true;
+  }
+  return false;
+}
+
 MHD_RESULT HTTPRequestHandlerUtils::FillArgumentMap(void *cls, enum MHD_ValueKind kind, const char *key, const char *value)
 {
   if (cls == nullptr || key == nullptr)
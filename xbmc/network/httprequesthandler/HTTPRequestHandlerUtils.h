@@ -22,6 +22,20 @@ public:
 
   static bool GetRequestedRanges(struct MHD_Connection *connection, uint64_t totalLength, CHttpRanges &ranges);
 
+  /*!
+   * \brief Creates a strong entity tag from the modification time and size of a file
+   *
+   * \param variant distinguishes different representations generated from the same file
+   */
+  static std::string CreateETag(int64_t modificationTime,
+                                int64_t size,
+                                const std::string& variant = "");
+
+  /*!
+   * \brief Whether an entity tag is listed in the value of an If-None-Match header
+   */
+  static bool MatchesETag(const std::string& ifNoneMatch, const std::string& etag);
+
 private:
   HTTPRequestHandlerUtils() = delete;
 
@@ -22,6 +22,7 @@ public:
   bool CanHandleRequest(const HTTPRequest &request) const override;
 
   int GetPriority() const override { return 5; }
+  bool MayBlock() const override { return true; }
 
 protected:
   explicit CHTTPVfsHandler(const HTTPRequest &request);
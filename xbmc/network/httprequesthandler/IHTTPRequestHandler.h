@@ -107,6 +107,15 @@ public:
    */
   virtual int GetPriority() const { return 0; }
 
+  /*!
+   * \brief Whether Create() may block for a while, e.g. on network shares or
+   * while caching an image.
+   *
+   * \details Such handlers are created in a job while the connection is
+   * suspended, so they don't stall the other connections of the same thread.
+   */
+  virtual bool MayBlock() const { return false; }
+
   /*!
   * \brief Checks if the HTTP request handler can handle the given request.
   *
@@ -146,6 +155,13 @@ public:
   */
   virtual bool GetLastModifiedDate(CDateTime &lastModified) const { return false; }
 
+  /*!
+  * \brief Returns the entity tag of the response data, including the quotes.
+  *
+  * \details This is only used if the response can be cached.
+  */
+  virtual bool GetETag(std::string& etag) const { return false; }
+
   /*!
    * \brief Returns the ranges with raw data belonging to the response.
    *
@@ -616,6 +616,22 @@ PLT_MediaObject* BuildObject(CFileItem& item,
       object->m_Resources[i].m_Resolution = resource.m_Resolution;
     }
 
+    // offer the video remuxed too, for the renderers that don't play its container
+    if (upnp_server && (VIDEO::IsVideoDb(item) || VIDEO::IsVideo(item)) &&
+        !URIUtils::IsStack(static_cast<const char*>(file_path)) &&
+        CUPnPRemuxer::CanRemux(static_cast<const char*>(file_path)))
+    {
+      const NPT_Cardinal remuxed = object->m_Resources.GetItemCount();
+      upnp_server->AddSafeResourceUri(object, rooturi, ips,
+                                      CUPnPRemuxer::PATH_PREFIX + file_path,
+                                      CUPnPRemuxer::PROTOCOL_INFO);
+      for (NPT_Cardinal i = remuxed; i < object->m_Resources.GetItemCount(); i++)
+      {
+        object->m_Resources[i].m_Duration = resource.m_Duration;
+        object->m_Resources[i].m_Resolution = resource.m_Resolution;
+      }
+    }
+
     // Some upnp clients expect all audio items to have parent root id 4
 #ifdef WMP_ID_MAPPING
     object->m_ParentID = EncodeObjectId("4");
@@ -0,0 +1,600 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "UPnPRemuxer.h"
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "ServiceBroker.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "threads/Condition.h"
+#include "threads/Thread.h"
+#include "utils/Digest.h"
+#include "utils/SortUtils.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <set>
+#include <utility>
+#include <vector>
+
+extern "C"
+{
+#include <libavformat/avformat.h>
+}
+
+using namespace XFILE;
+using KODI::UTILITY::CDigest;
+
+namespace
+{
+constexpr const char* CACHE_FOLDER = "special://temp/upnpremux/";
+constexpr const char* CACHE_EXTENSION = ".ts";
+constexpr const char* PART_EXTENSION = ".part";
+
+//! Remuxing reads and writes whole files, only that many run at the same time.
+constexpr size_t MAX_RUNNING_JOBS = 2;
+constexpr int64_t MAX_CACHE_SIZE = int64_t{16} * 1024 * 1024 * 1024;
+constexpr int IO_BUFFER_SIZE = 65536;
+
+//! Containers whose streams usually fit in MPEG-TS, but that many renderers don't play.
+constexpr std::array REMUX_EXTENSIONS = {".mkv", ".avi"};
+
+bool IsSupportedCodec(AVCodecID id)
+{
+  switch (id)
+  {
+    case AV_CODEC_ID_MPEG1VIDEO:
+    case AV_CODEC_ID_MPEG2VIDEO:
+    case AV_CODEC_ID_MPEG4:
+    case AV_CODEC_ID_H264:
+    case AV_CODEC_ID_HEVC:
+    case AV_CODEC_ID_VC1:
+    case AV_CODEC_ID_MP2:
+    case AV_CODEC_ID_MP3:
+    case AV_CODEC_ID_AAC:
+    case AV_CODEC_ID_AC3:
+    case AV_CODEC_ID_EAC3:
+    case AV_CODEC_ID_DTS:
+    case AV_CODEC_ID_TRUEHD:
+      return true;
+    default:
+      return false;
+  }
+}
+
+int ReadCallback(void* h, uint8_t* buf, int size)
+{
+  CFile* file = static_cast<CFile*>(h);
+  const ssize_t read = file->Read(buf, size);
+  if (read < 0)
+    return AVERROR(EIO);
+  return read == 0 ? AVERROR_EOF : static_cast<int>(read);
+}
+
+int64_t SeekCallback(void* h, int64_t pos, int whence)
+{
+  CFile* file = static_cast<CFile*>(h);
+  if (whence == AVSEEK_SIZE)
+    return file->GetLength();
+  else
+    return file->Seek(pos, whence & ~AVSEEK_FORCE);
+}
+
+struct IOContextDeleter
+{
+  void operator()(AVIOContext* context) const
+  {
+    av_freep(&context->buffer);
+    avio_context_free(&context);
+  }
+};
+
+struct InputContextDeleter
+{
+  void operator()(AVFormatContext* context) const { avformat_close_input(&context); }
+};
+
+struct OutputContextDeleter
+{
+  void operator()(AVFormatContext* context) const { avformat_free_context(context); }
+};
+
+struct PacketDeleter
+{
+  void operator()(AVPacket* packet) const { av_packet_free(&packet); }
+};
+
+std::unique_ptr<AVIOContext, IOContextDeleter> AllocIOContext(
+    int writeFlag,
+    void* opaque,
+    int (*read)(void*, uint8_t*, int),
+    int (*write)(void*, const uint8_t*, int),
+    int64_t (*seek)(void*, int64_t, int))
+{
+  auto buffer = static_cast<uint8_t*>(av_malloc(IO_BUFFER_SIZE));
+  if (!buffer)
+    return nullptr;
+
+  AVIOContext* context =
+      avio_alloc_context(buffer, IO_BUFFER_SIZE, writeFlag, opaque, read, write, seek);
+  if (!context)
+    av_free(buffer);
+  return std::unique_ptr<AVIOContext, IOContextDeleter>(context);
+}
+} // namespace
+
+namespace UPNP
+{
+
+/*!
+ * \brief Remuxes a file into the cache. The remuxed file can be read while it is written.
+ */
+class CUPnPRemuxJob : public CThread
+{
+public:
+  enum class State
+  {
+    RUNNING,
+    DONE,
+    FAILED
+  };
+
+  CUPnPRemuxJob(std::string path, std::string cacheFile, Logger logger)
+    : CThread("UPnPRemuxer"),
+      m_path(std::move(path)),
+      m_cacheFile(std::move(cacheFile)),
+      m_file(URIUtils::ReplaceExtension(m_cacheFile, PART_EXTENSION)),
+      m_logger(std::move(logger))
+  {
+  }
+
+  ~CUPnPRemuxJob() override { StopThread(); }
+
+  State GetState() const
+  {
+    std::unique_lock lock(m_critSection);
+    return m_state;
+  }
+
+  //! The file being written, or the remuxed file in the cache once it is done.
+  std::string GetFile() const
+  {
+    std::unique_lock lock(m_critSection);
+    return m_file;
+  }
+
+  int64_t GetWritten() const
+  {
+    std::unique_lock lock(m_critSection);
+    return m_written;
+  }
+
+  /*!
+   * \brief Wait until data past a position is written or the remux ends.
+   * \param position the position of the reader
+   * \param[out] written the size of the data written
+   */
+  State WaitForData(int64_t position, int64_t& written)
+  {
+    std::unique_lock lock(m_critSection);
+    m_dataWritten.wait(lock, [this, position]
+                       { return m_written > position || m_state != State::RUNNING; });
+    written = m_written;
+    return m_state;
+  }
+
+  /*!
+   * \brief Move the remuxed file to its place in the cache.
+   * \return true if the file is in place, false if it is not done or a reader still has it opened
+   * where it can't be moved then.
+   */
+  bool Finalize()
+  {
+    std::unique_lock lock(m_critSection);
+    if (m_state != State::DONE)
+      return false;
+    if (m_file == m_cacheFile)
+      return true;
+    if (!CFile::Rename(m_file, m_cacheFile))
+      return false;
+    m_file = m_cacheFile;
+    return true;
+  }
+
+protected:
+  void Process() override
+  {
+    const bool remuxed = Remux();
+    m_output.Close();
+    if (!remuxed)
+      CFile::Delete(m_file);
+
+    {
+      std::unique_lock lock(m_critSection);
+      m_state = remuxed ? State::DONE : State::FAILED;
+    }
+    m_dataWritten.notifyAll();
+
+    if (remuxed)
+      Finalize();
+  }
+
+private:
+  bool Remux();
+
+  /*!
+   * \brief Copy the video and audio streams muxers put in MPEG-TS to the output.
+   * \return false if the file has no such video stream
+   */
+  bool AddStreams(AVFormatContext* input, AVFormatContext* output, std::vector<int>& outputStreams);
+
+  static int WriteCallback(void* opaque, const uint8_t* buf, int size);
+
+  const std::string m_path;
+  const std::string m_cacheFile;
+  CFile m_output;
+
+  mutable CCriticalSection m_critSection;
+  XbmcThreads::ConditionVariable m_dataWritten;
+  std::string m_file;
+  int64_t m_written{0};
+  State m_state{State::RUNNING};
+
+  Logger m_logger;
+};
+
+bool CUPnPRemuxJob::Remux()
+{
+  CFile input;
+  if (!input.Open(m_path))
+  {
+    m_logger->error("Unable to open '{}' to remux", m_path);
+    return false;
+  }
+  if (!m_output.OpenForWrite(m_file, true))
+  {
+    m_logger->error("Unable to create '{}'", m_file);
+    return false;
+  }
+
+  const auto inputIO = AllocIOContext(0, &input, ReadCallback, nullptr, SeekCallback);
+  AVFormatContext* inputContext = avformat_alloc_context();
+  if (!inputIO || !inputContext)
+  {
+    avformat_free_context(inputContext);
+    return false;
+  }
+  if (input.IoControl(IOControl::SEEK_POSSIBLE, nullptr) == 0)
+    inputIO->seekable = 0;
+  inputContext->pb = inputIO.get();
+
+  // avformat_open_input() frees the context when it fails
+  if (avformat_open_input(&inputContext, m_path.c_str(), nullptr, nullptr) < 0)
+  {
+    m_logger->error("Unable to open the container of '{}'", m_path);
+    return false;
+  }
+  const std::unique_ptr<AVFormatContext, InputContextDeleter> inputGuard(inputContext);
+  if (avformat_find_stream_info(inputContext, nullptr) < 0)
+  {
+    m_logger->error("Unable to find the streams of '{}'", m_path);
+    return false;
+  }
+
+  AVFormatContext* outputContext = nullptr;
+  if (avformat_alloc_output_context2(&outputContext, nullptr, "mpegts", nullptr) < 0)
+    return false;
+  const std::unique_ptr<AVFormatContext, OutputContextDeleter> outputGuard(outputContext);
+  const auto outputIO = AllocIOContext(1, this, nullptr, WriteCallback, nullptr);
+  if (!outputIO)
+    return false;
+  outputContext->pb = outputIO.get();
+
+  std::vector<int> outputStreams;
+  if (!AddStreams(inputContext, outputContext, outputStreams))
+  {
+    m_logger->info("'{}' has no video stream to remux", m_path);
+    return false;
+  }
+
+  if (avformat_write_header(outputContext, nullptr) < 0)
+    return false;
+
+  const std::unique_ptr<AVPacket, PacketDeleter> packet(av_packet_alloc());
+  if (!packet)
+    return false;
+
+  while (!m_bStop)
+  {
+    const int err = av_read_frame(inputContext, packet.get());
+    if (err == AVERROR_EOF)
+      break;
+    if (err < 0)
+    {
+      m_logger->error("Unable to read '{}' ({})", m_path, err);
+      return false;
+    }
+
+    const AVStream* inputStream = inputContext->streams[packet->stream_index];
+    const int outputIndex = outputStreams[packet->stream_index];
+    if (outputIndex < 0)
+    {
+      av_packet_unref(packet.get());
+      continue;
+    }
+
+    packet->stream_index = outputIndex;
+    av_packet_rescale_ts(packet.get(), inputStream->time_base,
+                         outputContext->streams[outputIndex]->time_base);
+    packet->pos = -1;
+    if (av_interleaved_write_frame(outputContext, packet.get()) < 0)
+    {
+      m_logger->error("Unable to write the remux of '{}'", m_path);
+      return false;
+    }
+  }
+
+  if (m_bStop || av_write_trailer(outputContext) < 0)
+    return false;
+
+  avio_flush(outputIO.get());
+  m_logger->info("Remuxed '{}' to '{}'", m_path, m_cacheFile);
+  return true;
+}
+
+bool CUPnPRemuxJob::AddStreams(AVFormatContext* input,
+                               AVFormatContext* output,
+                               std::vector<int>& outputStreams)
+{
+  bool hasVideo = false;
+  outputStreams.assign(input->nb_streams, -1);
+  for (unsigned int i = 0; i < input->nb_streams; ++i)
+  {
+    const AVStream* stream = input->streams[i];
+    const AVCodecParameters* parameters = stream->codecpar;
+
+    // subtitles are served as files of their own, cover art is a video stream
+    if ((parameters->codec_type != AVMEDIA_TYPE_VIDEO &&
+         parameters->codec_type != AVMEDIA_TYPE_AUDIO) ||
+        (stream->disposition & AV_DISPOSITION_ATTACHED_PIC) ||
+        !IsSupportedCodec(parameters->codec_id))
+      continue;
+
+    AVStream* outputStream = avformat_new_stream(output, nullptr);
+    if (!outputStream || avcodec_parameters_copy(outputStream->codecpar, parameters) < 0)
+      return false;
+    outputStream->codecpar->codec_tag = 0;
+    outputStream->time_base = stream->time_base;
+    outputStreams[i] = outputStream->index;
+
+    if (parameters->codec_type == AVMEDIA_TYPE_VIDEO)
+      hasVideo = true;
+  }
+  return hasVideo;
+}
+
+int CUPnPRemuxJob::WriteCallback(void* opaque, const uint8_t* buf, int size)
+{
+  auto* job = static_cast<CUPnPRemuxJob*>(opaque);
+  if (job->m_output.Write(buf, size) != size)
+    return AVERROR(EIO);
+
+  {
+    std::unique_lock lock(job->m_critSection);
+    job->m_written += size;
+  }
+  job->m_dataWritten.notifyAll();
+  return size;
+}
+
+/*!
+ * \brief Reads a file while it is remuxed, waiting for the data still to be written.
+ */
+class CUPnPRemuxStream : public NPT_InputStream
+{
+public:
+  explicit CUPnPRemuxStream(std::shared_ptr<CUPnPRemuxJob> job) : m_job(std::move(job)) {}
+
+  bool Open() { return m_file.Open(m_job->GetFile(), READ_NO_CACHE); }
+
+  NPT_Result Read(void* buffer, NPT_Size bytes_to_read, NPT_Size* bytes_read = nullptr) override
+  {
+    if (bytes_read)
+      *bytes_read = 0;
+
+    int64_t written = 0;
+    const CUPnPRemuxJob::State state = m_job->WaitForData(m_position, written);
+    if (written <= m_position)
+      return state == CUPnPRemuxJob::State::DONE ? NPT_ERROR_EOS : NPT_FAILURE;
+
+    const auto size =
+        static_cast<NPT_Size>(std::min<int64_t>(bytes_to_read, written - m_position));
+    const ssize_t read = m_file.Read(buffer, size);
+    if (read <= 0)
+      return NPT_FAILURE;
+
+    m_position += read;
+    if (bytes_read)
+      *bytes_read = static_cast<NPT_Size>(read);
+    return NPT_SUCCESS;
+  }
+
+  // the size is unknown until the remux is done, so the stream isn't seekable
+  NPT_Result Seek(NPT_Position /* offset */) override { return NPT_ERROR_NOT_SUPPORTED; }
+  NPT_Result GetSize(NPT_LargeSize& /* size */) override { return NPT_ERROR_NOT_SUPPORTED; }
+
+  NPT_Result Tell(NPT_Position& offset) override
+  {
+    offset = m_position;
+    return NPT_SUCCESS;
+  }
+
+  NPT_Result GetAvailable(NPT_LargeSize& available) override
+  {
+    available = std::max<int64_t>(m_job->GetWritten() - m_position, 0);
+    return NPT_SUCCESS;
+  }
+
+private:
+  std::shared_ptr<CUPnPRemuxJob> m_job;
+  CFile m_file;
+  int64_t m_position{0};
+};
+
+CUPnPRemuxer::CUPnPRemuxer() : m_logger(CServiceBroker::GetLogging().GetLogger("CUPnPRemuxer"))
+{
+}
+
+CUPnPRemuxer::~CUPnPRemuxer()
+{
+  std::unique_lock lock(m_critSection);
+  for (const auto& [file, job] : m_jobs)
+    job->StopThread(false);
+}
+
+bool CUPnPRemuxer::CanRemux(const std::string& path)
+{
+  const std::string extension = StringUtils::ToLower(URIUtils::GetExtension(path));
+  return std::ranges::find(REMUX_EXTENSIONS, extension) != REMUX_EXTENSIONS.end();
+}
+
+NPT_Result CUPnPRemuxer::Serve(const NPT_HttpRequest& request,
+                               const NPT_HttpRequestContext& context,
+                               NPT_HttpResponse& response,
+                               const std::string& path)
+{
+  const std::string cacheFile = GetCacheFile(path);
+  if (cacheFile.empty())
+  {
+    response.SetStatus(404, "File Not Found");
+    return NPT_SUCCESS;
+  }
+
+  std::shared_ptr<CUPnPRemuxJob> job;
+  {
+    std::unique_lock lock(m_critSection);
+    RemoveFinishedJobs();
+
+    const auto it = m_jobs.find(cacheFile);
+    if (it != m_jobs.end())
+      job = it->second;
+    else if (m_failedFiles.contains(cacheFile))
+    {
+      response.SetStatus(415, "Unsupported Media Type");
+      return NPT_SUCCESS;
+    }
+    else if (!CFile::Exists(cacheFile))
+    {
+      const auto running = static_cast<size_t>(std::ranges::count_if(
+          m_jobs, [](const auto& entry)
+          { return entry.second->GetState() == CUPnPRemuxJob::State::RUNNING; }));
+      if (running >= MAX_RUNNING_JOBS)
+      {
+        m_logger->warn("Not remuxing '{}', {} files are already being remuxed", path, running);
+        response.SetStatus(503, "Service Unavailable");
+        return NPT_SUCCESS;
+      }
+
+      PruneCache();
+      if (!CDirectory::Exists(CACHE_FOLDER))
+        CDirectory::Create(CACHE_FOLDER);
+
+      job = std::make_shared<CUPnPRemuxJob>(path, cacheFile, m_logger);
+      m_jobs.emplace(cacheFile, job);
+      job->Create();
+    }
+  }
+
+  if (job && job->GetState() == CUPnPRemuxJob::State::FAILED)
+  {
+    response.SetStatus(415, "Unsupported Media Type");
+    return NPT_SUCCESS;
+  }
+
+  NPT_InputStreamReference stream;
+  if (job && job->GetState() == CUPnPRemuxJob::State::RUNNING)
+  {
+    auto remuxStream = std::make_unique<CUPnPRemuxStream>(job);
+    if (remuxStream->Open())
+      stream = remuxStream.release();
+  }
+  if (stream.IsNull())
+  {
+    // the complete file can be served with ranges
+    NPT_File file(job ? job->GetFile().c_str() : cacheFile.c_str());
+    if (NPT_FAILED(file.Open(NPT_FILE_OPEN_MODE_READ)) || NPT_FAILED(file.GetInputStream(stream)))
+      return NPT_ERROR_NO_SUCH_ITEM;
+  }
+
+  return PLT_HttpServer::ServeStream(request, context, response, stream, MIME_TYPE);
+}
+
+std::string CUPnPRemuxer::GetCacheFile(const std::string& path)
+{
+  // a changed file is remuxed again
+  struct __stat64 info;
+  if (CFile::Stat(path, &info) != 0)
+    return {};
+
+  const std::string key = StringUtils::Format("{}|{}|{}", path, info.st_size, info.st_mtime);
+  return CACHE_FOLDER + CDigest::Calculate(CDigest::Type::MD5, key) + CACHE_EXTENSION;
+}
+
+void CUPnPRemuxer::RemoveFinishedJobs()
+{
+  for (auto it = m_jobs.begin(); it != m_jobs.end();)
+  {
+    const std::shared_ptr<CUPnPRemuxJob>& job = it->second;
+    const CUPnPRemuxJob::State state = job->GetState();
+
+    // keep the jobs still served, their file may not be moved to the cache yet
+    if (state == CUPnPRemuxJob::State::RUNNING || job.use_count() > 1 ||
+        (state == CUPnPRemuxJob::State::DONE && !job->Finalize()))
+    {
+      ++it;
+      continue;
+    }
+
+    if (state == CUPnPRemuxJob::State::FAILED)
+      m_failedFiles.insert(it->first);
+    it = m_jobs.erase(it);
+  }
+}
+
+void CUPnPRemuxer::PruneCache() const
+{
+  CFileItemList items;
+  if (!CDirectory::GetDirectory(CACHE_FOLDER, items, "", DIR_FLAG_NO_FILE_DIRS))
+    return;
+
+  items.Sort(SortBy::DATE, SortOrder::ASCENDING);
+
+  int64_t size = 0;
+  for (const auto& item : items)
+    size += item->GetSize();
+
+  for (const auto& item : items)
+  {
+    const std::string& file = item->GetPath();
+    const bool isPart = URIUtils::HasExtension(file, PART_EXTENSION);
+    if (m_jobs.contains(isPart ? URIUtils::ReplaceExtension(file, CACHE_EXTENSION) : file))
+      continue;
+
+    // the parts left by failed or interrupted remuxes go first
+    if ((isPart || size > MAX_CACHE_SIZE) && CFile::Delete(file))
+      size -= item->GetSize();
+  }
+}
+
+} // namespace UPNP
@@ -0,0 +1,81 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+#include "utils/logtypes.h"
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+#include <Platinum/Source/Platinum/Platinum.h>
+
+namespace UPNP
+{
+
+class CUPnPRemuxJob;
+
+/*!
+ * \brief Serves video files in containers a renderer may not play remuxed to MPEG-TS.
+ *
+ * The audio and video streams are copied as they are, only the container changes. The remuxed
+ * file is written to a cache on disk while it is served, so other clients and later requests
+ * (including seeking ones, once it is complete) read it from there instead of remuxing again.
+ */
+class CUPnPRemuxer
+{
+public:
+  CUPnPRemuxer();
+  ~CUPnPRemuxer();
+
+  //! Prefix of the file paths of the UPnP server to serve remuxed.
+  static constexpr const char* PATH_PREFIX = "remux:";
+
+  //! Mime type of the remuxed files.
+  static constexpr const char* MIME_TYPE = "video/mp2t";
+
+  //! Protocol info of the remuxed resources. They are streamed, seeking needs them complete.
+  static constexpr const char* PROTOCOL_INFO =
+      "http-get:*:video/mp2t:DLNA.ORG_OP=00;DLNA.ORG_CI=0;"
+      "DLNA.ORG_FLAGS=01700000000000000000000000000000";
+
+  /*!
+   * \brief Whether a remuxed resource is offered for a video file, next to the original one.
+   */
+  static bool CanRemux(const std::string& path);
+
+  /*!
+   * \brief Serve a file remuxed, from the cache when it was already remuxed.
+   * \param path the path of the file, without PATH_PREFIX
+   * \return 503 as response status when too many files are already being remuxed
+   */
+  NPT_Result Serve(const NPT_HttpRequest& request,
+                   const NPT_HttpRequestContext& context,
+                   NPT_HttpResponse& response,
+                   const std::string& path);
+
+private:
+  static std::string GetCacheFile(const std::string& path);
+
+  //! Remove the finished jobs, their files are complete in the cache.
+  void RemoveFinishedJobs();
+
+  //! Delete the oldest remuxed files until the cache fits its size limit.
+  void PruneCache() const;
+
+  CCriticalSection m_critSection;
+  std::map<std::string, std::shared_ptr<CUPnPRemuxJob>> m_jobs; // by cache file
+  std::set<std::string> m_failedFiles; // cache files of the files that couldn't be remuxed
+
+  Logger m_logger;
+};
+
+} // namespace UPNP
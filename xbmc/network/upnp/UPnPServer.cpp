@@ -69,6 +69,9 @@ namespace UPNP
 
 NPT_UInt32 CUPnPServer::m_MaxReturnedItems = 0;
 
+// didl-lite fragments kept, a fragment takes one to two KiB
+constexpr size_t MAX_CACHED_DIDL = 10000;
+
 const char* audio_containers[] = {"musicdb://genres/",
                                   "musicdb://artists/",
                                   "musicdb://albums/",
@@ -172,6 +175,7 @@ void CUPnPServer::UpdateContainer(const std::string& id)
   if (itr != m_UpdateIDs.end())
     count = ++itr->second.second;
   m_UpdateIDs[id] = std::make_pair(true, count);
+  ClearCachedDidl();
   PropagateUpdates();
 }
 
@@ -262,6 +266,10 @@ NPT_String CUPnPServer::BuildSafeResourceUri(const NPT_HttpUrl& rooturi,
   else
     filename = URIUtils::GetFileName(mapped_file_path);
 
+  // renderers may tell the type by the extension
+  if (StringUtils::StartsWith(mapped_file_path, CUPnPRemuxer::PATH_PREFIX))
+    filename = URIUtils::ReplaceExtension(filename, ".ts");
+
   filename = CURL::Encode(filename);
   md5 = CDigest::Calculate(CDigest::Type::MD5, mapped_file_path);
   md5 += "/" + filename;
@@ -795,9 +803,14 @@ NPT_Result CUPnPServer::OnBrowseDirectChildren(PLT_ActionReference& action,
 
   items.SetPath(static_cast<const char*>(parent_id));
 
+  // flat listings of the whole library are paged by the database, a client browsing all the songs
+  // of a large library would otherwise wait for all of them on each page
+  const bool paged = GetPagedLibraryItems(starting_index, requested_count, items);
+
   // guard against loading while saving to the same cache file
   // as CArchive currently performs no locking itself
-  bool load;
+  bool load = paged;
+  if (!load)
   {
     NPT_AutoLock lock(m_CacheMutex);
     load = items.Load();
@@ -874,7 +887,112 @@ NPT_Result CUPnPServer::OnBrowseDirectChildren(PLT_ActionReference& action,
   NPT_String action_name = action->GetActionDesc().GetName();
   return BuildResponse(action, items, filter, starting_index, requested_count, sort_criteria,
                        context,
-                       (action_name.Compare("Search", true) == 0) ? NULL : parent_id.GetChars());
+                       (action_name.Compare("Search", true) == 0) ? NULL : parent_id.GetChars(),
+                       paged);
+}
+
+/*----------------------------------------------------------------------
+|   CUPnPServer::GetPagedLibraryItems
++---------------------------------------------------------------------*/
+bool CUPnPServer::GetPagedLibraryItems(NPT_UInt32 starting_index,
+                                       NPT_UInt32 requested_count,
+                                       CFileItemList& items) const
+{
+  const std::string& path = items.GetPath();
+  const bool songs = path == "musicdb://songs/";
+  if (requested_count == 0 || (!songs && path != "musicdb://albums/"))
+    return false;
+
+  CMusicDatabase database;
+  if (!database.Open())
+    return false;
+
+  // the same order as the whole listing, sorted by the database
+  SortDescription sorting = GetDefaultSorting(items);
+  sorting.limitStart = static_cast<int>(starting_index);
+  sorting.limitEnd =
+      static_cast<int>(starting_index + std::min(requested_count, m_MaxReturnedItems));
+
+  const CDatabase::Filter filter;
+  const bool result = songs ? database.GetSongsFullByWhere(path, items, sorting, filter, true)
+                            : database.GetAlbumsByWhere(path, items, sorting, filter);
+  if (!result || !items.HasProperty("total"))
+  {
+    // past the end or failed, the whole listing tells
+    items.Clear();
+    items.SetPath(path);
+    return false;
+  }
+
+  m_logger->debug("Paged {} items of '{}' from {} out of {}", items.Size(), path, starting_index,
+                  items.GetProperty("total").asInteger());
+  return true;
+}
+
+/*----------------------------------------------------------------------
+|   GetDidlCacheKey
++---------------------------------------------------------------------*/
+static std::string GetDidlCacheKey(const PLT_HttpRequestContext& context,
+                                   const char* filter,
+                                   const char* parent_id)
+{
+  // the fragments depend on the address the client reached us on and on the client quirks and
+  // mime types, which are told from its headers
+  std::string key = StringUtils::Format(
+      "{}:{}|{}|{}|", context.GetLocalAddress().GetIpAddress().ToString().GetChars(),
+      context.GetLocalAddress().GetPort(), filter ? filter : "", parent_id ? parent_id : "");
+  for (const char* header : {NPT_HTTP_HEADER_USER_AGENT, NPT_HTTP_HEADER_SERVER,
+                             "X-AV-Client-Info", "X-AV-Physical-Unit-Info"})
+  {
+    const NPT_String* value = context.GetRequest().GetHeaders().GetHeaderValue(header);
+    if (value)
+      key += value->GetChars();
+    key += '|';
+  }
+  return key;
+}
+
+/*----------------------------------------------------------------------
+|   CUPnPServer::GetCachedDidl
++---------------------------------------------------------------------*/
+bool CUPnPServer::GetCachedDidl(const std::string& key, NPT_String& didl)
+{
+  NPT_AutoLock lock(m_DidlMutex);
+  const auto it = m_DidlCache.find(key);
+  if (it == m_DidlCache.end())
+    return false;
+
+  m_DidlLRU.splice(m_DidlLRU.begin(), m_DidlLRU, it->second);
+  didl = it->second->second;
+  return true;
+}
+
+/*----------------------------------------------------------------------
+|   CUPnPServer::CacheDidl
++---------------------------------------------------------------------*/
+void CUPnPServer::CacheDidl(const std::string& key, const NPT_String& didl)
+{
+  NPT_AutoLock lock(m_DidlMutex);
+  if (m_DidlCache.contains(key))
+    return;
+
+  if (m_DidlLRU.size() >= MAX_CACHED_DIDL)
+  {
+    m_DidlCache.erase(m_DidlLRU.back().first);
+    m_DidlLRU.pop_back();
+  }
+  m_DidlLRU.emplace_front(key, didl);
+  m_DidlCache.emplace(key, m_DidlLRU.begin());
+}
+
+/*----------------------------------------------------------------------
+|   CUPnPServer::ClearCachedDidl
++---------------------------------------------------------------------*/
+void CUPnPServer::ClearCachedDidl()
+{
+  NPT_AutoLock lock(m_DidlMutex);
+  m_DidlCache.clear();
+  m_DidlLRU.clear();
 }
 
 /*----------------------------------------------------------------------
@@ -887,7 +1005,8 @@ NPT_Result CUPnPServer::BuildResponse(PLT_ActionReference& action,
                                       NPT_UInt32 requested_count,
                                       const char* sort_criteria,
                                       const PLT_HttpRequestContext& context,
-                                      const char* parent_id /* = NULL */)
+                                      const char* parent_id /* = NULL */,
+                                      bool paged /* = false */)
 {
   NPT_COMPILER_UNUSED(sort_criteria);
 
@@ -931,25 +1050,35 @@ NPT_Result CUPnPServer::BuildResponse(PLT_ActionReference& action,
   NPT_UInt32 max_count = (requested_count == 0) ? m_MaxReturnedItems
                                                 : std::min((unsigned long)requested_count,
                                                            (unsigned long)m_MaxReturnedItems);
-  NPT_UInt32 stop_index = std::min((unsigned long)(starting_index + max_count),
+  // a paged listing only holds the requested items
+  const NPT_UInt32 first_index = paged ? 0 : starting_index;
+  NPT_UInt32 stop_index = std::min((unsigned long)(first_index + max_count),
                                    (unsigned long)items.Size()); // don't return more than we can
 
   NPT_Cardinal count = 0;
-  NPT_Cardinal total = items.Size();
+  NPT_Cardinal total =
+      paged ? static_cast<NPT_Cardinal>(items.GetProperty("total").asInteger()) : items.Size();
   NPT_String didl = didl_header;
   PLT_MediaObjectReference object;
-  for (unsigned long i = starting_index; i < stop_index; ++i)
+  const std::string cache_key = GetDidlCacheKey(context, filter, parent_id);
+  for (unsigned long i = first_index; i < stop_index; ++i)
   {
-    object = Build(items[i], true, context, thumb_loader, parent_id);
-    if (object.IsNull())
+    // the items of the clients paging through a container again are kept
+    const std::string item_key = cache_key + items[i]->GetPath();
+    NPT_String tmp;
+    if (!GetCachedDidl(item_key, tmp))
     {
-      // don't tell the client this item ever existed
-      --total;
-      continue;
-    }
+      object = Build(items[i], true, context, thumb_loader, parent_id);
+      if (object.IsNull())
+      {
+        // don't tell the client this item ever existed
+        --total;
+        continue;
+      }
 
-    NPT_String tmp;
-    NPT_CHECK(PLT_Didl::ToDidl(*object.AsPointer(), filter, tmp));
+      NPT_CHECK(PLT_Didl::ToDidl(*object.AsPointer(), filter, tmp));
+      CacheDidl(item_key, tmp);
+    }
 
     // Neptunes string growing is dead slow for small additions
     if (didl.GetCapacity() < tmp.GetLength() + didl.GetLength())
@@ -1479,6 +1608,12 @@ NPT_Result CUPnPServer::ServeFile(const NPT_HttpRequest& request,
     }
   }
 
+  if (file_path.StartsWith(CUPnPRemuxer::PATH_PREFIX))
+  {
+    const std::string path = file_path.GetChars() + strlen(CUPnPRemuxer::PATH_PREFIX);
+    return m_Remuxer.Serve(request, context, response, path);
+  }
+
   // File requested
   NPT_HttpUrl rooturi(context.GetLocalAddress().GetIpAddress().ToString(),
                       context.GetLocalAddress().GetPort(), "/");
@@ -1536,16 +1671,19 @@ NPT_Result CUPnPServer::ServeFile(const NPT_HttpRequest& request,
   return PLT_HttpServer::ServeFile(request, context, response, file_path);
 }
 
+SortDescription CUPnPServer::GetDefaultSorting(const CFileItemList& items)
+{
+  const std::unique_ptr<CGUIViewState> viewState(
+      CGUIViewState::GetViewState(IsVideoDb(items) ? WINDOW_VIDEO_NAV : -1, items));
+  if (!viewState)
+    return {};
+  return viewState->GetSortMethod();
+}
+
 void CUPnPServer::DefaultSortItems(CFileItemList& items)
 {
-  CGUIViewState* viewState =
-      CGUIViewState::GetViewState(IsVideoDb(items) ? WINDOW_VIDEO_NAV : -1, items);
-  if (viewState)
-  {
-    SortDescription sorting = viewState->GetSortMethod();
-    items.Sort(sorting.sortBy, sorting.sortOrder, sorting.sortAttributes);
-    delete viewState;
-  }
+  const SortDescription sorting = GetDefaultSorting(items);
+  items.Sort(sorting.sortBy, sorting.sortOrder, sorting.sortAttributes);
 }
 
 NPT_Result CUPnPServer::AddSubtitleUriForSecResponse(const NPT_String& movie_md5,
@@ -8,12 +8,15 @@
 
 #pragma once
 
+#include "UPnPRemuxer.h"
 #include "interfaces/IAnnouncer.h"
 #include "utils/logtypes.h"
 
+#include <list>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include <Platinum/Source/Devices/MediaConnect/PltMediaConnect.h>
@@ -24,6 +27,7 @@ class CThumbLoader;
 class CVariant;
 class PLT_MediaObject;
 class PLT_HttpRequestContext;
+struct SortDescription;
 
 namespace UPNP
 {
@@ -125,9 +129,29 @@ public:
                              NPT_UInt32                    requested_count,
                              const char*                   sort_criteria,
                              const PLT_HttpRequestContext& context,
-                             const char*                   parent_id /* = NULL */);
+                             const char*                   parent_id /* = NULL */,
+                             bool                          paged = false);
+
+    /*! \brief Get a page of a flat library listing from the database.
+     \param starting_index index of the first item of the page
+     \param requested_count number of items of the page
+     \param items the listing, with the path set. Gets the page and the size of the listing as
+     "total" property.
+     \return true if the listing was paged, false if the whole listing has to be built
+     */
+    bool GetPagedLibraryItems(NPT_UInt32 starting_index,
+                              NPT_UInt32 requested_count,
+                              CFileItemList& items) const;
+
+    /*! \brief The didl-lite fragments of the items already sent, per client and filter.
+     Cleared when a container is updated.
+     */
+    bool GetCachedDidl(const std::string& key, NPT_String& didl);
+    void CacheDidl(const std::string& key, const NPT_String& didl);
+    void ClearCachedDidl();
 
     // class methods
+    static SortDescription GetDefaultSorting(const CFileItemList& items);
     static void DefaultSortItems(CFileItemList& items);
     static NPT_String GetParentFolder(const NPT_String& file_path)
     {
@@ -145,6 +169,13 @@ public:
     NPT_Mutex m_FileMutex;
     NPT_Map<NPT_String, NPT_String> m_FileMap;
 
+    NPT_Mutex m_DidlMutex;
+    std::list<std::pair<std::string, NPT_String>> m_DidlLRU; // most recently used first
+    std::unordered_map<std::string, std::list<std::pair<std::string, NPT_String>>::iterator>
+        m_DidlCache;
+
+    CUPnPRemuxer m_Remuxer;
+
     std::map<std::string, std::pair<bool, unsigned long> > m_UpdateIDs;
     bool m_scanning;
 
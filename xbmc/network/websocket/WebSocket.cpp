@@ -17,6 +17,8 @@
 #include <sstream>
 #include <string>
 
+#include <zlib.h>
+
 #define MASK_FIN      0x80
 #define MASK_RSV1     0x40
 #define MASK_RSV2     0x20
@@ -30,6 +32,14 @@
 
 #define LENGTH_MIN    0x2
 
+// smaller messages barely shrink, they aren't compressed
+#define DEFLATE_LENGTH_MIN  256
+// limit of an inflated message, the same as the one of a message in the client buffer
+#define INFLATE_LENGTH_MAX  (64 * 1024)
+
+// every deflated message ends with an empty stored block that is removed before sending
+static const char DeflateTail[] = {0x00, 0x00, static_cast<char>(0xFF), static_cast<char>(0xFF)};
+
 CWebSocketFrame::CWebSocketFrame(const char* data, uint64_t length)
 {
   reset();
@@ -43,10 +53,8 @@ CWebSocketFrame::CWebSocketFrame(const char* data, uint64_t length)
 
   // Get the FIN flag
   m_final = ((m_data[0] & MASK_FIN) == MASK_FIN);
-  // Get the RSV1 - RSV3 flags
-  m_extension |= m_data[0] & MASK_RSV1;
-  m_extension |= (m_data[0] & MASK_RSV2) << 1;
-  m_extension |= (m_data[0] & MASK_RSV3) << 2;
+  // Get the RSV1 - RSV3 flags, the same bits a frame is created with
+  m_extension = (m_data[0] & MASK_RSV) >> 4;
   // Get the opcode
   m_opcode = (WebSocketFrameOpcode)(m_data[0] & MASK_OPCODE);
   if (m_opcode >= WebSocketUnknownFrame)
@@ -289,6 +297,118 @@ void CWebSocketMessage::Clear()
   m_frames.clear();
 }
 
+class CWebSocket::CInflater
+{
+public:
+  CInflater() { m_valid = inflateInit2(&m_stream, -MAX_WBITS) == Z_OK; }
+  ~CInflater()
+  {
+    if (m_valid)
+      inflateEnd(&m_stream);
+  }
+
+  // the stream is kept for the whole connection, clients may use context takeover
+  bool Inflate(std::string& data, std::string& result)
+  {
+    if (!m_valid)
+      return false;
+
+    data.append(DeflateTail, sizeof(DeflateTail));
+    m_stream.next_in = reinterpret_cast<Bytef*>(data.data());
+    m_stream.avail_in = static_cast<uInt>(data.size());
+
+    char buffer[4096];
+    do
+    {
+      m_stream.next_out = reinterpret_cast<Bytef*>(buffer);
+      m_stream.avail_out = sizeof(buffer);
+      const int ret = inflate(&m_stream, Z_SYNC_FLUSH);
+      // a final block ends the stream, whatever follows starts a new one
+      if (ret == Z_STREAM_END)
+        inflateReset(&m_stream);
+      else if (ret != Z_OK && ret != Z_BUF_ERROR)
+        return false;
+
+      result.append(buffer, sizeof(buffer) - m_stream.avail_out);
+      if (result.size() > INFLATE_LENGTH_MAX)
+        return false;
+    } while (m_stream.avail_in > 0 || m_stream.avail_out == 0);
+
+    return true;
+  }
+
+private:
+  z_stream m_stream{};
+  bool m_valid;
+};
+
+CWebSocket::CWebSocket()
+{
+  m_state = WebSocketStateNotConnected;
+  m_message = NULL;
+}
+
+CWebSocket::~CWebSocket()
+{
+  if (m_message)
+    delete m_message;
+}
+
+bool CWebSocket::GetMessageData(const CWebSocketMessage* message, std::string& data)
+{
+  data.clear();
+  const std::vector<const CWebSocketFrame*>& frames = message->GetFrames();
+  for (const auto* frame : frames)
+  {
+    if (frame->GetApplicationData() != nullptr)
+      data.append(frame->GetApplicationData(), static_cast<size_t>(frame->GetLength()));
+  }
+
+  if (!m_deflate || frames.empty() ||
+      (frames.front()->GetExtension() & WebSocketExtensionCompressed) == 0)
+    return true;
+
+  if (!m_inflater)
+    m_inflater = std::make_unique<CInflater>();
+
+  std::string inflated;
+  if (!m_inflater->Inflate(data, inflated))
+  {
+    CLog::Log(LOGINFO, "WebSocket: Unable to inflate a compressed message");
+    return false;
+  }
+
+  data = std::move(inflated);
+  return true;
+}
+
+bool CWebSocket::Deflate(const char* data, size_t length, std::string& result)
+{
+  if (data == nullptr || length < DEFLATE_LENGTH_MIN)
+    return false;
+
+  z_stream stream{};
+  if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK)
+    return false;
+
+  result.resize(deflateBound(&stream, static_cast<uLong>(length)) + sizeof(DeflateTail));
+  stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+  stream.avail_in = static_cast<uInt>(length);
+  stream.next_out = reinterpret_cast<Bytef*>(result.data());
+  stream.avail_out = static_cast<uInt>(result.size());
+
+  const int ret = deflate(&stream, Z_SYNC_FLUSH);
+  const size_t size = result.size() - stream.avail_out;
+  deflateEnd(&stream);
+
+  if (ret != Z_OK || stream.avail_in > 0 || size < sizeof(DeflateTail) || size >= length)
+    return false;
+
+  result.resize(size - sizeof(DeflateTail));
+  return true;
+}
+
 const CWebSocketMessage* CWebSocket::Handle(const char* &buffer, size_t &length, bool &send)
 {
   send = false;
@@ -412,7 +532,13 @@ const CWebSocketMessage* CWebSocket::Handle(const char* &buffer, size_t &length,
 
 const CWebSocketMessage* CWebSocket::Send(WebSocketFrameOpcode opcode, const char* data /* = NULL */, uint32_t length /* = 0 */)
 {
-  CWebSocketFrame *frame = GetFrame(opcode, data, length);
+  CWebSocketFrame *frame;
+  std::string compressed;
+  if (m_deflate && (opcode & CONTROL_FRAME) == 0 && Deflate(data, length, compressed))
+    frame = GetFrame(opcode, compressed.data(), static_cast<uint32_t>(compressed.size()), true,
+                     false, 0, WebSocketExtensionCompressed);
+  else
+    frame = GetFrame(opcode, data, length);
   if (frame == NULL || !frame->IsValid())
   {
     CLog::Log(LOGINFO, "WebSocket: Trying to send an invalid frame");
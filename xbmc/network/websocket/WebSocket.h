@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <memory>
 #include <stdint.h>
 #include <string>
 #include <vector>
@@ -25,6 +26,12 @@ enum WebSocketFrameOpcode
   WebSocketUnknownFrame       = 0x10
 };
 
+enum WebSocketFrameExtension
+{
+  // RSV1 of the first frame of a message compressed with permessage-deflate (RFC 7692)
+  WebSocketExtensionCompressed  = 0x04
+};
+
 enum WebSocketState
 {
   WebSocketStateNotConnected    = 0,
@@ -107,16 +114,31 @@ protected:
 class CWebSocket
 {
 public:
-  CWebSocket() { m_state = WebSocketStateNotConnected; m_message = NULL; }
-  virtual ~CWebSocket()
-  {
-    if (m_message)
-      delete m_message;
-  }
+  CWebSocket();
+  virtual ~CWebSocket();
 
   int GetVersion() { return m_version; }
   WebSocketState GetState() { return m_state; }
 
+  /*!
+   * \brief Whether permessage-deflate was negotiated during the handshake
+   *
+   * \details Messages to the client are compressed without context takeover, so a frame built
+   * once can be sent to every client that negotiated the extension.
+   */
+  bool IsDeflateEnabled() const { return m_deflate; }
+
+  /*!
+   * \brief Get the payload of a complete message, inflated if it was compressed
+   */
+  bool GetMessageData(const CWebSocketMessage* message, std::string& data);
+
+  /*!
+   * \brief Compress the payload of a message to a client without context takeover
+   * \return false if the payload is too small to be worth it or compressing failed
+   */
+  static bool Deflate(const char* data, size_t length, std::string& result);
+
   virtual bool Handshake(const char* data, size_t length, std::string &response) = 0;
   virtual const CWebSocketMessage* Handle(const char* &buffer, size_t &length, bool &send);
   virtual const CWebSocketMessage* Send(WebSocketFrameOpcode opcode, const char* data = NULL, uint32_t length = 0);
@@ -129,8 +151,13 @@ protected:
   int m_version;
   WebSocketState m_state;
   CWebSocketMessage *m_message;
+  bool m_deflate = false;
 
   virtual CWebSocketFrame* GetFrame(const char* data, uint64_t length) = 0;
   virtual CWebSocketFrame* GetFrame(WebSocketFrameOpcode opcode, const char* data = NULL, uint32_t length = 0, bool final = true, bool masked = false, int32_t mask = 0, int8_t extension = 0) = 0;
   virtual CWebSocketMessage* GetMessage() = 0;
+
+private:
+  class CInflater;
+  std::unique_ptr<CInflater> m_inflater;
 };
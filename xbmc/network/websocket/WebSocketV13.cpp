@@ -31,9 +31,49 @@
 #define WS_HEADER_PROTOCOL      "Sec-WebSocket-Protocol"
 #define WS_HEADER_PROTOCOL_LC   "sec-websocket-protocol"    // "Sec-WebSocket-Protocol"
 
+#define WS_HEADER_EXTENSIONS    "Sec-WebSocket-Extensions"
+#define WS_HEADER_EXTENSIONS_LC "sec-websocket-extensions"  // "Sec-WebSocket-Extensions"
+
 #define WS_PROTOCOL_JSONRPC     "jsonrpc.xbmc.org"
 #define WS_HEADER_UPGRADE_VALUE "websocket"
 
+#define WS_EXTENSION_DEFLATE    "permessage-deflate"
+#define WS_EXTENSION_DEFLATE_RESPONSE WS_EXTENSION_DEFLATE "; server_no_context_takeover"
+
+namespace
+{
+// Messages to the client are always compressed without context takeover and with the full
+// window, offers asking for a smaller server window are declined
+bool IsDeflateOfferSupported(const std::string& offer)
+{
+  std::vector<std::string> parameters = StringUtils::Split(offer, ";");
+  if (parameters.empty() || StringUtils::Trim(parameters[0]) != WS_EXTENSION_DEFLATE)
+    return false;
+
+  for (size_t i = 1; i < parameters.size(); ++i)
+  {
+    std::string& parameter = StringUtils::Trim(parameters[i]);
+    std::string value;
+    const size_t pos = parameter.find('=');
+    if (pos != std::string::npos)
+    {
+      value = parameter.substr(pos + 1);
+      parameter.erase(pos);
+      StringUtils::Trim(parameter);
+      StringUtils::Trim(value, " \"");
+    }
+
+    if (parameter == "server_no_context_takeover" || parameter == "client_no_context_takeover" ||
+        parameter == "client_max_window_bits")
+      continue;
+    if (parameter == "server_max_window_bits" && value == "15")
+      continue;
+    return false;
+  }
+  return true;
+}
+} // unnamed namespace
+
 bool CWebSocketV13::Handshake(const char* data, size_t length, std::string &response)
 {
   std::string strHeader(data, length);
@@ -130,6 +170,14 @@ bool CWebSocketV13::Handshake(const char* data, size_t length, std::string &resp
     }
   }
 
+  // There might be a "Sec-WebSocket-Extensions" header offering permessage-deflate
+  value = header.getValue(WS_HEADER_EXTENSIONS_LC);
+  if (value && strlen(value) > 0)
+  {
+    std::vector<std::string> offers = StringUtils::Split(value, ",");
+    m_deflate = std::ranges::any_of(offers, IsDeflateOfferSupported);
+  }
+
   CHttpResponse httpResponse(HTTP::Get, HTTP::SwitchingProtocols, HTTP::Version1_1);
   httpResponse.AddHeader(WS_HEADER_UPGRADE, WS_HEADER_UPGRADE_VALUE);
   httpResponse.AddHeader(WS_HEADER_CONNECTION, WS_HEADER_UPGRADE);
@@ -137,6 +185,8 @@ bool CWebSocketV13::Handshake(const char* data, size_t length, std::string &resp
   httpResponse.AddHeader(WS_HEADER_ACCEPT, responseKey);
   if (!websocketProtocol.empty())
     httpResponse.AddHeader(WS_HEADER_PROTOCOL, websocketProtocol);
+  if (m_deflate)
+    httpResponse.AddHeader(WS_HEADER_EXTENSIONS, WS_EXTENSION_DEFLATE_RESPONSE);
 
   response = httpResponse.Create();
 
@@ -18,6 +18,7 @@
 #include "bus/PeripheralBus.h"
 #include "bus/PeripheralBusUSB.h"
 
+#include <algorithm>
 #include <mutex>
 #include <utility>
 #if defined(TARGET_ANDROID)
@@ -401,6 +402,9 @@ void CPeripherals::OnDeviceAdded(const CPeripheralBus& bus, const CPeripheral& p
 {
   OnDeviceChanged();
 
+  // the event scanner sleeps while there are no devices to poll
+  m_eventScanner->HandleEvents(false);
+
   //! @todo Improve device notifications in v18
 #if 0
   bool bNotify = true;
@@ -892,6 +896,13 @@ void CPeripherals::ProcessEvents(void)
     bus->ProcessEvents();
 }
 
+bool CPeripherals::HasEventSources(void)
+{
+  std::unique_lock lock(m_critSectionBusses);
+  return std::any_of(m_busses.begin(), m_busses.end(),
+                     [](const PeripheralBusPtr& bus) { return bus->HasEventSources(); });
+}
+
 void CPeripherals::EnableButtonMapping()
 {
   std::vector<PeripheralBusPtr> busses;
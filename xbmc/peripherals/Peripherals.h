@@ -275,6 +275,7 @@ public:
 
   // implementation of IEventScannerCallback
   void ProcessEvents(void) override;
+  bool HasEventSources(void) override;
 
   /*!
    * \brief Initialize button mapping
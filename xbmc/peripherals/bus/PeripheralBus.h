@@ -188,6 +188,13 @@ public:
    */
   virtual void ProcessEvents(void) {}
 
+  /*!
+   * \brief Whether ProcessEvents() has any device to poll
+   *
+   * The event scanner doesn't wake up when no bus has one.
+   */
+  virtual bool HasEventSources() const { return true; }
+
   /*!
    * \brief Initialize button mapping
    * \return True if button mapping is enabled for this bus
@@ -71,6 +71,7 @@ public:
                                             const int iProductId) const override;
   void GetDirectory(const std::string& strPath, CFileItemList& items) const override;
   void ProcessEvents(void) override;
+  bool HasEventSources() const override { return GetNumberOfPeripherals() > 0; }
   void EnableButtonMapping() override;
   void PowerOff(const std::string& strLocation) override;
 
@@ -36,6 +36,7 @@ public:
 
   // Implementation of CPeripheralBus
   void ProcessEvents() override;
+  bool HasEventSources() const override { return GetNumberOfPeripherals() > 0; }
   bool PerformDeviceScan(PeripheralScanResults& results) override;
 
 private:
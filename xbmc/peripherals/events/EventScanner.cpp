@@ -23,6 +23,10 @@ using namespace PERIPHERALS;
 // input latency when the game is running at < 1/4 speed.
 #define WATCHDOG_TIMEOUT_MS 80
 
+// Timeout when there are no devices to poll. A new device wakes the scanner up, this only
+// keeps up with a bus that doesn't tell about its devices.
+#define IDLE_TIMEOUT_MS 1000
+
 CEventScanner::CEventScanner(IEventScannerCallback& callback)
   : CThread("PeripEventScan"),
     m_callback(callback)
@@ -165,6 +169,9 @@ std::chrono::milliseconds CEventScanner::GetScanIntervalMs() const
     bHasActiveHandle = !m_activeHandles.empty();
   }
 
+  if (!bHasActiveHandle && !m_callback.HasEventSources())
+    return std::chrono::milliseconds(IDLE_TIMEOUT_MS);
+
   if (!bHasActiveHandle)
   {
     // this truncates to 16 (from 16.666) should it round up to 17 using std::nearbyint or should we use nanoseconds?
@@ -19,5 +19,10 @@ public:
   virtual ~IEventScannerCallback(void) = default;
 
   virtual void ProcessEvents(void) = 0;
+
+  /*!
+   * \brief Whether there is any device to process events of
+   */
+  virtual bool HasEventSources(void) = 0;
 };
 } // namespace PERIPHERALS
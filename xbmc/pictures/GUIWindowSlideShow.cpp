@@ -29,6 +29,7 @@
 #include "input/actions/ActionIDs.h"
 #include "input/mouse/MouseEvent.h"
 #include "interfaces/AnnouncementManager.h"
+#include "jobs/JobManager.h"
 #include "pictures/GUIViewStatePictures.h"
 #include "pictures/PictureThumbLoader.h"
 #include "pictures/SlideShowDelegator.h"
@@ -47,6 +48,7 @@
 #include "video/VideoFileItemClassify.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
 #include <memory>
 
 using namespace KODI;
@@ -58,6 +60,9 @@ using namespace std::chrono_literals;
 #define MAX_ZOOM_FACTOR                     10
 #define MAX_PICTURE_SIZE             2048*2048
 
+#define PREFETCH_SLIDES_AHEAD                3
+#define PREFETCH_SLIDES_BEHIND               1
+
 #define IMMEDIATE_TRANSITION_TIME          1
 
 #define PICTURE_MOVE_AMOUNT              0.02f
@@ -73,6 +78,44 @@ using namespace std::chrono_literals;
 
 static float zoomamount[10] = { 1.0f, 1.2f, 1.5f, 2.0f, 2.8f, 4.0f, 6.0f, 9.0f, 13.5f, 20.0f };
 
+class CBackgroundPicLoader::CPrefetchJob : public CJob
+{
+public:
+  explicit CPrefetchJob(std::shared_ptr<PrefetchedPic> pic) : m_pic(std::move(pic)) {}
+
+  ~CPrefetchJob() override
+  {
+    // also when the job manager dropped the job, nobody waits for it forever
+    m_pic->done.Set();
+  }
+
+  const char* GetType() const override { return "slideshowprefetch"; }
+
+  RESOURCE GetResource(std::string& host) const override
+  {
+    // local pictures keep the cpu busy with decoding, remote ones wait for their host
+    const std::string file{IMAGE_FILES::CImageFileURL(m_pic->fileName).GetTargetFile()};
+    if (!URIUtils::IsRemote(file))
+      return RESOURCE_CPU;
+
+    host = CURL(file).GetHostName();
+    return RESOURCE_NETWORK;
+  }
+
+  bool DoWork() override
+  {
+    if (m_pic->cancelled)
+      return false;
+
+    m_pic->texture = Decode(m_pic->fileName, m_pic->maxWidth, m_pic->maxHeight);
+    m_pic->decoded = true;
+    return m_pic->texture != nullptr;
+  }
+
+private:
+  const std::shared_ptr<PrefetchedPic> m_pic;
+};
+
 CBackgroundPicLoader::CBackgroundPicLoader() : CThread("BgPicLoader")
 {
 }
@@ -80,6 +123,11 @@ CBackgroundPicLoader::CBackgroundPicLoader() : CThread("BgPicLoader")
 CBackgroundPicLoader::~CBackgroundPicLoader()
 {
   StopThread();
+
+  std::unique_lock lock(m_prefetchSection);
+  for (const auto& [slideNumber, pic] : m_prefetched)
+    CancelPrefetch(*pic);
+  m_prefetched.clear();
 }
 
 void CBackgroundPicLoader::Create(CGUIWindowSlideShow *pCallback)
@@ -100,8 +148,19 @@ void CBackgroundPicLoader::Process()
       if (m_pCallback)
       {
         auto start = std::chrono::steady_clock::now();
-        std::unique_ptr<CTexture> texture =
-            CTexture::LoadFromFile(m_strFileName, m_maxWidth, m_maxHeight);
+        std::unique_ptr<CTexture> texture;
+        bool decoded = false;
+        const std::shared_ptr<PrefetchedPic> prefetched =
+            TakePrefetched(m_iSlideNumber, m_strFileName, m_maxWidth, m_maxHeight);
+        if (prefetched)
+        {
+          if (AbortableWait(prefetched->done) == WAIT_INTERRUPTED)
+            break;
+          texture = std::move(prefetched->texture);
+          decoded = prefetched->decoded;
+        }
+        if (!decoded)
+          texture = Decode(m_strFileName, m_maxWidth, m_maxHeight);
 
         auto end = std::chrono::steady_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
@@ -112,7 +171,8 @@ void CBackgroundPicLoader::Process()
         bool bFullSize = false;
         if (texture)
         {
-          bFullSize = ((int)texture->GetWidth() < m_maxWidth) && ((int)texture->GetHeight() < m_maxHeight);
+          bFullSize = texture->GetWidth() >= texture->GetOriginalWidth() &&
+                      texture->GetHeight() >= texture->GetOriginalHeight();
           if (!bFullSize)
           {
             int iSize = texture->GetWidth() * texture->GetHeight() - MAX_PICTURE_SIZE;
@@ -146,6 +206,78 @@ void CBackgroundPicLoader::LoadPic(int iPic, int iSlideNumber, const std::string
   m_loadPic.Set();
 }
 
+void CBackgroundPicLoader::Prefetch(const std::vector<std::pair<int, std::string>>& slides,
+                                    int maxWidth,
+                                    int maxHeight)
+{
+  std::unique_lock lock(m_prefetchSection);
+
+  std::map<int, std::shared_ptr<PrefetchedPic>> prefetched;
+  for (const auto& [slideNumber, fileName] : slides)
+  {
+    auto it = m_prefetched.find(slideNumber);
+    if (it != m_prefetched.end() && it->second->fileName == fileName &&
+        it->second->maxWidth == maxWidth && it->second->maxHeight == maxHeight)
+    {
+      prefetched.insert(m_prefetched.extract(it));
+      continue;
+    }
+
+    // already taken by LoadPic()
+    if (m_isLoading && slideNumber == m_iSlideNumber)
+      continue;
+
+    auto pic = std::make_shared<PrefetchedPic>();
+    pic->fileName = fileName;
+    pic->maxWidth = maxWidth;
+    pic->maxHeight = maxHeight;
+    pic->jobId =
+        CServiceBroker::GetJobManager()->AddJob(new CPrefetchJob(pic), nullptr, CJob::PRIORITY_LOW);
+    prefetched[slideNumber] = std::move(pic);
+  }
+
+  // the user skipped past these
+  for (const auto& [slideNumber, pic] : m_prefetched)
+    CancelPrefetch(*pic);
+
+  m_prefetched = std::move(prefetched);
+}
+
+std::unique_ptr<CTexture> CBackgroundPicLoader::Decode(const std::string& fileName,
+                                                       int maxWidth,
+                                                       int maxHeight)
+{
+  // fit the picture into the given size instead of keeping all its pixels, a size of 0 keeps
+  // the picture at its own size
+  return CTexture::LoadFromFile(fileName, maxWidth, maxHeight, CAspectRatio::KEEP);
+}
+
+std::shared_ptr<CBackgroundPicLoader::PrefetchedPic> CBackgroundPicLoader::TakePrefetched(
+    int slideNumber, const std::string& fileName, int maxWidth, int maxHeight)
+{
+  std::unique_lock lock(m_prefetchSection);
+
+  auto it = m_prefetched.find(slideNumber);
+  if (it == m_prefetched.end())
+    return {};
+
+  std::shared_ptr<PrefetchedPic> pic = std::move(it->second);
+  m_prefetched.erase(it);
+  if (pic->fileName != fileName || pic->maxWidth != maxWidth || pic->maxHeight != maxHeight)
+  {
+    CancelPrefetch(*pic);
+    return {};
+  }
+
+  return pic;
+}
+
+void CBackgroundPicLoader::CancelPrefetch(PrefetchedPic& pic)
+{
+  pic.cancelled = true;
+  CServiceBroker::GetJobManager()->CancelJob(pic.jobId);
+}
+
 CGUIWindowSlideShow::CGUIWindowSlideShow(void) : CGUIDialog(WINDOW_SLIDESHOW, "SlideShow.xml")
 {
   m_loadType = KEEP_IN_MEMORY;
@@ -264,6 +396,8 @@ void CGUIWindowSlideShow::Reset()
   m_iCurrentPic = 0;
   m_iDirection = 1;
   m_iLastFailedNextSlide = -1;
+  m_iPrefetchSlide = -1;
+  m_iFullSizeSlide = -1;
   m_slides.clear();
   AnnouncePlaylistClear();
   m_Resolution = CServiceBroker::GetWinSystem()->GetGfxContext().GetVideoResolution();
@@ -439,6 +573,7 @@ void CGUIWindowSlideShow::Process(unsigned int currentTime, CDirtyRegionList &re
   {
     m_pBackgroundLoader = std::make_unique<CBackgroundPicLoader>();
     m_pBackgroundLoader->Create(this);
+    m_iPrefetchSlide = -1;
   }
 
   bool bSlideShow = m_bSlideShow && !m_bPause && !m_bPlayingVideo;
@@ -541,6 +676,22 @@ void CGUIWindowSlideShow::Process(unsigned int currentTime, CDirtyRegionList &re
     }
   }
 
+  // the current picture was decoded at screen size, decode all of it once the user zooms in
+  if (m_fZoom > 1.0f && m_Image[m_iCurrentPic]->IsLoaded() &&
+      m_Image[m_iCurrentPic]->SlideNumber() == m_iCurrentSlide &&
+      !m_Image[m_iCurrentPic]->FullSize() && m_iFullSizeSlide != m_iCurrentSlide &&
+      !m_pBackgroundLoader->IsLoading())
+  {
+    CFileItemPtr item = m_slides.at(m_iCurrentSlide);
+    std::string picturePath = GetPicturePath(item.get());
+    if (!picturePath.empty())
+    {
+      CLog::Log(LOGDEBUG, "Loading the full size image {}: {}", m_iCurrentSlide, item->GetPath());
+      m_pBackgroundLoader->LoadPic(m_iCurrentPic, m_iCurrentSlide, picturePath, 0, 0);
+    }
+    m_iFullSizeSlide = m_iCurrentSlide;
+  }
+
   // check if we should discard an already loaded next slide
   if (m_Image[1 - m_iCurrentPic]->IsLoaded() &&
       m_Image[1 - m_iCurrentPic]->SlideNumber() != m_iNextSlide)
@@ -569,6 +720,9 @@ void CGUIWindowSlideShow::Process(unsigned int currentTime, CDirtyRegionList &re
     }
   }
 
+  if (m_Image[m_iCurrentPic]->IsLoaded())
+    PrefetchSlides();
+
   bool bPlayVideo = IsVideo(*m_slides.at(m_iCurrentSlide)) && m_iVideoSlide != m_iCurrentSlide;
   if (bPlayVideo)
     bSlideShow = false;
@@ -765,6 +919,42 @@ void CGUIWindowSlideShow::RenderEx()
   CGUIWindow::RenderEx();
 }
 
+void CGUIWindowSlideShow::PrefetchSlides()
+{
+  if (m_iPrefetchSlide == m_iCurrentSlide && m_iPrefetchDirection == m_iDirection &&
+      m_prefetchSlideCount == m_slides.size())
+    return;
+
+  m_iPrefetchSlide = m_iCurrentSlide;
+  m_iPrefetchDirection = m_iDirection;
+  m_prefetchSlideCount = m_slides.size();
+
+  std::vector<std::pair<int, std::string>> slides;
+  const auto addSlide = [this, &slides](int slide)
+  {
+    const CFileItemPtr& item = m_slides.at(slide);
+    if (IsVideo(*item) || item->HasProperty("unplayable"))
+      return;
+    if (std::find_if(slides.begin(), slides.end(), [slide](const auto& prefetched)
+                     { return prefetched.first == slide; }) == slides.end())
+      slides.emplace_back(slide, item->GetDynPath());
+  };
+
+  const int count = static_cast<int>(m_slides.size());
+  const int step = m_iDirection >= 0 ? 1 : -1;
+  for (int i = 1; i <= PREFETCH_SLIDES_AHEAD && i < count; i++)
+    addSlide(((m_iCurrentSlide + i * step) % count + count) % count);
+  for (int i = 1; i <= PREFETCH_SLIDES_BEHIND && i < count; i++)
+    addSlide(((m_iCurrentSlide - i * step) % count + count) % count);
+
+  // the size the slides are loaded with once they're shown, unzoomed
+  const RESOLUTION_INFO res = CServiceBroker::GetWinSystem()->GetGfxContext().GetResInfo();
+  int maxWidth, maxHeight;
+  GetCheckedSize(static_cast<float>(res.iWidth), static_cast<float>(res.iHeight), maxWidth,
+                 maxHeight);
+  m_pBackgroundLoader->Prefetch(slides, maxWidth, maxHeight);
+}
+
 int CGUIWindowSlideShow::GetNextSlide()
 {
   if (m_slides.size() <= 1)
@@ -1248,6 +1438,13 @@ void CGUIWindowSlideShow::OnLoadPic(int iPic,
     }
     CLog::Log(LOGDEBUG, "Finished background loading slot {}, {}: {}", iPic, iSlideNumber,
               m_slides.at(iSlideNumber)->GetPath());
+    if (m_Image[iPic]->IsLoaded() && m_Image[iPic]->SlideNumber() == iSlideNumber)
+    { // the full size picture, keep showing it as it is
+      m_Image[iPic]->SetOriginalSize(pTexture->GetOriginalWidth(), pTexture->GetOriginalHeight(),
+                                     bFullSize);
+      m_Image[iPic]->UpdateTexture(std::move(pTexture));
+      return;
+    }
     m_Image[iPic]->SetOriginalSize(pTexture->GetOriginalWidth(), pTexture->GetOriginalHeight(),
                                    bFullSize);
     m_Image[iPic]->SetTexture(iSlideNumber, std::move(pTexture), GetDisplayEffect(iSlideNumber));
@@ -1413,8 +1610,11 @@ void CGUIWindowSlideShow::AddItems(const std::string &strPath, path_set *recursi
 
 void CGUIWindowSlideShow::GetCheckedSize(float width, float height, int &maxWidth, int &maxHeight)
 {
-  maxWidth = CServiceBroker::GetRenderSystem()->GetMaxTextureSize();
-  maxHeight = CServiceBroker::GetRenderSystem()->GetMaxTextureSize();
+  // the picture is shown at screen size, only zooming in needs more pixels
+  const auto maxTextureSize =
+      static_cast<float>(CServiceBroker::GetRenderSystem()->GetMaxTextureSize());
+  maxWidth = static_cast<int>(std::min(width, maxTextureSize));
+  maxHeight = static_cast<int>(std::min(height, maxTextureSize));
 }
 
 std::string CGUIWindowSlideShow::GetPicturePath(CFileItem *item)
@@ -12,13 +12,20 @@
 #include "guilib/GUIDialog.h"
 #include "interfaces/IAnnouncer.h"
 #include "interfaces/ISlideShowDelegate.h"
+#include "threads/CriticalSection.h"
 #include "threads/Event.h"
 #include "threads/Thread.h"
 
+#include <atomic>
+#include <map>
 #include <memory>
 #include <set>
+#include <string>
+#include <utility>
+#include <vector>
 
 class CFileItemList;
+class CTexture;
 class CVariant;
 
 class CGUIWindowSlideShow;
@@ -35,7 +42,42 @@ public:
   int SlideNumber() const { return m_iSlideNumber; }
   int Pic() const { return m_iPic; }
 
+  /*!
+   * \brief Decode the given slides ahead of time.
+   *
+   * The slides are decoded in parallel by the job manager, LoadPic() takes them from here
+   * instead of decoding them again. Slides that were given before and aren't given anymore are
+   * dropped, decoding them is cancelled.
+   *
+   * \param slides slide number and file name of each slide
+   * \param maxWidth, maxHeight the size LoadPic() is going to ask for
+   */
+  void Prefetch(const std::vector<std::pair<int, std::string>>& slides,
+                int maxWidth,
+                int maxHeight);
+
 private:
+  class CPrefetchJob;
+
+  struct PrefetchedPic
+  {
+    std::string fileName;
+    int maxWidth{0};
+    int maxHeight{0};
+    unsigned int jobId{0};
+    std::atomic_bool cancelled{false};
+    bool decoded{false};
+    CEvent done{true};
+    std::unique_ptr<CTexture> texture;
+  };
+
+  static std::unique_ptr<CTexture> Decode(const std::string& fileName, int maxWidth, int maxHeight);
+  std::shared_ptr<PrefetchedPic> TakePrefetched(int slideNumber,
+                                                const std::string& fileName,
+                                                int maxWidth,
+                                                int maxHeight);
+  void CancelPrefetch(PrefetchedPic& pic);
+
   void Process() override;
   int m_iPic = 0;
   int m_iSlideNumber = 0;
@@ -46,6 +88,9 @@ private:
   CEvent m_loadPic;
   bool m_isLoading = false;
 
+  CCriticalSection m_prefetchSection;
+  std::map<int, std::shared_ptr<PrefetchedPic>> m_prefetched;
+
   CGUIWindowSlideShow* m_pCallback = nullptr;
 };
 
@@ -134,6 +179,7 @@ private:
   void GetCheckedSize(float width, float height, int &maxWidth, int &maxHeight);
   std::string GetPicturePath(CFileItem *item);
   int  GetNextSlide();
+  void PrefetchSlides();
 
   void AnnouncePlayerPlay(const CFileItemPtr& item);
   void AnnouncePlayerPause(const CFileItemPtr& item);
@@ -167,6 +213,10 @@ private:
   std::unique_ptr<CBackgroundPicLoader> m_pBackgroundLoader;
   int m_iLastFailedNextSlide;
   bool m_bLoadNextPic;
+  int m_iPrefetchSlide = -1;
+  int m_iPrefetchDirection = 0;
+  size_t m_prefetchSlideCount = 0;
+  int m_iFullSizeSlide = -1;
   RESOLUTION m_Resolution = RES_INVALID;
   CPoint m_firstGesturePoint;
 };
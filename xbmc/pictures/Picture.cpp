@@ -12,6 +12,7 @@
 #include "ServiceBroker.h"
 #include "URL.h"
 #include "filesystem/File.h"
+#include "guilib/DDSImage.h"
 #include "guilib/Texture.h"
 #include "guilib/imagefactory.h"
 #include "settings/AdvancedSettings.h"
@@ -22,6 +23,7 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <cstring>
 
 extern "C" {
 #include <libswscale/swscale.h>
@@ -60,6 +62,22 @@ bool CPicture::CreateThumbnailFromSurface(const unsigned char *buffer, int width
 {
   CLog::Log(LOGDEBUG, "cached image '{}' size {}x{}", CURL::GetRedacted(thumbFile), width, height);
 
+  if (URIUtils::HasExtension(thumbFile, ".dds"))
+  {
+    // stored as raw pixels, so showing the image doesn't need to decode it again
+    CDDSImage image(width, height, XB_FMT_A8R8G8B8);
+    bool hasAlpha = false;
+    for (int y = 0; y < height; ++y)
+    {
+      const unsigned char* src = buffer + static_cast<size_t>(y) * stride;
+      memcpy(image.GetData() + static_cast<size_t>(y) * width * 4, src, width * 4);
+      for (int x = 0; x < width && !hasAlpha; ++x)
+        hasAlpha = src[x * 4 + 3] != 0xff;
+    }
+    image.SetAlpha(hasAlpha);
+    return image.WriteFile(thumbFile);
+  }
+
   unsigned char *thumb = NULL;
   unsigned int thumbsize=0;
   IImage* pImage = ImageFactory::CreateLoader(thumbFile);
@@ -191,6 +209,35 @@ bool CPicture::ResizeTexture(const std::string &image, uint8_t *pixels, uint32_t
   return success;
 }
 
+namespace
+{
+void GetMaxCacheSize(uint32_t width, uint32_t height, uint32_t& max_width, uint32_t& max_height)
+{
+  const std::shared_ptr<CAdvancedSettings> advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+
+  // if no max width or height is specified, don't resize
+  if (max_width == 0)
+    max_width = width;
+  if (max_height == 0)
+    max_height = height;
+
+  uint32_t res_height = advancedSettings->m_imageRes;
+  if (advancedSettings->m_fanartRes > advancedSettings->m_imageRes)
+  { // 16x9 images larger than the fanart res use that rather than the image res
+    if (fabsf(static_cast<float>(width) / static_cast<float>(height) / (16.0f / 9.0f) - 1.0f)
+        <= 0.01f)
+    {
+      res_height = advancedSettings->m_fanartRes; // use height defined in fanartRes
+    }
+  }
+
+  uint32_t res_width = res_height * 16/9;
+
+  max_height = std::min(max_height, res_height);
+  max_width  = std::min(max_width, res_width);
+}
+} // namespace
+
 bool CPicture::CacheTexture(CTexture* texture,
                             uint32_t& dest_width,
                             uint32_t& dest_height,
@@ -208,38 +255,19 @@ bool CPicture::CacheTexture(uint8_t *pixels, uint32_t width, uint32_t height, ui
 {
   const std::shared_ptr<CAdvancedSettings> advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
 
-  // if no max width or height is specified, don't resize
-  if (dest_width == 0)
-    dest_width = width;
-  if (dest_height == 0)
-    dest_height = height;
   if (scalingAlgorithm == CPictureScalingAlgorithm::NoAlgorithm)
     scalingAlgorithm = advancedSettings->m_imageScalingAlgorithm;
 
-  uint32_t max_height = advancedSettings->m_imageRes;
-  if (advancedSettings->m_fanartRes > advancedSettings->m_imageRes)
-  { // 16x9 images larger than the fanart res use that rather than the image res
-    if (fabsf(static_cast<float>(width) / static_cast<float>(height) / (16.0f / 9.0f) - 1.0f)
-        <= 0.01f)
-    {
-      max_height = advancedSettings->m_fanartRes; // use height defined in fanartRes
-    }
-  }
-
-  uint32_t max_width = max_height * 16/9;
+  uint32_t max_width = dest_width;
+  uint32_t max_height = dest_height;
+  GetMaxCacheSize(width, height, max_width, max_height);
 
-  dest_height = std::min(dest_height, max_height);
-  dest_width  = std::min(dest_width, max_width);
-
-  if (width > dest_width || height > dest_height || orientation)
+  if (width > max_width || height > max_height || orientation)
   {
     bool success = false;
 
-    dest_width = std::min(width, dest_width);
-    dest_height = std::min(height, dest_height);
-
     // create a buffer large enough for the resulting image
-    GetScale(width, height, dest_width, dest_height);
+    GetCacheSize(width, height, dest_width, dest_height);
 
     // Let's align so that stride is always divisible by 16, and then add some 32 bytes more on top
     // See: https://github.com/FFmpeg/FFmpeg/blob/75638fe9402f70645bdde4d95672fa640a327300/libswscale/tests/swscale.c#L157
@@ -333,6 +361,18 @@ std::unique_ptr<CTexture> CPicture::CreateTiledThumb(const std::vector<std::stri
   return result;
 }
 
+void CPicture::GetCacheSize(uint32_t width,
+                            uint32_t height,
+                            uint32_t& dest_width,
+                            uint32_t& dest_height)
+{
+  GetMaxCacheSize(width, height, dest_width, dest_height);
+
+  dest_width = std::min(width, dest_width);
+  dest_height = std::min(height, dest_height);
+  GetScale(width, height, dest_width, dest_height);
+}
+
 void CPicture::GetScale(unsigned int width, unsigned int height, unsigned int &out_width, unsigned int &out_height)
 {
   float aspect = (float)width / height;
@@ -61,6 +61,17 @@ public:
     uint32_t &dest_width, uint32_t &dest_height, const std::string &dest,
     CPictureScalingAlgorithm::Algorithm scalingAlgorithm = CPictureScalingAlgorithm::NoAlgorithm);
 
+  /*! \brief Get the size CacheTexture() stores an image of the given size at
+   \param width width of the image
+   \param height height of the image
+   \param dest_width [in/out] maximum width in pixels, 0 for none - replaced with cached width
+   \param dest_height [in/out] maximum height in pixels, 0 for none - replaced with cached height
+   */
+  static void GetCacheSize(uint32_t width,
+                           uint32_t height,
+                           uint32_t& dest_width,
+                           uint32_t& dest_height);
+
   static void GetScale(unsigned int width, unsigned int height, unsigned int &out_width, unsigned int &out_height);
   static bool ScaleImage(
       uint8_t* in_pixels,
@@ -120,6 +131,7 @@ class CThumbnailWriter : public CJob
     CThumbnailWriter(unsigned char* buffer, int width, int height, int stride, const std::string& thumbFile);
     ~CThumbnailWriter() override;
     bool DoWork() override;
+    RESOURCE GetResource(std::string& host) const override { return RESOURCE_DISK; }
 
   private:
     unsigned char* m_buffer;
@@ -258,6 +258,8 @@ void CSlideShowPic::UpdateTexture(std::unique_ptr<CTexture> pTexture)
   m_pImage = std::move(pTexture);
   m_fWidth = static_cast<float>(m_pImage->GetWidth());
   m_fHeight = static_cast<float>(m_pImage->GetHeight());
+  if (CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(CSettings::SETTING_SLIDESHOW_HIGHQUALITYDOWNSCALING))
+    m_pImage->SetMipmapping();
   m_bIsDirty = true;
 }
 
@@ -12,7 +12,9 @@
 #include "utils/StringUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cctype>
+#include <cmath>
 #include <limits>
 #include <vector>
 
@@ -59,6 +61,103 @@ bool IsOnlySpaces(const std::string& str)
 {
   return std::ranges::all_of(str, [](unsigned char c) { return std::isspace(c); });
 }
+
+constexpr size_t JPEG_READ_SIZE = 64 * 1024;
+constexpr size_t JPEG_MAX_HEADER_SIZE = 16 * 1024 * 1024;
+
+constexpr uint8_t JPEG_SOI = 0xD8;
+constexpr uint8_t JPEG_EOI = 0xD9;
+constexpr uint8_t JPEG_SOS = 0xDA;
+constexpr uint8_t JPEG_TEM = 0x01;
+constexpr uint8_t JPEG_RST0 = 0xD0;
+constexpr uint8_t JPEG_RST7 = 0xD7;
+
+bool ReadAtLeast(CFile& file, std::vector<uint8_t>& buffer, size_t size)
+{
+  while (buffer.size() < size)
+  {
+    const size_t offset = buffer.size();
+    buffer.resize(offset + std::max(JPEG_READ_SIZE, size - offset));
+    const ssize_t read = file.Read(buffer.data() + offset, buffer.size() - offset);
+    buffer.resize(offset + std::max<ssize_t>(read, 0));
+    if (read <= 0)
+      return false;
+  }
+  return true;
+}
+
+/*!
+ * \brief Read the segments of a JPEG file up to its image data.
+ *
+ * The metadata of a JPEG is kept in the APP1 (EXIF, XMP) and APP13 (IPTC) segments in front of
+ * the image data, which is most of the file. Those segments are enough for libexiv2, it stops
+ * reading at the start of the scan.
+ *
+ * \return false if the file isn't a JPEG or its header can't be found
+ */
+bool ReadJpegHeader(CFile& file, std::vector<uint8_t>& header)
+{
+  if (!ReadAtLeast(file, header, 2) || header[0] != 0xFF || header[1] != JPEG_SOI)
+    return false;
+
+  size_t pos = 2;
+  while (pos < JPEG_MAX_HEADER_SIZE)
+  {
+    if (!ReadAtLeast(file, header, pos + 2) || header[pos] != 0xFF)
+      return false;
+
+    const uint8_t marker = header[pos + 1];
+    if (marker == 0xFF)
+    { // fill byte
+      pos++;
+      continue;
+    }
+    if (marker == JPEG_EOI)
+    {
+      header.resize(pos + 2);
+      return true;
+    }
+    if (marker == JPEG_TEM || (marker >= JPEG_RST0 && marker <= JPEG_RST7))
+    { // markers without a segment
+      pos += 2;
+      continue;
+    }
+
+    if (!ReadAtLeast(file, header, pos + 4))
+      return false;
+    const size_t length = (header[pos + 2] << 8) | header[pos + 3];
+    if (length < 2)
+      return false;
+
+    pos += 2 + length;
+    if (marker == JPEG_SOS)
+    {
+      if (!ReadAtLeast(file, header, pos))
+        return false;
+      header.resize(pos);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/*!
+ * \brief Read the part of the file libexiv2 needs, only the header of a JPEG
+ */
+bool ReadMetadataBlock(const std::string& picFileName, std::vector<uint8_t>& buffer)
+{
+  CFile file;
+  if (!file.Open(picFileName, READ_NO_CACHE))
+    return false;
+
+  if (ReadJpegHeader(file, buffer))
+    return true;
+
+  file.Close();
+  buffer.clear();
+  return file.LoadFile(picFileName, buffer) > 0;
+}
 } // namespace
 
 CImageMetadataParser::CImageMetadataParser() : m_imageMetadata(std::make_unique<ImageMetadata>())
@@ -68,13 +167,12 @@ CImageMetadataParser::CImageMetadataParser() : m_imageMetadata(std::make_unique<
 std::unique_ptr<ImageMetadata> CImageMetadataParser::ExtractMetadata(const std::string& picFileName)
 {
   // read image file to a buffer so it can be fed to libexiv2
-  CFile file;
   std::vector<uint8_t> outputBuffer;
-  ssize_t readbytes = file.LoadFile(picFileName, outputBuffer);
-  if (readbytes <= 0)
+  if (!ReadMetadataBlock(picFileName, outputBuffer))
   {
     return nullptr;
   }
+  const size_t readbytes = outputBuffer.size();
 
   // read image metadata
   try
@@ -99,6 +197,76 @@ std::unique_ptr<ImageMetadata> CImageMetadataParser::ExtractMetadata(const std::
   }
 }
 
+std::unique_ptr<ImagePreview> CImageMetadataParser::ExtractPreview(
+    const std::string& picFileName, const PreviewSizeCheck& isLargeEnough)
+{
+  std::vector<uint8_t> buffer;
+  if (!ReadMetadataBlock(picFileName, buffer))
+  {
+    return nullptr;
+  }
+
+  try
+  {
+    auto image = Exiv2::ImageFactory::open(buffer.data(), buffer.size());
+    image->readMetadata();
+
+    const unsigned int width = image->pixelWidth();
+    const unsigned int height = image->pixelHeight();
+    if (width == 0 || height == 0)
+    {
+      return nullptr;
+    }
+
+    // sorted by size, the smallest first
+    Exiv2::PreviewManager previews(*image);
+    for (const auto& properties : previews.getPreviewProperties())
+    {
+      if (properties.mimeType_ != "image/jpeg" || properties.width_ == 0 ||
+          properties.height_ == 0)
+      {
+        continue;
+      }
+
+      // letterboxed thumbnails show black bars
+      const float aspect = static_cast<float>(width) / height;
+      const float previewAspect = static_cast<float>(properties.width_) / properties.height_;
+      if (std::abs(previewAspect / aspect - 1.0f) > 0.01f)
+      {
+        continue;
+      }
+
+      if (!isLargeEnough(width, height, properties.width_, properties.height_))
+      {
+        continue;
+      }
+
+      const Exiv2::PreviewImage preview = previews.getPreviewImage(properties);
+      auto result = std::make_unique<ImagePreview>();
+      result->data.assign(preview.pData(), preview.pData() + preview.size());
+      result->mimeType = preview.mimeType();
+
+      const auto orientation = image->exifData().findKey(Exiv2::ExifKey("Exif.Image.Orientation"));
+      if (orientation != image->exifData().end())
+      {
+        const int orientationValue = orientation->value().EXIV_toUint32();
+        if (orientationValue >= 1 && orientationValue <= 8)
+        {
+          result->orientation = orientationValue;
+        }
+      }
+
+      return result;
+    }
+  }
+  catch (const std::exception& e)
+  {
+    CLog::LogF(LOGDEBUG, "Failed to extract a preview from {}: {}", picFileName, e.what());
+  }
+
+  return nullptr;
+}
+
 void CImageMetadataParser::ExtractCommonMetadata(Exiv2::Image& image)
 {
   //! TODO: all these elements are generic should be moved out of the exif struct
@@ -10,18 +10,46 @@
 
 #include "ImageMetadata.h"
 
+#include <functional>
 #include <memory>
+#include <stdint.h>
 #include <string>
+#include <vector>
 
 #include <exiv2/exiv2.hpp>
 
+struct ImagePreview
+{
+  std::vector<uint8_t> data; //!< the encoded preview
+  std::string mimeType;
+  int orientation{0}; //!< EXIF orientation of the picture, 0 if it has none
+};
+
 class CImageMetadataParser
 {
 public:
   ~CImageMetadataParser() = default;
 
+  using PreviewSizeCheck = std::function<bool(unsigned int width,
+                                              unsigned int height,
+                                              unsigned int previewWidth,
+                                              unsigned int previewHeight)>;
+
   static std::unique_ptr<ImageMetadata> ExtractMetadata(const std::string& picFileName);
 
+  /*!
+   * \brief Get the smallest JPEG preview embedded in a picture that is large enough.
+   *
+   * Only previews with the aspect ratio of the picture are taken. Of a JPEG only the header is
+   * read, which holds the EXIF thumbnail and the previews of the maker notes.
+   *
+   * \param picFileName the picture
+   * \param isLargeEnough called with the size of the picture and the size of a preview
+   * \return the preview, nullptr if the picture has none that is large enough
+   */
+  static std::unique_ptr<ImagePreview> ExtractPreview(const std::string& picFileName,
+                                                      const PreviewSizeCheck& isLargeEnough);
+
 private:
   CImageMetadataParser();
   void ExtractCommonMetadata(Exiv2::Image& image);
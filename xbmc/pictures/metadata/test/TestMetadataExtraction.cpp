@@ -82,3 +82,18 @@ TEST_F(TestMetadataExtraction, TestIPTC)
   EXPECT_EQ(metadata->encodingProcess, "Baseline DCT, Huffman coding");
 #endif
 }
+
+TEST_F(TestMetadataExtraction, TestLetterboxedPreview)
+{
+  // the 1x1 image carries a thumbnail of another aspect ratio, which would show black bars
+  auto path = XBMC_REF_FILE_PATH("xbmc/pictures/metadata/test/testdata/exifgps.jpg");
+  bool checked = false;
+  std::unique_ptr<ImagePreview> preview = CImageMetadataParser::ExtractPreview(
+      path, [&checked](unsigned int, unsigned int, unsigned int, unsigned int)
+      {
+        checked = true;
+        return true;
+      });
+  EXPECT_EQ(preview, nullptr);
+  EXPECT_FALSE(checked);
+}
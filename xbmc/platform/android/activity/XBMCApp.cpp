@@ -43,6 +43,7 @@
 #include "settings/SettingsComponent.h"
 #include "threads/Event.h"
 #include "utils/JSONVariantParser.h"
+#include "utils/MemoryPressure.h"
 #include "utils/StringUtils.h"
 #include "utils/TimeUtils.h"
 #include "utils/URIUtils.h"
@@ -424,7 +425,9 @@ void CXBMCApp::onConfigurationChanged()
 void CXBMCApp::onLowMemory()
 {
   android_printf("CXBMCApp::%s", __FUNCTION__);
-  // can't do much as we don't want to close completely
+  // we don't want to close completely, give back what the caches hold instead
+  if (const auto memoryPressure = CServiceBroker::GetMemoryPressureManager())
+    memoryPressure->Notify(MemoryPressure::CRITICAL);
 }
 
 void CXBMCApp::onCreateWindow(ANativeWindow* window)
@@ -13,6 +13,8 @@ extern "C" {
 }
 #include <cassert>
 #include <poll.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
 #include "utils/log.h"
 
 #ifndef USB_CLASS_PER_INTERFACE
@@ -73,11 +75,30 @@ CPeripheralBusUSB::CPeripheralBusUSB(CPeripherals& manager) :
 
   m_udev          = NULL;
   m_udevMon       = NULL;
+
+  m_wakeupFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (m_wakeupFd < 0)
+    CLog::Log(LOGERROR, "{} - failed to create eventfd, error {}", __FUNCTION__, errno);
 }
 
 CPeripheralBusUSB::~CPeripheralBusUSB(void)
 {
   StopThread(true);
+
+  if (m_wakeupFd >= 0)
+    close(m_wakeupFd);
+}
+
+void CPeripheralBusUSB::StopThread(bool bWait /* = true */)
+{
+  CThread::StopThread(false);
+
+  /* wake up the poll in WaitForUpdate() */
+  if (m_wakeupFd >= 0)
+    eventfd_write(m_wakeupFd, 1);
+
+  if (bWait)
+    CThread::StopThread(true);
 }
 
 bool CPeripheralBusUSB::PerformDeviceScan(PeripheralScanResults &results)
@@ -227,14 +248,31 @@ bool CPeripheralBusUSB::WaitForUpdate()
     return false;
   }
 
-  /* poll for udev changes */
-  struct pollfd pollFd;
-  pollFd.fd = udevFd;
-  pollFd.events = POLLIN;
-  int iPollResult;
-  while (!m_bStop && ((iPollResult = poll(&pollFd, 1, 100)) <= 0))
-    if (errno != EINTR && iPollResult != 0)
-      break;
+  /* wait for udev changes, StopThread() wakes the poll up through the eventfd. Without an
+     eventfd, fall back to checking for the stop every 100ms */
+  struct pollfd pollFds[2];
+  pollFds[0].fd = udevFd;
+  pollFds[0].events = POLLIN;
+  pollFds[1].fd = m_wakeupFd;
+  pollFds[1].events = POLLIN;
+  const nfds_t numFds = m_wakeupFd >= 0 ? 2 : 1;
+  const int timeout = m_wakeupFd >= 0 ? -1 : 100;
+  while (!m_bStop)
+  {
+    int iPollResult = poll(pollFds, numFds, timeout);
+    if (iPollResult == 0 || (iPollResult < 0 && errno == EINTR))
+      continue;
+
+    /* a wake up left from an earlier stop of the thread */
+    if (iPollResult > 0 && numFds > 1 && (pollFds[1].revents & POLLIN) &&
+        !(pollFds[0].revents & POLLIN))
+    {
+      eventfd_t dummy;
+      eventfd_read(m_wakeupFd, &dummy);
+      continue;
+    }
+    break;
+  }
 
   /* the thread is being stopped, so just return false */
   if (m_bStop)
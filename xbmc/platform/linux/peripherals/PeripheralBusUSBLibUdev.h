@@ -25,6 +25,7 @@ namespace PERIPHERALS
     ~CPeripheralBusUSB(void) override;
 
     void Clear(void) override;
+    void StopThread(bool bWait = true) override;
 
     /*!
      * @see PeripheralBus::PerformDeviceScan()
@@ -39,5 +40,6 @@ namespace PERIPHERALS
 
     struct udev *        m_udev;
     struct udev_monitor *m_udevMon;
+    int m_wakeupFd = -1;
   };
 }
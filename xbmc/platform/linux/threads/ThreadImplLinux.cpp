@@ -13,8 +13,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdio>
+#include <cstring>
 #include <mutex>
 
+#include <pthread.h>
 #include <sys/resource.h>
 #include <unistd.h>
 
@@ -63,6 +66,30 @@ static pid_t gettid()
 
 std::once_flag flag;
 
+uint64_t ReadVoluntaryContextSwitches(pid_t tid)
+{
+  char path[64];
+  snprintf(path, sizeof(path), "/proc/self/task/%d/status", static_cast<int>(tid));
+  FILE* file = fopen(path, "re");
+  if (!file)
+    return 0;
+
+  // a voluntary switch is the thread blocking, every one of them is followed by a wakeup
+  constexpr const char* key = "voluntary_ctxt_switches:";
+  unsigned long long switches = 0;
+  char line[128];
+  while (fgets(line, sizeof(line), file))
+  {
+    if (strncmp(line, key, strlen(key)) == 0)
+    {
+      sscanf(line + strlen(key), "%llu", &switches);
+      break;
+    }
+  }
+  fclose(file);
+  return switches;
+}
+
 } // namespace
 
 static int s_appPriority = getpriority(PRIO_PROCESS, getpid());
@@ -103,3 +130,15 @@ bool CThreadImplLinux::SetPriority(const ThreadPriority& priority)
 
   return true;
 }
+
+bool CThreadImplLinux::GetUsage(ThreadUsage& usage) const
+{
+  clockid_t clock;
+  timespec time;
+  if (pthread_getcpuclockid(m_handle, &clock) != 0 || clock_gettime(clock, &time) != 0)
+    return false;
+
+  usage.cpuTime = std::chrono::seconds(time.tv_sec) + std::chrono::nanoseconds(time.tv_nsec);
+  usage.wakeups = ReadVoluntaryContextSwitches(m_threadID);
+  return true;
+}
@@ -21,6 +21,8 @@ public:
 
   bool SetPriority(const ThreadPriority& priority) override;
 
+  bool GetUsage(ThreadUsage& usage) const override;
+
 private:
   pid_t m_threadID;
   std::string m_name;
@@ -22,11 +22,13 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/Stopwatch.h"
 #include "utils/StringUtils.h"
 #include "utils/TimeUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <cstring>
 #include <inttypes.h>
 #include <list>
@@ -922,6 +924,98 @@ bool CSMBFile::Rename(const CURL& url, const CURL& urlnew)
   return (result == 0);
 }
 
+bool CSMBFile::CopyOnServer(const CURL& url,
+                            const CURL& urlnew,
+                            IFileCallback* pCallback,
+                            void* pContext)
+{
+  // the server side copy (copychunk) needs both files on the same server
+  if (!urlnew.IsProtocol("smb") ||
+      !StringUtils::EqualsNoCase(url.GetHostName(), urlnew.GetHostName()))
+    return false;
+
+  // spliced a part at a time, the connection is locked meanwhile
+  constexpr int64_t SPLICE_SIZE = 16 * 1024 * 1024;
+
+  smb.Init();
+  const std::string strFile = GetAuthenticatedPath(CSMB::GetResolvedUrl(url));
+  const std::string strFileNew = GetAuthenticatedPath(CSMB::GetResolvedUrl(urlnew));
+
+  int srcFd = -1;
+  int dstFd = -1;
+  int64_t size = 0;
+  {
+    std::unique_lock lock(smb);
+    if (!smb.IsSmbValid())
+      return false;
+
+    struct stat info;
+    srcFd = smbc_open(strFile.c_str(), O_RDONLY, 0);
+    if (srcFd < 0 || smbc_fstat(srcFd, &info) < 0)
+    {
+      if (srcFd >= 0)
+        smbc_close(srcFd);
+      return false;
+    }
+    size = info.st_size;
+
+    dstFd = smbc_creat(strFileNew.c_str(), 0);
+    if (dstFd < 0)
+    {
+      smbc_close(srcFd);
+      return false;
+    }
+  }
+
+  CStopWatch timer;
+  timer.StartZero();
+  int64_t copied = 0;
+  bool result = true;
+  while (copied < size)
+  {
+    ssize_t spliced = -1;
+    {
+      std::unique_lock lock(smb);
+      if (!smb.IsSmbValid())
+        return false;
+      smb.SetActivityTime();
+
+      if (smbc_lseek(srcFd, copied, SEEK_SET) == copied &&
+          smbc_lseek(dstFd, copied, SEEK_SET) == copied)
+        spliced = smbc_splice(srcFd, dstFd, std::min(size - copied, SPLICE_SIZE),
+                              [](off_t, void*) { return 1; }, nullptr);
+    }
+
+    if (spliced <= 0)
+    {
+      CLog::Log(LOGDEBUG, "{} - server side copy of {} failed ({}), copying the data",
+                __FUNCTION__, CURL::GetRedacted(strFile), strerror(errno));
+      result = false;
+      break;
+    }
+    copied += spliced;
+
+    const float elapsed = timer.GetElapsedSeconds();
+    if (pCallback && elapsed > 0 &&
+        !pCallback->OnFileCallback(pContext, static_cast<int>(100 * copied / size),
+                                   copied / elapsed))
+    {
+      CLog::Log(LOGERROR, "{} - User aborted copy", __FUNCTION__);
+      result = false;
+      break;
+    }
+  }
+
+  std::unique_lock lock(smb);
+  if (!smb.IsSmbValid())
+    return false;
+  smbc_close(dstFd);
+  smbc_close(srcFd);
+  if (!result)
+    smbc_unlink(strFileNew.c_str());
+  return result;
+}
+
 bool CSMBFile::OpenForWrite(const CURL& url, bool bOverWrite)
 {
   m_fileSize = 0;
@@ -79,6 +79,10 @@ public:
   bool OpenForWrite(const CURL& url, bool bOverWrite = false) override;
   bool Delete(const CURL& url) override;
   bool Rename(const CURL& url, const CURL& urlnew) override;
+  bool CopyOnServer(const CURL& url,
+                    const CURL& urlnew,
+                    IFileCallback* pCallback,
+                    void* pContext) override;
   int GetChunkSize() override;
   int IoControl(IOControl request, void* param) override;
 
@@ -11,6 +11,11 @@
 #include "utils/log.h"
 
 #include <pthread.h>
+#include <time.h>
+
+#if defined(TARGET_DARWIN)
+#include <mach/mach.h>
+#endif
 
 std::unique_ptr<IThreadImpl> IThreadImpl::CreateThreadImpl(std::thread::native_handle_type handle)
 {
@@ -33,3 +38,29 @@ bool CThreadImplPosix::SetPriority(const ThreadPriority& priority)
   CLog::Log(LOGDEBUG, "[threads] setting priority is not supported on this platform");
   return false;
 }
+
+bool CThreadImplPosix::GetUsage(ThreadUsage& usage) const
+{
+#if defined(TARGET_DARWIN)
+  const mach_port_t port = pthread_mach_thread_np(m_handle);
+  thread_basic_info_data_t info;
+  mach_msg_type_number_t count = THREAD_BASIC_INFO_COUNT;
+  if (thread_info(port, THREAD_BASIC_INFO, reinterpret_cast<thread_info_t>(&info), &count) !=
+      KERN_SUCCESS)
+    return false;
+
+  usage.cpuTime = std::chrono::seconds(info.user_time.seconds + info.system_time.seconds) +
+                  std::chrono::microseconds(info.user_time.microseconds +
+                                            info.system_time.microseconds);
+#else
+  clockid_t clock;
+  timespec time;
+  if (pthread_getcpuclockid(m_handle, &clock) != 0 || clock_gettime(clock, &time) != 0)
+    return false;
+
+  usage.cpuTime = std::chrono::seconds(time.tv_sec) + std::chrono::nanoseconds(time.tv_nsec);
+#endif
+  // the wakeups of a thread aren't counted here
+  usage.wakeups = 0;
+  return true;
+}
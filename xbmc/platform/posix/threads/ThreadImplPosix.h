@@ -20,4 +20,6 @@ public:
   void SetThreadInfo(const std::string& name) override;
 
   bool SetPriority(const ThreadPriority& priority) override;
+
+  bool GetUsage(ThreadUsage& usage) const override;
 };
@@ -211,3 +211,20 @@ bool CThreadImplWin::RevertTask()
 #endif
   return ret;
 }
+
+bool CThreadImplWin::GetUsage(ThreadUsage& usage) const
+{
+  FILETIME creationTime, exitTime, kernelTime, userTime;
+  if (GetThreadTimes(m_handle, &creationTime, &exitTime, &kernelTime, &userTime) == 0)
+    return false;
+
+  // in 100 ns units, Windows doesn't count the wakeups of a thread
+  const auto toDuration = [](const FILETIME& time)
+  {
+    return std::chrono::nanoseconds(
+        ((static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime) * 100);
+  };
+  usage.cpuTime = toDuration(kernelTime) + toDuration(userTime);
+  usage.wakeups = 0;
+  return true;
+}
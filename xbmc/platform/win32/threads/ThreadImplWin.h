@@ -27,6 +27,8 @@ public:
   bool SetTask(const ThreadTask& task) override;
   bool RevertTask() override;
 
+  bool GetUsage(ThreadUsage& usage) const override;
+
 private:
   CCriticalSection m_criticalSection;
   std::string m_name;
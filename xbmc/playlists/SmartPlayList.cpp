@@ -782,11 +782,13 @@ std::string CSmartPlaylistRule::FormatParameter(const std::string &operatorStrin
 std::string CSmartPlaylistRule::FormatLinkQuery(const char *field, const char *table, const MediaType& mediaType, const std::string& mediaField, const std::string& parameter)
 {
   // NOTE: no need for a PrepareSQL here, as the parameter has already been formatted
+  // The ids are looked up once through the name and the link indices, instead of a subquery per
+  // listed item, which also lets the database fetch the matching items by their id.
   return StringUtils::Format(
-      " EXISTS (SELECT 1 FROM {}_link"
+      " {} IN (SELECT {}_link.media_id FROM {}_link"
       "         JOIN {} ON {}.{}_id={}_link.{}_id"
-      "         WHERE {}_link.media_id={} AND {}.name {} AND {}_link.media_type = '{}')",
-      field, table, table, table, field, table, field, mediaField, table, parameter, field,
+      "         WHERE {}.name {} AND {}_link.media_type = '{}')",
+      mediaField, field, field, table, table, table, field, table, table, parameter, field,
       mediaType);
 }
 
@@ -12,35 +12,28 @@
 #include "TextureCache.h"
 #include "TextureDatabase.h"
 #include "URL.h"
+#include "imagefiles/ImageCachePrecacher.h"
 #include "imagefiles/ImageFileURL.h"
+#include "jobs/JobManager.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
-#include <algorithm>
+#include <atomic>
 #include <string_view>
+#include <unordered_set>
+#include <utility>
 
 using namespace PVR;
 
-int CPVRCachedImages::Cleanup(const std::vector<PVRImagePattern>& urlPatterns,
-                              const std::vector<std::string>& urlsToCheck,
-                              bool clearTextureForPath /* = false */)
+namespace
 {
-  int iCleanedImages = 0;
-
-  if (urlPatterns.empty())
-  {
-    CLog::LogFC(LOGERROR, LOGPVR, "No URL patterns given");
-    return iCleanedImages;
-  }
-
-  CTextureDatabase db;
-  if (!db.Open())
-  {
-    CLog::LogFC(LOGERROR, LOGPVR, "Failed to open texture database");
-    return iCleanedImages;
-  }
+std::atomic_flag s_precaching;
 
+bool GetTextures(CTextureDatabase& db,
+                 const std::vector<PVRImagePattern>& urlPatterns,
+                 CVariant& items)
+{
   CDatabase::Filter filter;
 
   for (const auto& pattern : urlPatterns)
@@ -62,21 +55,48 @@ int CPVRCachedImages::Cleanup(const std::vector<PVRImagePattern>& urlPatterns,
     filter.AppendWhere(where, false); // logical OR
   }
 
-  CVariant items;
   if (!db.GetTextures(items, filter))
   {
     CLog::LogFC(LOGERROR, LOGPVR, "Failed to get items from texture database");
+    return false;
+  }
+  return true;
+}
+} // unnamed namespace
+
+int CPVRCachedImages::Cleanup(const std::vector<PVRImagePattern>& urlPatterns,
+                              const std::vector<std::string>& urlsToCheck,
+                              bool clearTextureForPath /* = false */)
+{
+  int iCleanedImages = 0;
+
+  if (urlPatterns.empty())
+  {
+    CLog::LogFC(LOGERROR, LOGPVR, "No URL patterns given");
+    return iCleanedImages;
+  }
+
+  CTextureDatabase db;
+  if (!db.Open())
+  {
+    CLog::LogFC(LOGERROR, LOGPVR, "Failed to open texture database");
     return iCleanedImages;
   }
 
+  CVariant items;
+  if (!GetTextures(db, urlPatterns, items))
+    return iCleanedImages;
+
+  // thousands of channel logos or epg icons on both sides, don't compare each with each
+  const std::unordered_set<std::string_view> urls(urlsToCheck.cbegin(), urlsToCheck.cend());
+
   for (unsigned int i = 0; i < items.size(); ++i)
   {
     // Unwrap the image:// URL returned from texture db.
     const std::string textureURL =
         IMAGE_FILES::CImageFileURL(items[i]["url"].asString()).GetTargetFile();
 
-    if (std::ranges::none_of(urlsToCheck,
-                             [&textureURL](std::string_view url) { return url == textureURL; }))
+    if (!urls.contains(textureURL))
     {
       CLog::LogFC(LOGDEBUG, LOGPVR, "Removing stale cached image: '{}'", textureURL);
       CServiceBroker::GetTextureCache()->ClearCachedImage(items[i]["textureid"].asInteger());
@@ -90,3 +110,52 @@ int CPVRCachedImages::Cleanup(const std::vector<PVRImagePattern>& urlPatterns,
 
   return iCleanedImages;
 }
+
+void CPVRCachedImages::Precache(const std::vector<PVRImagePattern>& urlPatterns,
+                                const std::vector<std::string>& images)
+{
+  if (urlPatterns.empty() || images.empty())
+    return;
+
+  // a running job catches up with the changes on the next update
+  if (s_precaching.test_and_set())
+    return;
+
+  CServiceBroker::GetJobManager()->Submit(
+      [urlPatterns, images]()
+      {
+        // one query for the images already cached instead of one per image
+        std::unordered_set<std::string> cached;
+        CTextureDatabase db;
+        if (db.Open())
+        {
+          CVariant items;
+          if (GetTextures(db, urlPatterns, items))
+          {
+            for (unsigned int i = 0; i < items.size(); ++i)
+              cached.emplace(items[i]["url"].asString());
+          }
+          db.Close();
+        }
+
+        // clients often share the logo of a channel, cache every image once
+        std::unordered_set<std::string_view> queued;
+        std::vector<std::string> uncached;
+        for (const auto& image : images)
+        {
+          if (!image.empty() && !cached.contains(image) && queued.emplace(image).second)
+            uncached.emplace_back(image);
+        }
+
+        if (!uncached.empty())
+        {
+          CLog::LogFC(LOGDEBUG, LOGPVR, "Precaching {} images", uncached.size());
+          IMAGE_FILES::CImageCachePrecacher::CacheImages(
+              std::move(uncached),
+              [](unsigned int, unsigned int) { return CServiceBroker::IsServiceManagerUp(); });
+        }
+
+        s_precaching.clear();
+      },
+      CJob::PRIORITY_LOW_PAUSABLE);
+}
@@ -37,6 +37,15 @@ public:
   static int Cleanup(const std::vector<PVRImagePattern>& urlPatterns,
                      const std::vector<std::string>& urlsToCheck,
                      bool clearTextureForPath = false);
+
+  /*!
+   * @brief Cache images ahead of their first use, in the background.
+   * @param urlPatterns The URL patterns of the images already cached.
+   * @param images The image:// URLs of the images to cache. Duplicates and images already in the
+   * texture db are skipped.
+   */
+  static void Precache(const std::vector<PVRImagePattern>& urlPatterns,
+                       const std::vector<std::string>& images);
 };
 
 } // namespace PVR
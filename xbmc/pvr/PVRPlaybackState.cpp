@@ -403,7 +403,9 @@ std::unique_ptr<CFileItem> CPVRPlaybackState::GetNextAutoplayItem(const CFileIte
     const std::shared_ptr<const CPVRClient> client{pvrMgr.GetClient(m_playingClientId)};
     if (epg && client)
     {
-      const std::vector<std::shared_ptr<CPVREpgInfoTag>> tags{epg->GetTags()};
+      // the tags before the playing one are of no interest
+      const std::vector<std::shared_ptr<CPVREpgInfoTag>> tags{
+          epg->GetTagsEndingAfter(m_playingEpgTag->StartAsUTC())};
       bool nextIsMatch{false};
       for (const auto& tag : tags)
       {
@@ -957,6 +957,31 @@ PVR_ERROR CPVRClient::GetEPGForChannel(int iChannelUid,
       m_clientCapabilities.SupportsEPG());
 }
 
+PVR_ERROR CPVRClient::GetEPGChangesForChannel(
+    int iChannelUid, CPVREpg* epg, time_t start, time_t end, time_t changedSince) const
+{
+  return DoAddonCall(
+      std::source_location::current().function_name(),
+      [this, iChannelUid, epg, start, end, changedSince](const AddonInstance* addon)
+      {
+        // older add-ons leave the function table entry empty
+        if (!addon->toAddon->GetEPGChangesForChannel)
+          return PVR_ERROR_NOT_IMPLEMENTED;
+
+        PVR_HANDLE_STRUCT handle = {};
+        handle.callerAddress = this;
+        handle.dataAddress = epg;
+
+        int iPVRTimeCorrection =
+            CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_iPVRTimeCorrection;
+
+        return addon->toAddon->GetEPGChangesForChannel(
+            addon, &handle, iChannelUid, start ? start - iPVRTimeCorrection : 0,
+            end ? end - iPVRTimeCorrection : 0, changedSince - iPVRTimeCorrection);
+      },
+      m_clientCapabilities.SupportsEPG() && m_clientCapabilities.SupportsEPGChanges());
+}
+
 PVR_ERROR CPVRClient::SetEPGMaxPastDays(int iPastDays)
 {
   return DoAddonCall(
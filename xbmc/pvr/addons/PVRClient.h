@@ -305,6 +305,19 @@ public:
    */
   PVR_ERROR GetEPGForChannel(int iChannelUid, CPVREpg* epg, time_t start, time_t end) const;
 
+  /*!
+   * @brief Request the EPG events of a channel created or changed since the given time from the
+   * client. Deleted events are notified by the client with an EPG_EVENT_DELETED state change.
+   * @param iChannelUid The UID of the channel to get the EPG changes for.
+   * @param epg The table to write the data to.
+   * @param start The start time to use.
+   * @param end The end time to use.
+   * @param changedSince Only events changed after this time are requested.
+   * @return PVR_ERROR_NO_ERROR if the changes have been fetched successfully.
+   */
+  PVR_ERROR GetEPGChangesForChannel(
+      int iChannelUid, CPVREpg* epg, time_t start, time_t end, time_t changedSince) const;
+
   /*!
    * @brief Tell the client the past time frame to use when notifying epg events back
    * to Kodi.
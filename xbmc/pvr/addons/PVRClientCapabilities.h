@@ -117,6 +117,27 @@ public:
     return m_addonCapabilities && m_addonCapabilities->bSupportsAsyncEPGTransfer;
   }
 
+  /*!
+   * @brief Check whether this add-on supports the transfer of only the epg events changed since
+   * a given time.
+   * @return True if supported, false otherwise.
+   */
+  bool SupportsEPGChanges() const
+  {
+    return m_addonCapabilities && m_addonCapabilities->bSupportsEPGChanges;
+  }
+
+  /*!
+   * @brief Get the number of channels the epg can be requested for at the same time.
+   * @return The number of parallel requests, at least 1.
+   */
+  unsigned int GetMaxParallelEPGRequests() const
+  {
+    return m_addonCapabilities && m_addonCapabilities->iMaxParallelEPGRequests > 1
+               ? m_addonCapabilities->iMaxParallelEPGRequests
+               : 1;
+  }
+
   /*!
    * @brief Check whether this add-on supports retrieving an edit decision list for epg tags.
    * @return True if supported, false otherwise.
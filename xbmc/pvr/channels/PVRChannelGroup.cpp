@@ -119,6 +119,7 @@ void CPVRChannelGroup::Unload()
   std::unique_lock lock(m_critSection);
   m_sortedMembers.clear();
   m_members.clear();
+  m_indexesValid = false;
   m_failedClients.clear();
 }
 
@@ -209,12 +210,14 @@ void CPVRChannelGroup::SortByClientChannelNumber()
 {
   std::unique_lock lock(m_critSection);
   std::ranges::sort(m_sortedMembers, sortByClientChannelNumber());
+  m_indexesValid = false;
 }
 
 void CPVRChannelGroup::SortByChannelNumber()
 {
   std::unique_lock lock(m_critSection);
   std::ranges::sort(m_sortedMembers, sortByChannelNumber());
+  m_indexesValid = false;
 }
 
 void CPVRChannelGroup::UpdateClientPriorities()
@@ -290,13 +293,71 @@ std::shared_ptr<CPVRChannel> CPVRChannelGroup::GetByUniqueID(int iUniqueChannelI
   return groupMember ? groupMember->Channel() : std::shared_ptr<CPVRChannel>();
 }
 
+namespace
+{
+uint64_t GetChannelNumberKey(const CPVRChannelNumber& channelNumber)
+{
+  return (static_cast<uint64_t>(channelNumber.GetChannelNumber()) << 32) |
+         channelNumber.GetSubChannelNumber();
+}
+} // unnamed namespace
+
+void CPVRChannelGroup::RebuildIndexes(bool bUseBackendChannelNumbers) const
+{
+  m_membersByNumber.clear();
+  m_membersByChannelId.clear();
+  m_sortedPositions.clear();
+  m_membersByNumber.reserve(m_sortedMembers.size());
+  m_membersByChannelId.reserve(m_sortedMembers.size());
+  m_sortedPositions.reserve(m_sortedMembers.size());
+
+  for (size_t i = 0; i < m_sortedMembers.size(); ++i)
+  {
+    const std::shared_ptr<CPVRChannelGroupMember>& member = m_sortedMembers[i];
+    const CPVRChannelNumber& number =
+        bUseBackendChannelNumbers ? member->ClientChannelNumber() : member->ChannelNumber();
+    m_membersByNumber.try_emplace(GetChannelNumberKey(number), member);
+    m_membersByChannelId.try_emplace(member->Channel()->ChannelID(), member);
+    m_sortedPositions.try_emplace(member.get(), i);
+  }
+
+  m_indexedBackendChannelNumbers = bUseBackendChannelNumbers;
+  m_indexesValid = true;
+}
+
+std::optional<size_t> CPVRChannelGroup::GetSortedPosition(
+    const CPVRChannelGroupMember* groupMember) const
+{
+  if (!m_indexesValid)
+    RebuildIndexes(GetSettings()->UseBackendChannelNumbers());
+
+  const auto it = m_sortedPositions.find(groupMember);
+  if (it == m_sortedPositions.end())
+    return {};
+
+  return it->second;
+}
+
 std::shared_ptr<CPVRChannel> CPVRChannelGroup::GetByChannelID(int iChannelID) const
 {
   std::unique_lock lock(m_critSection);
-  const auto it =
-      std::ranges::find_if(m_members, [iChannelID](const auto& member)
-                           { return member.second->Channel()->ChannelID() == iChannelID; });
-  return it != m_members.cend() ? (*it).second->Channel() : std::shared_ptr<CPVRChannel>();
+
+  // channel ids are set when a new channel is persisted, so a miss or a stale hit rebuilds the
+  // index once before giving up
+  for (bool bRebuilt = !m_indexesValid;; bRebuilt = true)
+  {
+    if (!m_indexesValid)
+      RebuildIndexes(GetSettings()->UseBackendChannelNumbers());
+
+    const auto it = m_membersByChannelId.find(iChannelID);
+    if (it != m_membersByChannelId.end() && it->second->Channel()->ChannelID() == iChannelID)
+      return it->second->Channel();
+
+    if (bRebuilt)
+      return {};
+
+    m_indexesValid = false;
+  }
 }
 
 namespace
@@ -392,15 +453,31 @@ std::shared_ptr<CPVRChannelGroupMember> CPVRChannelGroup::GetByChannelNumber(
 {
   std::unique_lock lock(m_critSection);
   const bool bUseBackendChannelNumbers = GetSettings()->UseBackendChannelNumbers();
-  for (const auto& member : m_sortedMembers)
+  if (m_indexedBackendChannelNumbers != bUseBackendChannelNumbers)
+    m_indexesValid = false;
+
+  // the channel manager may change the numbers of members directly, so a miss or a stale hit
+  // rebuilds the index once before giving up
+  for (bool bRebuilt = !m_indexesValid;; bRebuilt = true)
   {
-    CPVRChannelNumber activeChannelNumber =
-        bUseBackendChannelNumbers ? member->ClientChannelNumber() : member->ChannelNumber();
-    if (activeChannelNumber == channelNumber)
-      return member;
-  }
+    if (!m_indexesValid)
+      RebuildIndexes(bUseBackendChannelNumbers);
+
+    const auto it = m_membersByNumber.find(GetChannelNumberKey(channelNumber));
+    if (it != m_membersByNumber.end())
+    {
+      const CPVRChannelNumber& activeChannelNumber = bUseBackendChannelNumbers
+                                                         ? it->second->ClientChannelNumber()
+                                                         : it->second->ChannelNumber();
+      if (activeChannelNumber == channelNumber)
+        return it->second;
+    }
 
-  return {};
+    if (bRebuilt)
+      return {};
+
+    m_indexesValid = false;
+  }
 }
 
 std::shared_ptr<CPVRChannelGroupMember> CPVRChannelGroup::GetNextChannelGroupMember(
@@ -411,19 +488,17 @@ std::shared_ptr<CPVRChannelGroupMember> CPVRChannelGroup::GetNextChannelGroupMem
   if (groupMember)
   {
     std::unique_lock lock(m_critSection);
-    for (auto it = m_sortedMembers.cbegin(); !nextMember && it != m_sortedMembers.cend(); ++it)
+    const std::optional<size_t> position = GetSortedPosition(groupMember.get());
+    if (position)
     {
-      if (*it == groupMember)
+      // the member itself comes last, it is the only candidate if all others are hidden
+      const size_t count = m_sortedMembers.size();
+      for (size_t i = 1; !nextMember && i <= count; ++i)
       {
-        do
-        {
-          if ((++it) == m_sortedMembers.cend())
-            it = m_sortedMembers.cbegin();
-          if ((*it)->Channel() && !(*it)->Channel()->IsHidden())
-            nextMember = *it;
-        } while (!nextMember && *it != groupMember);
-
-        break;
+        const std::shared_ptr<CPVRChannelGroupMember>& member =
+            m_sortedMembers[(*position + i) % count];
+        if (member->Channel() && !member->Channel()->IsHidden())
+          nextMember = member;
       }
     }
   }
@@ -439,20 +514,16 @@ std::shared_ptr<CPVRChannelGroupMember> CPVRChannelGroup::GetPreviousChannelGrou
   if (groupMember)
   {
     std::unique_lock lock(m_critSection);
-    for (auto it = m_sortedMembers.crbegin(); !previousMember && it != m_sortedMembers.crend();
-         ++it)
+    const std::optional<size_t> position = GetSortedPosition(groupMember.get());
+    if (position)
     {
-      if (*it == groupMember)
+      const size_t count = m_sortedMembers.size();
+      for (size_t i = 1; !previousMember && i <= count; ++i)
       {
-        do
-        {
-          if ((++it) == m_sortedMembers.crend())
-            it = m_sortedMembers.crbegin();
-          if ((*it)->Channel() && !(*it)->Channel()->IsHidden())
-            previousMember = *it;
-        } while (!previousMember && *it != groupMember);
-
-        break;
+        const std::shared_ptr<CPVRChannelGroupMember>& member =
+            m_sortedMembers[(*position + count - i) % count];
+        if (member->Channel() && !member->Channel()->IsHidden())
+          previousMember = member;
       }
     }
   }
@@ -548,6 +619,7 @@ int CPVRChannelGroup::LoadFromDatabase(const std::vector<std::shared_ptr<CPVRCli
         // Ignore data from unknown/disabled clients
         m_sortedMembers.emplace_back(member);
         m_members.try_emplace({member->ChannelClientID(), member->ChannelUID()}, member);
+        m_indexesValid = false;
       }
     }
 
@@ -632,6 +704,7 @@ bool CPVRChannelGroup::UpdateFromClient(const std::shared_ptr<CPVRChannelGroupMe
 
     m_sortedMembers.emplace_back(groupMember);
     m_members.try_emplace(channel->StorageId(), groupMember);
+    m_indexesValid = false;
 
     CLog::LogFC(LOGDEBUG, LOGPVR, "Added {} channel group member '{}' to group '{}'",
                 IsRadio() ? "radio" : "TV", channel->ChannelName(), GroupName());
@@ -708,6 +781,7 @@ std::vector<std::shared_ptr<CPVRChannelGroupMember>> CPVRChannelGroup::RemoveDel
 
       m_members.erase(channel->StorageId());
       it = m_sortedMembers.erase(it);
+      m_indexesValid = false;
       continue;
     }
 
@@ -723,6 +797,7 @@ std::vector<std::shared_ptr<CPVRChannelGroupMember>> CPVRChannelGroup::RemoveDel
 
         m_members.erase(channel->StorageId());
         it = m_sortedMembers.erase(it);
+        m_indexesValid = false;
         continue;
       }
     }
@@ -776,16 +851,15 @@ bool CPVRChannelGroup::RemoveFromGroup(
 
   std::unique_lock lock(m_critSection);
 
-  for (auto it = m_sortedMembers.begin(); it != m_sortedMembers.end(); ++it)
+  const auto it = m_members.find(channel->StorageId());
+  if (it != m_members.end())
   {
-    const auto storageId = (*it)->Channel()->StorageId();
-    if (channel->StorageId() == storageId)
-    {
-      m_members.erase(storageId);
-      m_sortedMembers.erase(it);
-      bReturn = true;
-      break;
-    }
+    const std::optional<size_t> position = GetSortedPosition(it->second.get());
+    if (position)
+      m_sortedMembers.erase(m_sortedMembers.begin() + *position);
+    m_members.erase(it);
+    m_indexesValid = false;
+    bReturn = true;
   }
 
   // no need to delete and renumber if nothing was removed
@@ -824,6 +898,7 @@ bool CPVRChannelGroup::AppendToGroup(
 
     m_sortedMembers.emplace_back(newMember);
     m_members.try_emplace(channel->StorageId(), newMember);
+    m_indexesValid = false;
 
     SortAndRenumber();
     bReturn = true;
@@ -1201,6 +1276,21 @@ int CPVRChannelGroup::CleanupCachedImages()
   return CPVRCachedImages::Cleanup({{owner, ""}}, urlsToCheck);
 }
 
+void CPVRChannelGroup::PrecacheImages() const
+{
+  std::vector<std::string> images;
+  {
+    std::unique_lock lock(m_critSection);
+    images.reserve(m_members.size());
+    std::ranges::transform(m_members, std::back_inserter(images), [](const auto& groupMember)
+                           { return groupMember.second->Channel()->IconPath(); });
+  }
+
+  const std::string owner =
+      StringUtils::Format(CPVRChannel::IMAGE_OWNER_PATTERN, IsRadio() ? "radio" : "tv");
+  CPVRCachedImages::Precache({{owner, ""}}, images);
+}
+
 int CPVRChannelGroup::GetClientPriority() const
 {
   if (GetClientID() == PVR_GROUP_CLIENT_ID_UNKNOWN)
@@ -18,6 +18,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -469,6 +470,11 @@ public:
    */
   int CleanupCachedImages();
 
+  /*!
+   * @brief Cache the channel icons not cached yet, in the background.
+   */
+  void PrecacheImages() const;
+
   /*!
    * @brief Get the priority of the client that provides this group.
    * @return the priority, as set by the user or 0. Always 0 for non-backend-supplied groups.
@@ -613,6 +619,19 @@ private:
 
   void OnSettingChanged();
 
+  /*!
+   * @brief Rebuild the lookup indexes of the sorted members.
+   * @param bUseBackendChannelNumbers Whether to index the client channel numbers.
+   */
+  void RebuildIndexes(bool bUseBackendChannelNumbers) const;
+
+  /*!
+   * @brief Get the position of a member in the sorted members.
+   * @param groupMember The member.
+   * @return The position, or std::nullopt if the member is not in this group.
+   */
+  std::optional<size_t> GetSortedPosition(const CPVRChannelGroupMember* groupMember) const;
+
   std::shared_ptr<const CPVRChannelGroup> m_allChannelsGroup;
   CPVRChannelsPath m_path;
   bool m_bDeleted = false;
@@ -631,6 +650,14 @@ private:
   int m_iPosition{0}; /*!< the local position of this group within the group list */
   std::vector<std::shared_ptr<CPVRChannelGroupMember>>
       m_sortedMembers; /*!< members sorted by channel number */
+  mutable std::unordered_map<uint64_t, std::shared_ptr<CPVRChannelGroupMember>>
+      m_membersByNumber; /*!< members by active channel number, first one in sort order wins */
+  mutable std::unordered_map<int, std::shared_ptr<CPVRChannelGroupMember>>
+      m_membersByChannelId; /*!< members by channel database id */
+  mutable std::unordered_map<const CPVRChannelGroupMember*, size_t>
+      m_sortedPositions; /*!< positions of the members in m_sortedMembers */
+  mutable bool m_indexesValid{false}; /*!< false if the members changed since the last rebuild */
+  mutable bool m_indexedBackendChannelNumbers{false}; /*!< numbers m_membersByNumber is keyed by */
   CEventSource<PVREvent> m_events;
   mutable std::shared_ptr<CPVRChannelGroupSettings> m_settings;
 
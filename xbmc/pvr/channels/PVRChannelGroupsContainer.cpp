@@ -58,6 +58,13 @@ bool CPVRChannelGroupsContainer::UpdateFromClients(
   m_bIsUpdating = false;
   lock.unlock();
 
+  // fetch the logos of new channels now instead of on the first scroll through the list
+  if (bReturn)
+  {
+    m_groupsTV->GetGroupAll()->PrecacheImages();
+    m_groupsRadio->GetGroupAll()->PrecacheImages();
+  }
+
   return bReturn;
 }
 
@@ -23,6 +23,7 @@
 #include "utils/StringUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -199,6 +200,9 @@ bool IsTagExpired(const std::shared_ptr<const CPVREpgInfoTag>& tag)
   return tag->EndAsUTC() < cleanupTime;
 }
 
+// events changed while the last update was running must not be missed by the next one
+constexpr int EPG_CHANGES_OVERLAP = 10 * 60; // seconds
+
 } // unnamed namespace
 
 bool CPVREpg::UpdateEntry(const EPG_TAG* data, int iClientId)
@@ -260,8 +264,22 @@ bool CPVREpg::Update(time_t start,
                      int iPastDays,
                      const std::shared_ptr<CPVREpgDatabase>& database,
                      bool bForceUpdate /* = false */)
+{
+  bool bSuccess = true;
+  const std::shared_ptr<CPVREpg> update =
+      FetchUpdate(start, end, iUpdateTime, database, bForceUpdate, bSuccess);
+  return ApplyUpdate(update, iPastDays, bSuccess);
+}
+
+std::shared_ptr<CPVREpg> CPVREpg::FetchUpdate(time_t start,
+                                              time_t end,
+                                              int iUpdateTime,
+                                              const std::shared_ptr<CPVREpgDatabase>& database,
+                                              bool bForceUpdate,
+                                              bool& bSuccess)
 {
   bool bUpdate = false;
+  time_t changedSince = 0;
   std::shared_ptr<CPVREpg> tmpEpg;
 
   {
@@ -298,6 +316,10 @@ bool CPVREpg::Update(time_t start,
       m_lastScanTime.GetAsTime(iLastUpdate);
 
       bUpdate = (iNow > iLastUpdate + iUpdateTime);
+
+      // tags already transferred only need to be updated with what changed since then
+      if (bUpdate && iLastUpdate > EPG_CHANGES_OVERLAP && !m_tags.IsEmpty())
+        changedSince = iLastUpdate - EPG_CHANGES_OVERLAP;
     }
 
     if (bUpdate)
@@ -307,14 +329,24 @@ bool CPVREpg::Update(time_t start,
     }
   }
 
+  bSuccess = true;
+  if (!bUpdate)
+    return {};
+
+  bSuccess = tmpEpg->UpdateFromScraper(start, end, bForceUpdate, changedSince);
+  return tmpEpg;
+}
+
+bool CPVREpg::ApplyUpdate(const std::shared_ptr<CPVREpg>& update, int iPastDays, bool bSuccess)
+{
   // remove obsolete tags
   Cleanup(iPastDays);
 
-  bool bGrabSuccess = true;
+  bool bGrabSuccess = bSuccess;
 
-  if (bUpdate)
+  if (update)
   {
-    bGrabSuccess = tmpEpg->UpdateFromScraper(start, end, bForceUpdate) && UpdateEntries(*tmpEpg);
+    bGrabSuccess = bSuccess && UpdateEntries(*update);
 
     if (!bGrabSuccess)
       CLog::LogF(LOGERROR, "Failed to update table '{}'", Name());
@@ -330,6 +362,13 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpg::GetTags() const
   return m_tags.GetAllTags();
 }
 
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpg::GetTagsEndingAfter(
+    const CDateTime& minEventEnd) const
+{
+  std::unique_lock lock(m_critSection);
+  return m_tags.GetTagsEndingAfter(minEventEnd);
+}
+
 bool CPVREpg::QueuePersistQuery(const std::shared_ptr<CPVREpgDatabase>& database)
 {
   // Note: It is guaranteed that both this EPG instance and database instance are already
@@ -393,7 +432,10 @@ std::pair<CDateTime, CDateTime> CPVREpg::GetFirstAndLastUncommittedEPGDate() con
   return m_tags.GetFirstAndLastUncommittedEPGDate();
 }
 
-bool CPVREpg::UpdateFromScraper(time_t start, time_t end, bool bForceUpdate)
+bool CPVREpg::UpdateFromScraper(time_t start,
+                                time_t end,
+                                bool bForceUpdate,
+                                time_t changedSince /* = 0 */)
 {
   if (m_strScraperName.empty())
   {
@@ -423,10 +465,31 @@ bool CPVREpg::UpdateFromScraper(time_t start, time_t end, bool bForceUpdate)
       }
       else
       {
+        const int iChannelUid = m_channelData->UniqueClientChannelId();
+        if (changedSince > 0 && client->GetClientCapabilities().SupportsEPGChanges())
+        {
+          // the last update covered the range up to its own end of the time frame, anything
+          // beyond that is new and needs a full transfer
+          time_t iNow = 0;
+          CDateTime::GetUTCDateTime().GetAsTime(iNow);
+          const time_t coveredEnd = std::clamp(end - (iNow - changedSince), start, end);
+
+          CLog::LogFC(LOGDEBUG, LOGEPG, "Updating EPG changes for channel '{}' from client '{}'",
+                      m_channelData->ChannelName(), m_channelData->ClientId());
+          const PVR_ERROR error =
+              client->GetEPGChangesForChannel(iChannelUid, this, start, coveredEnd, changedSince);
+          if (error == PVR_ERROR_NO_ERROR)
+            return coveredEnd >= end || client->GetEPGForChannel(iChannelUid, this, coveredEnd,
+                                                                 end) == PVR_ERROR_NO_ERROR;
+
+          CLog::LogFC(LOGDEBUG, LOGEPG,
+                      "Client '{}' failed to provide EPG changes ({}), updating the whole range",
+                      m_channelData->ClientId(), CPVRClient::ToString(error));
+        }
+
         CLog::LogFC(LOGDEBUG, LOGEPG, "Updating EPG for channel '{}' from client '{}'",
                     m_channelData->ChannelName(), m_channelData->ClientId());
-        return (client->GetEPGForChannel(m_channelData->UniqueClientChannelId(), this, start,
-                                         end) == PVR_ERROR_NO_ERROR);
+        return (client->GetEPGForChannel(iChannelUid, this, start, end) == PVR_ERROR_NO_ERROR);
       }
     }
     else
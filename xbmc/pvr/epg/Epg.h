@@ -205,12 +205,47 @@ public:
               const std::shared_ptr<CPVREpgDatabase>& database,
               bool bForceUpdate = false);
 
+  /*!
+   * @brief Get the entries from 'start' till 'end' to update this EPG with, if an update is due.
+   * Does not change the contents of this EPG, so several EPGs can be fetched in parallel.
+   * @param start The start time.
+   * @param end The end time.
+   * @param iUpdateTime Update the table after the given amount of time has passed.
+   * @param database If given, the database to read the last scan time from.
+   * @param bForceUpdate Force update from client even if it's not the time to
+   * @param bSuccess [out] False if the entries could not be fetched.
+   * @return The fetched entries to pass to ApplyUpdate(), nullptr if no update is due.
+   */
+  std::shared_ptr<CPVREpg> FetchUpdate(time_t start,
+                                       time_t end,
+                                       int iUpdateTime,
+                                       const std::shared_ptr<CPVREpgDatabase>& database,
+                                       bool bForceUpdate,
+                                       bool& bSuccess);
+
+  /*!
+   * @brief Merge the entries fetched with FetchUpdate() into this EPG.
+   * @param update The fetched entries, nullptr if no update was due.
+   * @param iPastDays Amount of past days from now on, for which past entries are to be kept.
+   * @param bSuccess The result of FetchUpdate().
+   * @return True if the update was successful, false otherwise.
+   */
+  bool ApplyUpdate(const std::shared_ptr<CPVREpg>& update, int iPastDays, bool bSuccess);
+
   /*!
    * @brief Get all EPG tags.
    * @return The tags.
    */
   std::vector<std::shared_ptr<CPVREpgInfoTag>> GetTags() const;
 
+  /*!
+   * @brief Get the tags of this EPG not ended before the given time.
+   * @param minEventEnd The minimum end time of the tags to return.
+   * @return The tags.
+   */
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> GetTagsEndingAfter(
+      const CDateTime& minEventEnd) const;
+
   /*!
    * @brief Get all EPG tags for the given time frame, including "gap" tags.
    * @param timelineStart Start of time line
@@ -308,9 +343,11 @@ private:
    * @param start Get entries with a start date after this time.
    * @param end Get entries with an end date before this time.
    * @param bForceUpdate Force update from client even if it's not the time to
+   * @param changedSince If set, only get the entries changed since this time for the range
+   * covered by the last update, if the client supports it.
    * @return True if the update was successful, false otherwise.
    */
-  bool UpdateFromScraper(time_t start, time_t end, bool bForceUpdate);
+  bool UpdateFromScraper(time_t start, time_t end, bool bForceUpdate, time_t changedSince = 0);
 
   /*!
    * @brief Update the contents of this table with the contents provided in "epg"
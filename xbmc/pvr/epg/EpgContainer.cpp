@@ -11,6 +11,7 @@
 #include "ServiceBroker.h"
 #include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/pvr/pvr_channels.h" // PVR_CHANNEL_INVALID_UID
 #include "pvr/PVRManager.h"
+#include "pvr/addons/PVRClient.h"
 #include "pvr/epg/Epg.h"
 #include "pvr/epg/EpgChannelData.h"
 #include "pvr/epg/EpgContainer.h"
@@ -24,14 +25,18 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/Condition.h"
 #include "threads/SystemClock.h"
 #include "utils/log.h"
 
 #include <algorithm>
+#include <deque>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <numeric>
 #include <ranges>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -40,6 +45,19 @@ using namespace std::chrono_literals;
 namespace PVR
 {
 
+namespace
+{
+// upper bound of the threads fetching epg tables at the same time, over all clients
+constexpr unsigned int MAX_EPG_UPDATE_WORKERS = 8;
+
+struct EpgUpdateQueue
+{
+  std::deque<std::shared_ptr<CPVREpg>> epgs;
+  unsigned int active{0};
+  unsigned int maxActive{1};
+};
+} // unnamed namespace
+
 class CEpgUpdateRequest
 {
 public:
@@ -637,6 +655,10 @@ bool CPVREpgContainer::RemoveOldEntries()
     epg->Cleanup(cleanupTime);
   }
 
+  const std::shared_ptr<CPVREpgDatabase> database = GetEpgDatabase();
+  if (database)
+    database->DeleteUnusedSearchWords();
+
   std::unique_lock lock(m_critSection);
   CDateTime::GetCurrentDateTime().GetAsUTCDateTime().GetAsTime(m_iLastEpgCleanup);
 
@@ -774,36 +796,107 @@ bool CPVREpgContainer::UpdateEPG(bool bOnlyPending /* = false */)
         CServiceBroker::GetResourcesComponent().GetLocalizeStrings().Get(
             19004)); // Loading programme guide
 
-  size_t counter = 0;
+  // the tables of a client are fetched with as many parallel requests as the client can serve
+  std::map<int, EpgUpdateQueue> clientQueues;
   for (const auto& [_, epg] : epgsToUpdate)
   {
-    if (InterruptUpdate())
-    {
-      bInterrupted = true;
-      break;
-    }
-
     if (!epg)
       continue;
 
-    if (progressHandler)
-    {
-      counter++;
-      progressHandler->UpdateProgress(epg->GetChannelData()->ChannelName(), counter,
-                                      epgsToUpdate.size());
-    }
-
-    if ((!bOnlyPending || epg->UpdatePending()) &&
-        epg->Update(start, end, m_settings->GetIntValue(CSettings::SETTING_EPG_EPGUPDATE) * 60,
-                    m_settings->GetIntValue(CSettings::SETTING_EPG_PAST_DAYSTODISPLAY), database,
-                    bOnlyPending))
-    {
-      iUpdatedTables++;
-    }
+    if (!bOnlyPending || epg->UpdatePending())
+      clientQueues[epg->GetChannelData()->ClientId()].epgs.emplace_back(epg);
     else if (!epg->IsValid())
-    {
       invalidTables.push_back(epg);
+  }
+
+  unsigned int iWorkers = 0;
+  for (auto& [clientId, queue] : clientQueues)
+  {
+    const std::shared_ptr<const CPVRClient> client =
+        CServiceBroker::GetPVRManager().GetClient(clientId);
+    if (client)
+      queue.maxActive = client->GetClientCapabilities().GetMaxParallelEPGRequests();
+    iWorkers += std::min(queue.maxActive, static_cast<unsigned int>(queue.epgs.size()));
+  }
+  iWorkers = std::min(iWorkers, MAX_EPG_UPDATE_WORKERS);
+
+  const int iUpdateTime = m_settings->GetIntValue(CSettings::SETTING_EPG_EPGUPDATE) * 60;
+  const int iPastDays = m_settings->GetIntValue(CSettings::SETTING_EPG_PAST_DAYSTODISPLAY);
+  const size_t total = epgsToUpdate.size();
+  size_t counter = 0;
+
+  CCriticalSection section;
+  XbmcThreads::ConditionVariable condition;
+
+  auto worker = [&]()
+  {
+    std::unique_lock lock(section);
+    while (true)
+    {
+      auto next = clientQueues.end();
+      condition.wait(lock,
+                     [&]()
+                     {
+                       next = std::ranges::find_if(clientQueues,
+                                                   [](const auto& queue)
+                                                   {
+                                                     return queue.second.active <
+                                                                queue.second.maxActive &&
+                                                            !queue.second.epgs.empty();
+                                                   });
+                       return bInterrupted || next != clientQueues.end() ||
+                              std::ranges::all_of(clientQueues, [](const auto& queue)
+                                                  { return queue.second.epgs.empty(); });
+                     });
+      if (bInterrupted || next == clientQueues.end())
+        return;
+
+      if (InterruptUpdate())
+      {
+        bInterrupted = true;
+        condition.notifyAll();
+        return;
+      }
+
+      EpgUpdateQueue& queue = next->second;
+      const std::shared_ptr<CPVREpg> epg = std::move(queue.epgs.front());
+      queue.epgs.pop_front();
+      queue.active++;
+
+      if (progressHandler)
+      {
+        counter++;
+        progressHandler->UpdateProgress(epg->GetChannelData()->ChannelName(), counter, total);
+      }
+
+      lock.unlock();
+      bool bSuccess = true;
+      const std::shared_ptr<CPVREpg> update =
+          epg->FetchUpdate(start, end, iUpdateTime, database, bOnlyPending, bSuccess);
+      lock.lock();
+
+      // merge one table at a time, the database sees the same writes as with a sequential update
+      queue.active--;
+      if (epg->ApplyUpdate(update, iPastDays, bSuccess))
+        iUpdatedTables++;
+      else if (!epg->IsValid())
+        invalidTables.push_back(epg);
+
+      condition.notifyAll();
     }
+  };
+
+  if (iWorkers > 1)
+  {
+    std::vector<std::thread> workers;
+    for (unsigned int i = 0; i < iWorkers; ++i)
+      workers.emplace_back(worker);
+    for (auto& thread : workers)
+      thread.join();
+  }
+  else
+  {
+    worker();
   }
 
   progressHandler.reset();
@@ -19,9 +19,11 @@
 #include "utils/StringUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -29,11 +31,99 @@
 using namespace dbiplus;
 using namespace PVR;
 
+namespace
+{
+// the fields of the search index
+constexpr int SEARCH_FIELD_TITLE = 1 << 0;
+constexpr int SEARCH_FIELD_PLOT_OUTLINE = 1 << 1;
+constexpr int SEARCH_FIELD_PLOT = 1 << 2;
+constexpr int SEARCH_FIELD_EPISODE_NAME = 1 << 3;
+
+// the texts are split at whitespace only. so a search term without whitespace is a substring of a
+// text if and only if it is a substring of one of its words.
+constexpr std::string_view SEARCH_WORD_SEPARATORS = " \t\r\n";
+constexpr size_t SEARCH_WORD_MAX_LENGTH = 128;
+constexpr size_t SEARCH_INDEX_ROWS_PER_QUERY = 500;
+// below the 500 terms sqlite allows in a compound select
+constexpr size_t SEARCH_INDEX_SELECTS_PER_QUERY = 400;
+
+// tags persisted by one multi-row query, the conflict check of the chunk must stay below the
+// expression depth limit of sqlite
+constexpr size_t EPG_PERSIST_TAGS_PER_QUERY = 100;
+
+// the columns of epgtags written by PrepareTagValuesSQL(), without idBroadcast
+constexpr std::string_view EPGTAGS_COLUMNS =
+    "idEpg, iStartTime, iEndTime, sTitle, sPlotOutline, sPlot, sOriginalTitle, sCast, sDirector, "
+    "sWriter, iYear, sIMDBNumber, sIconPath, iGenreType, iGenreSubType, sGenre, sFirstAired, "
+    "iParentalRating, iStarRating, iSeriesId, iEpisodeId, iEpisodePart, sEpisodeName, iFlags, "
+    "sSeriesLink, sParentalRatingCode, iBroadcastUid, sParentalRatingIcon, sParentalRatingSource, "
+    "sTitleExtraInfo";
+
+bool IsMySQL()
+{
+  return StringUtils::EqualsNoCase(
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_databaseEpg.type, "mysql");
+}
+
+std::vector<std::string_view> SplitSearchWords(std::string_view text)
+{
+  std::vector<std::string_view> words;
+  size_t start = 0;
+  while (start < text.size())
+  {
+    const size_t end = std::min(text.find_first_of(SEARCH_WORD_SEPARATORS, start), text.size());
+    if (end > start)
+      words.emplace_back(text.substr(start, end - start));
+    start = end + 1;
+  }
+  return words;
+}
+
+void AddSearchWords(std::string_view text, int field, std::map<std::string, int>& words)
+{
+  for (std::string_view word : SplitSearchWords(text))
+  {
+    if (word.size() > SEARCH_WORD_MAX_LENGTH)
+    {
+      // don't cut a multi byte character
+      size_t length = SEARCH_WORD_MAX_LENGTH;
+      while (length > 0 && (static_cast<unsigned char>(word[length]) & 0xC0) == 0x80)
+        --length;
+      word = word.substr(0, length);
+    }
+
+    // stored in upper case, like the UPPER() of the plain LIKE searches
+    words[StringUtils::ToUpper(word)] |= field;
+  }
+}
+
+std::map<std::string, int> GetSearchWords(std::string_view title,
+                                          std::string_view plotOutline,
+                                          std::string_view plot,
+                                          std::string_view episodeName)
+{
+  std::map<std::string, int> words;
+  AddSearchWords(title, SEARCH_FIELD_TITLE, words);
+  AddSearchWords(plotOutline, SEARCH_FIELD_PLOT_OUTLINE, words);
+  AddSearchWords(plot, SEARCH_FIELD_PLOT, words);
+  AddSearchWords(episodeName, SEARCH_FIELD_EPISODE_NAME, words);
+  return words;
+}
+} // unnamed namespace
+
 bool CPVREpgDatabase::Open()
 {
   std::unique_lock lock(m_critSection);
-  return CDatabase::Open(
-      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_databaseEpg);
+  if (!CDatabase::Open(
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_databaseEpg))
+    return false;
+
+  // a guide update rewrites thousands of rows at once, with a write ahead log committing them
+  // doesn't sync the database file and a rollback journal every time
+  if (!IsMySQL())
+    ExecuteQuery("PRAGMA journal_mode=WAL");
+
+  return true;
 }
 
 void CPVREpgDatabase::Close()
@@ -135,6 +225,19 @@ void CPVREpgDatabase::CreateTables()
               "bStartAnyTime             bool, "
               "bEndAnyTime               bool"
               ")");
+
+  CLog::LogFC(LOGDEBUG, LOGEPG, "Creating table 'epgwords'");
+  m_pDS->exec("CREATE TABLE epgwords ("
+              "idWord      integer primary key, "
+              "sWord       varchar(128)"
+              ")");
+
+  CLog::LogFC(LOGDEBUG, LOGEPG, "Creating table 'epgtagwords'");
+  m_pDS->exec("CREATE TABLE epgtagwords ("
+              "idBroadcast integer, "
+              "idWord      integer, "
+              "iFields     integer"
+              ")");
 }
 
 void CPVREpgDatabase::CreateAnalytics()
@@ -144,6 +247,11 @@ void CPVREpgDatabase::CreateAnalytics()
   std::unique_lock lock(m_critSection);
   m_pDS->exec("CREATE UNIQUE INDEX idx_epg_idEpg_iStartTime on epgtags(idEpg, iStartTime desc);");
   m_pDS->exec("CREATE INDEX idx_epg_iEndTime on epgtags(iEndTime);");
+  m_pDS->exec("CREATE UNIQUE INDEX idx_epgwords_sWord on epgwords(sWord);");
+  m_pDS->exec("CREATE INDEX idx_epgtagwords_idWord on epgtagwords(idWord);");
+  m_pDS->exec("CREATE INDEX idx_epgtagwords_idBroadcast on epgtagwords(idBroadcast);");
+  m_pDS->exec("CREATE TRIGGER epgtagDelete AFTER DELETE ON epgtags FOR EACH ROW BEGIN "
+              "DELETE FROM epgtagwords WHERE idBroadcast = old.idBroadcast; END");
 }
 
 void CPVREpgDatabase::UpdateTables(int iVersion)
@@ -177,8 +285,7 @@ void CPVREpgDatabase::UpdateTables(int iVersion)
 
   if (iVersion < 13)
   {
-    const bool isMySQL = StringUtils::EqualsNoCase(
-        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_databaseEpg.type, "mysql");
+    const bool isMySQL = IsMySQL();
 
     m_pDS->exec("CREATE TABLE epgtags_new ("
                 "idBroadcast     integer primary key, "
@@ -347,6 +454,72 @@ void CPVREpgDatabase::UpdateTables(int iVersion)
     m_pDS->exec("ALTER TABLE epgtags ADD sTitleExtraInfo varchar(128);");
     m_pDS->exec("UPDATE epgtags SET sTitleExtraInfo = ''");
   }
+
+  if (iVersion < 22)
+  {
+    m_pDS->exec("CREATE TABLE epgwords ("
+                "idWord      integer primary key, "
+                "sWord       varchar(128)"
+                ")");
+    m_pDS->exec("CREATE TABLE epgtagwords ("
+                "idBroadcast integer, "
+                "idWord      integer, "
+                "iFields     integer"
+                ")");
+    RebuildSearchIndex();
+  }
+}
+
+void CPVREpgDatabase::RebuildSearchIndex()
+{
+  CLog::LogFC(LOGDEBUG, LOGEPG, "Building the EPG search index");
+
+  std::unique_lock lock(m_critSection);
+  m_pDS->exec("DELETE FROM epgtagwords");
+  m_pDS->exec("DELETE FROM epgwords");
+
+  // the unique index of the words does not exist yet, the ids are assigned here
+  std::map<std::string, int, std::less<>> wordIds;
+  std::vector<std::string> wordRows;
+  std::vector<std::string> tagWordRows;
+
+  const auto flush = [this](std::string_view query, std::vector<std::string>& rows)
+  {
+    if (!rows.empty())
+    {
+      m_pDS2->exec(std::string{query} + StringUtils::Join(rows, ", "));
+      rows.clear();
+    }
+  };
+
+  m_pDS->query("SELECT idBroadcast, sTitle, sPlotOutline, sPlot, sEpisodeName FROM epgtags");
+  while (!m_pDS->eof())
+  {
+    const int idBroadcast = m_pDS->fv("idBroadcast").get_asInt();
+    const auto words = GetSearchWords(
+        m_pDS->fv("sTitle").get_asString(), m_pDS->fv("sPlotOutline").get_asString(),
+        m_pDS->fv("sPlot").get_asString(), m_pDS->fv("sEpisodeName").get_asString());
+
+    for (const auto& [word, fields] : words)
+    {
+      const auto [it, inserted] = wordIds.try_emplace(word, static_cast<int>(wordIds.size()) + 1);
+      if (inserted)
+        wordRows.emplace_back(PrepareSQL("(%i, '%s')", it->second, word.c_str()));
+
+      tagWordRows.emplace_back(PrepareSQL("(%i, %i, %i)", idBroadcast, it->second, fields));
+    }
+
+    if (wordRows.size() >= SEARCH_INDEX_ROWS_PER_QUERY)
+      flush("INSERT INTO epgwords (idWord, sWord) VALUES ", wordRows);
+    if (tagWordRows.size() >= SEARCH_INDEX_ROWS_PER_QUERY)
+      flush("INSERT INTO epgtagwords (idBroadcast, idWord, iFields) VALUES ", tagWordRows);
+
+    m_pDS->next();
+  }
+  m_pDS->close();
+
+  flush("INSERT INTO epgwords (idWord, sWord) VALUES ", wordRows);
+  flush("INSERT INTO epgtagwords (idBroadcast, idWord, iFields) VALUES ", tagWordRows);
 }
 
 bool CPVREpgDatabase::DeleteEpg()
@@ -358,6 +531,8 @@ bool CPVREpgDatabase::DeleteEpg()
 
   bReturn = DeleteValues("epg") || bReturn;
   bReturn = DeleteValues("epgtags") || bReturn;
+  bReturn = DeleteValues("epgtagwords") || bReturn;
+  bReturn = DeleteValues("epgwords") || bReturn;
   bReturn = DeleteValues("lastepgscan") || bReturn;
 
   return bReturn;
@@ -571,21 +746,20 @@ class CSearchTermConverter
 public:
   explicit CSearchTermConverter(const std::string& strSearchTerm) { Parse(strSearchTerm); }
 
-  bool HasSearchTerm() const { return !m_fragments.empty(); }
+  bool HasSearchTerm() const { return !m_terms.empty(); }
 
-  std::string ToSQL(std::string_view strFieldName) const
+  std::string ToSQL(std::string_view strFieldName, int iSearchField) const
   {
     std::string result = "(";
 
-    for (auto it = m_fragments.cbegin(); it != m_fragments.cend();)
+    for (const auto& term : m_terms)
     {
-      result += (*it);
-
-      ++it;
-      if (it != m_fragments.cend())
-        result += strFieldName;
+      result += term.m_operators;
+      result += TermToSQL(term.m_term, strFieldName, iSearchField);
+      result += " ";
     }
 
+    result += m_trailingOperators;
     StringUtils::TrimRight(result);
     result += ")";
     return result;
@@ -634,19 +808,12 @@ private:
         GetAndCutNextTerm(strParsedSearchTerm, strTerm);
         if (!strTerm.empty())
         {
-          if (bNextOR && !m_fragments.empty())
+          if (bNextOR && !m_terms.empty())
             strFragment += " OR "; // default operator
 
-          strFragment += "(UPPER(";
-
-          m_fragments.emplace_back(strFragment);
+          m_terms.push_back({strFragment, strTerm});
           strFragment.clear();
 
-          strFragment += ") LIKE UPPER('%";
-          StringUtils::Replace(strTerm, "'", "''"); // escape '
-          strFragment += strTerm;
-          strFragment += "%')) ";
-
           bNextOR = true;
         }
         else
@@ -658,8 +825,44 @@ private:
       StringUtils::TrimLeft(strParsedSearchTerm);
     }
 
-    if (!strFragment.empty())
-      m_fragments.emplace_back(strFragment);
+    m_trailingOperators = strFragment;
+  }
+
+  /*!
+   * @brief Look the words of the term up in the search index. That gives the exact result for
+   * terms without whitespace. For phrases, every word of the term must be found in the text, and
+   * the text is checked to contain the phrase.
+   */
+  static std::string TermToSQL(std::string strTerm, std::string_view strFieldName, int iSearchField)
+  {
+    StringUtils::Replace(strTerm, "'", "''"); // escape '
+
+    const std::vector<std::string_view> words = SplitSearchWords(strTerm);
+    if (words.empty())
+      return StringUtils::Format("(UPPER({}) LIKE UPPER('%{}%'))", strFieldName, strTerm);
+
+    std::string result = "(";
+    for (size_t i = 0; i < words.size(); ++i)
+    {
+      // only the start of the term may be inside a word of the text, and only its end may be
+      // followed by more characters of a word
+      const bool openLeft = i == 0 && strTerm.starts_with(words[i]);
+      const bool openRight = i == words.size() - 1 && strTerm.ends_with(words[i]);
+      if (i > 0)
+        result += " AND ";
+      result += StringUtils::Format(
+          "idBroadcast IN (SELECT epgtagwords.idBroadcast FROM epgtagwords "
+          "JOIN epgwords ON epgwords.idWord = epgtagwords.idWord "
+          "WHERE (epgtagwords.iFields & {}) <> 0 AND epgwords.sWord LIKE '{}{}{}')",
+          iSearchField, openLeft ? "%" : "", StringUtils::ToUpper(words[i]),
+          openRight ? "%" : "");
+    }
+
+    if (words.size() > 1 || words.front().size() != strTerm.size())
+      result += StringUtils::Format(" AND UPPER({}) LIKE UPPER('%{}%')", strFieldName, strTerm);
+
+    result += ")";
+    return result;
   }
 
   static void GetAndCutNextTerm(std::string& strSearchTerm, std::string& strNextTerm)
@@ -685,7 +888,14 @@ private:
     }
   }
 
-  std::vector<std::string> m_fragments;
+  struct Term
+  {
+    std::string m_operators; // the operators before the term
+    std::string m_term;
+  };
+
+  std::vector<Term> m_terms;
+  std::string m_trailingOperators;
 };
 
 } // unnamed namespace
@@ -797,17 +1007,24 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgDatabase::GetEpgTags(
   if (conv.HasSearchTerm())
   {
     // title
-    std::string strWhere = conv.ToSQL("sTitle");
+    std::string strWhere = conv.ToSQL("sTitle", SEARCH_FIELD_TITLE);
 
     // plot outline
     strWhere += " OR ";
-    strWhere += conv.ToSQL("sPlotOutline");
+    strWhere += conv.ToSQL("sPlotOutline", SEARCH_FIELD_PLOT_OUTLINE);
 
     if (searchData.m_bSearchInDescription)
     {
       // plot
       strWhere += " OR ";
-      strWhere += conv.ToSQL("sPlot");
+      strWhere += conv.ToSQL("sPlot", SEARCH_FIELD_PLOT);
+    }
+
+    if (searchData.m_bSearchInEpisodeName)
+    {
+      // episode name
+      strWhere += " OR ";
+      strWhere += conv.ToSQL("sEpisodeName", SEARCH_FIELD_EPISODE_NAME);
     }
 
     filter.AppendWhere(strWhere);
@@ -1165,6 +1382,40 @@ bool CPVREpgDatabase::GetAllParentalRatingIconPaths(int iEpgID,
   return false;
 }
 
+bool CPVREpgDatabase::GetEpgTagTimes(int iEpgID,
+                                     std::vector<time_t>& starts,
+                                     std::vector<time_t>& ends) const
+{
+  std::unique_lock lock(m_critSection);
+  const std::string strQuery =
+      PrepareSQL("SELECT iStartTime, iEndTime FROM epgtags WHERE idEpg = %u;", iEpgID);
+  if (ResultQuery(strQuery))
+  {
+    try
+    {
+      while (!m_pDS->eof())
+      {
+        starts.emplace_back(static_cast<time_t>(m_pDS->fv("iStartTime").get_asInt()));
+        ends.emplace_back(static_cast<time_t>(m_pDS->fv("iEndTime").get_asInt()));
+        m_pDS->next();
+      }
+      m_pDS->close();
+
+      // sorted separately, overlapping tags must not break the lookups
+      std::ranges::sort(starts);
+      std::ranges::sort(ends);
+      return true;
+    }
+    catch (...)
+    {
+      CLog::LogF(LOGERROR, "Could not load tag times for EPG ({})", iEpgID);
+    }
+  }
+  starts.clear();
+  ends.clear();
+  return false;
+}
+
 bool CPVREpgDatabase::GetLastEpgScanTime(int iEpgId, CDateTime* lastScan) const
 {
   bool bReturn = false;
@@ -1278,14 +1529,67 @@ bool CPVREpgDatabase::QueueDeleteEpgTags(int iEpgId)
   return QueueDeleteQuery(strQuery);
 }
 
-bool CPVREpgDatabase::QueuePersistQuery(const CPVREpgInfoTag& tag)
+bool CPVREpgDatabase::DeleteUnusedSearchWords()
 {
-  if (tag.EpgID() <= 0)
+  std::unique_lock lock(m_critSection);
+  return ExecuteQuery("DELETE FROM epgwords WHERE NOT EXISTS (SELECT 1 FROM epgtagwords "
+                      "WHERE epgtagwords.idWord = epgwords.idWord)");
+}
+
+void CPVREpgDatabase::QueuePersistWithSearchIndexQuery(const CPVREpgInfoTag& tag,
+                                                        const std::string& strPersistQuery)
+{
+  time_t iStartTime{0};
+  tag.StartAsUTC().GetAsTime(iStartTime);
+
+  // the tag is identified by its slot, new tags get their id only when the query is committed
+  const std::string tagQuery =
+      PrepareSQL("SELECT idBroadcast FROM epgtags WHERE idEpg = %u AND iStartTime = %u",
+                 tag.EpgID(), static_cast<unsigned int>(iStartTime));
+
+  // REPLACE doesn't fire the delete trigger with sqlite, drop the words of the replaced tags here
+  QueueInsertQuery("DELETE FROM epgtagwords WHERE idBroadcast IN (" + tagQuery + ")");
+  if (tag.DatabaseID() > 0)
+    QueueInsertQuery(
+        PrepareSQL("DELETE FROM epgtagwords WHERE idBroadcast = %i", tag.DatabaseID()));
+
+  QueueInsertQuery(strPersistQuery);
+
+  QueueSearchWordsQuery(
+      tagQuery, GetSearchWords(tag.Title(), tag.PlotOutline(), tag.Plot(), tag.EpisodeName()));
+}
+
+void CPVREpgDatabase::QueueSearchWordsQuery(const std::string& tagQuery,
+                                            const std::map<std::string, int>& words)
+{
+  if (words.empty())
+    return;
+
+  std::vector<std::string> values;
+  std::map<int, std::vector<std::string>> wordsByFields;
+  for (const auto& [word, fields] : words)
   {
-    CLog::LogF(LOGERROR, "Tag '{}' does not have a valid table", tag.Title());
-    return false;
+    std::string value = PrepareSQL("'%s'", word.c_str());
+    wordsByFields[fields].emplace_back(value);
+    values.emplace_back("(" + value + ")");
   }
 
+  QueueInsertQuery(std::string{IsMySQL() ? "INSERT IGNORE" : "INSERT OR IGNORE"} +
+                   " INTO epgwords (sWord) VALUES " + StringUtils::Join(values, ", "));
+
+  for (const auto& [fields, fieldWords] : wordsByFields)
+  {
+    QueueInsertQuery(PrepareSQL("INSERT INTO epgtagwords (idBroadcast, idWord, iFields) "
+                                "SELECT t.idBroadcast, epgwords.idWord, %i "
+                                "FROM (",
+                                fields) +
+                     tagQuery + ") t, epgwords WHERE epgwords.sWord IN (" +
+                     StringUtils::Join(fieldWords, ", ") + ")");
+  }
+}
+
+std::string CPVREpgDatabase::PrepareTagValuesSQL(const CPVREpgInfoTag& tag) const
+{
   time_t iStartTime{0};
   tag.StartAsUTC().GetAsTime(iStartTime);
 
@@ -1296,64 +1600,191 @@ bool CPVREpgDatabase::QueuePersistQuery(const CPVREpgInfoTag& tag)
   if (tag.FirstAired().IsValid())
     sFirstAired = tag.FirstAired().GetAsW3CDate();
 
-  int iBroadcastId = tag.DatabaseID();
-  std::string strQuery;
+  std::string values = PrepareSQL(
+      "(%u, %u, %u, '%s', '%s', '%s', '%s', '%s', '%s', '%s', %i, '%s', '%s', %i, %i, "
+      "'%s', '%s', %i, %i, %i, %i, %i, '%s', %i, '%s', '%s', %i, '%s', '%s', '%s'",
+      tag.EpgID(), static_cast<unsigned int>(iStartTime), static_cast<unsigned int>(iEndTime),
+      tag.Title().c_str(), tag.PlotOutline().c_str(), tag.Plot().c_str(),
+      tag.OriginalTitle().c_str(), CPVREpgInfoTag::DeTokenize(tag.Cast()).c_str(),
+      CPVREpgInfoTag::DeTokenize(tag.Directors()).c_str(),
+      CPVREpgInfoTag::DeTokenize(tag.Writers()).c_str(), tag.Year(), tag.IMDBNumber().c_str(),
+      tag.ClientIconPath().c_str(), tag.GenreType(), tag.GenreSubType(),
+      tag.GenreDescription().c_str(), sFirstAired.c_str(), tag.ParentalRating(), tag.StarRating(),
+      tag.SeriesNumber(), tag.EpisodeNumber(), tag.EpisodePart(), tag.EpisodeName().c_str(),
+      tag.Flags(), tag.SeriesLink().c_str(), tag.ParentalRatingCode().c_str(),
+      tag.UniqueBroadcastID(), tag.ClientParentalRatingIconPath().c_str(),
+      tag.ParentalRatingSource().c_str(), tag.TitleExtraInfo().c_str());
+
+  if (tag.DatabaseID() > 0)
+    values += PrepareSQL(", %i", tag.DatabaseID());
+
+  return values + ")";
+}
+
+bool CPVREpgDatabase::QueuePersistQuery(const CPVREpgInfoTag& tag)
+{
+  if (tag.EpgID() <= 0)
+  {
+    CLog::LogF(LOGERROR, "Tag '{}' does not have a valid table", tag.Title());
+    return false;
+  }
+
+  std::unique_lock lock(m_critSection);
+
+  const std::string strQuery = StringUtils::Format(
+      "REPLACE INTO epgtags ({}{}) VALUES {};", EPGTAGS_COLUMNS,
+      tag.DatabaseID() > 0 ? ", idBroadcast" : "", PrepareTagValuesSQL(tag));
+
+  QueuePersistWithSearchIndexQuery(tag, strQuery);
+  return true;
+}
+
+bool CPVREpgDatabase::QueuePersistTagsQuery(
+    int iEpgID,
+    const std::vector<std::shared_ptr<CPVREpgInfoTag>>& changedTags,
+    const std::vector<std::shared_ptr<CPVREpgInfoTag>>& deletedTags)
+{
+  if (iEpgID <= 0)
+  {
+    CLog::LogF(LOGERROR, "Invalid table id: {}", iEpgID);
+    return false;
+  }
 
   std::unique_lock lock(m_critSection);
 
-  if (iBroadcastId < 0)
+  // tags without a database id were not persisted
+  std::vector<std::string> deletedIds;
+  for (const auto& tag : deletedTags)
   {
-    strQuery = PrepareSQL(
-        "REPLACE INTO epgtags (idEpg, iStartTime, "
-        "iEndTime, sTitle, sPlotOutline, sPlot, sOriginalTitle, sCast, sDirector, sWriter, iYear, "
-        "sIMDBNumber, "
-        "sIconPath, iGenreType, iGenreSubType, sGenre, sFirstAired, iParentalRating, iStarRating, "
-        "iSeriesId, "
-        "iEpisodeId, iEpisodePart, sEpisodeName, iFlags, sSeriesLink, sParentalRatingCode, "
-        "iBroadcastUid, sParentalRatingIcon, sParentalRatingSource, sTitleExtraInfo) "
-        "VALUES (%u, %u, %u, '%s', '%s', '%s', '%s', '%s', '%s', '%s', %i, '%s', '%s', %i, %i, "
-        "'%s', '%s', %i, %i, %i, %i, %i, '%s', %i, '%s', '%s', %i, '%s', '%s', '%s');",
-        tag.EpgID(), static_cast<unsigned int>(iStartTime), static_cast<unsigned int>(iEndTime),
-        tag.Title().c_str(), tag.PlotOutline().c_str(), tag.Plot().c_str(),
-        tag.OriginalTitle().c_str(), CPVREpgInfoTag::DeTokenize(tag.Cast()).c_str(),
-        CPVREpgInfoTag::DeTokenize(tag.Directors()).c_str(),
-        CPVREpgInfoTag::DeTokenize(tag.Writers()).c_str(), tag.Year(), tag.IMDBNumber().c_str(),
-        tag.ClientIconPath().c_str(), tag.GenreType(), tag.GenreSubType(),
-        tag.GenreDescription().c_str(), sFirstAired.c_str(), tag.ParentalRating(), tag.StarRating(),
-        tag.SeriesNumber(), tag.EpisodeNumber(), tag.EpisodePart(), tag.EpisodeName().c_str(),
-        tag.Flags(), tag.SeriesLink().c_str(), tag.ParentalRatingCode().c_str(),
-        tag.UniqueBroadcastID(), tag.ClientParentalRatingIconPath().c_str(),
-        tag.ParentalRatingSource().c_str(), tag.TitleExtraInfo().c_str());
+    if (tag->DatabaseID() > 0)
+      deletedIds.emplace_back(PrepareSQL("%i", tag->DatabaseID()));
   }
-  else
+
+  for (size_t i = 0; i < deletedIds.size(); i += SEARCH_INDEX_ROWS_PER_QUERY)
   {
-    strQuery = PrepareSQL(
-        "REPLACE INTO epgtags (idEpg, iStartTime, "
-        "iEndTime, sTitle, sPlotOutline, sPlot, sOriginalTitle, sCast, sDirector, sWriter, iYear, "
-        "sIMDBNumber, "
-        "sIconPath, iGenreType, iGenreSubType, sGenre, sFirstAired, iParentalRating, iStarRating, "
-        "iSeriesId, "
-        "iEpisodeId, iEpisodePart, sEpisodeName, iFlags, sSeriesLink, sParentalRatingCode, "
-        "iBroadcastUid, idBroadcast, sParentalRatingIcon, sParentalRatingSource, sTitleExtraInfo) "
-        "VALUES (%u, %u, %u, '%s', '%s', '%s', '%s', '%s', '%s', '%s', %i, '%s', '%s', %i, %i, "
-        "'%s', '%s', %i, %i, %i, %i, %i, '%s', %i, '%s', '%s', %i, %i, '%s', '%s', '%s');",
-        tag.EpgID(), static_cast<unsigned int>(iStartTime), static_cast<unsigned int>(iEndTime),
-        tag.Title().c_str(), tag.PlotOutline().c_str(), tag.Plot().c_str(),
-        tag.OriginalTitle().c_str(), CPVREpgInfoTag::DeTokenize(tag.Cast()).c_str(),
-        CPVREpgInfoTag::DeTokenize(tag.Directors()).c_str(),
-        CPVREpgInfoTag::DeTokenize(tag.Writers()).c_str(), tag.Year(), tag.IMDBNumber().c_str(),
-        tag.ClientIconPath().c_str(), tag.GenreType(), tag.GenreSubType(),
-        tag.GenreDescription().c_str(), sFirstAired.c_str(), tag.ParentalRating(), tag.StarRating(),
-        tag.SeriesNumber(), tag.EpisodeNumber(), tag.EpisodePart(), tag.EpisodeName().c_str(),
-        tag.Flags(), tag.SeriesLink().c_str(), tag.ParentalRatingCode().c_str(),
-        tag.UniqueBroadcastID(), iBroadcastId, tag.ClientParentalRatingIconPath().c_str(),
-        tag.ParentalRatingSource().c_str(), tag.TitleExtraInfo().c_str());
+    const std::vector<std::string> ids(
+        deletedIds.cbegin() + i,
+        deletedIds.cbegin() + std::min(deletedIds.size(), i + SEARCH_INDEX_ROWS_PER_QUERY));
+    QueueInsertQuery("DELETE FROM epgtags WHERE idBroadcast IN (" + StringUtils::Join(ids, ", ") +
+                     ")");
+  }
+
+  const std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags = changedTags;
+  for (size_t first = 0; first < tags.size(); first += EPG_PERSIST_TAGS_PER_QUERY)
+  {
+    const size_t last = std::min(tags.size(), first + EPG_PERSIST_TAGS_PER_QUERY);
+
+    std::vector<std::string> conflicts;
+    std::vector<std::string> starts;
+    std::vector<std::string> ids;
+    std::vector<std::string> newValues;
+    std::vector<std::string> persistedValues;
+    for (size_t i = first; i < last; ++i)
+    {
+      const CPVREpgInfoTag& tag = *tags[i];
+
+      time_t iStartTime{0};
+      tag.StartAsUTC().GetAsTime(iStartTime);
+
+      time_t iEndTime{0};
+      tag.EndAsUTC().GetAsTime(iEndTime);
+
+      // persisted tags overlapping the tag are replaced by it
+      conflicts.emplace_back(PrepareSQL("(iEndTime >= %u AND iStartTime <= %u)",
+                                        static_cast<unsigned int>(iStartTime + 1),
+                                        static_cast<unsigned int>(iEndTime - 1)));
+      starts.emplace_back(PrepareSQL("%u", static_cast<unsigned int>(iStartTime)));
+
+      if (tag.DatabaseID() > 0)
+      {
+        ids.emplace_back(PrepareSQL("%i", tag.DatabaseID()));
+        persistedValues.emplace_back(PrepareTagValuesSQL(tag));
+      }
+      else
+      {
+        newValues.emplace_back(PrepareTagValuesSQL(tag));
+      }
+    }
+
+    QueueInsertQuery(PrepareSQL("DELETE FROM epgtags WHERE idEpg = %u AND (", iEpgID) +
+                     StringUtils::Join(conflicts, " OR ") + ")");
+
+    // REPLACE doesn't fire the delete trigger with sqlite, drop the words of the replaced tags here
+    QueueInsertQuery(PrepareSQL("DELETE FROM epgtagwords WHERE idBroadcast IN (SELECT idBroadcast "
+                                "FROM epgtags WHERE idEpg = %u AND iStartTime IN (",
+                                iEpgID) +
+                     StringUtils::Join(starts, ", ") + "))");
+    if (!ids.empty())
+      QueueInsertQuery("DELETE FROM epgtagwords WHERE idBroadcast IN (" +
+                       StringUtils::Join(ids, ", ") + ")");
+
+    if (!newValues.empty())
+      QueueInsertQuery(StringUtils::Format("REPLACE INTO epgtags ({}) VALUES {}", EPGTAGS_COLUMNS,
+                                           StringUtils::Join(newValues, ", ")));
+    if (!persistedValues.empty())
+      QueueInsertQuery(StringUtils::Format("REPLACE INTO epgtags ({}, idBroadcast) VALUES {}",
+                                           EPGTAGS_COLUMNS,
+                                           StringUtils::Join(persistedValues, ", ")));
+
+    QueueSearchWordsQuery(iEpgID, tags, first, last);
   }
 
-  QueueInsertQuery(strQuery);
   return true;
 }
 
+void CPVREpgDatabase::QueueSearchWordsQuery(
+    int iEpgID, const std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags, size_t first, size_t last)
+{
+  std::set<std::string> vocabulary;
+  std::vector<std::string> postings;
+  for (size_t i = first; i < last; ++i)
+  {
+    const CPVREpgInfoTag& tag = *tags[i];
+
+    time_t iStartTime{0};
+    tag.StartAsUTC().GetAsTime(iStartTime);
+
+    std::map<int, std::vector<std::string>> wordsByFields;
+    for (const auto& [word, fields] :
+         GetSearchWords(tag.Title(), tag.PlotOutline(), tag.Plot(), tag.EpisodeName()))
+    {
+      std::string value = PrepareSQL("'%s'", word.c_str());
+      wordsByFields[fields].emplace_back(value);
+      vocabulary.emplace(std::move(value));
+    }
+
+    for (const auto& [fields, fieldWords] : wordsByFields)
+    {
+      postings.emplace_back(
+          PrepareSQL("SELECT epgtags.idBroadcast, epgwords.idWord, %i FROM epgtags, epgwords "
+                     "WHERE epgtags.idEpg = %u AND epgtags.iStartTime = %u AND epgwords.sWord IN (",
+                     fields, iEpgID, static_cast<unsigned int>(iStartTime)) +
+          StringUtils::Join(fieldWords, ", ") + ")");
+    }
+  }
+
+  if (vocabulary.empty())
+    return;
+
+  std::vector<std::string> values;
+  values.reserve(vocabulary.size());
+  for (const std::string& value : vocabulary)
+    values.emplace_back("(" + value + ")");
+
+  QueueInsertQuery(std::string{IsMySQL() ? "INSERT IGNORE" : "INSERT OR IGNORE"} +
+                   " INTO epgwords (sWord) VALUES " + StringUtils::Join(values, ", "));
+
+  // sqlite limits the number of terms of a compound select
+  for (size_t i = 0; i < postings.size(); i += SEARCH_INDEX_SELECTS_PER_QUERY)
+  {
+    const std::vector<std::string> selects(
+        postings.cbegin() + i,
+        postings.cbegin() + std::min(postings.size(), i + SEARCH_INDEX_SELECTS_PER_QUERY));
+    QueueInsertQuery("INSERT INTO epgtagwords (idBroadcast, idWord, iFields) " +
+                     StringUtils::Join(selects, " UNION ALL "));
+  }
+}
+
 int CPVREpgDatabase::GetLastEPGId() const
 {
   std::unique_lock lock(m_critSection);
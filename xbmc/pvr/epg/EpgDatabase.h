@@ -11,7 +11,9 @@
 #include "dbwrappers/Database.h"
 #include "threads/CriticalSection.h"
 
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 class CDateTime;
@@ -66,7 +68,7 @@ public:
    * @brief Get the minimal database version that is required to operate correctly.
    * @return The minimal database version.
    */
-  int GetSchemaVersion() const override { return 21; }
+  int GetSchemaVersion() const override { return 22; }
 
   /*!
    * @brief Get the default sqlite database filename.
@@ -126,6 +128,15 @@ public:
    */
   bool GetAllParentalRatingIconPaths(int iEpgID, std::vector<std::string>& paths) const;
 
+  /*!
+   * @brief Get the start and end times of all tags of a given EPG id, each sorted ascending.
+   * @param iEpgID The ID of the EPG.
+   * @param starts The start times returned.
+   * @param ends The end times returned.
+   * @return True on success, false otherwise.
+   */
+  bool GetEpgTagTimes(int iEpgID, std::vector<time_t>& starts, std::vector<time_t>& ends) const;
+
   /*!
    * @brief Check whether this EPG has any tags.
    * @param iEpgID The ID of the EPG.
@@ -298,6 +309,12 @@ public:
    */
   bool QueueDeleteEpgTags(int iEpgId);
 
+  /*!
+   * @brief Erase the words of the search index that are no longer used by any EPG tag.
+   * @return True if the words were removed successfully, false otherwise.
+   */
+  bool DeleteUnusedSearchWords();
+
   /*!
    * @brief Write the query to persist the given EPG tag to db query queue.
    * @param tag The tag to persist.
@@ -305,6 +322,19 @@ public:
    */
   bool QueuePersistQuery(const CPVREpgInfoTag& tag);
 
+  /*!
+   * @brief Write the queries to update the EPG tags of a table to db query queue. All queries go
+   * to the insert queue, so they are committed in a single transaction. The tags are written with
+   * multi-row queries and replace any persisted tag they overlap.
+   * @param iEpgID The id of the table.
+   * @param changedTags The tags to persist, they must not overlap each other.
+   * @param deletedTags The tags to delete.
+   * @return True on success, false otherwise.
+   */
+  bool QueuePersistTagsQuery(int iEpgID,
+                             const std::vector<std::shared_ptr<CPVREpgInfoTag>>& changedTags,
+                             const std::vector<std::shared_ptr<CPVREpgInfoTag>>& deletedTags);
+
   /*!
    * @return Last EPG id in the database
    */
@@ -378,6 +408,46 @@ private:
 
   int GetMinSchemaVersion() const override { return 4; }
 
+  /*!
+   * @brief Write the query to persist an EPG tag to db query queue, replacing its search index
+   * entries.
+   * @param tag The tag to persist.
+   * @param strPersistQuery The query persisting the tag.
+   */
+  void QueuePersistWithSearchIndexQuery(const CPVREpgInfoTag& tag,
+                                        const std::string& strPersistQuery);
+
+  /*!
+   * @brief Write the queries to add search index entries to db query queue.
+   * @param tagQuery The query selecting the database id of the indexed tag.
+   * @param words The words of the tag and the fields they appear in.
+   */
+  void QueueSearchWordsQuery(const std::string& tagQuery, const std::map<std::string, int>& words);
+
+  /*!
+   * @brief Write the queries to add the search index entries of a range of tags to db query queue.
+   * @param iEpgID The id of the table of the tags.
+   * @param tags The tags.
+   * @param first The index of the first tag to index.
+   * @param last The index after the last tag to index.
+   */
+  void QueueSearchWordsQuery(int iEpgID,
+                             const std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags,
+                             size_t first,
+                             size_t last);
+
+  /*!
+   * @brief Get the values of a tag for the REPLACE queries persisting it.
+   * @param tag The tag.
+   * @return The parenthesized values, ending with the database id if the tag has one.
+   */
+  std::string PrepareTagValuesSQL(const CPVREpgInfoTag& tag) const;
+
+  /*!
+   * @brief Build the search index of all EPG tags.
+   */
+  void RebuildSearchIndex();
+
   std::shared_ptr<CPVREpgInfoTag> CreateEpgTag(dbiplus::Dataset& ds) const;
 
   std::shared_ptr<CPVREpgSearchFilter> CreateEpgSearchFilter(bool bRadio,
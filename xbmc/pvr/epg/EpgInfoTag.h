@@ -12,6 +12,7 @@
 #include "pvr/PVRCachedImage.h"
 #include "threads/CriticalSection.h"
 #include "utils/ISerializable.h"
+#include "utils/SharedStrings.h"
 
 #include <memory>
 #include <string>
@@ -517,7 +518,7 @@ private:
   int m_iDatabaseID = -1; /*!< database ID */
   int m_iGenreType = 0; /*!< genre type */
   int m_iGenreSubType = 0; /*!< genre subtype */
-  std::string m_strGenreDescription; /*!< genre description */
+  CSharedString m_strGenreDescription; /*!< genre description, shared between the tags */
   unsigned int m_parentalRating = 0; /*!< parental rating */
   std::string m_parentalRatingCode; /*!< Parental rating code */
   CPVRCachedImage m_parentalRatingIcon; /*!< parental rating icon path */
@@ -537,7 +538,7 @@ private:
   std::vector<std::string> m_writers; /*!< writer(s) */
   int m_iYear = 0; /*!< year */
   std::string m_strIMDBNumber; /*!< imdb number */
-  mutable std::vector<std::string> m_genre; /*!< genre */
+  mutable CSharedStringList m_genre; /*!< genre, shared between the tags */
   std::string m_strEpisodeName; /*!< episode name */
   CPVRCachedImage m_iconPath; /*!< the path to the icon */
   CDateTime m_startTime; /*!< event start time */
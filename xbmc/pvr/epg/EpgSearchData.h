@@ -21,6 +21,7 @@ struct PVREpgSearchData
 {
   std::string m_strSearchTerm; /*!< The term to search for */
   bool m_bSearchInDescription = false; /*!< Search for strSearchTerm in the description too */
+  bool m_bSearchInEpisodeName = false; /*!< Search for strSearchTerm in the episode name too */
   bool m_bIncludeUnknownGenres = false; /*!< Whether to include unknown genres */
   int m_iGenreType = EPG_SEARCH_UNSET; /*!< The genre type for an entry */
   bool m_bIgnoreFinishedBroadcasts; /*!< True to ignore finished broadcasts, false if not */
@@ -34,6 +35,7 @@ struct PVREpgSearchData
   {
     m_strSearchTerm.clear();
     m_bSearchInDescription = false;
+    m_bSearchInEpisodeName = false;
     m_bIncludeUnknownGenres = false;
     m_iGenreType = EPG_SEARCH_UNSET;
     m_bIgnoreFinishedBroadcasts = true;
@@ -15,6 +15,7 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <iterator>
 #include <ranges>
 
 using namespace PVR;
@@ -39,6 +40,7 @@ CPVREpgTagsContainer::~CPVREpgTagsContainer() = default;
 void CPVREpgTagsContainer::SetEpgID(int iEpgID)
 {
   m_iEpgID = iEpgID;
+  InvalidateTimeIndex();
   for (const auto& [_, tag] : m_changedTags)
     tag->SetEpgID(iEpgID);
 }
@@ -318,13 +320,20 @@ void CPVREpgTagsContainer::Cleanup(const CDateTime& time)
   }
 
   if (m_database)
+  {
     m_database->DeleteEpgTags(m_iEpgID, time);
+    InvalidateTimeIndex();
+  }
 }
 
 void CPVREpgTagsContainer::Clear()
 {
   m_changedTags.clear();
   m_tagsCache->Reset();
+
+  // called when the changes were queued for the database. the queries are committed while the
+  // database is locked, thus a new index can't be loaded before they are done.
+  InvalidateTimeIndex();
 }
 
 bool CPVREpgTagsContainer::IsEmpty() const
@@ -333,7 +342,13 @@ bool CPVREpgTagsContainer::IsEmpty() const
     return false;
 
   if (m_database)
+  {
+    const TimeIndex* index = GetTimeIndex();
+    if (index)
+      return index->m_starts.empty();
+
     return !m_database->HasTags(m_iEpgID);
+  }
 
   return true;
 }
@@ -468,7 +483,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
     bool loadFromDb = true;
     if (!m_changedTags.empty())
     {
-      const CDateTime lastEnd = m_database->GetLastEndTime(m_iEpgID);
+      const CDateTime lastEnd = GetLastEndTime();
       if (!lastEnd.IsValid() || lastEnd < minEventEnd)
       {
         // nothing in the db yet. take what we have in memory.
@@ -479,7 +494,8 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
 
     if (loadFromDb)
     {
-      tags = m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, minEventEnd, maxEventStart);
+      if (HasCommittedTags(minEventEnd, maxEventStart))
+        tags = m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, minEventEnd, maxEventStart);
 
       if (!m_changedTags.empty())
       {
@@ -521,11 +537,11 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
     if (result.empty())
     {
       // create single gap tag
-      CDateTime maxEnd = m_database->GetMaxEndTime(m_iEpgID, minEventEnd);
+      CDateTime maxEnd = GetMaxEndTime(minEventEnd);
       if (!maxEnd.IsValid() || maxEnd < timelineStart)
         maxEnd = timelineStart;
 
-      CDateTime minStart = m_database->GetMinStartTime(m_iEpgID, maxEventStart);
+      CDateTime minStart = GetMinStartTime(maxEventStart);
       if (!minStart.IsValid() || minStart > timelineEnd)
         minStart = timelineEnd;
 
@@ -536,7 +552,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
       if (result.front()->StartAsUTC() > minEventEnd)
       {
         // prepend gap tag
-        CDateTime maxEnd = m_database->GetMaxEndTime(m_iEpgID, minEventEnd);
+        CDateTime maxEnd = GetMaxEndTime(minEventEnd);
         if (!maxEnd.IsValid() || maxEnd < timelineStart)
           maxEnd = timelineStart;
 
@@ -546,7 +562,7 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
       if (result.back()->EndAsUTC() < maxEventStart)
       {
         // append gap tag
-        CDateTime minStart = m_database->GetMinStartTime(m_iEpgID, maxEventStart);
+        CDateTime minStart = GetMinStartTime(maxEventStart);
         if (!minStart.IsValid() || minStart > timelineEnd)
           minStart = timelineEnd;
 
@@ -560,6 +576,89 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTimeline(
   return {};
 }
 
+const CPVREpgTagsContainer::TimeIndex* CPVREpgTagsContainer::GetTimeIndex() const
+{
+  if (!m_database)
+    return nullptr;
+
+  if (!m_timeIndex.m_loaded)
+  {
+    m_timeIndex.m_loaded = true;
+    m_timeIndex.m_valid =
+        m_database->GetEpgTagTimes(m_iEpgID, m_timeIndex.m_starts, m_timeIndex.m_ends);
+  }
+
+  return m_timeIndex.m_valid ? &m_timeIndex : nullptr;
+}
+
+void CPVREpgTagsContainer::InvalidateTimeIndex()
+{
+  m_timeIndex = {};
+}
+
+bool CPVREpgTagsContainer::HasCommittedTags(const CDateTime& minEventEnd,
+                                            const CDateTime& maxEventStart) const
+{
+  const TimeIndex* index = GetTimeIndex();
+  if (!index || minEventEnd > maxEventStart)
+    return true;
+
+  time_t minEnd;
+  minEventEnd.GetAsTime(minEnd);
+  time_t maxStart;
+  maxEventStart.GetAsTime(maxStart);
+
+  // every tag ending before minEnd also starts before maxStart, so the difference is the number of
+  // tags in the range
+  const auto startedBefore = std::ranges::upper_bound(index->m_starts, maxStart);
+  const auto endedBefore = std::ranges::lower_bound(index->m_ends, minEnd);
+  return (startedBefore - index->m_starts.cbegin()) > (endedBefore - index->m_ends.cbegin());
+}
+
+CDateTime CPVREpgTagsContainer::GetLastEndTime() const
+{
+  const TimeIndex* index = GetTimeIndex();
+  if (!index)
+    return m_database->GetLastEndTime(m_iEpgID);
+
+  if (index->m_ends.empty())
+    return {};
+
+  return CDateTime(index->m_ends.back());
+}
+
+CDateTime CPVREpgTagsContainer::GetMaxEndTime(const CDateTime& maxEnd) const
+{
+  const TimeIndex* index = GetTimeIndex();
+  if (!index)
+    return m_database->GetMaxEndTime(m_iEpgID, maxEnd);
+
+  time_t t;
+  maxEnd.GetAsTime(t);
+
+  const auto it = std::ranges::upper_bound(index->m_ends, t);
+  if (it == index->m_ends.cbegin())
+    return {};
+
+  return CDateTime(*std::prev(it));
+}
+
+CDateTime CPVREpgTagsContainer::GetMinStartTime(const CDateTime& minStart) const
+{
+  const TimeIndex* index = GetTimeIndex();
+  if (!index)
+    return m_database->GetMinStartTime(m_iEpgID, minStart);
+
+  time_t t;
+  minStart.GetAsTime(t);
+
+  const auto it = std::ranges::upper_bound(index->m_starts, t);
+  if (it == index->m_starts.cend())
+    return {};
+
+  return CDateTime(*it);
+}
+
 std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetAllTags() const
 {
   if (m_database)
@@ -592,6 +691,48 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetAllTags()
   return {};
 }
 
+std::vector<std::shared_ptr<CPVREpgInfoTag>> CPVREpgTagsContainer::GetTagsEndingAfter(
+    const CDateTime& minEventEnd) const
+{
+  if (m_database)
+  {
+    std::vector<std::shared_ptr<CPVREpgInfoTag>> tags;
+    if (!m_changedTags.empty() && !m_database->HasTags(m_iEpgID))
+    {
+      // nothing in the db yet. take what we have in memory.
+      for (const auto& [_, tag] : m_changedTags)
+      {
+        if (tag->EndAsUTC() >= minEventEnd)
+          tags.emplace_back(tag);
+      }
+
+      FixOverlappingEvents(tags);
+    }
+    else
+    {
+      // no committed event starts after the last one ends, read the db only from minEventEnd on
+      // instead of all the past days kept in it
+      const CDateTime lastEnd = GetLastEndTime();
+      if (lastEnd.IsValid() && lastEnd >= minEventEnd)
+        tags = m_database->GetEpgTagsByMinEndMaxStartTime(m_iEpgID, minEventEnd, lastEnd);
+
+      if (!m_changedTags.empty())
+      {
+        // Fix data inconsistencies
+        for (const auto& [_, tag] : m_changedTags)
+        {
+          if (tag->EndAsUTC() >= minEventEnd)
+            ResolveConflictingTags(tag, tags);
+        }
+      }
+    }
+
+    return CreateEntries(tags);
+  }
+
+  return {};
+}
+
 std::pair<CDateTime, CDateTime> CPVREpgTagsContainer::GetFirstAndLastUncommittedEPGDate() const
 {
   if (m_changedTags.empty())
@@ -615,21 +756,22 @@ void CPVREpgTagsContainer::QueuePersistQuery()
     CLog::LogFC(LOGDEBUG, LOGEPG, "EPG Tags Container: Updating {}, deleting {} events...",
                 m_changedTags.size(), m_deletedTags.size());
 
+    std::vector<std::shared_ptr<CPVREpgInfoTag>> deletedTags;
+    deletedTags.reserve(m_deletedTags.size());
     for (const auto& [_, tag] : m_deletedTags)
-      m_database->QueueDeleteTagQuery(*tag);
+      deletedTags.emplace_back(tag);
 
     m_deletedTags.clear();
 
     FixOverlappingEvents(m_changedTags);
 
+    // any conflicting events are removed from database before persisting the new events
+    std::vector<std::shared_ptr<CPVREpgInfoTag>> changedTags;
+    changedTags.reserve(m_changedTags.size());
     for (const auto& [_, tag] : m_changedTags)
-    {
-      // remove any conflicting events from database before persisting the new event
-      m_database->QueueDeleteEpgTagsByMinEndMaxStartTimeQuery(
-          m_iEpgID, tag->StartAsUTC() + ONE_SECOND, tag->EndAsUTC() - ONE_SECOND);
+      changedTags.emplace_back(tag);
 
-      tag->QueuePersistQuery(m_database);
-    }
+    m_database->QueuePersistTagsQuery(m_iEpgID, changedTags, deletedTags);
 
     Clear();
 
@@ -152,6 +152,14 @@ public:
    */
   std::vector<std::shared_ptr<CPVREpgInfoTag>> GetAllTags() const;
 
+  /*!
+   * @brief Get the EPG tags not ended before the given time.
+   * @param minEventEnd The minimum end time of the events to return
+   * @return The tags.
+   */
+  std::vector<std::shared_ptr<CPVREpgInfoTag>> GetTagsEndingAfter(
+      const CDateTime& minEventEnd) const;
+
   /*!
    * @brief Get the start and end time of the last not yet committed entry in this EPG.
    * @return The times; first: start time, second: end time.
@@ -215,6 +223,38 @@ private:
   void FixOverlappingEvents(std::vector<std::shared_ptr<CPVREpgInfoTag>>& tags) const;
   void FixOverlappingEvents(std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>>& tags) const;
 
+  /*!
+   * @brief Start and end times of the committed tags, each sorted ascending. Lets the timeline
+   * answer its range and gap lookups without a database query for every grid block.
+   */
+  struct TimeIndex
+  {
+    bool m_loaded = false;
+    bool m_valid = false;
+    std::vector<time_t> m_starts;
+    std::vector<time_t> m_ends;
+  };
+
+  /*!
+   * @brief Get the time index, loading it from the database if needed.
+   * @return The index, or nullptr if it could not be loaded.
+   */
+  const TimeIndex* GetTimeIndex() const;
+
+  /*!
+   * @brief Drop the time index, the database content is about to change.
+   */
+  void InvalidateTimeIndex();
+
+  /*!
+   * @brief Check whether the database has tags with an end time not before minEventEnd and a start
+   * time not after maxEventStart.
+   */
+  bool HasCommittedTags(const CDateTime& minEventEnd, const CDateTime& maxEventStart) const;
+  CDateTime GetLastEndTime() const;
+  CDateTime GetMaxEndTime(const CDateTime& maxEnd) const;
+  CDateTime GetMinStartTime(const CDateTime& minStart) const;
+
   int m_iEpgID = 0;
   std::shared_ptr<CPVREpgChannelData> m_channelData;
   const std::shared_ptr<CPVREpgDatabase> m_database;
@@ -222,6 +262,7 @@ private:
 
   std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>> m_changedTags;
   std::map<CDateTime, std::shared_ptr<CPVREpgInfoTag>> m_deletedTags;
+  mutable TimeIndex m_timeIndex;
 };
 
 } // namespace PVR
@@ -190,7 +190,7 @@ void CPVRRecording::Serialize(CVariant& value) const
   value["epgeventid"] = m_iEpgEventId;
   value["channeluid"] = m_iChannelUid;
   value["radio"] = m_bRadio;
-  value["genre"] = m_genre;
+  value["genre"] = m_genre.Get();
   value["parentalrating"] = m_parentalRating;
   value["parentalratingcode"] = m_parentalRatingCode;
   value["parentalratingicon"] = ClientParentalRatingIconPath();
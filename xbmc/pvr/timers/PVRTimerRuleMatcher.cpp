@@ -12,10 +12,13 @@
 #include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/pvr/pvr_channels.h" // PVR_CHANNEL_INVALID_UID
 #include "pvr/PVRConstants.h" // PVR_CLIENT_INVALID_UID
 #include "pvr/epg/EpgInfoTag.h"
+#include "pvr/epg/EpgSearchData.h"
 #include "pvr/timers/PVRTimerInfoTag.h"
 #include "utils/RegExp.h"
 
+#include <algorithm>
 #include <memory>
+#include <string_view>
 
 using namespace PVR;
 
@@ -80,6 +83,33 @@ bool CPVRTimerRuleMatcher::Matches(const std::shared_ptr<const CPVREpgInfoTag>&
          MatchSearchText(epgTag);
 }
 
+std::optional<PVREpgSearchData> CPVRTimerRuleMatcher::GetEpgSearchData() const
+{
+  const std::shared_ptr<const CPVRTimerType> type = m_timerRule->GetTimerType();
+  const bool fullText = type->SupportsEpgFulltextMatch() && m_timerRule->IsFullTextEpgSearch();
+  if (!fullText && !type->SupportsEpgTitleMatch())
+    return {};
+
+  // plain ascii text without regex syntax matches like the case insensitive search of the EPG
+  // database. quotes would end the search phrase.
+  static constexpr std::string_view SPECIAL_CHARS = "\\^$.|?*+()[]{}\"";
+  const std::string& searchString = m_timerRule->EpgSearchString();
+  if (searchString.empty() ||
+      std::ranges::any_of(searchString,
+                          [](char c) {
+                            return static_cast<unsigned char>(c) >= 0x80 ||
+                                   SPECIAL_CHARS.find(c) != std::string_view::npos;
+                          }))
+    return {};
+
+  PVREpgSearchData searchData;
+  searchData.Reset();
+  searchData.m_strSearchTerm = "\"" + searchString + "\"";
+  searchData.m_bSearchInDescription = fullText;
+  searchData.m_bSearchInEpisodeName = fullText;
+  return searchData;
+}
+
 bool CPVRTimerRuleMatcher::MatchSeriesLink(
     const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const
 {
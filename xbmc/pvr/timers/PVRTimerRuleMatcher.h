@@ -11,11 +11,13 @@
 #include "XBDateTime.h"
 
 #include <memory>
+#include <optional>
 
 class CRegExp;
 
 namespace PVR
 {
+struct PVREpgSearchData;
 class CPVRChannel;
 class CPVRTimerInfoTag;
 class CPVREpgInfoTag;
@@ -30,8 +32,21 @@ public:
 
   std::shared_ptr<const CPVRChannel> GetChannel() const;
   CDateTime GetNextTimerStart() const;
+
+  /*!
+   * @brief Get the time from which on EPG tags can match, tags ended before can be skipped.
+   * @return The time (UTC).
+   */
+  CDateTime GetMatchStart() const { return m_start.GetAsUTCDateTime(); }
   bool Matches(const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const;
 
+  /*!
+   * @brief Get an EPG search that finds at least all tags matching the rule's search text.
+   * @return The search, or std::nullopt if the search text is a regular expression the EPG search
+   * cannot express.
+   */
+  std::optional<PVREpgSearchData> GetEpgSearchData() const;
+
 private:
   bool MatchSeriesLink(const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const;
   bool MatchChannel(const std::shared_ptr<const CPVREpgInfoTag>& epgTag) const;
@@ -20,6 +20,7 @@
 #include "pvr/epg/Epg.h"
 #include "pvr/epg/EpgContainer.h"
 #include "pvr/epg/EpgInfoTag.h"
+#include "pvr/epg/EpgSearchData.h"
 #include "pvr/settings/PVRSettings.h"
 #include "pvr/timers/PVRTimerInfoTag.h"
 #include "pvr/timers/PVRTimerRuleMatcher.h"
@@ -31,6 +32,7 @@
 #include <memory>
 #include <mutex>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -445,6 +447,17 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> GetEpgTagsForTimerRule(
 {
   std::vector<std::shared_ptr<CPVREpgInfoTag>> matches;
 
+  const std::optional<PVREpgSearchData> searchData = matcher.GetEpgSearchData();
+  if (searchData)
+  {
+    // let the search index of the epg database preselect the candidates
+    const std::vector<std::shared_ptr<CPVREpgInfoTag>> tags =
+        CServiceBroker::GetPVRManager().EpgContainer().GetTags(*searchData);
+    std::ranges::copy_if(tags, std::back_inserter(matches),
+                         [&matcher](const auto& tag) { return matcher.Matches(tag); });
+    return matches;
+  }
+
   const std::shared_ptr<const CPVRChannel> channel = matcher.GetChannel();
   if (channel)
   {
@@ -452,7 +465,8 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> GetEpgTagsForTimerRule(
     const std::shared_ptr<const CPVREpg> epg = channel->GetEPG();
     if (epg)
     {
-      const std::vector<std::shared_ptr<CPVREpgInfoTag>> tags = epg->GetTags();
+      const std::vector<std::shared_ptr<CPVREpgInfoTag>> tags =
+          epg->GetTagsEndingAfter(matcher.GetMatchStart());
       std::ranges::copy_if(tags, std::back_inserter(matches),
                            [&matcher](const auto& tag) { return matcher.Matches(tag); });
     }
@@ -465,7 +479,8 @@ std::vector<std::shared_ptr<CPVREpgInfoTag>> GetEpgTagsForTimerRule(
 
     for (const auto& epg : epgs)
     {
-      const std::vector<std::shared_ptr<CPVREpgInfoTag>> tags = epg->GetTags();
+      const std::vector<std::shared_ptr<CPVREpgInfoTag>> tags =
+          epg->GetTagsEndingAfter(matcher.GetMatchStart());
       std::ranges::copy_if(tags, std::back_inserter(matches),
                            [&matcher](const auto& tag) { return matcher.Matches(tag); });
     }
@@ -478,8 +493,17 @@ void AddTimerRuleToEpgMap(
     const std::shared_ptr<CPVRTimerInfoTag>& timer,
     const CDateTime& now,
     std::map<std::shared_ptr<CPVREpg>, std::vector<std::shared_ptr<CPVRTimerRuleMatcher>>>& epgMap,
+    std::vector<std::shared_ptr<CPVRTimerRuleMatcher>>& searchMatchers,
     bool& bFetchedAllEpgs)
 {
+  auto searchMatcher{std::make_shared<CPVRTimerRuleMatcher>(timer, now)};
+  if (searchMatcher->GetEpgSearchData())
+  {
+    // matched against the results of an epg search instead of all tags
+    searchMatchers.emplace_back(searchMatcher);
+    return;
+  }
+
   const std::shared_ptr<const CPVRChannel> channel = timer->Channel();
   if (channel)
   {
@@ -533,6 +557,7 @@ bool CPVRTimers::UpdateEntries(int iMaxNotificationDelay)
   const CDateTime now = CDateTime::GetUTCDateTime();
   bool bFetchedAllEpgs = false;
   std::map<std::shared_ptr<CPVREpg>, std::vector<std::shared_ptr<CPVRTimerRuleMatcher>>> epgMap;
+  std::vector<std::shared_ptr<CPVRTimerRuleMatcher>> searchMatchers;
 
   std::unique_lock lock(m_critSection);
 
@@ -644,7 +669,7 @@ bool CPVRTimers::UpdateEntries(int iMaxNotificationDelay)
           if (timer->IsEpgBased())
           {
             if (m_bReminderRulesUpdatePending)
-              AddTimerRuleToEpgMap(timer, now, epgMap, bFetchedAllEpgs);
+              AddTimerRuleToEpgMap(timer, now, epgMap, searchMatchers, bFetchedAllEpgs);
           }
           else
           {
@@ -709,7 +734,8 @@ bool CPVRTimers::UpdateEntries(int iMaxNotificationDelay)
   // create new children of local epg-based reminder timer rules
   for (const auto& [epg, matchers] : epgMap)
   {
-    const auto epgTags{epg->GetTags()};
+    // ended tags never match, don't read the past days of the epg
+    const auto epgTags{epg->GetTagsEndingAfter(now)};
     for (const auto& epgTag : epgTags)
     {
       if (GetTimerForEpgTag(epgTag))
@@ -732,6 +758,24 @@ bool CPVRTimers::UpdateEntries(int iMaxNotificationDelay)
     }
   }
 
+  for (const auto& matcher : searchMatchers)
+  {
+    for (const auto& epgTag : GetEpgTagsForTimerRule(*matcher))
+    {
+      if (GetTimerForEpgTag(epgTag))
+        continue;
+
+      const std::shared_ptr<CPVRTimerInfoTag> childTimer =
+          CPVRTimerInfoTag::CreateReminderFromEpg(epgTag, matcher->GetTimerRule());
+      if (childTimer)
+      {
+        // remember and insert/save later
+        bChanged = true;
+        childTimersToInsert.emplace_back(childTimer, matcher->GetTimerRule());
+      }
+    }
+  }
+
   // persist and insert/update new children of local time-based and epg-based reminder timer rules
   for (const auto& [child, parent] : childTimersToInsert)
   {
@@ -20,6 +20,7 @@
 #include <memory>
 
 unsigned int CRenderSystemBase::m_GUIElementCount = 0;
+unsigned int CRenderSystemBase::m_lastGUIElementCount = 0;
 
 CRenderSystemBase::CRenderSystemBase()
 {
@@ -41,6 +42,7 @@ void CRenderSystemBase::OnAdvancedSettingsLoaded()
   m_guiFrontToBackRendering = advSettings->m_guiFrontToBackRendering;
   m_guiGeometryClear =
       advSettings->m_guiGeometryClear ? ClearFunction::GEOMETRY : ClearFunction::FIXED_FUNCTION;
+  m_guiRenderScale = advSettings->m_guiRenderScale;
 }
 
 CRenderSystemBase::~CRenderSystemBase()
@@ -153,3 +155,9 @@ ClearFunction CRenderSystemBase::GetClearFunction()
   std::unique_lock lock(m_settingsSection);
   return m_guiGeometryClear;
 }
+
+float CRenderSystemBase::GetGUIRenderScale()
+{
+  std::unique_lock lock(m_settingsSection);
+  return m_guiRenderScale;
+}
@@ -48,8 +48,12 @@ public:
   // Number of GUI elements (textures, text, overlays) drawn this frame; reset
   // in BeginRender, bumped at each GUI draw primitive. Render-thread only.
   static unsigned int m_GUIElementCount;
+  // Number of GUI elements drawn in the previous frame, kept for the debug overlay which is
+  // drawn before the current frame is complete.
+  static unsigned int m_lastGUIElementCount;
 
   unsigned int GetGUIElementCount() const { return m_GUIElementCount; }
+  unsigned int GetLastGUIElementCount() const { return m_lastGUIElementCount; }
 
   virtual bool InitRenderSystem() = 0;
   virtual bool DestroyRenderSystem() = 0;
@@ -73,6 +77,20 @@ public:
 
   virtual void SetDepthCulling(DepthCulling culling) {}
 
+  /*!
+   * \brief Render the GUI into an offscreen target smaller than the output, as set by the
+   *        renderscale advanced setting. EndGUIRenderScale() upscales it to the output.
+   * \param newTarget [out] true if the target holds nothing of the previous frame, so the whole
+   *        GUI has to be rendered
+   * \return true if the GUI is rendered into the scaled target
+   */
+  virtual bool BeginGUIRenderScale(bool& newTarget) { return false; }
+  /*!
+   * \brief Stop rendering into the scaled target.
+   * \param rendered true if the GUI was rendered this frame, so the target is upscaled to the output
+   */
+  virtual void EndGUIRenderScale(bool rendered) {}
+
   virtual void CaptureStateBlock() = 0;
   virtual void ApplyStateBlock() = 0;
 
@@ -97,6 +115,10 @@ public:
   virtual bool SupportsNPOT(bool dxt) const;
   virtual bool SupportsStereo(RenderStereoMode mode) const;
   unsigned int GetMaxTextureSize() const { return m_maxTextureSize; }
+  /*!
+   * \brief Whether the font shaders expect signed distance field glyphs.
+   */
+  bool UseSDFFonts() const { return m_sdfFonts; }
   unsigned int GetMinDXTPitch() const { return m_minDXTPitch; }
 
   virtual void ShowSplash(const std::string& message);
@@ -108,6 +130,7 @@ public:
   virtual void OnAdvancedSettingsLoaded();
   virtual bool GetEnabledFrontToBackRendering();
   virtual ClearFunction GetClearFunction();
+  float GetGUIRenderScale();
   virtual bool GetShowSplashImage();
 
 protected:
@@ -125,6 +148,7 @@ protected:
   RenderStereoMode m_stereoMode{RenderStereoMode::OFF};
   bool m_limitedColorRange{false};
   bool m_transferPQ{false};
+  bool m_sdfFonts{false};
 
   std::unique_ptr<CGUIImage> m_splashImage;
   std::unique_ptr<CGUITextLayout> m_splashMessageLayout;
@@ -134,5 +158,6 @@ protected:
   std::optional<int> m_settingsCallbackHandle;
   bool m_guiFrontToBackRendering{false};
   ClearFunction m_guiGeometryClear{ClearFunction::FIXED_FUNCTION};
+  float m_guiRenderScale{1.0f};
   bool m_showSplashImage{true};
 };
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "GLShader.h"
+#include "cores/VideoPlayer/VideoRenderers/FrameBufferObject.h"
 #include "rendering/RenderSystem.h"
 #include "utils/ColorUtils.h"
 #include "utils/Map.h"
@@ -92,6 +93,9 @@ public:
 
   void SetDepthCulling(DepthCulling culling) override;
 
+  bool BeginGUIRenderScale(bool& newTarget) override;
+  void EndGUIRenderScale(bool rendered) override;
+
   void CaptureStateBlock() override;
   void ApplyStateBlock() override;
 
@@ -130,6 +134,7 @@ protected:
   void CalculateMaxTexturesize();
   void InitialiseShaders();
   void ReleaseShaders();
+  void GetTargetViewPort(GLint (&viewPort)[4]) const;
 
   bool m_bVsyncInit = false;
   int m_width;
@@ -145,4 +150,14 @@ protected:
   std::map<ShaderMethodGL, std::unique_ptr<CGLShader>> m_pShader;
   ShaderMethodGL m_method = ShaderMethodGL::SM_DEFAULT;
   GLuint m_vertexArray = GL_NONE;
+
+  // offscreen target of the GUI when it is rendered below the output resolution
+  CFrameBufferObject m_guiScaleTarget;
+  int m_guiScaleWidth = 0;
+  int m_guiScaleHeight = 0;
+  GLint m_guiScaleOutput = 0;
+  float m_guiScaleX = 1.0f;
+  float m_guiScaleY = 1.0f;
+  bool m_guiScaleUsed = false;
+  bool m_guiScaleUsedLastFrame = false;
 };
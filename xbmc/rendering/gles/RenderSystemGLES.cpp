@@ -27,6 +27,8 @@
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
+
 #if defined(TARGET_LINUX)
 #include "utils/EGLUtils.h"
 #endif
@@ -165,6 +167,10 @@ bool CRenderSystemGLES::DestroyRenderSystem()
   glFinish();
   PresentRenderImpl(true);
 
+  m_guiScaleTarget.Cleanup();
+  m_guiScaleWidth = 0;
+  m_guiScaleHeight = 0;
+
   ReleaseShaders();
   m_bRenderCreated = false;
 
@@ -176,8 +182,12 @@ bool CRenderSystemGLES::BeginRender()
   if (!m_bRenderCreated)
     return false;
 
+  m_lastGUIElementCount = m_GUIElementCount;
   m_GUIElementCount = 0;
 
+  m_guiScaleUsedLastFrame = m_guiScaleUsed;
+  m_guiScaleUsed = false;
+
   const bool useLimited = CServiceBroker::GetWinSystem()->UseLimitedColor() &&
                           !CServiceBroker::GetWinSystem()->IsHdrComposite();
   const bool usePQ = CServiceBroker::GetWinSystem()->GetGfxContext().IsTransferPQ();
@@ -378,12 +388,15 @@ void CRenderSystemGLES::SetViewPort(const CRect& viewPort)
   if (!m_bRenderCreated)
     return;
 
-  glScissor((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
-  glViewport((GLint) viewPort.x1, (GLint) (m_height - viewPort.y1 - viewPort.Height()), (GLsizei) viewPort.Width(), (GLsizei) viewPort.Height());
   m_viewPort[0] = viewPort.x1;
   m_viewPort[1] = m_height - viewPort.y1 - viewPort.Height();
   m_viewPort[2] = viewPort.Width();
   m_viewPort[3] = viewPort.Height();
+
+  GLint target[4];
+  GetTargetViewPort(target);
+  glScissor(target[0], target[1], target[2], target[3]);
+  glViewport(target[0], target[1], target[2], target[3]);
 }
 
 bool CRenderSystemGLES::ScissorsCanEffectClipping()
@@ -412,11 +425,11 @@ void CRenderSystemGLES::SetScissors(const CRect &rect)
 {
   if (!m_bRenderCreated)
     return;
-  GLint x1 = MathUtils::round_int(static_cast<double>(rect.x1));
-  GLint y1 = MathUtils::round_int(static_cast<double>(rect.y1));
-  GLint x2 = MathUtils::round_int(static_cast<double>(rect.x2));
-  GLint y2 = MathUtils::round_int(static_cast<double>(rect.y2));
-  glScissor(x1, m_height - y2, x2-x1, y2-y1);
+  GLint x1 = MathUtils::round_int(static_cast<double>(rect.x1 * m_guiScaleX));
+  GLint y1 = MathUtils::round_int(static_cast<double>((m_height - rect.y2) * m_guiScaleY));
+  GLint x2 = MathUtils::round_int(static_cast<double>(rect.x2 * m_guiScaleX));
+  GLint y2 = MathUtils::round_int(static_cast<double>((m_height - rect.y1) * m_guiScaleY));
+  glScissor(x1, y1, x2 - x1, y2 - y1);
 }
 
 void CRenderSystemGLES::ResetScissors()
@@ -424,6 +437,90 @@ void CRenderSystemGLES::ResetScissors()
   SetScissors(CRect(0, 0, (float)m_width, (float)m_height));
 }
 
+bool CRenderSystemGLES::BeginGUIRenderScale(bool& newTarget)
+{
+#if HAS_GLES < 3
+  return false;
+#else
+  const float scale = GetGUIRenderScale();
+  if (!m_bRenderCreated || scale >= 1.0f || m_RenderVersionMajor < 3)
+    return false;
+
+  const int width = std::max(1, static_cast<int>(m_width * scale));
+  const int height = std::max(1, static_cast<int>(m_height * scale));
+
+  newTarget = !m_guiScaleUsedLastFrame;
+  if (m_guiScaleWidth != width || m_guiScaleHeight != height)
+  {
+    // only retried once the size changes, in case the target can't be created
+    m_guiScaleWidth = width;
+    m_guiScaleHeight = height;
+    m_guiScaleTarget.Cleanup();
+    if (!m_guiScaleTarget.Initialize() ||
+        !m_guiScaleTarget.CreateAndBindToTexture(GL_TEXTURE_2D, width, height, GL_RGBA,
+                                                 GL_UNSIGNED_BYTE, GL_LINEAR) ||
+        (GetEnabledFrontToBackRendering() && !m_guiScaleTarget.AttachDepthBuffer(width, height)))
+    {
+      CLog::Log(LOGERROR, "CRenderSystemGLES: failed to create the {}x{} GUI render target", width, height);
+      m_guiScaleTarget.Cleanup();
+      return false;
+    }
+    CLog::Log(LOGDEBUG, "CRenderSystemGLES: rendering the GUI at {}x{}", width, height);
+    newTarget = true;
+  }
+
+  if (!m_guiScaleTarget.IsValid())
+    return false;
+
+  glGetIntegerv(GL_FRAMEBUFFER_BINDING, &m_guiScaleOutput);
+  if (!m_guiScaleTarget.BeginRender())
+    return false;
+
+  m_guiScaleX = static_cast<float>(width) / m_width;
+  m_guiScaleY = static_cast<float>(height) / m_height;
+  m_guiScaleUsed = true;
+
+  GLint viewPort[4];
+  GetTargetViewPort(viewPort);
+  glViewport(viewPort[0], viewPort[1], viewPort[2], viewPort[3]);
+  ResetScissors();
+  return true;
+#endif
+}
+
+void CRenderSystemGLES::EndGUIRenderScale(bool rendered)
+{
+#if HAS_GLES >= 3
+  glBindFramebuffer(GL_FRAMEBUFFER, m_guiScaleOutput);
+  m_guiScaleX = 1.0f;
+  m_guiScaleY = 1.0f;
+
+  GLint viewPort[4];
+  GetTargetViewPort(viewPort);
+  glViewport(viewPort[0], viewPort[1], viewPort[2], viewPort[3]);
+  ResetScissors();
+
+  if (!rendered)
+    return;
+
+  // bilinear upscale, which also keeps the alpha of the GUI over a separate video plane
+  glDisable(GL_SCISSOR_TEST);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, m_guiScaleTarget.Framebuffer());
+  glBlitFramebuffer(0, 0, m_guiScaleWidth, m_guiScaleHeight, 0, 0, m_width, m_height,
+                    GL_COLOR_BUFFER_BIT, GL_LINEAR);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, m_guiScaleOutput);
+  glEnable(GL_SCISSOR_TEST);
+#endif
+}
+
+void CRenderSystemGLES::GetTargetViewPort(GLint (&viewPort)[4]) const
+{
+  viewPort[0] = MathUtils::round_int(static_cast<double>(m_viewPort[0] * m_guiScaleX));
+  viewPort[1] = MathUtils::round_int(static_cast<double>(m_viewPort[1] * m_guiScaleY));
+  viewPort[2] = MathUtils::round_int(static_cast<double>(m_viewPort[2] * m_guiScaleX));
+  viewPort[3] = MathUtils::round_int(static_cast<double>(m_viewPort[3] * m_guiScaleY));
+}
+
 void CRenderSystemGLES::SetDepthCulling(DepthCulling culling)
 {
   if (culling == DepthCulling::OFF)
@@ -505,8 +602,15 @@ void CRenderSystemGLES::InitialiseShaders()
     CLog::Log(LOGERROR, "GUI Shader gles_shader_multi_rgba_111r.frag - compile and link failed");
   }
 
-  m_pShader[ShaderMethodGLES::SM_FONTS] =
-      std::make_unique<CGLESShader>("gles_shader_simple.vert", "gles_shader_fonts.frag", defines);
+  // the SDF font shader needs fwidth(), which GLSL ES 1.00 only has as an extension
+  std::string fontDefines = defines;
+  m_sdfFonts = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_guiFontSDF &&
+               IsExtSupported("GL_OES_standard_derivatives");
+  if (m_sdfFonts)
+    fontDefines += "#define KODI_FONT_SDF 1\n";
+
+  m_pShader[ShaderMethodGLES::SM_FONTS] = std::make_unique<CGLESShader>(
+      "gles_shader_simple.vert", "gles_shader_fonts.frag", fontDefines);
   if (!m_pShader[ShaderMethodGLES::SM_FONTS]->CompileAndLink())
   {
     m_pShader[ShaderMethodGLES::SM_FONTS]->Free();
@@ -515,7 +619,7 @@ void CRenderSystemGLES::InitialiseShaders()
   }
 
   m_pShader[ShaderMethodGLES::SM_FONTS_SHADER_CLIP] =
-      std::make_unique<CGLESShader>("gles_shader_clip.vert", "gles_shader_fonts.frag", defines);
+      std::make_unique<CGLESShader>("gles_shader_clip.vert", "gles_shader_fonts.frag", fontDefines);
   if (!m_pShader[ShaderMethodGLES::SM_FONTS_SHADER_CLIP]->CompileAndLink())
   {
     m_pShader[ShaderMethodGLES::SM_FONTS_SHADER_CLIP]->Free();
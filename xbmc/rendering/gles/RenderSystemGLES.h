@@ -9,6 +9,7 @@
 #pragma once
 
 #include "GLESShader.h"
+#include "cores/VideoPlayer/VideoRenderers/FrameBufferObject.h"
 #include "rendering/RenderSystem.h"
 #include "utils/ColorUtils.h"
 #include "utils/Map.h"
@@ -112,6 +113,9 @@ public:
 
   void SetDepthCulling(DepthCulling culling) override;
 
+  bool BeginGUIRenderScale(bool& newTarget) override;
+  void EndGUIRenderScale(bool rendered) override;
+
   void CaptureStateBlock() override;
   void ApplyStateBlock() override;
 
@@ -149,6 +153,7 @@ protected:
   virtual void SetVSyncImpl(bool enable) = 0;
   virtual void PresentRenderImpl(bool rendered) = 0;
   void CalculateMaxTexturesize();
+  void GetTargetViewPort(GLint (&viewPort)[4]) const;
 
   bool m_bVsyncInit{false};
   int m_width;
@@ -160,4 +165,14 @@ protected:
   ShaderMethodGLES m_method = ShaderMethodGLES::SM_DEFAULT;
 
   GLint      m_viewPort[4];
+
+  // offscreen target of the GUI when it is rendered below the output resolution
+  CFrameBufferObject m_guiScaleTarget;
+  int m_guiScaleWidth{0};
+  int m_guiScaleHeight{0};
+  GLint m_guiScaleOutput{0};
+  float m_guiScaleX{1.0f};
+  float m_guiScaleY{1.0f};
+  bool m_guiScaleUsed{false};
+  bool m_guiScaleUsedLastFrame{false};
 };
@@ -227,6 +227,12 @@ void CAdvancedSettings::Initialize()
   m_videoFpsDetect = 1;
   m_maxTempo = 1.55f;
   m_videoPreferStereoStream = false;
+  m_videoZeroCopyPackets = true;
+  m_videoFastStart = true;
+  m_videoSeekPreviewInterval = 10;
+  m_videoSinglePassScaling = true;
+  m_videoToneMapLUT = true;
+  m_videoKeepCodecOnChannelSwitch = true;
 
   m_videoDefaultLatency = 0.0;
   m_videoDefaultHdrExtraLatency = 0.0;
@@ -369,6 +375,9 @@ void CAdvancedSettings::Initialize()
   m_imageRes = 720;
   m_imageScalingAlgorithm = CPictureScalingAlgorithm::Default;
   m_imageQualityJpeg = 4;
+  m_imageCacheRaw = false;
+  m_imageCacheMaxSize = 0;
+  m_imageHardwareDecode = false;
 
   m_sambaclienttimeout = 30;
   m_sambadoscodepage = "";
@@ -399,6 +408,8 @@ void CAdvancedSettings::Initialize()
   m_iVideoLibraryRecentlyAddedItems = 25;
   m_bVideoLibraryCleanOnUpdate = false;
   m_bVideoLibraryUseFastHash = true;
+  m_videoLibraryFastHashJobs = 4;
+  m_videoLibraryResultCacheAge = 120;
   m_bVideoScannerIgnoreErrors = false;
   m_metadataSourcesPriv = "tmdb|imdb|tvdb|anidb|";
   m_iVideoLibraryDateAdded = 1; // prefer mtime over ctime and current time
@@ -446,6 +457,7 @@ void CAdvancedSettings::Initialize()
   m_curlconnecttimeout = 30;
   m_curllowspeedtime = 20;
   m_curlretries = 2;
+  m_scraperHttpCacheTime = 24 * 60 * 60;
   m_curlKeepAliveInterval = 30;
   m_curlDisableIPV6 = false;      //Certain hardware/OS combinations have trouble
                                   //with ipv6.
@@ -490,6 +502,7 @@ void CAdvancedSettings::Initialize()
   m_iPVRNumericChannelSwitchTimeout = 2000;
   m_iPVRTimeshiftThreshold = 10;
   m_bPVRTimeshiftSimpleOSD = true;
+  m_iPVRTimeshiftBufferSize = 1024;
   m_PVRDefaultSortOrder.sortBy = SortBy::DATE;
   m_PVRDefaultSortOrder.sortOrder = SortOrder::DESCENDING;
 
@@ -531,6 +544,8 @@ void CAdvancedSettings::Initialize()
   m_stereoscopicregex_tab = "[-. _]h?tab[-. _]";
 
   m_logLevelHint = m_logLevel = LOG_LEVEL_NORMAL;
+  m_logAsync = false;
+  m_logRateLimit = 0;
 
   m_openGlDebugging = false;
 
@@ -538,6 +553,11 @@ void CAdvancedSettings::Initialize()
 
   m_nfsTimeout = 30;
   m_nfsRetries = -1;
+  m_cacheReadAheadDepth = 4;
+  m_cacheMapLocalFiles = false;
+  m_cacheRangeConnections = 0;
+  m_cacheAdaptiveSize = true;
+  m_dirCachePersistent = false;
 
   m_initialized = true;
 }
@@ -826,6 +846,16 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "fpsdetect", m_videoFpsDetect, 0, 2);
     XMLUtils::GetFloat(pElement, "maxtempo", m_maxTempo, 1.5, 2.0);
     XMLUtils::GetBoolean(pElement, "preferstereostream", m_videoPreferStereoStream);
+    XMLUtils::GetBoolean(pElement, "zerocopypackets", m_videoZeroCopyPackets);
+    XMLUtils::GetBoolean(pElement, "faststart", m_videoFastStart);
+    // seconds between two seek preview frames, 0 = no previews
+    XMLUtils::GetInt(pElement, "seekpreviewinterval", m_videoSeekPreviewInterval, 0, 600);
+    // scale lanczos3 and spline36 while converting from yuv, without an intermediate fbo
+    XMLUtils::GetBoolean(pElement, "singlepassscaling", m_videoSinglePassScaling);
+    // tone map hdr from a cached 3d lut instead of evaluating the curves for every pixel
+    XMLUtils::GetBoolean(pElement, "tonemaplut", m_videoToneMapLUT);
+    // keep the video decoder on a live tv channel switch if the new channel has the same format
+    XMLUtils::GetBoolean(pElement, "keepcodeconchannelswitch", m_videoKeepCodecOnChannelSwitch);
 
     // Store global display latency settings
     const TiXmlElement* pVideoLatency = pElement->FirstChildElement("latency");
@@ -883,6 +913,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "dateadded", m_iMusicLibraryDateAdded);
     XMLUtils::GetBoolean(pElement, "useisodates", m_bMusicLibraryUseISODates);
     XMLUtils::GetBoolean(pElement, "artistnavigatestosongs", m_bMusicLibraryArtistNavigatesToSongs);
+    XMLUtils::GetBoolean(pElement, "watchsources", m_bMusicLibraryWatchSources);
     // Music artist name separators
     const TiXmlElement* separators = pElement->FirstChildElement("artistseparators");
     if (separators)
@@ -905,9 +936,12 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "recentlyaddeditems", m_iVideoLibraryRecentlyAddedItems, 1, INT_MAX);
     XMLUtils::GetBoolean(pElement, "cleanonupdate", m_bVideoLibraryCleanOnUpdate);
     XMLUtils::GetBoolean(pElement, "usefasthash", m_bVideoLibraryUseFastHash);
+    XMLUtils::GetInt(pElement, "fasthashjobs", m_videoLibraryFastHashJobs, 1, 16);
+    XMLUtils::GetInt(pElement, "resultcacheage", m_videoLibraryResultCacheAge, 0, 3600);
     XMLUtils::GetString(pElement, "itemseparator", m_videoItemSeparator);
     XMLUtils::GetBoolean(pElement, "importwatchedstate", m_bVideoLibraryImportWatchedState);
     XMLUtils::GetBoolean(pElement, "importresumepoint", m_bVideoLibraryImportResumePoint);
+    XMLUtils::GetBoolean(pElement, "watchsources", m_bVideoLibraryWatchSources);
     XMLUtils::GetInt(pElement, "dateadded", m_iVideoLibraryDateAdded);
     XMLUtils::GetBoolean(pElement, "casesensitivelocalartmatch", m_caseSensitiveLocalArtMatch);
     XMLUtils::GetInt(pElement, "minimumepisodeplaylistduration", m_minimumEpisodePlaylistDuration);
@@ -950,12 +984,19 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetInt(pElement, "curlclienttimeout", m_curlconnecttimeout, 1, 1000);
     XMLUtils::GetInt(pElement, "curllowspeedtime", m_curllowspeedtime, 1, 1000);
     XMLUtils::GetInt(pElement, "curlretries", m_curlretries, 0, 10);
+    XMLUtils::GetInt(pElement, "scraperhttpcachetime", m_scraperHttpCacheTime, 0,
+                     30 * 24 * 60 * 60);
     XMLUtils::GetInt(pElement, "curlkeepaliveinterval", m_curlKeepAliveInterval, 0, 300);
     XMLUtils::GetBoolean(pElement, "disableipv6", m_curlDisableIPV6);
     XMLUtils::GetBoolean(pElement, "disablehttp2", m_curlDisableHTTP2);
     XMLUtils::GetString(pElement, "catrustfile", m_caTrustFile);
     XMLUtils::GetUInt(pElement, "nfstimeout", m_nfsTimeout, 0, 3600);
     XMLUtils::GetInt(pElement, "nfsretries", m_nfsRetries, -1, 30);
+    XMLUtils::GetInt(pElement, "readaheaddepth", m_cacheReadAheadDepth, 0, 32);
+    XMLUtils::GetBoolean(pElement, "maplocalfiles", m_cacheMapLocalFiles);
+    XMLUtils::GetInt(pElement, "rangeconnections", m_cacheRangeConnections, 0, 8);
+    XMLUtils::GetBoolean(pElement, "adaptivecachesize", m_cacheAdaptiveSize);
+    XMLUtils::GetBoolean(pElement, "persistentdircache", m_dirCachePersistent);
   }
 
   pElement = pRootElement->FirstChildElement("jsonrpc");
@@ -999,6 +1040,11 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     CServiceBroker::GetLogging().SetLogLevel(m_logLevel);
   }
 
+  XMLUtils::GetBoolean(pRootElement, "logasync", m_logAsync);
+  CServiceBroker::GetLogging().SetAsync(m_logAsync);
+  XMLUtils::GetInt(pRootElement, "lograte", m_logRateLimit, 0, 100000);
+  CServiceBroker::GetLogging().SetRateLimit(m_logRateLimit);
+
   XMLUtils::GetString(pRootElement, "cddbaddress", m_cddbAddress);
   XMLUtils::GetBoolean(pRootElement, "addsourceontop", m_addSourceOnTop);
 
@@ -1175,6 +1221,9 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
   if (XMLUtils::GetString(pRootElement, "imagescalingalgorithm", tmp))
     m_imageScalingAlgorithm = CPictureScalingAlgorithm::FromString(tmp);
   XMLUtils::GetUInt(pRootElement, "imagequalityjpeg", m_imageQualityJpeg, 0, 21);
+  XMLUtils::GetBoolean(pRootElement, "imagecacheraw", m_imageCacheRaw);
+  XMLUtils::GetUInt(pRootElement, "imagecachemaxsize", m_imageCacheMaxSize);
+  XMLUtils::GetBoolean(pRootElement, "imagehardwaredecode", m_imageHardwareDecode);
   XMLUtils::GetBoolean(pRootElement, "playlistasfolders", m_playlistAsFolders);
   XMLUtils::GetBoolean(pRootElement, "uselocalecollation", m_useLocaleCollation);
   XMLUtils::GetBoolean(pRootElement, "detectasudf", m_detectAsUdf);
@@ -1241,6 +1290,7 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
                       60000);
     XMLUtils::GetInt(pPVR, "timeshiftthreshold", m_iPVRTimeshiftThreshold, 0, 60);
     XMLUtils::GetBoolean(pPVR, "timeshiftsimpleosd", m_bPVRTimeshiftSimpleOSD);
+    XMLUtils::GetInt(pPVR, "timeshiftbuffersize", m_iPVRTimeshiftBufferSize, 0, 65536);
     const TiXmlElement* pSortDecription = pPVR->FirstChildElement("pvrrecordings");
     if (pSortDecription)
     {
@@ -1293,6 +1343,12 @@ void CAdvancedSettings::ParseSettingsFile(const std::string &file)
     XMLUtils::GetBoolean(pElement, "fronttobackrendering", m_guiFrontToBackRendering);
     XMLUtils::GetBoolean(pElement, "geometryclear", m_guiGeometryClear);
     XMLUtils::GetBoolean(pElement, "asynctextureupload", m_guiAsyncTextureUpload);
+    XMLUtils::GetBoolean(pElement, "textureatlas", m_guiTextureAtlas);
+    XMLUtils::GetBoolean(pElement, "fontsdf", m_guiFontSDF);
+    XMLUtils::GetFloat(pElement, "renderscale", m_guiRenderScale, 0.25f, 1.0f);
+    XMLUtils::GetUInt(pElement, "texturememory", m_guiTextureMemory);
+    XMLUtils::GetUInt(pElement, "idletimeout", m_guiIdleTimeout);
+    XMLUtils::GetUInt(pElement, "idlefps", m_guiIdleFps);
     XMLUtils::GetBoolean(pElement, "transparentvideolayout", m_guiVideoLayoutTransparent);
   }
 
@@ -198,6 +198,12 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int  m_videoFpsDetect;
     float m_maxTempo;
     bool m_videoPreferStereoStream = false;
+    bool m_videoZeroCopyPackets = true;
+    bool m_videoFastStart = true;
+    int m_videoSeekPreviewInterval = 10;
+    bool m_videoSinglePassScaling = true;
+    bool m_videoToneMapLUT = true;
+    bool m_videoKeepCodecOnChannelSwitch = true;
 
     std::string m_videoDefaultPlayer;
     float m_videoPlayCountMinimumPercent;
@@ -210,6 +216,8 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_songInfoDuration;
     int m_logLevel;
     int m_logLevelHint;
+    bool m_logAsync = false; //!< write the log file from a thread of its own
+    int m_logRateLimit = 0; //!< debug and info messages per second and component, 0 unlimited
     std::string m_cddbAddress;
     bool m_addSourceOnTop; //!< True to put 'add source' buttons on top
 
@@ -260,6 +268,10 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     CPictureScalingAlgorithm::Algorithm m_imageScalingAlgorithm;
     unsigned int
         m_imageQualityJpeg; ///< \brief the stored jpeg quality the lower the better (default: 4)
+    bool m_imageCacheRaw; ///< \brief cache images as uncompressed DDS to skip decoding them when shown
+    unsigned int
+        m_imageCacheMaxSize; ///< \brief size limit of the image cache in MiB (default: 0, none)
+    bool m_imageHardwareDecode; ///< \brief decode large JPEG images with VA-API/V4L2 if available
 
     int m_sambaclienttimeout;
     std::string m_sambadoscodepage;
@@ -279,6 +291,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_bMusicLibraryArtistSortOnUpdate;
     bool m_bMusicLibraryUseISODates;
     bool m_bMusicLibraryArtistNavigatesToSongs;
+    bool m_bMusicLibraryWatchSources{false}; //!< scan local sources when their folders change
     std::string m_strMusicLibraryAlbumFormat;
     bool m_prioritiseAPEv2tags;
     std::string m_musicItemSeparator;
@@ -290,8 +303,11 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_iVideoLibraryRecentlyAddedItems;
     bool m_bVideoLibraryCleanOnUpdate;
     bool m_bVideoLibraryUseFastHash;
+    int m_videoLibraryFastHashJobs; //!< concurrent folder listings per host for the fast hash
+    int m_videoLibraryResultCacheAge; //!< seconds a cached library listing is served, 0 disables
     bool m_bVideoLibraryImportWatchedState{true};
     bool m_bVideoLibraryImportResumePoint{true};
+    bool m_bVideoLibraryWatchSources{false}; //!< scan local sources when their folders change
 
     bool m_bVideoScannerIgnoreErrors;
     int m_iVideoLibraryDateAdded;
@@ -326,6 +342,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     int m_curlconnecttimeout;
     int m_curllowspeedtime;
     int m_curlretries;
+    int m_scraperHttpCacheTime; // seconds
     int m_curlKeepAliveInterval;    // seconds
     bool m_curlDisableIPV6;
     bool m_curlDisableHTTP2;
@@ -364,6 +381,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
         m_iPVRNumericChannelSwitchTimeout; /*!< @brief time in msecs after that a channel switch occurs after entering a channel number, if confirmchannelswitch is disabled */
     int m_iPVRTimeshiftThreshold; /*!< @brief time diff between current playing time and timeshift buffer end, in seconds, before a playing stream is displayed as timeshifting. */
     bool m_bPVRTimeshiftSimpleOSD; /*!< @brief use simple timeshift OSD (with progress only for the playing event instead of progress for the whole ts buffer). */
+    int m_iPVRTimeshiftBufferSize; /*!< @brief size in MB of the core timeshift buffer for live streams the add-on can't pause, 0 to disable. defaults to 1024. */
     SortDescription m_PVRDefaultSortOrder; /*!< @brief SortDecription used to store default recording sort type and sort order */
 
     DatabaseSettings m_databaseMusic; // advanced music database setup
@@ -380,6 +398,12 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_guiFrontToBackRendering{false};
     bool m_guiGeometryClear{true};
     bool m_guiAsyncTextureUpload{false};
+    bool m_guiTextureAtlas{false};
+    bool m_guiFontSDF{false};
+    float m_guiRenderScale{1.0f};
+    unsigned int m_guiTextureMemory{0}; //!< MiB of textures and video buffers, 0 for the default
+    unsigned int m_guiIdleTimeout{120}; //!< seconds without input until idle, 0 to never idle
+    unsigned int m_guiIdleFps{10}; //!< frame rate cap while idle, 0 for none
     bool m_guiVideoLayoutTransparent{false};
 
     unsigned int m_addonPackageFolderSize;
@@ -420,6 +444,11 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     std::string m_userAgent;
     uint32_t m_nfsTimeout;
     int m_nfsRetries;
+    int m_cacheReadAheadDepth; //!< io_uring reads in flight for cached local files, 0 disables
+    bool m_cacheMapLocalFiles; //!< serve the memory cache of local files from a file mapping
+    int m_cacheRangeConnections; //!< connections fetching ranges of large HTTP files, 0 disables
+    bool m_cacheAdaptiveSize; //!< size audio/video memory caches by their bitrate
+    bool m_dirCachePersistent; //!< keep network directory listings on disk across restarts
 
   private:
     void Initialize();
@@ -356,6 +356,10 @@ void CMediaSettings::OnSettingAction(const std::shared_ptr<const CSetting>& sett
   {
     CServiceBroker::GetTextureCache()->CleanAllUnusedImages();
   }
+  else if (settingId == CSettings::SETTING_MAINTENANCE_PRECACHEIMAGES)
+  {
+    CServiceBroker::GetTextureCache()->PrecacheAllLibraryImages(true);
+  }
 }
 
 void CMediaSettings::OnSettingChanged(const std::shared_ptr<const CSetting>& setting)
@@ -23,6 +23,7 @@
 #include "network/upnp/UPnPSettings.h"
 
 #include <mutex>
+#include <utility>
 #if defined(TARGET_DARWIN_TVOS)
 #include "platform/darwin/tvos/TVOSSettingsHandler.h"
 #endif // defined(TARGET_DARWIN_TVOS)
@@ -116,6 +117,13 @@ bool CSettings::Load()
 
 bool CSettings::Load(const std::string &file)
 {
+  {
+    // the file may have been changed outside, the next save has to write it
+    std::unique_lock lock(m_saveSection);
+    m_savedFile.clear();
+    m_savedContent.clear();
+  }
+
   CXBMCTinyXML xmlDoc;
   bool updated = false;
   if (!XFILE::CFile::Exists(file) || !xmlDoc.LoadFile(file) ||
@@ -162,7 +170,43 @@ bool CSettings::Save(const std::string& file) const
   if (!Save(root))
     return false;
 
-  return xmlDoc.SaveFile(file);
+  TiXmlPrinter printer;
+  xmlDoc.Accept(&printer);
+  std::string content(printer.CStr(), printer.Size());
+
+  std::unique_lock lock(m_saveSection);
+
+  // most saves follow a change of a single setting, or of none at all
+  if (file == m_savedFile && content == m_savedContent)
+    return true;
+
+  // write next to the file and replace it, so a crash or a full disk while writing doesn't lose
+  // all the settings
+  const std::string tempFile = file + ".tmp";
+  bool written = false;
+  {
+    XFILE::CFile out;
+    if (out.OpenForWrite(tempFile, true))
+    {
+      written = out.Write(content.data(), content.size()) == static_cast<ssize_t>(content.size());
+      if (written)
+        out.Flush();
+    }
+  }
+
+  // renaming doesn't replace an existing file on every platform
+  if (!written ||
+      (!XFILE::CFile::Rename(tempFile, file) &&
+       (!XFILE::CFile::Delete(file) || !XFILE::CFile::Rename(tempFile, file))))
+  {
+    CLog::Log(LOGERROR, "CSettings: unable to save settings to {}", file);
+    XFILE::CFile::Delete(tempFile);
+    return false;
+  }
+
+  m_savedFile = file;
+  m_savedContent = std::move(content);
+  return true;
 }
 
 bool CSettings::Save(TiXmlNode* root) const
@@ -584,7 +628,8 @@ void CSettings::InitializeISettingCallbacks()
        CSettings::SETTING_VIDEOLIBRARY_GROUPMOVIESETS, CSettings::SETTING_VIDEOLIBRARY_CLEANUP,
        CSettings::SETTING_VIDEOLIBRARY_IMPORT, CSettings::SETTING_VIDEOLIBRARY_EXPORT,
        CSettings::SETTING_VIDEOLIBRARY_SHOWUNWATCHEDPLOTS,
-       CSettings::SETTING_MAINTENANCE_CLEANIMAGECACHE});
+       CSettings::SETTING_MAINTENANCE_CLEANIMAGECACHE,
+       CSettings::SETTING_MAINTENANCE_PRECACHEIMAGES});
 
   GetSettingsManager()->RegisterCallback(
       &CDisplaySettings::GetInstance(),
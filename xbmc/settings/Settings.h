@@ -12,6 +12,7 @@
 #include "settings/SettingControl.h"
 #include "settings/SettingCreator.h"
 #include "settings/SettingsBase.h"
+#include "threads/CriticalSection.h"
 
 #include <string>
 
@@ -287,6 +288,7 @@ public:
   static constexpr auto SETTING_MUSICLIBRARY_EXPORT_SKIPNFO = "musiclibrary.exportskipnfo";
   static constexpr auto SETTING_MUSICLIBRARY_IMPORT = "musiclibrary.import";
   static constexpr auto SETTING_MAINTENANCE_CLEANIMAGECACHE = "maintenance.cleanimagecache";
+  static constexpr auto SETTING_MAINTENANCE_PRECACHEIMAGES = "maintenance.precacheimages";
   static constexpr auto SETTING_MUSICPLAYER_AUTOPLAYNEXTITEM = "musicplayer.autoplaynextitem";
   static constexpr auto SETTING_MUSICPLAYER_QUEUEBYDEFAULT = "musicplayer.queuebydefault";
   static constexpr auto SETTING_MUSICPLAYER_SEEKSTEPS = "musicplayer.seeksteps";
@@ -630,4 +632,9 @@ private:
   bool Reset();
 
   std::set<ISubSettings*> m_subSettings;
+
+  // The last saved settings, saving them again unchanged doesn't write the file
+  mutable std::string m_savedFile;
+  mutable std::string m_savedContent;
+  mutable CCriticalSection m_saveSection;
 };
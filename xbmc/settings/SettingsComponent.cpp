@@ -24,6 +24,7 @@
 #include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SubtitlesSettings.h"
+#include "utils/StartupTrace.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
@@ -337,6 +338,8 @@ void CSettingsComponent::Initialize()
 
 bool CSettingsComponent::Load()
 {
+  CStartupTrace::CScope trace("CSettingsComponent::Load");
+
   if (m_state == State::INITED)
   {
     if (!m_profileManager->Load())
@@ -0,0 +1,67 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceInitGraph.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(TestServiceInitGraph, RunsAfterDependencies)
+{
+  std::mutex mutex;
+  std::vector<std::string> order;
+  const auto record = [&](const std::string& name)
+  {
+    return [&, name]()
+    {
+      std::unique_lock lock(mutex);
+      order.emplace_back(name);
+      return true;
+    };
+  };
+
+  CServiceInitGraph graph("test");
+  graph.Add("a", {}, record("a"));
+  graph.Add("b", {"a"}, record("b"));
+  graph.Add("c", {}, record("c"));
+  graph.Add("d", {"b", "c"}, record("d"));
+  EXPECT_TRUE(graph.Run());
+
+  ASSERT_EQ(4u, order.size());
+  const auto position = [&](const std::string& name)
+  { return std::ranges::find(order, name) - order.begin(); };
+  EXPECT_LT(position("a"), position("b"));
+  EXPECT_LT(position("b"), position("d"));
+  EXPECT_LT(position("c"), position("d"));
+}
+
+TEST(TestServiceInitGraph, SkipsDependentsOfFailedTask)
+{
+  std::atomic<int> runs{0};
+  const auto count = [&](bool result)
+  {
+    return [&runs, result]()
+    {
+      runs++;
+      return result;
+    };
+  };
+
+  CServiceInitGraph graph("test");
+  graph.Add("failing", {}, count(false));
+  graph.Add("dependent", {"failing"}, count(true));
+  graph.Add("independent", {}, count(true));
+  EXPECT_FALSE(graph.Run());
+
+  EXPECT_EQ(2, runs);
+}
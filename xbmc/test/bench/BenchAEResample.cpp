@@ -0,0 +1,104 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/AEResampleFactory.h"
+#include "cores/AudioEngine/Utils/AEUtil.h"
+
+#include <cmath>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+using namespace ActiveAE;
+
+namespace
+{
+constexpr int PACKET_FRAMES = 1024;
+
+/*!
+ * \brief Resample planar float packets like a stream stage of ActiveAE does.
+ * Arguments: source rate, channels. The destination is always 48 kHz.
+ */
+void ResampleStream(benchmark::State& state, AEQuality quality)
+{
+  const int srcRate = static_cast<int>(state.range(0));
+  const int channels = static_cast<int>(state.range(1));
+  constexpr int dstRate = 48000;
+
+  const CAEChannelInfo layout(channels == 8 ? AE_CH_LAYOUT_7_1 : AE_CH_LAYOUT_2_0);
+
+  SampleConfig config;
+  config.channel_layout = CAEUtil::GetAVChannelLayout(layout);
+  config.channels = channels;
+  config.fmt = CAEUtil::GetAVSampleFormat(AE_FMT_FLOATP);
+  config.bits_per_sample = 32;
+  config.dither_bits = 0;
+
+  SampleConfig srcConfig = config;
+  srcConfig.sample_rate = srcRate;
+  SampleConfig dstConfig = config;
+  dstConfig.sample_rate = dstRate;
+
+  auto resampler = CAEResampleFactory::Create(0U, quality);
+  if (!resampler->Init(dstConfig, srcConfig, false, true, M_SQRT1_2, nullptr, quality, false, 0.0f))
+  {
+    state.SkipWithError("failed to init resampler");
+    return;
+  }
+
+  const int dstFrames = resampler->CalcDstSampleCount(PACKET_FRAMES, dstRate, srcRate) + 64;
+  std::vector<std::vector<float>> src(channels, std::vector<float>(PACKET_FRAMES));
+  std::vector<std::vector<float>> dst(channels, std::vector<float>(dstFrames));
+  std::vector<uint8_t*> srcPlanes;
+  std::vector<uint8_t*> dstPlanes;
+  for (int ch = 0; ch < channels; ++ch)
+  {
+    for (int i = 0; i < PACKET_FRAMES; ++i)
+      src[ch][i] = 0.5f * std::sin(2.0f * static_cast<float>(M_PI) * 997.0f * (i + ch) / srcRate);
+    srcPlanes.push_back(reinterpret_cast<uint8_t*>(src[ch].data()));
+    dstPlanes.push_back(reinterpret_cast<uint8_t*>(dst[ch].data()));
+  }
+
+  for (auto _ : state)
+  {
+    const int samples = resampler->Resample(dstPlanes.data(), dstFrames, srcPlanes.data(),
+                                            PACKET_FRAMES, 1.0);
+    benchmark::DoNotOptimize(samples);
+    benchmark::ClobberMemory();
+  }
+
+  // items are samples of a single channel, so the rate compares the cost per channel
+  state.SetItemsProcessed(state.iterations() * PACKET_FRAMES * channels);
+}
+
+void BM_AEResample_FFmpegHigh(benchmark::State& state)
+{
+  ResampleStream(state, AE_QUALITY_HIGH);
+}
+
+void BM_AEResample_FFmpegMid(benchmark::State& state)
+{
+  ResampleStream(state, AE_QUALITY_MID);
+}
+
+void BM_AEResample_Polyphase(benchmark::State& state)
+{
+  ResampleStream(state, AE_QUALITY_POLYPHASE);
+}
+
+void ResampleArgs(benchmark::internal::Benchmark* bench)
+{
+  for (int rate : {44100, 96000})
+    for (int channels : {2, 8})
+      bench->Args({rate, channels});
+}
+} // namespace
+
+BENCHMARK(BM_AEResample_FFmpegHigh)->Apply(ResampleArgs);
+BENCHMARK(BM_AEResample_FFmpegMid)->Apply(ResampleArgs);
+BENCHMARK(BM_AEResample_Polyphase)->Apply(ResampleArgs);
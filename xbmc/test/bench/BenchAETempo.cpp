@@ -0,0 +1,78 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/Engines/ActiveAE/ActiveAETempo.h"
+
+#include <cmath>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+using namespace ActiveAE;
+
+namespace
+{
+constexpr int PACKET_FRAMES = 1024;
+
+/*!
+ * \brief Stretch 48 kHz planar float packets like the atempo stage of ActiveAE does.
+ * Arguments: tempo in percent, channels.
+ */
+void BM_AETempo(benchmark::State& state)
+{
+  const float tempo = static_cast<float>(state.range(0)) / 100.0f;
+  const int channels = static_cast<int>(state.range(1));
+  constexpr int rate = 48000;
+
+  AEAudioFormat format;
+  format.m_dataFormat = AE_FMT_FLOATP;
+  format.m_sampleRate = rate;
+  format.m_channelLayout = CAEChannelInfo(channels == 8 ? AE_CH_LAYOUT_7_1 : AE_CH_LAYOUT_2_0);
+
+  CActiveAETempo filter;
+  filter.Init(format);
+  filter.SetTempo(tempo);
+
+  std::vector<std::vector<float>> src(channels, std::vector<float>(PACKET_FRAMES));
+  std::vector<std::vector<float>> dst(channels, std::vector<float>(PACKET_FRAMES));
+  std::vector<uint8_t*> srcPlanes;
+  std::vector<uint8_t*> dstPlanes;
+  for (int ch = 0; ch < channels; ++ch)
+  {
+    for (int i = 0; i < PACKET_FRAMES; ++i)
+      src[ch][i] = 0.5f * std::sin(2.0f * static_cast<float>(M_PI) * 997.0f * (i + ch) / rate);
+    srcPlanes.push_back(reinterpret_cast<uint8_t*>(src[ch].data()));
+    dstPlanes.push_back(reinterpret_cast<uint8_t*>(dst[ch].data()));
+  }
+
+  int64_t consumed = 0;
+  for (auto _ : state)
+  {
+    const bool feed = filter.NeedData();
+    const int samples = filter.ProcessFilter(dstPlanes.data(), PACKET_FRAMES,
+                                             feed ? srcPlanes.data() : nullptr,
+                                             feed ? PACKET_FRAMES : 0);
+    if (feed)
+      consumed += PACKET_FRAMES;
+    benchmark::DoNotOptimize(samples);
+    benchmark::ClobberMemory();
+  }
+
+  // items are input samples of a single channel, so the rate compares the cost per channel
+  state.SetItemsProcessed(consumed * channels);
+}
+
+void TempoArgs(benchmark::internal::Benchmark* bench)
+{
+  for (int tempo : {150, 200})
+    for (int channels : {2, 8})
+      bench->Args({tempo, channels});
+}
+} // namespace
+
+BENCHMARK(BM_AETempo)->Apply(TempoArgs);
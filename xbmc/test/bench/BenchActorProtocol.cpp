@@ -0,0 +1,45 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/ActorProtocol.h"
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+using namespace Actor;
+
+namespace
+{
+constexpr int SIGNAL = 1;
+
+/*!
+ * \brief Several threads send small messages through one port and take messages back out of
+ * it, the way the players and the sinks talk to the audio engine.
+ */
+void BM_ActorProtocol_SendReceive(benchmark::State& state)
+{
+  static Protocol port("bench");
+  int64_t payload = state.thread_index();
+
+  for (auto _ : state)
+  {
+    port.SendOutMessage(SIGNAL, &payload, sizeof(payload));
+
+    Message* msg = nullptr;
+    if (port.ReceiveOutMessage(&msg))
+      msg->Release();
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  if (state.thread_index() == 0)
+    port.Purge();
+}
+} // namespace
+
+BENCHMARK(BM_ActorProtocol_SendReceive)->ThreadRange(1, 8)->UseRealTime();
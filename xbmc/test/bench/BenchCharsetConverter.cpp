@@ -0,0 +1,75 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/CharsetConverter.h"
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+const std::string ASCII_TEXT = "The Lord of the Rings: The Fellowship of the Ring (2001)";
+const std::string UTF8_TEXT = "Der Herr der Ringe: Die Gefährten – Крёстный отец – 千と千尋の神隠し";
+
+void BM_CharsetConverter_utf8ToW(benchmark::State& state, const std::string& text, bool bidi)
+{
+  std::wstring result;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(g_charsetConverter.utf8ToW(text, result, bidi));
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+void BM_CharsetConverter_utf8ToUtf32(benchmark::State& state, const std::string& text)
+{
+  std::u32string result;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(g_charsetConverter.utf8ToUtf32(text, result));
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+void BM_CharsetConverter_utf32ToUtf8(benchmark::State& state, const std::string& text)
+{
+  const std::u32string source = g_charsetConverter.utf8ToUtf32(text);
+  std::string result;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(g_charsetConverter.utf32ToUtf8(source, result));
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+void BM_CharsetConverter_wToUTF8(benchmark::State& state)
+{
+  std::wstring source;
+  g_charsetConverter.utf8ToW(UTF8_TEXT, source, false);
+  std::string result;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(g_charsetConverter.wToUTF8(source, result));
+    benchmark::DoNotOptimize(result.data());
+  }
+}
+} // namespace
+
+BENCHMARK_CAPTURE(BM_CharsetConverter_utf8ToW, ascii, ASCII_TEXT, false);
+BENCHMARK_CAPTURE(BM_CharsetConverter_utf8ToW, ascii_bidi, ASCII_TEXT, true);
+BENCHMARK_CAPTURE(BM_CharsetConverter_utf8ToW, multibyte, UTF8_TEXT, false);
+BENCHMARK_CAPTURE(BM_CharsetConverter_utf8ToW, multibyte_bidi, UTF8_TEXT, true);
+BENCHMARK_CAPTURE(BM_CharsetConverter_utf8ToUtf32, ascii, ASCII_TEXT);
+BENCHMARK_CAPTURE(BM_CharsetConverter_utf8ToUtf32, multibyte, UTF8_TEXT);
+BENCHMARK_CAPTURE(BM_CharsetConverter_utf32ToUtf8, ascii, ASCII_TEXT);
+BENCHMARK_CAPTURE(BM_CharsetConverter_utf32ToUtf8, multibyte, UTF8_TEXT);
+BENCHMARK(BM_CharsetConverter_wToUTF8);
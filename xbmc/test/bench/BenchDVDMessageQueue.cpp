@@ -0,0 +1,122 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxUtils.h"
+#include "cores/VideoPlayer/DVDMessage.h"
+#include "cores/VideoPlayer/DVDMessageQueue.h"
+#include "cores/VideoPlayer/Interface/DemuxPacket.h"
+#include "cores/VideoPlayer/Interface/TimingConstants.h"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr int PACKET_SIZE = 64 * 1024;
+
+std::shared_ptr<CDVDMsg> CreatePacketMessage(double pts)
+{
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(PACKET_SIZE);
+  packet->iSize = PACKET_SIZE;
+  packet->dts = pts;
+  packet->pts = pts;
+  return CDVDMsgDemuxerPacket::Create(packet);
+}
+
+void BM_DVDMessageQueue_PutGet(benchmark::State& state)
+{
+  CDVDMessageQueue queue("bench");
+  if (state.range(0))
+    queue.SetRingMode(4096);
+  queue.SetMaxDataSize(64 * 1024 * 1024);
+  queue.Init();
+
+  double pts = 0.0;
+  for (auto _ : state)
+  {
+    queue.Put(CreatePacketMessage(pts));
+    pts += DVD_TIME_BASE / 60;
+
+    std::shared_ptr<CDVDMsg> msg;
+    benchmark::DoNotOptimize(queue.Get(msg, 0ms));
+  }
+  state.SetItemsProcessed(state.iterations());
+  queue.End();
+}
+
+void BM_DVDMessageQueue_Batch(benchmark::State& state)
+{
+  const int count = static_cast<int>(state.range(0));
+  CDVDMessageQueue queue("bench");
+  if (state.range(1))
+    queue.SetRingMode(4096);
+  queue.SetMaxDataSize(count * PACKET_SIZE * 2);
+  queue.Init();
+
+  double pts = 0.0;
+  for (auto _ : state)
+  {
+    for (int i = 0; i < count; ++i)
+    {
+      queue.Put(CreatePacketMessage(pts));
+      pts += DVD_TIME_BASE / 60;
+    }
+    benchmark::DoNotOptimize(queue.GetLevel());
+
+    std::shared_ptr<CDVDMsg> msg;
+    for (int i = 0; i < count; ++i)
+      queue.Get(msg, 0ms);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+  queue.End();
+}
+
+void BM_DVDMessageQueue_Threaded(benchmark::State& state)
+{
+  const int count = static_cast<int>(state.range(0));
+  CDVDMessageQueue queue("bench");
+  if (state.range(1))
+    queue.SetRingMode(4096);
+  queue.SetMaxDataSize(count * PACKET_SIZE * 2);
+  queue.Init();
+
+  for (auto _ : state)
+  {
+    std::thread consumer(
+        [&queue, count]()
+        {
+          std::shared_ptr<CDVDMsg> msg;
+          for (int received = 0; received < count;)
+          {
+            if (queue.Get(msg, 100ms) == MSGQ_OK)
+              received++;
+          }
+        });
+
+    double pts = 0.0;
+    for (int i = 0; i < count; ++i)
+    {
+      queue.Put(CreatePacketMessage(pts));
+      pts += DVD_TIME_BASE / 60;
+    }
+    consumer.join();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+  queue.End();
+}
+} // namespace
+
+// last argument selects the lock-free ring mode
+BENCHMARK(BM_DVDMessageQueue_PutGet)->Arg(0)->Arg(1);
+BENCHMARK(BM_DVDMessageQueue_Batch)->Ranges({{16, 1024}, {0, 1}});
+BENCHMARK(BM_DVDMessageQueue_Threaded)->Ranges({{256, 4096}, {0, 1}})->UseRealTime();
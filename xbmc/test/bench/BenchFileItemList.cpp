@@ -0,0 +1,120 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "utils/StringUtils.h"
+#include "video/VideoInfoTag.h"
+
+#include <cstddef>
+#include <memory>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+//! Bytes allocated on the heap, 0 where the C library can't tell.
+size_t HeapInUse()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+  return mallinfo2().uordblks;
+#else
+  return 0;
+#endif
+}
+
+/*!
+ * \brief Fill the list like a widget or a JSON-RPC request listing the movie library does.
+ */
+void FillMovieList(CFileItemList& items, int count)
+{
+  items.Reserve(count);
+  for (int i = 0; i < count; ++i)
+  {
+    const std::string folder = StringUtils::Format("smb://nas/Movies/Movie {} (2001)/", i);
+    auto item = std::make_shared<CFileItem>(folder + "movie.mkv", false);
+    item->SetLabel(StringUtils::Format("Movie {}", i));
+    item->SetLabel2("2001");
+    item->SetDynPath(StringUtils::Format("videodb://movies/titles/{}", i));
+
+    CVideoInfoTag* tag = item->GetVideoInfoTag();
+    tag->SetTitle(item->GetLabel());
+    tag->SetYear(2001);
+    tag->SetGenre({"Action", "Science Fiction"});
+    tag->m_iDbId = i;
+
+    item->SetArt({{"poster", "image://" + folder + "poster.jpg/"},
+                  {"fanart", "image://" + folder + "fanart.jpg/"}});
+    item->SetArtFallback("thumb", "poster");
+    item->SetProperty("dbid", i);
+    item->SetProperty("libraryartfilled", true);
+    items.Add(std::move(item));
+  }
+}
+
+void BM_FileItemList_Fill(benchmark::State& state)
+{
+  const int count = static_cast<int>(state.range(0));
+  size_t heap = 0;
+  for (auto _ : state)
+  {
+    const size_t before = HeapInUse();
+    CFileItemList items;
+    FillMovieList(items, count);
+    heap = HeapInUse() - before;
+    benchmark::DoNotOptimize(items.Size());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+  state.counters["item_size"] = sizeof(CFileItem);
+  state.counters["heap_per_item"] = static_cast<double>(heap) / count;
+}
+
+void BM_FileItemList_Copy(benchmark::State& state)
+{
+  const int count = static_cast<int>(state.range(0));
+  CFileItemList source;
+  FillMovieList(source, count);
+
+  size_t heap = 0;
+  for (auto _ : state)
+  {
+    const size_t before = HeapInUse();
+    CFileItemList items;
+    items.Copy(source);
+    heap = HeapInUse() - before;
+    benchmark::DoNotOptimize(items.Size());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+  state.counters["heap_per_item"] = static_cast<double>(heap) / count;
+}
+
+void BM_FileItemList_GetArt(benchmark::State& state)
+{
+  const int count = static_cast<int>(state.range(0));
+  CFileItemList items;
+  FillMovieList(items, count);
+
+  for (auto _ : state)
+  {
+    for (const auto& item : items)
+    {
+      benchmark::DoNotOptimize(item->GetArt("thumb"));
+      benchmark::DoNotOptimize(item->GetProperty("dbid").asInteger());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+} // namespace
+
+BENCHMARK(BM_FileItemList_Fill)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FileItemList_Copy)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FileItemList_GetArt)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,94 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "interfaces/json-rpc/IClient.h"
+#include "interfaces/json-rpc/ITransportLayer.h"
+#include "interfaces/json-rpc/JSONRPC.h"
+#include "interfaces/json-rpc/JSONServiceDescription.h"
+#include "utils/JSONVariantParser.h"
+#include "utils/Variant.h"
+
+#include <iterator>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+using namespace JSONRPC;
+
+namespace
+{
+class CBenchTransport : public ITransportLayer
+{
+public:
+  bool PrepareDownload(const char* path, CVariant& details, std::string& protocol) override
+  {
+    return false;
+  }
+  bool Download(const char* path, CVariant& result) override { return false; }
+  int GetCapabilities() override { return Response | Announcing; }
+};
+
+class CBenchClient : public IClient
+{
+public:
+  int GetPermissionFlags() override { return OPERATION_PERMISSION_ALL; }
+  int GetAnnouncementFlags() override { return 0; }
+  bool SetAnnouncementFlags(int flags) override { return false; }
+};
+
+struct BenchCall
+{
+  const char* method;
+  const char* params;
+};
+
+// calls remote apps keep sending while something is playing
+const BenchCall CALLS[] = {
+    {"jsonrpc.ping", "{}"},
+    {"player.getproperties",
+     R"({"playerid":1,"properties":["time","totaltime","percentage","speed","position",)"
+     R"("playlistid","repeat","shuffled","audiostreams","currentaudiostream","subtitleenabled",)"
+     R"("currentsubtitle","subtitles","canseek"]})"},
+    {"player.getitem",
+     R"({"playerid":1,"properties":["title","album","artist","season","episode","duration",)"
+     R"("showtitle","tvshowid","thumbnail","file","fanart","streamdetails"]})"},
+    {"application.getproperties", R"({"properties":["volume","muted"]})"},
+    {"videolibrary.getmovies",
+     R"({"properties":["title","year","rating","playcount","file","art"],"limits":{"start":0,)"
+     R"("end":50},"sort":{"method":"title","order":"ascending","ignorearticle":true},)"
+     R"("filter":{"field":"playcount","operator":"is","value":"0"}})"},
+};
+
+void BM_JSONRPC_CheckCall(benchmark::State& state)
+{
+  CJSONRPC::Initialize();
+
+  const BenchCall& call = CALLS[state.range(0)];
+  CVariant params;
+  CJSONVariantParser::Parse(call.params, params);
+  state.SetLabel(call.method);
+
+  CBenchTransport transport;
+  CBenchClient client;
+  for (auto _ : state)
+  {
+    MethodCall methodCall;
+    CVariant outputParameters;
+    JSONRPC_STATUS status = CJSONServiceDescription::CheckCall(
+        call.method, params, &transport, &client, false, methodCall, outputParameters);
+    if (status != OK)
+    {
+      state.SkipWithError("invalid call");
+      break;
+    }
+    benchmark::DoNotOptimize(outputParameters);
+  }
+}
+} // namespace
+
+BENCHMARK(BM_JSONRPC_CheckCall)->DenseRange(0, std::size(CALLS) - 1);
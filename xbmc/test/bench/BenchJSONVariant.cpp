@@ -0,0 +1,68 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "BenchUtils.h"
+#include "utils/JSONVariantParser.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+std::string CreateJSON(int count, bool compact)
+{
+  std::string json;
+  CJSONVariantWriter::Write(KODI::BENCH::CreateVariantMovieList(count), json, compact);
+  return json;
+}
+
+void BM_JSONVariantParser_Parse(benchmark::State& state)
+{
+  const std::string json = CreateJSON(static_cast<int>(state.range(0)), true);
+  for (auto _ : state)
+  {
+    CVariant result;
+    benchmark::DoNotOptimize(CJSONVariantParser::Parse(json, result));
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(json.size()));
+}
+
+void BM_JSONVariantParser_ParseRequest(benchmark::State& state)
+{
+  const std::string json =
+      R"({"jsonrpc":"2.0","method":"VideoLibrary.GetMovies","params":{"properties":["title",)"
+      R"("year","rating","playcount","file","art"],"limits":{"start":0,"end":50},"sort":)"
+      R"({"method":"title","order":"ascending","ignorearticle":true}},"id":1})";
+  for (auto _ : state)
+  {
+    CVariant result;
+    benchmark::DoNotOptimize(CJSONVariantParser::Parse(json, result));
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(json.size()));
+}
+
+void BM_JSONVariantWriter_Write(benchmark::State& state)
+{
+  const CVariant source = KODI::BENCH::CreateVariantMovieList(static_cast<int>(state.range(0)));
+  const bool compact = state.range(1) != 0;
+  std::string output;
+  for (auto _ : state)
+  {
+    CJSONVariantWriter::Write(source, output, compact);
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(output.size()));
+}
+} // namespace
+
+BENCHMARK(BM_JSONVariantParser_Parse)->Range(8, 4096);
+BENCHMARK(BM_JSONVariantParser_ParseRequest);
+BENCHMARK(BM_JSONVariantWriter_Write)->Ranges({{8, 4096}, {0, 1}});
@@ -0,0 +1,100 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "jobs/IJobCallback.h"
+#include "jobs/Job.h"
+#include "jobs/JobManager.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+constexpr unsigned int PROGRESS_STEPS = 16;
+constexpr int JOBS_PER_ITERATION = 64;
+
+/*!
+ * \brief A short job that reports its progress like the thumb and art jobs do.
+ */
+class CBenchJob : public CJob
+{
+public:
+  explicit CBenchJob(uint64_t id) : m_id(id) {}
+
+  bool DoWork() override
+  {
+    for (unsigned int i = 0; i < PROGRESS_STEPS; ++i)
+    {
+      if (ShouldCancel(i, PROGRESS_STEPS))
+        return false;
+    }
+    return true;
+  }
+
+  const char* GetType() const override { return "bench"; }
+
+  bool Equals(const CJob* job) const override
+  {
+    return std::strcmp(job->GetType(), GetType()) == 0 &&
+           static_cast<const CBenchJob*>(job)->m_id == m_id;
+  }
+
+private:
+  uint64_t m_id;
+};
+
+class CBenchCallback : public IJobCallback
+{
+public:
+  void OnJobComplete(unsigned int jobID, bool success, CJob* job) override { m_completed++; }
+
+  std::atomic<int64_t> m_completed{0};
+};
+
+CJobManager& GetJobManager()
+{
+  // never destroyed, idle workers may still wait on it when the process exits
+  static CJobManager* manager = new CJobManager();
+  return *manager;
+}
+
+/*!
+ * \brief Several threads queue batches of jobs and wait for them, while the workers take and
+ * run the jobs of all threads. Arguments: priority of the jobs.
+ */
+void BM_JobManager_AddJob(benchmark::State& state)
+{
+  CJobManager& manager = GetJobManager();
+  const auto priority = static_cast<CJob::PRIORITY>(state.range(0));
+
+  CBenchCallback callback;
+  uint64_t id = static_cast<uint64_t>(state.thread_index()) << 32;
+  int64_t queued = 0;
+  for (auto _ : state)
+  {
+    for (int i = 0; i < JOBS_PER_ITERATION; ++i)
+      manager.AddJob(new CBenchJob(id++), &callback, priority);
+    queued += JOBS_PER_ITERATION;
+
+    while (callback.m_completed < queued)
+      std::this_thread::yield();
+  }
+
+  state.SetItemsProcessed(queued);
+}
+} // namespace
+
+BENCHMARK(BM_JobManager_AddJob)
+    ->Arg(CJob::PRIORITY_LOW)
+    ->Arg(CJob::PRIORITY_HIGH)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
@@ -0,0 +1,551 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItemList.h"
+#include "XBDateTime.h"
+#include "dbwrappers/Database.h"
+#include "dbwrappers/dataset.h"
+#include "music/Album.h"
+#include "music/MusicDatabase.h"
+#include "music/MusicDbUrl.h"
+#include "platform/Filesystem.h"
+#include "settings/AdvancedSettings.h"
+#include "utils/SortUtils.h"
+#include "utils/StringUtils.h"
+#include "utils/Variant.h"
+#include "video/VideoDatabase.h"
+#include "video/VideoDbUrl.h"
+#include "video/VideoInfoTag.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <iterator>
+#include <set>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+/*
+ * Navigation of generated libraries of the size of large real ones. The libraries are added with
+ * the database APIs the scanners use, once per run and size, before the first benchmark using
+ * them. They are kept in a temporary SQLite folder, or on the MySQL or MariaDB server given by
+ * KODI_BENCH_MYSQL_HOST, KODI_BENCH_MYSQL_PORT, KODI_BENCH_MYSQL_USER and KODI_BENCH_MYSQL_PASS.
+ * There the databases are left in place and replaced by the next run.
+ */
+
+namespace
+{
+constexpr const char* GENRES[] = {
+    "Action",  "Adventure", "Animation", "Comedy",  "Crime",   "Documentary", "Drama",
+    "Family",  "Fantasy",   "History",   "Horror",  "Music",   "Mystery",     "Romance",
+    "Science", "Thriller",  "War",       "Western", "Pop",     "Rock",        "Jazz",
+    "Classical", "Electronic", "Hip-Hop",
+};
+
+constexpr const char* STUDIOS[] = {"Studio A", "Studio B", "Studio C", "Studio D", "Studio E"};
+
+std::string GetEnvironment(const char* name)
+{
+  const char* value = std::getenv(name);
+  return value ? value : "";
+}
+
+class CBenchFolder
+{
+public:
+  ~CBenchFolder()
+  {
+    std::error_code ec;
+    if (!m_path.empty())
+      std::filesystem::remove_all(m_path, ec);
+  }
+
+  const std::string& Get()
+  {
+    if (m_path.empty())
+    {
+      std::error_code ec;
+      m_path = KODI::PLATFORM::FILESYSTEM::create_temp_directory(ec);
+    }
+    return m_path;
+  }
+
+private:
+  std::string m_path;
+};
+
+DatabaseSettings GetDatabaseSettings()
+{
+  static CBenchFolder folder;
+
+  DatabaseSettings settings;
+  settings.host = GetEnvironment("KODI_BENCH_MYSQL_HOST");
+  if (!settings.host.empty())
+  {
+    settings.type = "mysql";
+    settings.port = GetEnvironment("KODI_BENCH_MYSQL_PORT");
+    settings.user = GetEnvironment("KODI_BENCH_MYSQL_USER");
+    settings.pass = GetEnvironment("KODI_BENCH_MYSQL_PASS");
+  }
+  else
+  {
+    settings.type = "sqlite3";
+    settings.host = folder.Get();
+  }
+  return settings;
+}
+
+/*!
+ * \brief Connect to a generated library, generate it on the first use in this run.
+ */
+template<class TDatabase>
+class CBenchLibrary : public TDatabase
+{
+public:
+  bool OpenLibrary(const std::string& name, int size)
+  {
+    static std::set<std::string> generated;
+
+    const std::string dbName = StringUtils::Format("KodiBench{}{}", name, size);
+    const DatabaseSettings settings = GetDatabaseSettings();
+    if (this->Connect(dbName, settings, true) != CDatabase::ConnectionState::STATE_CONNECTED)
+      return false;
+    if (generated.contains(dbName))
+      return true;
+
+    // left by an earlier run, possibly of another version
+    if (settings.type == "mysql" && !IsEmpty())
+    {
+      this->m_pDB->drop();
+      this->Close();
+      if (this->Connect(dbName, settings, true) != CDatabase::ConnectionState::STATE_CONNECTED)
+        return false;
+    }
+
+    // like the scanners, all in one transaction
+    this->BeginTransaction();
+    Generate(size);
+    if (!this->CommitTransaction())
+      return false;
+
+    generated.insert(dbName);
+    return true;
+  }
+
+protected:
+  virtual bool IsEmpty() = 0;
+  virtual void Generate(int size) = 0;
+};
+
+class CBenchVideoLibrary : public CBenchLibrary<CVideoDatabase>
+{
+public:
+  enum class Content
+  {
+    MOVIES,
+    TVSHOWS,
+  };
+
+  explicit CBenchVideoLibrary(Content content) : m_content(content) {}
+
+  static constexpr int SEASONS = 2;
+  static constexpr int EPISODES = 10;
+
+protected:
+  bool IsEmpty() override { return !HasContent(); }
+
+  void Generate(int size) override
+  {
+    if (m_content == Content::MOVIES)
+    {
+      for (int i = 0; i < size; ++i)
+        GenerateMovie(i);
+    }
+    else
+    {
+      for (int i = 0; i < size; ++i)
+        GenerateTvShow(i);
+    }
+  }
+
+private:
+  static void FillDetails(CVideoInfoTag& details, int i)
+  {
+    details.SetYear(1950 + i % 75);
+    details.m_dateAdded = CDateTime(2000 + i % 25, 1 + i % 12, 1 + i % 28, 12, 0, 0);
+    details.m_strPlot = StringUtils::Format("The plot of item {}, long enough to be read from the "
+                                            "database as a real plot would be.",
+                                            i);
+    details.m_genre = std::vector<std::string>{GENRES[i % std::size(GENRES)],
+                                               GENRES[(i / 7) % std::size(GENRES)]};
+    details.m_studio = std::vector<std::string>{STUDIOS[i % std::size(STUDIOS)]};
+    details.m_director = {StringUtils::Format("Director {}", i % 5000)};
+    details.m_writingCredits = {StringUtils::Format("Writer {}", i % 7000)};
+    for (int order = 0; order < 10; ++order)
+    {
+      SActorInfo actor;
+      actor.strName = StringUtils::Format("Actor {}", (i * 7 + order * 131) % 100000);
+      actor.strRole = StringUtils::Format("Role {}", order);
+      actor.order = order;
+      details.m_cast.emplace_back(std::move(actor));
+    }
+    details.SetRating(static_cast<float>(i % 100) / 10.0f, i % 10000, "themoviedb", true);
+    details.SetUniqueID(StringUtils::Format("tt{:07}", i), "imdb", true);
+  }
+
+  void GenerateMovie(int i)
+  {
+    CVideoInfoTag details;
+    details.m_strTitle = StringUtils::Format("The Movie {}", i);
+    details.m_basePath = StringUtils::Format("/media/movies/The Movie {}/", i);
+    details.m_strFileNameAndPath = details.m_basePath + "movie.mkv";
+    FillDetails(details, i);
+    if (i % 10 < 3)
+      details.m_set.SetTitle(StringUtils::Format("Collection {}", i / 10));
+    if (i % 3 == 0)
+      details.m_tags = {"Favourites"};
+
+    SetDetailsForMovie(details, {{"poster", details.m_basePath + "poster.jpg"}});
+  }
+
+  void GenerateTvShow(int i)
+  {
+    CVideoInfoTag show;
+    show.m_strTitle = StringUtils::Format("The Show {}", i);
+    show.m_strShowTitle = show.m_strTitle;
+    show.m_basePath = StringUtils::Format("/media/tvshows/The Show {}/", i);
+    show.m_strFileNameAndPath = show.m_basePath;
+    FillDetails(show, i);
+
+    const int idShow = SetDetailsForTvShow({show.m_basePath}, show,
+                                           {{"poster", show.m_basePath + "poster.jpg"}}, {});
+    if (idShow < 0)
+      return;
+
+    for (int season = 1; season <= SEASONS; ++season)
+    {
+      for (int episode = 1; episode <= EPISODES; ++episode)
+      {
+        CVideoInfoTag details;
+        details.m_strTitle = StringUtils::Format("Episode {}", episode);
+        details.m_strShowTitle = show.m_strTitle;
+        details.m_iSeason = season;
+        details.m_iEpisode = episode;
+        details.m_basePath = show.m_basePath;
+        details.m_strFileNameAndPath =
+            StringUtils::Format("{}S{:02}E{:02}.mkv", show.m_basePath, season, episode);
+        details.m_dateAdded = show.m_dateAdded;
+        details.m_director = show.m_director;
+        details.m_cast.assign(show.m_cast.begin(), show.m_cast.begin() + 3);
+        SetDetailsForEpisode(details, {{"thumb", details.m_strFileNameAndPath + ".jpg"}}, idShow);
+      }
+    }
+  }
+
+  Content m_content;
+};
+
+class CBenchMusicLibrary : public CBenchLibrary<CMusicDatabase>
+{
+public:
+  static constexpr int SONGS_PER_ALBUM = 10;
+  static constexpr int ALBUMS_PER_ARTIST = 5;
+
+protected:
+  bool IsEmpty() override { return GetSongsCount() == 0; }
+
+  void Generate(int size) override
+  {
+    for (int i = 0; i < size / SONGS_PER_ALBUM; ++i)
+      GenerateAlbum(i);
+  }
+
+private:
+  void GenerateAlbum(int i)
+  {
+    const int artist = i / ALBUMS_PER_ARTIST;
+    const std::string genre = GENRES[artist % std::size(GENRES)];
+
+    CAlbum album;
+    album.strAlbum = StringUtils::Format("Album {}", i);
+    album.strArtistDesc = StringUtils::Format("Artist {}", artist);
+    album.artistCredits.emplace_back(album.strArtistDesc);
+    album.genre = {genre};
+    album.strReleaseDate = std::to_string(1960 + i % 65);
+    album.strPath = StringUtils::Format("/media/music/Artist {}/Album {}/", artist, i);
+    album.art = {{"thumb", album.strPath + "folder.jpg"}};
+
+    for (int track = 1; track <= SONGS_PER_ALBUM; ++track)
+    {
+      CSong song;
+      song.strTitle = StringUtils::Format("Song {} of album {}", track, i);
+      song.strFileName = StringUtils::Format("{}{:02}.flac", album.strPath, track);
+      song.strArtistDesc = album.strArtistDesc;
+      song.artistCredits.emplace_back(album.strArtistDesc);
+      // every third song has a guest
+      if (track % 3 == 0)
+        song.artistCredits.emplace_back(StringUtils::Format("Artist {}", artist + 1));
+      song.genre = album.genre;
+      song.iTrack = (1 << 16) + track;
+      song.iDuration = 180 + (i + track) % 240;
+      song.strReleaseDate = album.strReleaseDate;
+      song.iTimesPlayed = (i + track) % 5;
+      song.dateAdded = CDateTime(2000 + i % 25, 1 + i % 12, 1 + i % 28, 12, 0, 0);
+      album.songs.emplace_back(std::move(song));
+    }
+
+    AddAlbum(album, -1);
+  }
+};
+
+SortDescription GetTitleSorting()
+{
+  SortDescription sorting;
+  sorting.sortBy = SortBy::TITLE;
+  sorting.sortAttributes = SortAttributeIgnoreArticle;
+  return sorting;
+}
+
+bool OpenMovies(benchmark::State& state, CBenchVideoLibrary& db)
+{
+  if (!db.OpenLibrary("Movies", static_cast<int>(state.range(0))))
+  {
+    state.SkipWithError("unable to create the library");
+    return false;
+  }
+  return true;
+}
+
+void BM_VideoDatabase_GetMoviesNav(benchmark::State& state)
+{
+  CBenchVideoLibrary db(CBenchVideoLibrary::Content::MOVIES);
+  if (!OpenMovies(state, db))
+    return;
+
+  const SortDescription sorting = GetTitleSorting();
+  for (auto _ : state)
+  {
+    CFileItemList items;
+    db.GetMoviesNav("videodb://movies/titles/", items, -1, -1, -1, -1, -1, -1, -1, -1, sorting);
+    benchmark::DoNotOptimize(items.Size());
+  }
+}
+
+void BM_VideoDatabase_GetMoviesNavByGenre(benchmark::State& state)
+{
+  CBenchVideoLibrary db(CBenchVideoLibrary::Content::MOVIES);
+  if (!OpenMovies(state, db))
+    return;
+
+  const SortDescription sorting = GetTitleSorting();
+  for (auto _ : state)
+  {
+    CFileItemList items;
+    db.GetMoviesNav("videodb://movies/genres/1/", items, 1, -1, -1, -1, -1, -1, -1, -1, sorting);
+    benchmark::DoNotOptimize(items.Size());
+  }
+}
+
+void BM_VideoDatabase_GetMoviesNavSmartPlaylist(benchmark::State& state)
+{
+  CBenchVideoLibrary db(CBenchVideoLibrary::Content::MOVIES);
+  if (!OpenMovies(state, db))
+    return;
+
+  // a typical unwatched recent drama playlist
+  CVideoDbUrl url;
+  url.FromString("videodb://movies/titles/");
+  url.AddOption("xsp", R"({"type":"movies","rules":{"and":[)"
+                       R"({"field":"genre","operator":"is","value":["Drama"]},)"
+                       R"({"field":"year","operator":"greaterthan","value":["1990"]},)"
+                       R"({"field":"playcount","operator":"is","value":["0"]}]}})");
+  const std::string path = url.ToString();
+  const SortDescription sorting = GetTitleSorting();
+  for (auto _ : state)
+  {
+    CFileItemList items;
+    db.GetMoviesNav(path, items, -1, -1, -1, -1, -1, -1, -1, -1, sorting);
+    benchmark::DoNotOptimize(items.Size());
+  }
+}
+
+void BM_VideoDatabase_GetMoviesJSONRPC(benchmark::State& state)
+{
+  CBenchVideoLibrary db(CBenchVideoLibrary::Content::MOVIES);
+  if (!OpenMovies(state, db))
+    return;
+
+  // VideoLibrary.GetMovies of a remote listing the whole library page by page
+  const std::set<std::string, std::less<>> fields = {"title", "year", "rating", "playcount",
+                                                     "file", "genre"};
+  SortDescription sorting = GetTitleSorting();
+  sorting.limitStart = 0;
+  sorting.limitEnd = 500;
+  for (auto _ : state)
+  {
+    CVariant result;
+    int total = 0;
+    db.GetMoviesByWhereJSON(fields, "videodb://movies/titles/", result, total, sorting);
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+void BM_VideoDatabase_GetTvShowsNav(benchmark::State& state)
+{
+  CBenchVideoLibrary db(CBenchVideoLibrary::Content::TVSHOWS);
+  if (!db.OpenLibrary("TvShows", static_cast<int>(state.range(0))))
+  {
+    state.SkipWithError("unable to create the library");
+    return;
+  }
+
+  const SortDescription sorting = GetTitleSorting();
+  for (auto _ : state)
+  {
+    CFileItemList items;
+    db.GetTvShowsNav("videodb://tvshows/titles/", items, -1, -1, -1, -1, -1, -1, sorting);
+    benchmark::DoNotOptimize(items.Size());
+  }
+}
+
+void BM_VideoDatabase_GetEpisodesNav(benchmark::State& state)
+{
+  CBenchVideoLibrary db(CBenchVideoLibrary::Content::TVSHOWS);
+  if (!db.OpenLibrary("TvShows", static_cast<int>(state.range(0))))
+  {
+    state.SkipWithError("unable to create the library");
+    return;
+  }
+
+  // the seasons of a show in the middle of the library
+  const int idShow = static_cast<int>(state.range(0) / 2 + 1);
+  for (auto _ : state)
+  {
+    CFileItemList items;
+    db.GetEpisodesNav(StringUtils::Format("videodb://tvshows/titles/{}/1/", idShow), items, -1,
+                      -1, -1, -1, idShow, 1);
+    benchmark::DoNotOptimize(items.Size());
+  }
+}
+
+bool OpenSongs(benchmark::State& state, CBenchMusicLibrary& db)
+{
+  if (!db.OpenLibrary("Songs", static_cast<int>(state.range(0))))
+  {
+    state.SkipWithError("unable to create the library");
+    return false;
+  }
+  return true;
+}
+
+void BM_MusicDatabase_GetArtistsNav(benchmark::State& state)
+{
+  CBenchMusicLibrary db;
+  if (!OpenSongs(state, db))
+    return;
+
+  SortDescription sorting;
+  sorting.sortBy = SortBy::ARTIST;
+  sorting.sortAttributes = SortAttributeIgnoreArticle;
+  for (auto _ : state)
+  {
+    CFileItemList items;
+    db.GetArtistsNav("musicdb://artists/", items, sorting, true);
+    benchmark::DoNotOptimize(items.Size());
+  }
+}
+
+void BM_MusicDatabase_GetAlbumsNav(benchmark::State& state)
+{
+  CBenchMusicLibrary db;
+  if (!OpenSongs(state, db))
+    return;
+
+  SortDescription sorting;
+  sorting.sortBy = SortBy::ALBUM;
+  sorting.sortAttributes = SortAttributeIgnoreArticle;
+  for (auto _ : state)
+  {
+    CFileItemList items;
+    db.GetAlbumsNav("musicdb://albums/", items, sorting);
+    benchmark::DoNotOptimize(items.Size());
+  }
+}
+
+void BM_MusicDatabase_GetSongsNavOfArtist(benchmark::State& state)
+{
+  CBenchMusicLibrary db;
+  if (!OpenSongs(state, db))
+    return;
+
+  // an artist in the middle of the library, the blank artist has the first id
+  const int idArtist = static_cast<int>(
+      state.range(0) / CBenchMusicLibrary::SONGS_PER_ALBUM / CBenchMusicLibrary::ALBUMS_PER_ARTIST /
+          2 +
+      2);
+  SortDescription sorting;
+  sorting.sortBy = SortBy::TRACK_NUMBER;
+  for (auto _ : state)
+  {
+    CFileItemList items;
+    db.GetSongsNav(StringUtils::Format("musicdb://artists/{}/-1/", idArtist), items, sorting, -1,
+                   idArtist, -1);
+    benchmark::DoNotOptimize(items.Size());
+  }
+}
+
+void BM_MusicDatabase_GetSongsSmartPlaylist(benchmark::State& state)
+{
+  CBenchMusicLibrary db;
+  if (!OpenSongs(state, db))
+    return;
+
+  CMusicDbUrl url;
+  url.FromString("musicdb://songs/");
+  url.AddOption("xsp", R"({"type":"songs","rules":{"and":[)"
+                       R"({"field":"genre","operator":"is","value":["Rock"]},)"
+                       R"({"field":"playcount","operator":"lessthan","value":["2"]}]},)"
+                       R"("order":{"method":"random"},"limit":50})");
+  const std::string path = url.ToString();
+  for (auto _ : state)
+  {
+    CFileItemList items;
+    db.GetSongsFullByWhere(path, items, SortDescription(), CDatabase::Filter(), true);
+    benchmark::DoNotOptimize(items.Size());
+  }
+}
+} // namespace
+
+// sizes of a small and of a huge library
+BENCHMARK(BM_VideoDatabase_GetMoviesNav)->Arg(1000)->Arg(50000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_VideoDatabase_GetMoviesNavByGenre)
+    ->Arg(1000)
+    ->Arg(50000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_VideoDatabase_GetMoviesNavSmartPlaylist)
+    ->Arg(1000)
+    ->Arg(50000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_VideoDatabase_GetMoviesJSONRPC)
+    ->Arg(1000)
+    ->Arg(50000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_VideoDatabase_GetTvShowsNav)->Arg(100)->Arg(5000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_VideoDatabase_GetEpisodesNav)->Arg(100)->Arg(5000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MusicDatabase_GetArtistsNav)->Arg(10000)->Arg(500000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MusicDatabase_GetAlbumsNav)->Arg(10000)->Arg(500000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MusicDatabase_GetSongsNavOfArtist)
+    ->Arg(10000)
+    ->Arg(500000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MusicDatabase_GetSongsSmartPlaylist)
+    ->Arg(10000)
+    ->Arg(500000)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,79 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "threads/SharedSection.h"
+
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+constexpr int VALUES = 64;
+
+/*!
+ * \brief A settings like map behind a reader-writer lock, shared by all threads of a run.
+ */
+template<class Section>
+struct CGuardedValues
+{
+  CGuardedValues()
+  {
+    for (int i = 0; i < VALUES; ++i)
+      values.emplace("setting." + std::to_string(i), i);
+  }
+
+  mutable Section section;
+  std::map<std::string, int> values;
+};
+
+/*!
+ * \brief Several threads read values under a shared lock, every WRITE_EVERY-th access of a
+ * thread changes one under the exclusive lock instead. Arguments: WRITE_EVERY, 0 only reads.
+ */
+template<class Section>
+void BM_SharedSection_ReadMostly(benchmark::State& state)
+{
+  static CGuardedValues<Section> guarded;
+  const int writeEvery = static_cast<int>(state.range(0));
+  const std::string key = "setting." + std::to_string(state.thread_index() % VALUES);
+
+  int access = 0;
+  for (auto _ : state)
+  {
+    if (writeEvery && ++access % writeEvery == 0)
+    {
+      std::unique_lock lock(guarded.section);
+      guarded.values[key]++;
+    }
+    else
+    {
+      std::shared_lock lock(guarded.section);
+      benchmark::DoNotOptimize(guarded.values.find(key)->second);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+// std::shared_mutex is the reference, it doesn't allow the nested locks CSharedSection supports
+BENCHMARK_TEMPLATE(BM_SharedSection_ReadMostly, CSharedSection)
+    ->Arg(0)
+    ->Arg(100)
+    ->Arg(10)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SharedSection_ReadMostly, std::shared_mutex)
+    ->Arg(0)
+    ->Arg(100)
+    ->Arg(10)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
@@ -0,0 +1,82 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/SortUtils.h"
+#include "utils/StringUtils.h"
+#include "utils/Variant.h"
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+SortItems CreateItems(size_t count)
+{
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> year(1950, 2025);
+  std::uniform_int_distribution<int> number(0, 99999);
+
+  SortItems items;
+  items.reserve(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    auto item = std::make_shared<SortItem>();
+    (*item)[Field::LABEL] = StringUtils::Format("The Movie {} Part {}", number(rng), i % 7);
+    (*item)[Field::TITLE] = (*item)[Field::LABEL];
+    (*item)[Field::SORT_TITLE] = (*item)[Field::LABEL];
+    (*item)[Field::YEAR] = year(rng);
+    (*item)[Field::DATE_ADDED] = StringUtils::Format("{}-01-01 00:00:00", year(rng));
+    items.push_back(item);
+  }
+  return items;
+}
+
+void SortItemsBy(benchmark::State& state, SortBy sortBy, SortAttribute attributes)
+{
+  const SortItems source = CreateItems(static_cast<size_t>(state.range(0)));
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    SortItems items;
+    items.reserve(source.size());
+    for (const auto& item : source)
+      items.push_back(std::make_shared<SortItem>(*item));
+    state.ResumeTiming();
+
+    SortUtils::Sort(sortBy, SortOrder::ASCENDING, attributes, items);
+    benchmark::DoNotOptimize(items.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SortUtils_Label(benchmark::State& state)
+{
+  SortItemsBy(state, SortBy::LABEL, SortAttributeNone);
+}
+
+void BM_SortUtils_LabelIgnoreArticle(benchmark::State& state)
+{
+  SortItemsBy(state, SortBy::LABEL, SortAttributeIgnoreArticle);
+}
+
+void BM_SortUtils_Year(benchmark::State& state)
+{
+  SortItemsBy(state, SortBy::YEAR, SortAttributeNone);
+}
+
+void BM_SortUtils_DateAdded(benchmark::State& state)
+{
+  SortItemsBy(state, SortBy::DATE_ADDED, SortAttributeNone);
+}
+} // namespace
+
+BENCHMARK(BM_SortUtils_Label)->Range(64, 16384);
+BENCHMARK(BM_SortUtils_LabelIgnoreArticle)->Range(64, 16384);
+BENCHMARK(BM_SortUtils_Year)->Range(64, 16384);
+BENCHMARK(BM_SortUtils_DateAdded)->Range(64, 16384);
@@ -0,0 +1,161 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/StringUtils.h"
+#include "utils/WordSearchIndex.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+const std::string LONG_TEXT =
+    "The Lord of the Rings: The Fellowship of the Ring (2001) [Extended Edition] "
+    "1080p BluRay x264 DTS-HD MA 6.1 - Directed by Peter Jackson";
+
+void BM_StringUtils_ToLower(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    std::string str(LONG_TEXT);
+    StringUtils::ToLower(str);
+    benchmark::DoNotOptimize(str.data());
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(LONG_TEXT.size()));
+}
+
+void BM_StringUtils_EqualsNoCase(benchmark::State& state)
+{
+  const std::string other = StringUtils::ToUpper(LONG_TEXT);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(StringUtils::EqualsNoCase(LONG_TEXT, other));
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(LONG_TEXT.size()));
+}
+
+void BM_StringUtils_Split(benchmark::State& state)
+{
+  const std::string genres = "Action / Adventure / Drama / Fantasy / Science Fiction / Thriller";
+  for (auto _ : state)
+  {
+    std::vector<std::string> parts = StringUtils::Split(genres, " / ");
+    benchmark::DoNotOptimize(parts.data());
+  }
+}
+
+void BM_StringUtils_Replace(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    std::string str(LONG_TEXT);
+    benchmark::DoNotOptimize(StringUtils::Replace(str, "the", "a"));
+  }
+}
+
+void BM_StringUtils_Trim(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    std::string str = "   \t " + LONG_TEXT + " \r\n  ";
+    StringUtils::Trim(str);
+    benchmark::DoNotOptimize(str.data());
+  }
+}
+
+void BM_StringUtils_FindWords(benchmark::State& state)
+{
+  for (auto _ : state)
+    benchmark::DoNotOptimize(StringUtils::FindWords(LONG_TEXT, "jackson"));
+}
+
+void BM_StringUtils_ToLowerUtf8(benchmark::State& state)
+{
+  const std::string text = "Amélie - Le Fabuleux Destin d'Amélie Poulain (2001) Ça, Ольга, 東京物語";
+  for (auto _ : state)
+    benchmark::DoNotOptimize(StringUtils::ToLower(text));
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+void BM_StringUtils_FilterList(benchmark::State& state)
+{
+  // A filter typed in a list of titles, few of them match
+  std::vector<std::string> titles;
+  titles.reserve(1000);
+  for (int i = 0; i < 1000; ++i)
+    titles.emplace_back(StringUtils::Format("The Movie Title Number {} - Director's Cut", i));
+  titles[500] = "The Lord of the Rings";
+
+  for (auto _ : state)
+  {
+    size_t matches = 0;
+    for (const auto& title : titles)
+      matches += StringUtils::FindWords(title, "rings") != std::string::npos;
+    benchmark::DoNotOptimize(matches);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(titles.size()));
+}
+
+void BM_StringUtils_FilterListTyping(benchmark::State& state)
+{
+  // Each keystroke of a filter typed in a list of 50000 titles, with or without the index
+  const bool useIndex = state.range(0) != 0;
+  std::vector<std::string> titles;
+  titles.reserve(50000);
+  for (int i = 0; i < 50000; ++i)
+    titles.emplace_back(StringUtils::Format("The Movie Title Number {} - Director's Cut", i));
+  titles[25000] = "The Lord of the Rings";
+
+  CWordSearchIndex index;
+  for (size_t i = 0; i < titles.size(); ++i)
+    index.Set(i, titles[i]);
+
+  const std::string filter = "the lord";
+  for (auto _ : state)
+  {
+    size_t matches = 0;
+    for (size_t length = 1; length <= filter.size(); ++length)
+    {
+      const std::string_view word(filter.data(), length);
+      if (useIndex)
+      {
+        for (size_t i = 0; i < titles.size(); ++i)
+          index.Set(i, titles[i]);
+        matches += index.Find(word).size();
+      }
+      else
+      {
+        for (const auto& title : titles)
+          matches += StringUtils::FindWords(title, word) != std::string::npos;
+      }
+    }
+    benchmark::DoNotOptimize(matches);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(titles.size()));
+}
+
+void BM_StringUtils_AlphaNumericCompare(benchmark::State& state)
+{
+  const std::wstring left = L"Episode 10 - The Long Night";
+  const std::wstring right = L"Episode 9 - The Long Night";
+  for (auto _ : state)
+    benchmark::DoNotOptimize(StringUtils::AlphaNumericCompare(left, right));
+}
+} // namespace
+
+BENCHMARK(BM_StringUtils_ToLower);
+BENCHMARK(BM_StringUtils_EqualsNoCase);
+BENCHMARK(BM_StringUtils_Split);
+BENCHMARK(BM_StringUtils_Replace);
+BENCHMARK(BM_StringUtils_Trim);
+BENCHMARK(BM_StringUtils_FindWords);
+BENCHMARK(BM_StringUtils_ToLowerUtf8);
+BENCHMARK(BM_StringUtils_FilterList);
+BENCHMARK(BM_StringUtils_FilterListTyping)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StringUtils_AlphaNumericCompare);
@@ -0,0 +1,47 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "BenchUtils.h"
+
+#include "utils/StringUtils.h"
+#include "utils/Variant.h"
+
+CVariant KODI::BENCH::CreateVariantMovieList(int count)
+{
+  CVariant movies(CVariant::VariantTypeArray);
+  for (int i = 0; i < count; ++i)
+  {
+    CVariant movie(CVariant::VariantTypeObject);
+    movie["movieid"] = i;
+    movie["label"] = StringUtils::Format("Movie number {}", i);
+    movie["title"] = movie["label"];
+    movie["year"] = 1950 + i % 75;
+    movie["rating"] = 5.0 + (i % 50) / 10.0;
+    movie["playcount"] = i % 3;
+    movie["file"] = StringUtils::Format("smb://nas/movies/Movie {0}/Movie {0}.mkv", i);
+
+    CVariant genres(CVariant::VariantTypeArray);
+    genres.push_back("Action");
+    genres.push_back("Drama");
+    movie["genre"] = genres;
+
+    CVariant art(CVariant::VariantTypeObject);
+    art["poster"] = StringUtils::Format("image://smb%3a%2f%2fnas%2fmovies%2fposter{}.jpg/", i);
+    art["fanart"] = StringUtils::Format("image://smb%3a%2f%2fnas%2fmovies%2ffanart{}.jpg/", i);
+    movie["art"] = art;
+
+    movies.push_back(movie);
+  }
+
+  CVariant result(CVariant::VariantTypeObject);
+  result["limits"]["start"] = 0;
+  result["limits"]["end"] = count;
+  result["limits"]["total"] = count;
+  result["movies"] = movies;
+  return result;
+}
@@ -0,0 +1,19 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+class CVariant;
+
+namespace KODI::BENCH
+{
+/*!
+ * \brief Create a JSON-RPC like "movies" result with the given number of entries.
+ */
+CVariant CreateVariantMovieList(int count);
+} // namespace KODI::BENCH
@@ -0,0 +1,67 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "BenchUtils.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+void BM_Variant_CopyScalar(benchmark::State& state)
+{
+  const CVariant source("The quick brown fox jumps over the lazy dog");
+  for (auto _ : state)
+  {
+    CVariant copy(source);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+void BM_Variant_CopyObject(benchmark::State& state)
+{
+  const CVariant source = KODI::BENCH::CreateVariantMovieList(static_cast<int>(state.range(0)));
+  for (auto _ : state)
+  {
+    CVariant copy(source);
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Variant_MoveObject(benchmark::State& state)
+{
+  CVariant source = KODI::BENCH::CreateVariantMovieList(static_cast<int>(state.range(0)));
+  for (auto _ : state)
+  {
+    CVariant moved(std::move(source));
+    source = std::move(moved);
+    benchmark::DoNotOptimize(source);
+  }
+}
+
+void BM_Variant_Serialize(benchmark::State& state)
+{
+  const CVariant source = KODI::BENCH::CreateVariantMovieList(static_cast<int>(state.range(0)));
+  std::string output;
+  for (auto _ : state)
+  {
+    CJSONVariantWriter::Write(source, output, true);
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(output.size()));
+}
+} // namespace
+
+BENCHMARK(BM_Variant_CopyScalar);
+BENCHMARK(BM_Variant_CopyObject)->Range(8, 4096);
+BENCHMARK(BM_Variant_MoveObject)->Range(8, 4096);
+BENCHMARK(BM_Variant_Serialize)->Range(8, 4096);
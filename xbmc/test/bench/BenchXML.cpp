@@ -0,0 +1,83 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/StringUtils.h"
+#include "utils/XBMCTinyXML.h"
+#include "utils/XBMCTinyXML2.h"
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+// a skin include file like the ones of the default skin, with entities in the conditions
+std::string CreateSkinXml(int count)
+{
+  std::string xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<includes>\n";
+  for (int i = 0; i < count; ++i)
+  {
+    xml += StringUtils::Format(
+        "  <include name=\"Item{0}\">\n"
+        "    <control type=\"group\" id=\"{0}\">\n"
+        "      <visible>Control.HasFocus({0}) &amp; !String.IsEmpty(ListItem.Label)</visible>\n"
+        "      <animation effect=\"fade\" time=\"200\">WindowOpen</animation>\n"
+        "      <control type=\"label\">\n"
+        "        <left>{0}</left>\n"
+        "        <label>$INFO[ListItem.Label] &#8226; $INFO[ListItem.Year]</label>\n"
+        "      </control>\n"
+        "    </control>\n"
+        "  </include>\n",
+        i);
+  }
+  return xml + "</includes>\n";
+}
+
+// a scraper result, with unescaped '&' in its urls
+std::string CreateScraperXml(int count)
+{
+  std::string xml = "<details>\n";
+  for (int i = 0; i < count; ++i)
+  {
+    xml += StringUtils::Format(
+        "  <thumb aspect=\"poster\" preview=\"https://image.example.org/w500/{0}.jpg\">"
+        "https://image.example.org/original/{0}.jpg?api_key=0123456789&language=en</thumb>\n",
+        i);
+  }
+  return xml + "</details>\n";
+}
+
+void BM_TinyXML_Parse(benchmark::State& state, std::string (*create)(int))
+{
+  const std::string xml = create(static_cast<int>(state.range(0)));
+  for (auto _ : state)
+  {
+    CXBMCTinyXML doc;
+    doc.Parse(xml, TIXML_ENCODING_UTF8);
+    benchmark::DoNotOptimize(doc.RootElement());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * xml.size()));
+}
+
+void BM_TinyXML2_Parse(benchmark::State& state, std::string (*create)(int))
+{
+  const std::string xml = create(static_cast<int>(state.range(0)));
+  for (auto _ : state)
+  {
+    CXBMCTinyXML2 doc;
+    doc.Parse(xml);
+    benchmark::DoNotOptimize(doc.RootElement());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * xml.size()));
+}
+} // namespace
+
+BENCHMARK_CAPTURE(BM_TinyXML_Parse, skin, CreateSkinXml)->Arg(100)->Arg(1000);
+BENCHMARK_CAPTURE(BM_TinyXML_Parse, scraper, CreateScraperXml)->Arg(100)->Arg(1000);
+BENCHMARK_CAPTURE(BM_TinyXML2_Parse, skin, CreateSkinXml)->Arg(100)->Arg(1000);
+BENCHMARK_CAPTURE(BM_TinyXML2_Parse, scraper, CreateScraperXml)->Arg(100)->Arg(1000);
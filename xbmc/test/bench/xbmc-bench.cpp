@@ -0,0 +1,32 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "application/AppEnvironment.h"
+#include "application/AppParams.h"
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+int main(int argc, char** argv)
+{
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+
+  // logging and settings are needed by most of the code paths under test
+  const auto params = std::make_shared<CAppParams>();
+  params->SetUserDirectoriesLocation(UserDirectoriesLocation::TEST);
+  CAppEnvironment::SetUp(params);
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  CAppEnvironment::TearDown();
+  return 0;
+}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "threads/Thread.h"
+#include "threads/ThreadRegistry.h"
 
 #include <memory>
 #include <string>
@@ -46,6 +47,13 @@ public:
    */
   virtual bool RevertTask() { return true; }
 
+  /*!
+   * \brief Get the CPU time and wakeups of the thread, callable from any thread
+   * \param[out] usage The usage since the thread started
+   * \return false if not supported on this platform
+   */
+  virtual bool GetUsage(ThreadUsage& usage) const { return false; }
+
 protected:
   IThreadImpl(std::thread::native_handle_type handle) : m_handle(handle) {}
 
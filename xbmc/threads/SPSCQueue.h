@@ -0,0 +1,123 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace XbmcThreads
+{
+
+/*!
+ * \brief Bounded, wait-free single-producer/single-consumer queue.
+ *
+ * Exactly one thread may call Push() and exactly one (other) thread may call Pop()/Front().
+ * Empty() and Size() may be called from any thread and return a snapshot. The capacity is
+ * rounded up to the next power of two. Slots are allocated once at construction, so pushing
+ * and popping never touches the heap as long as T itself does not.
+ */
+template<typename T>
+class CSPSCQueue
+{
+public:
+  explicit CSPSCQueue(size_t capacity)
+  {
+    size_t size = 2;
+    while (size < capacity)
+      size <<= 1;
+    m_mask = size - 1;
+    m_slots = std::make_unique<T[]>(size);
+  }
+
+  CSPSCQueue(const CSPSCQueue&) = delete;
+  CSPSCQueue& operator=(const CSPSCQueue&) = delete;
+
+  /*!
+   * \brief Append an element, producer side only.
+   * \return false if the queue is full, value is left untouched in that case
+   */
+  template<typename U>
+  bool Push(U&& value)
+  {
+    const size_t head = m_head.load(std::memory_order_relaxed);
+    if (head - m_tailCache >= Capacity())
+    {
+      m_tailCache = m_tail.load(std::memory_order_acquire);
+      if (head - m_tailCache >= Capacity())
+        return false;
+    }
+
+    m_slots[head & m_mask] = std::forward<U>(value);
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /*!
+   * \brief Access the oldest element without removing it, consumer side only.
+   * \return nullptr if the queue is empty
+   */
+  T* Front()
+  {
+    const size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail == m_headCache)
+    {
+      m_headCache = m_head.load(std::memory_order_acquire);
+      if (tail == m_headCache)
+        return nullptr;
+    }
+    return &m_slots[tail & m_mask];
+  }
+
+  /*!
+   * \brief Remove the oldest element, consumer side only.
+   * \return false if the queue is empty
+   */
+  bool Pop(T& value)
+  {
+    T* front = Front();
+    if (!front)
+      return false;
+
+    value = std::move(*front);
+    *front = T();
+    m_tail.store(m_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool Empty() const
+  {
+    return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+  }
+
+  size_t Size() const
+  {
+    const size_t tail = m_tail.load(std::memory_order_acquire);
+    return m_head.load(std::memory_order_acquire) - tail;
+  }
+
+  size_t Capacity() const { return m_mask + 1; }
+
+private:
+  // keep producer and consumer owned indices on separate cache lines
+  static constexpr size_t CACHE_LINE = 64;
+
+  std::unique_ptr<T[]> m_slots;
+  size_t m_mask = 0;
+
+  alignas(CACHE_LINE) std::atomic<size_t> m_head{0};
+  size_t m_tailCache = 0; // producer's view of m_tail
+
+  alignas(CACHE_LINE) std::atomic<size_t> m_tail{0};
+  size_t m_headCache = 0; // consumer's view of m_head
+};
+
+} // namespace XbmcThreads
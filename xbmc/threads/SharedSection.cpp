@@ -0,0 +1,173 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "SharedSection.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+struct SharedHold
+{
+  const CSharedSection* section;
+  unsigned int count;
+};
+
+// the shared locks of this thread, usually none or a few
+thread_local std::vector<SharedHold> sharedHolds;
+
+std::vector<SharedHold>::iterator FindHold(const CSharedSection* section)
+{
+  return std::ranges::find(sharedHolds, section, &SharedHold::section);
+}
+
+bool HoldsShared(const CSharedSection* section)
+{
+  return FindHold(section) != sharedHolds.end();
+}
+
+void AddHold(const CSharedSection* section)
+{
+  const auto hold = FindHold(section);
+  if (hold != sharedHolds.end())
+    hold->count++;
+  else
+    sharedHolds.push_back({section, 1});
+}
+
+void RemoveHold(const CSharedSection* section)
+{
+  const auto hold = FindHold(section);
+  if (hold != sharedHolds.end() && --hold->count == 0)
+  {
+    *hold = sharedHolds.back();
+    sharedHolds.pop_back();
+  }
+}
+} // namespace
+
+bool CSharedSection::TryAcquireShared()
+{
+  uint32_t state = m_state.load(std::memory_order_relaxed);
+  while (!(state & WRITER))
+  {
+    if (m_state.compare_exchange_weak(state, state + 1, std::memory_order_acquire,
+                                      std::memory_order_relaxed))
+      return true;
+  }
+  return false;
+}
+
+void CSharedSection::lock()
+{
+  if (IsOwner())
+  {
+    m_ownerDepth++;
+    return;
+  }
+
+  std::unique_lock lock(m_mutex);
+  // announce the writer first, new shared locks wait from then on
+  m_cv.wait(lock,
+            [this]() { return !(m_state.fetch_or(WRITER, std::memory_order_acquire) & WRITER); });
+  m_cv.wait(lock, [this]() { return m_state.load(std::memory_order_acquire) == WRITER; });
+
+  m_owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+  m_ownerDepth = 1;
+}
+
+bool CSharedSection::try_lock()
+{
+  if (IsOwner())
+  {
+    m_ownerDepth++;
+    return true;
+  }
+
+  uint32_t state = 0;
+  if (!m_state.compare_exchange_strong(state, WRITER, std::memory_order_acquire,
+                                       std::memory_order_relaxed))
+    return false;
+
+  m_owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+  m_ownerDepth = 1;
+  return true;
+}
+
+void CSharedSection::unlock()
+{
+  if (--m_ownerDepth > 0)
+    return;
+
+  m_owner.store(std::thread::id(), std::memory_order_relaxed);
+  {
+    std::unique_lock lock(m_mutex);
+    m_state.fetch_and(~WRITER, std::memory_order_release);
+  }
+  m_cv.notify_all();
+}
+
+void CSharedSection::lock_shared()
+{
+  if (IsOwner())
+  {
+    m_ownerDepth++;
+    return;
+  }
+
+  if (!TryAcquireShared())
+  {
+    // a waiting writer waits for this thread anyway, making it wait as well would deadlock
+    if (HoldsShared(this))
+      m_state.fetch_add(1, std::memory_order_acquire);
+    else
+    {
+      std::unique_lock lock(m_mutex);
+      m_cv.wait(lock, [this]() { return TryAcquireShared(); });
+    }
+  }
+  AddHold(this);
+}
+
+bool CSharedSection::try_lock_shared()
+{
+  if (IsOwner())
+  {
+    m_ownerDepth++;
+    return true;
+  }
+
+  if (!TryAcquireShared())
+  {
+    if (!HoldsShared(this))
+      return false;
+    m_state.fetch_add(1, std::memory_order_acquire);
+  }
+  AddHold(this);
+  return true;
+}
+
+void CSharedSection::unlock_shared()
+{
+  if (IsOwner())
+  {
+    unlock();
+    return;
+  }
+
+  RemoveHold(this);
+  // the last shared lock leaves while a writer waits
+  if (m_state.fetch_sub(1, std::memory_order_release) == (WRITER | 1))
+  {
+    {
+      std::unique_lock lock(m_mutex);
+    }
+    m_cv.notify_all();
+  }
+}
@@ -8,47 +8,52 @@
 
 #pragma once
 
-#include "threads/Condition.h"
-
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <mutex>
 #include <shared_mutex>
+#include <thread>
 
 /**
  * A CSharedSection is a mutex that satisfies the Shared Lockable concept (see Lockables.h).
+ *
+ * Shared locks only touch an atomic counter as long as no thread holds or waits for the
+ * exclusive lock. A waiting exclusive lock has preference, new shared locks wait until it was
+ * released, so a steady stream of readers can't starve a writer. Two exceptions keep the
+ * nested locking of existing callers working: a thread that already holds a shared lock gets
+ * another one right away, and the thread holding the exclusive lock can lock it again, shared
+ * or exclusive. A lock has to be released by the thread that took it.
  */
 class CSharedSection
 {
-  CCriticalSection sec;
-  XbmcThreads::ConditionVariable actualCv;
+public:
+  CSharedSection() = default;
+  CSharedSection(const CSharedSection&) = delete;
+  CSharedSection& operator=(const CSharedSection&) = delete;
 
-  unsigned int sharedCount = 0;
+  void lock();
+  bool try_lock();
+  void unlock();
 
-public:
-  inline CSharedSection() = default;
+  void lock_shared();
+  bool try_lock_shared();
+  void unlock_shared();
 
-  inline void lock()
-  {
-    std::unique_lock l(sec);
-    while (sharedCount)
-      actualCv.wait(l, [this]() { return sharedCount == 0; });
-    sec.lock();
-  }
-  inline bool try_lock() { return (sec.try_lock() ? ((sharedCount == 0) ? true : (sec.unlock(), false)) : false); }
-  inline void unlock() { sec.unlock(); }
+private:
+  //! Set while a thread holds or waits for the exclusive lock, the other bits count shared locks
+  static constexpr uint32_t WRITER = 1u << 31;
 
-  inline void lock_shared()
-  {
-    std::unique_lock l(sec);
-    sharedCount++;
-  }
-  inline bool try_lock_shared() { return (sec.try_lock() ? sharedCount++, sec.unlock(), true : false); }
-  inline void unlock_shared()
+  bool IsOwner() const
   {
-    std::unique_lock l(sec);
-    sharedCount--;
-    if (!sharedCount)
-    {
-      actualCv.notifyAll();
-    }
+    return m_owner.load(std::memory_order_relaxed) == std::this_thread::get_id();
   }
+  bool TryAcquireShared();
+
+  std::atomic<uint32_t> m_state{0};
+  std::atomic<std::thread::id> m_owner;
+  unsigned int m_ownerDepth{0}; //!< locks of the owning thread, only used by that thread
+
+  std::mutex m_mutex; //!< guards the waits of the slow paths
+  std::condition_variable m_cv;
 };
@@ -0,0 +1,145 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <future>
+#include <optional>
+#include <utility>
+
+/*!
+ * \brief Result of a coroutine returning T.
+ *
+ * The coroutine starts when the task is awaited with co_await from another coroutine, or when
+ * Get() is called from code that is not a coroutine. It runs on the thread that starts it until
+ * it awaits something, and continues on the thread that completes what it awaited. When it
+ * returns, the awaiting coroutine continues on the same thread.
+ */
+template<typename T>
+class CTask
+{
+public:
+  struct promise_type
+  {
+    CTask get_return_object() { return CTask(Handle::from_promise(*this)); }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    struct FinalAwaiter
+    {
+      bool await_ready() const noexcept { return false; }
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+      {
+        const std::coroutine_handle<> continuation = handle.promise().m_continuation;
+        return continuation ? continuation : std::noop_coroutine();
+      }
+      void await_resume() const noexcept {}
+    };
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    void return_value(T value) { m_value.emplace(std::move(value)); }
+    void unhandled_exception() { m_exception = std::current_exception(); }
+
+    std::optional<T> m_value;
+    std::exception_ptr m_exception;
+    std::coroutine_handle<> m_continuation;
+  };
+
+  CTask(CTask&& other) noexcept : m_handle(std::exchange(other.m_handle, {})) {}
+  CTask& operator=(CTask&& other) noexcept
+  {
+    if (this != &other)
+    {
+      if (m_handle)
+        m_handle.destroy();
+      m_handle = std::exchange(other.m_handle, {});
+    }
+    return *this;
+  }
+  CTask(const CTask&) = delete;
+  CTask& operator=(const CTask&) = delete;
+
+  ~CTask()
+  {
+    if (m_handle)
+      m_handle.destroy();
+  }
+
+  bool await_ready() const noexcept { return m_handle.done(); }
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+  {
+    m_handle.promise().m_continuation = awaiting;
+    return m_handle;
+  }
+  T await_resume() { return TakeResult(); }
+
+  /*!
+   * \brief Run the coroutine and block until it returns.
+   * \return the value the coroutine returned, rethrows its exception
+   */
+  T Get()
+  {
+    if (!m_handle.done())
+    {
+      std::promise<void> done;
+      std::future<void> finished = done.get_future();
+      Notify(m_handle, std::move(done));
+      finished.wait();
+    }
+    return TakeResult();
+  }
+
+private:
+  using Handle = std::coroutine_handle<promise_type>;
+
+  explicit CTask(Handle handle) : m_handle(handle) {}
+
+  T TakeResult()
+  {
+    promise_type& promise = m_handle.promise();
+    if (promise.m_exception)
+      std::rethrow_exception(promise.m_exception);
+    return std::move(*promise.m_value);
+  }
+
+  //! Coroutine that runs on its own and destroys itself when done
+  struct Detached
+  {
+    struct promise_type
+    {
+      Detached get_return_object() const noexcept { return {}; }
+      std::suspend_never initial_suspend() const noexcept { return {}; }
+      std::suspend_never final_suspend() const noexcept { return {}; }
+      void return_void() const noexcept {}
+      void unhandled_exception() const noexcept { std::terminate(); }
+    };
+  };
+
+  //! Awaits the task without taking its result
+  struct Completion
+  {
+    bool await_ready() const noexcept { return handle.done(); }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+    {
+      handle.promise().m_continuation = awaiting;
+      return handle;
+    }
+    void await_resume() const noexcept {}
+
+    Handle handle;
+  };
+
+  static Detached Notify(Handle handle, std::promise<void> done)
+  {
+    co_await Completion{handle};
+    done.set_value();
+  }
+
+  Handle m_handle;
+};
@@ -14,6 +14,7 @@
 #include "commons/Exception.h"
 #include "threads/IThreadImpl.h"
 #include "threads/SingleLock.h"
+#include "threads/ThreadRegistry.h"
 #include "utils/log.h"
 
 #include <atomic>
@@ -148,7 +149,11 @@ void CThread::Create(bool bAutoDelete)
 
         pThread->m_StartEvent.Set();
 
-        pThread->Action();
+        {
+          // unregistered before the thread may be deleted below
+          CThreadRegistry::CRegistration registration(*pThread, pThread->m_ThreadName);
+          pThread->Action();
+        }
 
         if (pThread->m_bAutoDelete)
         {
@@ -207,6 +212,11 @@ bool CThread::RevertTask()
   return m_impl->RevertTask();
 }
 
+bool CThread::GetUsage(ThreadUsage& usage) const
+{
+  return m_impl && m_impl->GetUsage(usage);
+}
+
 bool CThread::IsAutoDelete() const
 {
   return m_bAutoDelete;
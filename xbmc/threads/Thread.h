@@ -46,6 +46,7 @@ enum class ThreadTask
 
 class IRunnable;
 class IThreadImpl;
+struct ThreadUsage;
 class CThread
 {
 protected:
@@ -97,6 +98,13 @@ public:
    */
   bool RevertTask();
 
+  /*!
+   * \brief Get the CPU time and wakeups of the running thread (platform dependent)
+   * \param[out] usage The usage since the thread started
+   * \return true for success, false if not supported or not running
+   */
+  bool GetUsage(ThreadUsage& usage) const;
+
   static CThread* GetCurrentThread();
 
   virtual void OnException(){} // signal termination handler
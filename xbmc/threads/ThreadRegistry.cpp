@@ -0,0 +1,185 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ThreadRegistry.h"
+
+#include "threads/CriticalSection.h"
+#include "threads/Thread.h"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <mutex>
+#include <string_view>
+
+namespace
+{
+struct SubsystemPrefix
+{
+  std::string_view prefix;
+  std::string_view subsystem;
+};
+
+// thread names as given to CThread, the first matching prefix wins
+constexpr std::array<SubsystemPrefix, 53> subsystemPrefixes{{
+    {"AESink", "audio"},
+    {"ActiveAE", "audio"},
+    {"PAPlayer", "audio"},
+    {"VideoPlayer", "player"},
+    {"ExternalPlayer", "player"},
+    {"UPnPPlayer", "player"},
+    {"SubtitleLookAhead", "player"},
+    {"DVD", "player"},
+    {"FileCache", "player"},
+    {"TimeshiftBuffer", "player"},
+    {"ShoutcastFile", "player"},
+    {"RefClock", "player"},
+    {"Vaapi", "player"},
+    {"Vdpau", "player"},
+    {"PVR", "pvr"},
+    {"EPG", "pvr"},
+    {"epg-", "pvr"},
+    {"AirPlay", "network"},
+    {"AirTunes", "network"},
+    {"EventServer", "network"},
+    {"TCPServer", "network"},
+    {"UDPClient", "network"},
+    {"UPnP", "network"},
+    {"WSDiscovery", "network"},
+    {"Zeroconf", "network"},
+    {"RSSReader", "network"},
+    {"Announce", "network"},
+    {"JobWorker", "jobs"},
+    {"GUI", "gui"},
+    {"BgPicLoader", "gui"},
+    {"ButtonCaptureDlg", "gui"},
+    {"ControllerSelect", "gui"},
+    {"NewJoystickDlg", "gui"},
+    {"WindowHelper", "gui"},
+    {"CEC", "input"},
+    {"Lirc", "input"},
+    {"PeripEventScan", "input"},
+    {"RemoteControl", "input"},
+    {"keyboard", "input"},
+    {"libinput", "input"},
+    {"RumbleGenerator", "input"},
+    {"ControllerInstaller", "input"},
+    {"FDEventMonitor", "input"},
+    {"CWinEvents", "input"},
+    {"Wayland", "input"},
+    {"LanguageInvoker", "addons"},
+    {"GameLoop", "games"},
+    {"CRetroPlayer", "games"},
+    {"Rewind", "games"},
+    {"LibraryWatcher", "library"},
+    {"MusicInfoScraper", "library"},
+    {"VideoInfoDownloader", "library"},
+    {"ThumbExtractor", "library"},
+}};
+
+struct RegisteredThread
+{
+  std::string name;
+  std::string subsystem;
+  ThreadUsage lastUsage;
+  std::chrono::steady_clock::time_point lastSample;
+};
+
+CCriticalSection& GetSection()
+{
+  static CCriticalSection section;
+  return section;
+}
+
+std::map<CThread*, RegisteredThread>& GetThreads()
+{
+  static std::map<CThread*, RegisteredThread> threads;
+  return threads;
+}
+} // unnamed namespace
+
+void CThreadRegistry::Register(CThread& thread, const std::string& name)
+{
+  RegisteredThread registered{name, GetSubsystem(name), {}, std::chrono::steady_clock::now()};
+  thread.GetUsage(registered.lastUsage);
+
+  std::unique_lock lock(GetSection());
+  GetThreads()[&thread] = std::move(registered);
+}
+
+void CThreadRegistry::Unregister(CThread& thread)
+{
+  std::unique_lock lock(GetSection());
+  GetThreads().erase(&thread);
+}
+
+std::vector<CThreadRegistry::ThreadInfo> CThreadRegistry::Sample()
+{
+  std::vector<ThreadInfo> result;
+
+  // sampled under the lock, so no thread can end and be deleted meanwhile
+  std::unique_lock lock(GetSection());
+  const auto now = std::chrono::steady_clock::now();
+  result.reserve(GetThreads().size());
+  for (auto& [thread, registered] : GetThreads())
+  {
+    ThreadInfo info{registered.name, registered.subsystem};
+    if (!thread->GetUsage(info.usage))
+    {
+      result.push_back(std::move(info));
+      continue;
+    }
+
+    const std::chrono::duration<double> elapsed = now - registered.lastSample;
+    if (elapsed.count() > 0)
+    {
+      const std::chrono::duration<double> cpu = info.usage.cpuTime - registered.lastUsage.cpuTime;
+      info.cpuPercent = std::max(0.0, cpu / elapsed * 100.0);
+      if (info.usage.wakeups >= registered.lastUsage.wakeups)
+        info.wakeupsPerSecond =
+            static_cast<double>(info.usage.wakeups - registered.lastUsage.wakeups) /
+            elapsed.count();
+    }
+
+    registered.lastUsage = info.usage;
+    registered.lastSample = now;
+    result.push_back(std::move(info));
+  }
+
+  std::ranges::sort(result, std::ranges::greater{}, &ThreadInfo::cpuPercent);
+  return result;
+}
+
+std::string CThreadRegistry::GetSubsystem(const std::string& threadName)
+{
+  const auto it = std::ranges::find_if(subsystemPrefixes, [&threadName](const auto& entry)
+                                       { return threadName.starts_with(entry.prefix); });
+  return it != subsystemPrefixes.end() ? std::string(it->subsystem) : "system";
+}
+
+std::vector<CThreadRegistry::ThreadInfo> CThreadRegistry::BySubsystem(
+    const std::vector<ThreadInfo>& threads)
+{
+  std::vector<ThreadInfo> result;
+  for (const ThreadInfo& thread : threads)
+  {
+    auto it = std::ranges::find(result, thread.subsystem, &ThreadInfo::subsystem);
+    if (it == result.end())
+    {
+      result.push_back({thread.subsystem, thread.subsystem});
+      it = result.end() - 1;
+    }
+    it->usage.cpuTime += thread.usage.cpuTime;
+    it->usage.wakeups += thread.usage.wakeups;
+    it->cpuPercent += thread.cpuPercent;
+    it->wakeupsPerSecond += thread.wakeupsPerSecond;
+  }
+
+  std::ranges::sort(result, std::ranges::greater{}, &ThreadInfo::cpuPercent);
+  return result;
+}
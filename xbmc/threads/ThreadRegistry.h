@@ -0,0 +1,78 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class CThread;
+
+/*!
+ * \brief CPU time and wakeups of a thread since it started
+ */
+struct ThreadUsage
+{
+  std::chrono::nanoseconds cpuTime{0}; //!< user and system time
+  uint64_t wakeups = 0; //!< times the thread blocked and was woken up again, 0 if unknown
+};
+
+/*!
+ * \brief The running CThreads with their usage, to find what keeps an idle device busy.
+ *
+ * Threads are tagged with the subsystem their name belongs to. Threads not started through
+ * CThread, like the application thread, aren't listed.
+ */
+class CThreadRegistry
+{
+public:
+  struct ThreadInfo
+  {
+    std::string name;
+    std::string subsystem;
+    ThreadUsage usage;
+    double cpuPercent = 0.0; //!< of one core since the previous Sample()
+    double wakeupsPerSecond = 0.0; //!< since the previous Sample()
+  };
+
+  /*!
+   * \brief Called from the thread itself once started and before it ends
+   */
+  static void Register(CThread& thread, const std::string& name);
+  static void Unregister(CThread& thread);
+
+  /*!
+   * \brief Get the usage of the running threads, the rates are since the previous call.
+   */
+  static std::vector<ThreadInfo> Sample();
+
+  /*!
+   * \brief Subsystem a thread belongs to, by its name
+   */
+  static std::string GetSubsystem(const std::string& threadName);
+
+  /*!
+   * \brief Sum the threads of each subsystem, busiest first
+   */
+  static std::vector<ThreadInfo> BySubsystem(const std::vector<ThreadInfo>& threads);
+
+  class CRegistration
+  {
+  public:
+    CRegistration(CThread& thread, const std::string& name) : m_thread(thread)
+    {
+      Register(thread, name);
+    }
+    ~CRegistration() { Unregister(m_thread); }
+
+  private:
+    CThread& m_thread;
+  };
+};
@@ -0,0 +1,92 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "threads/SPSCQueue.h"
+
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace XbmcThreads;
+
+TEST(TestSPSCQueue, CapacityIsPowerOfTwo)
+{
+  CSPSCQueue<int> queue(100);
+  EXPECT_EQ(128u, queue.Capacity());
+  EXPECT_TRUE(queue.Empty());
+}
+
+TEST(TestSPSCQueue, PushPopOrder)
+{
+  CSPSCQueue<int> queue(4);
+  EXPECT_TRUE(queue.Push(1));
+  EXPECT_TRUE(queue.Push(2));
+  EXPECT_TRUE(queue.Push(3));
+  EXPECT_TRUE(queue.Push(4));
+  EXPECT_FALSE(queue.Push(5));
+  EXPECT_EQ(4u, queue.Size());
+
+  int value = 0;
+  ASSERT_NE(nullptr, queue.Front());
+  EXPECT_EQ(1, *queue.Front());
+  for (int expected = 1; expected <= 4; ++expected)
+  {
+    EXPECT_TRUE(queue.Pop(value));
+    EXPECT_EQ(expected, value);
+  }
+  EXPECT_FALSE(queue.Pop(value));
+  EXPECT_EQ(nullptr, queue.Front());
+  EXPECT_TRUE(queue.Empty());
+}
+
+TEST(TestSPSCQueue, PopReleasesSlot)
+{
+  CSPSCQueue<std::shared_ptr<int>> queue(2);
+  auto value = std::make_shared<int>(42);
+  EXPECT_TRUE(queue.Push(value));
+  EXPECT_EQ(2, value.use_count());
+
+  std::shared_ptr<int> result;
+  EXPECT_TRUE(queue.Pop(result));
+  result.reset();
+  EXPECT_EQ(1, value.use_count());
+}
+
+TEST(TestSPSCQueue, ProducerConsumer)
+{
+  constexpr int COUNT = 100000;
+  CSPSCQueue<int> queue(64);
+
+  std::thread producer(
+      [&queue]()
+      {
+        for (int i = 0; i < COUNT;)
+        {
+          if (queue.Push(i))
+            i++;
+          else
+            std::this_thread::yield();
+        }
+      });
+
+  int expected = 0;
+  while (expected < COUNT)
+  {
+    int value;
+    if (queue.Pop(value))
+    {
+      ASSERT_EQ(expected, value);
+      expected++;
+    }
+    else
+      std::this_thread::yield();
+  }
+  producer.join();
+  EXPECT_TRUE(queue.Empty());
+}
@@ -89,6 +89,22 @@ TEST(TestSharedSection, GetSharedLockWhileTryingExclusiveLock)
   thread waitThread3(l3); // try to get a shared lock
   EXPECT_TRUE(waitForThread(mutex, 2, 10000ms));
   std::this_thread::sleep_for(10ms);
+  EXPECT_TRUE(!l3.haslock); // the waiting exclusive lock goes first
+
+  // a thread that already holds a shared lock gets another one
+  {
+    std::shared_lock<CSharedSection> nested(sec);
+  }
+
+  // let it go
+  l1.unlock(); // the last shared lock leaves.
+
+  EXPECT_TRUE(waitThread1.timed_join(10000ms));
+
+  EXPECT_TRUE(l2.obtainedlock);  // the exclusive lock was captured
+  EXPECT_TRUE(!l2.haslock);  // ... but it doesn't have it anymore
+
+  EXPECT_TRUE(waitForWaiters(event, 1, 10000ms));
   EXPECT_TRUE(l3.haslock);
 
   event.Set();
@@ -96,18 +112,33 @@ TEST(TestSharedSection, GetSharedLockWhileTryingExclusiveLock)
 
   // l3 should have released.
   EXPECT_TRUE(!l3.haslock);
+}
 
-  // but the exclusive lock should still not have happened
-  EXPECT_TRUE(!l2.haslock);  // this thread is waiting ...
-  EXPECT_TRUE(!l2.obtainedlock);  // this thread is waiting ...
+TEST(TestSharedSection, LockWhileHoldingExclusiveLock)
+{
+  CSharedSection sec;
+  std::atomic<long> mutex(0L);
 
-  // let it go
-  l1.unlock(); // the last shared lock leaves.
+  locker<std::shared_lock<CSharedSection>> l1(sec, &mutex);
+  {
+    std::unique_lock<CSharedSection> l2(sec);
+    std::unique_lock<CSharedSection> l3(sec);
+    std::shared_lock<CSharedSection> l4(sec);
 
-  EXPECT_TRUE(waitThread1.timed_join(10000ms));
+    thread waitThread1(l1);
+    EXPECT_TRUE(waitForThread(mutex, 1, 10000ms));
+    std::this_thread::sleep_for(10ms);
+    EXPECT_TRUE(!l1.obtainedlock);
 
-  EXPECT_TRUE(l2.obtainedlock);  // the exclusive lock was captured
-  EXPECT_TRUE(!l2.haslock);  // ... but it doesn't have it anymore
+    l3.unlock();
+    l4.unlock();
+    std::this_thread::sleep_for(10ms);
+    EXPECT_TRUE(!l1.obtainedlock); // still held by l2
+
+    l2.unlock();
+    EXPECT_TRUE(waitThread1.timed_join(10000ms));
+    EXPECT_TRUE(l1.obtainedlock);
+  }
 }
 
 TEST(TestSharedSection, TwoCase)
@@ -0,0 +1,78 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "threads/Event.h"
+#include "threads/Thread.h"
+#include "threads/ThreadRegistry.h"
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+class CBusyThread : public CThread
+{
+public:
+  CBusyThread() : CThread("JobWorkerTest") {}
+  ~CBusyThread() override { StopThread(); }
+
+  CEvent m_started;
+
+protected:
+  void Process() override
+  {
+    m_started.Set();
+    while (!m_bStop)
+    {
+    }
+  }
+};
+
+bool IsListed(const std::vector<CThreadRegistry::ThreadInfo>& threads)
+{
+  return std::ranges::any_of(threads, [](const CThreadRegistry::ThreadInfo& info)
+                             { return info.name == "JobWorkerTest" && info.subsystem == "jobs"; });
+}
+} // namespace
+
+TEST(TestThreadRegistry, Subsystem)
+{
+  EXPECT_EQ("audio", CThreadRegistry::GetSubsystem("ActiveAE"));
+  EXPECT_EQ("player", CThreadRegistry::GetSubsystem("VideoPlayerAudio"));
+  EXPECT_EQ("pvr", CThreadRegistry::GetSubsystem("epg-sync"));
+  EXPECT_EQ("system", CThreadRegistry::GetSubsystem("SomethingElse"));
+}
+
+TEST(TestThreadRegistry, Sample)
+{
+  {
+    CBusyThread thread;
+    thread.Create();
+    ASSERT_TRUE(thread.m_started.Wait(10s));
+
+    CThreadRegistry::Sample();
+    std::this_thread::sleep_for(100ms);
+    const auto threads = CThreadRegistry::Sample();
+    ASSERT_TRUE(IsListed(threads));
+
+    ThreadUsage usage;
+    if (thread.GetUsage(usage))
+    {
+      EXPECT_LT(std::chrono::nanoseconds::zero(), usage.cpuTime);
+      const auto subsystems = CThreadRegistry::BySubsystem(threads);
+      const auto jobs = std::ranges::find(subsystems, "jobs", &CThreadRegistry::ThreadInfo::name);
+      ASSERT_NE(subsystems.end(), jobs);
+      EXPECT_LT(10.0, jobs->cpuPercent);
+    }
+  }
+
+  EXPECT_FALSE(IsListed(CThreadRegistry::Sample()));
+}
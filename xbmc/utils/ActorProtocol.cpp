@@ -17,13 +17,8 @@ using namespace Actor;
 
 void Message::Release()
 {
-  bool skip;
-  origin.Lock();
-  skip = isSync ? !isSyncFini : false;
-  isSyncFini = true;
-  origin.Unlock();
-
-  if (skip)
+  // sender and receiver both release a sync message, the second one frees it
+  if (isSync && !isSyncFini.exchange(true, std::memory_order_acq_rel))
     return;
 
   // free data buffer
@@ -74,31 +69,36 @@ bool Message::Reply(int sig, void *data /* = NULL*/, size_t size /* = 0 */)
   return true;
 }
 
+Protocol::Protocol(std::string name, CEvent* inEvent, CEvent* outEvent)
+  : portName(std::move(name)), containerInEvent(inEvent), containerOutEvent(outEvent)
+{
+  for (size_t slot = 0; slot < MESSAGE_SLOTS; ++slot)
+    messageSlots[slot].reset(new Message(*this, slot));
+}
+
 Protocol::~Protocol()
 {
-  Message *msg;
   Purge();
-  while (!freeMessageQueue.empty())
-  {
-    msg = freeMessageQueue.front();
-    freeMessageQueue.pop();
-    delete msg;
-  }
 }
 
 Message *Protocol::GetMessage()
 {
-  Message *msg;
-
-  std::unique_lock lock(criticalSection);
+  Message* msg = nullptr;
 
-  if (!freeMessageQueue.empty())
+  // start at a different slot each time, concurrent senders rarely try the same one
+  const size_t start = nextSlot.fetch_add(1, std::memory_order_relaxed);
+  for (size_t i = 0; i < MESSAGE_SLOTS; ++i)
   {
-    msg = freeMessageQueue.front();
-    freeMessageQueue.pop();
+    const size_t slot = (start + i) % MESSAGE_SLOTS;
+    if (!slotUsed[slot].load(std::memory_order_relaxed) &&
+        !slotUsed[slot].exchange(true, std::memory_order_acquire))
+    {
+      msg = messageSlots[slot].get();
+      break;
+    }
   }
-  else
-    msg = new Message(*this);
+  if (!msg)
+    msg = new Message(*this, Message::NO_SLOT);
 
   msg->isSync = false;
   msg->isSyncFini = false;
@@ -113,9 +113,10 @@ Message *Protocol::GetMessage()
 
 void Protocol::ReturnMessage(Message *msg)
 {
-  std::unique_lock lock(criticalSection);
-
-  freeMessageQueue.push(msg);
+  if (msg->slot == Message::NO_SLOT)
+    delete msg;
+  else
+    slotUsed[msg->slot].store(false, std::memory_order_release);
 }
 
 bool Protocol::SendOutMessage(int signal,
@@ -10,6 +10,8 @@
 
 #include "threads/CriticalSection.h"
 
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <queue>
@@ -51,7 +53,7 @@ class Message
 public:
   int signal;
   bool isSync = false;
-  bool isSyncFini;
+  std::atomic<bool> isSyncFini;
   bool isOut;
   bool isSyncTimeout;
   size_t payloadSize;
@@ -66,20 +68,26 @@ public:
   bool Reply(int sig, void *data = nullptr, size_t size = 0);
 
 private:
-  explicit Message(Protocol &_origin) noexcept
-    :origin(_origin) {}
+  static constexpr size_t NO_SLOT = static_cast<size_t>(-1);
+
+  Message(Protocol& _origin, size_t _slot) noexcept : origin(_origin), slot(_slot) {}
+
+  size_t slot; //!< slot of the protocol the message lives in, NO_SLOT if allocated on demand
 };
 
 class Protocol
 {
 public:
-  Protocol(std::string name, CEvent* inEvent, CEvent* outEvent)
-    : portName(std::move(name)), containerInEvent(inEvent), containerOutEvent(outEvent)
-  {
-  }
+  Protocol(std::string name, CEvent* inEvent, CEvent* outEvent);
   Protocol(std::string name) : Protocol(std::move(name), nullptr, nullptr) {}
   ~Protocol();
+  /*!
+   * \brief Take a free message, from one of the preallocated slots as long as there is one.
+   *
+   * Doesn't lock, the senders of a port don't contend with each other or with the receiver.
+   */
   Message *GetMessage();
+  //! Put a message back into its slot, wait-free
   void ReturnMessage(Message *msg);
   bool SendOutMessage(int signal,
                       const void* data = nullptr,
@@ -116,8 +124,15 @@ protected:
   CCriticalSection criticalSection;
   std::queue<Message*> outMessages;
   std::queue<Message*> inMessages;
-  std::queue<Message*> freeMessageQueue;
   bool inDefered = false, outDefered = false;
+
+private:
+  // enough for the messages a port has in flight, more are allocated on demand
+  static constexpr size_t MESSAGE_SLOTS = 32;
+
+  std::array<std::unique_ptr<Message>, MESSAGE_SLOTS> messageSlots;
+  std::array<std::atomic<bool>, MESSAGE_SLOTS> slotUsed{};
+  std::atomic<size_t> nextSlot{0};
 };
 
 }
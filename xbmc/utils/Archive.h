@@ -14,6 +14,8 @@
 #include <string>
 #include <vector>
 
+#include "utils/SharedStrings.h"
+
 #define CARCHIVE_BUFFER_MAX 4096
 
 namespace XFILE
@@ -133,6 +135,15 @@ public:
   CArchive& operator>>(std::vector<std::string>& strArray);
   CArchive& operator>>(std::vector<int>& iArray);
 
+  template<typename T>
+  CArchive& operator>>(CSharedValue<T>& value)
+  {
+    T stored;
+    *this >> stored;
+    value = CSharedValue<T>(std::move(stored));
+    return *this;
+  }
+
   bool IsLoading() const;
   bool IsStoring() const;
 
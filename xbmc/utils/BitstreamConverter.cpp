@@ -18,6 +18,14 @@
 #include "HevcSei.h"
 
 #include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 extern "C"
 {
@@ -188,6 +196,35 @@ static int nal_bs_read_ue(nal_bitstream* bs)
 
 static const uint8_t* avc_find_startcode_internal(const uint8_t* p, const uint8_t* end)
 {
+  // a start code can only begin in a block of 16 bytes with a zero in it, most have none
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+  const __m128i zero = _mm_setzero_si128();
+  for (; p + 19 <= end; p += 16)
+  {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    unsigned int zeros = _mm_movemask_epi8(_mm_cmpeq_epi8(block, zero));
+    for (; zeros; zeros &= zeros - 1)
+    {
+      const int i = std::countr_zero(zeros);
+      if (p[i + 1] == 0 && p[i + 2] == 1)
+        return p + i;
+    }
+  }
+#elif defined(__ARM_NEON)
+  for (; p + 19 <= end; p += 16)
+  {
+    const uint8x16_t zeros = vceqq_u8(vld1q_u8(p), vdupq_n_u8(0));
+    const uint64x2_t lanes = vreinterpretq_u64_u8(zeros);
+    if ((vgetq_lane_u64(lanes, 0) | vgetq_lane_u64(lanes, 1)) == 0)
+      continue;
+    for (int i = 0; i < 16; i++)
+    {
+      if (p[i] == 0 && p[i + 1] == 0 && p[i + 2] == 1)
+        return p + i;
+    }
+  }
+#endif
+
   const uint8_t* a = p + 4 - ((intptr_t)p & 3);
 
   for (end -= 3; p < a && p < end; p++)
@@ -323,6 +360,9 @@ CBitstreamConverter::CBitstreamConverter()
   m_convert_bitstream = false;
   m_convertBuffer = NULL;
   m_convertSize = 0;
+  m_convertCapacity = 0;
+  m_convertedInPlace = false;
+  m_convertInPlace = false;
   m_inputBuffer = NULL;
   m_inputSize = 0;
   m_to_annexb = false;
@@ -505,6 +545,8 @@ void CBitstreamConverter::Close()
   if (m_convertBuffer)
     av_free(m_convertBuffer), m_convertBuffer = NULL;
   m_convertSize = 0;
+  m_convertCapacity = 0;
+  m_convertedInPlace = false;
 
   m_extraData = {};
 
@@ -518,14 +560,17 @@ void CBitstreamConverter::Close()
 
 bool CBitstreamConverter::Convert(uint8_t* pData, int iSize)
 {
-  if (m_convertBuffer)
+  // the buffer of the Annex B conversion is kept for the next packets, the others are replaced
+  if (m_convertBuffer && !m_convert_bitstream)
   {
     av_free(m_convertBuffer);
     m_convertBuffer = NULL;
+    m_convertCapacity = 0;
   }
   m_inputSize = 0;
   m_convertSize = 0;
   m_inputBuffer = NULL;
+  m_convertedInPlace = false;
 
   if (pData)
   {
@@ -533,29 +578,16 @@ bool CBitstreamConverter::Convert(uint8_t* pData, int iSize)
     {
       if (m_to_annexb)
       {
-        int demuxer_bytes = iSize;
-        uint8_t* demuxer_content = pData;
-
         if (m_convert_bitstream)
         {
           // convert demuxer packet from bitstream to bytestream (AnnexB)
-          int bytestream_size = 0;
-          uint8_t* bytestream_buff = NULL;
-
-          BitstreamConvert(demuxer_content, demuxer_bytes, &bytestream_buff, &bytestream_size);
-          if (bytestream_buff && (bytestream_size > 0))
-          {
-            m_convertSize = bytestream_size;
-            m_convertBuffer = bytestream_buff;
+          if (BitstreamConvert(pData, iSize) && (m_convertedInPlace || m_convertSize > 0))
             return true;
-          }
-          else
-          {
-            m_convertSize = 0;
-            m_convertBuffer = NULL;
-            CLog::Log(LOGERROR, "CBitstreamConverter::Convert: error converting.");
-            return false;
-          }
+
+          m_convertSize = 0;
+          m_convertedInPlace = false;
+          CLog::Log(LOGERROR, "CBitstreamConverter::Convert: error converting.");
+          return false;
         }
         else
         {
@@ -627,7 +659,7 @@ bool CBitstreamConverter::Convert(uint8_t* pData, int iSize)
 uint8_t* CBitstreamConverter::GetConvertBuffer() const
 {
   if ((m_convert_bitstream || m_convert_bytestream || m_convert_3byteTo4byteNALSize) &&
-      m_convertBuffer != NULL)
+      m_convertBuffer != NULL && !m_convertedInPlace)
     return m_convertBuffer;
   else
     return m_inputBuffer;
@@ -636,7 +668,7 @@ uint8_t* CBitstreamConverter::GetConvertBuffer() const
 int CBitstreamConverter::GetConvertSize() const
 {
   if ((m_convert_bitstream || m_convert_bytestream || m_convert_3byteTo4byteNALSize) &&
-      m_convertBuffer != NULL)
+      m_convertBuffer != NULL && !m_convertedInPlace)
     return m_convertSize;
   else
     return m_inputSize;
@@ -870,10 +902,7 @@ bool CBitstreamConverter::IsSlice(uint8_t unit_type)
   }
 }
 
-bool CBitstreamConverter::BitstreamConvert(uint8_t* pData,
-                                           int iSize,
-                                           uint8_t** poutbuf,
-                                           int* poutbuf_size)
+bool CBitstreamConverter::BitstreamConvert(uint8_t* pData, int iSize)
 {
   // based on h264_mp4toannexb_bsf.c (ffmpeg)
   // which is Copyright (c) 2007 Benoit Fouet <benoit.fouet@free.fr>
@@ -893,6 +922,15 @@ bool CBitstreamConverter::BitstreamConvert(uint8_t* pData,
 
   std::vector<uint8_t> finalPrefixSeiNalu;
 
+  // while every unit is passed on as is, their 4 byte sizes are overwritten with start codes and
+  // the packet is the conversion
+  bool inPlace = m_convertInPlace && m_sps_pps_context.length_size == 4;
+
+  m_convertSize = 0;
+  // the output is the size of the packet unless units are added or grow, like a RPU conversion
+  if (!inPlace)
+    ReserveConvertBuffer(iSize + m_sps_pps_context.size);
+
   switch (m_codec)
   {
     case AV_CODEC_ID_H264:
@@ -941,8 +979,10 @@ bool CBitstreamConverter::BitstreamConvert(uint8_t* pData,
     // prepend only to the first access unit of an IDR picture, if no sps/pps already present
     if (m_sps_pps_context.first_idr && IsIDR(unit_type) && !m_sps_pps_context.idr_sps_pps_seen)
     {
-      BitstreamAllocAndCopy(poutbuf, poutbuf_size, m_sps_pps_context.sps_pps_data,
-                            m_sps_pps_context.size, buf, nal_size, unit_type);
+      if (inPlace)
+        inPlace = LeaveInPlace(pData, buf - m_sps_pps_context.length_size);
+      BitstreamAllocAndCopy(m_sps_pps_context.sps_pps_data, m_sps_pps_context.size, buf, nal_size,
+                            unit_type);
       m_sps_pps_context.first_idr = 0;
     }
     else
@@ -962,8 +1002,9 @@ bool CBitstreamConverter::BitstreamConvert(uint8_t* pData,
       if (m_removeDovi && (unit_type == HEVC_NAL_UNSPEC62 || unit_type == HEVC_NAL_UNSPEC63))
         write_buf = false;
 
-      // Try removing HDR10+ only if the NAL is big enough, optimization
-      if (m_removeHdr10Plus && unit_type == HEVC_NAL_SEI_PREFIX && nal_size >= 7)
+      // Try removing HDR10+ only if the NAL is big enough and has its T.35 header, optimization
+      if (m_removeHdr10Plus && unit_type == HEVC_NAL_SEI_PREFIX && nal_size >= 7 &&
+          CHevcSei::MayContainHdr10Plus(buf, nal_size))
       {
         std::tie(containsHdr10Plus, finalPrefixSeiNalu) =
             CHevcSei::RemoveHdr10PlusFromSeiNalu(buf, nal_size);
@@ -1003,9 +1044,17 @@ bool CBitstreamConverter::BitstreamConvert(uint8_t* pData,
         }
       }
 
-      if (write_buf)
-        BitstreamAllocAndCopy(poutbuf, poutbuf_size, NULL, 0, buf_to_write, final_nal_size,
-                              unit_type);
+      if (inPlace && write_buf && buf_to_write == buf && final_nal_size == nal_size)
+      {
+        AV_WB32(buf - m_sps_pps_context.length_size, 1);
+      }
+      else
+      {
+        if (inPlace)
+          inPlace = LeaveInPlace(pData, buf - m_sps_pps_context.length_size);
+        if (write_buf)
+          BitstreamAllocAndCopy(NULL, 0, buf_to_write, final_nal_size, unit_type);
+      }
 
 #ifdef HAVE_LIBDOVI
       if (rpu_data)
@@ -1023,17 +1072,52 @@ bool CBitstreamConverter::BitstreamConvert(uint8_t* pData,
     cumul_size += nal_size + m_sps_pps_context.length_size;
   } while (cumul_size < buf_size);
 
+  if (inPlace)
+  {
+    m_convertedInPlace = true;
+    m_inputBuffer = pData;
+    m_inputSize = iSize;
+  }
+  else if (m_convertBuffer)
+  {
+    // decoders may read past the end, like the ffmpeg parsers
+    memset(m_convertBuffer + m_convertSize, 0, AV_INPUT_BUFFER_PADDING_SIZE);
+  }
+
   return true;
 
 fail:
-  av_free(*poutbuf), *poutbuf = NULL;
-  *poutbuf_size = 0;
+  m_convertSize = 0;
+  return false;
+}
+
+bool CBitstreamConverter::LeaveInPlace(const uint8_t* pData, const uint8_t* end)
+{
+  // the units before were converted in the packet, they start the output
+  const int size = static_cast<int>(end - pData);
+  ReserveConvertBuffer(size);
+  if (m_convertCapacity < size)
+    return false;
+  memcpy(m_convertBuffer, pData, size);
+  m_convertSize = size;
   return false;
 }
 
-void CBitstreamConverter::BitstreamAllocAndCopy(uint8_t** poutbuf,
-                                                int* poutbuf_size,
-                                                const uint8_t* sps_pps,
+void CBitstreamConverter::ReserveConvertBuffer(int size)
+{
+  const int required = size + AV_INPUT_BUFFER_PADDING_SIZE;
+  if (required <= m_convertCapacity)
+    return;
+
+  const int capacity = std::max(required, m_convertCapacity + m_convertCapacity / 2);
+  void* buffer = av_realloc(m_convertBuffer, capacity);
+  if (!buffer)
+    return;
+  m_convertBuffer = static_cast<uint8_t*>(buffer);
+  m_convertCapacity = capacity;
+}
+
+void CBitstreamConverter::BitstreamAllocAndCopy(const uint8_t* sps_pps,
                                                 uint32_t sps_pps_size,
                                                 const uint8_t* in,
                                                 uint32_t in_size,
@@ -1043,40 +1127,40 @@ void CBitstreamConverter::BitstreamAllocAndCopy(uint8_t** poutbuf,
   // which is Copyright (c) 2007 Benoit Fouet <benoit.fouet@free.fr>
   // and Licensed GPL 2.1 or greater
 
-  uint32_t offset = *poutbuf_size;
+  uint32_t offset = m_convertSize;
   uint8_t nal_header_size = offset ? 3 : 4;
-  void* tmp;
 
   // According to x265, this type is always encoded with four-sized header
   // https://bitbucket.org/multicoreware/x265_git/src/4bf31dc15fb6d1f93d12ecf21fad5e695f0db5c0/source/encoder/nal.cpp#lines-100
   if (nal_type == HEVC_NAL_UNSPEC62)
     nal_header_size = 4;
 
-  *poutbuf_size += sps_pps_size + in_size + nal_header_size;
-  tmp = av_realloc(*poutbuf, *poutbuf_size);
-  if (!tmp)
+  const int size = m_convertSize + sps_pps_size + in_size + nal_header_size;
+  ReserveConvertBuffer(size);
+  if (m_convertCapacity < size)
     return;
-  *poutbuf = (uint8_t*)tmp;
+  m_convertSize = size;
+  uint8_t* outbuf = m_convertBuffer;
   if (sps_pps)
-    memcpy(*poutbuf + offset, sps_pps, sps_pps_size);
+    memcpy(outbuf + offset, sps_pps, sps_pps_size);
 
-  memcpy(*poutbuf + sps_pps_size + nal_header_size + offset, in, in_size);
+  memcpy(outbuf + sps_pps_size + nal_header_size + offset, in, in_size);
   if (!offset)
   {
-    AV_WB32(*poutbuf + sps_pps_size, 1);
+    AV_WB32(outbuf + sps_pps_size, 1);
   }
   else if (nal_header_size == 4)
   {
-    (*poutbuf + offset + sps_pps_size)[0] = 0;
-    (*poutbuf + offset + sps_pps_size)[1] = 0;
-    (*poutbuf + offset + sps_pps_size)[2] = 0;
-    (*poutbuf + offset + sps_pps_size)[3] = 1;
+    (outbuf + offset + sps_pps_size)[0] = 0;
+    (outbuf + offset + sps_pps_size)[1] = 0;
+    (outbuf + offset + sps_pps_size)[2] = 0;
+    (outbuf + offset + sps_pps_size)[3] = 1;
   }
   else
   {
-    (*poutbuf + offset + sps_pps_size)[0] = 0;
-    (*poutbuf + offset + sps_pps_size)[1] = 0;
-    (*poutbuf + offset + sps_pps_size)[2] = 1;
+    (outbuf + offset + sps_pps_size)[0] = 0;
+    (outbuf + offset + sps_pps_size)[1] = 0;
+    (outbuf + offset + sps_pps_size)[2] = 1;
   }
 }
 
@@ -108,6 +108,12 @@ public:
   void SetRemoveDovi(bool value) { m_removeDovi = value; }
   void SetRemoveHdr10Plus(bool value) { m_removeHdr10Plus = value; }
   void SetDoviZeroLevel5(bool value) { m_setDoviZeroLevel5 = value; }
+  /*!
+   * \brief Convert avcC/hvcC packets to Annex B in the packet itself while nothing is added to or
+   * removed from it, instead of copying them. A packet can't be converted twice then, the caller
+   * has to be done with it after Convert().
+   */
+  void SetConvertInPlace(bool value) { m_convertInPlace = value; }
 
   static bool mpeg2_sequence_header(const uint8_t* data,
                                     const uint32_t size,
@@ -122,14 +128,16 @@ protected:
   bool IsSlice(uint8_t unit_type);
   bool BitstreamConvertInitAVC(void* in_extradata, int in_extrasize);
   bool BitstreamConvertInitHEVC(void* in_extradata, int in_extrasize);
-  bool BitstreamConvert(uint8_t* pData, int iSize, uint8_t** poutbuf, int* poutbuf_size);
-  static void BitstreamAllocAndCopy(uint8_t** poutbuf,
-                                    int* poutbuf_size,
-                                    const uint8_t* sps_pps,
-                                    uint32_t sps_pps_size,
-                                    const uint8_t* in,
-                                    uint32_t in_size,
-                                    uint8_t nal_type);
+  bool BitstreamConvert(uint8_t* pData, int iSize);
+  void BitstreamAllocAndCopy(const uint8_t* sps_pps,
+                             uint32_t sps_pps_size,
+                             const uint8_t* in,
+                             uint32_t in_size,
+                             uint8_t nal_type);
+  //! copy what was converted in place to the convert buffer, returns false
+  bool LeaveInPlace(const uint8_t* pData, const uint8_t* end);
+  //! grow the convert buffer to size and the padding, keeping its content
+  void ReserveConvertBuffer(int size);
 
 #ifdef HAVE_LIBDOVI
   const DoviData* processDoviRpu(uint8_t* buf, uint32_t nalSize);
@@ -145,6 +153,9 @@ protected:
 
   uint8_t* m_convertBuffer;
   int m_convertSize;
+  int m_convertCapacity;
+  bool m_convertedInPlace;
+  bool m_convertInPlace;
   uint8_t* m_inputBuffer;
   int m_inputSize;
 
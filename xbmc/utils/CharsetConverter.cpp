@@ -20,6 +20,7 @@
 #include "utils/Utf8Utils.h"
 
 #include <algorithm>
+#include <cwchar>
 #include <mutex>
 
 #include <fribidi.h>
@@ -71,8 +72,33 @@
   #endif
 #endif
 
+#if defined(WCHAR_IS_UCS_4) || defined(WCHAR_IS_UTF16) || \
+    (__STDC_ISO_10646__ && WCHAR_MAX > 0xFFFF)
+  // wchar_t holds UTF-32 or UTF-16, CUtf8Utils converts it without iconv
+  #define WCHAR_IS_UNICODE 1
+#endif
+
 #define NO_ICONV ((iconv_t)-1)
 
+namespace
+{
+// UTF-8-MAC composes decomposed characters, only plain ASCII can skip iconv there
+bool IsPlainUtf8Source(const std::string& str)
+{
+#if defined(TARGET_DARWIN)
+  return CUtf8Utils::IsAscii(str);
+#else
+  return true;
+#endif
+}
+
+// Nothing needs to be reordered before the first right-to-left script (Hebrew)
+bool HasOnlyLTRChars(const std::u32string& str)
+{
+  return std::all_of(str.begin(), str.end(), [](char32_t chr) { return chr < 0x0590; });
+}
+} // unnamed namespace
+
 enum SpecialCharset
 {
   NotSpecialCharset = 0,
@@ -487,6 +513,18 @@ bool CCharsetConverter::CInnerConverter::logicalToVisualBiDi(
   if (srcLen == 0)
     return true;
 
+  // most labels have no right-to-left text, fribidi would return them unchanged
+  if (HasOnlyLTRChars(stringSrc))
+  {
+    stringDst = stringSrc;
+    if (visualToLogicalMap)
+    {
+      for (size_t i = 0; i < srcLen; i++)
+        visualToLogicalMap[i] = static_cast<int>(i);
+    }
+    return true;
+  }
+
   stringDst.reserve(srcLen);
   size_t lineStart = 0;
 
@@ -542,7 +580,7 @@ bool CCharsetConverter::CInnerConverter::logicalToVisualBiDi(
 bool CCharsetConverter::CInnerConverter::isBidiDirectionRTL(const std::string& str)
 {
   std::u32string converted;
-  if (!CInnerConverter::stdConvert(Utf8ToUtf32, str, converted, true))
+  if (!CCharsetConverter::utf8ToUtf32(str, converted, true))
     return false;
 
   int lineLen = static_cast<int>(str.size());
@@ -667,6 +705,9 @@ void CCharsetConverter::reinitCharsetsFromSettings(void)
 
 bool CCharsetConverter::utf8ToUtf32(const std::string& utf8StringSrc, std::u32string& utf32StringDst, bool failOnBadChar /*= true*/)
 {
+  if (IsPlainUtf8Source(utf8StringSrc))
+    return CUtf8Utils::Utf8ToUtf32(utf8StringSrc, utf32StringDst, failOnBadChar);
+
   return CInnerConverter::stdConvert(Utf8ToUtf32, utf8StringSrc, utf32StringDst, failOnBadChar);
 }
 
@@ -682,17 +723,17 @@ bool CCharsetConverter::utf8ToUtf32Visual(const std::string& utf8StringSrc, std:
   if (bVisualBiDiFlip)
   {
     std::u32string converted;
-    if (!CInnerConverter::stdConvert(Utf8ToUtf32, utf8StringSrc, converted, failOnBadChar))
+    if (!utf8ToUtf32(utf8StringSrc, converted, failOnBadChar))
       return false;
 
     return CInnerConverter::logicalToVisualBiDi(converted, utf32StringDst, forceLTRReadingOrder ? FRIBIDI_TYPE_LTR : FRIBIDI_TYPE_PDF, failOnBadChar);
   }
-  return CInnerConverter::stdConvert(Utf8ToUtf32, utf8StringSrc, utf32StringDst, failOnBadChar);
+  return utf8ToUtf32(utf8StringSrc, utf32StringDst, failOnBadChar);
 }
 
 bool CCharsetConverter::utf32ToUtf8(const std::u32string& utf32StringSrc, std::string& utf8StringDst, bool failOnBadChar /*= true*/)
 {
-  return CInnerConverter::stdConvert(Utf32ToUtf8, utf32StringSrc, utf8StringDst, failOnBadChar);
+  return CUtf8Utils::Utf32ToUtf8(utf32StringSrc, utf8StringDst, failOnBadChar);
 }
 
 std::string CCharsetConverter::utf32ToUtf8(const std::u32string& utf32StringSrc, bool failOnBadChar /*= false*/)
@@ -707,9 +748,11 @@ bool CCharsetConverter::utf32ToW(const std::u32string& utf32StringSrc, std::wstr
 #ifdef WCHAR_IS_UCS_4
   wStringDst.assign((const wchar_t*)utf32StringSrc.c_str(), utf32StringSrc.length());
   return true;
-#else // !WCHAR_IS_UCS_4
+#elif defined(WCHAR_IS_UNICODE)
+  return CUtf8Utils::Utf32ToW(utf32StringSrc, wStringDst, failOnBadChar);
+#else // !WCHAR_IS_UNICODE
   return CInnerConverter::stdConvert(Utf32ToW, utf32StringSrc, wStringDst, failOnBadChar);
-#endif // !WCHAR_IS_UCS_4
+#endif // !WCHAR_IS_UNICODE
 }
 
 bool CCharsetConverter::utf32logicalToVisualBiDi(const std::u32string& logicalStringSrc,
@@ -742,15 +785,19 @@ bool CCharsetConverter::utf8ToW(const std::string& utf8StringSrc, std::wstring&
   {
     wStringDst.clear();
     std::u32string utf32str;
-    if (!CInnerConverter::stdConvert(Utf8ToUtf32, utf8StringSrc, utf32str, failOnBadChar))
+    if (!utf8ToUtf32(utf8StringSrc, utf32str, failOnBadChar))
       return false;
 
     std::u32string utf32flipped;
     const bool bidiResult = CInnerConverter::logicalToVisualBiDi(utf32str, utf32flipped, forceLTRReadingOrder ? FRIBIDI_TYPE_LTR : FRIBIDI_TYPE_PDF, failOnBadChar);
 
-    return CInnerConverter::stdConvert(Utf32ToW, utf32flipped, wStringDst, failOnBadChar) && bidiResult;
+    return utf32ToW(utf32flipped, wStringDst, failOnBadChar) && bidiResult;
   }
 
+#ifdef WCHAR_IS_UNICODE
+  if (IsPlainUtf8Source(utf8StringSrc))
+    return CUtf8Utils::Utf8ToW(utf8StringSrc, wStringDst, failOnBadChar);
+#endif
   return CInnerConverter::stdConvert(Utf8toW, utf8StringSrc, wStringDst, failOnBadChar);
 }
 
@@ -833,7 +880,11 @@ bool CCharsetConverter::unknownToUTF8(const std::string& stringSrc, std::string&
 
 bool CCharsetConverter::wToUTF8(const std::wstring& wStringSrc, std::string& utf8StringDst, bool failOnBadChar /*= false*/)
 {
+#ifdef WCHAR_IS_UNICODE
+  return CUtf8Utils::WToUtf8(wStringSrc, utf8StringDst, failOnBadChar);
+#else
   return CInnerConverter::stdConvert(WtoUtf8, wStringSrc, utf8StringDst, failOnBadChar);
+#endif
 }
 
 bool CCharsetConverter::utf16BEtoUTF8(const std::u16string& utf16StringSrc, std::string& utf8StringDst)
@@ -9,6 +9,7 @@
 #include "EmbeddedArt.h"
 
 #include "Archive.h"
+#include "Crc32.h"
 
 EmbeddedArtInfo::EmbeddedArtInfo(size_t size,
                                  const std::string &mime, const std::string& type)
@@ -21,12 +22,21 @@ void EmbeddedArtInfo::Set(size_t size, const std::string &mime, const std::strin
   m_size = size;
   m_mime = mime;
   m_type = type;
+  m_hash = 0;
+}
+
+void EmbeddedArtInfo::SetHash(const uint8_t* data, size_t size)
+{
+  Crc32 crc;
+  crc.Compute(reinterpret_cast<const char*>(data), size);
+  m_hash = crc;
 }
 
 void EmbeddedArtInfo::Clear()
 {
   m_mime.clear();
   m_size = 0;
+  m_hash = 0;
 }
 
 bool EmbeddedArtInfo::Empty() const
@@ -38,7 +48,9 @@ bool EmbeddedArtInfo::Matches(const EmbeddedArtInfo &right) const
 {
   return (m_size == right.m_size &&
           m_mime == right.m_mime &&
-          m_type == right.m_type);
+          m_type == right.m_type &&
+          // images of the same size may still differ, compare the data when both are known
+          (m_hash == 0 || right.m_hash == 0 || m_hash == right.m_hash));
 }
 
 void EmbeddedArtInfo::Archive(CArchive &ar)
@@ -48,12 +60,14 @@ void EmbeddedArtInfo::Archive(CArchive &ar)
     ar << m_size;
     ar << m_mime;
     ar << m_type;
+    ar << m_hash;
   }
   else
   {
     ar >> m_size;
     ar >> m_mime;
     ar >> m_type;
+    ar >> m_hash;
   }
 }
 
@@ -67,6 +81,7 @@ void EmbeddedArt::Set(const uint8_t *data, size_t size,
                       const std::string &mime, const std::string& type)
 {
   EmbeddedArtInfo::Set(size, mime, type);
+  SetHash(data, size);
   m_data.resize(size);
   m_data.assign(data, data+size);
 }
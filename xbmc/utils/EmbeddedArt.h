@@ -25,6 +25,7 @@ public:
   void Archive(CArchive& ar) override;
 
   void Set(size_t size, const std::string &mime, const std::string& type = "");
+  void SetHash(const uint8_t* data, size_t size);
   void Clear();
   bool Empty() const;
   bool Matches(const EmbeddedArtInfo &right) const;
@@ -33,6 +34,7 @@ public:
   size_t m_size = 0;
   std::string m_mime;
   std::string m_type;
+  uint32_t m_hash = 0; ///< crc of the image data, 0 if unknown
 };
 
 class EmbeddedArt : public EmbeddedArtInfo
@@ -0,0 +1,116 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace KODI::UTILS
+{
+/*!
+ * \brief Map kept as a sorted vector of key value pairs.
+ *
+ * Meant for the small maps every list item carries. All entries are in a single allocation
+ * instead of a node per entry, lookups are a binary search. Inserting and erasing move the
+ * following entries, so it doesn't suit maps with many entries that change often.
+ *
+ * The keys must not be changed through the iterators.
+ */
+template<typename Key, typename T, typename Compare = std::less<>>
+class CFlatMap
+{
+public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<Key, T>;
+  using container_type = std::vector<value_type>;
+  using iterator = typename container_type::iterator;
+  using const_iterator = typename container_type::const_iterator;
+  using size_type = typename container_type::size_type;
+
+  iterator begin() { return m_entries.begin(); }
+  iterator end() { return m_entries.end(); }
+  const_iterator begin() const { return m_entries.begin(); }
+  const_iterator end() const { return m_entries.end(); }
+
+  bool empty() const { return m_entries.empty(); }
+  size_type size() const { return m_entries.size(); }
+  void clear() { m_entries.clear(); }
+  void reserve(size_type size) { m_entries.reserve(size); }
+  void shrink_to_fit() { m_entries.shrink_to_fit(); }
+
+  template<typename K>
+  iterator find(const K& key)
+  {
+    const auto it = LowerBound(m_entries, key);
+    return it != m_entries.end() && !Compare{}(key, it->first) ? it : m_entries.end();
+  }
+
+  template<typename K>
+  const_iterator find(const K& key) const
+  {
+    const auto it = LowerBound(m_entries, key);
+    return it != m_entries.end() && !Compare{}(key, it->first) ? it : m_entries.end();
+  }
+
+  template<typename K>
+  bool contains(const K& key) const
+  {
+    return find(key) != end();
+  }
+
+  template<typename K, typename... Args>
+  std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+  {
+    auto it = LowerBound(m_entries, key);
+    if (it != m_entries.end() && !Compare{}(key, it->first))
+      return {it, false};
+
+    it = m_entries.emplace(it, std::piecewise_construct,
+                           std::forward_as_tuple(std::forward<K>(key)),
+                           std::forward_as_tuple(std::forward<Args>(args)...));
+    return {it, true};
+  }
+
+  template<typename K>
+  T& operator[](K&& key)
+  {
+    return try_emplace(std::forward<K>(key)).first->second;
+  }
+
+  iterator erase(iterator it) { return m_entries.erase(it); }
+  iterator erase(const_iterator it) { return m_entries.erase(it); }
+
+  template<typename K>
+  size_type erase(const K& key)
+  {
+    const auto it = find(key);
+    if (it == m_entries.end())
+      return 0;
+    m_entries.erase(it);
+    return 1;
+  }
+
+  bool operator==(const CFlatMap& rhs) const = default;
+
+private:
+  template<typename Container, typename K>
+  static auto LowerBound(Container& entries, const K& key)
+  {
+    return std::lower_bound(entries.begin(), entries.end(), key,
+                            [](const value_type& entry, const K& k)
+                            { return Compare{}(entry.first, k); });
+  }
+
+  container_type m_entries;
+};
+} // namespace KODI::UTILS
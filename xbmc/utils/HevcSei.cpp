@@ -8,6 +8,9 @@
 
 #include "HevcSei.h"
 
+#include <algorithm>
+#include <iterator>
+
 void HevcAddStartCodeEmulationPrevention3Byte(std::vector<uint8_t>& buf)
 {
   size_t i = 0;
@@ -150,6 +153,15 @@ std::optional<const CHevcSei*> CHevcSei::FindHdr10PlusSeiMessage(
   return {};
 }
 
+bool CHevcSei::MayContainHdr10Plus(const uint8_t* inData, const size_t inDataLen)
+{
+  // country code, provider code, oriented code and application identifier of ST 2094-40, which
+  // has no 0x0000 emulation prevention could have been inserted into
+  static constexpr uint8_t header[] = {0xB5, 0x00, 0x3C, 0x00, 0x01, 0x04};
+  const uint8_t* end = inData + inDataLen;
+  return std::search(inData, end, std::begin(header), std::end(header)) != end;
+}
+
 std::pair<bool, const std::vector<uint8_t>> CHevcSei::RemoveHdr10PlusFromSeiNalu(
     const uint8_t* inData, const size_t inDataLen)
 {
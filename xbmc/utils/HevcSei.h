@@ -57,6 +57,10 @@ public:
   static std::pair<bool, const std::vector<uint8_t>> RemoveHdr10PlusFromSeiNalu(
       const uint8_t* inData, const size_t inDataLen);
 
+  // Looks for the T.35 header of HDR10+ in the NALU without parsing it. When false, the NALU has
+  // no HDR10+ SEI message.
+  static bool MayContainHdr10Plus(const uint8_t* inData, const size_t inDataLen);
+
 private:
   // Parses single SEI message from the reader and pushes it to the list
   static int ParseSeiMessage(CBitstreamReader& br, std::vector<CHevcSei>& messages);
@@ -10,6 +10,8 @@
 
 #include "ServiceBroker.h"
 #include "TimeUtils.h"
+#include "application/ApplicationComponents.h"
+#include "application/ApplicationPowerHandling.h"
 #include "jobs/JobManager.h"
 #include "resources/LocalizeStrings.h"
 #include "resources/ResourcesComponent.h"
@@ -25,6 +27,7 @@ CInfoLoader::~CInfoLoader() = default;
 void CInfoLoader::OnJobComplete(unsigned int jobID, bool success, CJob *job)
 {
   m_refreshTime = CTimeUtils::GetFrameTime() + m_timeToRefresh;
+  m_fetched = true;
   m_busy = false;
 }
 
@@ -32,6 +35,12 @@ bool CInfoLoader::RefreshIfNeeded()
 {
   if (m_refreshTime < CTimeUtils::GetFrameTime() && !m_busy)
   {
+    // keep what was fetched while idle, it's refreshed on the first request after it
+    const auto appPower =
+        CServiceBroker::GetAppComponents().GetComponent<CApplicationPowerHandling>();
+    if (m_fetched && appPower && appPower->IsIdle())
+      return false;
+
     // queue up data refresh job
     m_busy = true;
     CServiceBroker::GetJobManager()->AddJob(GetJob(), this);
@@ -33,4 +33,5 @@ private:
   unsigned int m_refreshTime;
   unsigned int m_timeToRefresh;
   std::atomic<bool> m_busy{false};
+  std::atomic<bool> m_fetched{false};
 };
@@ -32,67 +32,58 @@ public:
                    const nlohmann::json::exception& ex) override;
 
 private:
-  template <typename... TArgs>
-  bool Primitive(TArgs... args)
-  {
-    PushObject(CVariant(std::forward<TArgs>(args)...));
-    PopObject();
-
-    return true;
-  }
-
-  void PushObject(CVariant variant);
-  void PopObject();
+  /*!
+   * \brief Add a parsed value to the innermost open array or object.
+   * \param container true if value is an array or object whose members follow
+   */
+  void Add(CVariant&& value, bool container);
+  bool Close();
 
   CVariant& m_parsedObject;
-  std::vector<CVariant *> m_parse;
+  std::vector<CVariant*> m_parse; //!< open arrays and objects, innermost last
   std::string m_key;
   CVariant m_root;
-
-  enum class PARSE_STATUS
-  {
-    Variable,
-    Array,
-    Object
-  };
-  PARSE_STATUS m_status = PARSE_STATUS::Variable;
 };
 
 CJSONVariantParserHandler::CJSONVariantParserHandler(CVariant& parsedObject)
-  : m_parsedObject(parsedObject), m_parse(), m_key()
+  : m_parsedObject(parsedObject)
 { }
 
 bool CJSONVariantParserHandler::null()
 {
-  PushObject(CVariant::ConstNullVariant);
-  PopObject();
-
+  Add(CVariant::VariantTypeConstNull, false);
   return true;
 }
 
 bool CJSONVariantParserHandler::boolean(bool b)
 {
-  return Primitive(b);
+  Add(b, false);
+  return true;
 }
 
 bool CJSONVariantParserHandler::number_integer(number_integer_t i)
 {
-  return Primitive(i);
+  Add(static_cast<int64_t>(i), false);
+  return true;
 }
 
 bool CJSONVariantParserHandler::number_unsigned(number_unsigned_t u)
 {
-  return Primitive(u);
+  Add(static_cast<uint64_t>(u), false);
+  return true;
 }
 
 bool CJSONVariantParserHandler::number_float(number_float_t d, const string_t& s)
 {
-  return Primitive(d);
+  Add(d, false);
+  return true;
 }
 
 bool CJSONVariantParserHandler::string(std::string& str)
 {
-  return Primitive(str);
+  // the parser doesn't use the string after handing it over
+  Add(std::move(str), false);
+  return true;
 }
 
 bool CJSONVariantParserHandler::binary(binary_t& b)
@@ -102,37 +93,30 @@ bool CJSONVariantParserHandler::binary(binary_t& b)
 
 bool CJSONVariantParserHandler::start_object(std::size_t elements)
 {
-  PushObject(CVariant::VariantTypeObject);
-
+  Add(CVariant::VariantTypeObject, true);
   return true;
 }
 
 bool CJSONVariantParserHandler::key(std::string& str)
 {
-  m_key = str;
-
+  m_key.swap(str);
   return true;
 }
 
 bool CJSONVariantParserHandler::end_object()
 {
-  PopObject();
-
-  return true;
+  return Close();
 }
 
 bool CJSONVariantParserHandler::start_array(std::size_t elements)
 {
-  PushObject(CVariant::VariantTypeArray);
-
+  Add(CVariant::VariantTypeArray, true);
   return true;
 }
 
 bool CJSONVariantParserHandler::end_array()
 {
-  PopObject();
-
-  return true;
+  return Close();
 }
 
 bool CJSONVariantParserHandler::parse_error(std::size_t position,
@@ -142,56 +126,42 @@ bool CJSONVariantParserHandler::parse_error(std::size_t position,
   return false;
 }
 
-void CJSONVariantParserHandler::PushObject(CVariant variant)
+void CJSONVariantParserHandler::Add(CVariant&& value, bool container)
 {
-  const auto variant_type = variant.type();
-
-  if (m_status == PARSE_STATUS::Object)
+  CVariant* added;
+  if (m_parse.empty())
   {
-    (*m_parse.back())[m_key] = std::move(variant);
-    m_parse.push_back(&((*m_parse.back())[m_key]));
+    m_root = std::move(value);
+    added = &m_root;
   }
-  else if (m_status == PARSE_STATUS::Array)
+  else if (m_parse.back()->isObject())
   {
-    CVariant *temp = m_parse[m_parse.size() - 1];
-    temp->push_back(std::move(variant));
-    m_parse.push_back(&(*temp)[temp->size() - 1]);
+    added = &(*m_parse.back())[m_key];
+    *added = std::move(value);
   }
-  else if (m_parse.empty())
+  else
   {
-    m_root = std::move(variant);
-    m_parse.push_back(&m_root);
+    CVariant* array = m_parse.back();
+    array->push_back(std::move(value));
+    added = &(*array)[array->size() - 1];
   }
 
-  if (variant_type == CVariant::VariantTypeObject)
-    m_status = PARSE_STATUS::Object;
-  else if (variant_type == CVariant::VariantTypeArray)
-    m_status = PARSE_STATUS::Array;
-  else
-    m_status = PARSE_STATUS::Variable;
+  if (container)
+    m_parse.push_back(added);
+  else if (m_parse.empty())
+    m_parsedObject = std::move(m_root);
 }
 
-void CJSONVariantParserHandler::PopObject()
+bool CJSONVariantParserHandler::Close()
 {
-  assert(!m_parse.empty());
-  CVariant* variant = m_parse.back();
+  if (m_parse.empty())
+    return false;
+
   m_parse.pop_back();
+  if (m_parse.empty())
+    m_parsedObject = std::move(m_root);
 
-  if (!m_parse.empty())
-  {
-    variant = m_parse[m_parse.size() - 1];
-    if (variant->isObject())
-      m_status = PARSE_STATUS::Object;
-    else if (variant->isArray())
-      m_status = PARSE_STATUS::Array;
-    else
-      m_status = PARSE_STATUS::Variable;
-  }
-  else
-  {
-    m_parsedObject = *variant;
-    m_status = PARSE_STATUS::Variable;
-  }
+  return true;
 }
 
 bool CJSONVariantParser::Parse(const char* json, CVariant& data)
@@ -205,5 +175,7 @@ bool CJSONVariantParser::Parse(const char* json, CVariant& data)
 
 bool CJSONVariantParser::Parse(const std::string& json, CVariant& data)
 {
-  return Parse(json.c_str(), data);
+  // the length is known, no need to look for the terminator
+  CJSONVariantParserHandler handler(data);
+  return nlohmann::json::sax_parse(json.begin(), json.end(), &handler);
 }
@@ -10,74 +10,316 @@
 
 #include "utils/Variant.h"
 
-#include <nlohmann/json.hpp>
+#include <charconv>
+#include <cmath>
+#include <iterator>
+#include <string_view>
 
-void InternalWrite(nlohmann::json& writer, const CVariant& value)
+#include <fmt/format.h>
+
+namespace
+{
+/*!
+ * \brief Serializes a CVariant straight into the output string.
+ *
+ * Produces the same layout as dumping an nlohmann::json copy of the variant, without building
+ * that copy first: large JSON-RPC results used to exist three times in memory while being
+ * written (variant, json tree and string).
+ */
+class CVariantSerializer
 {
-  switch (value.type())
+public:
+  CVariantSerializer(std::string& output, bool compact) : m_output(output), m_compact(compact) {}
+
+  bool Write(const CVariant& value, unsigned int depth)
+  {
+    switch (value.type())
+    {
+      case CVariant::VariantTypeInteger:
+        fmt::format_to(std::back_inserter(m_output), "{}", value.asInteger());
+        break;
+      case CVariant::VariantTypeUnsignedInteger:
+        fmt::format_to(std::back_inserter(m_output), "{}", value.asUnsignedInteger());
+        break;
+      case CVariant::VariantTypeDouble:
+        WriteDouble(value.asDouble());
+        break;
+      case CVariant::VariantTypeBoolean:
+        m_output += value.asBoolean() ? "true" : "false";
+        break;
+      case CVariant::VariantTypeString:
+        return WriteString(std::string_view(value.c_str(), value.size()));
+      case CVariant::VariantTypeArray:
+      {
+        if (value.empty())
+        {
+          m_output += "[]";
+          break;
+        }
+
+        m_output += '[';
+        bool first = true;
+        for (auto itr = value.begin_array(); itr != value.end_array(); ++itr)
+        {
+          Separate(first, depth + 1);
+          if (!Write(*itr, depth + 1))
+            return false;
+        }
+        Close(']', depth);
+        break;
+      }
+      case CVariant::VariantTypeObject:
+      {
+        if (value.empty())
+        {
+          m_output += "{}";
+          break;
+        }
+
+        m_output += '{';
+        bool first = true;
+        for (auto itr = value.begin_map(); itr != value.end_map(); ++itr)
+        {
+          Separate(first, depth + 1);
+          if (!WriteString(itr->first))
+            return false;
+          m_output += m_compact ? ":" : ": ";
+          if (!Write(itr->second, depth + 1))
+            return false;
+        }
+        Close('}', depth);
+        break;
+      }
+      case CVariant::VariantTypeConstNull:
+      case CVariant::VariantTypeNull:
+      default:
+        m_output += "null";
+        break;
+    }
+
+    return true;
+  }
+
+private:
+  void Indent(unsigned int depth)
+  {
+    m_output += '\n';
+    m_output.append(depth, '\t');
+  }
+
+  void Separate(bool& first, unsigned int depth)
+  {
+    if (!first)
+      m_output += ',';
+    first = false;
+    if (!m_compact)
+      Indent(depth);
+  }
+
+  void Close(char bracket, unsigned int depth)
+  {
+    if (!m_compact)
+      Indent(depth);
+    m_output += bracket;
+  }
+
+  void WriteDouble(double value)
   {
-  case CVariant::VariantTypeInteger:
-    writer = value.asInteger();
-    break;
-  case CVariant::VariantTypeUnsignedInteger:
-    writer = value.asUnsignedInteger();
-    break;
-  case CVariant::VariantTypeDouble:
-    writer = value.asDouble();
-    break;
-  case CVariant::VariantTypeBoolean:
-    writer = value.asBoolean();
-    break;
-  case CVariant::VariantTypeString:
-    writer = std::string(value.c_str(), value.size());
-    break;
-  case CVariant::VariantTypeArray:
-    writer = nlohmann::json::array();
-
-    for (CVariant::const_iterator_array itr = value.begin_array(); itr != value.end_array(); ++itr)
+    if (!std::isfinite(value))
     {
-      nlohmann::json& o = writer.emplace_back();
-      InternalWrite(o, *itr);
+      m_output += "null";
+      return;
     }
 
-    break;
-  case CVariant::VariantTypeObject:
-    writer = nlohmann::json::object();
+    if (std::signbit(value))
+    {
+      m_output += '-';
+      value = -value;
+    }
+    if (value == 0.0)
+    {
+      m_output += "0.0";
+      return;
+    }
 
-    for (CVariant::const_iterator_map itr = value.begin_map(); itr != value.end_map(); ++itr)
+    // shortest digits that round trip, value = 0.<digits> * 10^point
+    char buffer[32];
+    const auto end = fmt::format_to(buffer, "{}", value);
+    const std::string_view formatted(buffer, end - buffer);
+    const size_t e = formatted.find('e');
+    const std::string_view mantissa = formatted.substr(0, e);
+    int point = static_cast<int>(mantissa.find('.'));
+    if (point < 0)
+      point = static_cast<int>(mantissa.size());
+    if (e != std::string_view::npos)
     {
-      nlohmann::json& o = writer[itr->first];
-      InternalWrite(o, itr->second);
+      int exponent = 0;
+      const char* first = formatted.data() + e + 1;
+      if (*first == '+')
+        ++first;
+      std::from_chars(first, formatted.data() + formatted.size(), exponent);
+      point += exponent;
     }
 
-    break;
+    std::string digits;
+    for (const char c : mantissa)
+    {
+      if (c != '.')
+        digits += c;
+    }
+    const size_t leading = digits.find_first_not_of('0');
+    digits.erase(0, leading);
+    point -= static_cast<int>(leading);
+    digits.erase(digits.find_last_not_of('0') + 1);
 
-  case CVariant::VariantTypeConstNull:
-  case CVariant::VariantTypeNull:
-  default:
-    writer = nullptr;
-    break;
+    // same layout as the nlohmann::json serializer used before
+    constexpr int MIN_EXP = -4;
+    constexpr int MAX_EXP = 15;
+    const int length = static_cast<int>(digits.size());
+    if (length <= point && point <= MAX_EXP)
+    {
+      m_output += digits;
+      m_output.append(point - length, '0');
+      m_output += ".0";
+    }
+    else if (0 < point && point <= MAX_EXP)
+    {
+      m_output.append(digits, 0, point);
+      m_output += '.';
+      m_output.append(digits, point);
+    }
+    else if (MIN_EXP < point && point <= 0)
+    {
+      m_output += "0.";
+      m_output.append(-point, '0');
+      m_output += digits;
+    }
+    else
+    {
+      m_output += digits[0];
+      if (length > 1)
+      {
+        m_output += '.';
+        m_output.append(digits, 1);
+      }
+      fmt::format_to(std::back_inserter(m_output), "e{:+03d}", point - 1);
+    }
   }
-}
 
-bool CJSONVariantWriter::Write(const CVariant &value, std::string& output, bool compact)
-{
-  try
+  bool WriteString(std::string_view value)
   {
-    nlohmann::json json;
-    InternalWrite(json, value);
+    static constexpr char HEX[] = "0123456789abcdef";
 
-    if (compact)
+    m_output += '"';
+    size_t pending = 0; // start of the run of characters that need no escaping
+    for (size_t i = 0; i < value.size();)
     {
-      output = json.dump();
+      const auto c = static_cast<unsigned char>(value[i]);
+      if (c >= 0x80)
+      {
+        const size_t length = GetSequenceLength(value, i);
+        if (length == 0)
+          return false; // invalid UTF-8 can't be represented in JSON
+        i += length;
+        continue;
+      }
+
+      if (c >= 0x20 && c != '"' && c != '\\')
+      {
+        ++i;
+        continue;
+      }
+
+      m_output.append(value.substr(pending, i - pending));
+      switch (c)
+      {
+        case '"':
+          m_output += "\\\"";
+          break;
+        case '\\':
+          m_output += "\\\\";
+          break;
+        case '\b':
+          m_output += "\\b";
+          break;
+        case '\f':
+          m_output += "\\f";
+          break;
+        case '\n':
+          m_output += "\\n";
+          break;
+        case '\r':
+          m_output += "\\r";
+          break;
+        case '\t':
+          m_output += "\\t";
+          break;
+        default:
+          m_output += "\\u00";
+          m_output += HEX[c >> 4];
+          m_output += HEX[c & 0xf];
+          break;
+      }
+      pending = ++i;
+    }
+    m_output.append(value.substr(pending));
+    m_output += '"';
+    return true;
+  }
+
+  /*!
+   * \brief Length of the valid multi byte UTF-8 sequence starting at pos, 0 if invalid.
+   */
+  static size_t GetSequenceLength(std::string_view value, size_t pos)
+  {
+    const auto lead = static_cast<unsigned char>(value[pos]);
+    size_t length;
+    unsigned char min = 0x80;
+    unsigned char max = 0xbf;
+    if (lead >= 0xc2 && lead <= 0xdf)
+      length = 2;
+    else if (lead >= 0xe0 && lead <= 0xef)
+    {
+      length = 3;
+      if (lead == 0xe0)
+        min = 0xa0; // overlong
+      else if (lead == 0xed)
+        max = 0x9f; // surrogates
+    }
+    else if (lead >= 0xf0 && lead <= 0xf4)
+    {
+      length = 4;
+      if (lead == 0xf0)
+        min = 0x90; // overlong
+      else if (lead == 0xf4)
+        max = 0x8f; // above U+10FFFF
     }
     else
+      return 0;
+
+    if (pos + length > value.size())
+      return 0;
+
+    for (size_t i = 1; i < length; ++i)
     {
-      output = json.dump(1, '\t');
+      const auto c = static_cast<unsigned char>(value[pos + i]);
+      if (c < (i == 1 ? min : 0x80) || c > (i == 1 ? max : 0xbf))
+        return 0;
     }
+    return length;
   }
-  catch (nlohmann::json::exception&)
+
+  std::string& m_output;
+  const bool m_compact;
+};
+} // namespace
+
+bool CJSONVariantWriter::Write(const CVariant &value, std::string& output, bool compact)
+{
+  output.clear();
+  if (!CVariantSerializer(output, compact).Write(value, 0))
   {
+    output.clear();
     return false;
   }
 
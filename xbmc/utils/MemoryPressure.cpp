@@ -0,0 +1,281 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "MemoryPressure.h"
+
+#include "threads/Thread.h"
+#include "utils/MemUtils.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+
+#if defined(TARGET_LINUX)
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// trimming again for the same pressure before this only throws away what was just rebuilt
+constexpr auto MIN_TRIM_INTERVAL = 10s;
+constexpr auto POLL_INTERVAL = 5s;
+constexpr auto USAGE_INTERVAL = 2s;
+
+// percentage of the physical memory left, when polling
+constexpr uint64_t MODERATE_FREE_PERCENT = 10;
+constexpr uint64_t CRITICAL_FREE_PERCENT = 5;
+
+const char* GetPressureName(MemoryPressure pressure)
+{
+  switch (pressure)
+  {
+    case MemoryPressure::MODERATE:
+      return "moderate";
+    case MemoryPressure::CRITICAL:
+      return "critical";
+    default:
+      return "none";
+  }
+}
+} // unnamed namespace
+
+#if defined(TARGET_LINUX)
+/*!
+ * \brief Waits for the pressure stall triggers of /proc/pressure/memory (Linux 5.2 and later).
+ *
+ * The kernel signals a trigger when the tasks were stalled on memory for longer than the
+ * threshold within the window. Unprivileged processes are limited to windows of whole multiples
+ * of two seconds.
+ */
+class CPressureStallMonitor : public CThread
+{
+public:
+  explicit CPressureStallMonitor(CMemoryPressureManager& manager)
+    : CThread("MemoryPressure"), m_manager(manager)
+  {
+  }
+
+  ~CPressureStallMonitor() override
+  {
+    StopThread();
+    for (const int fd : m_fds)
+    {
+      if (fd >= 0)
+        close(fd);
+    }
+  }
+
+  bool Open()
+  {
+    // some task stalled 150ms or all tasks stalled 100ms within two seconds
+    m_fds[0] = OpenTrigger("some 150000 2000000");
+    m_fds[1] = OpenTrigger("full 100000 2000000");
+    return m_fds[0] >= 0 && m_fds[1] >= 0;
+  }
+
+protected:
+  void Process() override
+  {
+    pollfd fds[2] = {{m_fds[0], POLLPRI, 0}, {m_fds[1], POLLPRI, 0}};
+    while (!m_bStop)
+    {
+      // wake up regularly to see if the thread is stopped
+      const int ret = poll(fds, 2, 1000);
+      if (ret < 0)
+      {
+        if (errno == EINTR)
+          continue;
+        CLog::LogF(LOGERROR, "poll failed: {}", strerror(errno));
+        return;
+      }
+
+      for (unsigned int i = 0; i < 2; ++i)
+      {
+        if (fds[i].revents & POLLERR)
+        {
+          CLog::LogF(LOGWARNING, "the pressure stall triggers were removed");
+          return;
+        }
+        if (fds[i].revents & POLLPRI)
+          m_manager.Notify(i == 0 ? MemoryPressure::MODERATE : MemoryPressure::CRITICAL);
+      }
+    }
+  }
+
+private:
+  static int OpenTrigger(const char* trigger)
+  {
+    const int fd = open("/proc/pressure/memory", O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0)
+      return -1;
+
+    // the terminating null is part of the trigger
+    if (write(fd, trigger, strlen(trigger) + 1) < 0)
+    {
+      CLog::LogF(LOGDEBUG, "unable to set the trigger \"{}\": {}", trigger, strerror(errno));
+      close(fd);
+      return -1;
+    }
+    return fd;
+  }
+
+  CMemoryPressureManager& m_manager;
+  int m_fds[2] = {-1, -1};
+};
+#else
+class CPressureStallMonitor
+{
+};
+#endif
+
+CMemoryPressureManager::CMemoryPressureManager() = default;
+
+CMemoryPressureManager::~CMemoryPressureManager()
+{
+  Stop();
+}
+
+void CMemoryPressureManager::Start()
+{
+#if defined(TARGET_LINUX)
+  if (m_monitor)
+    return;
+
+  auto monitor = std::make_unique<CPressureStallMonitor>(*this);
+  if (monitor->Open())
+  {
+    CLog::Log(LOGINFO, "CMemoryPressureManager: using the pressure stall information");
+    monitor->Create();
+    m_monitor = std::move(monitor);
+    return;
+  }
+#endif
+  CLog::Log(LOGINFO, "CMemoryPressureManager: polling the free memory");
+}
+
+void CMemoryPressureManager::Stop()
+{
+  m_monitor.reset();
+}
+
+unsigned int CMemoryPressureManager::RegisterCache(const std::string& name,
+                                                   int priority,
+                                                   UsageFunc usage,
+                                                   TrimFunc trim)
+{
+  std::unique_lock lock(m_section);
+  const unsigned int id = m_nextId++;
+  // keep the caches in trimming order, the ones of the same priority in registration order
+  const auto it = std::ranges::upper_bound(m_caches, priority, {}, &Cache::priority);
+  m_caches.insert(it, {id, name, priority, std::move(usage), std::move(trim)});
+  return id;
+}
+
+void CMemoryPressureManager::UnregisterCache(unsigned int id)
+{
+  std::unique_lock lock(m_section);
+  const auto it = std::ranges::find(m_caches, id, &Cache::id);
+  if (it == m_caches.end())
+    return;
+
+  std::erase_if(m_usage, [&it](const CacheUsage& usage) { return usage.name == it->name; });
+  m_caches.erase(it);
+}
+
+void CMemoryPressureManager::Notify(MemoryPressure pressure)
+{
+  // keep the worst pressure reported since the last Process()
+  int pending = m_pending.load();
+  while (pending < static_cast<int>(pressure) &&
+         !m_pending.compare_exchange_weak(pending, static_cast<int>(pressure)))
+  {
+  }
+}
+
+void CMemoryPressureManager::Process()
+{
+  MemoryPressure pressure =
+      static_cast<MemoryPressure>(m_pending.exchange(static_cast<int>(MemoryPressure::NONE)));
+
+  const auto now = std::chrono::steady_clock::now();
+  if (!m_monitor && now - m_lastPoll >= POLL_INTERVAL)
+  {
+    m_lastPoll = now;
+    pressure = std::max(pressure, PollFreeMemory());
+  }
+
+  if (pressure != MemoryPressure::NONE &&
+      (pressure > m_lastPressure || now - m_lastTrim >= MIN_TRIM_INTERVAL))
+  {
+    m_lastTrim = now;
+    m_lastPressure = pressure;
+    Trim(pressure);
+  }
+  else if (now - m_lastUsage >= USAGE_INTERVAL)
+  {
+    RefreshUsage();
+  }
+
+  if (m_lastPressure != MemoryPressure::NONE && now - m_lastTrim >= MIN_TRIM_INTERVAL)
+    m_lastPressure = MemoryPressure::NONE;
+}
+
+std::vector<CMemoryPressureManager::CacheUsage> CMemoryPressureManager::GetUsage() const
+{
+  std::unique_lock lock(m_section);
+  return m_usage;
+}
+
+MemoryPressure CMemoryPressureManager::PollFreeMemory()
+{
+  KODI::MEMORY::MemoryStatus status{};
+  KODI::MEMORY::GetMemoryStatus(&status);
+  if (status.totalPhys == 0)
+    return MemoryPressure::NONE;
+
+  const uint64_t freePercent = status.availPhys * 100 / status.totalPhys;
+  if (freePercent < CRITICAL_FREE_PERCENT)
+    return MemoryPressure::CRITICAL;
+  if (freePercent < MODERATE_FREE_PERCENT)
+    return MemoryPressure::MODERATE;
+  return MemoryPressure::NONE;
+}
+
+void CMemoryPressureManager::Trim(MemoryPressure pressure)
+{
+  std::unique_lock lock(m_section);
+  CLog::Log(LOGINFO, "CMemoryPressureManager: {} memory pressure, trimming {} caches",
+            GetPressureName(pressure), m_caches.size());
+
+  for (const Cache& cache : m_caches)
+  {
+    const Usage before = cache.usage();
+    cache.trim(pressure);
+    const Usage after = cache.usage();
+    CLog::Log(LOGDEBUG, "CMemoryPressureManager: {} went from {} to {} bytes, {} to {} items",
+              cache.name, before.bytes, after.bytes, before.items, after.items);
+  }
+
+  RefreshUsage();
+}
+
+void CMemoryPressureManager::RefreshUsage()
+{
+  std::unique_lock lock(m_section);
+  m_lastUsage = std::chrono::steady_clock::now();
+  m_usage.clear();
+  for (const Cache& cache : m_caches)
+    m_usage.push_back({cache.name, cache.priority, cache.usage()});
+}
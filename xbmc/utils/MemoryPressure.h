@@ -0,0 +1,126 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+class CPressureStallMonitor;
+
+enum class MemoryPressure
+{
+  NONE,
+  MODERATE, //!< free what is cheap to get back, like unused textures
+  CRITICAL, //!< free everything that can be rebuilt
+};
+
+/*!
+ * \brief Asks the caches to give memory back when the system runs low on it.
+ *
+ * The caches keep their own limits, this only tells them when the system as a whole needs memory.
+ * The pressure is reported by the platform, pressure stall triggers on Linux and the low memory
+ * notification on Android, or found by polling the free memory where there's nothing to report
+ * it. The caches are trimmed on the application thread, in the order of their priority.
+ */
+class CMemoryPressureManager
+{
+public:
+  struct Usage
+  {
+    uint64_t bytes = 0; //!< estimated memory held by the cache, 0 if unknown
+    uint64_t items = 0; //!< number of cached entries, 0 if not counted
+  };
+
+  struct CacheUsage
+  {
+    std::string name;
+    int priority;
+    Usage usage;
+  };
+
+  using UsageFunc = std::function<Usage()>;
+  using TrimFunc = std::function<void(MemoryPressure pressure)>;
+
+  CMemoryPressureManager();
+  ~CMemoryPressureManager();
+
+  /*!
+   * \brief Start listening to the pressure notifications of the platform.
+   */
+  void Start();
+  void Stop();
+
+  /*!
+   * \brief Add a cache to trim.
+   * \param priority caches with a lower priority are trimmed first
+   * \param usage called from the application thread to report what the cache holds
+   * \param trim called from the application thread to free memory
+   * \return id to unregister the cache with
+   */
+  unsigned int RegisterCache(const std::string& name,
+                             int priority,
+                             UsageFunc usage,
+                             TrimFunc trim);
+  void UnregisterCache(unsigned int id);
+
+  /*!
+   * \brief Report memory pressure, from any thread. The caches are trimmed on the next Process().
+   */
+  void Notify(MemoryPressure pressure);
+
+  /*!
+   * \brief Trim the caches if pressure was reported and refresh their usage.
+   * Called periodically from the application thread.
+   */
+  void Process();
+
+  /*!
+   * \brief The usage of the caches as found by the last Process(), in the order they are trimmed.
+   */
+  std::vector<CacheUsage> GetUsage() const;
+
+  /*!
+   * \brief The pressure the caches were last trimmed for, NONE once it's been quiet for a while.
+   */
+  MemoryPressure GetLastPressure() const { return m_lastPressure; }
+
+private:
+  struct Cache
+  {
+    unsigned int id;
+    std::string name;
+    int priority;
+    UsageFunc usage;
+    TrimFunc trim;
+  };
+
+  MemoryPressure PollFreeMemory();
+  void Trim(MemoryPressure pressure);
+  void RefreshUsage();
+
+  mutable CCriticalSection m_section;
+  std::vector<Cache> m_caches;
+  std::vector<CacheUsage> m_usage;
+  unsigned int m_nextId = 1;
+
+  std::atomic<int> m_pending{static_cast<int>(MemoryPressure::NONE)};
+  std::atomic<MemoryPressure> m_lastPressure{MemoryPressure::NONE};
+  std::chrono::steady_clock::time_point m_lastTrim;
+  std::chrono::steady_clock::time_point m_lastPoll;
+  std::chrono::steady_clock::time_point m_lastUsage;
+
+  std::unique_ptr<CPressureStallMonitor> m_monitor;
+};
@@ -9,6 +9,8 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
+#include <iterator>
 #include <random>
 
 namespace KODI
@@ -22,5 +24,26 @@ void RandomShuffle(TIterator begin, TIterator end)
   std::mt19937 mt(rd());
   std::shuffle(begin, end, mt);
 }
+
+/*!
+ * \brief Move a random sample of count elements to the front of the range, in random order.
+ *
+ * Only shuffles as many elements as sampled, a few out of many are picked cheaply.
+ * \return the end of the sample
+ */
+template<class TIterator>
+TIterator RandomSample(TIterator begin, TIterator end, size_t count)
+{
+  std::random_device rd;
+  std::mt19937 mt(rd());
+  const auto size = static_cast<size_t>(std::distance(begin, end));
+  count = std::min(count, size);
+  for (size_t i = 0; i < count; ++i)
+  {
+    std::uniform_int_distribution<size_t> dist(i, size - 1);
+    std::iter_swap(begin + i, begin + dist(mt));
+  }
+  return begin + count;
+}
 }
 }
@@ -656,3 +656,63 @@ std::vector<CRegExp> CompileRegexes(const std::vector<std::string>& regExpPatter
   }
   return regExps;
 }
+
+namespace
+{
+bool CanBeAlternative(std::string_view pattern)
+{
+  // Start of pattern items such as (*UTF) are only allowed at the very start
+  if (pattern.starts_with("(*"))
+    return false;
+
+  for (size_t pos = 0; pos < pattern.size(); ++pos)
+  {
+    if (pattern[pos] == '\\' && pos + 1 < pattern.size())
+    {
+      const char next = pattern[++pos];
+      // Back references and subroutine calls by number are shifted by the other patterns,
+      // a \Q without \E would quote the end of the group
+      if ((next >= '1' && next <= '9') || next == 'g' || next == 'Q')
+        return false;
+    }
+    else if (pattern.substr(pos).starts_with("(?"))
+    {
+      size_t end = pos + 2;
+      if (end < pattern.size() && (StringUtils::isasciidigit(pattern[end]) ||
+                                   pattern[end] == '+' || pattern[end] == 'R'))
+        return false; // recursion by number
+      while (end < pattern.size() &&
+             (StringUtils::isasciiletter(pattern[end]) || pattern[end] == '^' ||
+              pattern[end] == '-'))
+      {
+        // Comments of extended mode could swallow the end of the group
+        if (pattern[end] == 'x')
+          return false;
+        if (pattern[end] == '-' && end + 1 < pattern.size() &&
+            StringUtils::isasciidigit(pattern[end + 1]))
+          return false; // relative recursion
+        ++end;
+      }
+    }
+  }
+  return true;
+}
+} // unnamed namespace
+
+namespace KODI::REGEXP
+{
+std::string CombinePatterns(const std::vector<std::string>& patterns)
+{
+  if (patterns.size() < 2 || !std::ranges::all_of(patterns, CanBeAlternative))
+    return {};
+
+  std::string combined;
+  for (const auto& pattern : patterns)
+  {
+    if (!combined.empty())
+      combined += '|';
+    combined += "(?:" + pattern + ')';
+  }
+  return combined;
+}
+} // namespace KODI::REGEXP
@@ -10,6 +10,7 @@
 
 //! @todo - move to std::regex (after switching to gcc 4.9 or higher) and get rid of CRegExp
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -176,7 +177,8 @@ using RegExpCache =
  * \brief Provide the caller with a compiled CRegExp for the provided pattern. The CRegExp will be
  *        retrieved from the optional cache first or created when it doesn't exist in the cache.
  *        note: the cache key is the pattern. The same CRegExp will be returned for the same pattern
- *        and different constructor arguments.
+ *        and different constructor arguments. Cached regexps are reused for many subjects, they
+ *        are JIT-compiled when PCRE2 supports it.
  * \tparam ...Args 
  * \param[in] pattern Regular expression pattern
  * \param[in] cache Optional cache of regexp
@@ -194,7 +196,7 @@ std::shared_ptr<CRegExp> GetRegExp(const std::string& pattern,
       return iter->second;
   }
   auto regexp = std::make_shared<CRegExp>(std::forward<Args>(ctorArgs)...);
-  if (!regexp->RegComp(pattern))
+  if (!regexp->RegComp(pattern, cache ? CRegExp::StudyWithJitComp : CRegExp::NoStudy))
     regexp.reset();
 
   // Unconditionnally add to the cache to avoid recompiling failing patterns.
@@ -203,4 +205,46 @@ std::shared_ptr<CRegExp> GetRegExp(const std::string& pattern,
 
   return regexp;
 }
+
+/*!
+ * \brief Combine the patterns into a single alternation that matches where any of them matches.
+ * \param[in] patterns Regular expression patterns
+ * \return The combined pattern, empty if there are less than two patterns or if a pattern can't
+ *         be part of an alternation, e.g. because it refers to its groups by number.
+ */
+std::string CombinePatterns(const std::vector<std::string>& patterns);
+
+/*!
+ * \brief Provide the caller with a single compiled CRegExp that matches when any of the provided
+ *        patterns matches, so a subject is tested against all of them in one pass. Only suitable
+ *        to tell whether one of the patterns matches, the captures of the patterns can't be told
+ *        apart.
+ * \param[in] patterns Regular expression patterns
+ * \param[in] cache Cache of regexp, holds the combined and the single patterns
+ * \param[in] ...ctorArgs Arguments to forward to the constructor of CRegExp
+ * \return The combined regexp, nullptr if the patterns can't be combined or one of them doesn't
+ *         compile. The caller has to try the patterns one by one then.
+ */
+template<typename... Args>
+std::shared_ptr<CRegExp> GetAnyOfRegExp(const std::vector<std::string>& patterns,
+                                        RegExpCache& cache,
+                                        const Args&... ctorArgs)
+{
+  const std::string combined = CombinePatterns(patterns);
+  if (combined.empty())
+    return {};
+
+  if (auto iter = cache.find(combined); iter != cache.end())
+    return iter->second;
+
+  // An invalid pattern could change the meaning of the alternation instead of failing it
+  std::shared_ptr<CRegExp> regexp;
+  if (std::ranges::all_of(patterns, [&](const std::string& pattern)
+                          { return GetRegExp(pattern, &cache, ctorArgs...) != nullptr; }))
+    regexp = GetRegExp(combined, &cache, ctorArgs...);
+  else
+    cache.emplace(combined, regexp);
+
+  return regexp;
+}
 } // namespace KODI::REGEXP
@@ -11,6 +11,8 @@
 #include "CharsetConverter.h"
 #include "ServiceBroker.h"
 #include "URL.h"
+#include "application/ApplicationComponents.h"
+#include "application/ApplicationPowerHandling.h"
 #include "filesystem/CurlFile.h"
 #include "filesystem/File.h"
 #include "guilib/GUIRSSControl.h"
@@ -374,6 +376,12 @@ void CRssReader::UpdateObserver()
 
 void CRssReader::CheckForUpdates()
 {
+  // the feeds are refreshed once there is someone to read them again
+  const auto appPower =
+      CServiceBroker::GetAppComponents().GetComponent<CApplicationPowerHandling>();
+  if (!m_requestRefresh && appPower && appPower->IsIdle())
+    return;
+
   KODI::TIME::SystemTime time;
   KODI::TIME::GetLocalTime(&time);
 
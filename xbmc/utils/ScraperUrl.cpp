@@ -9,24 +9,114 @@
 #include "ScraperUrl.h"
 
 #include "CharsetConverter.h"
+#include "FileItem.h"
+#include "FileItemList.h"
 #include "ServiceBroker.h"
 #include "URIUtils.h"
 #include "URL.h"
 #include "XMLUtils.h"
 #include "filesystem/CurlFile.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
 #include "filesystem/ZipFile.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/CharsetDetection.h"
+#include "utils/Digest.h"
 #include "utils/Mime.h"
 #include "utils/StringUtils.h"
 #include "utils/XBMCTinyXML.h"
 #include "utils/log.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
 #include <cstring>
 #include <sstream>
 
+using KODI::UTILITY::CDigest;
+
+namespace
+{
+// Responses without a cache attribute are cached by their URL, for all scrapers
+constexpr const char* HTTP_CACHE_FOLDER = "http";
+
+std::string GetHttpCacheFolder()
+{
+  return URIUtils::AddFileToFolder(
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_cachePath, "scrapers",
+      HTTP_CACHE_FOLDER);
+}
+
+int64_t GetUnixTime()
+{
+  return std::chrono::duration_cast<std::chrono::seconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+/*!
+ * \brief Seconds the response of the last request may be cached for.
+ * \return 0 if it failed or its Cache-Control header doesn't allow it
+ */
+int64_t GetHttpCacheTime(const XFILE::CCurlFile& http, int64_t maxTime)
+{
+  if (http.GetResponseCode() != 200)
+    return 0;
+
+  const std::string cacheControl =
+      StringUtils::ToLower(http.GetHttpHeader().GetValue("cache-control"));
+  for (std::string directive : StringUtils::Split(cacheControl, ','))
+  {
+    StringUtils::Trim(directive);
+    if (directive == "no-store" || directive == "no-cache")
+      return 0;
+    if (directive.starts_with("max-age="))
+      maxTime = std::min(maxTime, std::max<int64_t>(0, std::atoll(directive.c_str() + 8)));
+  }
+  return maxTime;
+}
+
+// A cached response is its expiry time as unix time on the first line, followed by the content
+bool ReadHttpCache(const std::string& cachePath, std::string& content)
+{
+  std::vector<uint8_t> buffer;
+  XFILE::CFile file;
+  if (!XFILE::CFile::Exists(cachePath) || file.LoadFile(cachePath, buffer) <= 0)
+    return false;
+
+  const auto* data = reinterpret_cast<const char*>(buffer.data());
+  const auto* end = data + buffer.size();
+  const auto* newline = std::find(data, end, '\n');
+  if (newline == end || std::atoll(std::string(data, newline).c_str()) <= GetUnixTime())
+    return false;
+
+  content.assign(newline + 1, end);
+  return true;
+}
+
+void WriteHttpCache(const std::string& cachePath, const std::string& content, int64_t cacheTime)
+{
+  // written aside and renamed, another scan may be reading the previous response
+  const std::string header = std::to_string(GetUnixTime() + cacheTime) + "\n";
+  const std::string tmpPath = cachePath + "." + StringUtils::CreateUUID();
+  XFILE::CFile file;
+  if (!file.OpenForWrite(tmpPath, true))
+    return;
+  const bool written =
+      file.Write(header.data(), header.size()) == static_cast<ssize_t>(header.size()) &&
+      file.Write(content.data(), content.size()) == static_cast<ssize_t>(content.size());
+  file.Close();
+
+  if (!written || (!XFILE::CFile::Rename(tmpPath, cachePath) &&
+                   !(XFILE::CFile::Delete(cachePath) && XFILE::CFile::Rename(tmpPath, cachePath))))
+  {
+    CLog::Log(LOGWARNING, "{}: Can't cache the response in \"{}\"", __FUNCTION__, cachePath);
+    XFILE::CFile::Delete(tmpPath);
+  }
+}
+} // namespace
+
 CScraperUrl::CScraperUrl() : m_relevance(0.0), m_parsed(false)
 {
 }
@@ -305,6 +395,9 @@ bool CScraperUrl::Get(const SUrlEntry& scrURL,
   CURL url(scrURL.m_url);
   http.SetReferer(scrURL.m_spoof);
   std::string strCachePath;
+  std::string httpCachePath;
+  const int64_t httpCacheTime =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_scraperHttpCacheTime;
 
   if (!scrURL.m_cache.empty())
   {
@@ -322,6 +415,16 @@ bool CScraperUrl::Get(const SUrlEntry& scrURL,
       }
     }
   }
+  else if (!scrURL.m_post && httpCacheTime > 0)
+  {
+    httpCachePath = URIUtils::AddFileToFolder(
+        GetHttpCacheFolder(), CDigest::Calculate(CDigest::Type::MD5, scrURL.m_url));
+    if (ReadHttpCache(httpCachePath, strHTML))
+    {
+      CLog::Log(LOGDEBUG, "{}: Using cached response of \"{}\"", __FUNCTION__, scrURL.m_url);
+      return true;
+    }
+  }
 
   auto strHTML1 = strHTML;
 
@@ -430,5 +533,34 @@ bool CScraperUrl::Get(const SUrlEntry& scrURL,
         file.Write(strHTML.data(), strHTML.size()) != static_cast<ssize_t>(strHTML.size()))
       return false;
   }
+  else if (!httpCachePath.empty())
+  {
+    const int64_t cacheTime = GetHttpCacheTime(http, httpCacheTime);
+    if (cacheTime > 0)
+      WriteHttpCache(httpCachePath, strHTML, cacheTime);
+  }
   return true;
 }
+
+void CScraperUrl::ClearHttpCache()
+{
+  const int64_t cacheTime =
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_scraperHttpCacheTime;
+  const std::string cachePath = GetHttpCacheFolder();
+  if (!XFILE::CDirectory::Exists(cachePath))
+  {
+    XFILE::CDirectory::Create(cachePath);
+    return;
+  }
+
+  // no response is cached longer than the configured time since it was written
+  const CDateTime oldest =
+      CDateTime::GetCurrentDateTime() - CDateTimeSpan(0, 0, 0, static_cast<int>(cacheTime));
+  CFileItemList items;
+  XFILE::CDirectory::GetDirectory(cachePath, items, "", XFILE::DIR_FLAG_DEFAULTS);
+  for (const auto& item : items)
+  {
+    if (!item->IsFolder() && item->GetDateTime() <= oldest)
+      XFILE::CFile::Delete(item->GetDynPath());
+  }
+}
@@ -102,11 +102,20 @@ public:
    */
   static std::string GetThumbUrl(const CScraperUrl::SUrlEntry& entry);
 
+  /*! \brief fetch the content of a URL entry
+   Entries with a cache file name are cached in the folder of cacheContext. Other GET requests
+   are cached by URL for all scrapers, for as long as the advanced settings and the response
+   headers allow.
+   */
   static bool Get(const SUrlEntry& scrURL,
                   std::string& strHTML,
                   XFILE::CCurlFile& http,
                   const std::string& cacheContext);
 
+  /*! \brief delete the responses cached by URL which expired
+   */
+  static void ClearHttpCache();
+
   // ATTENTION: this member MUST NOT be used directly except from databases
   std::string m_data;
 
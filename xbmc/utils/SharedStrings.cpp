@@ -0,0 +1,248 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "SharedStrings.h"
+
+#include "threads/CriticalSection.h"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+
+namespace
+{
+size_t Hash(const std::string& value)
+{
+  return std::hash<std::string>{}(value);
+}
+
+size_t Hash(const std::vector<std::string>& value)
+{
+  size_t hash = value.size();
+  for (const auto& str : value)
+    hash ^= Hash(str) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  return hash;
+}
+
+size_t ApproximateSize(const std::string& value)
+{
+  return sizeof(value) + value.capacity();
+}
+
+size_t ApproximateSize(const std::vector<std::string>& value)
+{
+  size_t size = sizeof(value);
+  for (const auto& str : value)
+    size += ApproximateSize(str);
+  return size;
+}
+} // unnamed namespace
+
+template<typename T>
+struct CSharedValue<T>::Entry
+{
+  Entry(T&& v, size_t h) : value(std::move(v)), hash(h) {}
+
+  std::atomic<unsigned int> refs{1};
+  const T value;
+  const size_t hash;
+};
+
+template<typename T>
+class CSharedValue<T>::CPool
+{
+public:
+  Entry* Acquire(T&& value)
+  {
+    const size_t hash = Hash(value);
+
+    std::unique_lock lock(m_critSection);
+    const auto it = m_entries.find(Key{&value, hash});
+    if (it != m_entries.end())
+    {
+      // may bring an entry back whose last handle waits for the lock in Release
+      (*it)->refs++;
+      return *it;
+    }
+
+    Entry* entry = new Entry(std::move(value), hash);
+    m_entries.insert(entry);
+    return entry;
+  }
+
+  void Release(Entry* entry)
+  {
+    // the count only drops to zero under the lock, so Acquire can't hand out a deleted entry
+    unsigned int refs = entry->refs.load();
+    while (refs > 1)
+    {
+      if (entry->refs.compare_exchange_weak(refs, refs - 1))
+        return;
+    }
+
+    std::unique_lock lock(m_critSection);
+    if (--entry->refs == 0)
+    {
+      m_entries.erase(entry);
+      delete entry;
+    }
+  }
+
+  SharedValuesStats GetStats()
+  {
+    SharedValuesStats stats;
+
+    std::unique_lock lock(m_critSection);
+    for (const Entry* entry : m_entries)
+    {
+      const size_t size = ApproximateSize(entry->value);
+      const size_t refs = entry->refs;
+      stats.values++;
+      stats.references += refs;
+      stats.bytes += size;
+      stats.savedBytes += (refs - 1) * size;
+    }
+    return stats;
+  }
+
+private:
+  struct Key
+  {
+    const T* value;
+    size_t hash;
+  };
+
+  struct EntryHash
+  {
+    using is_transparent = void;
+    size_t operator()(const Entry* entry) const { return entry->hash; }
+    size_t operator()(const Key& key) const { return key.hash; }
+  };
+
+  struct EntryEqual
+  {
+    using is_transparent = void;
+    bool operator()(const Entry* lhs, const Entry* rhs) const { return lhs == rhs; }
+    bool operator()(const Key& lhs, const Entry* rhs) const { return *lhs.value == rhs->value; }
+    bool operator()(const Entry* lhs, const Key& rhs) const { return lhs->value == *rhs.value; }
+  };
+
+  CCriticalSection m_critSection;
+  std::unordered_set<Entry*, EntryHash, EntryEqual> m_entries;
+};
+
+template<typename T>
+typename CSharedValue<T>::CPool& CSharedValue<T>::GetPool()
+{
+  // never destroyed, handles in static objects may outlive it otherwise
+  static CPool* pool = new CPool;
+  return *pool;
+}
+
+template<typename T>
+CSharedValue<T>::CSharedValue(const T& value) : CSharedValue(T(value))
+{
+}
+
+template<typename T>
+CSharedValue<T>::CSharedValue(T&& value)
+{
+  if (!value.empty())
+    m_entry = GetPool().Acquire(std::move(value));
+}
+
+template<typename T>
+CSharedValue<T>::CSharedValue(const CSharedValue& other) noexcept : m_entry(other.m_entry)
+{
+  if (m_entry)
+    m_entry->refs++;
+}
+
+template<typename T>
+CSharedValue<T>::CSharedValue(CSharedValue&& other) noexcept : m_entry(other.m_entry)
+{
+  other.m_entry = nullptr;
+}
+
+template<typename T>
+CSharedValue<T>::~CSharedValue()
+{
+  Release();
+}
+
+template<typename T>
+CSharedValue<T>& CSharedValue<T>::operator=(const CSharedValue& other) noexcept
+{
+  if (m_entry != other.m_entry)
+  {
+    if (other.m_entry)
+      other.m_entry->refs++;
+    Release();
+    m_entry = other.m_entry;
+  }
+  return *this;
+}
+
+template<typename T>
+CSharedValue<T>& CSharedValue<T>::operator=(CSharedValue&& other) noexcept
+{
+  if (this != &other)
+  {
+    Release();
+    m_entry = other.m_entry;
+    other.m_entry = nullptr;
+  }
+  return *this;
+}
+
+template<typename T>
+const T& CSharedValue<T>::Get() const
+{
+  static const T empty;
+  return m_entry ? m_entry->value : empty;
+}
+
+template<typename T>
+void CSharedValue<T>::clear()
+{
+  Release();
+}
+
+template<typename T>
+void CSharedValue<T>::Release()
+{
+  if (m_entry)
+  {
+    GetPool().Release(m_entry);
+    m_entry = nullptr;
+  }
+}
+
+template<typename T>
+SharedValuesStats CSharedValue<T>::GetStats()
+{
+  return GetPool().GetStats();
+}
+
+template class CSharedValue<std::string>;
+template class CSharedValue<std::vector<std::string>>;
+
+SharedValuesStats GetSharedStringsStats()
+{
+  const SharedValuesStats strings = CSharedString::GetStats();
+  const SharedValuesStats lists = CSharedStringList::GetStats();
+  return {strings.values + lists.values, strings.references + lists.references,
+          strings.bytes + lists.bytes, strings.savedBytes + lists.savedBytes};
+}
+
+void CSharedStringList::push_back(std::string value)
+{
+  std::vector<std::string> list = Get();
+  list.emplace_back(std::move(value));
+  *this = CSharedStringList(std::move(list));
+}
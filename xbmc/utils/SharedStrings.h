@@ -0,0 +1,124 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief Memory used by the values of a pool of shared values.
+ */
+struct SharedValuesStats
+{
+  size_t values{0}; //!< number of distinct values
+  size_t references{0}; //!< number of handles to them
+  size_t bytes{0}; //!< approximate size of the distinct values
+  size_t savedBytes{0}; //!< approximate size of the copies a value per handle would take
+};
+
+/*!
+ * \brief Handle to an immutable value that is kept once for the whole process.
+ *
+ * Library items repeat the same genres, studios, countries, codecs and artists endlessly.
+ * Equal values are stored once in a pool and the items only hold a reference counted handle.
+ * Copying a handle doesn't lock, creating one from a value looks it up in the pool. The value
+ * is removed from the pool with its last handle.
+ */
+template<typename T>
+class CSharedValue
+{
+public:
+  CSharedValue() = default;
+  CSharedValue(const T& value);
+  CSharedValue(T&& value);
+  CSharedValue(const CSharedValue& other) noexcept;
+  CSharedValue(CSharedValue&& other) noexcept;
+  ~CSharedValue();
+
+  CSharedValue& operator=(const CSharedValue& other) noexcept;
+  CSharedValue& operator=(CSharedValue&& other) noexcept;
+
+  const T& Get() const;
+  operator const T&() const { return Get(); }
+
+  bool empty() const { return m_entry == nullptr; }
+  void clear();
+
+  //! equal values share the same entry
+  bool operator==(const CSharedValue& rhs) const { return m_entry == rhs.m_entry; }
+
+  static SharedValuesStats GetStats();
+
+private:
+  struct Entry;
+  class CPool;
+
+  static CPool& GetPool();
+  void Release();
+
+  Entry* m_entry{nullptr}; //!< nullptr for the empty value
+};
+
+/*!
+ * \brief Shared, immutable string, reads like a const std::string.
+ */
+class CSharedString : public CSharedValue<std::string>
+{
+public:
+  using CSharedValue::CSharedValue;
+  CSharedString(const char* value) : CSharedValue(std::string(value)) {}
+  CSharedString(std::string_view value) : CSharedValue(std::string(value)) {}
+
+  const char* c_str() const { return Get().c_str(); }
+  size_t size() const { return Get().size(); }
+  size_t length() const { return Get().length(); }
+  operator std::string_view() const { return Get(); }
+
+  using CSharedValue::operator==;
+  bool operator==(std::string_view rhs) const { return Get() == rhs; }
+  bool operator==(const std::string& rhs) const { return Get() == rhs; }
+  bool operator==(const char* rhs) const { return Get() == rhs; }
+};
+
+/*!
+ * \brief Shared, immutable list of strings, reads like a const std::vector<std::string>.
+ *
+ * The modifiers build a new list and share that one.
+ */
+class CSharedStringList : public CSharedValue<std::vector<std::string>>
+{
+public:
+  using CSharedValue::CSharedValue;
+  using const_iterator = std::vector<std::string>::const_iterator;
+
+  const_iterator begin() const { return Get().begin(); }
+  const_iterator end() const { return Get().end(); }
+  size_t size() const { return Get().size(); }
+  const std::string& operator[](size_t index) const { return Get()[index]; }
+  const std::string& at(size_t index) const { return Get().at(index); }
+  const std::string& front() const { return Get().front(); }
+  const std::string& back() const { return Get().back(); }
+
+  void push_back(std::string value);
+  void emplace_back(std::string value) { push_back(std::move(value)); }
+
+  using CSharedValue::operator==;
+  bool operator==(const std::vector<std::string>& rhs) const { return Get() == rhs; }
+};
+
+/*!
+ * \brief Memory used by the shared strings and string lists together.
+ */
+SharedValuesStats GetSharedStringsStats();
+
+extern template class CSharedValue<std::string>;
+extern template class CSharedValue<std::vector<std::string>>;
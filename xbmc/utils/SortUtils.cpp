@@ -18,7 +18,9 @@
 
 #include <algorithm>
 #include <array>
+#include <future>
 #include <limits>
+#include <thread>
 
 std::string ArrayToString(SortAttribute attributes, const CVariant &variant, const std::string &separator = " / ")
 {
@@ -513,142 +515,153 @@ std::string ByBPM(SortAttribute attributes, const SortItem& values)
                              ByLabel(attributes, values));
 }
 
-bool preliminarySort(const SortItem& left,
-                     const SortItem& right,
-                     bool handleFolder,
-                     bool& result,
-                     std::wstring& labelLeft,
-                     std::wstring& labelRight)
+/*!
+ * \brief Everything a comparison needs, gathered once per item before sorting.
+ *
+ * Comparing the items directly meant several map lookups and a copy of both wide labels for
+ * every comparison, which dominated the time spent sorting large libraries.
+ */
+struct SortKey
 {
-  // make sure both items have the necessary data to do the sorting
-  const auto itLeftSort = left.find(Field::SORT);
-  if (itLeftSort == left.end())
-  {
-    result = false;
-    return true;
-  }
-  const auto itRightSort = right.find(Field::SORT);
-  if (itRightSort == right.end())
-  {
-    result = true;
-    return true;
-  }
+  int rank; //!< 0 for SortSpecial::TOP, 1 for unspecial items, 2 for SortSpecial::BOTTOM
+  int folder; //!< -1 if the item has no folder flag
+  std::wstring label;
+  size_t index; //!< position of the item before sorting
+};
 
-  // look at special sorting behaviour
-  SortSpecial leftSortSpecial = SortSpecial::NONE;
-  SortSpecial rightSortSpecial = SortSpecial::NONE;
-  if (const auto itLeft = left.find(Field::SORT_SPECIAL);
-      itLeft != left.end() &&
-      itLeft->second.asInteger() <= static_cast<int64_t>(SortSpecial::BOTTOM))
-    leftSortSpecial = static_cast<SortSpecial>(itLeft->second.asInteger());
-  if (const auto itRight = right.find(Field::SORT_SPECIAL);
-      itRight != right.end() &&
-      itRight->second.asInteger() <= static_cast<int64_t>(SortSpecial::BOTTOM))
-    rightSortSpecial = static_cast<SortSpecial>(itRight->second.asInteger());
-
-  // one has a special sort
-  if (leftSortSpecial != rightSortSpecial)
-  {
-    // left should be sorted on top
-    // or right should be sorted on bottom
-    // => left is sorted above right
-    if (leftSortSpecial == SortSpecial::TOP || rightSortSpecial == SortSpecial::BOTTOM)
-    {
-      result = true;
-      return true;
-    }
+int GetSortRank(const SortItem& item)
+{
+  const auto it = item.find(Field::SORT_SPECIAL);
+  if (it == item.end())
+    return 1;
 
-    // otherwise right is sorted above left
-    result = false;
-    return true;
-  }
-  // both have either sort on top or sort on bottom -> leave as-is
-  else if (leftSortSpecial != SortSpecial::NONE)
+  switch (it->second.asInteger())
   {
-    result = false;
-    return true;
+    case static_cast<int64_t>(SortSpecial::TOP):
+      return 0;
+    case static_cast<int64_t>(SortSpecial::BOTTOM):
+      return 2;
+    default:
+      return 1;
   }
-
-  if (handleFolder)
-  {
-    const auto itLeft = left.find(Field::FOLDER);
-    const auto itRight = right.find(Field::FOLDER);
-    if (itLeft != left.end() && itRight != right.end() &&
-        itLeft->second.asBoolean() != itRight->second.asBoolean())
-    {
-      result = itLeft->second.asBoolean();
-      return true;
-    }
-  }
-
-  labelLeft = itLeftSort->second.asWideString();
-  labelRight = itRightSort->second.asWideString();
-
-  return false;
 }
 
-bool SorterAscending(const SortItem &left, const SortItem &right)
+SortKey GetSortKey(SortItem& item, std::wstring&& sortLabel, size_t index)
 {
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, true, result, labelLeft, labelRight))
-    return result;
+  SortKey key{GetSortRank(item), -1, {}, index};
+  if (const auto it = item.find(Field::FOLDER); it != item.end())
+    key.folder = it->second.asBoolean() ? 1 : 0;
 
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) < 0;
+  // an existing sort label is kept, as the items are handed back with it
+  const auto [it, inserted] = item.try_emplace(Field::SORT, sortLabel);
+  key.label = inserted ? std::move(sortLabel) : it->second.asWideString();
+  return key;
 }
 
-bool SorterDescending(const SortItem &left, const SortItem &right)
+template<bool descending>
+bool CompareSortKeys(const SortKey& left, const SortKey& right, bool handleFolder)
 {
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, true, result, labelLeft, labelRight))
-    return result;
+  // items sorted on top or bottom keep their order amongst each other
+  if (left.rank != right.rank)
+    return left.rank < right.rank;
+  if (left.rank != 1)
+    return false;
+
+  if (handleFolder && left.folder >= 0 && right.folder >= 0 && left.folder != right.folder)
+    return left.folder > right.folder;
 
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) > 0;
+  const int64_t result = StringUtils::AlphaNumericCompare(left.label, right.label);
+  return descending ? result > 0 : result < 0;
 }
 
-bool SorterIgnoreFoldersAscending(const SortItem &left, const SortItem &right)
+/*!
+ * \brief Stable sort of the keys, split over several threads for large listings.
+ *
+ * Chunks are sorted concurrently and neighbouring chunks merged afterwards, which keeps equal
+ * keys in their original order. std::execution::par isn't available on all our platforms.
+ */
+template<typename Compare>
+void StableSortKeys(std::vector<SortKey>& keys, Compare compare)
 {
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, false, result, labelLeft, labelRight))
-    return result;
+  // below this many keys per thread starting the threads costs more than it saves
+  constexpr size_t MIN_KEYS_PER_THREAD = 4096;
+  constexpr size_t MAX_THREADS = 8;
 
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) < 0;
-}
+  const size_t threads = std::min({static_cast<size_t>(std::thread::hardware_concurrency()),
+                                   keys.size() / MIN_KEYS_PER_THREAD, MAX_THREADS});
+  if (threads < 2)
+  {
+    std::ranges::stable_sort(keys, compare);
+    return;
+  }
 
-bool SorterIgnoreFoldersDescending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, false, result, labelLeft, labelRight))
-    return result;
+  std::vector<std::vector<SortKey>::iterator> bounds;
+  for (size_t i = 0; i <= threads; ++i)
+    bounds.emplace_back(keys.begin() + keys.size() * i / threads);
 
-  return StringUtils::AlphaNumericCompare(labelLeft, labelRight) > 0;
-}
+  const auto runParallel = [](size_t count, size_t step, const auto& task)
+  {
+    std::vector<std::future<void>> tasks;
+    for (size_t i = step; i < count; i += step)
+      tasks.emplace_back(std::async(std::launch::async, task, i));
+    task(0);
+    for (auto& result : tasks)
+      result.get();
+  };
 
-bool SorterIndirectAscending(const std::shared_ptr<SortItem>& left,
-                             const std::shared_ptr<SortItem>& right)
-{
-  return SorterAscending(*left, *right);
-}
+  runParallel(threads, 1, [&bounds, &compare](size_t i)
+              { std::stable_sort(bounds[i], bounds[i + 1], compare); });
 
-bool SorterIndirectDescending(const std::shared_ptr<SortItem>& left,
-                              const std::shared_ptr<SortItem>& right)
-{
-  return SorterDescending(*left, *right);
+  for (size_t width = 1; width < threads; width *= 2)
+  {
+    runParallel(threads - width, width * 2,
+                [&bounds, &compare, threads, width](size_t i)
+                {
+                  std::inplace_merge(bounds[i], bounds[i + width],
+                                     bounds[std::min(i + width * 2, threads)], compare);
+                });
+  }
 }
 
-bool SorterIndirectIgnoreFoldersAscending(const std::shared_ptr<SortItem>& left,
-                                          const std::shared_ptr<SortItem>& right)
+template<typename T, typename Item>
+void SortByKeys(std::vector<T>& items,
+                SortOrder sortOrder,
+                SortAttribute attributes,
+                const SortUtils::SortPreparator& preparator,
+                const Fields& sortingFields,
+                Item getItem)
 {
-  return SorterIgnoreFoldersAscending(*left, *right);
-}
+  std::vector<SortKey> keys;
+  keys.reserve(items.size());
+  for (size_t i = 0; i < items.size(); ++i)
+  {
+    SortItem& item = getItem(items[i]);
 
-bool SorterIndirectIgnoreFoldersDescending(const std::shared_ptr<SortItem>& left,
-                                           const std::shared_ptr<SortItem>& right)
-{
-  return SorterIgnoreFoldersDescending(*left, *right);
+    // add all fields to the item that are required for sorting if they are currently missing
+    for (const auto& field : sortingFields)
+    {
+      if (!item.contains(field))
+        item.emplace(field, CVariant::ConstNullVariant);
+    }
+
+    std::wstring sortLabel;
+    g_charsetConverter.utf8ToW(preparator(attributes, item), sortLabel, false);
+    keys.emplace_back(GetSortKey(item, std::move(sortLabel), i));
+  }
+
+  const bool handleFolder = !(attributes & SortAttributeIgnoreFolders);
+  if (sortOrder == SortOrder::DESCENDING)
+    StableSortKeys(keys, [handleFolder](const SortKey& left, const SortKey& right)
+                   { return CompareSortKeys<true>(left, right, handleFolder); });
+  else
+    StableSortKeys(keys, [handleFolder](const SortKey& left, const SortKey& right)
+                   { return CompareSortKeys<false>(left, right, handleFolder); });
+
+  std::vector<T> sorted;
+  sorted.reserve(items.size());
+  for (const auto& key : keys)
+    sorted.emplace_back(std::move(items[key.index]));
+  items = std::move(sorted);
 }
 
 // clang-format off
@@ -981,25 +994,9 @@ void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attribute
     SortPreparator preparator = getPreparator(sortBy);
     if (preparator)
     {
-      Fields sortingFields = GetFieldsForSorting(sortBy);
-
-      // Prepare the string used for sorting and store it under FieldSort
-      for (auto& item : items)
-      {
-        // add all fields to the item that are required for sorting if they are currently missing
-        for (const auto& field : sortingFields)
-        {
-          if (!item.contains(field))
-            item.emplace(field, CVariant::ConstNullVariant);
-        }
-
-        std::wstring sortLabel;
-        g_charsetConverter.utf8ToW(preparator(attributes, item), sortLabel, false);
-        item.emplace(Field::SORT, CVariant(sortLabel));
-      }
-
-      // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorter(sortOrder, attributes));
+      // Prepare the string used for sorting, store it under FieldSort and sort on the keys
+      SortByKeys(items, sortOrder, attributes, preparator, GetFieldsForSorting(sortBy),
+                 [](DatabaseResult& item) -> SortItem& { return item; });
     }
   }
 
@@ -1020,25 +1017,9 @@ void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attribute
     SortPreparator preparator = getPreparator(sortBy);
     if (preparator)
     {
-      Fields sortingFields = GetFieldsForSorting(sortBy);
-
-      // Prepare the string used for sorting and store it under FieldSort
-      for (auto& item : items)
-      {
-        // add all fields to the item that are required for sorting if they are currently missing
-        for (const auto& field : sortingFields)
-        {
-          if (!item->contains(field))
-            item->emplace(field, CVariant::ConstNullVariant);
-        }
-
-        std::wstring sortLabel;
-        g_charsetConverter.utf8ToW(preparator(attributes, *item), sortLabel, false);
-        item->emplace(Field::SORT, CVariant(sortLabel));
-      }
-
-      // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorterIndirect(sortOrder, attributes));
+      // Prepare the string used for sorting, store it under FieldSort and sort on the keys
+      SortByKeys(items, sortOrder, attributes, preparator, GetFieldsForSorting(sortBy),
+                 [](const std::shared_ptr<SortItem>& item) -> SortItem& { return *item; });
     }
   }
 
@@ -1093,24 +1074,6 @@ const SortUtils::SortPreparator& SortUtils::getPreparator(SortBy sortBy)
   return it == m_preparators.end() ? m_preparators[SortBy::NONE] : it->second;
 }
 
-SortUtils::Sorter SortUtils::getSorter(SortOrder sortOrder, SortAttribute attributes)
-{
-  if (attributes & SortAttributeIgnoreFolders)
-    return sortOrder == SortOrder::DESCENDING ? SorterIgnoreFoldersDescending
-                                              : SorterIgnoreFoldersAscending;
-
-  return sortOrder == SortOrder::DESCENDING ? SorterDescending : SorterAscending;
-}
-
-SortUtils::SorterIndirect SortUtils::getSorterIndirect(SortOrder sortOrder, SortAttribute attributes)
-{
-  if (attributes & SortAttributeIgnoreFolders)
-    return sortOrder == SortOrder::DESCENDING ? SorterIndirectIgnoreFoldersDescending
-                                              : SorterIndirectIgnoreFoldersAscending;
-
-  return sortOrder == SortOrder::DESCENDING ? SorterIndirectDescending : SorterIndirectAscending;
-}
-
 const Fields& SortUtils::GetFieldsForSorting(SortBy sortBy)
 {
   const auto it = m_sortingFields.find(sortBy);
@@ -229,14 +229,9 @@ public:
   static std::string RemoveArticles(const std::string &label);
 
   using SortPreparator = std::function<std::string(SortAttribute, const SortItem&)>;
-  using Sorter = std::function<bool(const SortItem&, const SortItem&)>;
-  using SorterIndirect =
-      std::function<bool(const std::shared_ptr<SortItem>&, const std::shared_ptr<SortItem>&)>;
 
 private:
   static const SortPreparator& getPreparator(SortBy sortBy);
-  static Sorter getSorter(SortOrder sortOrder, SortAttribute attributes);
-  static SorterIndirect getSorterIndirect(SortOrder sortOrder, SortAttribute attributes);
 
   static std::map<SortBy, SortPreparator> m_preparators;
   static std::map<SortBy, Fields> m_sortingFields;
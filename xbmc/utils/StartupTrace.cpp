@@ -0,0 +1,119 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "StartupTrace.h"
+
+#include "filesystem/File.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/Variant.h"
+#include "utils/log.h"
+
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono;
+
+namespace
+{
+struct TraceEvent
+{
+  std::string name;
+  int64_t start; //!< microseconds since the trace started
+  int64_t duration;
+  size_t thread;
+};
+
+std::mutex traceMutex;
+steady_clock::time_point traceStart;
+std::vector<TraceEvent> traceEvents;
+} // namespace
+
+std::atomic<bool> CStartupTrace::m_enabled{false};
+
+void CStartupTrace::Enable()
+{
+  std::unique_lock lock(traceMutex);
+  traceStart = steady_clock::now();
+  traceEvents.clear();
+  m_enabled = true;
+}
+
+void CStartupTrace::Finish(const std::string& path)
+{
+  if (!m_enabled.exchange(false))
+    return;
+
+  CVariant events(CVariant::VariantTypeArray);
+  {
+    std::unique_lock lock(traceMutex);
+    for (const TraceEvent& event : traceEvents)
+    {
+      CVariant traceEvent(CVariant::VariantTypeObject);
+      traceEvent["name"] = event.name;
+      traceEvent["ph"] = "X";
+      traceEvent["ts"] = event.start;
+      traceEvent["dur"] = event.duration;
+      traceEvent["pid"] = 1;
+      traceEvent["tid"] = static_cast<uint64_t>(event.thread);
+      events.push_back(std::move(traceEvent));
+    }
+    traceEvents.clear();
+  }
+
+  CVariant trace(CVariant::VariantTypeObject);
+  trace["traceEvents"] = std::move(events);
+  trace["displayTimeUnit"] = "ms";
+
+  std::string json;
+  XFILE::CFile file;
+  if (!CJSONVariantWriter::Write(trace, json, true) || !file.OpenForWrite(path, true) ||
+      file.Write(json.data(), json.size()) != static_cast<ssize_t>(json.size()))
+  {
+    CLog::Log(LOGERROR, "CStartupTrace::{}: unable to write {}", __func__, path);
+    return;
+  }
+  CLog::Log(LOGINFO, "CStartupTrace::{}: startup timeline written to {}", __func__, path);
+}
+
+void CStartupTrace::Record(std::string name,
+                           steady_clock::time_point start,
+                           steady_clock::time_point end)
+{
+  const size_t thread = std::hash<std::thread::id>()(std::this_thread::get_id());
+
+  std::unique_lock lock(traceMutex);
+  if (!m_enabled)
+    return;
+
+  traceEvents.push_back({std::move(name),
+                         duration_cast<microseconds>(start - traceStart).count(),
+                         duration_cast<microseconds>(end - start).count(), thread});
+}
+
+CStartupTrace::CScope::CScope(std::string_view name, std::string_view detail)
+  : m_active(IsEnabled())
+{
+  if (!m_active)
+    return;
+
+  m_name = name;
+  if (!detail.empty())
+  {
+    m_name += ' ';
+    m_name += detail;
+  }
+  m_start = steady_clock::now();
+}
+
+CStartupTrace::CScope::~CScope()
+{
+  if (m_active)
+    Record(std::move(m_name), m_start, steady_clock::now());
+}
@@ -0,0 +1,58 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <string_view>
+
+/*!
+ * \brief Records how long the phases of the startup take, as a timeline for chrome://tracing or
+ * https://ui.perfetto.dev.
+ *
+ * Nothing is recorded unless the application was started with --trace-startup, a scope only
+ * tests a flag then.
+ */
+class CStartupTrace
+{
+public:
+  static void Enable();
+  static bool IsEnabled() { return m_enabled.load(std::memory_order_relaxed); }
+
+  /*!
+   * \brief Stop recording and write the recorded phases as Chrome trace JSON.
+   * \param path the file to write, replaced if it exists
+   */
+  static void Finish(const std::string& path);
+
+  /*!
+   * \brief Records the time from its construction to its destruction as one phase.
+   */
+  class CScope
+  {
+  public:
+    explicit CScope(std::string_view name, std::string_view detail = {});
+    ~CScope();
+    CScope(const CScope&) = delete;
+    CScope& operator=(const CScope&) = delete;
+
+  private:
+    std::string m_name;
+    std::chrono::steady_clock::time_point m_start;
+    bool m_active;
+  };
+
+private:
+  static void Record(std::string name,
+                     std::chrono::steady_clock::time_point start,
+                     std::chrono::steady_clock::time_point end);
+
+  static std::atomic<bool> m_enabled;
+};
@@ -66,7 +66,7 @@ void CStreamDetailVideo::Archive(CArchive& ar)
 }
 void CStreamDetailVideo::Serialize(CVariant& value) const
 {
-  value["codec"] = m_strCodec;
+  value["codec"] = m_strCodec.Get();
   value["aspect"] = m_fAspect;
   value["height"] = m_iHeight;
   value["width"] = m_iWidth;
@@ -117,7 +117,7 @@ void CStreamDetailAudio::Archive(CArchive& ar)
 }
 void CStreamDetailAudio::Serialize(CVariant& value) const
 {
-  value["codec"] = m_strCodec;
+  value["codec"] = m_strCodec.Get();
   value["language"] = m_strLanguage;
   value["channels"] = m_iChannels;
 }
@@ -11,6 +11,7 @@
 #include "ISerializable.h"
 #include "cores/VideoPlayer/Interface/StreamInfo.h"
 #include "utils/IArchivable.h"
+#include "utils/SharedStrings.h"
 
 #include <memory>
 #include <string>
@@ -57,7 +58,7 @@ public:
   int m_iHeight = 0;
   float m_fAspect = 0.0;
   int m_iDuration = 0;
-  std::string m_strCodec;
+  CSharedString m_strCodec; // the same few codec names for the whole library
   std::string m_strStereoMode;
   std::string m_strLanguage;
   std::string m_strHdrType;
@@ -75,7 +76,7 @@ public:
   bool IsWorseThan(const CStreamDetail &that) const override;
 
   int m_iChannels = -1;
-  std::string m_strCodec;
+  CSharedString m_strCodec;
   std::string m_strLanguage;
 };
 
@@ -37,7 +37,10 @@
 #include <algorithm>
 #include <array>
 #include <assert.h>
+#include <bit>
 #include <cctype>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <inttypes.h>
 #include <iomanip>
@@ -52,6 +55,10 @@
 #include <fstrcmp.h>
 #include <memory.h>
 
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #define FORMAT_BLOCK_SIZE 512 // # of bytes for initial allocation for printf
 
 namespace KODI::UTILS
@@ -82,6 +89,129 @@ T NumberFromSS(std::string_view str, T fallback)
 {
   return 'a' <= c && c <= 'z' ? c - 'a' + 'A' : c;
 }
+
+/*
+ * The ASCII case conversions below work on 16 or 8 bytes at once. Bytes of UTF-8 sequences are
+ * never ASCII letters, so they are copied as they are, like the byte-wise versions do.
+ * First is 'A' to lower the case, 'a' to raise it.
+ */
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+template<char First>
+__m128i ToggleAsciiCase(__m128i block)
+{
+  // Moves First..First+25 to -128..-103, the lowest values of a signed byte
+  const __m128i shifted = _mm_add_epi8(block, _mm_set1_epi8(static_cast<char>(0x80 - First)));
+  const __m128i isLetter = _mm_cmplt_epi8(shifted, _mm_set1_epi8(-128 + 26));
+  return _mm_xor_si128(block, _mm_and_si128(isLetter, _mm_set1_epi8(0x20)));
+}
+#endif
+
+template<char First>
+uint64_t ToggleAsciiCase(uint64_t block)
+{
+  constexpr uint64_t ones = 0x0101010101010101ULL;
+  constexpr uint64_t highBits = 0x8080808080808080ULL;
+  const uint64_t heptets = block & ~highBits;
+  // The high bit of each byte tells whether the byte is >= First, resp. > First+25
+  const uint64_t geFirst = heptets + (0x80 - First) * ones;
+  const uint64_t gtLast = heptets + (0x80 - (First + 26)) * ones;
+  const uint64_t isLetter = ~block & (geFirst ^ gtLast) & highBits;
+  return block ^ (isLetter >> 2);
+}
+
+template<char First>
+void ChangeAsciiCase(const char* in, char* out, size_t len) noexcept
+{
+  size_t pos = 0;
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+  for (; pos + 16 <= len; pos += 16)
+  {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + pos));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + pos), ToggleAsciiCase<First>(block));
+  }
+#endif
+  for (; pos + 8 <= len; pos += 8)
+  {
+    uint64_t block;
+    std::memcpy(&block, in + pos, sizeof(block));
+    block = ToggleAsciiCase<First>(block);
+    std::memcpy(out + pos, &block, sizeof(block));
+  }
+  for (; pos < len; ++pos)
+    out[pos] = First == 'A' ? StringUtils::ToLowerAscii(in[pos]) : ToUpperAscii(in[pos]);
+}
+
+bool EqualsAsciiNoCase(const char* str1, const char* str2, size_t len) noexcept
+{
+  size_t pos = 0;
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+  for (; pos + 16 <= len; pos += 16)
+  {
+    const __m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str1 + pos));
+    const __m128i block2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str2 + pos));
+    const __m128i equal =
+        _mm_cmpeq_epi8(ToggleAsciiCase<'A'>(block1), ToggleAsciiCase<'A'>(block2));
+    if (_mm_movemask_epi8(equal) != 0xFFFF)
+      return false;
+  }
+#endif
+  for (; pos + 8 <= len; pos += 8)
+  {
+    uint64_t block1;
+    uint64_t block2;
+    std::memcpy(&block1, str1 + pos, sizeof(block1));
+    std::memcpy(&block2, str2 + pos, sizeof(block2));
+    if (ToggleAsciiCase<'A'>(block1) != ToggleAsciiCase<'A'>(block2))
+      return false;
+  }
+  for (; pos < len; ++pos)
+  {
+    if (StringUtils::ToLowerAscii(str1[pos]) != StringUtils::ToLowerAscii(str2[pos]))
+      return false;
+  }
+  return true;
+}
+
+/*!
+ * \brief Whether the lowercase word occurs anywhere in the string, ignoring the case of its
+ *        ASCII letters. Looks for the first letter of the word 16 bytes at once.
+ */
+bool ContainsLowerCase(std::string_view str, std::string_view wordLowerCase) noexcept
+{
+  if (wordLowerCase.empty())
+    return true;
+  if (str.size() < wordLowerCase.size())
+    return false;
+
+  const size_t lastStart = str.size() - wordLowerCase.size();
+  const auto matchesAt = [&](size_t start)
+  {
+    return std::equal(wordLowerCase.begin() + 1, wordLowerCase.end(), str.begin() + start + 1,
+                      [](char w, char c) { return StringUtils::ToLowerAscii(c) == w; });
+  };
+
+  size_t pos = 0;
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+  const __m128i first = _mm_set1_epi8(wordLowerCase.front());
+  for (; pos + 16 <= lastStart + 1; pos += 16)
+  {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str.data() + pos));
+    auto candidates = static_cast<unsigned int>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(ToggleAsciiCase<'A'>(block), first)));
+    for (; candidates != 0; candidates &= candidates - 1)
+    {
+      if (matchesAt(pos + std::countr_zero(candidates)))
+        return true;
+    }
+  }
+#endif
+  for (; pos <= lastStart; ++pos)
+  {
+    if (StringUtils::ToLowerAscii(str[pos]) == wordLowerCase.front() && matchesAt(pos))
+      return true;
+  }
+  return false;
+}
 } // unnamed namespace
 
 static constexpr const char* ADDON_GUID_RE = "^(\\{){0,1}[0-9a-fA-F]{8}\\-[0-9a-fA-F]{4}\\-[0-9a-fA-F]{4}\\-[0-9a-fA-F]{4}\\-[0-9a-fA-F]{12}(\\}){0,1}$";
@@ -376,7 +506,7 @@ void transformString(const StrIn& input, StrOut& output, Fn fn)
 std::string StringUtils::ToUpper(std::string_view str)
 {
   std::string result(str.size(), '\0');
-  transformString(str, result, ToUpperAscii);
+  ChangeAsciiCase<'a'>(str.data(), result.data(), str.size());
   return result;
 }
 
@@ -389,7 +519,7 @@ std::wstring StringUtils::ToUpper(std::wstring_view str)
 
 void StringUtils::ToUpper(std::string& str) noexcept
 {
-  transformString(str, str, ToUpperAscii);
+  ChangeAsciiCase<'a'>(str.data(), str.data(), str.size());
 }
 
 void StringUtils::ToUpper(std::wstring& str) noexcept
@@ -400,7 +530,7 @@ void StringUtils::ToUpper(std::wstring& str) noexcept
 std::string StringUtils::ToLower(std::string_view str)
 {
   std::string result(str.size(), '\0');
-  transformString(str, result, ToLowerAscii);
+  ChangeAsciiCase<'A'>(str.data(), result.data(), str.size());
   return result;
 }
 
@@ -413,7 +543,7 @@ std::wstring StringUtils::ToLower(std::wstring_view str)
 
 void StringUtils::ToLower(std::string& str) noexcept
 {
-  transformString(str, str, ToLowerAscii);
+  ChangeAsciiCase<'A'>(str.data(), str.data(), str.size());
 }
 
 void StringUtils::ToLower(std::wstring& str) noexcept
@@ -448,9 +578,7 @@ void StringUtils::ToCapitalize(std::wstring& str) noexcept
 
 bool StringUtils::EqualsNoCase(std::string_view str1, std::string_view str2) noexcept
 {
-  return std::ranges::equal(str1, str2,
-                            [](char c1, char c2)
-                            { return c1 == c2 || ToLowerAscii(c1) == ToLowerAscii(c2); });
+  return str1.size() == str2.size() && EqualsAsciiNoCase(str1.data(), str2.data(), str1.size());
 }
 
 std::string StringUtils::Left(std::string_view str, size_t count)
@@ -665,6 +793,11 @@ std::vector<std::string> StringUtils::Split(std::string_view input,
                                             size_t iMaxStrings)
 {
   std::vector<std::string> result;
+  if (!input.empty())
+  {
+    const size_t count = std::ranges::count(input, delimiter) + 1;
+    result.reserve(iMaxStrings > 0 ? std::min(count, iMaxStrings) : count);
+  }
   SplitTo(std::back_inserter(result), input, delimiter, iMaxStrings);
   return result;
 }
@@ -1598,9 +1731,36 @@ std::string StringUtils::ToHexadecimal(std::string_view in)
   return -1;
 }
 
+namespace
+{
+// Skip the current word (composed by latin letters), number or other character and the spaces
+// after it
+std::string_view::const_iterator NextWordStart(std::string_view::const_iterator strIter,
+                                               std::string_view::const_iterator strIterEnd) noexcept
+{
+  if (::isdigit(static_cast<unsigned char>(*strIter))) // skip digits
+    strIter = std::find_if_not(strIter, strIterEnd, [](unsigned char c) { return ::isdigit(c); });
+  else if (int l = IsUTF8Letter(strIter, strIterEnd); l > 0) // skip letters
+  {
+    strIter += l;
+    while ((l = IsUTF8Letter(strIter, strIterEnd)) > 0)
+      strIter += l;
+  }
+  else
+    ++strIter;
+
+  // skip spaces
+  return std::find_if_not(strIter, strIterEnd, [](unsigned char c) { return ::isspace(c); });
+}
+} // unnamed namespace
+
 size_t StringUtils::FindWords(std::string_view str, std::string_view wordLowerCase) noexcept
 {
   // NOTE: This assumes word is lowercase!
+  // Most strings don't contain the word at all when filtering lists, rule them out quickly
+  if (!ContainsLowerCase(str, wordLowerCase))
+    return std::string::npos;
+
   std::string_view::const_iterator strIter = str.begin();
   while (static_cast<size_t>(std::distance(strIter, str.end())) >= wordLowerCase.length())
   {
@@ -1614,25 +1774,22 @@ size_t StringUtils::FindWords(std::string_view str, std::string_view wordLowerCa
         return std::distance(str.begin(), strIter);
     }
 
-    // otherwise, skip current word (composed by latin letters) or number
-    if (::isdigit(static_cast<unsigned char>(*strIter))) // skip digits
-      strIter = std::find_if_not(strIter, str.end(), [](unsigned char c) { return ::isdigit(c); });
-    else if (int l = IsUTF8Letter(strIter, str.end()); l > 0) // skip letters
-    {
-      strIter += l;
-      while ((l = IsUTF8Letter(strIter, str.end())) > 0)
-        strIter += l;
-    }
-    else
-      ++strIter;
-
-    // skip spaces
-    strIter = std::find_if_not(strIter, str.end(), [](unsigned char c) { return ::isspace(c); });
+    // otherwise, skip current word
+    strIter = NextWordStart(strIter, str.end());
   }
 
   return std::string::npos;
 }
 
+std::vector<size_t> StringUtils::FindWordStarts(std::string_view str)
+{
+  std::vector<size_t> starts;
+  for (auto strIter = str.begin(); strIter != str.end();
+       strIter = NextWordStart(strIter, str.end()))
+    starts.push_back(std::distance(str.begin(), strIter));
+  return starts;
+}
+
 // assumes it is called from after the first open bracket is found
 int StringUtils::FindEndBracket(std::string_view str,
                                 char opener,
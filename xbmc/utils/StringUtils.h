@@ -363,6 +363,11 @@ public:
   static const std::string Empty;
   [[nodiscard]] static size_t FindWords(std::string_view str,
                                         std::string_view wordLowerCase) noexcept;
+  /*! \brief Get the positions FindWords() tries to match a word at.
+   \param str the string to split in words
+   \return the start of the string and of each following word, number or other character
+   */
+  [[nodiscard]] static std::vector<size_t> FindWordStarts(std::string_view str);
   [[nodiscard]] static int FindEndBracket(std::string_view str,
                                           char opener,
                                           char closer,
@@ -46,6 +46,24 @@ int64_t CurrentHostCounter(void)
 #endif
 }
 
+#if !defined(TARGET_DARWIN) && !defined(TARGET_WINDOWS)
+int64_t HostCounterFromClock(clockid_t clock, const timespec& time)
+{
+  const int64_t ns = static_cast<int64_t>(time.tv_sec) * 1000000000L + time.tv_nsec;
+
+  // the clocks are slewed differently, so the offset is sampled again each time. Reading the
+  // host counter around the other clock halves the error of the sample.
+  struct timespec now;
+  const int64_t before = CurrentHostCounter();
+  if (clock_gettime(clock, &now) != 0)
+    return ns;
+  const int64_t after = CurrentHostCounter();
+
+  const int64_t clockNow = static_cast<int64_t>(now.tv_sec) * 1000000000L + now.tv_nsec;
+  return ns + before + (after - before) / 2 - clockNow;
+}
+#endif
+
 int64_t CurrentHostFrequency(void)
 {
 #if defined(TARGET_DARWIN)
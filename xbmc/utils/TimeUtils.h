@@ -17,6 +17,17 @@ class CDateTime;
 int64_t CurrentHostCounter(void);
 int64_t CurrentHostFrequency(void);
 
+#if !defined(TARGET_DARWIN) && !defined(TARGET_WINDOWS)
+/*!
+ * @brief Convert a timestamp of another clock, e.g. a vblank timestamp of the display, to the
+ * time base of CurrentHostCounter()
+ * @param clock the clock of the timestamp
+ * @param time the timestamp
+ * @return the timestamp in host counter ticks (ns)
+ */
+int64_t HostCounterFromClock(clockid_t clock, const timespec& time);
+#endif
+
 class CTimeUtils
 {
 public:
@@ -8,6 +8,216 @@
 
 #include "Utf8Utils.h"
 
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+
+// Number of leading US-ASCII bytes of the buffer
+size_t AsciiPrefixLength(const unsigned char* str, size_t len)
+{
+  size_t pos = 0;
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+  for (; pos + 16 <= len; pos += 16)
+  {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + pos));
+    const int highBits = _mm_movemask_epi8(block);
+    if (highBits != 0)
+      return pos + std::countr_zero(static_cast<unsigned int>(highBits));
+  }
+#endif
+  for (; pos + 8 <= len; pos += 8)
+  {
+    uint64_t block;
+    std::memcpy(&block, str + pos, sizeof(block));
+    if (block & 0x8080808080808080ULL)
+      break;
+  }
+  while (pos < len && str[pos] < 0x80)
+    pos++;
+
+  return pos;
+}
+
+bool IsContinuation(unsigned char chr)
+{
+  return (chr & 0xC0) == 0x80;
+}
+
+/* Decode the multi-byte sequence at the start of the buffer following
+   http://www.unicode.org/versions/Unicode6.2.0/ch03.pdf#G27506
+   returns the sequence length, 0 for an invalid or truncated sequence */
+size_t DecodeUtf8Sequence(const unsigned char* str, size_t len, char32_t& codePoint)
+{
+  const unsigned char chr = str[0];
+  if (chr >= 0xC2 && chr <= 0xDF)
+  {
+    if (len < 2 || !IsContinuation(str[1]))
+      return 0;
+    codePoint = (static_cast<char32_t>(chr & 0x1F) << 6) | (str[1] & 0x3F);
+    return 2;
+  }
+  if (chr >= 0xE0 && chr <= 0xEF)
+  {
+    // no overlong forms and no surrogates (U+D800 - U+DFFF)
+    const unsigned char min = chr == 0xE0 ? 0xA0 : 0x80;
+    const unsigned char max = chr == 0xED ? 0x9F : 0xBF;
+    if (len < 3 || str[1] < min || str[1] > max || !IsContinuation(str[2]))
+      return 0;
+    codePoint = (static_cast<char32_t>(chr & 0x0F) << 12) |
+                (static_cast<char32_t>(str[1] & 0x3F) << 6) | (str[2] & 0x3F);
+    return 3;
+  }
+  if (chr >= 0xF0 && chr <= 0xF4)
+  {
+    // no overlong forms and nothing above U+10FFFF
+    const unsigned char min = chr == 0xF0 ? 0x90 : 0x80;
+    const unsigned char max = chr == 0xF4 ? 0x8F : 0xBF;
+    if (len < 4 || str[1] < min || str[1] > max || !IsContinuation(str[2]) ||
+        !IsContinuation(str[3]))
+      return 0;
+    codePoint = (static_cast<char32_t>(chr & 0x07) << 18) |
+                (static_cast<char32_t>(str[1] & 0x3F) << 12) |
+                (static_cast<char32_t>(str[2] & 0x3F) << 6) | (str[3] & 0x3F);
+    return 4;
+  }
+
+  return 0;
+}
+
+bool IsValidCodePoint(char32_t codePoint)
+{
+  return codePoint < 0xD800 || (codePoint > 0xDFFF && codePoint <= 0x10FFFF);
+}
+
+template<typename CharT>
+CharT* AppendCodePoint(CharT* out, char32_t codePoint)
+{
+  if constexpr (sizeof(CharT) == 2)
+  {
+    if (codePoint >= 0x10000)
+    {
+      codePoint -= 0x10000;
+      *out++ = static_cast<CharT>(0xD800 + (codePoint >> 10));
+      *out++ = static_cast<CharT>(0xDC00 + (codePoint & 0x3FF));
+      return out;
+    }
+  }
+  *out++ = static_cast<CharT>(codePoint);
+  return out;
+}
+
+template<typename CharT>
+bool DecodeUtf8(const std::string& utf8, std::basic_string<CharT>& dst, bool failOnBadChar)
+{
+  static_assert(sizeof(CharT) == 2 || sizeof(CharT) == 4);
+
+  // a code point never takes more UTF-16 or UTF-32 units than UTF-8 bytes
+  dst.resize(utf8.size());
+  CharT* out = dst.data();
+
+  const auto* str = reinterpret_cast<const unsigned char*>(utf8.data());
+  const size_t len = utf8.size();
+  size_t pos = 0;
+  while (pos < len)
+  {
+    const size_t asciiLen = AsciiPrefixLength(str + pos, len - pos);
+    out = std::copy(str + pos, str + pos + asciiLen, out);
+    pos += asciiLen;
+    if (pos == len)
+      break;
+
+    char32_t codePoint;
+    const size_t seqLen = DecodeUtf8Sequence(str + pos, len - pos, codePoint);
+    if (seqLen == 0)
+    {
+      if (failOnBadChar)
+      {
+        dst.clear();
+        return false;
+      }
+      pos++;
+      continue;
+    }
+    out = AppendCodePoint(out, codePoint);
+    pos += seqLen;
+  }
+
+  dst.resize(out - dst.data());
+  return true;
+}
+
+char* AppendUtf8(char* out, char32_t codePoint)
+{
+  if (codePoint < 0x800)
+  {
+    *out++ = static_cast<char>(0xC0 | (codePoint >> 6));
+  }
+  else if (codePoint < 0x10000)
+  {
+    *out++ = static_cast<char>(0xE0 | (codePoint >> 12));
+    *out++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+  }
+  else
+  {
+    *out++ = static_cast<char>(0xF0 | (codePoint >> 18));
+    *out++ = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+    *out++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+  }
+  *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+  return out;
+}
+
+template<typename CharT>
+bool EncodeUtf8(const std::basic_string<CharT>& src, std::string& utf8, bool failOnBadChar)
+{
+  static_assert(sizeof(CharT) == 2 || sizeof(CharT) == 4);
+
+  // at most three bytes per UTF-16 unit and four per UTF-32 unit
+  utf8.resize(src.size() * (sizeof(CharT) == 2 ? 3 : 4));
+  char* out = utf8.data();
+
+  const size_t len = src.size();
+  size_t pos = 0;
+  while (pos < len)
+  {
+    // tight loop for the ASCII runs, the compiler vectorizes it
+    while (pos < len && static_cast<char32_t>(src[pos]) < 0x80)
+      *out++ = static_cast<char>(src[pos++]);
+    if (pos == len)
+      break;
+
+    char32_t codePoint = static_cast<char32_t>(src[pos++]);
+    if constexpr (sizeof(CharT) == 2)
+    {
+      if (codePoint >= 0xD800 && codePoint <= 0xDBFF && pos < len &&
+          src[pos] >= 0xDC00 && src[pos] <= 0xDFFF)
+        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (src[pos++] - 0xDC00);
+    }
+    if (!IsValidCodePoint(codePoint))
+    {
+      if (failOnBadChar)
+      {
+        utf8.clear();
+        return false;
+      }
+      continue;
+    }
+    out = AppendUtf8(out, codePoint);
+  }
+
+  utf8.resize(out - utf8.data());
+  return true;
+}
+
+} // unnamed namespace
 
 CUtf8Utils::utf8CheckResult CUtf8Utils::checkStrForUtf8(const std::string& str)
 {
@@ -146,3 +356,66 @@ inline size_t CUtf8Utils::SizeOfUtf8Char(const char* const str)
 
   return 0; // invalid UTF-8 char sequence
 }
+
+bool CUtf8Utils::IsAscii(const std::string& str)
+{
+  return AsciiPrefixLength(reinterpret_cast<const unsigned char*>(str.data()), str.size()) ==
+         str.size();
+}
+
+bool CUtf8Utils::Utf8ToUtf32(const std::string& utf8, std::u32string& utf32, bool failOnBadChar)
+{
+  return DecodeUtf8(utf8, utf32, failOnBadChar);
+}
+
+bool CUtf8Utils::Utf8ToW(const std::string& utf8, std::wstring& wide, bool failOnBadChar)
+{
+  return DecodeUtf8(utf8, wide, failOnBadChar);
+}
+
+bool CUtf8Utils::Utf32ToUtf8(const std::u32string& utf32, std::string& utf8, bool failOnBadChar)
+{
+  return EncodeUtf8(utf32, utf8, failOnBadChar);
+}
+
+bool CUtf8Utils::WToUtf8(const std::wstring& wide, std::string& utf8, bool failOnBadChar)
+{
+  return EncodeUtf8(wide, utf8, failOnBadChar);
+}
+
+bool CUtf8Utils::Utf32ToW(const std::u32string& utf32, std::wstring& wide, bool failOnBadChar)
+{
+  if constexpr (sizeof(wchar_t) == 4)
+  {
+    wide.clear();
+    wide.reserve(utf32.size());
+    for (const char32_t codePoint : utf32)
+    {
+      if (IsValidCodePoint(codePoint))
+        wide.push_back(static_cast<wchar_t>(codePoint));
+      else if (failOnBadChar)
+      {
+        wide.clear();
+        return false;
+      }
+    }
+  }
+  else
+  {
+    // surrogate pairs for the code points above the BMP
+    wide.resize(utf32.size() * 2);
+    wchar_t* out = wide.data();
+    for (const char32_t codePoint : utf32)
+    {
+      if (IsValidCodePoint(codePoint))
+        out = AppendCodePoint(out, codePoint);
+      else if (failOnBadChar)
+      {
+        wide.clear();
+        return false;
+      }
+    }
+    wide.resize(out - wide.data());
+  }
+  return true;
+}
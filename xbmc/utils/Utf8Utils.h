@@ -37,6 +37,27 @@ public:
   static size_t RFindValidUtf8Char(const std::string& str, const size_t startPos);
 
   static size_t SizeOfUtf8Char(const std::string& str, const size_t charStart = 0);
+
+  /**
+   * Check whether the string has only US-ASCII characters, scans it a block at a time
+   * @param str string to check
+   * @return true for an empty string
+   */
+  static bool IsAscii(const std::string& str);
+
+  /**
+   * Convert between UTF-8 and UTF-32 or wchar_t (UTF-32 or UTF-16, depending on its size)
+   * without iconv. Runs of ASCII characters are copied a block at a time.
+   * Like iconv, an invalid sequence is skipped one byte or code unit at a time, unless
+   * failOnBadChar is set, then the conversion fails with an empty result.
+   * @return true on success
+   */
+  static bool Utf8ToUtf32(const std::string& utf8, std::u32string& utf32, bool failOnBadChar);
+  static bool Utf8ToW(const std::string& utf8, std::wstring& wide, bool failOnBadChar);
+  static bool Utf32ToUtf8(const std::u32string& utf32, std::string& utf8, bool failOnBadChar);
+  static bool WToUtf8(const std::wstring& wide, std::string& utf8, bool failOnBadChar);
+  static bool Utf32ToW(const std::u32string& utf32, std::wstring& wide, bool failOnBadChar);
+
 private:
   static size_t SizeOfUtf8Char(const char* const str);
 };
@@ -285,13 +285,15 @@ CVariant::CVariant(std::map<std::string, std::string>&& strMap)
 }
 
 CVariant::CVariant(const std::map<std::string, CVariant>& variantMap)
-  : m_data(std::in_place_type<VariantMap>, variantMap)
+  : m_data(std::in_place_type<VariantMap>, variantMap.begin(), variantMap.end())
 {
 }
 
 CVariant::CVariant(std::map<std::string, CVariant>&& variantMap)
-  : m_data(std::in_place_type<VariantMap>, std::move(variantMap))
+  : m_data(std::in_place_type<VariantMap>)
 {
+  // only the comparators differ, the nodes can be moved over
+  std::get<VariantMap>(m_data).merge(variantMap);
 }
 
 CVariant::CVariant(const CVariant& variant) : m_data(variant.m_data)
@@ -302,15 +304,7 @@ CVariant::CVariant(CVariant&& rhs) noexcept : m_data(std::move(rhs.m_data))
 {
 }
 
-CVariant::~CVariant()
-{
-  cleanup();
-}
-
-void CVariant::cleanup()
-{
-  m_data = Null{};
-}
+CVariant::~CVariant() = default;
 
 bool CVariant::isInteger() const
 {
@@ -464,19 +458,25 @@ std::wstring CVariant::asWideString(std::wstring_view fallback /*= L""*/) &&
                     m_data);
 }
 
-CVariant& CVariant::operator[](const std::string& key) &
+CVariant& CVariant::operator[](std::string_view key) &
 {
   if (type() == VariantTypeNull)
   {
     m_data = VariantMap{};
   }
 
-  return std::visit(overloaded{[&](VariantMap& m) -> CVariant& { return m[key]; },
+  return std::visit(overloaded{[&](VariantMap& m) -> CVariant& {
+                                 // the key is only copied when it is inserted
+                                 auto it = m.lower_bound(key);
+                                 if (it == m.end() || it->first != key)
+                                   it = m.emplace_hint(it, key, CVariant());
+                                 return it->second;
+                               },
                                [](auto&) -> CVariant& { return ConstNullVariant; }},
                     m_data);
 }
 
-const CVariant& CVariant::operator[](const std::string& key) const&
+const CVariant& CVariant::operator[](std::string_view key) const&
 {
   return std::visit(overloaded{[&](const VariantMap& m) -> const CVariant& {
                                  auto it = m.find(key);
@@ -486,7 +486,7 @@ const CVariant& CVariant::operator[](const std::string& key) const&
                     m_data);
 }
 
-CVariant CVariant::operator[](const std::string& key) &&
+CVariant CVariant::operator[](std::string_view key) &&
 {
   return std::visit(overloaded{[&](VariantMap& m) -> CVariant {
                                  auto it = m.find(key);
@@ -529,7 +529,7 @@ CVariant &CVariant::operator=(const CVariant &rhs)
   if (type() == VariantTypeConstNull || this == &rhs)
     return *this;
 
-  cleanup();
+  // assigning over a value of the same type reuses its storage
   m_data = rhs.m_data;
   return *this;
 }
@@ -690,9 +690,15 @@ void CVariant::clear()
              m_data);
 }
 
-void CVariant::erase(const std::string &key)
+void CVariant::erase(std::string_view key)
 {
-  std::visit(overloaded{[&](Null&) { m_data = VariantMap{}; }, [&](VariantMap& m) { m.erase(key); },
+  std::visit(overloaded{[&](Null&) { m_data = VariantMap{}; },
+                        [&](VariantMap& m)
+                        {
+                          const auto it = m.find(key);
+                          if (it != m.end())
+                            m.erase(it);
+                        },
                         [](const auto&) {}},
              m_data);
 }
@@ -704,7 +710,7 @@ void CVariant::erase(unsigned int position)
              m_data);
 }
 
-bool CVariant::isMember(const std::string &key) const
+bool CVariant::isMember(std::string_view key) const
 {
   return std::visit(overloaded{[&](const VariantMap& m) { return m.contains(key); },
                                [](const auto&) { return false; }},
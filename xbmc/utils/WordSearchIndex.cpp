@@ -0,0 +1,78 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "WordSearchIndex.h"
+
+#include "utils/StringUtils.h"
+
+#include <utility>
+
+void CWordSearchIndex::Clear()
+{
+  m_entries.clear();
+  m_hasLastFind = false;
+  m_lastWord.clear();
+  m_lastMatches.clear();
+}
+
+void CWordSearchIndex::Set(size_t entry, std::string_view text)
+{
+  if (entry >= m_entries.size())
+    m_entries.resize(entry + 1);
+  else if (m_entries[entry].text == text)
+    return;
+
+  Entry& e = m_entries[entry];
+  e.text = text;
+  e.lowerText = StringUtils::ToLower(text);
+  const std::vector<size_t> starts = StringUtils::FindWordStarts(e.lowerText);
+  e.wordStarts.assign(starts.begin(), starts.end());
+
+  // a changed text may match the words the last search ruled out
+  m_hasLastFind = false;
+}
+
+const std::vector<size_t>& CWordSearchIndex::Find(std::string_view wordLowerCase)
+{
+  std::vector<size_t> matches;
+  if (m_hasLastFind && wordLowerCase.starts_with(m_lastWord))
+  {
+    // a text containing the longer word contains the shorter one at the same position
+    for (size_t entry : m_lastMatches)
+    {
+      if (Matches(m_entries[entry], wordLowerCase))
+        matches.push_back(entry);
+    }
+  }
+  else
+  {
+    for (size_t entry = 0; entry < m_entries.size(); ++entry)
+    {
+      if (Matches(m_entries[entry], wordLowerCase))
+        matches.push_back(entry);
+    }
+  }
+
+  m_hasLastFind = true;
+  m_lastWord = wordLowerCase;
+  m_lastMatches = std::move(matches);
+  return m_lastMatches;
+}
+
+bool CWordSearchIndex::Matches(const Entry& entry, std::string_view wordLowerCase)
+{
+  const std::string_view text = entry.lowerText;
+  for (uint32_t start : entry.wordStarts)
+  {
+    if (start + wordLowerCase.size() > text.size())
+      break;
+    if (text.substr(start, wordLowerCase.size()) == wordLowerCase)
+      return true;
+  }
+  return wordLowerCase.empty();
+}
@@ -0,0 +1,59 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*!
+ * \brief Index of texts to find those containing a word, the way StringUtils::FindWords() does.
+ *
+ * Each text is lowered and split in words once, when it is set. A word is then matched against
+ * the starts of the words only. While a filter is typed, each word extends the previous one, so
+ * only the texts that matched the previous word are tested again.
+ */
+class CWordSearchIndex
+{
+public:
+  void Clear();
+  size_t Size() const { return m_entries.size(); }
+
+  /*!
+   * \brief Set the text of an entry, the index grows as needed.
+   * \param entry position of the entry
+   * \param text the text, nothing is done if the entry already has this text
+   */
+  void Set(size_t entry, std::string_view text);
+
+  /*!
+   * \brief Find the entries whose text contains the word.
+   * \param wordLowerCase the word, lowercase like for StringUtils::FindWords()
+   * \return the matching entries in ascending order
+   */
+  const std::vector<size_t>& Find(std::string_view wordLowerCase);
+
+private:
+  struct Entry
+  {
+    std::string text;
+    std::string lowerText;
+    std::vector<uint32_t> wordStarts;
+  };
+
+  static bool Matches(const Entry& entry, std::string_view wordLowerCase);
+
+  std::vector<Entry> m_entries;
+
+  // The last search, the next one only tests its matches when it extends its word
+  bool m_hasLastFind{false};
+  std::string m_lastWord;
+  std::vector<size_t> m_lastMatches;
+};
@@ -9,7 +9,7 @@
 #include "XBMCTinyXML.h"
 
 #include "LangInfo.h"
-#include "RegExp.h"
+#include "XMLUtils.h"
 #include "filesystem/File.h"
 #include "utils/CharsetConverter.h"
 #include "utils/CharsetDetection.h"
@@ -17,7 +17,6 @@
 #include "utils/Utf8Utils.h"
 #include "utils/log.h"
 
-#define MAX_ENTITY_LENGTH 8 // size of largest entity "&#xNNNN;"
 #define BUFFER_SIZE 4096
 
 CXBMCTinyXML::CXBMCTinyXML()
@@ -238,15 +237,7 @@ bool CXBMCTinyXML::InternalParse(const std::string& rawdata, TiXmlEncoding encod
   if (pos == std::string::npos)
     return (TiXmlDocument::Parse(rawdata.c_str(), NULL, encoding) != NULL); // nothing to fix, process data directly
 
-  std::string data(rawdata);
-  CRegExp re(false, CRegExp::asciiOnly, "^&(amp|lt|gt|quot|apos|#x[a-fA-F0-9]{1,4}|#[0-9]{1,5});.*");
-  do
-  {
-    if (re.RegFind(data, pos, MAX_ENTITY_LENGTH) < 0)
-      data.insert(pos + 1, "amp;");
-    pos = data.find('&', pos + 1);
-  } while (pos != std::string::npos);
-
+  const std::string data = XMLUtils::EscapeInvalidEntities(rawdata, pos);
   return (TiXmlDocument::Parse(data.c_str(), NULL, encoding) != NULL);
 }
 
@@ -8,7 +8,7 @@
 
 #include "XBMCTinyXML2.h"
 
-#include "RegExp.h"
+#include "XMLUtils.h"
 #include "filesystem/File.h"
 
 #include <cstdint>
@@ -17,7 +17,6 @@
 
 namespace
 {
-static constexpr int MAX_ENTITY_LENGTH = 8; // size of largest entity "&#xNNNN;"
 static constexpr size_t BUFFER_SIZE = 4096;
 } // namespace
 
@@ -79,7 +78,7 @@ bool CXBMCTinyXML2::Parse(std::string_view inputdata)
                 inputdata.data(), inputdata.size())); // nothing to fix, process data directly
   }
 
-  return ParseHelper(pos, std::string{inputdata});
+  return ParseHelper(pos, inputdata);
 }
 
 bool CXBMCTinyXML2::Parse(std::string&& inputdata)
@@ -94,20 +93,11 @@ bool CXBMCTinyXML2::Parse(std::string&& inputdata)
                 inputdata.c_str(), inputdata.size())); // nothing to fix, process data directly
   }
 
-  return ParseHelper(pos, std::move(inputdata));
+  return ParseHelper(pos, inputdata);
 }
 
-bool CXBMCTinyXML2::ParseHelper(size_t pos, std::string&& inputdata)
+bool CXBMCTinyXML2::ParseHelper(size_t pos, std::string_view inputdata)
 {
-  CRegExp re(false, CRegExp::asciiOnly,
-             "^&(amp|lt|gt|quot|apos|#x[a-fA-F0-9]{1,4}|#[0-9]{1,5});.*");
-  do
-  {
-    if (re.RegFind(inputdata, static_cast<unsigned int>(pos), MAX_ENTITY_LENGTH) < 0)
-      inputdata.insert(pos + 1, "amp;");
-    pos = inputdata.find('&', pos + 1);
-  } while (pos != std::string::npos);
-
-  return (tinyxml2::XML_SUCCESS ==
-          tinyxml2::XMLDocument::Parse(inputdata.c_str(), inputdata.size()));
+  const std::string data = XMLUtils::EscapeInvalidEntities(inputdata, pos);
+  return (tinyxml2::XML_SUCCESS == tinyxml2::XMLDocument::Parse(data.c_str(), data.size()));
 }
@@ -25,5 +25,5 @@ public:
   bool Parse(std::string&& inputdata);
 
 private:
-  bool ParseHelper(size_t pos, std::string&& inputdata);
+  bool ParseHelper(size_t pos, std::string_view inputdata);
 };
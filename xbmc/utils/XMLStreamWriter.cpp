@@ -0,0 +1,77 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "XMLStreamWriter.h"
+
+#include "utils/log.h"
+
+#include <tinyxml.h>
+
+CXMLStreamWriter::~CXMLStreamWriter()
+{
+  if (m_open)
+  {
+    m_file.Close();
+    XFILE::CFile::Delete(m_path);
+  }
+}
+
+bool CXMLStreamWriter::Open(const std::string& file, std::string_view rootName)
+{
+  if (!m_file.OpenForWrite(file, true))
+  {
+    CLog::LogF(LOGERROR, "unable to create \"{}\"", file);
+    return false;
+  }
+
+  m_open = true;
+  m_failed = false;
+  m_path = file;
+  m_rootName = rootName;
+  return Write("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\" ?>\n<") &&
+         Write(m_rootName) && Write(">\n");
+}
+
+bool CXMLStreamWriter::Flush(TiXmlNode& node)
+{
+  for (const TiXmlNode* child = node.FirstChild(); child; child = child->NextSibling())
+  {
+    TiXmlPrinter printer;
+    child->Accept(&printer);
+    Write({printer.CStr(), printer.Size()});
+  }
+  node.Clear();
+  return !m_failed;
+}
+
+bool CXMLStreamWriter::Close()
+{
+  if (!m_open)
+    return false;
+
+  Write("</");
+  Write(m_rootName);
+  Write(">\n");
+  m_file.Flush();
+  m_file.Close();
+  m_open = false;
+  return !m_failed;
+}
+
+bool CXMLStreamWriter::Write(std::string_view data)
+{
+  if (!m_open || m_failed)
+    return false;
+
+  if (m_file.Write(data.data(), data.size()) != static_cast<ssize_t>(data.size()))
+  {
+    CLog::LogF(LOGERROR, "unable to write the document");
+    m_failed = true;
+  }
+  return !m_failed;
+}
@@ -0,0 +1,58 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "filesystem/File.h"
+
+#include <string>
+#include <string_view>
+
+class TiXmlNode;
+
+/*!
+ * \brief Writes an XML document to a file one element after the other.
+ *
+ * For documents too large to be built in memory, like library exports: the elements are added to
+ * a node as usual, Flush() writes them as children of the root element and deletes them. A
+ * document that isn't closed, like a canceled export, is deleted.
+ */
+class CXMLStreamWriter
+{
+public:
+  CXMLStreamWriter() = default;
+  ~CXMLStreamWriter();
+
+  CXMLStreamWriter(const CXMLStreamWriter&) = delete;
+  CXMLStreamWriter& operator=(const CXMLStreamWriter&) = delete;
+
+  /*!
+   * \brief Create the file and write the declaration and the start of the root element.
+   */
+  bool Open(const std::string& file, std::string_view rootName);
+
+  /*!
+   * \brief Write the children of a node and delete them from it.
+   */
+  bool Flush(TiXmlNode& node);
+
+  /*!
+   * \brief Write the end of the root element and close the file.
+   * \return false if anything couldn't be written
+   */
+  bool Close();
+
+private:
+  bool Write(std::string_view data);
+
+  XFILE::CFile m_file;
+  std::string m_path;
+  std::string m_rootName;
+  bool m_open = false;
+  bool m_failed = false;
+};
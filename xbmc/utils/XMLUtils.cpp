@@ -725,3 +725,61 @@ void XMLUtils::SetDateTime(tinyxml2::XMLNode* rootNode, const char* tag, const C
 {
   SetString(rootNode, tag, dateTime.IsValid() ? dateTime.GetAsDBDateTime() : "");
 }
+
+namespace
+{
+bool IsAsciiHexDigit(char c)
+{
+  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+bool IsAsciiDigit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+// whether the text after a '&' is one of the entities the XML parsers understand
+bool IsEntity(std::string_view text)
+{
+  for (std::string_view name : {"amp;", "lt;", "gt;", "quot;", "apos;"})
+  {
+    if (text.starts_with(name))
+      return true;
+  }
+
+  if (!text.starts_with('#'))
+    return false;
+  text.remove_prefix(1);
+
+  const bool hex = text.starts_with('x');
+  if (hex)
+    text.remove_prefix(1);
+
+  // up to "&#xFFFF;" and "&#99999;"
+  const size_t maxDigits = hex ? 4 : 5;
+  size_t digits = 0;
+  while (digits < text.size() && digits < maxDigits &&
+         (hex ? IsAsciiHexDigit(text[digits]) : IsAsciiDigit(text[digits])))
+    ++digits;
+
+  return digits > 0 && digits < text.size() && text[digits] == ';';
+}
+} // namespace
+
+std::string XMLUtils::EscapeInvalidEntities(std::string_view data, size_t pos)
+{
+  // built in one pass, inserting into the data would move its tail for each '&'
+  std::string result;
+  result.reserve(data.size() + 64);
+  size_t start = 0;
+  while (pos != std::string_view::npos)
+  {
+    result.append(data, start, pos + 1 - start);
+    if (!IsEntity(data.substr(pos + 1)))
+      result.append("amp;");
+    start = pos + 1;
+    pos = data.find('&', start);
+  }
+  result.append(data, start);
+  return result;
+}
@@ -12,6 +12,7 @@
 
 #include <stdint.h>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <tinyxml2.h>
@@ -150,6 +151,14 @@ public:
   static void SetDate(tinyxml2::XMLNode* rootNode, const char* tag, const CDateTime& date);
   static void SetDateTime(tinyxml2::XMLNode* rootNode, const char* tag, const CDateTime& dateTime);
 
+  /*! \brief Escape the '&' that don't start a valid XML entity, e.g. in scraper results
+
+   \param[in] data the XML data
+   \param[in] pos position of the first '&' in data
+   \return the data with each such '&' replaced by "&amp;"
+   */
+  static std::string EscapeInvalidEntities(std::string_view data, size_t pos);
+
   static const int path_version = 1;
 };
 
@@ -23,9 +23,17 @@
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
+#include <mutex>
 #include <set>
+#include <thread>
 
+#include <spdlog/details/log_msg_buffer.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/dist_sink.h>
 #include <spdlog/sinks/dup_filter_sink.h>
@@ -82,8 +90,112 @@ constexpr auto componentMap = make_map<int, ComponentInfo>({
 });
 // clang-format on
 
+constexpr size_t ASYNC_QUEUE_SIZE = 8192;
+
 } // unnamed namespace
 
+/*!
+ * \brief Passes the messages to another sink on a thread of its own.
+ *
+ * When the queue is full, messages below warning are dropped and counted, warnings and errors
+ * wait for room so none of them gets lost.
+ */
+class CLog::CAsyncSink : public spdlog::sinks::sink
+{
+public:
+  explicit CAsyncSink(std::shared_ptr<spdlog::sinks::sink> sink)
+    : m_sink(std::move(sink)),
+      m_thread([this]() { Process(); })
+  {
+  }
+
+  ~CAsyncSink() override
+  {
+    {
+      std::unique_lock lock(m_mutex);
+      m_stop = true;
+    }
+    m_ready.notify_one();
+    m_thread.join();
+  }
+
+  void log(const spdlog::details::log_msg& msg) override
+  {
+    std::unique_lock lock(m_mutex);
+    if (m_queue.size() >= ASYNC_QUEUE_SIZE)
+    {
+      if (msg.level < spdlog::level::warn)
+      {
+        m_dropped++;
+        return;
+      }
+      m_space.wait(lock, [this]() { return m_queue.size() < ASYNC_QUEUE_SIZE; });
+    }
+    m_queue.emplace_back(msg);
+    lock.unlock();
+    m_ready.notify_one();
+  }
+
+  // every debug message flushes, the logging threads mustn't wait for the disk for that
+  void flush() override
+  {
+    {
+      std::unique_lock lock(m_mutex);
+      m_flush = true;
+    }
+    m_ready.notify_one();
+  }
+
+  // the wrapped sink formats the messages
+  void set_pattern(const std::string& pattern) override {}
+  void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override {}
+
+private:
+  void Process()
+  {
+    std::deque<spdlog::details::log_msg_buffer> batch;
+    std::unique_lock lock(m_mutex);
+    while (true)
+    {
+      m_ready.wait(lock, [this]() { return m_stop || m_flush || !m_queue.empty(); });
+      batch.swap(m_queue);
+      const bool flush = std::exchange(m_flush, false) || m_stop;
+      const size_t dropped = std::exchange(m_dropped, 0);
+      const bool stop = m_stop;
+      lock.unlock();
+      m_space.notify_all();
+
+      if (dropped > 0)
+      {
+        const std::string message =
+            fmt::format("{} log messages dropped, the log queue was full", dropped);
+        m_sink->log(spdlog::details::log_msg("general", spdlog::level::warn, message));
+      }
+      for (const auto& msg : batch)
+        m_sink->log(msg);
+      batch.clear();
+      if (flush)
+        m_sink->flush();
+
+      lock.lock();
+      if (stop && m_queue.empty())
+        break;
+    }
+  }
+
+  std::shared_ptr<spdlog::sinks::sink> m_sink;
+
+  std::mutex m_mutex;
+  std::condition_variable m_ready;
+  std::condition_variable m_space;
+  std::deque<spdlog::details::log_msg_buffer> m_queue;
+  size_t m_dropped{0};
+  bool m_flush{false};
+  bool m_stop{false};
+
+  std::thread m_thread; //!< last, it starts on the members above
+};
+
 CLog::CLog()
   : m_platform(IPlatformLog::CreatePlatformLog()),
     m_sinks(std::make_shared<spdlog::sinks::dist_sink_mt>()),
@@ -175,7 +287,13 @@ void CLog::Initialize(const std::string& path)
   m_fileSink = duplicateFilterSink;
 
   // add it to the existing sinks
-  m_sinks->add_sink(m_fileSink);
+  if (m_async)
+  {
+    m_asyncSink = std::make_shared<CAsyncSink>(m_fileSink);
+    m_sinks->add_sink(m_asyncSink);
+  }
+  else
+    m_sinks->add_sink(m_fileSink);
 }
 
 void CLog::UnregisterFromSettings()
@@ -196,6 +314,13 @@ void CLog::Deinitialize()
   // flush all loggers
   spdlog::apply_all([](const std::shared_ptr<spdlog::logger>& logger) { logger->flush(); });
 
+  // write what is still queued
+  if (m_asyncSink)
+  {
+    m_sinks->remove_sink(m_asyncSink);
+    m_asyncSink.reset();
+  }
+
   // flush the file sink
   m_fileSink->flush();
 
@@ -204,6 +329,38 @@ void CLog::Deinitialize()
   m_fileSink.reset();
 }
 
+void CLog::SetAsync(bool async)
+{
+  if (async == m_async)
+    return;
+
+  m_async = async;
+  if (m_fileSink == nullptr)
+    return;
+
+  // the file sink isn't thread-safe, it is only ever written from the logging threads under the
+  // lock of m_sinks or from the thread of the async sink, never both
+  if (async)
+  {
+    m_sinks->remove_sink(m_fileSink);
+    m_asyncSink = std::make_shared<CAsyncSink>(m_fileSink);
+    m_sinks->add_sink(m_asyncSink);
+  }
+  else
+  {
+    m_sinks->remove_sink(m_asyncSink);
+    m_asyncSink.reset();
+    m_sinks->add_sink(m_fileSink);
+  }
+  FormatAndLogInternal(spdlog::level::info, LOG_COMPONENT_GENERAL, "Asynchronous logging {}",
+                       fmt::make_format_args(async ? "enabled" : "disabled"));
+}
+
+void CLog::SetRateLimit(int messagesPerSecond)
+{
+  m_rateLimit = std::max(messagesPerSecond, 0);
+}
+
 void CLog::SetLogLevel(int level)
 {
   if (level < LOG_LEVEL_NONE || level > LOG_LEVEL_MAX)
@@ -313,7 +470,7 @@ void CLog::FormatAndLogInternal(spdlog::level::level_enum level,
                                 fmt::string_view format,
                                 fmt::format_args args)
 {
-  if (level < m_defaultLogger->level())
+  if (level < m_defaultLogger->level() || !PassesRateLimit(level, component))
     return;
 
   auto message = fmt::vformat(format, args);
@@ -357,6 +514,36 @@ void CLog::SetComponentLogLevel(const std::vector<CVariant>& components)
   }
 }
 
+bool CLog::PassesRateLimit(spdlog::level::level_enum level, uint32_t component)
+{
+  const int limit = m_rateLimit.load(std::memory_order_relaxed);
+  if (limit == 0 || level >= spdlog::level::warn)
+    return true;
+
+  ComponentRate& rate =
+      m_componentRates[component == LOG_COMPONENT_GENERAL ? 0 : std::countr_zero(component) + 1];
+
+  // one window per second, the first message of a new one reports what the last one suppressed
+  const int64_t second = std::chrono::duration_cast<std::chrono::seconds>(
+                             std::chrono::steady_clock::now().time_since_epoch())
+                             .count();
+  int64_t window = rate.second.load(std::memory_order_relaxed);
+  if (window != second && rate.second.compare_exchange_strong(window, second))
+  {
+    rate.count = 0;
+    const int suppressed = rate.suppressed.exchange(0);
+    if (suppressed > 0)
+      GetLoggerById(component)->warn("{} log messages suppressed, more than {} per second",
+                                     suppressed, limit);
+  }
+
+  if (rate.count.fetch_add(1, std::memory_order_relaxed) < limit)
+    return true;
+
+  rate.suppressed++;
+  return false;
+}
+
 void CLog::FormatLineBreaks(std::string& message) const
 {
   // fixup newline alignment, number of spaces should equal prefix length
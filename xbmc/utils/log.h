@@ -30,6 +30,8 @@
 #include "utils/IPlatformLog.h"
 #include "utils/logtypes.h"
 
+#include <array>
+#include <atomic>
 #include <source_location>
 #include <string>
 #include <vector>
@@ -79,6 +81,20 @@ public:
   int GetLogLevel() const { return m_logLevel; }
   bool IsLogLevelLogged(int loglevel) const;
 
+  /*!
+   * \brief Write the log file from a thread of its own.
+   *
+   * The logging threads only queue their messages then, a slow disk doesn't stall the render or
+   * audio threads. When the queue is full, debug and info messages are dropped and counted.
+   */
+  void SetAsync(bool async);
+
+  /*!
+   * \brief Limit the debug and info messages each component may log.
+   * \param messagesPerSecond messages per second and component, 0 for no limit
+   */
+  void SetRateLimit(int messagesPerSecond);
+
   bool CanLogComponent(uint32_t component) const;
   static void SettingOptionsLoggingComponentsFiller(const std::shared_ptr<const CSetting>& setting,
                                                     std::vector<IntegerSettingOption>& list,
@@ -144,6 +160,8 @@ public:
 #endif
 
 private:
+  class CAsyncSink;
+
   static CLog& GetInstance();
 
   static spdlog::level::level_enum MapLogLevel(int level);
@@ -166,14 +184,27 @@ private:
 
   void FormatLineBreaks(std::string& message) const;
 
+  bool PassesRateLimit(spdlog::level::level_enum level, uint32_t component);
+
   std::unique_ptr<IPlatformLog> m_platform;
   std::shared_ptr<spdlog::sinks::dist_sink<std::mutex>> m_sinks;
   Logger m_defaultLogger;
 
   std::shared_ptr<spdlog::sinks::sink> m_fileSink;
+  std::shared_ptr<CAsyncSink> m_asyncSink; //!< writes to m_fileSink in async mode
+  bool m_async{false};
 
   int m_logLevel{LOG_LEVEL_DEBUG};
 
   bool m_componentLogEnabled{false};
   uint32_t m_componentLogLevels{0};
+
+  struct ComponentRate
+  {
+    std::atomic<int64_t> second{0};
+    std::atomic<int> count{0};
+    std::atomic<int> suppressed{0};
+  };
+  std::atomic<int> m_rateLimit{0};
+  std::array<ComponentRate, 33> m_componentRates; //!< general, then one per component bit
 };
@@ -0,0 +1,64 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/FlatMap.h"
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+using KODI::UTILS::CFlatMap;
+
+TEST(TestFlatMap, KeepsKeysSorted)
+{
+  CFlatMap<std::string, int> map;
+  EXPECT_TRUE(map.try_emplace("b", 2).second);
+  EXPECT_TRUE(map.try_emplace("c", 3).second);
+  EXPECT_TRUE(map.try_emplace("a", 1).second);
+  EXPECT_FALSE(map.try_emplace("a", 4).second);
+
+  ASSERT_EQ(3u, map.size());
+  EXPECT_TRUE(std::is_sorted(map.begin(), map.end(),
+                             [](const auto& a, const auto& b) { return a.first < b.first; }));
+  EXPECT_EQ(1, map.find("a")->second);
+  EXPECT_EQ(map.end(), map.find("d"));
+}
+
+TEST(TestFlatMap, LookupAndErase)
+{
+  CFlatMap<std::string, int> map;
+  map["one"] = 1;
+  map["two"] = 2;
+  map["one"] += 10;
+
+  EXPECT_EQ(11, map.find(std::string_view("one"))->second);
+  EXPECT_TRUE(map.contains("two"));
+
+  EXPECT_EQ(1u, map.erase("two"));
+  EXPECT_EQ(0u, map.erase("two"));
+  EXPECT_FALSE(map.contains("two"));
+
+  map.erase(map.find("one"));
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(TestFlatMap, Compare)
+{
+  CFlatMap<std::string, int> map1;
+  map1["x"] = 1;
+  map1["y"] = 2;
+  CFlatMap<std::string, int> map2;
+  map2["y"] = 2;
+  map2["x"] = 1;
+
+  EXPECT_EQ(map1, map2);
+  map2["y"] = 3;
+  EXPECT_NE(map1, map2);
+}
@@ -187,3 +187,25 @@ TEST(TestJSONVariantParser, CanParseArray)
   ASSERT_TRUE(variant[0]["foo"].isString());
   ASSERT_STREQ("bar", variant[0]["foo"].asString().c_str());
 }
+
+TEST(TestJSONVariantParser, CanParseNested)
+{
+  CVariant variant;
+  ASSERT_TRUE(CJSONVariantParser::Parse(
+      std::string(R"({"a":[1,[2,{"b":"c","d":[]}],{}],"e":{"f":{"g":-3.5}},"h":"i"})"), variant));
+
+  CVariant expected(CVariant::VariantTypeObject);
+  expected["a"].push_back(1u); // positive numbers are parsed as unsigned
+  CVariant inner(CVariant::VariantTypeArray);
+  inner.push_back(2u);
+  CVariant innerObject(CVariant::VariantTypeObject);
+  innerObject["b"] = "c";
+  innerObject["d"] = CVariant(CVariant::VariantTypeArray);
+  inner.push_back(innerObject);
+  expected["a"].push_back(inner);
+  expected["a"].push_back(CVariant(CVariant::VariantTypeObject));
+  expected["e"]["f"]["g"] = -3.5;
+  expected["h"] = "i";
+
+  EXPECT_EQ(expected, variant);
+}
@@ -149,3 +149,26 @@ TEST(TestJSONVariantWriter, CanWriteArray)
   ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, false));
   ASSERT_STREQ("[\n\t{\n\t\t\"foo\": \"bar\"\n\t}\n]", str.c_str());
 }
+
+TEST(TestJSONVariantWriter, CanWriteCompact)
+{
+  CVariant variant(CVariant::VariantTypeObject);
+  variant["foo"].push_back(1);
+  variant["foo"].push_back(0.5);
+  variant["bar"] = CVariant(CVariant::VariantTypeArray);
+  std::string str;
+  ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, true));
+  ASSERT_STREQ("{\"bar\":[],\"foo\":[1,0.5]}", str.c_str());
+}
+
+TEST(TestJSONVariantWriter, CanEscapeString)
+{
+  CVariant variant("\"quoted\" \\ \t\n\x01 \xc3\xa9");
+  std::string str;
+  ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, true));
+  ASSERT_STREQ("\"\\\"quoted\\\" \\\\ \\t\\n\\u0001 \xc3\xa9\"", str.c_str());
+
+  // invalid UTF-8
+  variant = "foo\xc3";
+  ASSERT_FALSE(CJSONVariantWriter::Write(variant, str, true));
+}
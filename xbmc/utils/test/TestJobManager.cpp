@@ -12,8 +12,12 @@
 #include "test/MtTestUtils.h"
 #include "utils/XTimeUtils.h"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <mutex>
+#include <string>
+#include <utility>
 
 #include <gtest/gtest.h>
 
@@ -49,6 +53,19 @@ public:
   }
 };
 
+class RemoteJob : public DummyJob
+{
+  std::string m_host;
+public:
+  RemoteJob(Flags* flags, std::string host) : DummyJob(flags), m_host(std::move(host)) {}
+
+  RESOURCE GetResource(std::string& host) const override
+  {
+    host = m_host;
+    return RESOURCE_NETWORK;
+  }
+};
+
 class ReallyDumbJob : public CJob
 {
   Flags* m_flags;
@@ -85,6 +102,30 @@ TEST_F(TestJobManager, AddJob)
   delete flags;
 }
 
+TEST_F(TestJobManager, LimitJobsPerHost)
+{
+  std::array<Flags, 4> flags;
+  auto jobManager = CServiceBroker::GetJobManager();
+  jobManager->AddJob(new RemoteJob(&flags[0], "nas"), nullptr, CJob::PRIORITY_HIGH);
+  jobManager->AddJob(new RemoteJob(&flags[1], "nas"), nullptr, CJob::PRIORITY_HIGH);
+  jobManager->AddJob(new RemoteJob(&flags[2], "nas"), nullptr, CJob::PRIORITY_HIGH);
+  jobManager->AddJob(new RemoteJob(&flags[3], "scraper"), nullptr, CJob::PRIORITY_HIGH);
+
+  // the job of the other host passes the one waiting for its host
+  ASSERT_TRUE(poll([&flags]() -> bool
+                   { return flags[0].started && flags[1].started && flags[3].started; }));
+  EXPECT_FALSE(flags[2].started);
+
+  flags[0].lingerAtWork = false;
+  ASSERT_TRUE(poll([&flags]() -> bool { return flags[2].started; }));
+
+  for (Flags& flag : flags)
+    flag.lingerAtWork = false;
+  ASSERT_TRUE(poll(
+      [&flags]() -> bool
+      { return std::ranges::all_of(flags, [](const Flags& f) -> bool { return f.finished; }); }));
+}
+
 TEST_F(TestJobManager, CancelJob)
 {
   unsigned int id;
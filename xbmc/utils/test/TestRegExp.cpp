@@ -424,4 +424,34 @@ TEST(TestRegExpCache, CtorArgs)
     EXPECT_TRUE(regexp->IsCompiled());
     EXPECT_EQ(0, regexp->RegFind("\u00E0"));
   }
-}
\ No newline at end of file
+}
+TEST(TestRegExpCache, AnyOf)
+{
+  const std::vector<std::string> patterns{"-trailer", "(?i)^extras?$",
+                                          "[-._ \\\\/]sample[-._ \\\\/]"};
+  KODI::REGEXP::RegExpCache cache;
+
+  std::shared_ptr<CRegExp> regexp = KODI::REGEXP::GetAnyOfRegExp(patterns, cache, true);
+  ASSERT_NE(nullptr, regexp);
+  EXPECT_GE(regexp->RegFind("Movie-trailer.mkv"), 0);
+  EXPECT_GE(regexp->RegFind("EXTRAS"), 0);
+  EXPECT_GE(regexp->RegFind("/movies/sample/movie.mkv"), 0);
+  EXPECT_EQ(-1, regexp->RegFind("/movies/movie.mkv"));
+
+  // The combined and the single patterns are cached
+  EXPECT_EQ(4, cache.size());
+  EXPECT_EQ(regexp, KODI::REGEXP::GetAnyOfRegExp(patterns, cache, true));
+}
+
+TEST(TestRegExpCache, AnyOfNotCombinable)
+{
+  KODI::REGEXP::RegExpCache cache;
+
+  // Back references by number would refer to the groups of other patterns
+  EXPECT_TRUE(KODI::REGEXP::CombinePatterns({"(a)\\1", "b"}).empty());
+  EXPECT_EQ(nullptr, KODI::REGEXP::GetAnyOfRegExp({"(a)\\1", "b"}, cache));
+
+  // An invalid pattern mustn't be accepted as a part of the alternation
+  EXPECT_EQ(nullptr, KODI::REGEXP::GetAnyOfRegExp({"a)|(b", "c"}, cache));
+  EXPECT_EQ(nullptr, KODI::REGEXP::GetAnyOfRegExp({"a)|(b", "c"}, cache));
+}
@@ -0,0 +1,84 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/SharedStrings.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(TestSharedStrings, SharesEqualValues)
+{
+  const SharedValuesStats before = CSharedString::GetStats();
+
+  const CSharedString rock1(std::string("Progressive Rock and Roll"));
+  const CSharedString rock2("Progressive Rock and Roll");
+  const CSharedString pop("Pop");
+
+  EXPECT_TRUE(rock1 == rock2);
+  EXPECT_FALSE(rock1 == pop);
+  EXPECT_EQ(&rock1.Get(), &rock2.Get());
+  EXPECT_TRUE(rock1 == "Progressive Rock and Roll");
+
+  const SharedValuesStats after = CSharedString::GetStats();
+  EXPECT_EQ(before.values + 2, after.values);
+  EXPECT_EQ(before.references + 3, after.references);
+  EXPECT_GT(after.savedBytes, before.savedBytes);
+}
+
+TEST(TestSharedStrings, EmptyValue)
+{
+  CSharedString empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ("", empty.Get());
+  EXPECT_TRUE(empty == CSharedString(""));
+
+  CSharedString value("Drama");
+  value.clear();
+  EXPECT_TRUE(value.empty());
+}
+
+TEST(TestSharedStrings, ModifyList)
+{
+  CSharedStringList genres(std::vector<std::string>{"Drama", "Comedy"});
+  const CSharedStringList copy = genres;
+
+  genres.push_back("Horror");
+  EXPECT_EQ(3u, genres.size());
+  EXPECT_EQ("Horror", genres.back());
+  EXPECT_EQ(2u, copy.size());
+  EXPECT_FALSE(genres == copy);
+
+  EXPECT_TRUE(copy == CSharedStringList(std::vector<std::string>{"Drama", "Comedy"}));
+}
+
+TEST(TestSharedStrings, ReleasesFromThreads)
+{
+  const size_t values = CSharedString::GetStats().values;
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++)
+  {
+    threads.emplace_back(
+        []
+        {
+          for (int j = 0; j < 10000; j++)
+          {
+            const CSharedString value(std::to_string(j % 8));
+            CSharedString copy = value;
+            copy = CSharedString("Sci-Fi");
+          }
+        });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  EXPECT_EQ(values, CSharedString::GetStats().values);
+}
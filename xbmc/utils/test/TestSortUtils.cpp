@@ -7,6 +7,7 @@
  */
 
 #include "utils/SortUtils.h"
+#include "utils/StringUtils.h"
 #include "utils/Variant.h"
 
 #include <gtest/gtest.h>
@@ -103,6 +104,67 @@ TEST(TestSortUtils, Sort_SortDescription)
   EXPECT_STREQ("R Artist", (*items.at(6))[Field::ARTIST].asString().c_str());
 }
 
+TEST(TestSortUtils, Sort_SpecialAndFolders)
+{
+  DatabaseResults items;
+  const auto addItem = [&items](const char* label, bool folder, SortSpecial special)
+  {
+    DatabaseResult item;
+    item[Field::LABEL] = label;
+    item[Field::FOLDER] = folder;
+    item[Field::SORT_SPECIAL] = static_cast<int>(special);
+    items.push_back(item);
+  };
+  addItem("C File", false, SortSpecial::NONE);
+  addItem("Bottom", false, SortSpecial::BOTTOM);
+  addItem("B Folder", true, SortSpecial::NONE);
+  addItem("Top 2", false, SortSpecial::TOP);
+  addItem("A File", false, SortSpecial::NONE);
+  addItem("Top 1", true, SortSpecial::TOP);
+  addItem("A File", false, SortSpecial::NONE);
+
+  SortUtils::Sort(SortBy::LABEL, SortOrder::DESCENDING, SortAttributeNone, items);
+
+  // special items keep their relative order, folders go first in either direction
+  const std::vector<std::string> expected{"Top 2",  "Top 1",  "B Folder", "C File",
+                                          "A File", "A File", "Bottom"};
+  ASSERT_EQ(expected.size(), items.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_EQ(expected[i], items[i][Field::LABEL].asString());
+
+  SortUtils::Sort(SortBy::LABEL, SortOrder::ASCENDING, SortAttributeIgnoreFolders, items);
+
+  EXPECT_EQ("A File", items[2][Field::LABEL].asString());
+  EXPECT_EQ("B Folder", items[4][Field::LABEL].asString());
+  EXPECT_EQ("C File", items[5][Field::LABEL].asString());
+}
+
+TEST(TestSortUtils, Sort_LargeListIsStable)
+{
+  // large enough to be sorted in parallel chunks
+  constexpr int count = 50000;
+  DatabaseResults items;
+  for (int i = 0; i < count; ++i)
+  {
+    DatabaseResult item;
+    item[Field::LABEL] = StringUtils::Format("Song {:03}", (i * 7919) % 997);
+    item[Field::ID] = i;
+    items.push_back(item);
+  }
+
+  SortUtils::Sort(SortBy::LABEL, SortOrder::ASCENDING, SortAttributeNone, items);
+
+  ASSERT_EQ(static_cast<size_t>(count), items.size());
+  for (size_t i = 1; i < items.size(); ++i)
+  {
+    const std::string& previous = items[i - 1][Field::LABEL].asString();
+    const std::string& current = items[i][Field::LABEL].asString();
+    ASSERT_LE(previous, current);
+    if (previous == current)
+      ASSERT_LT(items[i - 1][Field::ID].asInteger(), items[i][Field::ID].asInteger());
+  }
+}
+
 TEST(TestSortUtils, GetFieldsForSorting)
 {
   Fields fields;
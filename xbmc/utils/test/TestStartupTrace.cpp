@@ -0,0 +1,49 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/File.h"
+#include "utils/JSONVariantParser.h"
+#include "utils/StartupTrace.h"
+#include "utils/Variant.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(TestStartupTrace, WritesChromeTrace)
+{
+  const std::string path = "special://temp/startup-trace-test.json";
+
+  {
+    CStartupTrace::CScope notRecorded("before");
+  }
+  CStartupTrace::Enable();
+  {
+    CStartupTrace::CScope trace("phase", "detail");
+  }
+  CStartupTrace::Finish(path);
+  {
+    CStartupTrace::CScope notRecorded("after");
+  }
+  EXPECT_FALSE(CStartupTrace::IsEnabled());
+
+  std::vector<uint8_t> data;
+  XFILE::CFile file;
+  ASSERT_GT(file.LoadFile(path, data), 0);
+  XFILE::CFile::Delete(path);
+
+  CVariant trace;
+  ASSERT_TRUE(CJSONVariantParser::Parse(std::string(data.begin(), data.end()), trace));
+  const CVariant& events = trace["traceEvents"];
+  ASSERT_EQ(1u, events.size());
+  EXPECT_EQ("phase detail", events[0]["name"].asString());
+  EXPECT_EQ("X", events[0]["ph"].asString());
+  EXPECT_GE(events[0]["dur"].asInteger(), 0);
+}
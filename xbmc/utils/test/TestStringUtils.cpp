@@ -98,6 +98,16 @@ TEST(TestStringUtils, ToLower)
   EXPECT_STREQ(refstr.c_str(), varstr.c_str());
 }
 
+TEST(TestStringUtils, ToLowerLong)
+{
+  // Long enough for the block-wise conversion, non-ASCII characters are kept
+  const std::string str = "Die Ähnlichkeit Der ÄRZTE @[`{ AZaz Ça Ольга 東京物語 THE END";
+  EXPECT_EQ("die Ähnlichkeit der Ärzte @[`{ azaz Ça Ольга 東京物語 the end",
+            StringUtils::ToLower(str));
+  EXPECT_EQ("DIE ÄHNLICHKEIT DER ÄRZTE @[`{ AZAZ ÇA Ольга 東京物語 THE END",
+            StringUtils::ToUpper(str));
+}
+
 TEST(TestStringUtils, ToCapitalize)
 {
   std::string refstr = "Test";
@@ -137,6 +147,14 @@ TEST(TestStringUtils, EqualsNoCase)
 
   EXPECT_TRUE(StringUtils::EqualsNoCase(refstr, "TeSt"));
   EXPECT_TRUE(StringUtils::EqualsNoCase(refstr, "tEsT"));
+  EXPECT_FALSE(StringUtils::EqualsNoCase(refstr, "TeSts"));
+
+  const std::string longstr = "The Lord of the Rings: The Fellowship of the Ring (2001)";
+  EXPECT_TRUE(StringUtils::EqualsNoCase(longstr, StringUtils::ToUpper(longstr)));
+  EXPECT_FALSE(StringUtils::EqualsNoCase(
+      longstr, "The Lord of the Rings: The Fellowship of the Ring [2001]"));
+  EXPECT_FALSE(
+      StringUtils::EqualsNoCase("Amélie Poulain and the others", "AMéLIE Poulaim and the others"));
 }
 
 TEST(TestStringUtils, ReturnDigits)
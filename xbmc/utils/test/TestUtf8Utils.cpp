@@ -0,0 +1,75 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/Utf8Utils.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+TEST(TestUtf8Utils, IsAscii)
+{
+  EXPECT_TRUE(CUtf8Utils::IsAscii(""));
+  EXPECT_TRUE(CUtf8Utils::IsAscii("The Lord of the Rings: The Fellowship of the Ring"));
+  EXPECT_FALSE(CUtf8Utils::IsAscii("The Lord of the Rings: The Fellowship of the Ring\xC3\xA4"));
+  EXPECT_FALSE(CUtf8Utils::IsAscii("\xC3\xA4 The Lord of the Rings"));
+}
+
+TEST(TestUtf8Utils, Utf8ToUtf32)
+{
+  std::u32string utf32;
+  EXPECT_TRUE(CUtf8Utils::Utf8ToUtf32("Die Gefährten – Крёстный отец – 千と千尋 🎬", utf32, true));
+  EXPECT_EQ(U"Die Gefährten – Крёстный отец – 千と千尋 🎬", utf32);
+
+  // embedded null characters are kept
+  EXPECT_TRUE(CUtf8Utils::Utf8ToUtf32(std::string("a\0b", 3), utf32, true));
+  EXPECT_EQ(std::u32string(U"a\0b", 3), utf32);
+}
+
+TEST(TestUtf8Utils, Utf8ToUtf32Invalid)
+{
+  // truncated sequence, lone continuation byte, overlong form and surrogate
+  const std::string invalid = "abcdefghijklmnopq\xC3 r\x80s\xC0\xAFt\xED\xA0\x80u\xE2\x82";
+
+  std::u32string utf32;
+  EXPECT_FALSE(CUtf8Utils::Utf8ToUtf32(invalid, utf32, true));
+  EXPECT_TRUE(utf32.empty());
+
+  EXPECT_TRUE(CUtf8Utils::Utf8ToUtf32(invalid, utf32, false));
+  EXPECT_EQ(U"abcdefghijklmnopq rstu", utf32);
+}
+
+TEST(TestUtf8Utils, Utf32ToUtf8)
+{
+  std::string utf8;
+  EXPECT_TRUE(CUtf8Utils::Utf32ToUtf8(U"Die Gefährten – Крёстный отец – 千と千尋 🎬", utf8, true));
+  EXPECT_EQ("Die Gefährten – Крёстный отец – 千と千尋 🎬", utf8);
+
+  const std::u32string invalid = {U'a', 0xD800, U'b', 0x110000, U'c'};
+  EXPECT_FALSE(CUtf8Utils::Utf32ToUtf8(invalid, utf8, true));
+  EXPECT_TRUE(CUtf8Utils::Utf32ToUtf8(invalid, utf8, false));
+  EXPECT_EQ("abc", utf8);
+}
+
+TEST(TestUtf8Utils, WideRoundTrip)
+{
+  const std::string text = "Die Gefährten – Крёстный отец – 千と千尋 🎬";
+
+  std::wstring wide;
+  EXPECT_TRUE(CUtf8Utils::Utf8ToW(text, wide, true));
+  EXPECT_EQ(L"Die Gefährten – Крёстный отец – 千と千尋 🎬", wide);
+
+  std::string utf8;
+  EXPECT_TRUE(CUtf8Utils::WToUtf8(wide, utf8, true));
+  EXPECT_EQ(text, utf8);
+
+  std::u32string utf32;
+  EXPECT_TRUE(CUtf8Utils::Utf8ToUtf32(text, utf32, true));
+  EXPECT_TRUE(CUtf8Utils::Utf32ToW(utf32, wide, true));
+  EXPECT_EQ(L"Die Gefährten – Крёстный отец – 千と千尋 🎬", wide);
+}
@@ -10,6 +10,8 @@
 
 #include <map>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -415,3 +417,28 @@ TEST(TestVariant, ConstNullVariant_cant_be_changed)
   EXPECT_EQ(CVariant::VariantTypeConstNull, CVariant::ConstNullVariant.type());
   EXPECT_EQ(CVariant::VariantTypeConstNull, c3.type());
 }
+
+TEST(TestVariant, StringViewKeys)
+{
+  const std::string_view key = "a key longer than the small string buffer";
+  CVariant a;
+  a[key] = 1;
+  a[std::string(key)] = 2;
+  a["other"] = 3;
+
+  EXPECT_EQ(2u, a.size());
+  EXPECT_TRUE(a.isMember(key));
+  EXPECT_EQ(2, std::as_const(a)[key].asInteger());
+  EXPECT_TRUE(std::as_const(a)["missing"].isNull());
+  EXPECT_FALSE(a.isMember("missing"));
+
+  a.erase(key);
+  a.erase("missing");
+  EXPECT_EQ(1u, a.size());
+  EXPECT_FALSE(a.isMember(key));
+
+  std::map<std::string, CVariant> variantMap;
+  variantMap["key"] = CVariant("value");
+  CVariant b = std::move(variantMap);
+  EXPECT_EQ("value", b["key"].asString());
+}
@@ -0,0 +1,76 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "utils/StringUtils.h"
+#include "utils/WordSearchIndex.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+const std::vector<std::string> labels = {
+    "The Fifth Element", "Fight Club",      "Élite",         "2001: A Space Odyssey",
+    "Se7en",             "Ocean's Eleven",  "fifty shades",  "The Fellowship of the Ring",
+    "",                  "Twelve Monkeys", "Crème brûlée", "Live Free or Die Hard"};
+
+std::vector<size_t> FindWords(const std::string& wordLowerCase)
+{
+  std::vector<size_t> matches;
+  for (size_t i = 0; i < labels.size(); ++i)
+  {
+    if (StringUtils::FindWords(labels[i], wordLowerCase) != std::string::npos)
+      matches.push_back(i);
+  }
+  return matches;
+}
+} // namespace
+
+TEST(TestWordSearchIndex, FindsLikeFindWords)
+{
+  CWordSearchIndex index;
+  for (size_t i = 0; i < labels.size(); ++i)
+    index.Set(i, labels[i]);
+  ASSERT_EQ(labels.size(), index.Size());
+
+  for (const char* word : {"f", "fi", "fif", "fifth", "e", "el", "ele", "élite", "2001", "200",
+                           "00", "7", "en", "s", "'", "brû", "die hard", "xyz"})
+  {
+    EXPECT_EQ(FindWords(word), index.Find(word)) << word;
+  }
+}
+
+TEST(TestWordSearchIndex, Narrowing)
+{
+  CWordSearchIndex index;
+  for (size_t i = 0; i < labels.size(); ++i)
+    index.Set(i, labels[i]);
+
+  // typing a filter, deleting from it and typing another one
+  for (const char* word : {"t", "th", "the", "th", "the f", "the fe", "o", "oc", "f", "fi"})
+  {
+    EXPECT_EQ(FindWords(word), index.Find(word)) << word;
+  }
+}
+
+TEST(TestWordSearchIndex, ChangedText)
+{
+  CWordSearchIndex index;
+  index.Set(0, "Alien");
+  index.Set(1, "Aliens");
+  EXPECT_EQ(std::vector<size_t>({0, 1}), index.Find("al"));
+
+  // a changed text after a search must not be ruled out by the narrowing
+  index.Set(0, "Prometheus");
+  index.Set(1, "Alien Covenant");
+  EXPECT_EQ(std::vector<size_t>({1}), index.Find("ali"));
+  index.Set(0, "Alien: Romulus");
+  EXPECT_EQ(std::vector<size_t>({0, 1}), index.Find("alie"));
+}
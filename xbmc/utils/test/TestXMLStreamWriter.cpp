@@ -0,0 +1,83 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/File.h"
+#include "test/TestUtils.h"
+#include "utils/XBMCTinyXML.h"
+#include "utils/XMLStreamWriter.h"
+#include "utils/XMLUtils.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+TEST(TestXMLStreamWriter, WritesFlushedElements)
+{
+  XFILE::CFile* tmpfile = XBMC_CREATETEMPFILE(".xml");
+  ASSERT_NE(nullptr, tmpfile);
+  const std::string path = XBMC_TEMPFILEPATH(tmpfile);
+  tmpfile->Close();
+
+  {
+    CXMLStreamWriter writer;
+    ASSERT_TRUE(writer.Open(path, "videodb"));
+
+    TiXmlElement main("videodb");
+    XMLUtils::SetInt(&main, "version", 1);
+    EXPECT_TRUE(writer.Flush(main));
+    EXPECT_EQ(nullptr, main.FirstChild());
+
+    for (const char* title : {"Alien", "Aliens & Predators"})
+    {
+      TiXmlElement movie("movie");
+      XMLUtils::SetString(&movie, "title", title);
+      main.InsertEndChild(movie);
+      EXPECT_TRUE(writer.Flush(main));
+    }
+    EXPECT_TRUE(writer.Close());
+  }
+
+  CXBMCTinyXML doc;
+  ASSERT_TRUE(doc.LoadFile(path));
+  const TiXmlElement* root = doc.RootElement();
+  ASSERT_NE(nullptr, root);
+  EXPECT_STREQ("videodb", root->Value());
+
+  int version = 0;
+  EXPECT_TRUE(XMLUtils::GetInt(root, "version", version));
+  EXPECT_EQ(1, version);
+
+  const TiXmlElement* movie = root->FirstChildElement("movie");
+  ASSERT_NE(nullptr, movie);
+  EXPECT_EQ("Alien", XMLUtils::GetString(movie, "title"));
+  movie = movie->NextSiblingElement("movie");
+  ASSERT_NE(nullptr, movie);
+  EXPECT_EQ("Aliens & Predators", XMLUtils::GetString(movie, "title"));
+  EXPECT_EQ(nullptr, movie->NextSiblingElement());
+
+  EXPECT_TRUE(XBMC_DELETETEMPFILE(tmpfile));
+}
+
+TEST(TestXMLStreamWriter, DeletesUnclosedDocument)
+{
+  XFILE::CFile* tmpfile = XBMC_CREATETEMPFILE(".xml");
+  ASSERT_NE(nullptr, tmpfile);
+  const std::string path = XBMC_TEMPFILEPATH(tmpfile);
+  tmpfile->Close();
+
+  {
+    CXMLStreamWriter writer;
+    ASSERT_TRUE(writer.Open(path, "musicdb"));
+    TiXmlElement main("musicdb");
+    main.InsertEndChild(TiXmlElement("album"));
+    EXPECT_TRUE(writer.Flush(main));
+  }
+
+  EXPECT_FALSE(XFILE::CFile::Exists(path));
+  XBMC_DELETETEMPFILE(tmpfile);
+}
@@ -584,3 +584,12 @@ TEST(TestXMLUtils, SetDateTime)
   EXPECT_TRUE(XMLUtils::GetDateTime(b.RootElement(), "node", val2));
   EXPECT_TRUE(ref == val2);
 }
+
+TEST(TestXMLUtils, EscapeInvalidEntities)
+{
+  const std::string data("<url>?a=1&b=2&amp;&lt;&gt;&quot;&apos;&#x3f;&#x003F;&#0063;"
+                         "&#x12345;&#123456;&#;&#x;&foo;&</url>");
+  EXPECT_EQ("<url>?a=1&amp;b=2&amp;&lt;&gt;&quot;&apos;&#x3f;&#x003F;&#0063;"
+            "&amp;#x12345;&amp;#123456;&amp;#;&amp;#x;&amp;foo;&amp;</url>",
+            XMLUtils::EscapeInvalidEntities(data, data.find('&')));
+}
@@ -16,6 +16,8 @@
 #include "utils/log.h"
 
 #include <stdlib.h>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -92,3 +94,58 @@ TEST_F(Testlog, SetLogLevel)
   CServiceBroker::GetLogging().Deinitialize();
   EXPECT_TRUE(XFILE::CFile::Delete(logfile));
 }
+
+namespace
+{
+std::string ReadLog(const std::string& logfile)
+{
+  std::vector<uint8_t> data;
+  XFILE::CFile file;
+  file.LoadFile(logfile, data);
+  return std::string(data.begin(), data.end());
+}
+} // namespace
+
+TEST_F(Testlog, AsyncLog)
+{
+  std::string appName = CCompileInfo::GetAppName();
+  StringUtils::ToLower(appName);
+  const std::string logfile = CSpecialProtocol::TranslatePath("special://temp/") + appName + ".log";
+  CServiceBroker::GetLogging().Initialize(CSpecialProtocol::TranslatePath("special://temp/"));
+  CServiceBroker::GetLogging().SetAsync(true);
+
+  CLog::Log(LOGDEBUG, "async debug log message");
+  CLog::Log(LOGERROR, "async error log message");
+  CServiceBroker::GetLogging().Deinitialize();
+  CServiceBroker::GetLogging().SetAsync(false);
+
+  const std::string logstring = ReadLog(logfile);
+  EXPECT_NE(std::string::npos, logstring.find("<general>: async debug log message"));
+  EXPECT_NE(std::string::npos, logstring.find("<general>: async error log message"));
+
+  EXPECT_TRUE(XFILE::CFile::Delete(logfile));
+}
+
+TEST_F(Testlog, RateLimit)
+{
+  std::string appName = CCompileInfo::GetAppName();
+  StringUtils::ToLower(appName);
+  const std::string logfile = CSpecialProtocol::TranslatePath("special://temp/") + appName + ".log";
+  CServiceBroker::GetLogging().Initialize(CSpecialProtocol::TranslatePath("special://temp/"));
+  CServiceBroker::GetLogging().SetRateLimit(5);
+
+  for (int i = 0; i < 50; ++i)
+    CLog::Log(LOGDEBUG, "rate limited log message {}", i);
+  CLog::Log(LOGERROR, "error log message");
+  CServiceBroker::GetLogging().Deinitialize();
+  CServiceBroker::GetLogging().SetRateLimit(0);
+
+  const std::string logstring = ReadLog(logfile);
+  // the loop may span two windows of the limit
+  const int logged = StringUtils::FindNumber(logstring, "rate limited log message");
+  EXPECT_GE(logged, 1);
+  EXPECT_LE(logged, 10);
+  EXPECT_NE(std::string::npos, logstring.find("error log message"));
+
+  EXPECT_TRUE(XFILE::CFile::Delete(logfile));
+}
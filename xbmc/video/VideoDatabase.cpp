@@ -54,11 +54,13 @@
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
+#include "utils/XMLStreamWriter.h"
 #include "utils/XMLUtils.h"
 #include "utils/i18n/TableLanguageCodes.h"
 #include "utils/log.h"
 #include "video/VideoDatabaseColumns.h"
 #include "video/VideoDatabaseDDL.h"
+#include "video/VideoDbResultCache.h"
 #include "video/VideoDbUrl.h"
 #include "video/VideoFileItemClassify.h"
 #include "video/VideoInfoTag.h"
@@ -69,11 +71,14 @@
 #include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <ranges>
 #include <set>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -87,6 +92,186 @@ using namespace KODI::GUILIB;
 using namespace KODI::VIDEO;
 using namespace std::chrono_literals;
 
+namespace
+{
+/*! \brief Add the stream of the current row of a "SELECT * FROM streamdetails" query.
+ \return true if the row held a known stream type
+ */
+bool AddStreamDetail(dbiplus::Dataset& ds, CStreamDetails& details)
+{
+  const auto e = static_cast<CStreamDetail::StreamType>(ds.fv(1).get_asInt());
+  switch (e)
+  {
+  case CStreamDetail::VIDEO:
+    {
+      auto* p = new CStreamDetailVideo();
+      p->m_strCodec = ds.fv(2).get_asString();
+      p->m_fAspect = ds.fv(3).get_asFloat();
+      p->m_iWidth = ds.fv(4).get_asInt();
+      p->m_iHeight = ds.fv(5).get_asInt();
+      p->m_iDuration = ds.fv(10).get_asInt();
+      p->m_strStereoMode = ds.fv(11).get_asString();
+      p->m_strLanguage = ds.fv(12).get_asString();
+      p->m_strHdrType = ds.fv(13).get_asString();
+      p->m_strHdrDetail = ds.fv(14).get_asString();
+      details.AddStream(p);
+      return true;
+    }
+  case CStreamDetail::AUDIO:
+    {
+      auto* p = new CStreamDetailAudio();
+      p->m_strCodec = ds.fv(6).get_asString();
+      if (ds.fv(7).get_isNull())
+        p->m_iChannels = -1;
+      else
+        p->m_iChannels = ds.fv(7).get_asInt();
+      p->m_strLanguage = ds.fv(8).get_asString();
+      details.AddStream(p);
+      return true;
+    }
+  case CStreamDetail::SUBTITLE:
+    {
+      auto* p = new CStreamDetailSubtitle();
+      p->m_strLanguage = ds.fv(9).get_asString();
+      details.AddStream(p);
+      return true;
+    }
+  }
+  return false;
+}
+
+/*! \brief Call function with comma separated lists of the ids, at most IDS_PER_QUERY in each
+ */
+void ForEachIdBatch(const auto& ids, const auto& function)
+{
+  // ids in one IN () list, keeps the statements well below the size limits of the servers
+  constexpr size_t IDS_PER_QUERY = 500;
+
+  std::string list;
+  size_t count = 0;
+  for (const int id : ids)
+  {
+    if (!list.empty())
+      list += ',';
+    list += std::to_string(id);
+    if (++count == IDS_PER_QUERY)
+    {
+      function(list);
+      list.clear();
+      count = 0;
+    }
+  }
+  if (!list.empty())
+    function(list);
+}
+
+std::chrono::seconds GetResultCacheAge()
+{
+  return std::chrono::seconds(
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoLibraryResultCacheAge);
+}
+
+struct JSONVideoField
+{
+  std::string_view name;
+  CVariant (*get)(const CVideoInfoTag& tag, const dbiplus::sql_record& record);
+};
+
+std::string GetDBDate(const CDateTime& date)
+{
+  return date.IsValid() ? date.GetAsDBDate() : "";
+}
+
+std::string GetDBDateTime(const CDateTime& dateTime)
+{
+  return dateTime.IsValid() ? dateTime.GetAsDBDateTime() : "";
+}
+
+// JSON-RPC fields that only depend on the view row, with the values CVideoInfoTag::Serialize()
+// produces for them
+// clang-format off
+constexpr JSONVideoField JSONVideoFields[] = {
+  {"dateadded",          [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(GetDBDateTime(tag.m_dateAdded)); }},
+  {"director",           [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_director); }},
+  {"episode",            [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_iEpisode); }},
+  {"episodeguide",       [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_strEpisodeGuide); }},
+  {"file",               [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.GetPath()); }},
+  {"firstaired",         [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(GetDBDate(tag.m_firstAired)); }},
+  {"genre",              [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_genre); }},
+  {"imdbnumber",         [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.GetUniqueID()); }},
+  {"lastplayed",         [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(GetDBDateTime(tag.m_lastPlayed)); }},
+  {"mpaa",               [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_strMPAARating); }},
+  {"originaltitle",      [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_strOriginalTitle); }},
+  {"playcount",          [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.GetPlayCount()); }},
+  {"plot",               [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_strPlot); }},
+  {"plotoutline",        [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_strPlotOutline); }},
+  {"premiered",          [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(GetDBDate(tag.m_premiered)); }},
+  {"productioncode",     [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_strProductionCode); }},
+  {"rating",             [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.GetRating().rating); }},
+  {"resume",             [](const CVideoInfoTag& tag, const dbiplus::sql_record&)
+                         {
+                           const CBookmark resumePoint = tag.GetResumePoint();
+                           CVariant resume{CVariant::VariantTypeObject};
+                           resume["position"] = resumePoint.timeInSeconds;
+                           resume["total"] = resumePoint.totalTimeInSeconds;
+                           return resume;
+                         }},
+  {"runtime",            [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.GetDuration()); }},
+  {"season",             [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_iSeason); }},
+  {"seasonid",           [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_iIdSeason); }},
+  {"set",                [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_set.GetTitle()); }},
+  {"setid",              [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_set.GetID()); }},
+  {"showtitle",          [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_strShowTitle); }},
+  {"sorttitle",          [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_strSortTitle); }},
+  {"specialsortepisode", [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_iSpecialSortEpisode); }},
+  {"specialsortseason",  [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_iSpecialSortSeason); }},
+  {"studio",             [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_studio); }},
+  {"tagline",            [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_strTagLine); }},
+  {"title",              [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_strTitle); }},
+  {"top250",             [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_iTop250); }},
+  {"trailer",            [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_strTrailer); }},
+  {"tvshowid",           [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_iIdShow); }},
+  {"userrating",         [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_iUserRating); }},
+  {"votes",              [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(std::to_string(tag.GetRating().votes)); }},
+  {"writer",             [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.m_writingCredits); }},
+  {"year",               [](const CVideoInfoTag& tag, const dbiplus::sql_record&) { return CVariant(tag.GetYear()); }},
+};
+
+// tv show fields the file item listing takes from item properties
+constexpr JSONVideoField JSONTvShowFields[] = {
+  {"watchedepisodes",    [](const CVideoInfoTag&, const dbiplus::sql_record& record) { return CVariant(record.at(VIDEODB_DETAILS_TVSHOW_NUM_WATCHED).get_asInt()); }},
+};
+// clang-format on
+
+const JSONVideoField* FindJSONVideoField(const MediaType& mediaType, std::string_view name)
+{
+  if (mediaType == MediaTypeTvShow)
+  {
+    const auto it = std::ranges::find(JSONTvShowFields, name, &JSONVideoField::name);
+    if (it != std::end(JSONTvShowFields))
+      return it;
+  }
+
+  const auto it = std::ranges::find(JSONVideoFields, name, &JSONVideoField::name);
+  return it != std::end(JSONVideoFields) ? it : nullptr;
+}
+
+/*! \brief Label of an episode as set by the "%H. %T" formatter of GetEpisodesByWhere().
+ */
+std::string GetEpisodeLabel(const CVideoInfoTag& episode)
+{
+  if (episode.m_iEpisode <= 0)
+    return episode.m_strTitle;
+
+  std::string label = episode.m_iSeason == 0
+                          ? StringUtils::Format("S{:02}", episode.m_iEpisode)
+                          : StringUtils::Format("{}x{:02}", episode.m_iSeason, episode.m_iEpisode);
+  if (!episode.m_strTitle.empty())
+    label += ". " + episode.m_strTitle;
+  return label;
+}
+} // unnamed namespace
+
 CVideoDatabase::FileInformation::FileInformation(std::string&& newPath,
                                                  int newFileId,
                                                  int newVvId,
@@ -138,8 +323,8 @@ int CVideoDatabase::GetPathId(const std::string& strPath)
 
     URIUtils::AddSlashAtEnd(strPath1);
 
-    strSQL=PrepareSQL("select idPath from path where strPath='%s'",strPath1.c_str());
-    m_pDS->query(strSQL);
+    strSQL = "select idPath from path where strPath=?";
+    m_pDS->query(strSQL, {dbiplus::field_value(strPath1)});
     if (!m_pDS->eof())
       idPath = m_pDS->fv("path.idPath").get_asInt();
 
@@ -300,6 +485,53 @@ int CVideoDatabase::RunQuery(const std::string &sql)
   return rows;
 }
 
+std::string CVideoDatabase::GetResultCacheKey(std::string_view type,
+                                              const std::string& strBaseDir,
+                                              const std::string& query,
+                                              const SortDescription& sortDescription,
+                                              const SortDescription& sorting,
+                                              int getDetails) const
+{
+  if (GetResultCacheAge() <= 0s)
+    return {};
+
+  // random listings have to differ each time
+  if (sortDescription.sortBy == SortBy::RANDOM || sorting.sortBy == SortBy::RANDOM)
+    return {};
+
+  // items of locked sources are filtered per user, don't share those listings
+  if (m_profileManager.GetMasterProfile().getLockMode() != LockMode::EVERYONE &&
+      !g_passwordManager.bMasterUser)
+    return {};
+
+  // the connection identifies the database, profiles may use separate ones
+  return StringUtils::Format(
+      "{}/{}|{}|{}|{}|{}:{}:{}:{}:{}|{}:{}:{}:{}:{}|{}", m_pDB->getHostName(),
+      m_pDB->getDatabase(), type, strBaseDir, getDetails, static_cast<int>(sortDescription.sortBy),
+      static_cast<int>(sortDescription.sortOrder), static_cast<int>(sortDescription.sortAttributes),
+      sortDescription.limitStart, sortDescription.limitEnd, static_cast<int>(sorting.sortBy),
+      static_cast<int>(sorting.sortOrder), static_cast<int>(sorting.sortAttributes),
+      sorting.limitStart, sorting.limitEnd, query);
+}
+
+int CVideoDatabase::RestrictToRandomSample(const MediaType& mediaType,
+                                           const SortDescription& sorting,
+                                           Filter& filter,
+                                           std::string& strSQLExtra) const
+{
+  if (!filter.limit.empty() || sorting.sortBy != SortBy::RANDOM || sorting.limitStart != 0 ||
+      sorting.limitEnd <= 0)
+    return -1;
+
+  const std::string idField =
+      DatabaseUtils::GetField(Field::ID, mediaType, DatabaseQueryPart::WHERE);
+  const int total = RestrictToRandomIds(idField.substr(0, idField.find('.')), idField,
+                                        static_cast<unsigned int>(sorting.limitEnd), filter);
+  if (total >= 0)
+    CDatabase::BuildSQL("", filter, strSQLExtra);
+  return total;
+}
+
 bool CVideoDatabase::GetSubPaths(const std::string &basepath, std::vector<std::pair<int, std::string>>& subpaths)
 {
   std::string sql;
@@ -550,10 +782,9 @@ int CVideoDatabase::AddOrUpdateFile(const std::string& fileAndPath,
                                      ? "'" + fileInfo.m_lastPlayed.GetAsDBDateTime() + "'"
                                      : "NULL"};
 
-    sql = PrepareSQL("SELECT idFile FROM files WHERE strFileName = '%s' AND idPath=%i",
-                     strFileName.c_str(), idPath);
+    sql = "SELECT idFile FROM files WHERE strFileName = ? AND idPath = ?";
 
-    m_pDS->query(sql);
+    m_pDS->query(sql, {dbiplus::field_value(strFileName), dbiplus::field_value(idPath)});
     if (m_pDS->num_rows() > 0)
     {
       const int idFile{m_pDS->fv("idFile").get_asInt()};
@@ -769,9 +1000,8 @@ int CVideoDatabase::GetFileId(const std::string& strFilenameAndPath)
     int idPath = GetPathId(strPath);
     if (idPath >= 0)
     {
-      std::string strSQL;
-      strSQL=PrepareSQL("select idFile from files where strFileName='%s' and idPath=%i", strFileName.c_str(),idPath);
-      m_pDS->query(strSQL);
+      m_pDS->query("select idFile from files where strFileName=? and idPath=?",
+                   {dbiplus::field_value(strFileName), dbiplus::field_value(idPath)});
       if (m_pDS->num_rows() > 0)
       {
         int idFile = m_pDS->fv("files.idFile").get_asInt();
@@ -2230,6 +2460,16 @@ std::string CVideoDatabase::GetValueString(const CVideoInfoTag& details,
       conditions.emplace_back(PrepareSQL("c%02d='%s'", i, StringUtils::Join(*((const std::vector<std::string>*)(((const char*)&details)+offsets[i].offset)),
                                                                           CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoItemSeparator).c_str()));
       break;
+    case VIDEODB_TYPE_SHAREDSTRINGARRAY:
+      conditions.emplace_back(PrepareSQL(
+          "c%02d='%s'", i,
+          StringUtils::Join(
+              reinterpret_cast<const CSharedStringList*>(
+                  reinterpret_cast<const char*>(&details) + offsets[i].offset)
+                  ->Get(),
+              CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoItemSeparator)
+              .c_str()));
+      break;
     case VIDEODB_TYPE_DATE:
       conditions.emplace_back(PrepareSQL("c%02d='%s'", i, ((const CDateTime*)(((const char*)&details)+offsets[i].offset))->GetAsDBDate().c_str()));
       break;
@@ -4349,6 +4589,17 @@ void CVideoDatabase::GetDetailsFromDB(const dbiplus::sql_record* const record,
         *(std::vector<std::string>*)(((char*)&details)+offsets[i].offset) = StringUtils::Split(value, CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoItemSeparator);
       break;
     }
+    case VIDEODB_TYPE_SHAREDSTRINGARRAY:
+    {
+      const std::string value = record->at(i + idxOffset).get_asString();
+      const std::string& separator =
+          CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoItemSeparator;
+      if (!value.empty())
+        *reinterpret_cast<CSharedStringList*>(reinterpret_cast<char*>(&details) +
+                                              offsets[i].offset) =
+            StringUtils::Split(value, separator);
+      break;
+    }
     case VIDEODB_TYPE_DATE:
       ((CDateTime*)(((char*)&details)+offsets[i].offset))->SetFromDBDate(record->at(i+idxOffset).get_asString());
       break;
@@ -4476,47 +4727,8 @@ bool CVideoDatabase::GetStreamDetails(CVideoInfoTag& tag)
 
     while (!pDS->eof())
     {
-      const auto e = static_cast<CStreamDetail::StreamType>(pDS->fv(1).get_asInt());
-      switch (e)
-      {
-      case CStreamDetail::VIDEO:
-        {
-          auto* p = new CStreamDetailVideo();
-          p->m_strCodec = pDS->fv(2).get_asString();
-          p->m_fAspect = pDS->fv(3).get_asFloat();
-          p->m_iWidth = pDS->fv(4).get_asInt();
-          p->m_iHeight = pDS->fv(5).get_asInt();
-          p->m_iDuration = pDS->fv(10).get_asInt();
-          p->m_strStereoMode = pDS->fv(11).get_asString();
-          p->m_strLanguage = pDS->fv(12).get_asString();
-          p->m_strHdrType = pDS->fv(13).get_asString();
-          p->m_strHdrDetail = pDS->fv(14).get_asString();
-          details.AddStream(p);
-          retVal = true;
-          break;
-        }
-      case CStreamDetail::AUDIO:
-        {
-          auto* p = new CStreamDetailAudio();
-          p->m_strCodec = pDS->fv(6).get_asString();
-          if (pDS->fv(7).get_isNull())
-            p->m_iChannels = -1;
-          else
-            p->m_iChannels = pDS->fv(7).get_asInt();
-          p->m_strLanguage = pDS->fv(8).get_asString();
-          details.AddStream(p);
-          retVal = true;
-          break;
-        }
-      case CStreamDetail::SUBTITLE:
-        {
-          auto* p = new CStreamDetailSubtitle();
-          p->m_strLanguage = pDS->fv(9).get_asString();
-          details.AddStream(p);
-          retVal = true;
-          break;
-        }
-      }
+      if (AddStreamDetail(*pDS, details))
+        retVal = true;
 
       pDS->next();
     }
@@ -4535,6 +4747,41 @@ bool CVideoDatabase::GetStreamDetails(CVideoInfoTag& tag)
   return retVal;
 }
 
+bool CVideoDatabase::GetStreamDetailsForFiles(const std::set<int>& fileIds,
+                                              std::map<int, CStreamDetails>& details)
+{
+  if (nullptr == m_pDB || nullptr == m_pDS2)
+    return false;
+
+  try
+  {
+    for (const int id : fileIds)
+      details[id].Reset();
+
+    ForEachIdBatch(fileIds,
+                   [&](const std::string& ids)
+                   {
+                     m_pDS2->query(PrepareSQL("SELECT * FROM streamdetails WHERE idFile IN (%s)",
+                                              ids.c_str()));
+                     while (!m_pDS2->eof())
+                     {
+                       AddStreamDetail(*m_pDS2, details[m_pDS2->fv(0).get_asInt()]);
+                       m_pDS2->next();
+                     }
+                     m_pDS2->close();
+                   });
+
+    for (const int id : fileIds)
+      details[id].DetermineBestStreams();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "({} files) failed", fileIds.size());
+  }
+  return false;
+}
+
 bool CVideoDatabase::GetResumePoint(CVideoInfoTag& tag)
 {
   if (tag.m_iFileId < 0)
@@ -5050,6 +5297,182 @@ void CVideoDatabase::GetUniqueIDs(int media_id, const std::string &media_type, C
   }
 }
 
+void CVideoDatabase::GetBulkDetails(std::vector<CVideoInfoTag>& details,
+                                    const MediaType& mediaType,
+                                    int getDetails)
+{
+  if (!getDetails || details.empty() || !m_pDB || !m_pDS2)
+    return;
+
+  // several versions of a movie can be listed, and versions can share a file
+  std::unordered_map<int, std::vector<size_t>> byId;
+  std::unordered_map<int, std::vector<size_t>> byFile;
+  byId.reserve(details.size());
+  for (size_t i = 0; i < details.size(); ++i)
+  {
+    byId[details[i].m_iDbId].push_back(i);
+    if (details[i].m_iFileId >= 0)
+      byFile[details[i].m_iFileId].push_back(i);
+  }
+
+  const auto forEachMatch = [](const auto& indices, int id, const auto& function)
+  {
+    const auto it = indices.find(id);
+    if (it != indices.end())
+    {
+      for (size_t index : it->second)
+        function(index);
+    }
+  };
+
+  try
+  {
+    if (getDetails & VideoDbDetailsCast)
+    {
+      ForEachIdBatch(std::views::keys(byId), [&](const std::string& ids) {
+        m_pDS2->query(PrepareSQL("SELECT actor_link.media_id,"
+                                 "  actor.name,"
+                                 "  actor_link.role,"
+                                 "  actor_link.cast_order,"
+                                 "  actor.art_urls,"
+                                 "  art.url "
+                                 "FROM actor_link"
+                                 "  JOIN actor ON"
+                                 "    actor_link.actor_id=actor.actor_id"
+                                 "  LEFT JOIN art ON"
+                                 "    art.media_id=actor.actor_id AND art.media_type='actor' AND art.type='thumb' "
+                                 "WHERE actor_link.media_id IN (%s) AND actor_link.media_type='%s' "
+                                 "ORDER BY actor_link.media_id, actor_link.cast_order",
+                                 ids.c_str(), mediaType.c_str()));
+        while (!m_pDS2->eof())
+        {
+          SActorInfo info;
+          info.strName = m_pDS2->fv(1).get_asString();
+          info.strRole = m_pDS2->fv(2).get_asString();
+          info.order = m_pDS2->fv(3).get_asInt();
+          info.thumbUrl.ParseFromData(m_pDS2->fv(4).get_asString());
+          info.thumb = m_pDS2->fv(5).get_asString();
+
+          forEachMatch(byId, m_pDS2->fv(0).get_asInt(), [&](size_t index) {
+            // ignore identical actors, same as GetCast()
+            std::vector<SActorInfo>& cast = details[index].m_cast;
+            if (std::ranges::none_of(
+                    cast, [&info](const SActorInfo& actor)
+                    { return actor.strName == info.strName && actor.strRole == info.strRole; }))
+              cast.emplace_back(info);
+          });
+          m_pDS2->next();
+        }
+        m_pDS2->close();
+      });
+    }
+
+    if (getDetails & VideoDbDetailsTag)
+    {
+      ForEachIdBatch(std::views::keys(byId), [&](const std::string& ids) {
+        m_pDS2->query(PrepareSQL("SELECT tag_link.media_id, tag.name FROM tag "
+                                 "INNER JOIN tag_link ON tag_link.tag_id = tag.tag_id "
+                                 "WHERE tag_link.media_id IN (%s) AND tag_link.media_type = '%s' "
+                                 "ORDER BY tag_link.media_id, tag.tag_id",
+                                 ids.c_str(), mediaType.c_str()));
+        while (!m_pDS2->eof())
+        {
+          forEachMatch(byId, m_pDS2->fv(0).get_asInt(), [&](size_t index)
+                       { details[index].m_tags.emplace_back(m_pDS2->fv(1).get_asString()); });
+          m_pDS2->next();
+        }
+        m_pDS2->close();
+      });
+    }
+
+    if (getDetails & VideoDbDetailsRating)
+    {
+      ForEachIdBatch(std::views::keys(byId), [&](const std::string& ids) {
+        m_pDS2->query(PrepareSQL("SELECT media_id, rating_type, rating, votes FROM rating "
+                                 "WHERE media_id IN (%s) AND media_type = '%s'",
+                                 ids.c_str(), mediaType.c_str()));
+        while (!m_pDS2->eof())
+        {
+          forEachMatch(byId, m_pDS2->fv(0).get_asInt(), [&](size_t index) {
+            details[index].m_ratings[m_pDS2->fv(1).get_asString()] =
+                CRating(m_pDS2->fv(2).get_asFloat(), m_pDS2->fv(3).get_asInt());
+          });
+          m_pDS2->next();
+        }
+        m_pDS2->close();
+      });
+    }
+
+    if (getDetails & VideoDbDetailsUniqueID)
+    {
+      ForEachIdBatch(std::views::keys(byId), [&](const std::string& ids) {
+        m_pDS2->query(PrepareSQL("SELECT media_id, type, value FROM uniqueid "
+                                 "WHERE media_id IN (%s) AND media_type = '%s'",
+                                 ids.c_str(), mediaType.c_str()));
+        while (!m_pDS2->eof())
+        {
+          forEachMatch(byId, m_pDS2->fv(0).get_asInt(), [&](size_t index) {
+            details[index].SetUniqueID(m_pDS2->fv(2).get_asString(),
+                                       m_pDS2->fv(1).get_asString());
+          });
+          m_pDS2->next();
+        }
+        m_pDS2->close();
+      });
+    }
+
+    if ((getDetails & VideoDbDetailsShowLink) && mediaType == MediaTypeMovie)
+    {
+      ForEachIdBatch(std::views::keys(byId), [&](const std::string& ids) {
+        m_pDS2->query(PrepareSQL("SELECT movielinktvshow.idMovie, tvshow.c%02d "
+                                 "FROM movielinktvshow "
+                                 "JOIN tvshow ON tvshow.idShow = movielinktvshow.idShow "
+                                 "WHERE movielinktvshow.idMovie IN (%s)",
+                                 VIDEODB_ID_TV_TITLE, ids.c_str()));
+        while (!m_pDS2->eof())
+        {
+          forEachMatch(byId, m_pDS2->fv(0).get_asInt(), [&](size_t index)
+                       { details[index].m_showLink.emplace_back(m_pDS2->fv(1).get_asString()); });
+          m_pDS2->next();
+        }
+        m_pDS2->close();
+      });
+    }
+
+    if ((getDetails & VideoDbDetailsStream) && !byFile.empty())
+    {
+      for (CVideoInfoTag& tag : details)
+        tag.m_streamDetails.Reset();
+
+      ForEachIdBatch(std::views::keys(byFile), [&](const std::string& ids) {
+        m_pDS2->query(
+            PrepareSQL("SELECT * FROM streamdetails WHERE idFile IN (%s)", ids.c_str()));
+        while (!m_pDS2->eof())
+        {
+          forEachMatch(byFile, m_pDS2->fv(0).get_asInt(), [&](size_t index)
+                       { AddStreamDetail(*m_pDS2, details[index].m_streamDetails); });
+          m_pDS2->next();
+        }
+        m_pDS2->close();
+      });
+
+      for (CVideoInfoTag& tag : details)
+      {
+        tag.m_streamDetails.DetermineBestStreams();
+        if (tag.m_streamDetails.GetVideoDuration() > 0)
+          tag.SetDuration(tag.m_streamDetails.GetVideoDuration());
+      }
+    }
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "({}, {} items) failed", mediaType, details.size());
+  }
+
+  for (CVideoInfoTag& tag : details)
+    tag.m_parsedDetails = getDetails;
+}
+
 bool CVideoDatabase::GetVideoSettings(const CFileItem &item, CVideoSettings &settings)
 {
   return GetVideoSettings(GetFileId(item), settings);
@@ -5292,6 +5715,43 @@ bool CVideoDatabase::GetArtForItem(int mediaId, const MediaType& mediaType, KODI
   return false;
 }
 
+bool CVideoDatabase::GetArtForItems(const std::set<int>& mediaIds,
+                                    const MediaType& mediaType,
+                                    std::map<int, KODI::ART::Artwork>& art)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS2)
+      return false;
+
+    for (const int id : mediaIds)
+      art.try_emplace(id);
+
+    ForEachIdBatch(mediaIds,
+                   [&](const std::string& ids)
+                   {
+                     m_pDS2->query(PrepareSQL("SELECT media_id, type, url FROM art "
+                                              "WHERE media_id IN (%s) AND media_type = '%s'",
+                                              ids.c_str(), mediaType.c_str()));
+                     while (!m_pDS2->eof())
+                     {
+                       art[m_pDS2->fv(0).get_asInt()].try_emplace(m_pDS2->fv(1).get_asString(),
+                                                                  m_pDS2->fv(2).get_asString());
+                       m_pDS2->next();
+                     }
+                     m_pDS2->close();
+                   });
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "({}, {} items) failed", mediaType, mediaIds.size());
+  }
+  return false;
+}
+
 bool CVideoDatabase::GetArtForAsset(int assetId,
                                     ArtFallbackOptions fallback,
                                     KODI::ART::Artwork& art)
@@ -5805,6 +6265,60 @@ void CVideoDatabase::SetStackTimes(const std::string& filePath,
   }
 }
 
+bool CVideoDatabase::GetProbeInfo(const std::string& filePath,
+                                  const std::string& key,
+                                  std::string& info)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+    const int idFile = GetFileId(filePath);
+    if (idFile < 0)
+      return false;
+
+    m_pDS->query(PrepareSQL("SELECT strInfo FROM probeinfo WHERE idFile=%i AND strKey='%s'",
+                            idFile, key.c_str()));
+    const bool found = m_pDS->num_rows() > 0;
+    if (found)
+      info = m_pDS->fv("strInfo").get_asString();
+    m_pDS->close();
+    return found;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "({}) failed", CURL::GetRedacted(filePath));
+  }
+  return false;
+}
+
+void CVideoDatabase::SetProbeInfo(const std::string& filePath,
+                                  const std::string& key,
+                                  const std::string& info)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return;
+    if (nullptr == m_pDS)
+      return;
+    const int idFile = info.empty() ? GetFileId(filePath) : AddFile(filePath);
+    if (idFile < 0)
+      return;
+
+    m_pDS->exec(PrepareSQL("DELETE FROM probeinfo WHERE idFile=%i", idFile));
+    if (!info.empty())
+      m_pDS->exec(PrepareSQL("INSERT INTO probeinfo (idFile, strKey, strInfo) VALUES (%i, '%s', '%s')",
+                             idFile, key.c_str(), info.c_str()));
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "({}) failed", CURL::GetRedacted(filePath));
+  }
+}
+
 void CVideoDatabase::RemoveContentForPath(const std::string& strPath,
                                           CGUIDialogProgress* progress /* = nullptr */)
 {
@@ -7822,6 +8336,19 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
     if (!CDatabase::BuildSQL(strSQLExtra, extFilter, strSQLExtra))
       return false;
 
+    // repeated navigation to the same node is served from the result cache
+    const uint64_t generation = GetWriteGeneration();
+    const std::string cacheKey =
+        items.IsEmpty() ? GetResultCacheKey("movies", strBaseDir, extFilter.fields + strSQLExtra,
+                                            sortDescription, sorting, getDetails)
+                        : "";
+    if (!cacheKey.empty() &&
+        CVideoDbResultCache::GetInstance().Get(cacheKey, generation, GetResultCacheAge(), items))
+      return true;
+
+    // a random pick from a large listing only reads the rows of a sample of its ids
+    total = RestrictToRandomSample(MediaTypeMovie, sorting, extFilter, strSQLExtra);
+
     // Apply the limiting directly here if there's no special sorting but limiting
     if (extFilter.limit.empty() && sorting.sortBy == SortBy::NONE &&
         (sorting.limitStart > 0 || sorting.limitEnd > 0 ||
@@ -7850,69 +8377,80 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
       return false;
 
     // get data from returned rows
-    items.Reserve(results.size());
+    std::vector<CVideoInfoTag> movies;
+    movies.reserve(results.size());
     const query_data &data = m_pDS->get_result_set().records;
     for (const auto &i : results)
     {
       const auto targetRow = static_cast<unsigned int>(i.at(Field::ROW).asInteger());
       const dbiplus::sql_record* const record = data.at(targetRow);
 
-      CVideoInfoTag movie = GetDetailsForMovie(record, getDetails);
+      CVideoInfoTag movie = GetDetailsForMovie(record, VideoDbDetailsNone);
       if (m_profileManager.GetMasterProfile().getLockMode() == LockMode::EVERYONE ||
           g_passwordManager.bMasterUser ||
           g_passwordManager.IsDatabasePathUnlocked(
               movie.m_strPath, *CMediaSourceSettings::GetInstance().GetSources("video")))
+        movies.emplace_back(std::move(movie));
+    }
+
+    // cleanup
+    m_pDS->close();
+
+    // the side tables of all listed movies at once instead of a set of queries per movie
+    GetBulkDetails(movies, MediaTypeMovie, getDetails);
+
+    items.Reserve(movies.size());
+    for (CVideoInfoTag& movie : movies)
+    {
+      const auto item{std::make_shared<CFileItem>(movie)};
+
+      std::string path;
+      CVideoDbUrl itemUrl{videoUrl};
+      if (videoVersionNav)
       {
-        const auto item{std::make_shared<CFileItem>(movie)};
+        itemUrl.AppendPath(std::to_string(movie.m_iDbId));
+      }
+      else if (assetsNav)
+      {
+        // Display the name of the movie for a collection of movie assets rather than "Assets"
+        if (!items.HasProperty("customtitle"))
+          items.SetProperty("customtitle", movie.GetTitle());
 
-        std::string path;
-        CVideoDbUrl itemUrl{videoUrl};
-        if (videoVersionNav)
-        {
-          itemUrl.AppendPath(std::to_string(movie.m_iDbId));
-        }
-        else if (assetsNav)
-        {
-          // Display the name of the movie for a collection of movie assets rather than "Assets"
-          if (!items.HasProperty("customtitle"))
-            items.SetProperty("customtitle", movie.GetTitle());
+        if (movie.IsDefaultVideoVersion())
+          item->Select(true);
 
-          if (movie.IsDefaultVideoVersion())
-            item->Select(true);
+        itemUrl.AppendPath(std::to_string(movie.m_iFileId));
 
-          itemUrl.AppendPath(std::to_string(movie.m_iFileId));
+        // Adjust item fields
+        // Use asset name as label instead of the movie name
+        item->SetLabel(movie.GetAssetInfo().GetTitle());
+      }
+      else
+      {
+        itemUrl.AppendPath(std::to_string(movie.m_iDbId));
 
-          // Adjust item fields
-          // Use asset name as label instead of the movie name
-          item->SetLabel(movie.GetAssetInfo().GetTitle());
-        }
-        else
+        // Turn a movie with versions or extras into a folder item that navigates to a list of
+        // the versions and a virtual Extras folder (special assetType -2 value).
+        if (movie.HasVideoVersions() || movie.HasVideoExtras())
         {
-          itemUrl.AppendPath(std::to_string(movie.m_iDbId));
-
-          // Turn a movie with versions or extras into a folder item that navigates to a list of
-          // the versions and a virtual Extras folder (special assetType -2 value).
-          if (movie.HasVideoVersions() || movie.HasVideoExtras())
-          {
-            static std::string hybridFolderPath{
-                std::to_string(static_cast<int>(VideoAssetType::VERSIONSANDEXTRASFOLDER)) + "/"};
-            item->SetProperty("IsHybridFolder", true);
-            item->SetFolder(true);
-            itemUrl.AppendPath(hybridFolderPath);
-          }
+          static std::string hybridFolderPath{
+              std::to_string(static_cast<int>(VideoAssetType::VERSIONSANDEXTRASFOLDER)) + "/"};
+          item->SetProperty("IsHybridFolder", true);
+          item->SetFolder(true);
+          itemUrl.AppendPath(hybridFolderPath);
         }
+      }
 
-        item->SetPath(itemUrl.ToString());
-        item->SetDynPath(std::move(movie.m_strFileNameAndPath));
+      item->SetPath(itemUrl.ToString());
+      item->SetDynPath(std::move(movie.m_strFileNameAndPath));
 
-        item->SetOverlayImage(movie.GetPlayCount() > 0 ? CGUIListItem::ICON_OVERLAY_WATCHED
-                                                       : CGUIListItem::ICON_OVERLAY_UNWATCHED);
-        items.Add(item);
-      }
+      item->SetOverlayImage(movie.GetPlayCount() > 0 ? CGUIListItem::ICON_OVERLAY_WATCHED
+                                                     : CGUIListItem::ICON_OVERLAY_UNWATCHED);
+      items.Add(item);
     }
 
-    // cleanup
-    m_pDS->close();
+    if (!cacheKey.empty())
+      CVideoDbResultCache::GetInstance().Set(cacheKey, generation, items);
     return true;
   }
   catch (...)
@@ -7968,6 +8506,19 @@ bool CVideoDatabase::GetTvShowsByWhere(const std::string& strBaseDir, const Filt
     if (!BuildSQL(strBaseDir, strSQLExtra, extFilter, strSQLExtra, videoUrl, sorting))
       return false;
 
+    // repeated navigation to the same node is served from the result cache
+    const uint64_t generation = GetWriteGeneration();
+    const std::string cacheKey =
+        items.IsEmpty() ? GetResultCacheKey("tvshows", strBaseDir, extFilter.fields + strSQLExtra,
+                                            sortDescription, sorting, getDetails)
+                        : "";
+    if (!cacheKey.empty() &&
+        CVideoDbResultCache::GetInstance().Get(cacheKey, generation, GetResultCacheAge(), items))
+      return true;
+
+    // a random pick from a large listing only reads the rows of a sample of its ids
+    total = RestrictToRandomSample(MediaTypeTvShow, sorting, extFilter, strSQLExtra);
+
     // Apply the limiting directly here if there's no special sorting but limiting
     if (extFilter.limit.empty() && sorting.sortBy == SortBy::NONE &&
         (sorting.limitStart > 0 || sorting.limitEnd > 0 ||
@@ -7995,7 +8546,10 @@ bool CVideoDatabase::GetTvShowsByWhere(const std::string& strBaseDir, const Filt
       return false;
 
     // get data from returned rows
-    items.Reserve(results.size());
+    std::vector<CVideoInfoTag> shows;
+    std::vector<std::pair<std::shared_ptr<CFileItem>, int>> showItems;
+    shows.reserve(results.size());
+    showItems.reserve(results.size());
     const query_data &data = m_pDS->get_result_set().records;
     for (const auto &i : results)
     {
@@ -8003,29 +8557,43 @@ bool CVideoDatabase::GetTvShowsByWhere(const std::string& strBaseDir, const Filt
       const dbiplus::sql_record* const record = data.at(targetRow);
 
       auto pItem = std::make_shared<CFileItem>();
-      CVideoInfoTag movie = GetDetailsForTvShow(record, getDetails, pItem.get());
+      CVideoInfoTag show = GetDetailsForTvShow(record, VideoDbDetailsNone, pItem.get());
       if (m_profileManager.GetMasterProfile().getLockMode() == LockMode::EVERYONE ||
           g_passwordManager.bMasterUser ||
           g_passwordManager.IsDatabasePathUnlocked(
-              movie.m_strPath, *CMediaSourceSettings::GetInstance().GetSources("video")))
+              show.m_strPath, *CMediaSourceSettings::GetInstance().GetSources("video")))
       {
-        pItem->SetFromVideoInfoTag(movie);
-
-        CVideoDbUrl itemUrl = videoUrl;
-        std::string path = StringUtils::Format("{}/", record->at(0).get_asInt());
-        itemUrl.AppendPath(path);
-        pItem->SetPath(itemUrl.ToString());
-
-        pItem->SetOverlayImage((pItem->GetVideoInfoTag()->GetPlayCount() > 0) &&
-                                       (pItem->GetVideoInfoTag()->m_iEpisode > 0)
-                                   ? CGUIListItem::ICON_OVERLAY_WATCHED
-                                   : CGUIListItem::ICON_OVERLAY_UNWATCHED);
-        items.Add(std::move(pItem));
+        shows.emplace_back(std::move(show));
+        showItems.emplace_back(std::move(pItem), record->at(0).get_asInt());
       }
     }
 
     // cleanup
     m_pDS->close();
+
+    // the side tables of all listed shows at once instead of a set of queries per show
+    GetBulkDetails(shows, MediaTypeTvShow, getDetails);
+
+    items.Reserve(shows.size());
+    for (size_t i = 0; i < shows.size(); ++i)
+    {
+      auto& [pItem, idShow] = showItems[i];
+      pItem->SetFromVideoInfoTag(shows[i]);
+
+      CVideoDbUrl itemUrl = videoUrl;
+      std::string path = StringUtils::Format("{}/", idShow);
+      itemUrl.AppendPath(path);
+      pItem->SetPath(itemUrl.ToString());
+
+      pItem->SetOverlayImage((pItem->GetVideoInfoTag()->GetPlayCount() > 0) &&
+                                     (pItem->GetVideoInfoTag()->m_iEpisode > 0)
+                                 ? CGUIListItem::ICON_OVERLAY_WATCHED
+                                 : CGUIListItem::ICON_OVERLAY_UNWATCHED);
+      items.Add(std::move(pItem));
+    }
+
+    if (!cacheKey.empty())
+      CVideoDbResultCache::GetInstance().Set(cacheKey, generation, items);
     return true;
   }
   catch (...)
@@ -8097,6 +8665,9 @@ bool CVideoDatabase::GetEpisodesByWhere(const std::string& strBaseDir, const Fil
     if (!BuildSQL(strBaseDir, strSQLExtra, extFilter, strSQLExtra, videoUrl, sorting))
       return false;
 
+    // a random pick from a large listing only reads the rows of a sample of its ids
+    total = RestrictToRandomSample(MediaTypeEpisode, sorting, extFilter, strSQLExtra);
+
     // Apply the limiting directly here if there's no special sorting but limiting
     if (extFilter.limit.empty() && sorting.sortBy == SortBy::NONE &&
         (sorting.limitStart > 0 || sorting.limitEnd > 0 ||
@@ -8174,6 +8745,179 @@ bool CVideoDatabase::GetEpisodesByWhere(const std::string& strBaseDir, const Fil
   return false;
 }
 
+bool CVideoDatabase::CanGetByWhereJSON(const MediaType& mediaType,
+                                       const std::set<std::string, std::less<>>& fields)
+{
+  if (mediaType != MediaTypeMovie && mediaType != MediaTypeTvShow && mediaType != MediaTypeEpisode)
+    return false;
+
+  return std::ranges::all_of(fields, [&mediaType](const std::string& field)
+                             { return FindJSONVideoField(mediaType, field) != nullptr; });
+}
+
+bool CVideoDatabase::GetMoviesByWhereJSON(const std::set<std::string, std::less<>>& fields,
+                                          const std::string& baseDir,
+                                          CVariant& result,
+                                          int& total,
+                                          const SortDescription& sortDescription)
+{
+  return GetVideosByWhereJSON(MediaTypeMovie, fields, baseDir, result, total, sortDescription);
+}
+
+bool CVideoDatabase::GetTvShowsByWhereJSON(const std::set<std::string, std::less<>>& fields,
+                                           const std::string& baseDir,
+                                           CVariant& result,
+                                           int& total,
+                                           const SortDescription& sortDescription)
+{
+  return GetVideosByWhereJSON(MediaTypeTvShow, fields, baseDir, result, total, sortDescription);
+}
+
+bool CVideoDatabase::GetEpisodesByWhereJSON(const std::set<std::string, std::less<>>& fields,
+                                            const std::string& baseDir,
+                                            CVariant& result,
+                                            int& total,
+                                            const SortDescription& sortDescription)
+{
+  return GetVideosByWhereJSON(MediaTypeEpisode, fields, baseDir, result, total, sortDescription);
+}
+
+bool CVideoDatabase::GetVideosByWhereJSON(const MediaType& mediaType,
+                                          const std::set<std::string, std::less<>>& fields,
+                                          const std::string& baseDir,
+                                          CVariant& result,
+                                          int& total,
+                                          const SortDescription& sortDescription)
+{
+  try
+  {
+    if (nullptr == m_pDB)
+      return false;
+    if (nullptr == m_pDS)
+      return false;
+
+    std::string view;
+    std::string idField;
+    std::string resultName;
+    if (mediaType == MediaTypeMovie)
+    {
+      view = "movie_view";
+      idField = "movieid";
+      resultName = "movies";
+    }
+    else if (mediaType == MediaTypeTvShow)
+    {
+      view = "tvshow_view";
+      idField = "tvshowid";
+      resultName = "tvshows";
+    }
+    else if (mediaType == MediaTypeEpisode)
+    {
+      view = "episode_view";
+      idField = "episodeid";
+      resultName = "episodes";
+    }
+    else
+      return false;
+
+    std::vector<const JSONVideoField*> requested;
+    requested.reserve(fields.size());
+    for (const std::string& field : fields)
+    {
+      const JSONVideoField* jsonField = FindJSONVideoField(mediaType, field);
+      if (!jsonField)
+        return false;
+      requested.emplace_back(jsonField);
+    }
+
+    total = -1;
+
+    std::string strSQL = "SELECT %s FROM " + view + " ";
+    CVideoDbUrl videoUrl;
+    std::string strSQLExtra;
+    Filter extFilter;
+    SortDescription sorting = sortDescription;
+    if (!BuildSQL(baseDir, strSQLExtra, extFilter, strSQLExtra, videoUrl, sorting))
+      return false;
+
+    // a random pick from a large listing only reads the rows of a sample of its ids
+    total = RestrictToRandomSample(mediaType, sorting, extFilter, strSQLExtra);
+
+    // Apply the limiting directly here if there's no special sorting but limiting
+    if (extFilter.limit.empty() && sorting.sortBy == SortBy::NONE &&
+        (sorting.limitStart > 0 || sorting.limitEnd > 0 ||
+         (sorting.limitStart == 0 && sorting.limitEnd == 0)))
+    {
+      total = GetSingleValueInt(PrepareSQL(strSQL, "COUNT(1)") + strSQLExtra, *m_pDS);
+      strSQLExtra += DatabaseUtils::BuildLimitClause(sorting.limitEnd, sorting.limitStart);
+    }
+
+    // the view columns are still needed as a whole, sorting reads them by position
+    strSQL = PrepareSQL(strSQL, !extFilter.fields.empty() ? extFilter.fields.c_str() : "*") +
+             strSQLExtra;
+
+    int iRowsFound = RunQuery(strSQL);
+
+    if (total < iRowsFound)
+      total = iRowsFound;
+
+    CVariant& items = result[resultName];
+    items = CVariant(CVariant::VariantTypeArray);
+
+    if (iRowsFound <= 0)
+      return iRowsFound == 0;
+
+    // same sorting as GetMoviesByWhere(), which ignores the order of smart playlists
+    DatabaseResults results;
+    results.reserve(iRowsFound);
+    if (!SortUtils::SortFromDataset(mediaType == MediaTypeMovie ? sortDescription : sorting,
+                                    mediaType, *m_pDS, results))
+      return false;
+
+    const bool checkLocks =
+        m_profileManager.GetMasterProfile().getLockMode() != LockMode::EVERYONE &&
+        !g_passwordManager.bMasterUser;
+
+    items.reserve(results.size());
+    const query_data& data = m_pDS->get_result_set().records;
+    for (const auto& i : results)
+    {
+      const auto targetRow = static_cast<unsigned int>(i.at(Field::ROW).asInteger());
+      const dbiplus::sql_record* const record = data.at(targetRow);
+
+      // only the row itself is parsed, none of the requested fields needs the side tables
+      CVideoInfoTag tag;
+      if (mediaType == MediaTypeMovie)
+        tag = GetDetailsForMovie(record, VideoDbDetailsNone);
+      else if (mediaType == MediaTypeTvShow)
+        tag = GetDetailsForTvShow(record, VideoDbDetailsNone);
+      else
+        tag = GetDetailsForEpisode(record, VideoDbDetailsNone);
+
+      if (checkLocks &&
+          !g_passwordManager.IsDatabasePathUnlocked(
+              tag.m_strPath, *CMediaSourceSettings::GetInstance().GetSources("video")))
+        continue;
+
+      CVariant object(CVariant::VariantTypeObject);
+      for (const JSONVideoField* field : requested)
+        object[std::string(field->name)] = field->get(tag, *record);
+      object[idField] = tag.m_iDbId;
+      object["label"] = mediaType == MediaTypeEpisode ? GetEpisodeLabel(tag) : tag.m_strTitle;
+      items.push_back(std::move(object));
+    }
+
+    // cleanup
+    m_pDS->close();
+    return true;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+  }
+  return false;
+}
+
 bool CVideoDatabase::GetMusicVideosNav(const std::string& strBaseDir, CFileItemList& items, int idGenre, int idYear, int idArtist, int idDirector, int idStudio, int idAlbum, int idTag /* = -1 */, const SortDescription &sortDescription /* = SortDescription() */, int getDetails /* = VideoDbDetailsNone */)
 {
   CVideoDbUrl videoUrl;
@@ -9114,6 +9858,9 @@ bool CVideoDatabase::GetMusicVideosByWhere(const std::string &baseDir, const Fil
     if (!BuildSQL(baseDir, strSQLExtra, extFilter, strSQLExtra, videoUrl, sorting))
       return false;
 
+    // a random pick from a large listing only reads the rows of a sample of its ids
+    total = RestrictToRandomSample(MediaTypeMusicVideo, sorting, extFilter, strSQLExtra);
+
     // Apply the limiting directly here if there's no special sorting but limiting
     if (extFilter.limit.empty() && sorting.sortBy == SortBy::NONE &&
         (sorting.limitStart > 0 || sorting.limitEnd > 0 ||
@@ -10339,6 +11086,10 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
       CDirectory::Create(tvshowsDir);
     }
 
+    CXMLStreamWriter xmlWriter;
+    if (singleFile && !xmlWriter.Open(xmlFile, "videodb"))
+      return;
+
     // Need this due to query clashes in GetFile/GetPath
     std::unique_ptr<Dataset> pDS3;
     pDS3.reset(m_pDB->CreateDataset());
@@ -10384,6 +11135,7 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
     int current = 0;
 
     // create our xml document
+    // a single file is written item by item, pMain only holds the item being exported
     CXBMCTinyXML xmlDoc;
     TiXmlDeclaration decl("1.0", "UTF-8", "yes");
     xmlDoc.InsertEndChild(decl);
@@ -10395,6 +11147,7 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
       TiXmlElement xmlMainElement("videodb");
       pMain = xmlDoc.InsertEndChild(xmlMainElement);
       XMLUtils::SetInt(pMain,"version", GetExportVersion());
+      xmlWriter.Flush(*pMain);
     }
 
     // Save information for each version
@@ -10564,6 +11317,8 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
         xmlDoc.InsertEndChild(decl1);
         pMain = &xmlDoc;
       }
+      else
+        xmlWriter.Flush(*pMain);
     }
     pDS3->close();
 
@@ -10637,6 +11392,8 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
             TiXmlDeclaration decl1("1.0", "UTF-8", "yes");
             xmlDoc.InsertEndChild(decl1);
           }
+          else
+            xmlWriter.Flush(*pMain);
 
           // Write images to MSIF
           if (images)
@@ -10735,6 +11492,8 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
         TiXmlDeclaration decl2("1.0", "UTF-8", "yes");
         xmlDoc.InsertEndChild(decl2);
       }
+      else
+        xmlWriter.Flush(*pMain);
       if (images && !bSkip)
       {
         if (singleFile)
@@ -10982,6 +11741,10 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
         }
       }
 
+      // the episodes are written with their show
+      if (singleFile)
+        xmlWriter.Flush(*pMain);
+
       pDS->close();
       pDS2->next();
       current++;
@@ -11017,7 +11780,9 @@ void CVideoDatabase::ExportToXML(const std::string &path, bool singleFile /* = t
           XMLUtils::SetString(pPath,"scraperpath", info->ID());
         }
       }
-      xmlDoc.SaveFile(xmlFile);
+      xmlWriter.Flush(*pMain);
+      if (!xmlWriter.Close())
+        iFailCount++;
     }
     CVariant data;
 
@@ -11423,10 +12188,15 @@ bool CVideoDatabase::CommitTransaction()
 {
   if (CDatabase::CommitTransaction())
   { // number of items in the db has likely changed, so recalculate
-    GUIINFO::CLibraryGUIInfo& guiInfo = CServiceBroker::GetGUI()->GetInfoManager().GetInfoProviders().GetLibraryInfoProvider();
-    guiInfo.SetLibraryBool(LIBRARY_HAS_MOVIES, HasContent(VideoDbContentType::MOVIES));
-    guiInfo.SetLibraryBool(LIBRARY_HAS_TVSHOWS, HasContent(VideoDbContentType::TVSHOWS));
-    guiInfo.SetLibraryBool(LIBRARY_HAS_MUSICVIDEOS, HasContent(VideoDbContentType::MUSICVIDEOS));
+    CGUIComponent* gui = CServiceBroker::GetGUI();
+    if (gui)
+    {
+      GUIINFO::CLibraryGUIInfo& guiInfo =
+          gui->GetInfoManager().GetInfoProviders().GetLibraryInfoProvider();
+      guiInfo.SetLibraryBool(LIBRARY_HAS_MOVIES, HasContent(VideoDbContentType::MOVIES));
+      guiInfo.SetLibraryBool(LIBRARY_HAS_TVSHOWS, HasContent(VideoDbContentType::TVSHOWS));
+      guiInfo.SetLibraryBool(LIBRARY_HAS_MUSICVIDEOS, HasContent(VideoDbContentType::MUSICVIDEOS));
+    }
     return true;
   }
   return false;
@@ -12831,55 +13601,7 @@ std::vector<std::string> CVideoDatabase::GetUsedImages(
     sql.pop_back(); // remove last ','
     sql += ")";
 
-    // add arttype filters if not set to "Maximum"
-    if (artworkLevel != CSettings::VIDEOLIBRARY_ARTWORK_LEVEL_ALL)
-    {
-      static std::array<std::string, 7> mediatypes = {
-          MediaTypeEpisode,         MediaTypeTvShow,     MediaTypeSeason,      MediaTypeMovie,
-          MediaTypeVideoCollection, MediaTypeMusicVideo, MediaTypeVideoVersion};
-
-      std::string arttypeSQL;
-      for (const auto& mediatype : mediatypes)
-      {
-        const auto& arttypes = CVideoThumbLoader::GetArtTypes(mediatype);
-        if (arttypes.empty())
-          continue;
-
-        if (!arttypeSQL.empty())
-          arttypeSQL += ") OR ";
-        arttypeSQL += PrepareSQL("media_type = '%s' AND (", mediatype.c_str());
-        bool workingNext = false;
-        for (const auto& arttype : arttypes)
-        {
-          if (workingNext)
-            arttypeSQL += " OR ";
-          workingNext = true;
-          if (artworkLevel == CSettings::VIDEOLIBRARY_ARTWORK_LEVEL_BASIC)
-          {
-            // for basic match exact artwork type
-            arttypeSQL += PrepareSQL("type = '%s'", arttype.c_str());
-          }
-          else
-          {
-            // otherwise check for arttype 'families', like fanart, fanart1, fanart13;
-            // still avoid most "happens to start with" like fanartstuff
-            arttypeSQL +=
-                PrepareSQL("type BETWEEN '%s' AND '%s999'", arttype.c_str(), arttype.c_str());
-          }
-        }
-      }
-
-      if (CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
-              CSettings::SETTING_VIDEOLIBRARY_ACTORTHUMBS))
-      {
-        if (!arttypeSQL.empty())
-          arttypeSQL += ") OR ";
-        arttypeSQL += "media_type = 'actor'";
-      }
-
-      if (!arttypeSQL.empty())
-        sql += " AND (" + arttypeSQL + ")";
-    }
+    sql += GetArtworkLevelFilter(artworkLevel);
 
     std::vector<std::string> result;
     if (m_pDS->query(sql))
@@ -12892,16 +13614,19 @@ std::vector<std::string> CVideoDatabase::GetUsedImages(
       m_pDS->close();
     }
 
-    // then check any chapter thumbnails against path and file tables
+    // then check any chapter thumbnails and seek preview strips against path and file tables
+    // the preview tiles are left to the cleaner, they are cut from the strips again quickly
 
-    if (CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
-            CSettings::SETTING_MYVIDEOS_EXTRACTCHAPTERTHUMBS))
+    const bool chapterThumbs = CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+        CSettings::SETTING_MYVIDEOS_EXTRACTCHAPTERTHUMBS);
     {
       std::vector<std::string> foundVideoFiles;
       for (const auto& image : imagesToCheck)
       {
         auto imageFile = IMAGE_FILES::CImageFileURL(image);
-        if (imageFile.GetSpecialType() == "video" && !imageFile.GetOption("chapter").empty())
+        if (imageFile.GetSpecialType() == "video" &&
+            ((chapterThumbs && !imageFile.GetOption("chapter").empty()) ||
+             !imageFile.GetOption("seekstrip").empty()))
         {
           const auto& target = imageFile.GetTargetFile();
           const auto quickFind = std::ranges::find(foundVideoFiles, target);
@@ -12931,6 +13656,94 @@ std::vector<std::string> CVideoDatabase::GetUsedImages(
   return {};
 }
 
+std::vector<std::string> CVideoDatabase::GetArtURLs()
+{
+  try
+  {
+    if (!m_pDB || !m_pDS)
+      return {};
+
+    int artworkLevel = CServiceBroker::GetSettingsComponent()->GetSettings()->GetInt(
+        CSettings::SETTING_VIDEOLIBRARY_ARTWORK_LEVEL);
+    if (artworkLevel == CSettings::VIDEOLIBRARY_ARTWORK_LEVEL_NONE)
+      return {};
+
+    std::string sql = "SELECT DISTINCT url FROM art WHERE url <> ''";
+    sql += GetArtworkLevelFilter(artworkLevel);
+
+    std::vector<std::string> result;
+    if (m_pDS->query(sql))
+    {
+      while (!m_pDS->eof())
+      {
+        result.emplace_back(m_pDS->fv(0).get_asString());
+        m_pDS->next();
+      }
+      m_pDS->close();
+    }
+    return result;
+  }
+  catch (...)
+  {
+    CLog::LogF(LOGERROR, "failed");
+  }
+  return {};
+}
+
+std::string CVideoDatabase::GetArtworkLevelFilter(int artworkLevel) const
+{
+  // add arttype filters if not set to "Maximum"
+  if (artworkLevel != CSettings::VIDEOLIBRARY_ARTWORK_LEVEL_ALL)
+  {
+    static std::array<std::string, 7> mediatypes = {
+        MediaTypeEpisode,         MediaTypeTvShow,     MediaTypeSeason,      MediaTypeMovie,
+        MediaTypeVideoCollection, MediaTypeMusicVideo, MediaTypeVideoVersion};
+
+    std::string arttypeSQL;
+    for (const auto& mediatype : mediatypes)
+    {
+      const auto& arttypes = CVideoThumbLoader::GetArtTypes(mediatype);
+      if (arttypes.empty())
+        continue;
+
+      if (!arttypeSQL.empty())
+        arttypeSQL += ") OR ";
+      arttypeSQL += PrepareSQL("media_type = '%s' AND (", mediatype.c_str());
+      bool workingNext = false;
+      for (const auto& arttype : arttypes)
+      {
+        if (workingNext)
+          arttypeSQL += " OR ";
+        workingNext = true;
+        if (artworkLevel == CSettings::VIDEOLIBRARY_ARTWORK_LEVEL_BASIC)
+        {
+          // for basic match exact artwork type
+          arttypeSQL += PrepareSQL("type = '%s'", arttype.c_str());
+        }
+        else
+        {
+          // otherwise check for arttype 'families', like fanart, fanart1, fanart13;
+          // still avoid most "happens to start with" like fanartstuff
+          arttypeSQL +=
+              PrepareSQL("type BETWEEN '%s' AND '%s999'", arttype.c_str(), arttype.c_str());
+        }
+      }
+    }
+
+    if (CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+            CSettings::SETTING_VIDEOLIBRARY_ACTORTHUMBS))
+    {
+      if (!arttypeSQL.empty())
+        arttypeSQL += ") OR ";
+      arttypeSQL += "media_type = 'actor'";
+    }
+
+    if (!arttypeSQL.empty())
+      return " AND (" + arttypeSQL + ")";
+  }
+  return {};
+}
+
 void CVideoDatabase::SetTrailerForMovie(int idMovie, const std::string& trailer)
 {
   SetSingleValue(VideoDbContentType::MOVIES, VIDEODB_ID_TRAILER, idMovie, trailer);
@@ -18,6 +18,7 @@
 
 #include <array>
 #include <functional>
+#include <map>
 #include <memory>
 #include <set>
 #include <stdexcept>
@@ -35,6 +36,7 @@ class CStreamDetails;
 class CVideoSettings;
 class CGUIDialogProgress;
 class CGUIDialogProgressBarHandle;
+class CVariant;
 class TiXmlNode;
 
 struct VideoAssetInfo;
@@ -501,6 +503,21 @@ public:
   void SetStackTimes(const std::string& filePath,
                      const std::vector<std::chrono::milliseconds>& times);
 
+  /*! \brief Get the cached demuxer probe result of a file
+   \param filePath path of the file
+   \param key identifies the state of the file the result was taken from, its size and mtime
+   \param info [out] the probe result
+   \return true if there is a result for this key, false otherwise
+   */
+  bool GetProbeInfo(const std::string& filePath, const std::string& key, std::string& info);
+
+  /*! \brief Store the demuxer probe result of a file, replacing any older one
+   \param filePath path of the file
+   \param key identifies the state of the file the result was taken from, its size and mtime
+   \param info the probe result, an empty one removes the cached result
+   */
+  void SetProbeInfo(const std::string& filePath, const std::string& key, const std::string& info);
+
   void GetBookMarksForFile(const std::string& strFilenameAndPath, VECBOOKMARKS& bookmarks, CBookmark::EType type = CBookmark::STANDARD, bool bAppend=false, long partNumber=0);
   bool AddBookMarkToFile(const std::string& strFilenameAndPath,
                          const CBookmark& bookmark,
@@ -521,6 +538,14 @@ public:
   bool GetStreamDetails(CFileItem& item);
   bool GetStreamDetails(CVideoInfoTag& tag);
   bool GetStreamDetails(const std::string& filenameAndPath, CStreamDetails& details);
+
+  /*! \brief Get the stream details of several files with one query per batch of files.
+   \param fileIds the files to look up, files without stream details get empty details
+   \param details [out] the stream details by file id
+   \return true on success
+   */
+  bool GetStreamDetailsForFiles(const std::set<int>& fileIds,
+                                std::map<int, CStreamDetails>& details);
   bool GetDetailsByTypeAndId(CFileItem& item, VideoDbContentType type, int id);
   CVideoInfoTag GetDetailsByTypeAndId(VideoDbContentType type, int id);
 
@@ -793,6 +818,31 @@ public:
   bool GetEpisodesByWhere(const std::string& strBaseDir, const Filter &filter, CFileItemList& items, bool appendFullShowPath = true, const SortDescription &sortDescription = SortDescription(), int getDetails = VideoDbDetailsNone);
   bool GetMusicVideosByWhere(const std::string &baseDir, const Filter &filter, CFileItemList& items, bool checkLocks = true, const SortDescription &sortDescription = SortDescription(), int getDetails = VideoDbDetailsNone);
 
+  /////////////////////////////////////////////////
+  // JSON-RPC
+  /////////////////////////////////////////////////
+  /*! \brief Whether GetMoviesByWhereJSON() and friends can provide all the given fields.
+   Fields needing side tables, art or stream details are only available through the file item
+   listings.
+   */
+  static bool CanGetByWhereJSON(const MediaType& mediaType,
+                                const std::set<std::string, std::less<>>& fields);
+  bool GetMoviesByWhereJSON(const std::set<std::string, std::less<>>& fields,
+                            const std::string& baseDir,
+                            CVariant& result,
+                            int& total,
+                            const SortDescription& sortDescription);
+  bool GetTvShowsByWhereJSON(const std::set<std::string, std::less<>>& fields,
+                             const std::string& baseDir,
+                             CVariant& result,
+                             int& total,
+                             const SortDescription& sortDescription);
+  bool GetEpisodesByWhereJSON(const std::set<std::string, std::less<>>& fields,
+                              const std::string& baseDir,
+                              CVariant& result,
+                              int& total,
+                              const SortDescription& sortDescription);
+
   // retrieve sorted and limited items
   bool GetSortedVideos(const MediaType &mediaType, const std::string& strBaseDir, const SortDescription &sortDescription, CFileItemList& items, const Filter &filter = Filter());
 
@@ -840,6 +890,16 @@ public:
   bool GetArtForItem(int mediaId, const MediaType& mediaType, KODI::ART::Artwork& art);
   std::string GetArtForItem(int mediaId, const MediaType &mediaType, const std::string &artType);
 
+  /*! \brief Get the art of several items of one media type with one query per batch of items.
+   \param mediaIds the items to look up, items without art get an empty entry
+   \param mediaType the media type of the items
+   \param art [out] the art by item id
+   \return true on success
+   */
+  bool GetArtForItems(const std::set<int>& mediaIds,
+                      const MediaType& mediaType,
+                      std::map<int, KODI::ART::Artwork>& art);
+
   void UpdateArtForItem(int mediaId, const MediaType& mediaType) const;
 
   /*!
@@ -1038,6 +1098,13 @@ public:
    */
   std::vector<std::string> GetUsedImages(const std::vector<std::string>& imagesToCheck);
 
+  /*!
+   * @brief Get the distinct art URLs of the library, limited to the configured artwork level.
+   * Used to pre-cache the library images.
+   * @return the art URLs.
+   */
+  std::vector<std::string> GetArtURLs();
+
   /*! \brief Find a playlist path for a removable bluray disc.
    \param originalPath A path in the format of bluray://removable://<title_ID>/BDMV/index.bdmv
    \return A path in the format of bluray://removable://<title_ID>/BDMV/PLAYLIST/00000.mpls if found, otherwise an empty string.
@@ -1150,6 +1217,27 @@ protected:
   void GetRatings(int media_id, const std::string &media_type, RatingMap &ratings);
   void GetUniqueIDs(int media_id, const std::string &media_type, CVideoInfoTag& details);
 
+  /*! \brief Load the details of the side tables for a whole listing.
+   Same result as passing getDetails to the GetDetailsFor* functions, but with one query per
+   table and batch of items instead of one per table and item.
+   \param details tags with m_iDbId and m_iFileId set
+   \param mediaType media type of all the tags
+   \param getDetails VideoDbDetails flags to load
+   */
+  void GetBulkDetails(std::vector<CVideoInfoTag>& details,
+                      const MediaType& mediaType,
+                      int getDetails);
+
+  /*! \brief Write the requested fields of the listed items straight from the view rows.
+   \sa CanGetByWhereJSON()
+   */
+  bool GetVideosByWhereJSON(const MediaType& mediaType,
+                            const std::set<std::string, std::less<>>& fields,
+                            const std::string& baseDir,
+                            CVariant& result,
+                            int& total,
+                            const SortDescription& sortDescription);
+
   template<typename T>
   void GetDetailsFromDB(const dbiplus::sql_record* const record,
                         int min,
@@ -1190,6 +1278,12 @@ private:
    */
   int GetDbId(const std::string& query) const;
 
+  /*! \brief Get the SQL limiting the art table to the art types of the given artwork level
+   \param artworkLevel the videolibrary.artworklevel setting
+   \return " AND (...)" to append to a query, empty to keep all art
+   */
+  std::string GetArtworkLevelFilter(int artworkLevel) const;
+
   /*! \brief Run a query on the main dataset and return the number of rows
    If no rows are found we close the dataset and return 0.
    \param sql the sql query to run
@@ -1197,6 +1291,31 @@ private:
    */
   int RunQuery(const std::string &sql);
 
+  /*! \brief Key of a listing in the result cache, empty if the listing can't be cached.
+   Listings filtered by locked sources are never cached.
+   \param type type of the listing (movies, tvshows)
+   \param query the complete SQL of the listing without limit
+   */
+  std::string GetResultCacheKey(std::string_view type,
+                                const std::string& strBaseDir,
+                                const std::string& query,
+                                const SortDescription& sortDescription,
+                                const SortDescription& sorting,
+                                int getDetails) const;
+
+  /*! \brief Restrict a random listing with a limit to a random sample of its ids.
+   \sa CDatabase::RestrictToRandomIds
+   \param mediaType type of the items listed
+   \param sorting the sorting of the listing
+   \param filter the filter of the listing, restricted to the sample
+   \param strSQLExtra the SQL built from the filter, built again when restricted
+   \return the number of items of the listing, -1 if it isn't a random listing with a limit
+   */
+  int RestrictToRandomSample(const MediaType& mediaType,
+                             const SortDescription& sorting,
+                             Filter& filter,
+                             std::string& strSQLExtra) const;
+
   void AppendIdLinkFilter(const char* field,
                           const char* table,
                           const MediaType& mediaType,
@@ -147,6 +147,7 @@ constexpr int VIDEODB_TYPE_COUNT        = 5;
 constexpr int VIDEODB_TYPE_STRINGARRAY  = 6;
 constexpr int VIDEODB_TYPE_DATE         = 7;
 constexpr int VIDEODB_TYPE_DATETIME     = 8;
+constexpr int VIDEODB_TYPE_SHAREDSTRINGARRAY = 9; // CSharedStringList
 // clang-format on
 
 enum VIDEODB_IDS // this enum MUST match the offset struct further down!! and make sure to keep min and max at -1 and sizeof(offsets)
@@ -202,14 +203,14 @@ const std::array<SDbTableOffsets, DB_MOVIE_OFFSETS_SIZE> DbMovieOffsets = {{
     {VIDEODB_TYPE_INT, my_offsetof(CVideoInfoTag, m_duration)},
     {VIDEODB_TYPE_STRING, my_offsetof(CVideoInfoTag, m_strMPAARating)},
     {VIDEODB_TYPE_INT, my_offsetof(CVideoInfoTag, m_iTop250)},
-    {VIDEODB_TYPE_STRINGARRAY, my_offsetof(CVideoInfoTag, m_genre)},
+    {VIDEODB_TYPE_SHAREDSTRINGARRAY, my_offsetof(CVideoInfoTag, m_genre)},
     {VIDEODB_TYPE_STRINGARRAY, my_offsetof(CVideoInfoTag, m_director)},
     {VIDEODB_TYPE_STRING, my_offsetof(CVideoInfoTag, m_strOriginalTitle)},
     {VIDEODB_TYPE_UNUSED, 0}, // unused
-    {VIDEODB_TYPE_STRINGARRAY, my_offsetof(CVideoInfoTag, m_studio)},
+    {VIDEODB_TYPE_SHAREDSTRINGARRAY, my_offsetof(CVideoInfoTag, m_studio)},
     {VIDEODB_TYPE_STRING, my_offsetof(CVideoInfoTag, m_strTrailer)},
     {VIDEODB_TYPE_STRING, my_offsetof(CVideoInfoTag, m_fanart.m_xml)},
-    {VIDEODB_TYPE_STRINGARRAY, my_offsetof(CVideoInfoTag, m_country)},
+    {VIDEODB_TYPE_SHAREDSTRINGARRAY, my_offsetof(CVideoInfoTag, m_country)},
     {VIDEODB_TYPE_STRING, my_offsetof(CVideoInfoTag, m_basePath)},
     {VIDEODB_TYPE_INT, my_offsetof(CVideoInfoTag, m_parentPathID)},
 }};
@@ -265,13 +266,13 @@ const std::array<SDbTableOffsets, DB_TVSHOW_OFFSETS_SIZE> DbTvShowOffsets = {{
     {VIDEODB_TYPE_DATE, my_offsetof(CVideoInfoTag, m_premiered)},
     {VIDEODB_TYPE_STRING, my_offsetof(CVideoInfoTag, m_strPictureURL.m_data)},
     {VIDEODB_TYPE_UNUSED, 0}, // unused
-    {VIDEODB_TYPE_STRINGARRAY, my_offsetof(CVideoInfoTag, m_genre)},
+    {VIDEODB_TYPE_SHAREDSTRINGARRAY, my_offsetof(CVideoInfoTag, m_genre)},
     {VIDEODB_TYPE_STRING, my_offsetof(CVideoInfoTag, m_strOriginalTitle)},
     {VIDEODB_TYPE_STRING, my_offsetof(CVideoInfoTag, m_strEpisodeGuide)},
     {VIDEODB_TYPE_STRING, my_offsetof(CVideoInfoTag, m_fanart.m_xml)},
     {VIDEODB_TYPE_INT, my_offsetof(CVideoInfoTag, m_iIdUniqueID)},
     {VIDEODB_TYPE_STRING, my_offsetof(CVideoInfoTag, m_strMPAARating)},
-    {VIDEODB_TYPE_STRINGARRAY, my_offsetof(CVideoInfoTag, m_studio)},
+    {VIDEODB_TYPE_SHAREDSTRINGARRAY, my_offsetof(CVideoInfoTag, m_studio)},
     {VIDEODB_TYPE_STRING, my_offsetof(CVideoInfoTag, m_strSortTitle)},
     {VIDEODB_TYPE_STRING, my_offsetof(CVideoInfoTag, m_strTrailer)},
 }};
@@ -384,12 +385,12 @@ const std::array<SDbTableOffsets, DB_MUSIC_VIDEO_OFFSETS_SIZE> DbMusicVideoOffse
     {VIDEODB_TYPE_UNUSED, 0}, // unused
     {VIDEODB_TYPE_INT, my_offsetof(CVideoInfoTag, m_duration)},
     {VIDEODB_TYPE_STRINGARRAY, my_offsetof(CVideoInfoTag, m_director)},
-    {VIDEODB_TYPE_STRINGARRAY, my_offsetof(CVideoInfoTag, m_studio)},
+    {VIDEODB_TYPE_SHAREDSTRINGARRAY, my_offsetof(CVideoInfoTag, m_studio)},
     {VIDEODB_TYPE_UNUSED, 0}, // unused
     {VIDEODB_TYPE_STRING, my_offsetof(CVideoInfoTag, m_strPlot)},
     {VIDEODB_TYPE_STRING, my_offsetof(CVideoInfoTag, m_strAlbum)},
     {VIDEODB_TYPE_STRINGARRAY, my_offsetof(CVideoInfoTag, m_artist)},
-    {VIDEODB_TYPE_STRINGARRAY, my_offsetof(CVideoInfoTag, m_genre)},
+    {VIDEODB_TYPE_SHAREDSTRINGARRAY, my_offsetof(CVideoInfoTag, m_genre)},
     {VIDEODB_TYPE_INT, my_offsetof(CVideoInfoTag, m_iTrack)},
     {VIDEODB_TYPE_STRING, my_offsetof(CVideoInfoTag, m_basePath)},
     {VIDEODB_TYPE_INT, my_offsetof(CVideoInfoTag, m_parentPathID)},
@@ -68,6 +68,9 @@ void CVideoDatabaseDDL::CreateTables(CDatabase& db)
   CLog::Log(LOGINFO, "create stacktimes table");
   db.ExecuteQuery("CREATE TABLE stacktimes (idFile integer, times text)\n");
 
+  CLog::Log(LOGINFO, "create probeinfo table");
+  db.ExecuteQuery("CREATE TABLE probeinfo (idFile integer, strKey text, strInfo text)");
+
   CLog::Log(LOGINFO, "create genre table");
   db.ExecuteQuery("CREATE TABLE genre ( genre_id integer primary key, name TEXT)\n");
   db.ExecuteQuery("CREATE TABLE genre_link (genre_id integer, media_id integer, media_type TEXT)");
@@ -241,12 +244,14 @@ void CVideoDatabaseDDL::CreateIndices(CDatabase& db)
   db.ExecuteQuery("CREATE INDEX ix_bookmark ON bookmark (idFile, type)");
   db.ExecuteQuery("CREATE UNIQUE INDEX ix_settings ON settings ( idFile )\n");
   db.ExecuteQuery("CREATE UNIQUE INDEX ix_stacktimes ON stacktimes ( idFile )\n");
+  db.ExecuteQuery("CREATE UNIQUE INDEX ix_probeinfo ON probeinfo ( idFile )");
   db.ExecuteQuery("CREATE INDEX ix_path ON path ( strPath(255) )");
   db.ExecuteQuery("CREATE INDEX ix_path2 ON path ( idParentPath )");
   db.ExecuteQuery("CREATE INDEX ix_files ON files ( idPath, strFilename(255) )");
 
   db.ExecuteQuery("CREATE UNIQUE INDEX ix_movie_file_1 ON movie (idFile, idMovie)");
   db.ExecuteQuery("CREATE UNIQUE INDEX ix_movie_file_2 ON movie (idMovie, idFile)");
+  db.ExecuteQuery("CREATE INDEX ix_movie_set ON movie (idSet)");
 
   db.ExecuteQuery("CREATE UNIQUE INDEX ix_tvshowlinkpath_1 ON tvshowlinkpath ( idShow, idPath )\n");
   db.ExecuteQuery("CREATE UNIQUE INDEX ix_tvshowlinkpath_2 ON tvshowlinkpath ( idPath, idShow )\n");
@@ -266,6 +271,9 @@ void CVideoDatabaseDDL::CreateIndices(CDatabase& db)
   db.ExecuteQuery(createColIndex);
   db.ExecuteQuery("CREATE INDEX ix_episode_show1 on episode(idEpisode,idShow)");
   db.ExecuteQuery("CREATE INDEX ix_episode_show2 on episode(idShow,idEpisode)");
+  // the episodes of a season are listed by show and season
+  db.ExecuteQuery(db.PrepareSQL("CREATE INDEX ix_episode_show_season ON episode (idShow, c%02d)",
+                                VIDEODB_ID_EPISODE_SEASON));
 
   db.ExecuteQuery("CREATE UNIQUE INDEX ix_musicvideo_file_1 on musicvideo (idMVideo, idFile)");
   db.ExecuteQuery("CREATE UNIQUE INDEX ix_musicvideo_file_2 on musicvideo (idFile, idMVideo)");
@@ -369,6 +377,7 @@ void CVideoDatabaseDDL::CreateTriggers(CDatabase& db)
                   "DELETE FROM settings WHERE idFile=old.idFile; "
                   "DELETE FROM stacktimes WHERE idFile=old.idFile; "
                   "DELETE FROM streamdetails WHERE idFile=old.idFile; "
+                  "DELETE FROM probeinfo WHERE idFile=old.idFile; "
                   "DELETE FROM videoversion WHERE idFile=old.idFile; "
                   "DELETE FROM art WHERE media_id=old.idFile AND media_type='videoversion'; "
                   "END");
@@ -0,0 +1,101 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoDbResultCache.h"
+
+#include "FileItemList.h"
+
+#include <mutex>
+
+CVideoDbResultCache& CVideoDbResultCache::GetInstance()
+{
+  static CVideoDbResultCache cache;
+  return cache;
+}
+
+bool CVideoDbResultCache::Get(const std::string& key,
+                              uint64_t generation,
+                              std::chrono::seconds maxAge,
+                              CFileItemList& items)
+{
+  std::shared_ptr<const CFileItemList> cached;
+  {
+    std::unique_lock lock(m_section);
+
+    const auto it = m_entries.find(key);
+    if (it == m_entries.end())
+      return false;
+
+    Entry& entry = it->second;
+    if (entry.generation != generation ||
+        std::chrono::steady_clock::now() - entry.stored > maxAge)
+    {
+      m_itemCount -= entry.items->Size();
+      m_entries.erase(it);
+      return false;
+    }
+
+    entry.lastUse = ++m_useCounter;
+    cached = entry.items;
+  }
+
+  // cached lists are never modified, copy without holding the lock
+  items.Copy(*cached);
+  return true;
+}
+
+void CVideoDbResultCache::Set(const std::string& key,
+                              uint64_t generation,
+                              const CFileItemList& items)
+{
+  const size_t size = static_cast<size_t>(items.Size());
+  if (size > MAX_ITEMS)
+    return;
+
+  auto copy = std::make_shared<CFileItemList>();
+  copy->Copy(items);
+
+  std::unique_lock lock(m_section);
+
+  const auto it = m_entries.find(key);
+  if (it != m_entries.end())
+  {
+    m_itemCount -= it->second.items->Size();
+    m_entries.erase(it);
+  }
+
+  Evict(size);
+
+  m_entries.try_emplace(key, Entry{generation, std::chrono::steady_clock::now(), std::move(copy),
+                                   ++m_useCounter});
+  m_itemCount += size;
+}
+
+void CVideoDbResultCache::Clear()
+{
+  std::unique_lock lock(m_section);
+  m_entries.clear();
+  m_itemCount = 0;
+}
+
+void CVideoDbResultCache::Evict(size_t items)
+{
+  // drop the least recently used entries until the new one fits
+  while (!m_entries.empty() &&
+         (m_entries.size() >= MAX_ENTRIES || m_itemCount + items > MAX_ITEMS))
+  {
+    auto oldest = m_entries.begin();
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+    {
+      if (it->second.lastUse < oldest->second.lastUse)
+        oldest = it;
+    }
+    m_itemCount -= oldest->second.items->Size();
+    m_entries.erase(oldest);
+  }
+}
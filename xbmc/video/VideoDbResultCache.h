@@ -0,0 +1,68 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+class CFileItemList;
+
+/*!
+ * \brief Process wide cache of video library listings.
+ *
+ * Entries are stored with the write generation of the database (see
+ * CDatabase::GetWriteGeneration()) taken before the listing was queried, and are only served
+ * while the generation is unchanged. The maximum age bounds how long changes made by other
+ * clients of a shared database can go unnoticed.
+ */
+class CVideoDbResultCache
+{
+public:
+  static constexpr size_t MAX_ENTRIES = 32;
+  static constexpr size_t MAX_ITEMS = 50000; //!< total number of cached items
+
+  static CVideoDbResultCache& GetInstance();
+
+  /*!
+   * \brief Copy a cached listing into items.
+   * \return true if an entry for key with a matching generation younger than maxAge exists
+   */
+  bool Get(const std::string& key,
+           uint64_t generation,
+           std::chrono::seconds maxAge,
+           CFileItemList& items);
+
+  /*!
+   * \brief Store a copy of items, generation must be the one taken before running the query.
+   */
+  void Set(const std::string& key, uint64_t generation, const CFileItemList& items);
+
+  void Clear();
+
+private:
+  struct Entry
+  {
+    uint64_t generation;
+    std::chrono::steady_clock::time_point stored;
+    std::shared_ptr<const CFileItemList> items;
+    uint64_t lastUse;
+  };
+
+  void Evict(size_t items);
+
+  CCriticalSection m_section;
+  std::unordered_map<std::string, Entry> m_entries;
+  size_t m_itemCount{0};
+  uint64_t m_useCounter{0};
+};
@@ -20,6 +20,7 @@
 #include "utils/URIUtils.h"
 #include "video/VideoFileItemClassify.h"
 #include "video/VideoInfoTag.h"
+#include "video/VideoSeekPreview.h"
 
 #include <charconv>
 
@@ -64,6 +65,9 @@ std::unique_ptr<CTexture> CVideoGeneratedImageFileLoader::Load(
     return {};
   }
 
+  if (!imageFile.GetOption("seekstrip").empty() || !imageFile.GetOption("seektile").empty())
+    return CVideoSeekPreview::Load(imageFile);
+
   const std::string& filePath = imageFile.GetTargetFile();
   CFileItem item{filePath, false};
 
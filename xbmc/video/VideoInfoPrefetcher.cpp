@@ -0,0 +1,178 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoInfoPrefetcher.h"
+
+#include "VideoInfoDownloader.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+using namespace KODI::VIDEO;
+
+namespace
+{
+// scraper sites limit the requests of a client, a few lookups at once stay well below that
+constexpr unsigned int MAX_LOOKUPS_PER_SCRAPER = 3;
+constexpr unsigned int MAX_WORKERS = 6;
+// results are kept until the scanner takes them, don't run too far ahead of it
+constexpr size_t MAX_LOOKAHEAD = 16;
+} // unnamed namespace
+
+CVideoInfoPrefetcher::~CVideoInfoPrefetcher()
+{
+  Stop();
+}
+
+void CVideoInfoPrefetcher::Add(const ADDON::ScraperPtr& scraper,
+                               const std::string& title,
+                               int year)
+{
+  Lookup lookup;
+  lookup.scraper = scraper;
+  lookup.title = title;
+  lookup.year = year;
+  m_lookups.emplace_back(std::move(lookup));
+}
+
+void CVideoInfoPrefetcher::Start()
+{
+  std::map<std::string, size_t> scrapers;
+  for (const auto& lookup : m_lookups)
+    scrapers[lookup.scraper->ID()]++;
+
+  size_t workers = 0;
+  for (const auto& [id, count] : scrapers)
+    workers += std::min<size_t>(count, MAX_LOOKUPS_PER_SCRAPER);
+  workers = std::min<size_t>(workers, MAX_WORKERS);
+
+  CLog::LogF(LOGDEBUG, "looking up {} items with {} threads", m_lookups.size(), workers);
+  for (size_t i = 0; i < workers; ++i)
+    m_threads.emplace_back([this]() { Process(); });
+}
+
+void CVideoInfoPrefetcher::Stop()
+{
+  {
+    std::unique_lock lock(m_section);
+    m_stop = true;
+    m_condition.notifyAll();
+  }
+
+  for (auto& thread : m_threads)
+    thread.join();
+
+  m_threads.clear();
+  m_lookups.clear();
+  m_activeLookups.clear();
+  m_next = 0;
+  m_first = 0;
+  m_detailsIndex.reset();
+  m_stop = false;
+}
+
+bool CVideoInfoPrefetcher::FindVideo(const ADDON::ScraperPtr& scraper,
+                                     const std::string& title,
+                                     int year,
+                                     CScraperUrl& url)
+{
+  std::unique_lock lock(m_section);
+  m_detailsIndex.reset();
+
+  const auto it = std::find_if(m_lookups.begin() + m_first, m_lookups.end(),
+                               [&scraper, &title, year](const Lookup& lookup)
+                               {
+                                 return lookup.year == year && lookup.title == title &&
+                                        lookup.scraper->ID() == scraper->ID();
+                               });
+  if (it == m_lookups.end())
+    return false;
+
+  // the scanner skipped the items before it, their results aren't needed anymore
+  const size_t index = static_cast<size_t>(it - m_lookups.begin());
+  for (size_t i = m_first; i < index; ++i)
+    m_lookups[i].details.Reset();
+  m_next = std::max(m_next, index);
+  m_first = index + 1;
+  m_condition.notifyAll();
+
+  m_condition.wait(lock, [this, &lookup = *it]() { return m_stop || lookup.done; });
+  if (!it->done || !it->found)
+    return false;
+
+  url = it->url;
+  m_detailsIndex = index;
+  return true;
+}
+
+bool CVideoInfoPrefetcher::GetDetails(const ADDON::ScraperPtr& scraper,
+                                      const CScraperUrl& url,
+                                      CVideoInfoTag& details)
+{
+  std::unique_lock lock(m_section);
+  if (!m_detailsIndex)
+    return false;
+
+  Lookup& lookup = m_lookups[*m_detailsIndex];
+  m_detailsIndex.reset();
+  if (lookup.scraper->ID() != scraper->ID() ||
+      lookup.url.GetFirstThumbUrl() != url.GetFirstThumbUrl())
+    return false;
+
+  details = std::move(lookup.details);
+  lookup.details.Reset();
+  return true;
+}
+
+void CVideoInfoPrefetcher::Process()
+{
+  std::unique_lock lock(m_section);
+  while (true)
+  {
+    m_condition.wait(lock,
+                     [this]()
+                     {
+                       return m_stop || m_next == m_lookups.size() ||
+                              (m_next < m_first + MAX_LOOKAHEAD &&
+                               m_activeLookups[m_lookups[m_next].scraper->ID()] <
+                                   MAX_LOOKUPS_PER_SCRAPER);
+                     });
+    if (m_stop || m_next == m_lookups.size())
+      return;
+
+    Lookup& lookup = m_lookups[m_next++];
+    const std::string scraperId = lookup.scraper->ID();
+    m_activeLookups[scraperId]++;
+    lock.unlock();
+
+    // without a progress dialog the downloader runs on the calling thread
+    CVideoInfoDownloader downloader(lookup.scraper);
+    MOVIELIST movies;
+    CScraperUrl url;
+    CVideoInfoTag details;
+    bool found = false;
+    if (downloader.FindMovie(lookup.title, lookup.year, movies) > 0 && !movies.empty())
+    {
+      url = movies[0];
+      found = downloader.GetDetails({}, url, details);
+    }
+
+    lock.lock();
+    m_activeLookups[scraperId]--;
+    lookup.done = true;
+    lookup.found = found;
+    if (found)
+    {
+      lookup.url = std::move(url);
+      lookup.details = std::move(details);
+    }
+    m_condition.notifyAll();
+  }
+}
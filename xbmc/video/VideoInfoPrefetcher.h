@@ -0,0 +1,94 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "VideoInfoTag.h"
+#include "addons/Scraper.h"
+#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
+#include "utils/ScraperUrl.h"
+
+#include <map>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace KODI::VIDEO
+{
+/*!
+ * \brief Looks up the next items of a folder with their scraper while the scanner adds the
+ * current one to the library.
+ *
+ * Most of the time of a scan is spent waiting for the scraper, the lookups of several items run
+ * at the same time on a few threads. The scanner stays the only one to write to the database, it
+ * takes the results in the order the lookups were added and does the lookup itself for anything
+ * that wasn't found. Only python scrapers are used, they don't share any state between calls.
+ */
+class CVideoInfoPrefetcher
+{
+public:
+  CVideoInfoPrefetcher() = default;
+  ~CVideoInfoPrefetcher();
+
+  CVideoInfoPrefetcher(const CVideoInfoPrefetcher&) = delete;
+  CVideoInfoPrefetcher& operator=(const CVideoInfoPrefetcher&) = delete;
+
+  /*!
+   * \brief Queue the search for a title, must be called before Start()
+   */
+  void Add(const ADDON::ScraperPtr& scraper, const std::string& title, int year);
+
+  void Start();
+
+  /*!
+   * \brief Stop the lookups and drop all results, returns once the lookups in progress finished
+   */
+  void Stop();
+
+  /*!
+   * \brief Get the best match for a title, waits for the lookup if it is still in progress
+   * \return false if the title wasn't queued or nothing was found
+   */
+  bool FindVideo(const ADDON::ScraperPtr& scraper,
+                 const std::string& title,
+                 int year,
+                 CScraperUrl& url);
+
+  /*!
+   * \brief Get the details of the match returned by the last call of FindVideo()
+   * \return false if the details are for a different url or couldn't be fetched
+   */
+  bool GetDetails(const ADDON::ScraperPtr& scraper, const CScraperUrl& url, CVideoInfoTag& details);
+
+private:
+  struct Lookup
+  {
+    ADDON::ScraperPtr scraper;
+    std::string title;
+    int year = -1;
+    bool done = false;
+    bool found = false;
+    CScraperUrl url;
+    CVideoInfoTag details;
+  };
+
+  void Process();
+
+  CCriticalSection m_section;
+  XbmcThreads::ConditionVariable m_condition;
+  std::vector<Lookup> m_lookups; //!< not resized once the threads are started
+  std::map<std::string, unsigned int> m_activeLookups; //!< lookups in progress per scraper
+  std::vector<std::thread> m_threads;
+  size_t m_next = 0; //!< next lookup to start
+  size_t m_first = 0; //!< oldest lookup the scanner may still ask for
+  std::optional<size_t> m_detailsIndex; //!< lookup returned by the last FindVideo()
+  bool m_stop = false;
+};
+} // namespace KODI::VIDEO
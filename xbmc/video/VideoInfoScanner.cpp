@@ -32,6 +32,8 @@
 #include "guilib/GUIWindowManager.h"
 #include "imagefiles/ImageFileURL.h"
 #include "interfaces/AnnouncementManager.h"
+#include "jobs/JobManager.h"
+#include "jobs/LambdaJob.h"
 #include "messaging/helpers/DialogHelper.h"
 #include "messaging/helpers/DialogOKHelper.h"
 #include "playlists/PlayListFileItemClassify.h"
@@ -42,6 +44,8 @@
 #include "settings/SettingsComponent.h"
 #include "tags/SetInfoTagLoaderFactory.h"
 #include "tags/VideoInfoTagLoaderFactory.h"
+#include "threads/CriticalSection.h"
+#include "threads/Event.h"
 #include "utils/ArtUtils.h"
 #include "utils/Digest.h"
 #include "utils/DiscsUtils.h"
@@ -62,7 +66,10 @@
 #include "video/dialogs/GUIDialogVideoManagerVersions.h"
 
 #include <algorithm>
+#include <atomic>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <ranges>
 #include <set>
 #include <string>
@@ -167,6 +174,108 @@ void OnDirectoryScanned(const std::string& strDirectory)
   CServiceBroker::GetGUI()->GetWindowManager().SendThreadMessage(msg);
 }
 
+/*! \brief Sums the modification times of a folder and all its subfolders.
+ Subfolders are listed and stat'ed on the job manager, with at most jobsPerHost folders of the
+ same host being processed at once so a single NAS isn't flooded with requests.
+ */
+class CFolderTimeWalker : public std::enable_shared_from_this<CFolderTimeWalker>
+{
+public:
+  explicit CFolderTimeWalker(unsigned int jobsPerHost) : m_jobsPerHost(jobsPerHost) {}
+
+  /*! \brief Walk the given folder, blocks until all subfolders are done.
+   \return the sum of all folder times, 0 if the time of any folder is not available
+   */
+  int64_t Run(const std::string& directory)
+  {
+    Enqueue(directory);
+    m_done.Wait();
+    return m_failed ? 0 : m_time.load();
+  }
+
+private:
+  void Enqueue(const std::string& path)
+  {
+    const CURL url(path);
+    std::string host = url.GetProtocol() + "://" + url.GetHostName();
+    {
+      std::unique_lock lock(m_section);
+      m_remaining++;
+      m_pending[host].push_back(path);
+      if (m_workers[host] >= m_jobsPerHost)
+        return;
+      m_workers[host]++;
+    }
+
+    auto job = [self = shared_from_this(), host]() { self->Work(host); };
+    if (!CServiceBroker::GetJobManager()->AddJob(new CLambdaJob(std::move(job)), nullptr,
+                                                 CJob::PRIORITY_NORMAL))
+      Work(host); // job manager is shutting down, do it ourselves
+  }
+
+  void Work(const std::string& host)
+  {
+    while (true)
+    {
+      std::string path;
+      {
+        std::unique_lock lock(m_section);
+        auto& queue = m_pending[host];
+        if (queue.empty())
+        {
+          m_workers[host]--;
+          return;
+        }
+        path = std::move(queue.front());
+        queue.pop_front();
+      }
+
+      if (!m_failed)
+        Process(path);
+
+      std::unique_lock lock(m_section);
+      if (--m_remaining == 0)
+        m_done.Set();
+    }
+  }
+
+  void Process(const std::string& path)
+  {
+    int64_t statTime = 0;
+    struct __stat64 buffer;
+    if (CFile::Stat(path, &buffer) == 0)
+    {
+      //! @todo some filesystems may return the mtime/ctime inline, in which case this is
+      //! unnecessarily expensive. Consider supporting Stat() in our directory cache?
+      statTime = buffer.st_mtime ? buffer.st_mtime : buffer.st_ctime;
+    }
+
+    if (!statTime)
+    {
+      m_failed = true;
+      return;
+    }
+    m_time += statTime;
+
+    CFileItemList items;
+    CDirectory::GetDirectory(path, items, "", DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_NO_FILE_INFO);
+    for (const auto& item : items)
+    {
+      if (item->IsFolder() && !item->IsPath(".."))
+        Enqueue(item->GetPath());
+    }
+  }
+
+  const unsigned int m_jobsPerHost;
+  CCriticalSection m_section;
+  std::unordered_map<std::string, std::deque<std::string>> m_pending; // per host
+  std::unordered_map<std::string, unsigned int> m_workers; // per host
+  unsigned int m_remaining{0}; // folders queued but not processed yet
+  std::atomic<int64_t> m_time{0};
+  std::atomic<bool> m_failed{false};
+  CEvent m_done;
+};
+
 } // namespace
 
 namespace KODI::VIDEO
@@ -680,6 +789,11 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
     m_database.Open();
 
+    // the next files are read and looked up while the current one is added to the library
+    if (!pURL && !pDlgProgress &&
+        (content == ContentType::MOVIES || content == ContentType::MUSICVIDEOS))
+      PrefetchVideoInfo(items, bDirNames, useLocal);
+
     bool FoundSomeInfo = false;
     std::vector<int> seenPaths;
     seenPaths.reserve(items.Size());
@@ -784,10 +898,78 @@ CVideoInfoScanner::~CVideoInfoScanner()
     if(pDlgProgress)
       pDlgProgress->ShowProgressBar(false);
 
+    m_prefetcher.Stop();
+    m_nfoPrefetcher.Stop();
     m_database.Close();
     return FoundSomeInfo;
   }
 
+  void CVideoInfoScanner::PrefetchVideoInfo(const CFileItemList& items,
+                                            bool bDirNames,
+                                            bool useLocal)
+  {
+    const ScraperPtr scraper = m_database.GetScraperForPath(items.GetPath(), &m_scraperCache);
+    if (!scraper || (scraper->Content() != ContentType::MOVIES &&
+                     scraper->Content() != ContentType::MUSICVIDEOS))
+      return;
+
+    // the lookups run at the same time, only python scrapers don't share state between calls
+    const bool lookup = scraper->IsPython();
+    const bool movies = scraper->Content() == ContentType::MOVIES;
+    size_t count = 0;
+    size_t nfoCount = 0;
+    for (const auto& item : items)
+    {
+      if (item->IsFolder() || !IsVideo(*item) || item->IsNFO() || PLAYLIST::IsPlayList(*item))
+        continue;
+
+      if (CUtil::ExcludeFileOrFolder(item->GetPath(),
+                                     m_advancedSettings->m_moviesExcludeFromScanRegExps,
+                                     &m_regexpCache))
+        continue;
+
+      if (movies ? m_database.HasMovieInfo(item->GetDynPath())
+                 : m_database.HasMusicVideoInfo(item->GetPath()))
+        continue;
+
+      if (useLocal)
+      {
+        m_nfoPrefetcher.Add(item, scraper, bDirNames);
+        nfoCount++;
+      }
+
+      if (!lookup)
+        continue;
+
+      // these are looked up by their unique id or by what the local info says
+      const std::string title = item->GetMovieName(bDirNames);
+      std::string identifierType;
+      std::string identifier;
+      if (CFilenameAttributes(movies ? URIUtils::GetFileName(item->GetPath()) : title,
+                              &m_regexpCache)
+              .GetIdentifier(identifierType, identifier))
+        continue;
+
+      if (useLocal && std::unique_ptr<IVideoInfoTagLoader>(
+                          CVideoInfoTagLoaderFactory::CreateLoader(*item, scraper, bDirNames)))
+        continue;
+
+      m_prefetcher.Add(scraper, title, -1);
+      count++;
+    }
+
+    // a single item is read and looked up by the scanner itself
+    if (nfoCount > 1)
+      m_nfoPrefetcher.Start();
+    else
+      m_nfoPrefetcher.Stop();
+
+    if (count > 1)
+      m_prefetcher.Start();
+    else
+      m_prefetcher.Stop();
+  }
+
   CInfoScanner::InfoRet CVideoInfoScanner::RetrieveInfoForTvShow(CFileItem* pItem,
                                                                  bool bDirNames,
                                                                  ScraperPtr& info2,
@@ -1863,9 +2045,13 @@ CVideoInfoScanner::~CVideoInfoScanner()
                   bool lookInFolder,
                   bool resetTag)
   {
-    if (std::unique_ptr<IVideoInfoTagLoader> loader{
-            CVideoInfoTagLoaderFactory::CreateLoader(item, scraper, lookInFolder)};
-        loader)
+    // the local info read ahead is for an empty tag, additional versions aren't read ahead
+    std::unique_ptr<IVideoInfoTagLoader> loader;
+    if (!resetTag || item.HasProperty("nfo_index") ||
+        !m_nfoPrefetcher.TakeLoader(item, scraper, lookInFolder, loader))
+      loader.reset(CVideoInfoTagLoaderFactory::CreateLoader(item, scraper, lookInFolder));
+
+    if (loader)
     {
       CVideoInfoTag& infoTag = *item.GetVideoInfoTag();
       if (resetTag)
@@ -2334,8 +2520,12 @@ CVideoInfoScanner::~CVideoInfoScanner()
     if (m_handle && !url.GetTitle().empty())
       m_handle->SetText(url.GetTitle());
 
-    CVideoInfoDownloader imdb(scraper);
-    bool ret = imdb.GetDetails(uniqueIDs, url, movieDetails, pDialog);
+    bool ret = uniqueIDs.empty() && m_prefetcher.GetDetails(scraper, url, movieDetails);
+    if (!ret)
+    {
+      CVideoInfoDownloader imdb(scraper);
+      ret = imdb.GetDetails(uniqueIDs, url, movieDetails, pDialog);
+    }
 
     if (ret)
     {
@@ -2456,34 +2646,17 @@ CVideoInfoScanner::~CVideoInfoScanner()
   std::string CVideoInfoScanner::GetRecursiveFastHash(const std::string &directory,
       const std::vector<std::string> &excludes) const
   {
-    CFileItemList items;
-    items.Add(std::make_shared<CFileItem>(directory, true));
-    CUtil::GetRecursiveDirsListing(directory, items, DIR_FLAG_NO_FILE_DIRS | DIR_FLAG_NO_FILE_INFO);
-
-    CDigest digest{CDigest::Type::MD5};
+    const unsigned int jobsPerHost =
+        static_cast<unsigned int>(std::max(m_advancedSettings->m_videoLibraryFastHashJobs, 1));
+    const int64_t time = std::make_shared<CFolderTimeWalker>(jobsPerHost)->Run(directory);
 
-    if (!excludes.empty())
-      digest.Update(StringUtils::Join(excludes, "|"));
-
-    int64_t time = 0;
-    for (int i=0; i < items.Size(); ++i)
+    if (time)
     {
-      int64_t stat_time = 0;
-      struct __stat64 buffer;
-      if (XFILE::CFile::Stat(items[i]->GetPath(), &buffer) == 0)
-      {
-        //! @todo some filesystems may return the mtime/ctime inline, in which case this is
-        //! unnecessarily expensive. Consider supporting Stat() in our directory cache?
-        stat_time = buffer.st_mtime ? buffer.st_mtime : buffer.st_ctime;
-        time += stat_time;
-      }
+      CDigest digest{CDigest::Type::MD5};
 
-      if (!stat_time)
-        return "";
-    }
+      if (!excludes.empty())
+        digest.Update(StringUtils::Join(excludes, "|"));
 
-    if (time)
-    {
       digest.Update((unsigned char *)&time, sizeof(time));
       return digest.Finalize();
     }
@@ -2641,6 +2814,9 @@ CVideoInfoScanner::~CVideoInfoScanner()
 
   int CVideoInfoScanner::FindVideo(const std::string &title, int year, const ScraperPtr &scraper, CScraperUrl &url, CGUIDialogProgress *progress)
   {
+    if (m_prefetcher.FindVideo(scraper, title, year, url))
+      return 1; // found a movie
+
     MOVIELIST movielist;
     CVideoInfoDownloader imdb(scraper);
     int returncode = imdb.FindMovie(title, year, movielist, progress);
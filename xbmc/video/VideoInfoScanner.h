@@ -10,6 +10,8 @@
 
 #include "InfoScanner.h"
 #include "VideoDatabase.h"
+#include "VideoInfoPrefetcher.h"
+#include "VideoNfoPrefetcher.h"
 #include "addons/Scraper.h"
 #include "settings/VideoVersionsSettings.h"
 #include "utils/Artwork.h"
@@ -202,6 +204,14 @@ namespace KODI::VIDEO
      */
     int FindVideo(const std::string &title, int year, const ADDON::ScraperPtr &scraper, CScraperUrl &url, CGUIDialogProgress *progress);
 
+    /*! \brief Start reading the local info of the files of a folder and looking up those that
+     will be searched by their name
+     \param items the items of the folder
+     \param bDirNames whether the items are looked up by the name of their folder
+     \param useLocal whether local info is used, files that have it are not looked up
+     */
+    void PrefetchVideoInfo(const CFileItemList& items, bool bDirNames, bool useLocal);
+
     /*! \brief Find a url for the given video using the given scraper
      \param item the video to lookup
      \param scraper scraper to use for the lookup
@@ -333,5 +343,7 @@ namespace KODI::VIDEO
     std::shared_ptr<CAdvancedSettings> m_advancedSettings;
     CVideoDatabase::ScraperCache m_scraperCache;
     mutable KODI::REGEXP::RegExpCache m_regexpCache;
+    CVideoInfoPrefetcher m_prefetcher;
+    CVideoNfoPrefetcher m_nfoPrefetcher;
   };
   } // namespace KODI::VIDEO
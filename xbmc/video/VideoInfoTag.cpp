@@ -756,14 +756,14 @@ void CVideoInfoTag::Serialize(CVariant& value) const
 {
   value["director"] = m_director;
   value["writer"] = m_writingCredits;
-  value["genre"] = m_genre;
-  value["country"] = m_country;
+  value["genre"] = m_genre.Get();
+  value["country"] = m_country.Get();
   value["tagline"] = m_strTagLine;
   value["plotoutline"] = m_strPlotOutline;
   value["plot"] = m_strPlot;
   value["title"] = m_strTitle;
   value["votes"] = std::to_string(GetRating().votes);
-  value["studio"] = m_studio;
+  value["studio"] = m_studio.Get();
   value["trailer"] = m_strTrailer;
   value["cast"] = CVariant(CVariant::VariantTypeArray);
   for (const auto& person : m_cast)
@@ -849,10 +849,10 @@ void CVideoInfoTag::ToSortable(SortItem& sortable, Field field) const
       sortable[Field::WRITER] = m_writingCredits;
       break;
     case Field::GENRE:
-      sortable[Field::GENRE] = m_genre;
+      sortable[Field::GENRE] = m_genre.Get();
       break;
     case Field::COUNTRY:
-      sortable[Field::COUNTRY] = m_country;
+      sortable[Field::COUNTRY] = m_country.Get();
       break;
     case Field::TAGLINE:
       sortable[Field::TAGLINE] = m_strTagLine;
@@ -875,7 +875,7 @@ void CVideoInfoTag::ToSortable(SortItem& sortable, Field field) const
       sortable[Field::VOTES] = GetRating().votes;
       break;
     case Field::STUDIO:
-      sortable[Field::STUDIO] = m_studio;
+      sortable[Field::STUDIO] = m_studio.Get();
       break;
     case Field::TRAILER:
       sortable[Field::TRAILER] = m_strTrailer;
@@ -14,6 +14,7 @@
 #include "utils/Fanart.h"
 #include "utils/ISortable.h"
 #include "utils/ScraperUrl.h"
+#include "utils/SharedStrings.h"
 #include "utils/StreamDetails.h"
 #include "video/Bookmark.h"
 
@@ -385,8 +386,8 @@ public:
   int m_parentPathID;      // the parent path id where the base path of the video lies
   std::vector<std::string> m_director;
   std::vector<std::string> m_writingCredits;
-  std::vector<std::string> m_genre;
-  std::vector<std::string> m_country;
+  CSharedStringList m_genre; // shared between the tags, like m_country and m_studio
+  CSharedStringList m_country;
   std::string m_strTagLine;
   std::string m_strPlotOutline;
   std::string m_strTrailer;
@@ -410,7 +411,7 @@ public:
   std::string m_strProductionCode;
   CDateTime m_firstAired;
   std::string m_strShowTitle;
-  std::vector<std::string> m_studio;
+  CSharedStringList m_studio;
   std::string m_strAlbum;
   CDateTime m_lastPlayed;
   std::vector<std::string> m_showLink;
@@ -0,0 +1,134 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoNfoPrefetcher.h"
+
+#include "FileItem.h"
+#include "utils/log.h"
+#include "video/tags/IVideoInfoTagLoader.h"
+#include "video/tags/VideoInfoTagLoaderFactory.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+using namespace KODI::VIDEO;
+
+namespace
+{
+// the files are mostly read from the same disk or share, a few reads at once keep it busy
+constexpr size_t MAX_WORKERS = 4;
+// the parsed details are kept until the scanner takes them, don't run too far ahead of it
+constexpr size_t MAX_LOOKAHEAD = 32;
+} // unnamed namespace
+
+CVideoNfoPrefetcher::~CVideoNfoPrefetcher()
+{
+  Stop();
+}
+
+void CVideoNfoPrefetcher::Add(const std::shared_ptr<CFileItem>& item,
+                              const ADDON::ScraperPtr& scraper,
+                              bool lookInFolder)
+{
+  Entry entry;
+  entry.item = item;
+  entry.scraper = scraper;
+  entry.lookInFolder = lookInFolder;
+  m_entries.emplace_back(std::move(entry));
+}
+
+void CVideoNfoPrefetcher::Start()
+{
+  const size_t workers = std::min(m_entries.size(), MAX_WORKERS);
+  CLog::LogF(LOGDEBUG, "reading the local info of {} items with {} threads", m_entries.size(),
+             workers);
+  for (size_t i = 0; i < workers; ++i)
+    m_threads.emplace_back([this]() { Process(); });
+}
+
+void CVideoNfoPrefetcher::Stop()
+{
+  {
+    std::unique_lock lock(m_section);
+    m_stop = true;
+    m_condition.notifyAll();
+  }
+
+  for (auto& thread : m_threads)
+    thread.join();
+
+  m_threads.clear();
+  m_entries.clear();
+  m_next = 0;
+  m_first = 0;
+  m_stop = false;
+}
+
+bool CVideoNfoPrefetcher::TakeLoader(const CFileItem& item,
+                                     const ADDON::ScraperPtr& scraper,
+                                     bool lookInFolder,
+                                     std::unique_ptr<IVideoInfoTagLoader>& loader)
+{
+  std::unique_lock lock(m_section);
+  const auto it =
+      std::find_if(m_entries.begin() + m_first, m_entries.end(),
+                   [&item, &scraper, lookInFolder](const Entry& entry)
+                   {
+                     return entry.lookInFolder == lookInFolder &&
+                            entry.item->GetPath() == item.GetPath() &&
+                            entry.scraper->ID() == scraper->ID();
+                   });
+  if (it == m_entries.end())
+    return false;
+
+  // the scanner skipped the items before it, their loaders aren't needed anymore
+  const size_t index = static_cast<size_t>(it - m_entries.begin());
+  for (size_t i = m_first; i < index; ++i)
+    m_entries[i].loader.reset();
+  m_next = std::max(m_next, index);
+  m_first = index + 1;
+  m_condition.notifyAll();
+
+  m_condition.wait(lock, [this, &entry = *it]() { return m_stop || entry.done; });
+  if (!it->done)
+    return false;
+
+  loader = std::move(it->loader);
+  return true;
+}
+
+void CVideoNfoPrefetcher::Process()
+{
+  std::unique_lock lock(m_section);
+  while (true)
+  {
+    m_condition.wait(lock,
+                     [this]()
+                     {
+                       return m_stop || m_next == m_entries.size() ||
+                              m_next < m_first + MAX_LOOKAHEAD;
+                     });
+    if (m_stop || m_next == m_entries.size())
+      return;
+
+    Entry& entry = m_entries[m_next++];
+    lock.unlock();
+
+    // finding the nfo file and parsing it needs no scraper, only the scanner runs those
+    std::unique_ptr<IVideoInfoTagLoader> loader(
+        CVideoInfoTagLoaderFactory::CreateLoader(*entry.item, entry.scraper, entry.lookInFolder));
+    if (loader)
+      loader->Prefetch();
+
+    lock.lock();
+    entry.loader = std::move(loader);
+    entry.done = true;
+    m_condition.notifyAll();
+  }
+}
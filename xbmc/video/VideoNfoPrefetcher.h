@@ -0,0 +1,88 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "addons/Scraper.h"
+#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+class CFileItem;
+
+namespace KODI::VIDEO
+{
+class IVideoInfoTagLoader;
+
+/*!
+ * \brief Reads and parses the local info of the next items of a folder while the scanner adds
+ * the current one to the library.
+ *
+ * Libraries described by nfo files spend most of a scan finding, reading and parsing them one
+ * after the other. This is done for several items at the same time on a few threads, ahead of
+ * the scanner. The scanner stays the only one to write to the database and to run the scraper,
+ * which looks for urls in the nfo files. It takes the loaders in the order they were added.
+ */
+class CVideoNfoPrefetcher
+{
+public:
+  CVideoNfoPrefetcher() = default;
+  ~CVideoNfoPrefetcher();
+
+  CVideoNfoPrefetcher(const CVideoNfoPrefetcher&) = delete;
+  CVideoNfoPrefetcher& operator=(const CVideoNfoPrefetcher&) = delete;
+
+  /*!
+   * \brief Queue an item, must be called before Start()
+   * \param item the item, it must stay alive until Stop() and the loader taken for it is deleted
+   */
+  void Add(const std::shared_ptr<CFileItem>& item,
+           const ADDON::ScraperPtr& scraper,
+           bool lookInFolder);
+
+  void Start();
+
+  /*!
+   * \brief Stop reading and drop all loaders, returns once the items in progress are read
+   */
+  void Stop();
+
+  /*!
+   * \brief Get the loader of the local info of an item, waits while it is still being read
+   * \param[out] loader the loader with its info read, nullptr if the item has no local info
+   * \return false if the item wasn't queued, the caller has to create the loader
+   */
+  bool TakeLoader(const CFileItem& item,
+                  const ADDON::ScraperPtr& scraper,
+                  bool lookInFolder,
+                  std::unique_ptr<IVideoInfoTagLoader>& loader);
+
+private:
+  struct Entry
+  {
+    std::shared_ptr<CFileItem> item;
+    ADDON::ScraperPtr scraper;
+    bool lookInFolder = false;
+    bool done = false;
+    std::unique_ptr<IVideoInfoTagLoader> loader;
+  };
+
+  void Process();
+
+  CCriticalSection m_section;
+  XbmcThreads::ConditionVariable m_condition;
+  std::vector<Entry> m_entries; //!< not resized once the threads are started
+  std::vector<std::thread> m_threads;
+  size_t m_next = 0; //!< next entry to read
+  size_t m_first = 0; //!< oldest entry the scanner may still ask for
+  bool m_stop = false;
+};
+} // namespace KODI::VIDEO
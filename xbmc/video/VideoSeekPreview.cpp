@@ -0,0 +1,155 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoSeekPreview.h"
+
+#include "DVDFileInfo.h"
+#include "FileItem.h"
+#include "ServiceBroker.h"
+#include "TextureCache.h"
+#include "guilib/Texture.h"
+#include "imagefiles/ImageFileURL.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/Settings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/URIUtils.h"
+#include "video/VideoInfoTag.h"
+
+#include <charconv>
+#include <cstring>
+
+namespace KODI::VIDEO
+{
+
+namespace
+{
+constexpr unsigned int TILES_PER_STRIP = CVideoSeekPreview::COLUMNS * CVideoSeekPreview::ROWS;
+
+std::chrono::seconds GetInterval()
+{
+  return std::chrono::seconds(
+      CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_videoSeekPreviewInterval);
+}
+
+unsigned int GetNumber(const IMAGE_FILES::CImageFileURL& imageFile, const std::string& option)
+{
+  const std::string value = imageFile.GetOption(option);
+  unsigned int number = 0;
+  std::from_chars(value.data(), value.data() + value.size(), number);
+  return number;
+}
+
+// the interval is part of the url, so changing it doesn't mix up tiles of different strips
+std::string GetImage(const std::string& file,
+                     const std::string& type,
+                     unsigned int number,
+                     std::chrono::seconds interval)
+{
+  auto image = IMAGE_FILES::CImageFileURL::FromFile(file, "video");
+  image.AddOption(type, std::to_string(number));
+  image.AddOption("interval", std::to_string(interval.count()));
+  return image.ToCacheKey();
+}
+
+std::unique_ptr<CTexture> LoadStrip(const std::string& file,
+                                    unsigned int strip,
+                                    std::chrono::seconds interval)
+{
+  const CFileItem item{file, false};
+  return CDVDFileInfo::ExtractThumbStripToTexture(
+      item, interval * strip * TILES_PER_STRIP, interval, CVideoSeekPreview::COLUMNS,
+      CVideoSeekPreview::ROWS, CVideoSeekPreview::TILE_WIDTH, CVideoSeekPreview::TILE_HEIGHT);
+}
+
+std::unique_ptr<CTexture> LoadTile(const std::string& file,
+                                   unsigned int tile,
+                                   std::chrono::seconds interval)
+{
+  const std::string stripImage = GetImage(file, "seekstrip", tile / TILES_PER_STRIP, interval);
+  auto textureCache = CServiceBroker::GetTextureCache();
+  bool needsRecaching = false;
+  const std::string cachedStrip = textureCache->CheckCachedImage(stripImage, needsRecaching);
+  if (cachedStrip.empty())
+  {
+    // making the strip takes a while, there is no preview until it is done
+    textureCache->BackgroundCacheImage(stripImage);
+    return {};
+  }
+
+  // raw cached images may be compressed, the tiles can't be cut from those
+  if (URIUtils::HasExtension(cachedStrip, ".dds"))
+    return {};
+
+  auto strip = CTexture::LoadFromFile(cachedStrip);
+  if (!strip || !strip->GetPixels())
+    return {};
+
+  // the cache may have scaled the strip
+  const unsigned int width = strip->GetWidth() / CVideoSeekPreview::COLUMNS;
+  const unsigned int height = strip->GetHeight() / CVideoSeekPreview::ROWS;
+  if (width == 0 || height == 0)
+    return {};
+
+  auto result = CTexture::CreateTexture(width, height);
+  result->SetAlpha(false);
+  const unsigned int index = tile % TILES_PER_STRIP;
+  const uint8_t* src = strip->GetPixels() +
+                       (index / CVideoSeekPreview::COLUMNS) * height * strip->GetPitch() +
+                       (index % CVideoSeekPreview::COLUMNS) * width * 4;
+  for (unsigned int y = 0; y < height; y++)
+    std::memcpy(result->GetPixels() + y * result->GetPitch(), src + y * strip->GetPitch(),
+                width * 4);
+  return result;
+}
+} // namespace
+
+bool CVideoSeekPreview::IsEnabled(const CFileItem& item)
+{
+  return GetInterval().count() > 0 && item.HasVideoInfoTag() &&
+         item.GetVideoInfoTag()->m_iDbId > 0 && !URIUtils::IsStack(item.GetDynPath()) &&
+         CServiceBroker::GetSettingsComponent()->GetSettings()->GetBool(
+             CSettings::SETTING_MYVIDEOS_EXTRACTTHUMB) &&
+         CDVDFileInfo::CanExtract(item);
+}
+
+void CVideoSeekPreview::CacheStrips(const CFileItem& item, std::chrono::milliseconds duration)
+{
+  const std::chrono::seconds interval = GetInterval();
+  if (interval.count() <= 0 || duration.count() <= 0)
+    return;
+
+  const auto strips = static_cast<unsigned int>(duration / (interval * TILES_PER_STRIP)) + 1;
+  auto textureCache = CServiceBroker::GetTextureCache();
+  for (unsigned int strip = 0; strip < strips; strip++)
+    textureCache->BackgroundCacheImage(GetImage(item.GetDynPath(), "seekstrip", strip, interval));
+}
+
+std::string CVideoSeekPreview::GetTileImage(const CFileItem& item, std::chrono::milliseconds time)
+{
+  const std::chrono::seconds interval = GetInterval();
+  if (time.count() < 0 || !IsEnabled(item))
+    return {};
+
+  return GetImage(item.GetDynPath(), "seektile", static_cast<unsigned int>(time / interval),
+                  interval);
+}
+
+std::unique_ptr<CTexture> CVideoSeekPreview::Load(const IMAGE_FILES::CImageFileURL& imageFile)
+{
+  const std::chrono::seconds interval{GetNumber(imageFile, "interval")};
+  if (interval.count() == 0)
+    return {};
+
+  if (!imageFile.GetOption("seekstrip").empty())
+    return LoadStrip(imageFile.GetTargetFile(), GetNumber(imageFile, "seekstrip"), interval);
+  if (!imageFile.GetOption("seektile").empty())
+    return LoadTile(imageFile.GetTargetFile(), GetNumber(imageFile, "seektile"), interval);
+  return {};
+}
+
+} // namespace KODI::VIDEO
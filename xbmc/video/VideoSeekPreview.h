@@ -0,0 +1,65 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+class CFileItem;
+class CTexture;
+
+namespace IMAGE_FILES
+{
+class CImageFileURL;
+}
+
+namespace KODI::VIDEO
+{
+/*!
+ * @brief Small frames of a video to preview the target of a seek.
+ *
+ * A background job takes a frame every few seconds and puts them together into strips of 8x8
+ * tiles, which go through the texture cache like any other image. The tile of a position is cut
+ * from its cached strip, so showing a preview never touches a decoder.
+ */
+class CVideoSeekPreview
+{
+public:
+  static constexpr unsigned int COLUMNS = 8;
+  static constexpr unsigned int ROWS = 8;
+  static constexpr unsigned int TILE_WIDTH = 160;
+  static constexpr unsigned int TILE_HEIGHT = 90;
+
+  /*!
+   * @brief Whether previews are made for an item, only library videos get them.
+   */
+  static bool IsEnabled(const CFileItem& item);
+
+  /*!
+   * @brief Queue the strips of an item that are not cached yet.
+   * @param duration length of the video
+   */
+  static void CacheStrips(const CFileItem& item, std::chrono::milliseconds duration);
+
+  /*!
+   * @brief Get the preview image of a position.
+   * @return the image url, empty if the item has no previews
+   */
+  static std::string GetTileImage(const CFileItem& item, std::chrono::milliseconds time);
+
+  /*!
+   * @brief Load a strip or a tile for the image loader of generated video images.
+   * @return the texture, nullptr if the image is not a preview or could not be made. A tile is
+   * only made if its strip is cached already.
+   */
+  static std::unique_ptr<CTexture> Load(const IMAGE_FILES::CImageFileURL& imageFile);
+};
+
+} // namespace KODI::VIDEO
@@ -38,6 +38,7 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <set>
 #include <utility>
 
 using namespace KODI;
@@ -58,6 +59,8 @@ void CVideoThumbLoader::OnLoaderStart()
 {
   m_videoDatabase->Open();
   m_artCache.clear();
+  m_streamDetailsCache.clear();
+  PrefetchLibraryData();
   CThumbLoader::OnLoaderStart();
 }
 
@@ -65,6 +68,7 @@ void CVideoThumbLoader::OnLoaderFinish()
 {
   m_videoDatabase->Close();
   m_artCache.clear();
+  m_streamDetailsCache.clear();
   CThumbLoader::OnLoaderFinish();
 }
 
@@ -188,7 +192,7 @@ bool CVideoThumbLoader::LoadItemCached(CFileItem* pItem)
             VIDEO::IsVideo(
                 *pItem))) // Some other video file for which we haven't yet got any database details
     {
-      if (m_videoDatabase->GetStreamDetails(*pItem))
+      if (GetStreamDetails(*pItem))
         pItem->SetInvalid();
     }
   }
@@ -462,7 +466,7 @@ bool CVideoThumbLoader::FillLibraryArt(CFileItem &item)
               artwork))
         item.AppendArt(artwork);
     }
-    else if (m_videoDatabase->GetArtForItem(tag.m_iDbId, tag.m_type, artwork) && !artwork.empty())
+    else if (GetLibraryArt(tag.m_iDbId, tag.m_type, artwork) && !artwork.empty())
     {
       item.AppendArt(artwork);
     }
@@ -685,3 +689,70 @@ const KODI::ART::Artwork& CVideoThumbLoader::GetArtFromCache(const std::string&
   }
   return it->second;
 }
+
+void CVideoThumbLoader::PrefetchLibraryData()
+{
+  // the same conditions as LoadItemCached() and FillLibraryArt()
+  std::map<MediaType, std::set<int>> artIds;
+  std::set<int> fileIds;
+  for (const auto& item : m_vecItems)
+  {
+    if (!item->HasVideoInfoTag() || item->IsShareOrDrive() || item->IsParentFolder())
+      continue;
+
+    const CVideoInfoTag& tag = *item->GetVideoInfoTag();
+    if (!tag.HasStreamDetails() && tag.m_iFileId >= 0)
+      fileIds.insert(tag.m_iFileId);
+
+    if (item->GetProperty("libraryartfilled").asBoolean() || tag.m_iDbId < 0 ||
+        tag.m_type.empty() || VIDEO::IsVideoAssetFile(*item))
+      continue;
+
+    artIds[tag.m_type].insert(tag.m_iDbId);
+    if ((tag.m_type == MediaTypeEpisode || tag.m_type == MediaTypeSeason) && tag.m_iIdShow >= 0)
+      artIds[MediaTypeTvShow].insert(tag.m_iIdShow);
+    if (tag.m_type == MediaTypeEpisode && tag.m_iSeason > -1)
+      artIds[MediaTypeSeason].insert(tag.m_iIdSeason);
+    else if (tag.m_type == MediaTypeMovie && tag.m_set.GetID() >= 0)
+      artIds[MediaTypeVideoCollection].insert(tag.m_set.GetID());
+  }
+
+  for (const auto& [type, ids] : artIds)
+  {
+    std::map<int, KODI::ART::Artwork> art;
+    if (!m_videoDatabase->GetArtForItems(ids, type, art))
+      continue;
+    for (auto& [id, artwork] : art)
+      m_artCache.try_emplace(std::make_pair(type, id), std::move(artwork));
+  }
+
+  if (!fileIds.empty())
+    m_videoDatabase->GetStreamDetailsForFiles(fileIds, m_streamDetailsCache);
+}
+
+bool CVideoThumbLoader::GetLibraryArt(int id, const MediaType& type, KODI::ART::Artwork& art)
+{
+  const auto it = m_artCache.find(std::make_pair(type, id));
+  if (it == m_artCache.end())
+    return m_videoDatabase->GetArtForItem(id, type, art);
+
+  art.insert(it->second.begin(), it->second.end());
+  return true;
+}
+
+bool CVideoThumbLoader::GetStreamDetails(CFileItem& item)
+{
+  if (item.HasVideoInfoTag())
+  {
+    CVideoInfoTag& tag = *item.GetVideoInfoTag();
+    const auto it = m_streamDetailsCache.find(tag.m_iFileId);
+    if (it != m_streamDetailsCache.end())
+    {
+      tag.m_streamDetails = it->second;
+      if (tag.m_streamDetails.GetVideoDuration() > 0)
+        tag.SetDuration(tag.m_streamDetails.GetVideoDuration());
+      return tag.m_streamDetails.HasItems();
+    }
+  }
+  return m_videoDatabase->GetStreamDetails(item);
+}
@@ -11,11 +11,11 @@
 #include "FileItem.h"
 #include "ThumbLoader.h"
 #include "utils/Artwork.h"
+#include "utils/StreamDetails.h"
 
 #include <map>
 #include <vector>
 
-class CStreamDetails;
 class CVideoDatabase;
 class EmbeddedArt;
 
@@ -76,6 +76,7 @@ public:
 protected:
   CVideoDatabase *m_videoDatabase;
   ArtCache m_artCache;
+  std::map<int, CStreamDetails> m_streamDetailsCache; ///< by file id, for the items being loaded
 
   /*! \brief Tries to detect missing data/info from a file and adds those
    \param item The CFileItem to process
@@ -85,6 +86,14 @@ protected:
 
   const KODI::ART::Artwork& GetArtFromCache(const std::string& mediaType, const int id);
 
+  /*! \brief Fetch the library art and stream details of all items being loaded, a few queries
+   for the whole list instead of several queries for every item.
+   */
+  void PrefetchLibraryData();
+
+  bool GetLibraryArt(int id, const MediaType& type, KODI::ART::Artwork& art);
+  bool GetStreamDetails(CFileItem& item);
+
 private:
   int SetDetailsForItem(CVideoInfoTag& details, const KODI::ART::Artwork& artwork);
 };
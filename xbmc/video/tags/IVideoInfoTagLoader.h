@@ -46,6 +46,10 @@ public:
                                       bool prioritise,
                                       std::vector<EmbeddedArt>* art = nullptr) = 0;
 
+  //! \brief Read and parse the info ahead of Load(), without using the scraper.
+  //! \note May be called on another thread than Load(), which must then be given an empty tag.
+  virtual void Prefetch() {}
+
   //! \brief Returns url associated with obtained URL (NFO_URL et al).
   const CScraperUrl& ScraperUrl() const { return m_url; }
 
@@ -69,6 +69,8 @@ CVideoTagLoaderNFO::CVideoTagLoaderNFO(const CFileItem& item,
     m_path = FindNFO(m_item, lookInFolder);
 }
 
+CVideoTagLoaderNFO::~CVideoTagLoaderNFO() = default;
+
 bool CVideoTagLoaderNFO::HasInfo() const
 {
   return !m_path.empty() && CFileUtils::Exists(m_path);
@@ -83,16 +85,20 @@ CInfoScanner::InfoType CVideoTagLoaderNFO::Load(CVideoInfoTag& tag,
   CInfoScanner::InfoType result = NONE;
   if (m_info)
   {
-    CNfoFile nfoReader;
-    result = nfoReader.Create(m_path, m_info, GetNfoIndex(m_item, m_info));
+    const bool prefetched = m_prefetched != nullptr;
+    std::unique_ptr<CNfoFile> nfoReader =
+        prefetched ? std::move(m_prefetched) : std::make_unique<CNfoFile>();
+    result = nfoReader->Create(m_path, m_info, GetNfoIndex(m_item, m_info));
 
-    if (result == FULL || result == COMBINED || result == OVERRIDE)
-      nfoReader.GetDetails(tag, nullptr, prioritise);
+    // the details parsed ahead are those of an empty tag
+    if ((result == FULL || result == COMBINED || result == OVERRIDE) &&
+        (!prefetched || prioritise || !nfoReader->TakeDetails(tag)))
+      nfoReader->GetDetails(tag, nullptr, prioritise);
 
     if (result == URL || result == COMBINED)
     {
-      m_url = nfoReader.ScraperUrl();
-      m_info = nfoReader.GetScraperInfo();
+      m_url = nfoReader->ScraperUrl();
+      m_info = nfoReader->GetScraperInfo();
     }
   }
 
@@ -118,6 +124,15 @@ CInfoScanner::InfoType CVideoTagLoaderNFO::Load(CVideoInfoTag& tag,
   return result;
 }
 
+void CVideoTagLoaderNFO::Prefetch()
+{
+  if (!m_info)
+    return;
+
+  m_prefetched = std::make_unique<CNfoFile>();
+  m_prefetched->Parse(m_path, m_info->Content(), GetNfoIndex(m_item, m_info));
+}
+
 std::string CVideoTagLoaderNFO::FindNFO(const CFileItem& item,
                                         bool movieFolder) const
 {
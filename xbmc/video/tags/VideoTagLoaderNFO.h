@@ -10,9 +10,12 @@
 
 #include "IVideoInfoTagLoader.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
+class CNfoFile;
+
 //! \brief Video tag loader using nfo files.
 class CVideoTagLoaderNFO : public KODI::VIDEO::IVideoInfoTagLoader
 {
@@ -21,7 +24,7 @@ public:
                      ADDON::ScraperPtr info,
                      bool lookInFolder);
 
-  ~CVideoTagLoaderNFO() override = default;
+  ~CVideoTagLoaderNFO() override;
 
   //! \brief Returns whether or not read has info.
   bool HasInfo() const override;
@@ -32,6 +35,9 @@ public:
                               bool prioritise,
                               std::vector<EmbeddedArt>* = nullptr) override;
 
+  //! \brief Read and parse the nfo file, Load() then only looks for scraper urls in it.
+  void Prefetch() override;
+
 protected:
   //! \brief Find nfo file for item
   //! \param item The item to find NFO file for
@@ -39,4 +45,5 @@ protected:
   std::string FindNFO(const CFileItem& item, bool movieFolder) const;
 
   std::string m_path; //!< Path to nfo file
+  std::unique_ptr<CNfoFile> m_prefetched; //!< nfo file parsed by Prefetch()
 };
@@ -0,0 +1,139 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/Database.h"
+#include "dbwrappers/dataset.h"
+#include "settings/AdvancedSettings.h"
+#include "video/VideoDatabaseColumns.h"
+#include "video/VideoDatabaseDDL.h"
+
+#include <cstdio>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+using namespace KODI::DATABASE;
+
+namespace
+{
+class CQueryPlanDatabase : public CDatabase
+{
+public:
+  /*!
+   * \brief The steps of the query plan that read a whole table or view
+   */
+  std::vector<std::string> GetScans(const std::string& sql)
+  {
+    std::vector<std::string> scans;
+    m_pDS->query("EXPLAIN QUERY PLAN " + sql);
+    while (!m_pDS->eof())
+    {
+      const std::string detail = m_pDS->fv("detail").get_asString();
+      if (detail.starts_with("SCAN "))
+        scans.emplace_back(detail.substr(5, detail.find(' ', 5) - 5));
+      m_pDS->next();
+    }
+    m_pDS->close();
+    return scans;
+  }
+
+protected:
+  void CreateTables() override { CVideoDatabaseDDL::CreateTables(*this); }
+  void CreateAnalytics() override { CVideoDatabaseDDL::CreateAnalytics(*this); }
+  int GetSchemaVersion() const override { return 1; }
+  const char* GetBaseDBName() const override { return "MyVideos"; }
+};
+
+struct QueryPlanCase
+{
+  const char* name;
+  std::string sql;
+  std::set<std::string> allowedScans; //!< driving tables of queries that list everything
+};
+
+class TestVideoDatabaseQueryPlans : public ::testing::TestWithParam<QueryPlanCase>
+{
+protected:
+  void SetUp() override
+  {
+    char dir[] = "/tmp/kodi-queryplans-XXXXXX";
+    ASSERT_NE(nullptr, mkdtemp(dir));
+    m_dir = dir;
+
+    DatabaseSettings settings;
+    settings.type = "sqlite3";
+    settings.host = m_dir;
+    ASSERT_EQ(CDatabase::ConnectionState::STATE_CONNECTED,
+              m_db.Connect("MyVideos.db", settings, true));
+  }
+
+  void TearDown() override
+  {
+    m_db.Close();
+    for (const char* suffix : {"", "-wal", "-shm"})
+      std::remove((m_dir + "/MyVideos.db" + suffix).c_str());
+    rmdir(m_dir.c_str());
+  }
+
+  std::string m_dir;
+  CQueryPlanDatabase m_db;
+};
+
+// the navigation and smart playlist queries of the library, as CVideoDatabase builds them
+const QueryPlanCase QUERIES[] = {
+    {"MoviesInSet", "SELECT * FROM movie_view WHERE movie_view.idSet = 3", {}},
+    {"MoviesByGenre",
+     "SELECT * FROM movie_view WHERE movie_view.idMovie IN "
+     "(SELECT media_id FROM genre_link WHERE genre_id = 2 AND media_type = 'movie')",
+     {}},
+    {"MoviesByTag",
+     "SELECT * FROM movie_view WHERE movie_view.idMovie IN "
+     "(SELECT media_id FROM tag_link WHERE tag_id = 2 AND media_type = 'movie')",
+     {}},
+    {"MoviesOfTvShow",
+     "SELECT * FROM movie_view JOIN movielinktvshow ON movielinktvshow.idMovie = "
+     "movie_view.idMovie WHERE movielinktvshow.idShow = 4",
+     {}},
+    {"MovieByFile", "SELECT * FROM movie_view WHERE movie_view.idFile = 5", {}},
+    {"MovieCast",
+     "SELECT actor.name, actor_link.role FROM actor_link JOIN actor ON actor_link.actor_id = "
+     "actor.actor_id WHERE actor_link.media_id = 3 AND actor_link.media_type = 'movie' "
+     "ORDER BY actor_link.cast_order",
+     {}},
+    {"EpisodesOfSeason",
+     "SELECT * FROM episode_view WHERE episode_view.idShow = 4 AND episode_view.c" +
+         std::to_string(VIDEODB_ID_EPISODE_SEASON) + " = 2",
+     {}},
+    {"EpisodeByFile", "SELECT * FROM episode_view WHERE episode_view.idFile = 5", {}},
+    {"MusicVideoByFile", "SELECT * FROM musicvideo_view WHERE musicvideo_view.idFile = 5", {}},
+    {"FileInPath", "SELECT idFile FROM files WHERE idPath = 2 AND strFilename = 'a.mkv'", {}},
+    {"ArtOfMovie", "SELECT type, url FROM art WHERE media_id = 3 AND media_type = 'movie'", {}},
+    // movie_view is driven by its videoversion table
+    {"Sets", "SELECT * FROM movie_view JOIN sets ON movie_view.idSet = sets.idSet", {"vv"}},
+    {"SmartPlaylistGenre",
+     "SELECT * FROM movie_view WHERE EXISTS (SELECT 1 FROM genre_link JOIN genre ON "
+     "genre.genre_id = genre_link.genre_id WHERE genre_link.media_id = movie_view.idMovie AND "
+     "genre.name LIKE 'Drama' AND genre_link.media_type = 'movie')",
+     {"vv"}},
+};
+} // namespace
+
+TEST_P(TestVideoDatabaseQueryPlans, NoTableScans)
+{
+  const QueryPlanCase& query = GetParam();
+  for (const std::string& scan : m_db.GetScans(query.sql))
+    EXPECT_TRUE(query.allowedScans.contains(scan)) << "scan of " << scan << " in " << query.sql;
+}
+
+INSTANTIATE_TEST_SUITE_P(LibraryViews,
+                         TestVideoDatabaseQueryPlans,
+                         ::testing::ValuesIn(QUERIES),
+                         [](const auto& info) { return std::string(info.param.name); });
@@ -63,15 +63,14 @@ bool CVideoSyncGbm::Setup()
   m_crtcId = crtc->GetCrtcId();
   m_fd = drm->GetFileDescriptor();
   int s = drmCrtcGetSequence(m_fd, m_crtcId, &m_sequence, &ns);
-  m_offset = CurrentHostCounter() - ns;
   if (s != 0)
   {
     CLog::Log(LOGWARNING, "CVideoSyncGbm::{}: drmCrtcGetSequence failed ({})", __FUNCTION__, s);
     return false;
   }
 
-  CLog::Log(LOGINFO, "CVideoSyncGbm::{}: opened (fd:{} crtc:{} seq:{} ns:{}:{})", __FUNCTION__,
-            m_fd, m_crtcId, m_sequence, ns, m_offset + ns);
+  CLog::Log(LOGINFO, "CVideoSyncGbm::{}: opened (fd:{} crtc:{} seq:{} ns:{})", __FUNCTION__, m_fd,
+            m_crtcId, m_sequence, ns);
   return true;
 }
 
@@ -101,7 +100,11 @@ void CVideoSyncGbm::Run(CEvent& stopEvent)
     if (sequence == m_sequence)
       continue;
 
-    m_refClock->UpdateClock(sequence - m_sequence, m_offset + ns);
+    // the vblank timestamps are CLOCK_MONOTONIC, the reference clock runs on the host counter
+    const timespec vblankTime = {static_cast<time_t>(ns / 1000000000),
+                                 static_cast<long>(ns % 1000000000)};
+    m_refClock->UpdateClock(sequence - m_sequence,
+                            HostCounterFromClock(CLOCK_MONOTONIC, vblankTime));
     m_sequence = sequence;
   }
 }
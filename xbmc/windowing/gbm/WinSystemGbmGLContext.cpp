@@ -122,11 +122,13 @@ void CWinSystemGbmGLContext::PresentRender(bool rendered, bool videoLayer)
 
   if (rendered || videoLayer)
   {
-    bool async = !videoLayer && m_eglFence;
+    // the commit doesn't block with or without explicit fencing, the video layer needs the
+    // flip done before its previous buffer is released
+    bool async = !videoLayer;
     if (rendered)
     {
 #if defined(EGL_ANDROID_native_fence_sync) && defined(EGL_KHR_fence_sync)
-      if (async)
+      if (async && m_eglFence)
       {
         int fd = m_DRM->TakeOutFenceFd();
         if (fd != -1)
@@ -146,7 +148,7 @@ void CWinSystemGbmGLContext::PresentRender(bool rendered, bool videoLayer)
       }
 
 #if defined(EGL_ANDROID_native_fence_sync) && defined(EGL_KHR_fence_sync)
-      if (async)
+      if (async && m_eglFence)
       {
         int fd = m_eglFence->FlushFence();
         m_DRM->SetInFenceFd(fd);
@@ -21,6 +21,7 @@
 
 #include <drm_fourcc.h>
 #include <drm_mode.h>
+#include <poll.h>
 #include <unistd.h>
 
 using namespace KODI::WINDOWING::GBM;
@@ -130,7 +131,10 @@ void CDRMAtomic::DrmAtomicCommit(int fb_id, int flags, bool rendered, bool video
   if (CServiceBroker::GetLogging().CanLogComponent(LOGWINDOWING))
     m_req->LogAtomicRequest();
 
-  auto ret = drmModeAtomicCommit(m_fd, m_req->Get(), flags | DRM_MODE_ATOMIC_TEST_ONLY, nullptr);
+  // the kernel refuses a page flip event for a test commit
+  auto ret = drmModeAtomicCommit(m_fd, m_req->Get(),
+                                 (flags & ~DRM_MODE_PAGE_FLIP_EVENT) | DRM_MODE_ATOMIC_TEST_ONLY,
+                                 nullptr);
   if (ret < 0)
   {
     CLog::LogF(LOGERROR,
@@ -147,7 +151,9 @@ void CDRMAtomic::DrmAtomicCommit(int fb_id, int flags, bool rendered, bool video
       AddProperty(outputPlane, "FB_ID", fb_id);
   }
 
-  ret = drmModeAtomicCommit(m_fd, m_req->Get(), flags, nullptr);
+  WaitForFlip();
+
+  ret = drmModeAtomicCommit(m_fd, m_req->Get(), flags, &m_flipPending);
   if (ret < 0)
   {
     CLog::LogF(LOGERROR, "atomic commit failed: {}", strerror(errno));
@@ -155,6 +161,8 @@ void CDRMAtomic::DrmAtomicCommit(int fb_id, int flags, bool rendered, bool video
   }
   else
   {
+    m_flipPending = (flags & DRM_MODE_PAGE_FLIP_EVENT) != 0;
+
     // Sync the property cache with values the kernel accepted.
     // This must happen after a successful commit so that
     // GetPropertyValue() returns current state (e.g. CRTC_ID=0
@@ -191,7 +199,13 @@ void CDRMAtomic::FlipPage(struct gbm_bo* bo, bool rendered, bool videoLayer, boo
     }
 
     if (async && !m_need_modeset)
+    {
       flags |= DRM_MODE_ATOMIC_NONBLOCK;
+      // without an in-fence the caller doesn't wait for the out-fence of the previous
+      // commit, so the flip is waited for before the next commit instead
+      if (m_inFenceFd == -1)
+        flags |= DRM_MODE_PAGE_FLIP_EVENT;
+    }
   }
 
   if (m_need_modeset)
@@ -204,6 +218,46 @@ void CDRMAtomic::FlipPage(struct gbm_bo* bo, bool rendered, bool videoLayer, boo
   DrmAtomicCommit(!drm_fb ? 0 : drm_fb->fb_id, flags, rendered, videoLayer);
 }
 
+void CDRMAtomic::PageFlipHandler(
+    int fd, unsigned int frame, unsigned int sec, unsigned int usec, void* data)
+{
+  (void)fd, (void)frame, (void)sec, (void)usec;
+
+  bool* flipPending = static_cast<bool*>(data);
+  *flipPending = false;
+}
+
+void CDRMAtomic::WaitForFlip()
+{
+  if (!m_flipPending)
+    return;
+
+  struct pollfd drm_fds = {
+      m_fd,
+      POLLIN,
+      0,
+  };
+
+  drmEventContext drm_evctx{};
+  drm_evctx.version = DRM_EVENT_CONTEXT_VERSION;
+  drm_evctx.page_flip_handler = PageFlipHandler;
+
+  while (m_flipPending)
+  {
+    // a flip takes a frame, don't hang when the event got lost
+    auto ret = poll(&drm_fds, 1, 1000);
+    if (ret <= 0 || (drm_fds.revents & (POLLHUP | POLLERR)))
+    {
+      CLog::LogF(LOGWARNING, "no page flip event: {}", ret < 0 ? strerror(errno) : "timeout");
+      m_flipPending = false;
+      break;
+    }
+
+    if (drm_fds.revents & POLLIN)
+      drmHandleEvent(m_fd, &drm_evctx);
+  }
+}
+
 bool CDRMAtomic::InitDrm()
 {
   if (!CDRMUtils::OpenDrm(true))
@@ -229,6 +283,7 @@ bool CDRMAtomic::InitDrm()
 
 void CDRMAtomic::DestroyDrm()
 {
+  WaitForFlip();
   CDRMUtils::DestroyDrm();
 }
 
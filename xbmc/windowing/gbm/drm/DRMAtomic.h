@@ -39,7 +39,17 @@ public:
 private:
   void DrmAtomicCommit(int fb_id, int flags, bool rendered, bool videoLayer);
 
+  /*!
+   * \brief Wait for the page flip of the last non-blocking commit without an in-fence.
+   * The kernel rejects a commit while the previous one is pending, so it is waited for
+   * right before the next commit, letting the next frame render during the flip.
+   */
+  void WaitForFlip();
+  static void PageFlipHandler(
+      int fd, unsigned int frame, unsigned int sec, unsigned int usec, void* data);
+
   bool m_need_modeset{true};
+  bool m_flipPending{false};
   bool m_active = true;
 
   class CDRMAtomicRequest
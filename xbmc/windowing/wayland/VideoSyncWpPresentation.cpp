@@ -78,7 +78,6 @@ void CVideoSyncWpPresentation::HandlePresentation(timespec tv, std::uint32_t ref
   }
   m_lastMsc = msc;
 
-  // FIXME use timespec instead of currenthostcounter()? Possibly difficult
-  // due to different clock base
-  m_refClock->UpdateClock(mscDiff, CurrentHostCounter());
+  // the time the frame was presented, not the time the feedback got here
+  m_refClock->UpdateClock(mscDiff, HostCounterFromClock(m_winSystem.GetPresentationClock(), tv));
 }
@@ -96,6 +96,8 @@ public:
 
   using PresentationFeedbackHandler = std::function<void(timespec /* tv */, std::uint32_t /* refresh */, std::uint32_t /* sync output id */, float /* sync output fps */, std::uint64_t /* msc */)>;
   CSignalRegistration RegisterOnPresentationFeedback(const PresentationFeedbackHandler& handler);
+  //! Clock of the presentation feedback timestamps
+  clockid_t GetPresentationClock() const { return m_presentationClock; }
 
   std::vector<std::string> GetConnectedOutputs() override;
 
@@ -34,6 +34,7 @@
 #include "dialogs/GUIDialogMediaFilter.h"
 #include "dialogs/GUIDialogProgress.h"
 #include "dialogs/GUIDialogSmartPlaylistEditor.h"
+#include "filesystem/DirectoryCache.h"
 #include "filesystem/FileDirectoryFactory.h"
 #include "filesystem/MultiPathDirectory.h"
 #include "filesystem/PluginDirectory.h"
@@ -68,6 +69,9 @@
 #include "utils/log.h"
 #include "view/GUIViewState.h"
 
+#include <optional>
+#include <vector>
+
 #define CONTROL_BTNVIEWASICONS       2
 #define CONTROL_BTNSORTBY            3
 #define CONTROL_BTNSORTASC           4
@@ -371,6 +375,8 @@ bool CGUIMediaWindow::OnMessage(CGUIMessage& message)
 
           CFileItemList list(message.GetStringParam());
           list.RemoveDiscCache(GetID());
+          if (URIUtils::IsPlugin(message.GetStringParam()))
+            g_directoryCache.ClearDirectory(CURL(message.GetStringParam()));
           Update(message.GetStringParam());
         }
         else
@@ -606,6 +612,8 @@ void CGUIMediaWindow::ClearFileItems()
   m_viewControl.Clear();
   m_vecItems->Clear();
   m_unfilteredItems->Clear();
+  m_filterIndex.Clear();
+  m_filterIndexEntries.clear();
 }
 
 /*!
@@ -925,6 +933,8 @@ bool CGUIMediaWindow::Update(const std::string &strDirectory, bool updateFilterP
 
   // remember the original (untouched) list of items (for filtering etc)
   m_unfilteredItems->Assign(*m_vecItems);
+  m_filterIndex.Clear();
+  m_filterIndexEntries.clear();
 
   // Cache the list of items if possible
   OnCacheFileItems(*m_vecItems);
@@ -950,7 +960,12 @@ bool CGUIMediaWindow::Refresh(bool clearCache /* = false */)
     return false;
 
   if (clearCache)
+  {
     m_vecItems->RemoveDiscCache(GetID());
+    // plugins may keep their listings in memory for a while, a refresh runs them again
+    if (URIUtils::IsPlugin(strCurrentDirectory))
+      g_directoryCache.ClearDirectory(CURL(strCurrentDirectory));
+  }
 
   bool ret = true;
 
@@ -2007,6 +2022,14 @@ bool CGUIMediaWindow::GetFilteredItems(const std::string &filter, CFileItemList
 
   CFileItemList filteredItems(items.GetPath()); // use the original path - it'll likely be relied on for other things later.
   bool numericMatch = StringUtils::IsNaturalNumber(trimmedFilter);
+  if (!numericMatch)
+  {
+    GetIndexFilteredItems(trimmedFilter, items, filteredItems);
+    items.ClearItems();
+    items.Append(filteredItems);
+    return items.GetObjectCount() > 0;
+  }
+
   for (int i = 0; i < items.Size(); i++)
   {
     CFileItemPtr item = items.Get(i);
@@ -2042,6 +2065,48 @@ bool CGUIMediaWindow::GetFilteredItems(const std::string &filter, CFileItemList
   return items.GetObjectCount() > 0;
 }
 
+void CGUIMediaWindow::GetIndexFilteredItems(std::string_view wordLowerCase,
+                                            const CFileItemList& items,
+                                            CFileItemList& filteredItems)
+{
+  // the items to filter are the unfiltered items, or some of them after the advanced filter
+  if (m_filterIndexEntries.size() != static_cast<size_t>(m_unfilteredItems->Size()))
+  {
+    m_filterIndexEntries.clear();
+    m_filterIndexEntries.reserve(m_unfilteredItems->Size());
+    for (int i = 0; i < m_unfilteredItems->Size(); i++)
+      m_filterIndexEntries.try_emplace(m_unfilteredItems->Get(i).get(), i);
+  }
+
+  std::vector<std::optional<size_t>> entries(items.Size());
+  for (int i = 0; i < items.Size(); i++)
+  {
+    const CFileItem* item = items.Get(i).get();
+    if (i < m_unfilteredItems->Size() && m_unfilteredItems->Get(i).get() == item)
+      entries[i] = i;
+    else if (const auto it = m_filterIndexEntries.find(item); it != m_filterIndexEntries.end())
+      entries[i] = it->second;
+    else
+      continue;
+
+    // labels are formatted again on sort changes, the index only splits the changed ones again
+    m_filterIndex.Set(*entries[i], item->GetLabel());
+  }
+
+  std::vector<bool> matches(m_filterIndex.Size());
+  for (size_t entry : m_filterIndex.Find(wordLowerCase))
+    matches[entry] = true;
+
+  for (int i = 0; i < items.Size(); i++)
+  {
+    const CFileItemPtr& item = items.Get(i);
+    if (item->IsParentFolder() ||
+        (entries[i] ? matches[*entries[i]]
+                    : StringUtils::FindWords(item->GetLabel(), wordLowerCase) != std::string::npos))
+      filteredItems.Add(item);
+  }
+}
+
 bool CGUIMediaWindow::GetAdvanceFilteredItems(CFileItemList &items)
 {
   // don't run the advanced filter if the filter is empty
@@ -13,9 +13,12 @@
 #include "filesystem/VirtualDirectory.h"
 #include "guilib/GUIWindow.h"
 #include "playlists/SmartPlayList.h"
+#include "utils/WordSearchIndex.h"
 #include "view/GUIViewControl.h"
 
 #include <atomic>
+#include <string_view>
+#include <unordered_map>
 
 class CFileItemList;
 class CGUIViewState;
@@ -135,6 +138,16 @@ protected:
    */
   virtual bool GetFilteredItems(const std::string &filter, CFileItemList &items);
 
+  /* \brief Filter the items on their label with the index of the unfiltered items
+   \param wordLowerCase lowercase word to find in the labels
+   \param items the items to filter, the unfiltered items or some of them
+   \param filteredItems the items whose label contains the word and the parent folder item
+   \sa GetFilteredItems
+   */
+  void GetIndexFilteredItems(std::string_view wordLowerCase,
+                             const CFileItemList& items,
+                             CFileItemList& filteredItems);
+
   /* \brief Retrieve the advance filtered item list
   \param items CFileItemList to filter
   \param hasNewItems Whether the filtered item list contains new items
@@ -180,6 +193,8 @@ protected:
   // current path and history
   CFileItemList* m_vecItems;
   CFileItemList* m_unfilteredItems;        ///< \brief items prior to filtering using FilterItems()
+  CWordSearchIndex m_filterIndex; ///< \brief labels of m_unfilteredItems, built when first filtered
+  std::unordered_map<const CFileItem*, size_t> m_filterIndexEntries; ///< \brief item to index entry
   CDirectoryHistory m_history;
   std::unique_ptr<CGUIViewState> m_guiState;
   std::atomic_bool m_vecItemsUpdating = {false};
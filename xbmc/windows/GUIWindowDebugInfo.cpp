@@ -20,17 +20,23 @@
 #include "guilib/GUIFontManager.h"
 #include "guilib/GUITextLayout.h"
 #include "guilib/GUIWindowManager.h"
+#include "input/InputManager.h"
 #include "input/WindowTranslator.h"
+#include "rendering/RenderSystem.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "threads/ThreadRegistry.h"
 #include "utils/CPUInfo.h"
 #include "utils/MemUtils.h"
+#include "utils/SharedStrings.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 #include "windowing/WinSystem.h"
 
 #include <inttypes.h>
 
+using namespace std::chrono_literals;
+
 CGUIWindowDebugInfo::CGUIWindowDebugInfo(void)
   : CGUIDialog(WINDOW_DEBUG_INFO, "", DialogModalityType::MODELESS)
 {
@@ -107,8 +113,11 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
       strCores = "N/A";
     std::string lcAppName = CCompileInfo::GetAppName();
     StringUtils::ToLower(lcAppName);
+    // draw calls of the previous frame, the current one isn't finished yet
+    const unsigned int guiDrawCount = CServiceBroker::GetRenderSystem()->GetLastGUIElementCount();
 #if !defined(TARGET_POSIX)
-    info = StringUtils::Format("LOG: {}{}.log\nMEM: {}/{} KB - FPS: {:2.1f} fps\nCPU: {}{}",
+    info = StringUtils::Format("LOG: {}{}.log\nMEM: {}/{} KB - FPS: {:2.1f} fps - DRAWS: {}\n"
+                               "CPU: {}{}",
                                CSpecialProtocol::TranslatePath("special://logpath"), lcAppName,
                                stat.availPhys / 1024, stat.totalPhys / 1024,
                                CServiceBroker::GetGUI()
@@ -116,13 +125,13 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
                                    .GetInfoProviders()
                                    .GetSystemInfoProvider()
                                    .GetFPS(),
-                               strCores, profiling);
+                               guiDrawCount, strCores, profiling);
 #else
     double dCPU = m_resourceCounter.GetCPUUsage();
     std::string ucAppName = lcAppName;
     StringUtils::ToUpper(ucAppName);
     info = StringUtils::Format("LOG: {}{}.log\n"
-                               "MEM: {}/{} KB - FPS: {:2.1f} fps\n"
+                               "MEM: {}/{} KB - FPS: {:2.1f} fps - DRAWS: {}\n"
                                "CPU: {} (CPU-{} {:4.2f}%{})",
                                CSpecialProtocol::TranslatePath("special://logpath"), lcAppName,
                                stat.availPhys / 1024, stat.totalPhys / 1024,
@@ -131,8 +140,27 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
                                    .GetInfoProviders()
                                    .GetSystemInfoProvider()
                                    .GetFPS(),
-                               strCores, ucAppName, dCPU, profiling);
+                               guiDrawCount, strCores, ucAppName, dCPU, profiling);
 #endif
+    const auto inputLatency = CServiceBroker::GetInputManager().GetInputLatency();
+    info += StringUtils::Format("\nINPUT: {:.1f} ms to present", inputLatency.count() / 1000.0);
+
+    // the busiest subsystems, over a second so the rates don't jump around every frame
+    const auto sampleTime = std::chrono::steady_clock::now();
+    if (sampleTime - m_lastThreadSample >= 1s)
+    {
+      m_lastThreadSample = sampleTime;
+      const auto subsystems = CThreadRegistry::BySubsystem(CThreadRegistry::Sample());
+      m_threadUsage.clear();
+      for (size_t i = 0; i < subsystems.size() && i < 4; ++i)
+      {
+        m_threadUsage += StringUtils::Format("{}{} {:.1f}% ({:.0f}/s)", i > 0 ? ", " : "",
+                                             subsystems[i].subsystem, subsystems[i].cpuPercent,
+                                             subsystems[i].wakeupsPerSecond);
+      }
+    }
+    if (!m_threadUsage.empty())
+      info += "\nTHREADS: " + m_threadUsage;
   }
 
   // render the skin debug info
@@ -154,6 +182,16 @@ void CGUIWindowDebugInfo::Process(unsigned int currentTime, CDirtyRegionList &di
       else
         windowName = window->GetProperty("xmlfile").asString();
       info += "Window: " + windowName + "\n";
+      info += StringUtils::Format(
+          "Conditions evaluated: {}\n",
+          CServiceBroker::GetGUI()->GetInfoManager().GetLastEvaluationCount());
+      const CGUIFrameBudget& budget = CServiceBroker::GetGUI()->GetWindowManager().GetFrameBudget();
+      info += StringUtils::Format("Missed frames: {}, deferred updates: {}\n",
+                                  budget.GetMissedFrames(), budget.GetDeferredUpdates());
+      const SharedValuesStats shared = GetSharedStringsStats();
+      info += StringUtils::Format("Shared strings: {} for {} uses, {} KB, {} KB saved\n",
+                                  shared.values, shared.references, shared.bytes / 1024,
+                                  shared.savedBytes / 1024);
       // transform the mouse coordinates to this window's coordinates
       CServiceBroker::GetWinSystem()->GetGfxContext().SetScalingResolution(window->GetCoordsRes(), true);
       point.x *= CServiceBroker::GetWinSystem()->GetGfxContext().GetGUIScaleX();
@@ -13,6 +13,9 @@
 #include "platform/posix/PosixResourceCounter.h"
 #endif
 
+#include <chrono>
+#include <string>
+
 class CGUITextLayout;
 
 class CGUIWindowDebugInfo :
@@ -28,6 +31,8 @@ protected:
   void UpdateVisibility() override;
 private:
   CGUITextLayout *m_layout;
+  std::string m_threadUsage;
+  std::chrono::steady_clock::time_point m_lastThreadSample;
 #ifdef TARGET_POSIX
   CPosixResourceCounter m_resourceCounter;
 #endif
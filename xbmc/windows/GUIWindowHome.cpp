@@ -11,15 +11,21 @@
 #include "ServiceBroker.h"
 #include "application/ApplicationComponents.h"
 #include "application/ApplicationPlayer.h"
+#include "guilib/GUIAction.h"
+#include "guilib/GUIButtonControl.h"
 #include "guilib/GUIComponent.h"
+#include "guilib/GUIStaticItem.h"
 #include "guilib/GUIWindowManager.h"
+#include "guilib/IGUIContainer.h"
 #include "guilib/WindowIDs.h"
+#include "input/WindowTranslator.h"
 #include "input/actions/Action.h"
 #include "input/actions/ActionIDs.h"
 #include "interfaces/AnnouncementManager.h"
 #include "jobs/JobManager.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/ExecString.h"
 #include "utils/RecentlyAddedJob.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
@@ -178,3 +184,43 @@ bool CGUIWindowHome::OnMessage(CGUIMessage& message)
 
   return CGUIWindow::OnMessage(message);
 }
+
+void CGUIWindowHome::FrameMove()
+{
+  CGUIWindow::FrameMove();
+
+  // the window behind the focused menu entry is likely to be opened next, load it while idle
+  const CGUIControl* control = GetFocusedControl();
+  const void* entry = control;
+  const CGUIAction* actions = nullptr;
+  if (control && control->IsContainer())
+  {
+    const auto item = static_cast<const IGUIContainer*>(control)->GetListItem(0);
+    const auto* staticItem = dynamic_cast<const CGUIStaticItem*>(item.get());
+    entry = item.get();
+    if (staticItem)
+      actions = &staticItem->GetClickActions();
+  }
+  else if (control && control->GetControlType() == CGUIControl::GUICONTROL_BUTTON)
+    actions = &static_cast<const CGUIButtonControl*>(control)->GetClickActions();
+
+  if (entry == m_focusedEntry)
+    return;
+  m_focusedEntry = entry;
+
+  if (!actions)
+    return;
+
+  for (const auto& action : actions->GetActions())
+  {
+    const CExecString exec(action.GetAction());
+    if (exec.IsValid() && StringUtils::EqualsNoCase(exec.GetFunction(), "activatewindow") &&
+        !exec.GetParams().empty())
+    {
+      const int windowId = CWindowTranslator::TranslateWindow(exec.GetParams()[0]);
+      if (windowId != WINDOW_INVALID)
+        CServiceBroker::GetGUI()->GetWindowManager().PreloadWindow(windowId);
+      break;
+    }
+  }
+}
@@ -30,6 +30,7 @@ public:
 
   bool OnMessage(CGUIMessage& message) override;
   bool OnAction(const CAction &action) override;
+  void FrameMove() override;
 
   void OnJobComplete(unsigned int jobID, bool success, CJob *job) override;
 private:
@@ -38,4 +39,5 @@ private:
 
   bool m_recentlyAddedRunning = false;
   int m_cumulativeUpdateFlag = 0;
+  const void* m_focusedEntry = nullptr; // menu entry whose target was last preloaded
 };